@@ -0,0 +1,10204 @@
+	.file	"init.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -m64 -mtune=generic -march=x86-64 -g3 -Og -fvisibility=hidden -ftrapv -fstack-clash-protection -fno-omit-frame-pointer -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "Lib/munit_test/init.c"
+	.globl	munit_test_initialize
+	.hidden	munit_test_initialize
+	.type	munit_test_initialize, @function
+munit_test_initialize:
+.LFB22:
+	.file 1 "Lib/munit_test/init.c"
+	.loc 1 11 1 view -0
+	.cfi_startproc
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	.loc 1 12 5 view .LVU1
+	call	test_unittest_initialize@PLT	#
+.LVL0:
+	.loc 1 13 5 view .LVU2
+	call	test_memory_initialize@PLT	#
+.LVL1:
+	.loc 1 14 5 view .LVU3
+	call	test_refcnt_initialize@PLT	#
+.LVL2:
+	.loc 1 16 5 view .LVU4
+	call	test_objects_initialize@PLT	#
+.LVL3:
+	.loc 1 17 5 view .LVU5
+	call	test_protocols_initialize@PLT	#
+.LVL4:
+# Lib/munit_test/init.c:18: }
+	.loc 1 18 1 is_stmt 0 view .LVU6
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE22:
+	.size	munit_test_initialize, .-munit_test_initialize
+	.hidden	munit_test_suites
+	.globl	munit_test_suites
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"/test_unittest"
+.LC1:
+	.string	"/test_memory"
+.LC2:
+	.string	"/test_refcnt"
+.LC3:
+	.string	"/test_objects"
+.LC4:
+	.string	"/test_protocols"
+	.section	.data.rel,"aw"
+	.align 32
+	.type	munit_test_suites, @object
+	.size	munit_test_suites, 192
+munit_test_suites:
+# prefix:
+	.quad	.LC0
+# tests:
+	.quad	test_unittest_tests
+# suites:
+	.quad	0
+# iterations:
+	.long	1
+# options:
+	.long	0
+# prefix:
+	.quad	.LC1
+# tests:
+	.quad	test_memory_tests
+# suites:
+	.quad	0
+# iterations:
+	.long	1
+# options:
+	.long	0
+# prefix:
+	.quad	.LC2
+# tests:
+	.quad	test_refcnt_tests
+# suites:
+	.quad	0
+# iterations:
+	.long	1
+# options:
+	.long	0
+# prefix:
+	.quad	.LC3
+# tests:
+	.quad	0
+# suites:
+	.quad	test_objects_suites
+# iterations:
+	.long	1
+# options:
+	.long	0
+# prefix:
+	.quad	.LC4
+# tests:
+	.quad	0
+# suites:
+	.quad	test_protocols_suites
+# iterations:
+	.long	1
+# options:
+	.long	0
+# prefix:
+	.quad	0
+	.zero	24
+	.text
+.Letext0:
+	.file 2 "Tools/munit/munit.h"
+	.file 3 "Lib/munit_test/unittest.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x3c0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xf
+	.long	.LASF1633
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1578
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1579
+	.uleb128 0x10
+	.byte	0x8
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1580
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1581
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1582
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1583
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1584
+	.uleb128 0x4
+	.long	0x71
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1585
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1586
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1587
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1588
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1589
+	.uleb128 0x12
+	.long	0x9f
+	.uleb128 0x7
+	.long	0x40
+	.byte	0
+	.uleb128 0x4
+	.long	0x94
+	.uleb128 0xa
+	.long	0x39
+	.value	0x195
+	.long	0xc8
+	.uleb128 0x5
+	.long	.LASF1590
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1591
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1592
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1593
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1596
+	.value	0x1a0
+	.byte	0x3
+	.long	0xa4
+	.uleb128 0xb
+	.byte	0x10
+	.value	0x1a2
+	.long	0xf7
+	.uleb128 0x1
+	.long	.LASF1594
+	.value	0x1a3
+	.byte	0x9
+	.long	0x6c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1595
+	.value	0x1a4
+	.byte	0xa
+	.long	0xf7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x6c
+	.uleb128 0x3
+	.long	.LASF1597
+	.value	0x1a5
+	.byte	0x3
+	.long	0xd4
+	.uleb128 0xb
+	.byte	0x10
+	.value	0x1a7
+	.long	0x12b
+	.uleb128 0x1
+	.long	.LASF1594
+	.value	0x1a8
+	.byte	0x9
+	.long	0x6c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1598
+	.value	0x1a9
+	.byte	0x9
+	.long	0x6c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1599
+	.value	0x1aa
+	.byte	0x3
+	.long	0x108
+	.uleb128 0x13
+	.long	0x12b
+	.uleb128 0xa
+	.long	0x39
+	.value	0x1ae
+	.long	0x15a
+	.uleb128 0x5
+	.long	.LASF1600
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1601
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1602
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1603
+	.value	0x1b2
+	.byte	0x3
+	.long	0x13c
+	.uleb128 0x3
+	.long	.LASF1604
+	.value	0x1b4
+	.byte	0x18
+	.long	0x172
+	.uleb128 0x4
+	.long	0x177
+	.uleb128 0xd
+	.long	0xc8
+	.long	0x18b
+	.uleb128 0x7
+	.long	0x18b
+	.uleb128 0x7
+	.long	0x40
+	.byte	0
+	.uleb128 0x4
+	.long	0x137
+	.uleb128 0x3
+	.long	.LASF1605
+	.value	0x1b5
+	.byte	0x12
+	.long	0x19c
+	.uleb128 0x4
+	.long	0x1a1
+	.uleb128 0xd
+	.long	0x40
+	.long	0x1b5
+	.uleb128 0x7
+	.long	0x18b
+	.uleb128 0x7
+	.long	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1606
+	.value	0x1b6
+	.byte	0x11
+	.long	0x9f
+	.uleb128 0xb
+	.byte	0x30
+	.value	0x1b8
+	.long	0x218
+	.uleb128 0x1
+	.long	.LASF1594
+	.value	0x1b9
+	.byte	0x9
+	.long	0x6c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1607
+	.value	0x1ba
+	.byte	0x11
+	.long	0x166
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1608
+	.value	0x1bb
+	.byte	0x12
+	.long	0x190
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1609
+	.value	0x1bc
+	.byte	0x15
+	.long	0x1b5
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1610
+	.value	0x1bd
+	.byte	0x14
+	.long	0x15a
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1611
+	.value	0x1be
+	.byte	0x17
+	.long	0x218
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	0xfc
+	.uleb128 0x3
+	.long	.LASF1612
+	.value	0x1bf
+	.byte	0x3
+	.long	0x1c1
+	.uleb128 0xa
+	.long	0x39
+	.value	0x1c1
+	.long	0x23b
+	.uleb128 0x5
+	.long	.LASF1613
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1614
+	.value	0x1c3
+	.byte	0x3
+	.long	0x229
+	.uleb128 0x3
+	.long	.LASF1615
+	.value	0x1c5
+	.byte	0x1c
+	.long	0x253
+	.uleb128 0x14
+	.long	.LASF1634
+	.byte	0x20
+	.byte	0x2
+	.value	0x1c7
+	.byte	0x8
+	.long	0x2a3
+	.uleb128 0x1
+	.long	.LASF1616
+	.value	0x1c8
+	.byte	0x9
+	.long	0x6c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1617
+	.value	0x1c9
+	.byte	0xe
+	.long	0x2a3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1618
+	.value	0x1ca
+	.byte	0xf
+	.long	0x2a8
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1619
+	.value	0x1cb
+	.byte	0x10
+	.long	0x39
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1610
+	.value	0x1cc
+	.byte	0x15
+	.long	0x23b
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x4
+	.long	0x21d
+	.uleb128 0x4
+	.long	0x247
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1620
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1621
+	.uleb128 0xc
+	.long	0x247
+	.long	0x2c6
+	.uleb128 0xe
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1622
+	.value	0x4aa
+	.byte	0x13
+	.long	0x2bb
+	.uleb128 0xc
+	.long	0x21d
+	.long	0x2dd
+	.uleb128 0xe
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1623
+	.value	0x4ab
+	.byte	0x12
+	.long	0x2d2
+	.uleb128 0x6
+	.long	.LASF1624
+	.value	0x4ac
+	.byte	0x12
+	.long	0x2d2
+	.uleb128 0x6
+	.long	.LASF1625
+	.value	0x4ad
+	.byte	0x12
+	.long	0x2d2
+	.uleb128 0x6
+	.long	.LASF1626
+	.value	0x4af
+	.byte	0x13
+	.long	0x2bb
+	.uleb128 0x6
+	.long	.LASF1627
+	.value	0x4b9
+	.byte	0x13
+	.long	0x2bb
+	.uleb128 0xc
+	.long	0x247
+	.long	0x329
+	.uleb128 0x15
+	.long	0x32
+	.byte	0x5
+	.byte	0
+	.uleb128 0x16
+	.long	0x2c6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xc
+	.long	0x319
+	.uleb128 0x9
+	.byte	0x3
+	.quad	munit_test_suites
+	.uleb128 0x8
+	.long	.LASF1628
+	.value	0x4b9
+	.byte	0x38
+	.uleb128 0x8
+	.long	.LASF1629
+	.value	0x4af
+	.byte	0x36
+	.uleb128 0x8
+	.long	.LASF1630
+	.value	0x4ad
+	.byte	0x33
+	.uleb128 0x8
+	.long	.LASF1631
+	.value	0x4ac
+	.byte	0x33
+	.uleb128 0x8
+	.long	.LASF1632
+	.value	0x4ab
+	.byte	0x35
+	.uleb128 0x17
+	.long	.LASF1635
+	.byte	0x1
+	.byte	0xa
+	.byte	0xd
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x9
+	.quad	.LVL0
+	.long	0x35f
+	.uleb128 0x9
+	.quad	.LVL1
+	.long	0x357
+	.uleb128 0x9
+	.quad	.LVL2
+	.long	0x34f
+	.uleb128 0x9
+	.quad	.LVL3
+	.long	0x347
+	.uleb128 0x9
+	.quad	.LVL4
+	.long	0x33f
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.file 4 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 5 "./nohtyP.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF394
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h"
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF395
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF396
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x6
+	.file 8 "/usr/include/limits.h"
+	.byte	0x3
+	.uleb128 0xcb
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h"
+	.byte	0x3
+	.uleb128 0xc3
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF572
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/local_lim.h"
+	.byte	0x3
+	.uleb128 0xa1
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 20 "/usr/include/linux/limits.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF636
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF643
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h"
+	.byte	0x3
+	.uleb128 0xc7
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0x8
+	.long	.LASF663
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF714
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF715
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF775
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF789
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF790
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF791
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF792
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF814
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.file 35 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF816
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF833
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF846
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF851
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF855
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF872
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF873
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF874
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF886
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF893
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF894
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF972
+	.file 52 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF995
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1031
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 57 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1062
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x3a
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 60 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3c
+	.file 61 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1069
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1132
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.file 64 "/usr/include/inttypes.h"
+	.byte	0x3
+	.uleb128 0x6b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 65 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x135
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1344
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1345
+	.byte	0x4
+	.byte	0x4
+	.file 68 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 69 "/usr/include/stdio.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1378
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1379
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1380
+	.byte	0x4
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1381
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1382
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1383
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF390
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unittest.h.2.f0a7d71e5425ff1436838cf2eea9b2ab,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.23.3c23ae3e8f372a0298be6ce978307bc7,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.32.6a1c51cbc8834927c9b529a347d7b23f,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF571
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix1_lim.h.32.a7cb894e219b90f9f73cd9217f417c40,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF602
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.25.97ee4129efb08ad296101237bcd3401b,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF606
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.3.0a3ae0fffe30e22dfdd77ac2c1b1fbdd,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF620
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.42.a403368f4a1bbbff510e22bd9037c5aa,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2a
+	.long	.LASF621
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF622
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF623
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF624
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF625
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF626
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF627
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF633
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF635
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.84.535be492ad9773d11e46b49da2c4d18d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF642
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix2_lim.h.23.56b9c4f885cbac0b652f53ee56b244b1,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF662
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.60.7bfe30ae3ff4e90f07238e284348f8e7,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF664
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF666
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF668
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF670
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF672
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF674
+	.byte	0x6
+	.uleb128 0x62
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF676
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF678
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF680
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF682
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF684
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF686
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF688
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF690
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF692
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF694
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF696
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF570
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF699
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF713
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF730
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF772
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF774
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF788
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.f6fdfdd3074dba759703a90896f28cf6,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF820
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF822
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF824
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF828
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF832
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF845
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF850
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF867
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF871
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF885
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF889
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.nohtyP.h.97.2e0fa8bba9384abbe6f78eb6f8754f10,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x342
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x34b
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x808
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x809
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x80a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x933
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x93d
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x95b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x95d
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x95f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x975
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x979
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x97b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x97d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x97e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x97f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x980
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x983
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x984
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x985
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x986
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x987
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x9b5
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x9b7
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x9bb
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x9be
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x9c0
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x9c4
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9c9
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9d2
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9d3
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x9d4
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x9d6
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x9d7
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x9d8
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x9de
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9e3
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e8
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9e9
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x9eb
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x9ec
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x9f2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x9fa
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x9fb
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x9fc
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xa02
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xa03
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xa04
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xa06
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xa08
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xa0b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xa14
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xa1b
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xa1c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xa1d
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xa1f
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xa21
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xa24
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xa2d
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xa3c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xa3d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xa3e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xa40
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xa42
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xa44
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xa47
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xa50
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xa51
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xa55
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xa57
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xa58
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xa59
+	.long	.LASF971
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.2a7f4947d4b7296e7e393bf9a618c3c1,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF990
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF991
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF992
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1004
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1016
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1023
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1030
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1052
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1058
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1061
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.31.44de592716652d75a04e2faa46853d09,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1064
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1068
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1131
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.47.1ef7fb496f1b65128a348b451b57d412,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1140
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.inttypes.h.23.2397f598c39b8a2316c758c5353fd94b,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1298
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.114.92fe5c078131265938a549edd1319448,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1342
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.310.45d0a216137ebcf1d6d874c8ac8a068a,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1360
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.f07083f9b666a9e5c52a336c758fdd72,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1373
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1374
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF992
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1376
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1374
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF992
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1375
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1391
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.93.8171f82adf48af92ec67424d5f5b709c,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1400
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1407
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1412
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1416
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF1417
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unittest.h.26.cfd313572d0c5f6e4458388009f5c7dd,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x354
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x468
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x470
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x477
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1577
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1609:
+	.string	"tear_down"
+.LASF914:
+	.string	"_ypStringLib_ENC_CODE_LATIN_1 (1u)"
+.LASF1053:
+	.string	"__ldiv_t_defined 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF679:
+	.string	"SHRT_MAX"
+.LASF1060:
+	.string	"alloca"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1453:
+	.string	"_STRINGIFY27(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A"
+.LASF1553:
+	.string	"assert_eq_same_type(a,b) do { ypObject *_ypmt_EQ_TYPE_a = (a); ypObject *_ypmt_EQ_TYPE_b = (b); _assert_eq_same_type(_ypmt_EQ_TYPE_a, _ypmt_EQ_TYPE_b, \"%s\", \"%s\", #a, #b); } while (0)"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF984:
+	.string	"_WCHAR_T_DEFINED "
+.LASF674:
+	.string	"CHAR_MIN SCHAR_MIN"
+.LASF1420:
+	.string	"yp_ARCH_64_BIT 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF680:
+	.string	"SHRT_MAX __SHRT_MAX__"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1209:
+	.string	"PRIXLEAST8 \"X\""
+.LASF1473:
+	.string	"_COMMA_REPEAT13(x) x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF398:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1237:
+	.string	"SCNdFAST8 \"hhd\""
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF722:
+	.string	"__SQUAD_TYPE long int"
+.LASF1073:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF818:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1354:
+	.string	"munit_assert_not_null(ptr) munit_assert_ptr(ptr, !=, NULL)"
+.LASF1424:
+	.string	"_PP_NARG(prefix,...) _ESC(_PP_ARG_N(prefix, __VA_ARGS__))"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1222:
+	.string	"PRIXMAX __PRI64_PREFIX \"X\""
+.LASF784:
+	.string	"__pid_t_defined "
+.LASF817:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1156:
+	.string	"PRIdFAST64 __PRI64_PREFIX \"d\""
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF629:
+	.string	"_POSIX_THREAD_KEYS_MAX 128"
+.LASF1001:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF631:
+	.string	"_POSIX_THREAD_DESTRUCTOR_ITERATIONS 4"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1066:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1063:
+	.string	"MUNIT_VERSION(major,minor,revision) (((major) << 16) | ((minor) << 8) | (revision))"
+.LASF572:
+	.string	"_BITS_POSIX1_LIM_H 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1620:
+	.string	"_Bool"
+.LASF1138:
+	.string	"munit_uint32_t uint32_t"
+.LASF1536:
+	.ascii	"_assert_typeC_raises_exc(T,a_statement,op,b_statement,excs,v"
+	.ascii	"al_pri,a_fmt,b_fmt,excs_fmt,a_str,b_str,excs_str) do { ypObj"
+	.ascii	"ect *_ypmt_TYPEC_excs[] = {UNPACK excs}; yp_ssize_t _ypmt_TY"
+	.ascii	"PEC_n = yp_lengthof_array(_ypmt_TYPEC_excs); T _ypmt_TYPEC_a"
+	.ascii	"; T _ypmt_TYPEC_b; _assert_raises_exc(_ypmt_TYP"
+	.string	"EC_a = (a_statement), _ypmt_TYPEC_n, _ypmt_TYPEC_excs, a_fmt, excs_fmt, a_str, excs_str); _assert_not_raises_exc(_ypmt_TYPEC_b = (b_statement), b_fmt, b_str); _assert_typeC(_ypmt_TYPEC_a, op, _ypmt_TYPEC_b, val_pri, a_fmt, b_fmt, a_str, b_str); } while (0)"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1258:
+	.string	"SCNuLEAST16 \"hu\""
+.LASF644:
+	.string	"_BITS_POSIX2_LIM_H 1"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF607:
+	.string	"_LINUX_LIMITS_H "
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1622:
+	.string	"munit_test_suites"
+.LASF570:
+	.string	"LLONG_MAX __LONG_LONG_MAX__"
+.LASF1599:
+	.string	"MunitParameter"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1559:
+	.string	"assert_setlike(obj,...) do { ypObject *_ypmt_SET_obj = (obj); ypObject *_ypmt_SET_items[] = {__VA_ARGS__}; char *_ypmt_SET_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_setlike(_ypmt_SET_obj, _ypmt_SET_items, \"%s\", _ypmt_SET_item_strs, #obj); } while (0)"
+.LASF1316:
+	.string	"munit_assert_true(expr) do { if (!MUNIT_LIKELY(expr)) { munit_error(\"assertion failed: \" #expr \" is not true\"); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF589:
+	.string	"_POSIX_PIPE_BUF 512"
+.LASF1590:
+	.string	"MUNIT_OK"
+.LASF1385:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1447:
+	.string	"_STRINGIFY21(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1468:
+	.string	"_COMMA_REPEAT8(x) x, x, x, x, x, x, x, x"
+.LASF1349:
+	.ascii	"munit_assert_memory_equal(size,a,b) do { const unsigned char"
+	.ascii	"* munit_tmp_a_ = (const unsigned char*) (a); const unsigned "
+	.ascii	"char* munit_tmp_b_ = (const unsigned char*) (b); const size_"
+	.ascii	"t munit_tmp_size_ = (size); if (MUNIT_UNLIKELY(memcmp(munit_"
+	.ascii	"tmp_a_, munit_tmp_b_, munit_tmp_size_)) != 0) { size_t munit"
+	.ascii	"_tmp_pos_; for (munit_tmp_pos_ = 0 ; munit_tmp_pos_ < munit_"
+	.ascii	"tmp_size_ ; munit_tmp_pos_++) { if (munit"
+	.string	"_tmp_a_[munit_tmp_pos_] != munit_tmp_b_[munit_tmp_pos_]) { munit_errorf(\"assertion failed: memory %s == %s, at offset %\" MUNIT_SIZE_MODIFIER \"u\", #a, #b, munit_tmp_pos_); break; } } } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF394:
+	.string	"yp_NOHTYP_H "
+.LASF1352:
+	.string	"munit_assert_ptr_not_equal(a,b) munit_assert_ptr(a, !=, b)"
+.LASF1197:
+	.string	"PRIxLEAST8 \"x\""
+.LASF421:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF651:
+	.string	"_POSIX2_LINE_MAX 2048"
+.LASF1331:
+	.string	"munit_assert_float(a,op,b) munit_assert_type(float, \"f\", a, op, b)"
+.LASF396:
+	.string	"_GCC_NEXT_LIMITS_H "
+.LASF976:
+	.string	"__WCHAR_T__ "
+.LASF995:
+	.string	"_STDLIB_H 1"
+.LASF947:
+	.string	"yp_ELSE } } if(_yp_IF_cond == yp_False) { {"
+.LASF1203:
+	.string	"PRIxFAST32 __PRIPTR_PREFIX \"x\""
+.LASF653:
+	.string	"_POSIX2_CHARCLASS_NAME_MAX 14"
+.LASF616:
+	.string	"PIPE_BUF 4096"
+.LASF645:
+	.string	"_POSIX2_BC_BASE_MAX 99"
+.LASF670:
+	.string	"SCHAR_MAX __SCHAR_MAX__"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF688:
+	.string	"UINT_MAX (INT_MAX * 2U + 1U)"
+.LASF1386:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1248:
+	.string	"SCNiLEAST64 __PRI64_PREFIX \"i\""
+.LASF1323:
+	.string	"munit_assert_ushort(a,op,b) munit_assert_type(unsigned short, MUNIT_SHORT_MODIFIER \"u\", a, op, b)"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF907:
+	.string	"_ypObject_HEAD ypObject ob_base"
+.LASF1134:
+	.string	"munit_uint8_t uint8_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF829:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF772:
+	.string	"__FD_SETSIZE 1024"
+.LASF730:
+	.string	"__STD_TYPE typedef"
+.LASF599:
+	.string	"_POSIX_TIMER_MAX 32"
+.LASF1500:
+	.string	"yp_sizeof(x) ((yp_ssize_t)sizeof(x))"
+.LASF612:
+	.string	"MAX_CANON 255"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF950:
+	.string	"yp_ENDIF } } }"
+.LASF1319:
+	.string	"munit_assert_type(T,fmt,a,op,b) munit_assert_type_full(\"\", \"\", T, fmt, a, op, b)"
+.LASF1445:
+	.string	"_STRINGIFY19(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s"
+.LASF1084:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1208:
+	.string	"PRIX64 __PRI64_PREFIX \"X\""
+.LASF1306:
+	.string	"MUNIT_SHORT_MODIFIER \"h\""
+.LASF782:
+	.string	"__uid_t_defined "
+.LASF1492:
+	.string	"_COMMA_REPEAT32(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1099:
+	.string	"INT_FAST8_MAX (127)"
+.LASF910:
+	.string	"_ypObject_REFCNT_IMMORTAL (0x7FFFFFFFu)"
+.LASF719:
+	.string	"__U32_TYPE unsigned int"
+.LASF1384:
+	.string	"__struct_FILE_defined 1"
+.LASF1391:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF1556:
+	.ascii	"_assert_sequence(obj,items,obj_fmt,item_strs,...) do { yp_ss"
+	.ascii	"ize_t _ypmt_SEQ_n = yp_lengthof_array(items); yp_ssize_t _yp"
+	.ascii	"mt_SEQ_i; _assert_len(obj, _ypmt_SEQ_n, obj_fmt, \"%\" PRIss"
+	.ascii	"ize, __VA_ARGS__, _ypmt_SEQ_n); for (_ypmt_SEQ_i = 0; _ypmt_"
+	.ascii	"SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_ac"
+	.ascii	"tual = yp_getindexC(obj, _ypmt_SEQ_i); _assert_not_exception"
+	.ascii	"(_ypmt_SEQ_actual, \"yp_getindexC(\" o"
+	.string	"bj_fmt \", %\" PRIssize \")\", __VA_ARGS__, _ypmt_SEQ_i); _assert_eq_same_type(_ypmt_SEQ_actual, items[_ypmt_SEQ_i], \"yp_getindexC(\" obj_fmt \", %\" PRIssize \")\", \"%s\", __VA_ARGS__, _ypmt_SEQ_i, item_strs[_ypmt_SEQ_i]); yp_decref(_ypmt_SEQ_actual); } } while (0)"
+.LASF1235:
+	.string	"SCNdLEAST32 \"d\""
+.LASF908:
+	.string	"_ypSmallObject_HEAD struct _ypSmallObject ob_base"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1397:
+	.string	"SEEK_SET 0"
+.LASF1491:
+	.string	"_COMMA_REPEAT31(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1490:
+	.string	"_COMMA_REPEAT30(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF952:
+	.string	"yp_WHILE(expression) _yp_WHILE(expression, ((void)0))"
+.LASF419:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF638:
+	.string	"TTY_NAME_MAX 32"
+.LASF1231:
+	.string	"SCNd32 \"d\""
+.LASF1512:
+	.string	"assert_ptr(a,op,b) munit_assert_ptr(a, op, b)"
+.LASF711:
+	.string	"_VA_LIST_DEFINED "
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF781:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1566:
+	.ascii	"_faulty_iter_tests(setup,iter_name,iter_supplier,statement,a"
+	.ascii	"ssertion,tear_down,exc_suffix,statement_str) do { yp_ssize_t"
+	.ascii	" _ypmt_FLT_ITR_len = yp_lenC_not_raises(iter_supplier); if ("
+	.ascii	"_ypmt_FLT_ITR_len < 2) { munit_error(\"iter_supplier must co"
+	.ascii	"ntain at least two entries\"); } _faulty_iter_test_raises(se"
+	.ascii	"tup, iter_name, yp_StopIteration, statement, tear_down, \"ex"
+	.ascii	"c_passthrough\", exc_suffix, yp_StopIteration, statement_str"
+	.ascii	"); _faulty_iter_test_raises(setup, iter_name, new_faulty_ite"
+	.ascii	"r(iter_supplier, 0, yp_SyntaxError, _ypmt_FLT_ITR_len), stat"
+	.ascii	"ement, tear_down, \"fail_start\", exc_suffix, yp_SyntaxError"
+	.ascii	", statement_str); _faulty_iter_test_raises(setup, iter_name,"
+	.ascii	" new_faulty_iter(iter_supplier, 1, yp_SyntaxError, _ypmt_FLT"
+	.ascii	"_ITR_len), statement, tear_down, \"fail_mid\", exc_suffix, y"
+	.ascii	"p_SyntaxError, statement_str); _faulty_iter_test_raises(setu"
+	.ascii	"p, iter_name, new_faulty_iter(iter_supplier, 0, yp_Generator"
+	.ascii	"Exit, _ypmt_FLT_ITR_len), statement, tear_down, \"fail_start"
+	.ascii	"\", exc_suffix, yp_GeneratorExit, statement_str); _faulty_it"
+	.ascii	"er_test_raises(setup, iter_name, new_faulty_iter( iter_suppl"
+	.ascii	"ier, _ypmt_FLT_ITR_len, yp_GeneratorExit, _ypmt_FLT_ITR_len)"
+	.ascii	", statement, tear_down, \"fail_end\", exc_suffix, yp_Generat"
+	.ascii	"orExit, statement_str); _faulty_iter_test_succeeds(setup, it"
+	.ascii	"er_name, new_faulty_iter(iter_supplier, _ypmt_FLT_ITR_len + "
+	.ascii	"1, yp_SyntaxError, 1), statement, assertion, tear_down, \"hi"
+	.ascii	"nt_small\","
+	.string	" exc_suffix, statement_str); _faulty_iter_test_succeeds(setup, iter_name, new_faulty_iter(iter_supplier, _ypmt_FLT_ITR_len + 1, yp_SyntaxError, _ypmt_FLT_ITR_len + 100), statement, assertion, tear_down, \"hint_large\", exc_suffix, statement_str); } while (0)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF975:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1601:
+	.string	"MUNIT_TEST_OPTION_SINGLE_ITERATION"
+.LASF1285:
+	.string	"SCNxFAST8 \"hhx\""
+.LASF410:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1164:
+	.string	"PRIiLEAST64 __PRI64_PREFIX \"i\""
+.LASF1126:
+	.string	"UINT8_C(c) c"
+.LASF569:
+	.string	"LLONG_MIN (-LLONG_MAX-1)"
+.LASF596:
+	.string	"_POSIX_STREAM_MAX 8"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1076:
+	.string	"INT16_MAX (32767)"
+.LASF575:
+	.string	"_POSIX_ARG_MAX 4096"
+.LASF1402:
+	.string	"L_tmpnam 20"
+.LASF739:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF650:
+	.string	"_POSIX2_EXPR_NEST_MAX 32"
+.LASF1048:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1289:
+	.string	"SCNdMAX __PRI64_PREFIX \"d\""
+.LASF1597:
+	.string	"MunitParameterEnum"
+.LASF1522:
+	.string	"assert_not_raises(statement) _assert_not_raises((statement), \"%s\", #statement)"
+.LASF1176:
+	.string	"PRIoLEAST64 __PRI64_PREFIX \"o\""
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF617:
+	.string	"XATTR_NAME_MAX 255"
+.LASF938:
+	.string	"yp_IMMORTAL_FUNCTION_static(name,code,parameters) _yp_IMMORTAL_FUNCTION(static, name, code, parameters)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1136:
+	.string	"munit_uint16_t uint16_t"
+.LASF768:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1365:
+	.string	"_T_PTRDIFF_ "
+.LASF1188:
+	.string	"PRIuLEAST64 __PRI64_PREFIX \"u\""
+.LASF1240:
+	.string	"SCNdFAST64 __PRI64_PREFIX \"d\""
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1557:
+	.ascii	"as"
+	.string	"sert_sequence(obj,...) do { ypObject *_ypmt_SEQ_obj = (obj); ypObject *_ypmt_SEQ_items[] = {__VA_ARGS__}; char *_ypmt_SEQ_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_sequence(_ypmt_SEQ_obj, _ypmt_SEQ_items, \"%s\", _ypmt_SEQ_item_strs, #obj); } while (0)"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF805:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1518:
+	.string	"_assert_not_exception(obj,obj_fmt,...) do { if (yp_isexceptionC(obj)) { munit_errorf(\"assertion failed: !yp_isexceptionC(\" obj_fmt \")\", __VA_ARGS__); } } while (0)"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF966:
+	.string	"yp1(self,method) yp_ ##method(self)"
+.LASF1103:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF727:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1483:
+	.string	"_COMMA_REPEAT23(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF846:
+	.string	"_SYS_SELECT_H 1"
+.LASF1026:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF917:
+	.string	"_ypBaseException_CODE (2u)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF642:
+	.string	"SEM_VALUE_MAX (2147483647)"
+.LASF858:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1345:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF986:
+	.string	"___int_wchar_t_h "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF401:
+	.string	"__USE_ISOC11"
+.LASF1503:
+	.string	"yp_lengthof_array(x) (yp_sizeof(x) / yp_sizeof((x)[0]))"
+.LASF579:
+	.string	"_POSIX_LINK_MAX 8"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1416:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF831:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF713:
+	.string	"__va_list__ "
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1254:
+	.string	"SCNu16 \"hu\""
+.LASF513:
+	.string	"__always_inline"
+.LASF970:
+	.string	"yp4(self,method,a1,a2,a3) yp_ ##method(self, a1, a2, a3)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1032:
+	.string	"__HAVE_FLOAT16 0"
+.LASF968:
+	.string	"yp(self,method,...) yp_ ##method(self, __VA_ARGS__)"
+.LASF1340:
+	.string	"munit_assert_int64(a,op,b) munit_assert_type(munit_int64_t, PRIi64, a, op, b)"
+.LASF1555:
+	.string	"assert_len(obj,expected) do { ypObject *_ypmt_LEN_obj = (obj); yp_ssize_t _ypmt_LEN_expected = (expected); _assert_len(_ypmt_LEN_obj, _ypmt_LEN_expected, \"%s\", \"%s\", #obj, #expected); } while (0)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF632:
+	.string	"PTHREAD_DESTRUCTOR_ITERATIONS _POSIX_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF1595:
+	.string	"values"
+.LASF677:
+	.string	"SHRT_MIN"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1531:
+	.ascii	"assert_raises_exc(statem"
+	.string	"ent,...) do { ypObject *_ypmt_RAISES_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_RAISES_n = yp_lengthof_array(_ypmt_RAISES_expected); _assert_raises_exc((statement), _ypmt_RAISES_n, _ypmt_RAISES_expected, \"%s\", \"%s\", #statement, #__VA_ARGS__); } while (0)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF940:
+	.string	"yp_IMMORTAL_FUNCTION2_static(name,code) _yp_IMMORTAL_FUNCTION5(static, name, code, 0, NULL)"
+.LASF1067:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1218:
+	.string	"PRIiMAX __PRI64_PREFIX \"i\""
+.LASF1153:
+	.string	"PRIdFAST8 \"d\""
+.LASF1305:
+	.string	"MUNIT_CHAR_MODIFIER \"hh\""
+.LASF663:
+	.string	"_GCC_NEXT_LIMITS_H"
+.LASF915:
+	.string	"_ypStringLib_ENC_CODE_UCS_2 (2u)"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1472:
+	.string	"_COMMA_REPEAT12(x) x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1095:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1335:
+	.string	"munit_assert_uint8(a,op,b) munit_assert_type(munit_uint8_t, PRIu8, a, op, b)"
+.LASF1514:
+	.string	"assert_not_null(ptr) munit_assert_not_null(ptr)"
+.LASF749:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF696:
+	.string	"LLONG_MIN (-LLONG_MAX - 1LL)"
+.LASF1600:
+	.string	"MUNIT_TEST_OPTION_NONE"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF798:
+	.string	"_T_SIZE_ "
+.LASF1549:
+	.ascii	"a"
+	.string	"ssert_type_is(obj,expected) do { ypObject *_ypmt_TYPE_obj = (obj); ypObject *_ypmt_TYPE_expected = (expected); _assert_not_exception(_ypmt_TYPE_obj, \"%s\", #obj); _assert_type_is(_ypmt_TYPE_obj, _ypmt_TYPE_expected, \"%s\", \"%s\", #obj, #expected); } while (0)"
+.LASF842:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1577:
+	.string	"SUITE_OF_SUITES_DECLS(name) extern MunitSuite name ##_suites[]; extern void name ##_initialize(void)"
+.LASF850:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1584:
+	.string	"long int"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1539:
+	.string	"assert_ssizeC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_ssize_t, a, op, b, (__VA_ARGS__), PRIssize, \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF585:
+	.string	"_POSIX_NAME_MAX 14"
+.LASF1380:
+	.string	"____mbstate_t_defined 1"
+.LASF672:
+	.string	"UCHAR_MAX (SCHAR_MAX * 2 + 1)"
+.LASF1012:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1122:
+	.string	"INT8_C(c) c"
+.LASF1415:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF809:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF900:
+	.string	"yp_SLICE_DEFAULT yp_SSIZE_T_MIN"
+.LASF1036:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1417:
+	.string	"__STDIO_INLINE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF658:
+	.string	"COLL_WEIGHTS_MAX 255"
+.LASF626:
+	.string	"__undef_OPEN_MAX"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1144:
+	.string	"__PRIPTR_PREFIX \"l\""
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1124:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1527:
+	.string	"assert_isexception_exc assert_raises_exc"
+.LASF1596:
+	.string	"MunitResult"
+.LASF1226:
+	.string	"PRIuPTR __PRIPTR_PREFIX \"u\""
+.LASF1443:
+	.string	"_STRINGIFY17(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q"
+.LASF648:
+	.string	"_POSIX2_BC_STRING_MAX 1000"
+.LASF1009:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1236:
+	.string	"SCNdLEAST64 __PRI64_PREFIX \"d\""
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF944:
+	.string	"_yp_ELIF(expression,decref_expression) } } if(_yp_IF_cond == yp_False) { _yp_IF_expr = (expression); _yp_IF_cond = yp_bool(_yp_IF_expr); decref_expression; if(_yp_IF_cond == yp_True) {"
+.LASF1028:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF698:
+	.string	"ULLONG_MAX"
+.LASF806:
+	.string	"_SIZE_T_DECLARED "
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1591:
+	.string	"MUNIT_FAIL"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1072:
+	.string	"INT16_MIN (-32767-1)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1400:
+	.string	"P_tmpdir \"/tmp\""
+.LASF1318:
+	.ascii	"munit_assert_type_full(prefix,suffix,T,fmt,a,op,b) do { T mu"
+	.ascii	"nit_tmp_a_ = (a); T munit_tmp_b_ = (b); if ("
+	.string	"!(munit_tmp_a_ op munit_tmp_b_)) { munit_errorf(\"assertion failed: %s %s %s (\" prefix \"%\" fmt suffix \" %s \" prefix \"%\" fmt suffix \")\", #a, #op, #b, munit_tmp_a_, #op, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF1321:
+	.string	"munit_assert_uchar(a,op,b) munit_assert_type_full(\"'\\\\x\", \"'\", unsigned char, \"02\" MUNIT_CHAR_MODIFIER \"x\", a, op, b)"
+.LASF1270:
+	.string	"SCNoLEAST16 \"ho\""
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF777:
+	.string	"__ino_t_defined "
+.LASF1608:
+	.string	"setup"
+.LASF828:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1201:
+	.string	"PRIxFAST8 \"x\""
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1232:
+	.string	"SCNd64 __PRI64_PREFIX \"d\""
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF603:
+	.string	"__undef_NR_OPEN "
+.LASF1451:
+	.string	"_STRINGIFY25(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF821:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1058:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF854:
+	.string	"__timeval_defined 1"
+.LASF1371:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF586:
+	.string	"_POSIX_NGROUPS_MAX 8"
+.LASF1104:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF619:
+	.string	"XATTR_LIST_MAX 65536"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1121:
+	.string	"WINT_MAX (4294967295u)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1051:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF662:
+	.string	"RE_DUP_MAX (0x7fff)"
+.LASF666:
+	.string	"CHAR_BIT __CHAR_BIT__"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1568:
+	.ascii	"faulty_iter_tests_exc(setup,iter_name,iter_supplier,statemen"
+	.ascii	"t,assertion,tear_down) do { ypObject *_ypmt_FLT_ITR_supplie"
+	.string	"r = (iter_supplier); char _ypmt_FLT_ITR_statement_str[] = #statement; _faulty_iter_tests((setup), (iter_name), _ypmt_FLT_ITR_supplier, (statement), (assertion), (tear_down), _exc, _ypmt_FLT_ITR_statement_str); yp_decref(_ypmt_FLT_ITR_supplier); } while (0)"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1250:
+	.string	"SCNiFAST16 __PRIPTR_PREFIX \"i\""
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF405:
+	.string	"__USE_POSIX"
+.LASF987:
+	.string	"__INT_WCHAR_T_H "
+.LASF779:
+	.string	"__gid_t_defined "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1162:
+	.string	"PRIiLEAST16 \"i\""
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1308:
+	.string	"MUNIT_PUSH_DISABLE_MSVC_C4127_ "
+.LASF1538:
+	.string	"assert_floatC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_float_t, a, op, b, (__VA_ARGS__), \"lf\", \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1213:
+	.string	"PRIXFAST8 \"X\""
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF847:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1102:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF864:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF602:
+	.string	"_POSIX_CLOCKRES_MIN 20000000"
+.LASF841:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1476:
+	.string	"_COMMA_REPEAT16(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1262:
+	.string	"SCNuFAST16 __PRIPTR_PREFIX \"u\""
+.LASF1022:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF780:
+	.string	"__mode_t_defined "
+.LASF1312:
+	.string	"munit_log(level,msg) munit_logf(level, \"%s\", msg)"
+.LASF1185:
+	.string	"PRIuLEAST8 \"u\""
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1494:
+	.string	"_COMMA_REPEAT34(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1047:
+	.string	"__f32x(x) x ##f32x"
+.LASF1211:
+	.string	"PRIXLEAST32 \"X\""
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF933:
+	.string	"yp_IMMORTAL_BYTES_static(name,value) _yp_IMMORTAL_BYTES(static, name, value)"
+.LASF1458:
+	.string	"_STRINGIFY32(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F"
+.LASF1086:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1580:
+	.string	"unsigned char"
+.LASF1069:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1096:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF610:
+	.string	"ARG_MAX 131072"
+.LASF1475:
+	.string	"_COMMA_REPEAT15(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1309:
+	.string	"MUNIT_POP_DISABLE_MSVC_C4127_ "
+.LASF584:
+	.string	"_POSIX_MQ_PRIO_MAX 32"
+.LASF1521:
+	.string	"_assert_not_raises(statement,statement_fmt,...) do { ypObject *_ypmt_NOT_RAISES_obj = statement; _assert_not_exception(_ypmt_NOT_RAISES_obj, statement_fmt, __VA_ARGS__); } while (0)"
+.LASF955:
+	.string	"yp_WHILE_EXCEPT } if(yp_isexceptionC(_yp_WHILE_cond)) {"
+.LASF1496:
+	.string	"N(...) VA_ARGC(__VA_ARGS__), __VA_ARGS__"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1372:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1541:
+	.ascii	"_assert_bool(obj,value,n"
+	.string	"ot_value,obj_fmt,...) do { if (obj == value) { } else if (obj == not_value) { munit_errorf(\"assertion failed: \" obj_fmt \" == \" #value, __VA_ARGS__); } else { _ypmt_error_exception(obj, \"expected a bool or an exception\", obj_fmt, __VA_ARGS__); } } while (0)"
+.LASF1542:
+	.string	"assert_falsy(obj) do { ypObject *_ypmt_FALSY_result = yp_bool(obj); _assert_bool(_ypmt_FALSY_result, yp_False, yp_True, \"yp_bool(%s)\", #obj); } while (0)"
+.LASF1329:
+	.string	"munit_assert_ullong(a,op,b) munit_assert_type(unsigned long long int, \"llu\", a, op, b)"
+.LASF358:
+	.string	"__k8 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1635:
+	.string	"munit_test_initialize"
+.LASF1588:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF403:
+	.string	"__USE_ISOC95"
+.LASF402:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1123:
+	.string	"INT16_C(c) c"
+.LASF1334:
+	.string	"munit_assert_int8(a,op,b) munit_assert_type(munit_int8_t, PRIi8, a, op, b)"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1278:
+	.string	"SCNx16 \"hx\""
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1149:
+	.string	"PRIdLEAST8 \"d\""
+.LASF1418:
+	.string	"TRUE (1 == 1)"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF814:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1364:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF826:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF412:
+	.string	"__USE_XOPEN2K"
+.LASF678:
+	.string	"SHRT_MIN (-SHRT_MAX - 1)"
+.LASF408:
+	.string	"__USE_POSIX199506"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF654:
+	.string	"BC_BASE_MAX _POSIX2_BC_BASE_MAX"
+.LASF1293:
+	.string	"SCNxMAX __PRI64_PREFIX \"x\""
+.LASF1346:
+	.string	"_STRINGS_H 1"
+.LASF844:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF640:
+	.string	"HOST_NAME_MAX 64"
+.LASF1517:
+	.string	"assert_hashC(a,op,b) munit_assert_type(yp_hash_t, PRIssize, a, op, b)"
+.LASF1529:
+	.ascii	"assert_raises(st"
+	.string	"atement,...) do { ypObject *_ypmt_RAISES_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_RAISES_n = yp_lengthof_array(_ypmt_RAISES_expected); _assert_raises((statement), _ypmt_RAISES_n, _ypmt_RAISES_expected, \"%s\", \"%s\", #statement, #__VA_ARGS__); } while (0)"
+.LASF1091:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1221:
+	.string	"PRIxMAX __PRI64_PREFIX \"x\""
+.LASF512:
+	.string	"__wur "
+.LASF1377:
+	.string	"_STDIO_H 1"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1344:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1253:
+	.string	"SCNu8 \"hhu\""
+.LASF1145:
+	.string	"PRId8 \"d\""
+.LASF1170:
+	.string	"PRIo16 \"o\""
+.LASF1011:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1563:
+	.string	"ead(name,expression,assertion) do { ypObject *(name) = (expression); assertion; yp_decref(name); } while (0)"
+.LASF988:
+	.string	"_GCC_WCHAR_T "
+.LASF1217:
+	.string	"PRIdMAX __PRI64_PREFIX \"d\""
+.LASF1207:
+	.string	"PRIX32 \"X\""
+.LASF1223:
+	.string	"PRIdPTR __PRIPTR_PREFIX \"d\""
+.LASF1271:
+	.string	"SCNoLEAST32 \"o\""
+.LASF789:
+	.string	"__clock_t_defined 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF433:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF983:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF941:
+	.string	"_yp_IF(expression,decref_expression) { ypObject *_yp_IF_expr; ypObject *_yp_IF_cond; { _yp_IF_expr = (expression); _yp_IF_cond = yp_bool(_yp_IF_expr); decref_expression; if(_yp_IF_cond == yp_True) {"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF857:
+	.string	"__NFDBITS"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1070:
+	.string	"__intptr_t_defined "
+.LASF635:
+	.string	"AIO_PRIO_DELTA_MAX 20"
+.LASF1078:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1089:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1286:
+	.string	"SCNxFAST16 __PRIPTR_PREFIX \"x\""
+.LASF1014:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1350:
+	.ascii	"munit_assert_memory_not_equal(size,a,b) do { const unsigned "
+	.ascii	"char* munit_tmp_a_ = (const unsigned char*) (a); const unsig"
+	.ascii	"ned char* munit_tmp_b_ = (const unsigned char*) (b); const s"
+	.ascii	"ize_t munit_tmp_si"
+	.string	"ze_ = (size); if (MUNIT_UNLIKELY(memcmp(munit_tmp_a_, munit_tmp_b_, munit_tmp_size_)) == 0) { munit_errorf(\"assertion failed: memory %s != %s (%zu bytes)\", #a, #b, munit_tmp_size_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF708:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1509:
+	.string	"_assert_ptr(a,op,b,a_fmt,b_fmt,...) _assert_typeC(a, op, b, \"p\", a_fmt, b_fmt, __VA_ARGS__)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1225:
+	.string	"PRIoPTR __PRIPTR_PREFIX \"o\""
+.LASF723:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF415:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1342:
+	.ascii	"munit_assert_double_equal(a,b,precision) do { const double m"
+	.ascii	"unit_tmp_a_ = (a); const double munit_tmp_b_ = (b); const do"
+	.ascii	"uble munit_tmp_diff_ = ((munit_tmp_a_ - munit_tmp_b_) < 0) ?"
+	.ascii	" -(munit_tmp_a_ - munit_tmp_b_) : (munit_tmp_a_ - munit_tmp_"
+	.ascii	"b_)"
+	.string	"; if (MUNIT_UNLIKELY(munit_tmp_diff_ > 1e- ##precision)) { munit_errorf(\"assertion failed: %s == %s (%0.\" #precision \"g == %0.\" #precision \"g)\", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF792:
+	.string	"__timer_t_defined 1"
+.LASF1106:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1233:
+	.string	"SCNdLEAST8 \"hhd\""
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1378:
+	.string	"__need___va_list "
+.LASF1215:
+	.string	"PRIXFAST32 __PRIPTR_PREFIX \"X\""
+.LASF1037:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1575:
+	.string	"INCREMENTAL_RESIZE_LEN 16"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1459:
+	.string	"_STRINGIFY33(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F,G) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F, #G"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF852:
+	.string	"____sigset_t_defined "
+.LASF816:
+	.string	"_ENDIAN_H 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF701:
+	.string	"_ANSI_STDARG_H_ "
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1128:
+	.string	"UINT32_C(c) c ## U"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF422:
+	.string	"__USE_GNU"
+.LASF1515:
+	.string	"assert_intC(a,op,b) munit_assert_type(yp_int_t, PRIint, a, op, b)"
+.LASF1082:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1146:
+	.string	"PRId16 \"d\""
+.LASF924:
+	.string	"_yp_IMMORTAL_HEAD_INIT(type,type_flags,len,data) {(type), 0, (type_flags), _ypObject_REFCNT_IMMORTAL, (len), _ypObject_LEN_INVALID, _ypObject_HASH_INVALID, (data)}"
+.LASF1607:
+	.string	"test"
+.LASF1155:
+	.string	"PRIdFAST32 __PRIPTR_PREFIX \"d\""
+.LASF1441:
+	.string	"_STRINGIFY15(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o"
+.LASF709:
+	.string	"_VA_LIST_ "
+.LASF819:
+	.string	"__BIG_ENDIAN 4321"
+.LASF661:
+	.string	"CHARCLASS_NAME_MAX 2048"
+.LASF895:
+	.string	"ypAPI extern __attribute__((visibility(\"default\")))"
+.LASF1450:
+	.string	"_STRINGIFY24(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x"
+.LASF1039:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1125:
+	.string	"INT64_C(c) c ## L"
+.LASF659:
+	.string	"EXPR_NEST_MAX _POSIX2_EXPR_NEST_MAX"
+.LASF1291:
+	.string	"SCNoMAX __PRI64_PREFIX \"o\""
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1062:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1470:
+	.string	"_COMMA_REPEAT10(x) x, x, x, x, x, x, x, x, x, x"
+.LASF729:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF773:
+	.string	"_BITS_TIME64_H 1"
+.LASF885:
+	.string	"__ONCE_ALIGNMENT "
+.LASF932:
+	.string	"yp_IMMORTAL_INT_static(name,value) _yp_IMMORTAL_INT(static, name, value)"
+.LASF1101:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF753:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1449:
+	.string	"_STRINGIFY23(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w"
+.LASF694:
+	.string	"ULONG_MAX (LONG_MAX * 2UL + 1UL)"
+.LASF1005:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1477:
+	.string	"_COMMA_REPEAT17(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1530:
+	.ascii	"_assert_raises_exc(statement,n,expected,statement_fmt,expect"
+	.ascii	"ed_fmt,...) do { ypObject *exc = yp_None; if (n < 1) { munit"
+	.ascii	"_error(\"missing expected exception in assertion\"); } state"
+	.ascii	"ment; if (!yp_isexceptionC(exc)) { munit_errorf(\"assertion "
+	.ascii	"failed: \""
+	.string	" statement_fmt \"; yp_isexceptionC(exc) (expected \" expected_fmt \")\", __VA_ARGS__); } if (!yp_isexception_arrayC(exc, n, expected)) { munit_errorf(\"assertion failed: \" statement_fmt \"; yp_isexceptionCN(exc, N(\" expected_fmt \"))\", __VA_ARGS__); } } while (0)"
+.LASF568:
+	.string	"MB_LEN_MAX 16"
+.LASF417:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF815:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1320:
+	.string	"munit_assert_char(a,op,b) munit_assert_type_full(\"'\\\\x\", \"'\", char, \"02\" MUNIT_CHAR_MODIFIER \"x\", a, op, b)"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1157:
+	.string	"PRIi8 \"i\""
+.LASF717:
+	.string	"__U16_TYPE unsigned short int"
+.LASF655:
+	.string	"BC_DIM_MAX _POSIX2_BC_DIM_MAX"
+.LASF838:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF974:
+	.string	"__need_NULL "
+.LASF1558:
+	.ascii	"_assert_setlike(obj,items,obj_fmt,item_strs,...) do { yp_ssi"
+	.ascii	"ze_t _ypmt_SET_n = yp_lengthof_array(items); int _ypmt_SET_f"
+	.ascii	"ound[yp_lengthof_array(items)] = {0}; yp_uint64_t _ypmt_SET_"
+	.ascii	"mi_state; ypObject *_ypmt_SET_mi; ypObject *_ypmt_SET_actual"
+	.ascii	"; yp_ssize_t _ypmt_SET_i; _assert_len(obj, _ypmt_SET_n, obj_"
+	.ascii	"fmt, \"%\" PRIssize, __VA_ARGS__, _ypmt_SET_n); _assert_not_"
+	.ascii	"raises(_ypmt_SET_mi = yp_miniiter(obj, &_ypmt_SET_mi_state),"
+	.ascii	" \"yp_miniiter(\" obj_fmt \", &mi_state)\", __VA_ARGS__); wh"
+	.ascii	"ile (_assert_setlike_helper(_ypmt_SET_mi, &_ypmt_SET_mi_stat"
+	.ascii	"e, _ypmt_SET_n, items, &_ypmt_SET_actual , &_ypmt_SET_i)) { "
+	.ascii	"_assert_not_exception(_ypmt_SET_actual, \"yp_miniiter_next(y"
+	.ascii	"p_miniiter(\" obj_fmt \", &mi_state), &mi_state)\", __VA_ARG"
+	.ascii	"S__); if (_ypmt_SET_i >= _ypmt_SET_n) { munit_errorf(\"unexp"
+	.ascii	"ected item yielded from \" obj_fmt, __VA_ARGS__); } if (_ypm"
+	.ascii	"t_SET_found[_ypmt_SET_i]) { munit_errorf( \"%s yielded twice"
+	.ascii	" from \" obj_fmt, item_strs[_ypmt_SET_i], __VA_ARGS__); } _y"
+	.ascii	"pmt_SET_found[_ypmt_SET_i] = TRUE; _assert_same_type(_ypmt_S"
+	.ascii	"ET_actual, items[_ypmt_SET_i], \"<item in \" obj_fmt \">\", "
+	.ascii	"\"%s\", __VA_ARGS__, item_strs[_ypmt_SET_i]); y"
+	.string	"p_decref(_ypmt_SET_actual); } for (_ypmt_SET_i = 0; _ypmt_SET_i < _ypmt_SET_n; _ypmt_SET_i++) { if (!_ypmt_SET_found[_ypmt_SET_i]) { munit_errorf(\"%s not yielded from \" obj_fmt, item_strs[_ypmt_SET_i], __VA_ARGS__); } } yp_decref(_ypmt_SET_mi); } while (0)"
+.LASF1511:
+	.string	"assert_false(expr) munit_assert_false(expr)"
+.LASF1431:
+	.string	"_STRINGIFY5(a,b,c,d,e) #a, #b, #c, #d, #e"
+.LASF1419:
+	.string	"FALSE (0 == 1)"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1552:
+	.string	"_assert_eq_same_type(a,b,a_fmt,b_fmt,...) do { _assert_obj(a, eq, b, a_fmt, b_fmt, __VA_ARGS__); _assert_same_type(a, b, a_fmt, b_fmt, __VA_ARGS__); } while (0)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1632:
+	.string	"test_unittest_initialize"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1489:
+	.string	"_COMMA_REPEAT29(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1383:
+	.string	"__FILE_defined 1"
+.LASF1034:
+	.string	"__HAVE_FLOAT64 1"
+.LASF808:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF592:
+	.string	"_POSIX_SEM_NSEMS_MAX 256"
+.LASF897:
+	.string	"yp_SSIZE_T_MIN (-yp_SSIZE_T_MAX - 1)"
+.LASF803:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF697:
+	.string	"LLONG_MAX"
+.LASF1471:
+	.string	"_COMMA_REPEAT11(x) x, x, x, x, x, x, x, x, x, x, x"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1452:
+	.string	"_STRINGIFY26(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z"
+.LASF827:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1287:
+	.string	"SCNxFAST32 __PRIPTR_PREFIX \"x\""
+.LASF1139:
+	.string	"munit_int64_t int64_t"
+.LASF755:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1501:
+	.string	"yp_offsetof(structType,member) ((yp_ssize_t)offsetof(structType, member))"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1405:
+	.string	"L_ctermid 9"
+.LASF721:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF993:
+	.string	"NULL"
+.LASF656:
+	.string	"BC_SCALE_MAX _POSIX2_BC_SCALE_MAX"
+.LASF886:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF397:
+	.string	"_LIBC_LIMITS_H_ 1"
+.LASF901:
+	.string	"yp_SLICE_LAST yp_SSIZE_T_MAX"
+.LASF1626:
+	.string	"test_objects_suites"
+.LASF409:
+	.string	"__USE_XOPEN"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF432:
+	.string	"_DEFAULT_SOURCE"
+.LASF381:
+	.string	"MUNIT_NO_BUFFER 1"
+.LASF431:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1440:
+	.string	"_STRINGIFY14(a,b,c,d,e,f,g,h,i,j,k,l,m,n) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n"
+.LASF778:
+	.string	"__dev_t_defined "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1425:
+	.ascii	"_PP_ARG_N(prefix,_1,_2,_3,_4,_5,_"
+	.string	"6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66,n,...) prefix ##n"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF903:
+	.string	"yp_HASH_ALGORITHM_SIPHASH13 (1)"
+.LASF608:
+	.string	"NR_OPEN 1024"
+.LASF1502:
+	.string	"yp_sizeof_member(structType,member) yp_sizeof(((structType *)0)->member)"
+.LASF734:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1163:
+	.string	"PRIiLEAST32 \"i\""
+.LASF1016:
+	.string	"__WCOREFLAG 0x80"
+.LASF1118:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF898:
+	.string	"yp_INT_T_MAX LLONG_MAX"
+.LASF1564:
+	.ascii	"_faulty_iter_test_raises(setup,iter_name,iter_expression,sta"
+	.ascii	"tement,tear_down,test_name,exc_suffix,expected,statement_str"
+	.ascii	") do { ypObject *_ypmt_FLT_ITR_expecte"
+	.string	"d[] = {expected}; ypObject *iter_name; UNPACK setup; iter_name = iter_expression; _assert_raises ##exc_suffix(statement, 1, _ypmt_FLT_ITR_expected, \"%s /*\" test_name \"*/\", \"%s\", statement_str, #expected); yp_decref(iter_name); UNPACK tear_down; } while (0)"
+.LASF1241:
+	.string	"SCNi8 \"hhi\""
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF965:
+	.string	"yp_ENDFOR } } yp_decref(_yp_FOR_iter); }"
+.LASF693:
+	.string	"ULONG_MAX"
+.LASF957:
+	.string	"yp_ENDWHILE } }"
+.LASF793:
+	.string	"__need_size_t "
+.LASF704:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1464:
+	.string	"_COMMA_REPEAT4(x) x, x, x, x"
+.LASF960:
+	.string	"yp_FORd(target,expression) _yp_FOR(target, expression, yp_decref(_yp_FOR_expr))"
+.LASF887:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF790:
+	.string	"__clockid_t_defined 1"
+.LASF991:
+	.string	"_BSD_WCHAR_T_"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1030:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF801:
+	.string	"_SIZE_T_ "
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF812:
+	.string	"__need_size_t"
+.LASF1374:
+	.string	"__need_ptrdiff_t"
+.LASF830:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1216:
+	.string	"PRIXFAST64 __PRI64_PREFIX \"X\""
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF686:
+	.string	"INT_MAX __INT_MAX__"
+.LASF1315:
+	.string	"munit_assert(expr) do { if (!MUNIT_LIKELY(expr)) { munit_error(\"assertion failed: \" #expr); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF393:
+	.string	"yp_FUTURE "
+.LASF1361:
+	.string	"_STDDEF_H "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1617:
+	.string	"tests"
+.LASF1116:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1196:
+	.string	"PRIx64 __PRI64_PREFIX \"x\""
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1132:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1272:
+	.string	"SCNoLEAST64 __PRI64_PREFIX \"o\""
+.LASF1131:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF411:
+	.string	"__USE_UNIX98"
+.LASF1625:
+	.string	"test_refcnt_tests"
+.LASF913:
+	.string	"_ypStringLib_ENC_CODE_BYTES (0u)"
+.LASF1454:
+	.string	"_STRINGIFY28(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF614:
+	.string	"NAME_MAX 255"
+.LASF1506:
+	.string	"SUITE_OF_TESTS(name) { \"/\" #name, (name ##_tests), NULL, 1, MUNIT_SUITE_OPTION_NONE }"
+.LASF1528:
+	.string	"_assert_raises(statement,n,expected,statement_fmt,expected_fmt,...) do { ypObject *_ypmt_RAISES_statement = statement; _assert_isexception( _ypmt_RAISES_statement, n, expected, statement_fmt, expected_fmt, __VA_ARGS__); } while (0)"
+.LASF1551:
+	.ascii	"ass"
+	.string	"ert_same_type(a,b) do { ypObject *_ypmt_TYPE_a = (a); ypObject *_ypmt_TYPE_b = (b); _assert_not_exception(_ypmt_TYPE_a, \"%s\", #a); _assert_not_exception(_ypmt_TYPE_b, \"%s\", #b); _assert_same_type(_ypmt_TYPE_a, _ypmt_TYPE_b, \"%s\", \"%s\", #a, #b); } while (0)"
+.LASF1019:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1260:
+	.string	"SCNuLEAST64 __PRI64_PREFIX \"u\""
+.LASF1273:
+	.string	"SCNoFAST8 \"hho\""
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF604:
+	.string	"__undef_LINK_MAX "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF767:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF961:
+	.string	"yp_FOR_return(expression) return yp_decref(_yp_FOR_iter), (expression)"
+.LASF1043:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF624:
+	.string	"__undef_LINK_MAX"
+.LASF1259:
+	.string	"SCNuLEAST32 \"u\""
+.LASF1479:
+	.string	"_COMMA_REPEAT19(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1083:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1129:
+	.string	"UINT64_C(c) c ## UL"
+.LASF769:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1224:
+	.string	"PRIiPTR __PRIPTR_PREFIX \"i\""
+.LASF1029:
+	.string	"__f128(x) x ##f128"
+.LASF870:
+	.string	"__fsblkcnt_t_defined "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1255:
+	.string	"SCNu32 \"u\""
+.LASF951:
+	.string	"_yp_WHILE(expression,decref_expression) { ypObject *_yp_WHILE_expr; ypObject *_yp_WHILE_cond; while(_yp_WHILE_expr = (expression), _yp_WHILE_cond = yp_bool(_yp_WHILE_expr), decref_expression, _yp_WHILE_cond == yp_True) {"
+.LASF692:
+	.string	"LONG_MAX __LONG_MAX__"
+.LASF1592:
+	.string	"MUNIT_SKIP"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF825:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF703:
+	.string	"__GNUC_VA_LIST "
+.LASF627:
+	.string	"ARG_MAX"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1598:
+	.string	"value"
+.LASF871:
+	.string	"__fsfilcnt_t_defined "
+.LASF996:
+	.string	"WNOHANG 1"
+.LASF1357:
+	.string	"munit_malloc(size) munit_malloc_ex(__FILE__, __LINE__, (size))"
+.LASF1195:
+	.string	"PRIx32 \"x\""
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1548:
+	.string	"_assert_type_is(obj,expected,obj_fmt,expected_fmt,...) do { ypObject *_ypmt_TYPE_type_obj = yp_type(obj); _assert_ptr(_ypmt_TYPE_type_obj, ==, expected, \"yp_type(\" obj_fmt \")\", expected_fmt, __VA_ARGS__); } while (0)"
+.LASF1297:
+	.string	"SCNuPTR __PRIPTR_PREFIX \"u\""
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1244:
+	.string	"SCNi64 __PRI64_PREFIX \"i\""
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1171:
+	.string	"PRIo32 \"o\""
+.LASF389:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF571:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1)"
+.LASF611:
+	.string	"LINK_MAX 127"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF967:
+	.string	"yp2(self,method,a1) yp_ ##method(self, a1)"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1394:
+	.string	"_IONBF 2"
+.LASF649:
+	.string	"_POSIX2_COLL_WEIGHTS_MAX 2"
+.LASF1570:
+	.ascii	"define_function(name,code,parameters) yp_pa"
+	.string	"rameter_decl_t _ ##name ##_parameters[] = {UNPACK parameters}; yp_function_decl_t _ ##name ##_declaration = { (code), 0, yp_lengthof_array(_ ##name ##_parameters), _ ##name ##_parameters, NULL, NULL}; ypObject *name = yp_functionC(&_ ##name ##_declaration)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1463:
+	.string	"_COMMA_REPEAT3(x) x, x, x"
+.LASF1474:
+	.string	"_COMMA_REPEAT14(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1565:
+	.ascii	"_faulty_iter_test_succeeds(setup,iter_name,iter_expression,s"
+	.ascii	"tatement,assertion,tear_down,t"
+	.string	"est_name,exc_suffix,statement_str) do { ypObject *iter_name; UNPACK setup; iter_name = iter_expression; _assert_not_raises ##exc_suffix(statement, \"%s /*\" test_name \"*/\", statement_str); UNPACK assertion; yp_decref(iter_name); UNPACK tear_down; } while (0)"
+.LASF1442:
+	.string	"_STRINGIFY16(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p"
+.LASF1093:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1614:
+	.string	"MunitSuiteOptions"
+.LASF1403:
+	.string	"TMP_MAX 238328"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF998:
+	.string	"WSTOPPED 2"
+.LASF868:
+	.string	"__blksize_t_defined "
+.LASF894:
+	.string	"__have_pthread_attr_t 1"
+.LASF929:
+	.string	"yp_IMMORTAL_INT(name,value) _yp_IMMORTAL_INT(, name, value)"
+.LASF691:
+	.string	"LONG_MAX"
+.LASF999:
+	.string	"WEXITED 4"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1467:
+	.string	"_COMMA_REPEAT7(x) x, x, x, x, x, x, x"
+.LASF1281:
+	.string	"SCNxLEAST8 \"hhx\""
+.LASF989:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1613:
+	.string	"MUNIT_SUITE_OPTION_NONE"
+.LASF1589:
+	.string	"double"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1433:
+	.string	"_STRINGIFY7(a,b,c,d,e,f,g) #a, #b, #c, #d, #e, #f, #g"
+.LASF884:
+	.string	"__LOCK_ALIGNMENT "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1618:
+	.string	"suites"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1008:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF385:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1299:
+	.string	"munit_bool _Bool"
+.LASF861:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF613:
+	.string	"MAX_INPUT 255"
+.LASF1519:
+	.string	"assert_not_exception(obj) do { ypObject *_ypmt_NOT_EXC_obj = (obj); _assert_not_exception(_ypmt_NOT_EXC_obj, \"%s\", #obj); } while (0)"
+.LASF1130:
+	.string	"INTMAX_C(c) c ## L"
+.LASF628:
+	.string	"__undef_ARG_MAX"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1347:
+	.ascii	"munit_assert_string_equal(a,b) do { const char* munit_tmp_a_"
+	.ascii	" = a; const char* munit"
+	.string	"_tmp_b_ = b; if (MUNIT_UNLIKELY(strcmp(munit_tmp_a_, munit_tmp_b_) != 0)) { munit_errorf(\"assertion failed: string %s == %s (\\\"%s\\\" == \\\"%s\\\")\", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF641:
+	.string	"MQ_PRIO_MAX 32768"
+.LASF1593:
+	.string	"MUNIT_ERROR"
+.LASF1027:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1466:
+	.string	"_COMMA_REPEAT6(x) x, x, x, x, x, x"
+.LASF1266:
+	.string	"SCNo16 \"ho\""
+.LASF1267:
+	.string	"SCNo32 \"o\""
+.LASF1147:
+	.string	"PRId32 \"d\""
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1532:
+	.ascii	"_assert_typeC_exc(T,a_statement,op,b_statement,val_pri,a_fmt"
+	.ascii	",b_fmt,...) do "
+	.string	"{ T _ypmt_TYPEC_a; T _ypmt_TYPEC_b; _assert_not_raises_exc(_ypmt_TYPEC_a = (a_statement); _ypmt_TYPEC_b = (b_statement), a_fmt \" \" #op \" \" b_fmt, __VA_ARGS__); _assert_typeC(_ypmt_TYPEC_a, op, _ypmt_TYPEC_b, val_pri, a_fmt, b_fmt, __VA_ARGS__); } while (0)"
+.LASF837:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1000:
+	.string	"WCONTINUED 8"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF977:
+	.string	"_WCHAR_T "
+.LASF720:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF695:
+	.string	"LLONG_MIN"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF652:
+	.string	"_POSIX2_RE_DUP_MAX 255"
+.LASF1269:
+	.string	"SCNoLEAST8 \"hho\""
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1110:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1524:
+	.string	"assert_not_raises_exc(statement) _assert_not_raises_exc((statement), \"%s\", #statement)"
+.LASF1097:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF647:
+	.string	"_POSIX2_BC_SCALE_MAX 99"
+.LASF1077:
+	.string	"INT32_MAX (2147483647)"
+.LASF1487:
+	.string	"_COMMA_REPEAT27(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF981:
+	.string	"_WCHAR_T_ "
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF605:
+	.string	"__undef_OPEN_MAX "
+.LASF928:
+	.ascii	"_yp_IMMORTAL_STR_LATIN_1(qual,name,value) static const char "
+	.ascii	"_ ##name ##_dat"
+	.string	"a[] = (value); static struct _ypStringLibObject _ ##name ##_struct = { _yp_IMMORTAL_HEAD_INIT(_ypStr_CODE, _ypStringLib_ENC_CODE_LATIN_1, sizeof(_ ##name ##_data) - 1, (void *)_ ##name ##_data), }; qual ypObject *const _yp_UNUSED name = _yp_CONST_REF(name)"
+.LASF953:
+	.string	"yp_WHILEd(expression) _yp_WHILE(expression, yp_decref(_yp_WHILE_expr))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1288:
+	.string	"SCNxFAST64 __PRI64_PREFIX \"x\""
+.LASF1399:
+	.string	"SEEK_END 2"
+.LASF574:
+	.string	"_POSIX_AIO_MAX 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1109:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1087:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF797:
+	.string	"_SYS_SIZE_T_H "
+.LASF745:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1497:
+	.string	"K(...) (VA_ARGC(__VA_ARGS__) / 2), __VA_ARGS__"
+.LASF609:
+	.string	"NGROUPS_MAX 65536"
+.LASF1544:
+	.string	"yp_is(a,b) ((a) == (b) ? yp_True : yp_False)"
+.LASF1339:
+	.string	"munit_assert_uint32(a,op,b) munit_assert_type(munit_uint32_t, PRIu32, a, op, b)"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1387:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF1181:
+	.string	"PRIu8 \"u\""
+.LASF587:
+	.string	"_POSIX_OPEN_MAX 20"
+.LASF707:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1204:
+	.string	"PRIxFAST64 __PRI64_PREFIX \"x\""
+.LASF1341:
+	.string	"munit_assert_uint64(a,op,b) munit_assert_type(munit_uint64_t, PRIu64, a, op, b)"
+.LASF943:
+	.string	"yp_IFd(expression) _yp_IF(expression, yp_decref(_yp_IF_expr))"
+.LASF1594:
+	.string	"name"
+.LASF906:
+	.string	"_yp_UNPACK(...) __VA_ARGS__"
+.LASF423:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF573:
+	.string	"_POSIX_AIO_LISTIO_MAX 2"
+.LASF1550:
+	.string	"_assert_same_type(a,b,a_fmt,b_fmt,...) do { ypObject *_ypmt_TYPE_type_a = yp_type(a); ypObject *_ypmt_TYPE_type_b = yp_type(b); _assert_ptr(_ypmt_TYPE_type_a, ==, _ypmt_TYPE_type_b, \"yp_type(\" a_fmt \")\", \"yp_type(\" b_fmt \")\", __VA_ARGS__); } while (0)"
+.LASF588:
+	.string	"_POSIX_PATH_MAX 256"
+.LASF856:
+	.string	"__suseconds_t_defined "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF756:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1137:
+	.string	"munit_int32_t int32_t"
+.LASF873:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1205:
+	.string	"PRIX8 \"X\""
+.LASF1465:
+	.string	"_COMMA_REPEAT5(x) x, x, x, x, x"
+.LASF865:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF414:
+	.string	"__USE_XOPEN2K8"
+.LASF1117:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF848:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF757:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF813:
+	.string	"__need_NULL"
+.LASF1375:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF920:
+	.string	"_ypStr_CODE (18u)"
+.LASF1276:
+	.string	"SCNoFAST64 __PRI64_PREFIX \"o\""
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF416:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1210:
+	.string	"PRIXLEAST16 \"X\""
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF911:
+	.string	"_ypObject_HASH_INVALID ((yp_hash_t) - 1)"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1520:
+	.string	"_ypmt_error_exception(exc,non_exc_fmt,obj_fmt,...) do { _assert_not_exception(exc, obj_fmt, __VA_ARGS__); munit_errorf(non_exc_fmt \": \" obj_fmt, __VA_ARGS__); } while (0)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1180:
+	.string	"PRIoFAST64 __PRI64_PREFIX \"o\""
+.LASF581:
+	.string	"_POSIX_MAX_CANON 255"
+.LASF1381:
+	.string	"_____fpos64_t_defined 1"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF391:
+	.string	"yp_MUNIT_TEST_UNITTEST_H "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1404:
+	.string	"FILENAME_MAX 4096"
+.LASF1283:
+	.string	"SCNxLEAST32 \"x\""
+.LASF904:
+	.string	"yp_HASH_ALGORITHM_WYHASH (2)"
+.LASF1343:
+	.string	"_STRING_H 1"
+.LASF1174:
+	.string	"PRIoLEAST16 \"o\""
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF742:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1167:
+	.string	"PRIiFAST32 __PRIPTR_PREFIX \"i\""
+.LASF899:
+	.string	"yp_INT_T_MIN LLONG_MIN"
+.LASF1249:
+	.string	"SCNiFAST8 \"hhi\""
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1581:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF923:
+	.string	"yp_CONST_REF _yp_CONST_REF"
+.LASF1582:
+	.string	"signed char"
+.LASF1044:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1294:
+	.string	"SCNdPTR __PRIPTR_PREFIX \"d\""
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF949:
+	.string	"yp_ELSE_EXCEPT_AS(target) yp_ELSE_EXCEPT ypObject *target = _yp_IF_cond;"
+.LASF601:
+	.string	"_POSIX_TZNAME_MAX 6"
+.LASF1179:
+	.string	"PRIoFAST32 __PRIPTR_PREFIX \"o\""
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF794:
+	.string	"__size_t__ "
+.LASF1482:
+	.string	"_COMMA_REPEAT22(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1561:
+	.string	"assert_mapping(obj,...) do { ypObject *_ypmt_MAP_obj = (obj); ypObject *_ypmt_MAP_items[] = {__VA_ARGS__}; char *_ypmt_MAP_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_mapping(_ypmt_MAP_obj, _ypmt_MAP_items, \"%s\", _ypmt_MAP_item_strs, #obj); } while (0)"
+.LASF1006:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF985:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1279:
+	.string	"SCNx32 \"x\""
+.LASF1191:
+	.string	"PRIuFAST32 __PRIPTR_PREFIX \"u\""
+.LASF791:
+	.string	"__time_t_defined 1"
+.LASF840:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF832:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1396:
+	.string	"EOF (-1)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1111:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF902:
+	.string	"yp_HASH_ALGORITHM_DEFAULT (0)"
+.LASF1631:
+	.string	"test_memory_initialize"
+.LASF1296:
+	.string	"SCNoPTR __PRIPTR_PREFIX \"o\""
+.LASF893:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1187:
+	.string	"PRIuLEAST32 \"u\""
+.LASF400:
+	.string	"_FEATURES_H 1"
+.LASF1046:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF802:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF931:
+	.string	"yp_IMMORTAL_STR_LATIN_1(name,value) _yp_IMMORTAL_STR_LATIN_1(, name, value)"
+.LASF1633:
+	.string	"GNU C17 12.2.0 -m64 -mtune=generic -march=x86-64 -g3 -Og -fvisibility=hidden -ftrapv -fstack-clash-protection -fno-omit-frame-pointer -fasynchronous-unwind-tables"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF872:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF738:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1004:
+	.string	"__WCLONE 0x80000000"
+.LASF964:
+	.string	"yp_FOR_EXCEPT_AS(target) yp_FOR_EXCEPT ypObject *target = _yp_FOR_item;"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF867:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF425:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1206:
+	.string	"PRIX16 \"X\""
+.LASF1020:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1569:
+	.ascii	"sprintf_array(array,fmt,..."
+	.string	") do { yp_ssize_t _ypmt_SPRINTF_len = yp_lengthof_array(array); yp_ssize_t result = (yp_ssize_t)unittest_snprintf( (array), (size_t)_ypmt_SPRINTF_len, fmt, __VA_ARGS__); assert_ssizeC(result, >=, 0); assert_ssizeC(result, <, _ypmt_SPRINTF_len); } while (0)"
+.LASF743:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1035:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1142:
+	.string	"____gwchar_t_defined 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF971:
+	.string	"yp5(self,method,a1,a2,a3,a4) yp_ ##method(self, a1, a2, a3, a4)"
+.LASF1634:
+	.string	"MunitSuite_"
+.LASF1513:
+	.string	"assert_null(ptr) munit_assert_null(ptr)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1545:
+	.string	"yp_is_not(a,b) ((a) != (b) ? yp_True : yp_False)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF735:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1363:
+	.string	"_ANSI_STDDEF_H "
+.LASF620:
+	.string	"RTSIG_MAX 32"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF969:
+	.string	"yp3(self,method,a1,a2) yp_ ##method(self, a1, a2)"
+.LASF1280:
+	.string	"SCNx64 __PRI64_PREFIX \"x\""
+.LASF689:
+	.string	"LONG_MIN"
+.LASF918:
+	.string	"_ypInt_CODE (10u)"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1135:
+	.string	"munit_int16_t int16_t"
+.LASF583:
+	.string	"_POSIX_MQ_OPEN_MAX 8"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1499:
+	.string	"UNPACK(...) __VA_ARGS__"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1140:
+	.string	"munit_uint64_t uint64_t"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1623:
+	.string	"test_unittest_tests"
+.LASF1455:
+	.string	"_STRINGIFY29(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1098:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF869:
+	.string	"__blkcnt_t_defined "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF788:
+	.string	"__key_t_defined "
+.LASF690:
+	.string	"LONG_MIN (-LONG_MAX - 1L)"
+.LASF1353:
+	.string	"munit_assert_null(ptr) munit_assert_ptr(ptr, ==, NULL)"
+.LASF737:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1398:
+	.string	"SEEK_CUR 1"
+.LASF1133:
+	.string	"munit_int8_t int8_t"
+.LASF835:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF736:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1462:
+	.string	"_COMMA_REPEAT2(x) x, x"
+.LASF824:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF934:
+	.string	"yp_IMMORTAL_STR_LATIN_1_static(name,value) _yp_IMMORTAL_STR_LATIN_1(static, name, value)"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF595:
+	.string	"_POSIX_SSIZE_MAX 32767"
+.LASF1481:
+	.string	"_COMMA_REPEAT21(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1407:
+	.string	"FOPEN_MAX 16"
+.LASF726:
+	.string	"__SLONG32_TYPE int"
+.LASF1257:
+	.string	"SCNuLEAST8 \"hhu\""
+.LASF937:
+	.string	"yp_IMMORTAL_FUNCTION(name,code,parameters) _yp_IMMORTAL_FUNCTION(, name, code, parameters)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1075:
+	.string	"INT8_MAX (127)"
+.LASF1189:
+	.string	"PRIuFAST8 \"u\""
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1081:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1460:
+	.string	"_STRINGIFY34(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F,G,H) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F, #G, #H"
+.LASF1230:
+	.string	"SCNd16 \"hd\""
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1573:
+	.string	"obj_array_fill(array,uq,filler) (filler)((uq), yp_lengthof_array(array), (array))"
+.LASF1200:
+	.string	"PRIxLEAST64 __PRI64_PREFIX \"x\""
+.LASF939:
+	.string	"yp_IMMORTAL_FUNCTION2(name,code) _yp_IMMORTAL_FUNCTION5(, name, code, 0, NULL)"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF404:
+	.string	"__USE_ISOCXX11"
+.LASF1173:
+	.string	"PRIoLEAST8 \"o\""
+.LASF1169:
+	.string	"PRIo8 \"o\""
+.LASF1389:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF430:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1071:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1079:
+	.string	"UINT8_MAX (255)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1301:
+	.string	"MUNIT_UNLIKELY(expr) (__builtin_expect ((expr), 0))"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1408:
+	.string	"stdin stdin"
+.LASF1159:
+	.string	"PRIi32 \"i\""
+.LASF1239:
+	.string	"SCNdFAST32 __PRIPTR_PREFIX \"d\""
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1421:
+	.string	"PRIint \"lld\""
+.LASF877:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1351:
+	.string	"munit_assert_ptr_equal(a,b) munit_assert_ptr(a, ==, b)"
+.LASF1368:
+	.string	"_PTRDIFF_T_ "
+.LASF1332:
+	.string	"munit_assert_double(a,op,b) munit_assert_type(double, \"g\", a, op, b)"
+.LASF1088:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1488:
+	.string	"_COMMA_REPEAT28(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1533:
+	.string	"assert_intC_exc(a,op,b) _assert_typeC_exc(yp_int_t, a, op, b, PRIint, \"%s\", \"%s\", #a, #b)"
+.LASF909:
+	.string	"_yp_INLINE_DATA(elemType) elemType ob_inline_data[]"
+.LASF1246:
+	.string	"SCNiLEAST16 \"hi\""
+.LASF1367:
+	.string	"__PTRDIFF_T "
+.LASF849:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF855:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF387:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1057:
+	.string	"EXIT_SUCCESS 0"
+.LASF1194:
+	.string	"PRIx16 \"x\""
+.LASF1184:
+	.string	"PRIu64 __PRI64_PREFIX \"u\""
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF958:
+	.ascii	"_yp_FOR(target,expression,decref_expression) { yp_uint64_t _"
+	.ascii	"yp_FOR_state; ypObject *_yp_FOR_item; int _yp_FOR_iter_exhau"
+	.ascii	"sted = 0; ypObject *_yp_FOR_expr = (expression); ypObject *_"
+	.ascii	"yp_FOR_iter = yp_miniiter(_yp_FOR_expr, &_yp_FOR_state); dec"
+	.ascii	"ref_expression; while(1) { _yp_FOR_item = yp_"
+	.string	"miniiter_next(&_yp_FOR_iter, &_yp_FOR_state); if(yp_isexceptionC(_yp_FOR_item)) { if(yp_isexceptionC(_yp_FOR_iter)) break; if(yp_isexceptionC2(_yp_FOR_item, yp_StopIteration)) _yp_FOR_iter_exhausted = 1; break; } yp_decref(target); target = _yp_FOR_item; {"
+.LASF759:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF636:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF1535:
+	.string	"assert_hashC_exc(a,op,b) _assert_typeC_exc(yp_hash_t, a, op, b, PRIssize, \"%s\", \"%s\", #a, #b)"
+.LASF1252:
+	.string	"SCNiFAST64 __PRI64_PREFIX \"i\""
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF591:
+	.string	"_POSIX_RTSIG_MAX 8"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1338:
+	.string	"munit_assert_int32(a,op,b) munit_assert_type(munit_int32_t, PRIi32, a, op, b)"
+.LASF1554:
+	.ascii	"_assert_len(obj,expected,obj_fmt,expected_fmt,...) do { yp_s"
+	.ascii	"size_t _ypmt_LEN_actual; _assert_not_raises_exc(_ypmt_LEN_ac"
+	.ascii	"tual = yp_lenC(obj, &exc), \"yp_lenC(\""
+	.string	" obj_fmt \", &exc) == \" expected_fmt, __VA_ARGS__); if (_ypmt_LEN_actual != expected) { munit_errorf(\"assertion failed: yp_lenC(\" obj_fmt \", &exc) == \" expected_fmt \" (%\" PRIssize \" == %\" PRIssize \")\", __VA_ARGS__, _ypmt_LEN_actual, expected); } } while (0)"
+.LASF1409:
+	.string	"stdout stdout"
+.LASF1484:
+	.string	"_COMMA_REPEAT24(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF954:
+	.string	"yp_WHILE_ELSE } if(_yp_WHILE_cond == yp_False) {"
+.LASF948:
+	.string	"yp_ELSE_EXCEPT } } if(yp_isexceptionC(_yp_IF_cond)) { {"
+.LASF800:
+	.string	"__SIZE_T "
+.LASF1327:
+	.string	"munit_assert_ulong(a,op,b) munit_assert_type(unsigned long int, \"lu\", a, op, b)"
+.LASF633:
+	.string	"_POSIX_THREAD_THREADS_MAX 64"
+.LASF714:
+	.string	"_SYS_TYPES_H 1"
+.LASF1168:
+	.string	"PRIiFAST64 __PRI64_PREFIX \"i\""
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1049:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF395:
+	.string	"_GCC_LIMITS_H_ "
+.LASF922:
+	.string	"_yp_CONST_REF(name) ((ypObject *)&_ ##name ##_struct)"
+.LASF916:
+	.string	"_ypStringLib_ENC_CODE_UCS_4 (3u)"
+.LASF747:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF763:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1406:
+	.string	"FOPEN_MAX"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1621:
+	.string	"long double"
+.LASF1298:
+	.string	"SCNxPTR __PRIPTR_PREFIX \"x\""
+.LASF1510:
+	.string	"assert_true(expr) munit_assert_true(expr)"
+.LASF799:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1050:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF859:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1182:
+	.string	"PRIu16 \"u\""
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF1628:
+	.string	"test_protocols_initialize"
+.LASF1326:
+	.string	"munit_assert_long(a,op,b) munit_assert_type(long int, \"ld\", a, op, b)"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1052:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF429:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF715:
+	.string	"_BITS_TYPES_H 1"
+.LASF606:
+	.string	"__undef_ARG_MAX "
+.LASF1172:
+	.string	"PRIo64 __PRI64_PREFIX \"o\""
+.LASF1578:
+	.string	"long unsigned int"
+.LASF618:
+	.string	"XATTR_SIZE_MAX 65536"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1092:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF853:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF978:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1480:
+	.string	"_COMMA_REPEAT20(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF687:
+	.string	"UINT_MAX"
+.LASF1085:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF380:
+	.string	"MUNIT_TEST_NAME_LEN 58"
+.LASF1055:
+	.string	"RAND_MAX 2147483647"
+.LASF1485:
+	.string	"_COMMA_REPEAT25(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1243:
+	.string	"SCNi32 \"i\""
+.LASF718:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1360:
+	.string	"munit_newa(type,nmemb) ((type*) munit_calloc((nmemb), sizeof(type)))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1300:
+	.string	"MUNIT_LIKELY(expr) (__builtin_expect ((expr), 1))"
+.LASF639:
+	.string	"LOGIN_NAME_MAX 256"
+.LASF379:
+	.string	"MUNIT_DISABLE_TIMING 1"
+.LASF1436:
+	.string	"_STRINGIFY10(a,b,c,d,e,f,g,h,i,j) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1100:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1295:
+	.string	"SCNiPTR __PRIPTR_PREFIX \"i\""
+.LASF1413:
+	.string	"_BITS_STDIO_H 1"
+.LASF1585:
+	.string	"char"
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1629:
+	.string	"test_objects_initialize"
+.LASF962:
+	.string	"yp_FOR_ELSE } } if(_yp_FOR_iter_exhausted) { {"
+.LASF1611:
+	.string	"parameters"
+.LASF1437:
+	.string	"_STRINGIFY11(a,b,c,d,e,f,g,h,i,j,k) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1175:
+	.string	"PRIoLEAST32 \"o\""
+.LASF990:
+	.string	"__DEFINED_wchar_t "
+.LASF1038:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1214:
+	.string	"PRIXFAST16 __PRIPTR_PREFIX \"X\""
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1461:
+	.string	"_COMMA_REPEAT1(x) x"
+.LASF1165:
+	.string	"PRIiFAST8 \"i\""
+.LASF669:
+	.string	"SCHAR_MAX"
+.LASF590:
+	.string	"_POSIX_RE_DUP_MAX 255"
+.LASF716:
+	.string	"__S16_TYPE short int"
+.LASF1311:
+	.string	"munit_logf(level,format,...) munit_logf_ex(level, __FILE__, __LINE__, format, __VA_ARGS__)"
+.LASF1160:
+	.string	"PRIi64 __PRI64_PREFIX \"i\""
+.LASF760:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF997:
+	.string	"WUNTRACED 2"
+.LASF1356:
+	.string	"munit_assert_ptr_not_null(ptr) munit_assert_ptr(ptr, !=, NULL)"
+.LASF1317:
+	.string	"munit_assert_false(expr) do { if (!MUNIT_LIKELY(!(expr))) { munit_error(\"assertion failed: \" #expr \" is not false\"); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF843:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF671:
+	.string	"UCHAR_MAX"
+.LASF1562:
+	.ascii	"assert_ptr_array(array,...) do { void **_ypmt_PTR_ARR_array "
+	.ascii	"= (void **)(array); void *_ypmt_PTR_ARR_items[] = {__VA_ARGS"
+	.ascii	"__}; char *_ypmt_PTR_ARR_item_strs[] = {STRINGIFY(__VA_ARGS_"
+	.ascii	"_)}; yp_ssize_t _ypmt_PTR_ARR_n = yp_lengthof_array(_ypmt_PT"
+	.ascii	"R_ARR_items); yp_ssize_t _ypmt_PTR_ARR_i; if (_ypmt_PTR_ARR_"
+	.ascii	"n < 1) { munit_error(\"missing expected items in assertion\""
+	.ascii	"); } for (_ypmt_PTR_ARR_i = 0; "
+	.string	"_ypmt_PTR_ARR_i < _ypmt_PTR_ARR_n; _ypmt_PTR_ARR_i++) { _assert_ptr(_ypmt_PTR_ARR_array[_ypmt_PTR_ARR_i], ==, _ypmt_PTR_ARR_items[_ypmt_PTR_ARR_i], \"%s[%\" PRIssize \"]\", \"%s\", #array, _ypmt_PTR_ARR_i, _ypmt_PTR_ARR_item_strs[_ypmt_PTR_ARR_i]); } } while (0)"
+.LASF1068:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1567:
+	.ascii	"faulty_iter_tests(setup,iter_name,iter_supplier,statement,as"
+	.ascii	"sertion,tear_down) do { ypObject *_ypmt_FLT_ITR_sup"
+	.string	"plier = (iter_supplier); char _ypmt_FLT_ITR_statement_str[] = #statement; _faulty_iter_tests((setup), (iter_name), _ypmt_FLT_ITR_supplier, (statement), (assertion), (tear_down), , _ypmt_FLT_ITR_statement_str); yp_decref(_ypmt_FLT_ITR_supplier); } while (0)"
+.LASF1307:
+	.string	"MUNIT_NO_RETURN _Noreturn"
+.LASF1290:
+	.string	"SCNiMAX __PRI64_PREFIX \"i\""
+.LASF1333:
+	.string	"munit_assert_ptr(a,op,b) munit_assert_type(const void*, \"p\", a, op, b)"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1154:
+	.string	"PRIdFAST16 __PRIPTR_PREFIX \"d\""
+.LASF1150:
+	.string	"PRIdLEAST16 \"d\""
+.LASF750:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF804:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1439:
+	.string	"_STRINGIFY13(a,b,c,d,e,f,g,h,i,j,k,l,m) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m"
+.LASF921:
+	.string	"_ypFunction_CODE (28u)"
+.LASF382:
+	.string	"MUNIT_OUTPUT_FILE stderr"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF775:
+	.string	"__STD_TYPE"
+.LASF761:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1094:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1018:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF733:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1033:
+	.string	"__HAVE_FLOAT32 1"
+.LASF384:
+	.string	"_DEBUG 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF811:
+	.string	"__size_t "
+.LASF1177:
+	.string	"PRIoFAST8 \"o\""
+.LASF741:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1401:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1434:
+	.string	"_STRINGIFY8(a,b,c,d,e,f,g,h) #a, #b, #c, #d, #e, #f, #g, #h"
+.LASF994:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1261:
+	.string	"SCNuFAST8 \"hhu\""
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF892:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1624:
+	.string	"test_memory_tests"
+.LASF1543:
+	.string	"assert_truthy(obj) do { ypObject *_ypmt_TRUTHY_result = yp_bool(obj); _assert_bool(_ypmt_TRUTHY_result, yp_True, yp_False, \"yp_bool(%s)\", #obj); } while (0)"
+.LASF1074:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF388:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1119:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF851:
+	.string	"__sigset_t_defined 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1438:
+	.string	"_STRINGIFY12(a,b,c,d,e,f,g,h,i,j,k,l) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF992:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF1108:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1366:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1330:
+	.string	"munit_assert_size(a,op,b) munit_assert_type(size_t, MUNIT_SIZE_MODIFIER \"u\", a, op, b)"
+.LASF783:
+	.string	"__off_t_defined "
+.LASF1234:
+	.string	"SCNdLEAST16 \"hd\""
+.LASF706:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF963:
+	.string	"yp_FOR_EXCEPT } } if(!_yp_FOR_iter_exhausted && yp_isexceptionC(_yp_FOR_item)) { {"
+.LASF1486:
+	.string	"_COMMA_REPEAT26(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF630:
+	.string	"PTHREAD_KEYS_MAX 1024"
+.LASF1504:
+	.string	"yp_lengthof_array_member(structType,member) yp_lengthof_array(((structType *)0)->member)"
+.LASF702:
+	.string	"__need___va_list"
+.LASF371:
+	.string	"__linux 1"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1041:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF785:
+	.string	"__id_t_defined "
+.LASF625:
+	.string	"OPEN_MAX"
+.LASF1229:
+	.string	"SCNd8 \"hhd\""
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF890:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1013:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1627:
+	.string	"test_protocols_suites"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1428:
+	.string	"_STRINGIFY2(a,b) #a, #b"
+.LASF889:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF435:
+	.string	"__USE_ISOC11 1"
+.LASF787:
+	.string	"__daddr_t_defined "
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1198:
+	.string	"PRIxLEAST16 \"x\""
+.LASF1003:
+	.string	"__WALL 0x40000000"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1302:
+	.string	"MUNIT_UNUSED __attribute__((__unused__))"
+.LASF822:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF836:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF376:
+	.string	"unix 1"
+.LASF426:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF725:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF875:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF418:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1015:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1245:
+	.string	"SCNiLEAST8 \"hhi\""
+.LASF1264:
+	.string	"SCNuFAST64 __PRI64_PREFIX \"u\""
+.LASF643:
+	.string	"SSIZE_MAX LONG_MAX"
+.LASF1322:
+	.string	"munit_assert_short(a,op,b) munit_assert_type(short, MUNIT_SHORT_MODIFIER \"d\", a, op, b)"
+.LASF1410:
+	.string	"stderr stderr"
+.LASF675:
+	.string	"CHAR_MAX"
+.LASF1219:
+	.string	"PRIoMAX __PRI64_PREFIX \"o\""
+.LASF956:
+	.string	"yp_WHILE_EXCEPT_AS(target) yp_WHILE_EXCEPT ypObject *target = _yp_WHILE_cond;"
+.LASF1576:
+	.string	"SUITE_OF_TESTS_DECLS(name) extern MunitTest name ##_tests[]; extern void name ##_initialize(void)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF839:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1148:
+	.string	"PRId64 __PRI64_PREFIX \"d\""
+.LASF748:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1414:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF820:
+	.string	"__PDP_ENDIAN 3412"
+.LASF594:
+	.string	"_POSIX_SIGQUEUE_MAX 32"
+.LASF684:
+	.string	"INT_MIN (-INT_MAX - 1)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF905:
+	.string	"_yp_UNUSED __attribute__((unused))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF823:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF758:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1348:
+	.ascii	"munit_assert_string_not_equal(a,b) do { const char* munit_tm"
+	.ascii	"p_a_ = a; const char* munit"
+	.string	"_tmp_b_ = b; if (MUNIT_UNLIKELY(strcmp(munit_tmp_a_, munit_tmp_b_) == 0)) { munit_errorf(\"assertion failed: string %s != %s (\\\"%s\\\" == \\\"%s\\\")\", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF646:
+	.string	"_POSIX2_BC_DIM_MAX 2048"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF982:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1493:
+	.string	"_COMMA_REPEAT33(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1412:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF1054:
+	.string	"__lldiv_t_defined 1"
+.LASF1090:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF578:
+	.string	"_POSIX_HOST_NAME_MAX 255"
+.LASF664:
+	.string	"_LIMITS_H___ "
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1478:
+	.string	"_COMMA_REPEAT18(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1390:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF668:
+	.string	"SCHAR_MIN (-SCHAR_MAX - 1)"
+.LASF621:
+	.string	"NR_OPEN"
+.LASF1540:
+	.string	"assert_hashC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_hash_t, a, op, b, (__VA_ARGS__), PRIssize, \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1010:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF406:
+	.string	"__USE_POSIX2"
+.LASF1115:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1143:
+	.string	"__PRI64_PREFIX \"l\""
+.LASF351:
+	.string	"__x86_64 1"
+.LASF942:
+	.string	"yp_IF(expression) _yp_IF(expression, ((void)0))"
+.LASF1507:
+	.string	"SUITE_OF_SUITES(name) { \"/\" #name, NULL, (name ##_suites), 1, MUNIT_SUITE_OPTION_NONE }"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF936:
+	.string	"_yp_IMMORTAL_FUNCTION(qual,name,code,parameters) static yp_parameter_decl_t _ ##name ##_parameters[] = {_yp_UNPACK parameters}; _yp_IMMORTAL_FUNCTION5( qual, name, code, yp_lengthof_array(_ ##name ##_parameters), _ ##name ##_parameters)"
+.LASF582:
+	.string	"_POSIX_MAX_INPUT 255"
+.LASF1422:
+	.string	"PRIssize PRId64"
+.LASF724:
+	.string	"__SWORD_TYPE long int"
+.LASF973:
+	.string	"__need_wchar_t "
+.LASF413:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1031:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1242:
+	.string	"SCNi16 \"hi\""
+.LASF1105:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1448:
+	.string	"_STRINGIFY22(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1002:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF979:
+	.string	"_T_WCHAR "
+.LASF1256:
+	.string	"SCNu64 __PRI64_PREFIX \"u\""
+.LASF810:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1080:
+	.string	"UINT16_MAX (65535)"
+.LASF1227:
+	.string	"PRIxPTR __PRIPTR_PREFIX \"x\""
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF766:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1362:
+	.string	"_STDDEF_H_ "
+.LASF774:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1183:
+	.string	"PRIu32 \"u\""
+.LASF731:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF927:
+	.ascii	"_yp_IMMORTAL_BYTES(qual,name,value) static const char _"
+	.string	" ##name ##_data[] = (value); static struct _ypStringLibObject _ ##name ##_struct = {_yp_IMMORTAL_HEAD_INIT(_ypBytes_CODE, _ypStringLib_ENC_CODE_BYTES, sizeof(_ ##name ##_data) - 1, (void *)_ ##name ##_data)}; qual ypObject *const name = _yp_CONST_REF(name)"
+.LASF667:
+	.string	"SCHAR_MIN"
+.LASF770:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1127:
+	.string	"UINT16_C(c) c"
+.LASF876:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1059:
+	.string	"_ALLOCA_H 1"
+.LASF1113:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1379:
+	.string	"_____fpos_t_defined 1"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF407:
+	.string	"__USE_POSIX199309"
+.LASF1265:
+	.string	"SCNo8 \"hho\""
+.LASF615:
+	.string	"PATH_MAX 4096"
+.LASF1547:
+	.string	"assert_obj(a,op,b) do { ypObject *_ypmt_OBJ_a = (a); ypObject *_ypmt_OBJ_b = (b); _assert_obj(_ypmt_OBJ_a, op, _ypmt_OBJ_b, \"%s\", \"%s\", #a, #b); } while (0)"
+.LASF685:
+	.string	"INT_MAX"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF622:
+	.string	"__undef_NR_OPEN"
+.LASF1045:
+	.string	"__f32(x) x ##f32"
+.LASF1369:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF980:
+	.string	"__WCHAR_T "
+.LASF1274:
+	.string	"SCNoFAST16 __PRIPTR_PREFIX \"o\""
+.LASF1336:
+	.string	"munit_assert_int16(a,op,b) munit_assert_type(munit_int16_t, PRIi16, a, op, b)"
+.LASF1615:
+	.string	"MunitSuite"
+.LASF776:
+	.string	"__u_char_defined "
+.LASF386:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1277:
+	.string	"SCNx8 \"hhx\""
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF665:
+	.string	"CHAR_BIT"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF860:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1251:
+	.string	"SCNiFAST32 __PRIPTR_PREFIX \"i\""
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1040:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1186:
+	.string	"PRIuLEAST16 \"u\""
+.LASF434:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF676:
+	.string	"CHAR_MAX SCHAR_MAX"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1586:
+	.string	"long long unsigned int"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF771:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1192:
+	.string	"PRIuFAST64 __PRI64_PREFIX \"u\""
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1268:
+	.string	"SCNo64 __PRI64_PREFIX \"o\""
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1275:
+	.string	"SCNoFAST32 __PRIPTR_PREFIX \"o\""
+.LASF1025:
+	.string	"__HAVE_FLOAT128 1"
+.LASF833:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1263:
+	.string	"SCNuFAST32 __PRIPTR_PREFIX \"u\""
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1065:
+	.string	"_STDINT_H 1"
+.LASF699:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1ULL)"
+.LASF1430:
+	.string	"_STRINGIFY4(a,b,c,d) #a, #b, #c, #d"
+.LASF1024:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF764:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1151:
+	.string	"PRIdLEAST32 \"d\""
+.LASF710:
+	.string	"_VA_LIST "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF634:
+	.string	"PTHREAD_THREADS_MAX"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF1314:
+	.string	"munit_error(msg) munit_errorf(\"%s\", msg)"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF959:
+	.string	"yp_FOR(target,expression) _yp_FOR(target, expression, ((void)0))"
+.LASF1212:
+	.string	"PRIXLEAST64 __PRI64_PREFIX \"X\""
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF746:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1603:
+	.string	"MunitTestOptions"
+.LASF1303:
+	.string	"MUNIT_ARRAY_PARAM(name) name"
+.LASF1395:
+	.string	"BUFSIZ 8192"
+.LASF930:
+	.string	"yp_IMMORTAL_BYTES(name,value) _yp_IMMORTAL_BYTES(, name, value)"
+.LASF925:
+	.string	"_yp_IMMORTAL_SMALL_HEAD_INIT(type,type_flags) {(type), 0, (type_flags), _ypObject_REFCNT_IMMORTAL}"
+.LASF862:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1526:
+	.ascii	"assert_isexception(obj,...) do { ypObject *_ypmt"
+	.string	"_ISEXC_obj = (obj); ypObject *_ypmt_ISEXC_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_ISEXC_n = yp_lengthof_array(_ypmt_ISEXC_expected); _assert_isexception(_ypmt_ISEXC_obj, _ypmt_ISEXC_n, _ypmt_ISEXC_expected, \"%s\", \"%s\", #obj, #__VA_ARGS__); } while (0)"
+.LASF945:
+	.string	"yp_ELIF(expression) _yp_ELIF(expression, ((void)0))"
+.LASF1023:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF765:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1426:
+	.string	"_PP_RSEQ_N() 66,65,64,63,62,61,60, 59,58,57,56,55,54,53,52,51,50, 49,48,47,46,45,44,43,42,41,40, 39,38,37,36,35,34,33,32,31,30, 29,28,27,26,25,24,23,22,21,20, 19,18,17,16,15,14,13,12,11,10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0"
+.LASF1359:
+	.string	"munit_calloc(nmemb,size) munit_malloc((nmemb) * (size))"
+.LASF577:
+	.string	"_POSIX_DELAYTIMER_MAX 32"
+.LASF712:
+	.string	"_VA_LIST_T_H "
+.LASF786:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1411:
+	.string	"__attr_dealloc_fclose"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1152:
+	.string	"PRIdLEAST64 __PRI64_PREFIX \"d\""
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1516:
+	.string	"assert_ssizeC(a,op,b) munit_assert_type(yp_ssize_t, PRIssize, a, op, b)"
+.LASF866:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1602:
+	.string	"MUNIT_TEST_OPTION_TODO"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1042:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF383:
+	.string	"yp_ENABLE_SHARED 1"
+.LASF1282:
+	.string	"SCNxLEAST16 \"hx\""
+.LASF1429:
+	.string	"_STRINGIFY3(a,b,c) #a, #b, #c"
+.LASF1427:
+	.string	"_STRINGIFY1(a) #a"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1498:
+	.string	"STRINGIFY(...) _ESC(_PP_NARG(_STRINGIFY, __VA_ARGS__, _PP_RSEQ_N())(__VA_ARGS__))"
+.LASF874:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF926:
+	.string	"_yp_IMMORTAL_INT(qual,name,value) static struct _ypIntObject _ ##name ##_struct = { _yp_IMMORTAL_SMALL_HEAD_INIT(_ypInt_CODE, 0), (value)}; qual ypObject *const name = _yp_CONST_REF(name)"
+.LASF1061:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1112:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1370:
+	.string	"___int_ptrdiff_t_h "
+.LASF1508:
+	.string	"_assert_typeC(a,op,b,val_pri,a_fmt,b_fmt,...) do { if (!(a op b)) { munit_errorf(\"assertion failed: \" a_fmt \" \" #op \" \" b_fmt \" (%\" val_pri \" \" #op \" %\" val_pri \") \", __VA_ARGS__, a, b); } } while (0)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF896:
+	.string	"yp_SSIZE_T_MAX SSIZE_MAX"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF762:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1537:
+	.string	"assert_intC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_int_t, a, op, b, (__VA_ARGS__), PRIint, \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF1574:
+	.string	"obj_array_decref(array) obj_array_decref2(yp_lengthof_array(array), (array))"
+.LASF673:
+	.string	"CHAR_MIN"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1523:
+	.ascii	"_assert_not_raises_exc(statement,statement_fmt,...) do { y"
+	.string	"pObject *exc = NULL; statement; if (exc != NULL) { if (yp_isexceptionC(exc)) { munit_errorf(\"assertion failed: \" statement_fmt \"; !yp_isexceptionC(exc)\", __VA_ARGS__); } munit_errorf(\"exc set to a non-exception: \" statement_fmt, __VA_ARGS__); } } while (0)"
+.LASF834:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1158:
+	.string	"PRIi16 \"i\""
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF863:
+	.string	"NFDBITS __NFDBITS"
+.LASF1587:
+	.string	"long long int"
+.LASF752:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1120:
+	.string	"WINT_MIN (0u)"
+.LASF1604:
+	.string	"MunitTestFunc"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1456:
+	.string	"_STRINGIFY30(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D"
+.LASF1056:
+	.string	"EXIT_FAILURE 1"
+.LASF705:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF1630:
+	.string	"test_refcnt_initialize"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1534:
+	.string	"assert_ssizeC_exc(a,op,b) _assert_typeC_exc(yp_ssize_t, a, op, b, PRIssize, \"%s\", \"%s\", #a, #b)"
+.LASF1017:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF919:
+	.string	"_ypBytes_CODE (16u)"
+.LASF1616:
+	.string	"prefix"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1284:
+	.string	"SCNxLEAST64 __PRI64_PREFIX \"x\""
+.LASF1606:
+	.string	"MunitTestTearDown"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1388:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF1166:
+	.string	"PRIiFAST16 __PRIPTR_PREFIX \"i\""
+.LASF1444:
+	.string	"_STRINGIFY18(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r"
+.LASF807:
+	.string	"__DEFINED_size_t "
+.LASF972:
+	.string	"MUNIT_H "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF912:
+	.string	"_ypObject_LEN_INVALID ((yp_ssize_t) - 1)"
+.LASF888:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1325:
+	.string	"munit_assert_uint(a,op,b) munit_assert_type(unsigned int, \"u\", a, op, b)"
+.LASF1007:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF598:
+	.string	"_POSIX_SYMLOOP_MAX 8"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1178:
+	.string	"PRIoFAST16 __PRIPTR_PREFIX \"o\""
+.LASF1457:
+	.string	"_STRINGIFY31(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1423:
+	.string	"_ESC(...) __VA_ARGS__"
+.LASF466:
+	.string	"__PMT"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF580:
+	.string	"_POSIX_LOGIN_NAME_MAX 9"
+.LASF1313:
+	.string	"munit_errorf(format,...) munit_errorf_ex(__FILE__, __LINE__, format, __VA_ARGS__)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF420:
+	.string	"__USE_ATFILE"
+.LASF1393:
+	.string	"_IOLBF 1"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1546:
+	.string	"_assert_obj(a,op,b,a_fmt,b_fmt,...) do { ypObject *_ypmt_OBJ_result = yp_ ##op(a, b); _assert_bool(_ypmt_OBJ_result, yp_True, yp_False, \"yp_\" #op \"(\" a_fmt \", \" b_fmt \")\", __VA_ARGS__); } while (0)"
+.LASF1190:
+	.string	"PRIuFAST16 __PRIPTR_PREFIX \"u\""
+.LASF1199:
+	.string	"PRIxLEAST32 \"x\""
+.LASF1560:
+	.ascii	"_assert_mapping(obj,items,obj_fmt,item_strs,...) do { yp_ssi"
+	.ascii	"ze_t _ypmt_MAP_k = yp_lengthof_array(items) / 2; int _ypmt_M"
+	.ascii	"AP_found[yp_lengthof_array(items) / 2] = {0}; yp_uint64_t _y"
+	.ascii	"pmt_MAP_mi_state; ypObject *_ypmt_MAP_mi; ypObject *_ypmt_MA"
+	.ascii	"P_actual_key; ypObject *_ypmt_MAP_actual_value; yp_ssize_t _"
+	.ascii	"ypmt_MAP_ki; if (yp_lengthof_array(items) % 2 != 0) { munit_"
+	.ascii	"error(\"expected an even number of objects for the (key, val"
+	.ascii	"ue) pairs\"); } _assert_len(obj, _ypmt_MAP_k, obj_fmt, \"%\""
+	.ascii	" PRIssize, __VA_ARGS__, _ypmt_MAP_k); _assert_not_raises(_yp"
+	.ascii	"mt_MAP_mi = yp_miniiter_items(obj, &_ypmt_MAP_mi_state), \"y"
+	.ascii	"p_miniiter_items(\" obj_fmt \", &mi_state)\", __VA_ARGS__); "
+	.ascii	"while (_assert_mapping_helper(_ypmt_MAP_mi, &_ypmt_MAP_mi_st"
+	.ascii	"ate, _ypmt_MAP_k, items, &_ypmt_MAP_actual_key , &_ypmt_MAP_"
+	.ascii	"actual_value , &_ypmt_MAP_ki)) { _assert_not_exception(_ypmt"
+	.ascii	"_MAP_actual_key, \"yp_miniiter_items_next(yp_miniiter_items("
+	.ascii	"\" obj_fmt \", &mi_state), &mi_state)\", __VA_ARGS__); if (_"
+	.ascii	"ypmt_MAP_ki >= _ypmt_MAP_k) { munit_errorf(\"unexpected item"
+	.ascii	" yielded from \" obj_fmt, __VA_ARGS__); } if (_ypmt_MAP_foun"
+	.ascii	"d[_ypmt_MAP_ki]) { munit_errorf(\"%s yielded twice from \" o"
+	.ascii	"bj_fmt, item_strs[_ypmt_MAP_ki * 2], __VA_ARGS__); } _ypmt_M"
+	.ascii	"AP_found[_ypmt_MAP_ki] = TRUE; _assert_same_type(_ypmt_MAP_a"
+	.ascii	"ctual_key, items[_ypmt_MAP_ki * 2], \"<key in \" obj_fmt \">"
+	.ascii	"\", \"%s\", __VA_ARGS__, item_strs[_ypmt_MAP_ki * 2]); _asse"
+	.ascii	"rt_eq_same_type(_ypmt_MAP_actual_value, items[_ypmt_MAP_ki *"
+	.ascii	" 2 + 1], \"<value \" obj_fmt \"[%s]>\", \"%s\", __VA_ARGS__,"
+	.ascii	" item_strs[_ypmt_MAP_ki * 2], item_strs[_ypmt_MAP_ki * 2 + 1"
+	.ascii	"]); yp_decref(_ypmt_MAP_actual_key); yp_decref(_ypmt_M"
+	.string	"AP_actual_value); } for (_ypmt_MAP_ki = 0; _ypmt_MAP_ki < _ypmt_MAP_k; _ypmt_MAP_ki++) { if (!_ypmt_MAP_found[_ypmt_MAP_ki]) { munit_errorf( \"%s not yielded from \" obj_fmt, item_strs[_ypmt_MAP_ki * 2], __VA_ARGS__); } } yp_decref(_ypmt_MAP_mi); } while (0)"
+.LASF891:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1392:
+	.string	"_IOFBF 0"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1107:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF660:
+	.string	"LINE_MAX _POSIX2_LINE_MAX"
+.LASF1572:
+	.string	"obj_array_init(n,expression) {_COMMA_REPEAT ##n((expression))}"
+.LASF946:
+	.string	"yp_ELIFd(expression) _yp_ELIF(expression, yp_decref(_yp_IF_expr))"
+.LASF1114:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF754:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1446:
+	.string	"_STRINGIFY20(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1328:
+	.string	"munit_assert_llong(a,op,b) munit_assert_type(long long int, \"lld\", a, op, b)"
+.LASF1571:
+	.string	"define_function2(name,code) yp_function_decl_t _ ##name ##_declaration = {(code), 0, 0, NULL, NULL, NULL}; ypObject *name = yp_functionC(&_ ##name ##_declaration)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1193:
+	.string	"PRIx8 \"x\""
+.LASF1495:
+	.string	"VA_ARGC(...) (_PP_NARG(, __VA_ARGS__, _PP_RSEQ_N()))"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF751:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1605:
+	.string	"MunitTestSetup"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF744:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1376:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF1525:
+	.ascii	"_assert_isexception(obj,n,expected,obj_fmt,expected_fmt,...)"
+	.ascii	" do { if (n < 1) { munit_error(\"missing expected exception "
+	.ascii	"in assertion\"); } if (!yp_isexceptionC(obj)) { munit_error"
+	.string	"f(\"assertion failed: yp_isexceptionC(\" obj_fmt \") (expected \" expected_fmt \")\", __VA_ARGS__); } if (!yp_isexception_arrayC(obj, n, expected)) { munit_errorf(\"assertion failed: yp_isexceptionCN(\" obj_fmt \", N(\" expected_fmt \"))\", __VA_ARGS__); } } while (0)"
+.LASF392:
+	.string	"unittest_snprintf snprintf"
+.LASF1382:
+	.string	"____FILE_defined 1"
+.LASF683:
+	.string	"INT_MIN"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF795:
+	.string	"__SIZE_T__ "
+.LASF1292:
+	.string	"SCNuMAX __PRI64_PREFIX \"u\""
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF740:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF390:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1619:
+	.string	"iterations"
+.LASF597:
+	.string	"_POSIX_SYMLINK_MAX 255"
+.LASF1304:
+	.string	"MUNIT_SIZE_MODIFIER \"z\""
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1220:
+	.string	"PRIuMAX __PRI64_PREFIX \"u\""
+.LASF600:
+	.string	"_POSIX_TTY_NAME_MAX 9"
+.LASF1432:
+	.string	"_STRINGIFY6(a,b,c,d,e,f) #a, #b, #c, #d, #e, #f"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1310:
+	.string	"MUNIT_PRINTF(string_index,first_to_check) __attribute__((format (printf, string_index, first_to_check)))"
+.LASF576:
+	.string	"_POSIX_CHILD_MAX 25"
+.LASF1358:
+	.string	"munit_new(type) ((type*) munit_malloc(sizeof(type)))"
+.LASF1435:
+	.string	"_STRINGIFY9(a,b,c,d,e,f,g,h,i) #a, #b, #c, #d, #e, #f, #g, #h, #i"
+.LASF1579:
+	.string	"unsigned int"
+.LASF1228:
+	.string	"PRIXPTR __PRIPTR_PREFIX \"X\""
+.LASF845:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1505:
+	.string	"TEST(name,parameters) { \"/\" #name, (MunitTestFunc)(name), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, parameters }"
+.LASF682:
+	.string	"USHRT_MAX (SHRT_MAX * 2 + 1)"
+.LASF1064:
+	.string	"MUNIT_CURRENT_VERSION MUNIT_VERSION(0, 4, 1)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF935:
+	.ascii	"_yp_IMMORTAL_F"
+	.string	"UNCTION5(qual,name,code,parameters_len,parameters) static struct _ypFunctionObject _ ##name ##_struct = { _yp_IMMORTAL_HEAD_INIT(_ypFunction_CODE, 0, (parameters_len), (parameters)), (code), NULL}; qual ypObject *const _yp_UNUSED name = _yp_CONST_REF(name)"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1247:
+	.string	"SCNiLEAST32 \"i\""
+.LASF732:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF593:
+	.string	"_POSIX_SEM_VALUE_MAX 32767"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1355:
+	.string	"munit_assert_ptr_null(ptr) munit_assert_ptr(ptr, ==, NULL)"
+.LASF1583:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1141:
+	.string	"_INTTYPES_H 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1324:
+	.string	"munit_assert_int(a,op,b) munit_assert_type(int, \"d\", a, op, b)"
+.LASF23:
+	.string	"_LP64 1"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF681:
+	.string	"USHRT_MAX"
+.LASF1612:
+	.string	"MunitTest"
+.LASF728:
+	.string	"__S64_TYPE long int"
+.LASF796:
+	.string	"_SIZE_T "
+.LASF637:
+	.string	"DELAYTIMER_MAX 2147483647"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1161:
+	.string	"PRIiLEAST8 \"i\""
+.LASF623:
+	.string	"LINK_MAX"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1610:
+	.string	"options"
+.LASF1337:
+	.string	"munit_assert_uint16(a,op,b) munit_assert_type(munit_uint16_t, PRIu16, a, op, b)"
+.LASF700:
+	.string	"_STDARG_H "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1373:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1202:
+	.string	"PRIxFAST16 __PRIPTR_PREFIX \"x\""
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1021:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF657:
+	.string	"BC_STRING_MAX _POSIX2_BC_STRING_MAX"
+.LASF1469:
+	.string	"_COMMA_REPEAT9(x) x, x, x, x, x, x, x, x, x"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1238:
+	.string	"SCNdFAST16 __PRIPTR_PREFIX \"d\""
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"Lib/munit_test/init.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,40991 @@
+	.file	"test_memory.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -m64 -mtune=generic -march=x86-64 -g3 -Og -fvisibility=hidden -ftrapv -fstack-clash-protection -fno-omit-frame-pointer -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "Lib/munit_test/test_memory.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"yp_append(list, list, &exc)"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"assertion failed: %s; !yp_isexceptionC(exc)"
+	.section	.rodata.str1.1
+.LC2:
+	.string	"Lib/munit_test/test_memory.c"
+	.section	.rodata.str1.8
+	.align 8
+.LC3:
+	.string	"exc set to a non-exception: %s"
+	.globl	__addvdi3
+	.section	.rodata.str1.1
+.LC4:
+	.string	"0"
+.LC5:
+	.string	"yp_collect(2, &exc)"
+	.section	.rodata.str1.8
+	.align 8
+.LC6:
+	.string	"assertion failed: %s >= %s; !yp_isexceptionC(exc)"
+	.align 8
+.LC7:
+	.string	"exc set to a non-exception: %s >= %s"
+	.align 8
+.LC8:
+	.string	"assertion failed: %s >= %s (%ld >= %ld) "
+	.globl	__subvdi3
+	.section	.rodata.str1.1
+.LC9:
+	.string	">"
+	.section	.rodata.str1.8
+	.align 8
+.LC10:
+	.string	"after.collections[0] - before.collections[0]"
+	.align 8
+.LC11:
+	.string	"assertion failed: %s %s %s (%ld %s %ld)"
+	.section	.rodata.str1.1
+.LC12:
+	.string	"1000"
+.LC13:
+	.string	"=="
+	.section	.rodata.str1.8
+	.align 8
+.LC14:
+	.string	"after.collected[0] + after.collected[1] + after.collected[2] - (before.collected[0] + before.collected[1] + before.collected[2])"
+	.text
+	.type	test_collect_automatic, @function
+test_collect_automatic:
+.LVL0:
+.LFB39:
+	.file 1 "Lib/munit_test/test_memory.c"
+	.loc 1 422 1 view -0
+	.cfi_startproc
+	.loc 1 422 1 is_stmt 0 view .LVU1
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$176, %rsp	#,
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	.loc 1 423 5 is_stmt 1 view .LVU2
+	.loc 1 424 5 view .LVU3
+	.loc 1 425 5 view .LVU4
+	.loc 1 427 5 view .LVU5
+	leaq	-96(%rbp), %rdi	#, tmp106
+.LVL1:
+	.loc 1 427 5 is_stmt 0 view .LVU6
+	call	yp_collect_stats@PLT	#
+.LVL2:
+	.loc 1 428 5 is_stmt 1 view .LVU7
+	movl	$100, %edi	#,
+	call	yp_collect_enable@PLT	#
+.LVL3:
+	.loc 1 429 5 view .LVU8
+# Lib/munit_test/test_memory.c:429:     for (i = 0; i < 1000; i++) {
+	.loc 1 429 12 is_stmt 0 view .LVU9
+	movl	$0, %r12d	#, i
+.LVL4:
+.L2:
+	.loc 1 429 19 is_stmt 1 discriminator 1 view .LVU10
+	cmpq	$999, %r12	#, i
+	jg	.L12	#,
+.LBB2:
+	.loc 1 430 9 view .LVU11
+# Lib/munit_test/test_memory.c:430:         ypObject *list = yp_listN(0);
+	.loc 1 430 26 is_stmt 0 view .LVU12
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_listN@PLT	#
+.LVL5:
+	movq	%rax, %rbx	# tmp141, list
+.LVL6:
+	.loc 1 431 9 is_stmt 1 view .LVU13
+.LBB3:
+	.loc 1 431 14 view .LVU14
+# Lib/munit_test/test_memory.c:431:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 431 24 is_stmt 0 view .LVU15
+	movq	$0, -184(%rbp)	#, MEM[(struct ypObject * *)_51]
+	.loc 1 431 10 is_stmt 1 view .LVU16
+# Lib/munit_test/test_memory.c:431:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 431 11 is_stmt 0 view .LVU17
+	leaq	-184(%rbp), %rdx	#, tmp107
+	movq	%rax, %rsi	# list,
+	movq	%rax, %rdi	# list,
+	call	yp_append@PLT	#
+.LVL7:
+	.loc 1 431 41 is_stmt 1 view .LVU18
+# Lib/munit_test/test_memory.c:431:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 431 49 is_stmt 0 view .LVU19
+	movq	-184(%rbp), %rdi	# MEM[(struct ypObject * *)_51], exc.0_1
+# Lib/munit_test/test_memory.c:431:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 431 44 view .LVU20
+	testq	%rdi, %rdi	# exc.0_1
+	jne	.L13	#,
+.LBE3:
+	.loc 1 431 12 is_stmt 1 discriminator 2 view .LVU21
+	.loc 1 432 9 discriminator 2 view .LVU22
+	movq	%rbx, %rdi	# list,
+	call	yp_decref@PLT	#
+.LVL8:
+.LBE2:
+	.loc 1 429 28 discriminator 2 view .LVU23
+	movl	$1, %esi	#,
+	movq	%r12, %rdi	# i,
+	call	__addvdi3@PLT	#
+.LVL9:
+	movq	%rax, %r12	# tmp143, i
+.LVL10:
+	.loc 1 429 28 is_stmt 0 discriminator 2 view .LVU24
+	jmp	.L2	#
+.LVL11:
+.L13:
+.LBB5:
+.LBB4:
+	.loc 1 431 12 is_stmt 1 discriminator 1 view .LVU25
+# Lib/munit_test/test_memory.c:431:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 431 16 is_stmt 0 discriminator 1 view .LVU26
+	call	yp_isexceptionC@PLT	#
+.LVL12:
+# Lib/munit_test/test_memory.c:431:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 431 15 discriminator 1 view .LVU27
+	testl	%eax, %eax	# tmp142
+	je	.L4	#,
+	.loc 1 431 40 is_stmt 1 discriminator 2 view .LVU28
+	leaq	.LC0(%rip), %rcx	#, tmp108
+	leaq	.LC1(%rip), %rdx	#, tmp109
+	movl	$431, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp110
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL13:
+.L4:
+	.loc 1 431 180 discriminator 3 view .LVU29
+	leaq	.LC0(%rip), %rcx	#, tmp111
+	leaq	.LC3(%rip), %rdx	#, tmp112
+	movl	$431, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp113
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL14:
+.L12:
+	.loc 1 431 180 is_stmt 0 discriminator 3 view .LVU30
+.LBE4:
+.LBE5:
+	.loc 1 434 5 is_stmt 1 view .LVU31
+.LBB6:
+	.loc 1 434 10 view .LVU32
+	.loc 1 434 36 view .LVU33
+	.loc 1 434 62 view .LVU34
+.LBB7:
+	.loc 1 434 67 view .LVU35
+# Lib/munit_test/test_memory.c:434:     assert_ssizeC_exc(yp_collect(2, &exc), >=, 0);  // collects whatever remains
+	.loc 1 434 77 is_stmt 0 view .LVU36
+	movq	$0, -184(%rbp)	#, MEM[(struct ypObject * *)_51]
+	.loc 1 434 6 is_stmt 1 view .LVU37
+# Lib/munit_test/test_memory.c:434:     assert_ssizeC_exc(yp_collect(2, &exc), >=, 0);  // collects whatever remains
+	.loc 1 434 23 is_stmt 0 view .LVU38
+	leaq	-184(%rbp), %rsi	#, tmp115
+	movl	$2, %edi	#,
+	call	yp_collect@PLT	#
+.LVL15:
+	.loc 1 434 45 is_stmt 1 view .LVU39
+	.loc 1 434 66 view .LVU40
+# Lib/munit_test/test_memory.c:434:     assert_ssizeC_exc(yp_collect(2, &exc), >=, 0);  // collects whatever remains
+	.loc 1 434 74 is_stmt 0 view .LVU41
+	movq	-184(%rbp), %rdi	# MEM[(struct ypObject * *)_51], exc.2_3
+# Lib/munit_test/test_memory.c:434:     assert_ssizeC_exc(yp_collect(2, &exc), >=, 0);  // collects whatever remains
+	.loc 1 434 69 view .LVU42
+	testq	%rdi, %rdi	# exc.2_3
+	je	.L6	#,
+	.loc 1 434 8 is_stmt 1 discriminator 1 view .LVU43
+# Lib/munit_test/test_memory.c:434:     assert_ssizeC_exc(yp_collect(2, &exc), >=, 0);  // collects whatever remains
+	.loc 1 434 12 is_stmt 0 discriminator 1 view .LVU44
+	call	yp_isexceptionC@PLT	#
+.LVL16:
+# Lib/munit_test/test_memory.c:434:     assert_ssizeC_exc(yp_collect(2, &exc), >=, 0);  // collects whatever remains
+	.loc 1 434 11 discriminator 1 view .LVU45
+	testl	%eax, %eax	# tmp145
+	je	.L7	#,
+	.loc 1 434 36 is_stmt 1 discriminator 3 view .LVU46
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC5(%rip), %rcx	#, tmp116
+	leaq	.LC6(%rip), %rdx	#, tmp117
+	movl	$434, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp118
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL17:
+.L7:
+	.loc 1 434 191 discriminator 4 view .LVU47
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC5(%rip), %rcx	#, tmp119
+	leaq	.LC7(%rip), %rdx	#, tmp120
+	movl	$434, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp121
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL18:
+.L6:
+	.loc 1 434 191 is_stmt 0 discriminator 4 view .LVU48
+.LBE7:
+	.loc 1 434 65 is_stmt 1 discriminator 2 view .LVU49
+	.loc 1 434 343 discriminator 2 view .LVU50
+	.loc 1 434 348 discriminator 2 view .LVU51
+# Lib/munit_test/test_memory.c:434:     assert_ssizeC_exc(yp_collect(2, &exc), >=, 0);  // collects whatever remains
+	.loc 1 434 351 is_stmt 0 discriminator 2 view .LVU52
+	testq	%rax, %rax	# _ypmt_TYPEC_a
+	js	.L14	#,
+	.loc 1 434 346 is_stmt 1 discriminator 6 view .LVU53
+.LBE6:
+	.loc 1 434 8 discriminator 6 view .LVU54
+	.loc 1 435 5 discriminator 6 view .LVU55
+	call	yp_collect_disable@PLT	#
+.LVL19:
+	.loc 1 437 5 discriminator 6 view .LVU56
+	leaq	-176(%rbp), %rdi	#, tmp125
+	call	yp_collect_stats@PLT	#
+.LVL20:
+	.loc 1 438 5 discriminator 6 view .LVU57
+.LBB8:
+	.loc 1 438 10 discriminator 6 view .LVU58
+# Lib/munit_test/test_memory.c:438:     assert_ssizeC(after.collections[0] - before.collections[0], >, 0);
+	.loc 1 438 21 is_stmt 0 discriminator 6 view .LVU59
+	movq	-96(%rbp), %rsi	# before.collections[0],
+	movq	-176(%rbp), %rdi	# after.collections[0],
+	call	__subvdi3@PLT	#
+.LVL21:
+	.loc 1 438 84 is_stmt 1 discriminator 6 view .LVU60
+	.loc 1 438 115 discriminator 6 view .LVU61
+# Lib/munit_test/test_memory.c:438:     assert_ssizeC(after.collections[0] - before.collections[0], >, 0);
+	.loc 1 438 118 is_stmt 0 discriminator 6 view .LVU62
+	testq	%rax, %rax	# munit_tmp_a_
+	jle	.L15	#,
+.LBE8:
+	.loc 1 438 8 is_stmt 1 discriminator 2 view .LVU63
+	.loc 1 439 5 discriminator 2 view .LVU64
+.LBB9:
+	.loc 1 439 10 discriminator 2 view .LVU65
+# Lib/munit_test/test_memory.c:439:     assert_ssizeC(after.collected[0] + after.collected[1] + after.collected[2] -
+	.loc 1 439 56 is_stmt 0 discriminator 2 view .LVU66
+	movq	-144(%rbp), %rsi	# after.collected[1],
+	movq	-152(%rbp), %rdi	# after.collected[0],
+	call	__addvdi3@PLT	#
+.LVL22:
+	.loc 1 439 56 discriminator 2 view .LVU67
+	movq	%rax, %rdi	# tmp147, tmp131
+# Lib/munit_test/test_memory.c:439:     assert_ssizeC(after.collected[0] + after.collected[1] + after.collected[2] -
+	.loc 1 439 77 discriminator 2 view .LVU68
+	movq	-136(%rbp), %rsi	# after.collected[2],
+	call	__addvdi3@PLT	#
+.LVL23:
+	movq	%rax, %rbx	# tmp148, tmp132
+# Lib/munit_test/test_memory.c:439:     assert_ssizeC(after.collected[0] + after.collected[1] + after.collected[2] -
+	.loc 1 439 121 discriminator 2 view .LVU69
+	movq	-64(%rbp), %rsi	# before.collected[1],
+	movq	-72(%rbp), %rdi	# before.collected[0],
+	call	__addvdi3@PLT	#
+.LVL24:
+	movq	%rax, %rdi	# tmp149, tmp133
+# Lib/munit_test/test_memory.c:439:     assert_ssizeC(after.collected[0] + after.collected[1] + after.collected[2] -
+	.loc 1 439 143 discriminator 2 view .LVU70
+	movq	-56(%rbp), %rsi	# before.collected[2],
+	call	__addvdi3@PLT	#
+.LVL25:
+	movq	%rax, %rsi	# tmp150, tmp134
+# Lib/munit_test/test_memory.c:439:     assert_ssizeC(after.collected[0] + after.collected[1] + after.collected[2] -
+	.loc 1 439 21 discriminator 2 view .LVU71
+	movq	%rbx, %rdi	# tmp132,
+	call	__subvdi3@PLT	#
+.LVL26:
+	.loc 1 439 168 is_stmt 1 discriminator 2 view .LVU72
+	.loc 1 439 202 discriminator 2 view .LVU73
+# Lib/munit_test/test_memory.c:439:     assert_ssizeC(after.collected[0] + after.collected[1] + after.collected[2] -
+	.loc 1 439 205 is_stmt 0 discriminator 2 view .LVU74
+	cmpq	$1000, %rax	#, munit_tmp_a_
+	jne	.L16	#,
+.LBE9:
+	.loc 1 439 8 is_stmt 1 discriminator 2 view .LVU75
+	.loc 1 443 5 discriminator 2 view .LVU76
+# Lib/munit_test/test_memory.c:444: }
+	.loc 1 444 1 is_stmt 0 discriminator 2 view .LVU77
+	movl	$0, %eax	#,
+.LVL27:
+	.loc 1 444 1 discriminator 2 view .LVU78
+	leaq	-16(%rbp), %rsp	#,
+	popq	%rbx	#
+	popq	%r12	#
+.LVL28:
+	.loc 1 444 1 discriminator 2 view .LVU79
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL29:
+.L14:
+	.cfi_restore_state
+.LBB10:
+	.loc 1 434 389 is_stmt 1 discriminator 5 view .LVU80
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	movq	%rax, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC5(%rip), %rcx	#, tmp122
+	leaq	.LC8(%rip), %rdx	#, tmp123
+	movl	$434, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp124
+	movl	$0, %eax	#,
+.LVL30:
+	.loc 1 434 389 is_stmt 0 discriminator 5 view .LVU81
+	call	munit_errorf_ex@PLT	#
+.LVL31:
+.L15:
+	.loc 1 434 389 discriminator 5 view .LVU82
+.LBE10:
+.LBB11:
+	.loc 1 438 153 is_stmt 1 discriminator 1 view .LVU83
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC9(%rip), %r8	#, tmp127
+	pushq	%r8	# tmp127
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC10(%rip), %rcx	#, tmp128
+	leaq	.LC11(%rip), %rdx	#, tmp129
+	movl	$438, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp130
+	movl	$0, %eax	#,
+.LVL32:
+	.loc 1 438 153 is_stmt 0 discriminator 1 view .LVU84
+	call	munit_errorf_ex@PLT	#
+.LVL33:
+.L16:
+	.loc 1 438 153 discriminator 1 view .LVU85
+.LBE11:
+.LBB12:
+	.loc 1 439 241 is_stmt 1 discriminator 1 view .LVU86
+	subq	$8, %rsp	#,
+	pushq	$1000	#
+	leaq	.LC13(%rip), %r8	#, tmp136
+	pushq	%r8	# tmp136
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC12(%rip), %r9	#,
+	leaq	.LC14(%rip), %rcx	#, tmp137
+	leaq	.LC11(%rip), %rdx	#, tmp138
+	movl	$439, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp139
+	movl	$0, %eax	#,
+.LVL34:
+	.loc 1 439 241 is_stmt 0 discriminator 1 view .LVU87
+	call	munit_errorf_ex@PLT	#
+.LVL35:
+	.loc 1 439 241 discriminator 1 view .LVU88
+.LBE12:
+	.cfi_endproc
+.LFE39:
+	.size	test_collect_automatic, .-test_collect_automatic
+	.section	.rodata.str1.1
+.LC15:
+	.string	"1"
+.LC16:
+	.string	"yp_collect(0, &exc)"
+	.section	.rodata.str1.8
+	.align 8
+.LC17:
+	.string	"assertion failed: %s == %s; !yp_isexceptionC(exc)"
+	.align 8
+.LC18:
+	.string	"exc set to a non-exception: %s == %s"
+	.align 8
+.LC19:
+	.string	"assertion failed: %s == %s (%ld == %ld) "
+	.align 8
+.LC20:
+	.string	"yp_setitem(dict, yp_i_one, list, &exc)"
+	.align 8
+.LC21:
+	.string	"yp_setindexC(list, 0, tuple, &exc)"
+	.section	.rodata.str1.1
+.LC22:
+	.string	"3"
+.LC23:
+	.string	"yp_append(list, other, &exc)"
+.LC24:
+	.string	"other"
+.LC25:
+	.string	"list"
+	.section	.rodata.str1.8
+	.align 8
+.LC26:
+	.string	"assertion failed: yp_lenC(%s, &exc) == %ld; !yp_isexceptionC(exc)"
+	.align 8
+.LC27:
+	.string	"exc set to a non-exception: yp_lenC(%s, &exc) == %ld"
+	.align 8
+.LC28:
+	.string	"assertion failed: yp_lenC(%s, &exc) == %ld (%ld == %ld)"
+	.align 8
+.LC29:
+	.string	"assertion failed: !yp_isexceptionC(yp_getindexC(%s, %ld))"
+	.align 8
+.LC30:
+	.string	"assertion failed: yp_eq(yp_getindexC(%s, %ld), %s) == yp_True"
+	.align 8
+.LC31:
+	.string	"assertion failed: !yp_isexceptionC(yp_eq(yp_getindexC(%s, %ld), %s))"
+	.align 8
+.LC32:
+	.string	"expected a bool or an exception: yp_eq(yp_getindexC(%s, %ld), %s)"
+	.align 8
+.LC33:
+	.string	"assertion failed: yp_type(yp_getindexC(%s, %ld)) == yp_type(%s) (%p == %p) "
+	.section	.rodata.str1.1
+.LC34:
+	.string	"after.tracked[0]"
+.LC35:
+	.string	"2"
+.LC36:
+	.string	"after.tracked[1]"
+.LC37:
+	.string	"yp_clear(list, &exc)"
+.LC38:
+	.string	"4"
+	.section	.rodata.str1.8
+	.align 8
+.LC39:
+	.string	"after.collections[2] - before.collections[2]"
+	.align 8
+.LC40:
+	.string	"after.collected[0] - before.collected[0]"
+	.align 8
+.LC41:
+	.string	"after.collected[2] - before.collected[2]"
+	.align 8
+.LC42:
+	.string	"after.tracked[0] + after.tracked[1] + after.tracked[2]"
+	.section	.rodata.str1.1
+.LC43:
+	.string	"yp_ValueError"
+.LC44:
+	.string	"yp_collect(-1, &exc)"
+	.section	.rodata.str1.8
+	.align 8
+.LC45:
+	.string	"assertion failed: %s; yp_isexceptionC(exc) (expected %s)"
+	.align 8
+.LC46:
+	.string	"assertion failed: %s; yp_isexceptionCN(exc, N(%s))"
+	.section	.rodata.str1.1
+.LC47:
+	.string	"-1"
+.LC48:
+	.string	"yp_collect(3, &exc)"
+	.text
+	.type	test_collect, @function
+test_collect:
+.LVL36:
+.LFB38:
+	.loc 1 353 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 353 1 is_stmt 0 view .LVU90
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$184, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 354 5 is_stmt 1 view .LVU91
+	.loc 1 355 5 view .LVU92
+	.loc 1 357 5 view .LVU93
+	leaq	-128(%rbp), %rdi	#, tmp170
+.LVL37:
+	.loc 1 357 5 is_stmt 0 view .LVU94
+	call	yp_collect_stats@PLT	#
+.LVL38:
+	.loc 1 358 5 is_stmt 1 view .LVU95
+	movq	$-1, %rdi	#,
+	call	yp_collect_enable@PLT	#
+.LVL39:
+.LBB13:
+	.loc 1 362 9 view .LVU96
+# Lib/munit_test/test_memory.c:362:         ypObject *list = yp_listN(0);
+	.loc 1 362 26 is_stmt 0 view .LVU97
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_listN@PLT	#
+.LVL40:
+	movq	%rax, %rbx	# tmp370, list
+.LVL41:
+	.loc 1 363 9 is_stmt 1 view .LVU98
+.LBB14:
+	.loc 1 363 14 view .LVU99
+# Lib/munit_test/test_memory.c:363:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 363 24 is_stmt 0 view .LVU100
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 363 10 is_stmt 1 view .LVU101
+# Lib/munit_test/test_memory.c:363:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 363 11 is_stmt 0 view .LVU102
+	leaq	-216(%rbp), %rdx	#, tmp171
+	movq	%rax, %rsi	# list,
+	movq	%rax, %rdi	# list,
+	call	yp_append@PLT	#
+.LVL42:
+	.loc 1 363 41 is_stmt 1 view .LVU103
+# Lib/munit_test/test_memory.c:363:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 363 49 is_stmt 0 view .LVU104
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.4_1
+# Lib/munit_test/test_memory.c:363:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 363 44 view .LVU105
+	testq	%rdi, %rdi	# exc.4_1
+	je	.L18	#,
+	.loc 1 363 12 is_stmt 1 discriminator 1 view .LVU106
+# Lib/munit_test/test_memory.c:363:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 363 16 is_stmt 0 discriminator 1 view .LVU107
+	call	yp_isexceptionC@PLT	#
+.LVL43:
+# Lib/munit_test/test_memory.c:363:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 363 15 discriminator 1 view .LVU108
+	testl	%eax, %eax	# tmp371
+	je	.L19	#,
+	.loc 1 363 40 is_stmt 1 discriminator 2 view .LVU109
+	leaq	.LC0(%rip), %rcx	#, tmp172
+	leaq	.LC1(%rip), %rdx	#, tmp173
+	movl	$363, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp174
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL44:
+.L19:
+	.loc 1 363 180 discriminator 3 view .LVU110
+	leaq	.LC0(%rip), %rcx	#, tmp175
+	leaq	.LC3(%rip), %rdx	#, tmp176
+	movl	$363, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp177
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL45:
+.L18:
+.LBE14:
+	.loc 1 363 12 view .LVU111
+	.loc 1 364 9 view .LVU112
+	movq	%rbx, %rdi	# list,
+	call	yp_decref@PLT	#
+.LVL46:
+	.loc 1 365 9 view .LVU113
+.LBB15:
+	.loc 1 365 14 view .LVU114
+	.loc 1 365 40 view .LVU115
+	.loc 1 365 66 view .LVU116
+.LBB16:
+	.loc 1 365 71 view .LVU117
+# Lib/munit_test/test_memory.c:365:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 1);
+	.loc 1 365 81 is_stmt 0 view .LVU118
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 365 10 is_stmt 1 view .LVU119
+# Lib/munit_test/test_memory.c:365:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 1);
+	.loc 1 365 27 is_stmt 0 view .LVU120
+	leaq	-216(%rbp), %rsi	#, tmp178
+	movl	$0, %edi	#,
+	call	yp_collect@PLT	#
+.LVL47:
+	.loc 1 365 49 is_stmt 1 view .LVU121
+	.loc 1 365 70 view .LVU122
+# Lib/munit_test/test_memory.c:365:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 1);
+	.loc 1 365 78 is_stmt 0 view .LVU123
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.6_3
+# Lib/munit_test/test_memory.c:365:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 1);
+	.loc 1 365 73 view .LVU124
+	testq	%rdi, %rdi	# exc.6_3
+	je	.L20	#,
+	.loc 1 365 12 is_stmt 1 discriminator 1 view .LVU125
+# Lib/munit_test/test_memory.c:365:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 1);
+	.loc 1 365 16 is_stmt 0 discriminator 1 view .LVU126
+	call	yp_isexceptionC@PLT	#
+.LVL48:
+# Lib/munit_test/test_memory.c:365:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 1);
+	.loc 1 365 15 discriminator 1 view .LVU127
+	testl	%eax, %eax	# tmp373
+	je	.L21	#,
+	.loc 1 365 40 is_stmt 1 discriminator 3 view .LVU128
+	leaq	.LC15(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp179
+	leaq	.LC17(%rip), %rdx	#, tmp180
+	movl	$365, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp181
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL49:
+.L21:
+	.loc 1 365 195 discriminator 4 view .LVU129
+	leaq	.LC15(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp182
+	leaq	.LC18(%rip), %rdx	#, tmp183
+	movl	$365, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp184
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL50:
+.L20:
+	.loc 1 365 195 is_stmt 0 discriminator 4 view .LVU130
+.LBE16:
+	.loc 1 365 69 is_stmt 1 discriminator 2 view .LVU131
+	.loc 1 365 347 discriminator 2 view .LVU132
+	.loc 1 365 352 discriminator 2 view .LVU133
+# Lib/munit_test/test_memory.c:365:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 1);
+	.loc 1 365 355 is_stmt 0 discriminator 2 view .LVU134
+	cmpq	$1, %rax	#, _ypmt_TYPEC_a
+	jne	.L71	#,
+	.loc 1 365 350 is_stmt 1 discriminator 6 view .LVU135
+.LBE15:
+	.loc 1 365 12 discriminator 6 view .LVU136
+.LBE13:
+.LBB18:
+	.loc 1 370 9 discriminator 6 view .LVU137
+# Lib/munit_test/test_memory.c:370:         ypObject *dict = yp_dictK(0);
+	.loc 1 370 26 is_stmt 0 discriminator 6 view .LVU138
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+.LVL51:
+	.loc 1 370 26 discriminator 6 view .LVU139
+	call	yp_dictK@PLT	#
+.LVL52:
+	movq	%rax, %r12	# tmp374, dict
+.LVL53:
+	.loc 1 371 9 is_stmt 1 discriminator 6 view .LVU140
+# Lib/munit_test/test_memory.c:371:         ypObject *list = yp_listN(N(yp_None));
+	.loc 1 371 26 is_stmt 0 discriminator 6 view .LVU141
+	movq	yp_None(%rip), %rsi	# yp_None,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL54:
+	.loc 1 371 26 discriminator 6 view .LVU142
+	call	yp_listN@PLT	#
+.LVL55:
+	movq	%rax, %rbx	# tmp375, list
+.LVL56:
+	.loc 1 372 9 is_stmt 1 discriminator 6 view .LVU143
+# Lib/munit_test/test_memory.c:372:         ypObject *tuple = yp_tupleN(N(dict, list));
+	.loc 1 372 27 is_stmt 0 discriminator 6 view .LVU144
+	movq	%rax, %rdx	# list,
+	movq	%r12, %rsi	# dict,
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+.LVL57:
+	.loc 1 372 27 discriminator 6 view .LVU145
+	call	yp_tupleN@PLT	#
+.LVL58:
+	.loc 1 372 27 discriminator 6 view .LVU146
+	movq	%rax, %r13	# tmp376, tuple
+.LVL59:
+	.loc 1 373 9 is_stmt 1 discriminator 6 view .LVU147
+.LBB19:
+	.loc 1 373 14 discriminator 6 view .LVU148
+# Lib/munit_test/test_memory.c:373:         assert_not_raises_exc(yp_setitem(dict, yp_i_one, list, &exc));
+	.loc 1 373 24 is_stmt 0 discriminator 6 view .LVU149
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 373 10 is_stmt 1 discriminator 6 view .LVU150
+# Lib/munit_test/test_memory.c:373:         assert_not_raises_exc(yp_setitem(dict, yp_i_one, list, &exc));
+	.loc 1 373 11 is_stmt 0 discriminator 6 view .LVU151
+	leaq	-216(%rbp), %rcx	#, tmp188
+	movq	%rbx, %rdx	# list,
+	movq	yp_i_one(%rip), %rsi	# yp_i_one,
+	movq	%r12, %rdi	# dict,
+	call	yp_setitem@PLT	#
+.LVL60:
+	.loc 1 373 52 is_stmt 1 discriminator 6 view .LVU152
+# Lib/munit_test/test_memory.c:373:         assert_not_raises_exc(yp_setitem(dict, yp_i_one, list, &exc));
+	.loc 1 373 60 is_stmt 0 discriminator 6 view .LVU153
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.10_7
+# Lib/munit_test/test_memory.c:373:         assert_not_raises_exc(yp_setitem(dict, yp_i_one, list, &exc));
+	.loc 1 373 55 discriminator 6 view .LVU154
+	testq	%rdi, %rdi	# exc.10_7
+	je	.L23	#,
+	.loc 1 373 12 is_stmt 1 discriminator 1 view .LVU155
+# Lib/munit_test/test_memory.c:373:         assert_not_raises_exc(yp_setitem(dict, yp_i_one, list, &exc));
+	.loc 1 373 16 is_stmt 0 discriminator 1 view .LVU156
+	call	yp_isexceptionC@PLT	#
+.LVL61:
+# Lib/munit_test/test_memory.c:373:         assert_not_raises_exc(yp_setitem(dict, yp_i_one, list, &exc));
+	.loc 1 373 15 discriminator 1 view .LVU157
+	testl	%eax, %eax	# tmp377
+	je	.L24	#,
+	.loc 1 373 40 is_stmt 1 discriminator 2 view .LVU158
+	leaq	.LC20(%rip), %rcx	#, tmp190
+	leaq	.LC1(%rip), %rdx	#, tmp191
+	movl	$373, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp192
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL62:
+.L71:
+	.loc 1 373 40 is_stmt 0 discriminator 2 view .LVU159
+.LBE19:
+.LBE18:
+.LBB25:
+.LBB17:
+	.loc 1 365 393 is_stmt 1 discriminator 5 view .LVU160
+	subq	$8, %rsp	#,
+	pushq	$1	#
+	movq	%rax, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC15(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp185
+	leaq	.LC19(%rip), %rdx	#, tmp186
+	movl	$365, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp187
+	movl	$0, %eax	#,
+.LVL63:
+	.loc 1 365 393 is_stmt 0 discriminator 5 view .LVU161
+	call	munit_errorf_ex@PLT	#
+.LVL64:
+.L24:
+	.loc 1 365 393 discriminator 5 view .LVU162
+.LBE17:
+.LBE25:
+.LBB26:
+.LBB20:
+	.loc 1 373 191 is_stmt 1 discriminator 3 view .LVU163
+	leaq	.LC20(%rip), %rcx	#, tmp193
+	leaq	.LC3(%rip), %rdx	#, tmp194
+	movl	$373, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp195
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL65:
+.L23:
+.LBE20:
+	.loc 1 373 12 view .LVU164
+	.loc 1 374 9 view .LVU165
+.LBB21:
+	.loc 1 374 14 view .LVU166
+# Lib/munit_test/test_memory.c:374:         assert_not_raises_exc(yp_setindexC(list, 0, tuple, &exc));
+	.loc 1 374 24 is_stmt 0 view .LVU167
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 374 10 is_stmt 1 view .LVU168
+# Lib/munit_test/test_memory.c:374:         assert_not_raises_exc(yp_setindexC(list, 0, tuple, &exc));
+	.loc 1 374 11 is_stmt 0 view .LVU169
+	leaq	-216(%rbp), %rcx	#, tmp196
+	movq	%r13, %rdx	# tuple,
+	movl	$0, %esi	#,
+	movq	%rbx, %rdi	# list,
+	call	yp_setindexC@PLT	#
+.LVL66:
+	.loc 1 374 48 is_stmt 1 view .LVU170
+# Lib/munit_test/test_memory.c:374:         assert_not_raises_exc(yp_setindexC(list, 0, tuple, &exc));
+	.loc 1 374 56 is_stmt 0 view .LVU171
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.12_9
+# Lib/munit_test/test_memory.c:374:         assert_not_raises_exc(yp_setindexC(list, 0, tuple, &exc));
+	.loc 1 374 51 view .LVU172
+	testq	%rdi, %rdi	# exc.12_9
+	je	.L25	#,
+	.loc 1 374 12 is_stmt 1 discriminator 1 view .LVU173
+# Lib/munit_test/test_memory.c:374:         assert_not_raises_exc(yp_setindexC(list, 0, tuple, &exc));
+	.loc 1 374 16 is_stmt 0 discriminator 1 view .LVU174
+	call	yp_isexceptionC@PLT	#
+.LVL67:
+# Lib/munit_test/test_memory.c:374:         assert_not_raises_exc(yp_setindexC(list, 0, tuple, &exc));
+	.loc 1 374 15 discriminator 1 view .LVU175
+	testl	%eax, %eax	# tmp378
+	je	.L26	#,
+	.loc 1 374 40 is_stmt 1 discriminator 2 view .LVU176
+	leaq	.LC21(%rip), %rcx	#, tmp197
+	leaq	.LC1(%rip), %rdx	#, tmp198
+	movl	$374, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp199
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL68:
+.L26:
+	.loc 1 374 187 discriminator 3 view .LVU177
+	leaq	.LC21(%rip), %rcx	#, tmp200
+	leaq	.LC3(%rip), %rdx	#, tmp201
+	movl	$374, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp202
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL69:
+.L25:
+.LBE21:
+	.loc 1 374 12 view .LVU178
+	.loc 1 375 9 view .LVU179
+	movq	%r13, %rcx	# tuple,
+	movq	%rbx, %rdx	# list,
+	movq	%r12, %rsi	# dict,
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_decrefN@PLT	#
+.LVL70:
+	.loc 1 376 9 view .LVU180
+.LBB22:
+	.loc 1 376 14 view .LVU181
+	.loc 1 376 40 view .LVU182
+	.loc 1 376 66 view .LVU183
+.LBB23:
+	.loc 1 376 71 view .LVU184
+# Lib/munit_test/test_memory.c:376:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 3);
+	.loc 1 376 81 is_stmt 0 view .LVU185
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 376 10 is_stmt 1 view .LVU186
+# Lib/munit_test/test_memory.c:376:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 3);
+	.loc 1 376 27 is_stmt 0 view .LVU187
+	leaq	-216(%rbp), %rsi	#, tmp203
+	movl	$0, %edi	#,
+	call	yp_collect@PLT	#
+.LVL71:
+	.loc 1 376 49 is_stmt 1 view .LVU188
+	.loc 1 376 70 view .LVU189
+# Lib/munit_test/test_memory.c:376:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 3);
+	.loc 1 376 78 is_stmt 0 view .LVU190
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.14_11
+# Lib/munit_test/test_memory.c:376:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 3);
+	.loc 1 376 73 view .LVU191
+	testq	%rdi, %rdi	# exc.14_11
+	je	.L27	#,
+	.loc 1 376 12 is_stmt 1 discriminator 1 view .LVU192
+# Lib/munit_test/test_memory.c:376:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 3);
+	.loc 1 376 16 is_stmt 0 discriminator 1 view .LVU193
+	call	yp_isexceptionC@PLT	#
+.LVL72:
+# Lib/munit_test/test_memory.c:376:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 3);
+	.loc 1 376 15 discriminator 1 view .LVU194
+	testl	%eax, %eax	# tmp380
+	je	.L28	#,
+	.loc 1 376 40 is_stmt 1 discriminator 3 view .LVU195
+	leaq	.LC22(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp204
+	leaq	.LC17(%rip), %rdx	#, tmp205
+	movl	$376, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp206
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL73:
+.L28:
+	.loc 1 376 195 discriminator 4 view .LVU196
+	leaq	.LC22(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp207
+	leaq	.LC18(%rip), %rdx	#, tmp208
+	movl	$376, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp209
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL74:
+.L27:
+	.loc 1 376 195 is_stmt 0 discriminator 4 view .LVU197
+.LBE23:
+	.loc 1 376 69 is_stmt 1 discriminator 2 view .LVU198
+	.loc 1 376 347 discriminator 2 view .LVU199
+	.loc 1 376 352 discriminator 2 view .LVU200
+# Lib/munit_test/test_memory.c:376:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 3);
+	.loc 1 376 355 is_stmt 0 discriminator 2 view .LVU201
+	cmpq	$3, %rax	#, _ypmt_TYPEC_a
+	jne	.L72	#,
+	.loc 1 376 350 is_stmt 1 discriminator 6 view .LVU202
+.LBE22:
+	.loc 1 376 12 discriminator 6 view .LVU203
+.LBE26:
+.LBB27:
+	.loc 1 381 9 discriminator 6 view .LVU204
+# Lib/munit_test/test_memory.c:381:         ypObject *list = yp_listN(0);
+	.loc 1 381 26 is_stmt 0 discriminator 6 view .LVU205
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+.LVL75:
+	.loc 1 381 26 discriminator 6 view .LVU206
+	call	yp_listN@PLT	#
+.LVL76:
+	movq	%rax, %rbx	# tmp381, list
+.LVL77:
+	.loc 1 382 9 is_stmt 1 discriminator 6 view .LVU207
+# Lib/munit_test/test_memory.c:382:         ypObject *other = yp_listN(N(list));
+	.loc 1 382 27 is_stmt 0 discriminator 6 view .LVU208
+	movq	%rax, %rsi	# list,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+.LVL78:
+	.loc 1 382 27 discriminator 6 view .LVU209
+	call	yp_listN@PLT	#
+.LVL79:
+	movq	%rax, %r12	# tmp382, other
+.LVL80:
+	.loc 1 383 9 is_stmt 1 discriminator 6 view .LVU210
+.LBB28:
+	.loc 1 383 14 discriminator 6 view .LVU211
+# Lib/munit_test/test_memory.c:383:         assert_not_raises_exc(yp_append(list, other, &exc));
+	.loc 1 383 24 is_stmt 0 discriminator 6 view .LVU212
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 383 10 is_stmt 1 discriminator 6 view .LVU213
+# Lib/munit_test/test_memory.c:383:         assert_not_raises_exc(yp_append(list, other, &exc));
+	.loc 1 383 11 is_stmt 0 discriminator 6 view .LVU214
+	leaq	-216(%rbp), %rdx	#, tmp213
+	movq	%rax, %rsi	# other,
+	movq	%rbx, %rdi	# list,
+	call	yp_append@PLT	#
+.LVL81:
+	.loc 1 383 42 is_stmt 1 discriminator 6 view .LVU215
+# Lib/munit_test/test_memory.c:383:         assert_not_raises_exc(yp_append(list, other, &exc));
+	.loc 1 383 50 is_stmt 0 discriminator 6 view .LVU216
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.16_13
+# Lib/munit_test/test_memory.c:383:         assert_not_raises_exc(yp_append(list, other, &exc));
+	.loc 1 383 45 discriminator 6 view .LVU217
+	testq	%rdi, %rdi	# exc.16_13
+	je	.L30	#,
+	.loc 1 383 12 is_stmt 1 discriminator 1 view .LVU218
+# Lib/munit_test/test_memory.c:383:         assert_not_raises_exc(yp_append(list, other, &exc));
+	.loc 1 383 16 is_stmt 0 discriminator 1 view .LVU219
+	call	yp_isexceptionC@PLT	#
+.LVL82:
+# Lib/munit_test/test_memory.c:383:         assert_not_raises_exc(yp_append(list, other, &exc));
+	.loc 1 383 15 discriminator 1 view .LVU220
+	testl	%eax, %eax	# tmp383
+	je	.L31	#,
+	.loc 1 383 40 is_stmt 1 discriminator 2 view .LVU221
+	leaq	.LC23(%rip), %rcx	#, tmp214
+	leaq	.LC1(%rip), %rdx	#, tmp215
+	movl	$383, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp216
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL83:
+.L72:
+	.loc 1 383 40 is_stmt 0 discriminator 2 view .LVU222
+.LBE28:
+.LBE27:
+.LBB64:
+.LBB24:
+	.loc 1 376 393 is_stmt 1 discriminator 5 view .LVU223
+	subq	$8, %rsp	#,
+	pushq	$3	#
+	movq	%rax, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC22(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp210
+	leaq	.LC19(%rip), %rdx	#, tmp211
+	movl	$376, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp212
+	movl	$0, %eax	#,
+.LVL84:
+	.loc 1 376 393 is_stmt 0 discriminator 5 view .LVU224
+	call	munit_errorf_ex@PLT	#
+.LVL85:
+.L31:
+	.loc 1 376 393 discriminator 5 view .LVU225
+.LBE24:
+.LBE64:
+.LBB65:
+.LBB29:
+	.loc 1 383 181 is_stmt 1 discriminator 3 view .LVU226
+	leaq	.LC23(%rip), %rcx	#, tmp217
+	leaq	.LC3(%rip), %rdx	#, tmp218
+	movl	$383, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp219
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL86:
+.L30:
+.LBE29:
+	.loc 1 383 12 view .LVU227
+	.loc 1 384 9 view .LVU228
+	movq	%r12, %rdi	# other,
+	call	yp_decref@PLT	#
+.LVL87:
+	.loc 1 385 9 view .LVU229
+.LBB30:
+	.loc 1 385 14 view .LVU230
+	.loc 1 385 40 view .LVU231
+	.loc 1 385 66 view .LVU232
+.LBB31:
+	.loc 1 385 71 view .LVU233
+# Lib/munit_test/test_memory.c:385:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);
+	.loc 1 385 81 is_stmt 0 view .LVU234
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 385 10 is_stmt 1 view .LVU235
+# Lib/munit_test/test_memory.c:385:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);
+	.loc 1 385 27 is_stmt 0 view .LVU236
+	leaq	-216(%rbp), %rsi	#, tmp220
+	movl	$0, %edi	#,
+	call	yp_collect@PLT	#
+.LVL88:
+	movq	%rax, %r13	# tmp384, _ypmt_TYPEC_a
+.LVL89:
+	.loc 1 385 49 is_stmt 1 view .LVU237
+	.loc 1 385 70 view .LVU238
+# Lib/munit_test/test_memory.c:385:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);
+	.loc 1 385 78 is_stmt 0 view .LVU239
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.18_15
+# Lib/munit_test/test_memory.c:385:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);
+	.loc 1 385 73 view .LVU240
+	testq	%rdi, %rdi	# exc.18_15
+	je	.L32	#,
+	.loc 1 385 12 is_stmt 1 discriminator 1 view .LVU241
+# Lib/munit_test/test_memory.c:385:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);
+	.loc 1 385 16 is_stmt 0 discriminator 1 view .LVU242
+	call	yp_isexceptionC@PLT	#
+.LVL90:
+# Lib/munit_test/test_memory.c:385:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);
+	.loc 1 385 15 discriminator 1 view .LVU243
+	testl	%eax, %eax	# tmp385
+	je	.L33	#,
+	.loc 1 385 40 is_stmt 1 discriminator 3 view .LVU244
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp221
+	leaq	.LC17(%rip), %rdx	#, tmp222
+	movl	$385, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp223
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL91:
+.L33:
+	.loc 1 385 195 discriminator 4 view .LVU245
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp224
+	leaq	.LC18(%rip), %rdx	#, tmp225
+	movl	$385, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp226
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL92:
+.L32:
+	.loc 1 385 195 is_stmt 0 discriminator 4 view .LVU246
+.LBE31:
+	.loc 1 385 69 is_stmt 1 discriminator 2 view .LVU247
+	.loc 1 385 347 discriminator 2 view .LVU248
+	.loc 1 385 352 discriminator 2 view .LVU249
+# Lib/munit_test/test_memory.c:385:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);
+	.loc 1 385 355 is_stmt 0 discriminator 2 view .LVU250
+	testq	%rax, %rax	# _ypmt_TYPEC_a
+	jne	.L73	#,
+	.loc 1 385 350 is_stmt 1 discriminator 6 view .LVU251
+.LBE30:
+	.loc 1 385 12 discriminator 6 view .LVU252
+	.loc 1 386 9 discriminator 6 view .LVU253
+.LBB32:
+	.loc 1 386 14 discriminator 6 view .LVU254
+.LVL93:
+	.loc 1 386 48 discriminator 6 view .LVU255
+	.loc 1 386 87 discriminator 6 view .LVU256
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 93 is_stmt 0 discriminator 6 view .LVU257
+	leaq	.LC24(%rip), %rax	#, tmp417
+.LVL94:
+	.loc 1 386 93 discriminator 6 view .LVU258
+	movq	%rax, -224(%rbp)	# tmp417, MEM[(char *[1] *)_239][0]
+	.loc 1 386 128 is_stmt 1 discriminator 6 view .LVU259
+.LBB33:
+	.loc 1 386 133 discriminator 6 view .LVU260
+.LVL95:
+	.loc 1 386 244 discriminator 6 view .LVU261
+	.loc 1 386 268 discriminator 6 view .LVU262
+.LBB34:
+	.loc 1 386 273 discriminator 6 view .LVU263
+	.loc 1 386 302 discriminator 6 view .LVU264
+.LBB35:
+	.loc 1 386 307 discriminator 6 view .LVU265
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 317 is_stmt 0 discriminator 6 view .LVU266
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 386 10 is_stmt 1 discriminator 6 view .LVU267
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 29 is_stmt 0 discriminator 6 view .LVU268
+	leaq	-216(%rbp), %rsi	#, tmp231
+	movq	%rbx, %rdi	# list,
+	call	yp_lenC@PLT	#
+.LVL96:
+	movq	%rax, %r9	# tmp386, _ypmt_LEN_actual
+.LVL97:
+	.loc 1 386 59 is_stmt 1 discriminator 6 view .LVU269
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 67 is_stmt 0 discriminator 6 view .LVU270
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.20_17
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 62 discriminator 6 view .LVU271
+	testq	%rdi, %rdi	# exc.20_17
+	je	.L35	#,
+	.loc 1 386 12 is_stmt 1 discriminator 1 view .LVU272
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 16 is_stmt 0 discriminator 1 view .LVU273
+	call	yp_isexceptionC@PLT	#
+.LVL98:
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 15 discriminator 1 view .LVU274
+	testl	%eax, %eax	# tmp387
+	je	.L36	#,
+	.loc 1 386 40 is_stmt 1 discriminator 3 view .LVU275
+	movl	$1, %r8d	#,
+	leaq	.LC25(%rip), %rcx	#, tmp232
+	leaq	.LC26(%rip), %rdx	#, tmp233
+	movl	$386, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp234
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL99:
+.L73:
+	.loc 1 386 40 is_stmt 0 discriminator 3 view .LVU276
+.LBE35:
+.LBE34:
+.LBE33:
+.LBE32:
+.LBB47:
+	.loc 1 385 393 is_stmt 1 discriminator 5 view .LVU277
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	movq	%rax, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp227
+	leaq	.LC19(%rip), %rdx	#, tmp228
+	movl	$385, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp229
+	movl	$0, %eax	#,
+.LVL100:
+	.loc 1 385 393 is_stmt 0 discriminator 5 view .LVU278
+	call	munit_errorf_ex@PLT	#
+.LVL101:
+.L36:
+	.loc 1 385 393 discriminator 5 view .LVU279
+.LBE47:
+.LBB48:
+.LBB45:
+.LBB37:
+.LBB36:
+	.loc 1 386 59 is_stmt 1 discriminator 4 view .LVU280
+	movl	$1, %r8d	#,
+	leaq	.LC25(%rip), %rcx	#, tmp235
+	leaq	.LC27(%rip), %rdx	#, tmp236
+	movl	$386, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp237
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL102:
+.L35:
+	.loc 1 386 59 is_stmt 0 discriminator 4 view .LVU281
+.LBE36:
+	.loc 1 386 305 is_stmt 1 discriminator 2 view .LVU282
+	.loc 1 386 47 discriminator 2 view .LVU283
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 50 is_stmt 0 discriminator 2 view .LVU284
+	cmpq	$1, %rax	#, _ypmt_LEN_actual
+	jne	.L74	#,
+.LVL103:
+.L37:
+	.loc 1 386 50 discriminator 2 view .LVU285
+.LBE37:
+	.loc 1 386 115 is_stmt 1 discriminator 18 view .LVU286
+	testq	%r13, %r13	# _ypmt_TYPEC_a
+	jle	.L43	#,
+.LBE45:
+	.loc 1 386 131 discriminator 20 view .LVU287
+.LBE48:
+	.loc 1 386 12 discriminator 20 view .LVU288
+	.loc 1 387 9 discriminator 20 view .LVU289
+	leaq	-208(%rbp), %rdi	#, tmp261
+	call	yp_collect_stats@PLT	#
+.LVL104:
+	.loc 1 388 9 discriminator 20 view .LVU290
+.LBB49:
+	.loc 1 388 14 discriminator 20 view .LVU291
+# Lib/munit_test/test_memory.c:388:         assert_ssizeC(after.tracked[0], ==, 0);
+	.loc 1 388 25 is_stmt 0 discriminator 20 view .LVU292
+	movq	-160(%rbp), %rax	# after.tracked[0], munit_tmp_a_
+.LVL105:
+	.loc 1 388 60 is_stmt 1 discriminator 20 view .LVU293
+	.loc 1 388 91 discriminator 20 view .LVU294
+# Lib/munit_test/test_memory.c:388:         assert_ssizeC(after.tracked[0], ==, 0);
+	.loc 1 388 94 is_stmt 0 discriminator 20 view .LVU295
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L75	#,
+.LBE49:
+	.loc 1 388 12 is_stmt 1 discriminator 2 view .LVU296
+	.loc 1 389 9 discriminator 2 view .LVU297
+.LBB50:
+	.loc 1 389 14 discriminator 2 view .LVU298
+# Lib/munit_test/test_memory.c:389:         assert_ssizeC(after.tracked[1], ==, 2);
+	.loc 1 389 25 is_stmt 0 discriminator 2 view .LVU299
+	movq	-152(%rbp), %rax	# after.tracked[1], munit_tmp_a_
+.LVL106:
+	.loc 1 389 60 is_stmt 1 discriminator 2 view .LVU300
+	.loc 1 389 91 discriminator 2 view .LVU301
+# Lib/munit_test/test_memory.c:389:         assert_ssizeC(after.tracked[1], ==, 2);
+	.loc 1 389 94 is_stmt 0 discriminator 2 view .LVU302
+	cmpq	$2, %rax	#, munit_tmp_a_
+	jne	.L76	#,
+.LBE50:
+	.loc 1 389 12 is_stmt 1 discriminator 2 view .LVU303
+	.loc 1 391 9 discriminator 2 view .LVU304
+	movq	%rbx, %rdi	# list,
+	call	yp_decref@PLT	#
+.LVL107:
+	.loc 1 392 9 discriminator 2 view .LVU305
+.LBB51:
+	.loc 1 392 14 discriminator 2 view .LVU306
+	.loc 1 392 40 discriminator 2 view .LVU307
+	.loc 1 392 66 discriminator 2 view .LVU308
+.LBB52:
+	.loc 1 392 71 discriminator 2 view .LVU309
+# Lib/munit_test/test_memory.c:392:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);  // generation 1 isn't examined
+	.loc 1 392 81 is_stmt 0 discriminator 2 view .LVU310
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 392 10 is_stmt 1 discriminator 2 view .LVU311
+# Lib/munit_test/test_memory.c:392:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);  // generation 1 isn't examined
+	.loc 1 392 27 is_stmt 0 discriminator 2 view .LVU312
+	leaq	-216(%rbp), %rsi	#, tmp270
+	movl	$0, %edi	#,
+	call	yp_collect@PLT	#
+.LVL108:
+	movq	%rax, %r9	# tmp395, _ypmt_TYPEC_a
+.LVL109:
+	.loc 1 392 49 is_stmt 1 discriminator 2 view .LVU313
+	.loc 1 392 70 discriminator 2 view .LVU314
+# Lib/munit_test/test_memory.c:392:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);  // generation 1 isn't examined
+	.loc 1 392 78 is_stmt 0 discriminator 2 view .LVU315
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.24_27
+# Lib/munit_test/test_memory.c:392:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);  // generation 1 isn't examined
+	.loc 1 392 73 discriminator 2 view .LVU316
+	testq	%rdi, %rdi	# exc.24_27
+	je	.L46	#,
+	.loc 1 392 12 is_stmt 1 discriminator 1 view .LVU317
+# Lib/munit_test/test_memory.c:392:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);  // generation 1 isn't examined
+	.loc 1 392 16 is_stmt 0 discriminator 1 view .LVU318
+	call	yp_isexceptionC@PLT	#
+.LVL110:
+# Lib/munit_test/test_memory.c:392:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);  // generation 1 isn't examined
+	.loc 1 392 15 discriminator 1 view .LVU319
+	testl	%eax, %eax	# tmp396
+	je	.L47	#,
+	.loc 1 392 40 is_stmt 1 discriminator 3 view .LVU320
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp271
+	leaq	.LC17(%rip), %rdx	#, tmp272
+	movl	$392, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp273
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL111:
+.L74:
+	.loc 1 392 40 is_stmt 0 discriminator 3 view .LVU321
+.LBE52:
+.LBE51:
+.LBB54:
+.LBB46:
+.LBB38:
+	.loc 1 386 86 is_stmt 1 discriminator 5 view .LVU322
+	subq	$8, %rsp	#,
+	pushq	$1	#
+	movl	$1, %r8d	#,
+	leaq	.LC25(%rip), %rcx	#, tmp238
+	leaq	.LC28(%rip), %rdx	#, tmp239
+	movl	$386, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp240
+	movl	$0, %eax	#,
+.LVL112:
+	.loc 1 386 86 is_stmt 0 discriminator 5 view .LVU323
+	call	munit_errorf_ex@PLT	#
+.LVL113:
+.L43:
+	.loc 1 386 86 discriminator 5 view .LVU324
+.LBE38:
+.LBB39:
+	.loc 1 386 147 is_stmt 1 discriminator 19 view .LVU325
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 176 is_stmt 0 discriminator 19 view .LVU326
+	movq	%r13, %rsi	# _ypmt_TYPEC_a,
+	movq	%rbx, %rdi	# list,
+	call	yp_getindexC@PLT	#
+.LVL114:
+	movq	%rax, %r14	# tmp388, _ypmt_SEQ_actual
+.LVL115:
+	.loc 1 386 218 is_stmt 1 discriminator 19 view .LVU327
+	.loc 1 386 223 discriminator 19 view .LVU328
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 227 is_stmt 0 discriminator 19 view .LVU329
+	movq	%rax, %rdi	# _ypmt_SEQ_actual,
+	call	yp_isexceptionC@PLT	#
+.LVL116:
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 226 discriminator 19 view .LVU330
+	testl	%eax, %eax	# tmp389
+	jne	.L77	#,
+	.loc 1 386 221 is_stmt 1 discriminator 9 view .LVU331
+	.loc 1 386 54 discriminator 9 view .LVU332
+	.loc 1 386 59 discriminator 9 view .LVU333
+.LBB40:
+	.loc 1 386 64 discriminator 9 view .LVU334
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 93 is_stmt 0 discriminator 9 view .LVU335
+	movq	%r12, %rsi	# other,
+	movq	%r14, %rdi	# _ypmt_SEQ_actual,
+	call	yp_eq@PLT	#
+.LVL117:
+	movq	%rax, %rdi	# tmp390, _ypmt_OBJ_result
+.LVL118:
+	.loc 1 386 148 is_stmt 1 discriminator 9 view .LVU336
+	.loc 1 386 153 discriminator 9 view .LVU337
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 156 is_stmt 0 discriminator 9 view .LVU338
+	cmpq	%rax, yp_True(%rip)	# _ypmt_OBJ_result, yp_True
+	jne	.L78	#,
+	.loc 1 386 188 is_stmt 1 view .LVU339
+	.loc 1 386 112 view .LVU340
+	.loc 1 386 151 view .LVU341
+.LBE40:
+	.loc 1 386 62 view .LVU342
+	.loc 1 386 124 view .LVU343
+.LBB41:
+	.loc 1 386 129 view .LVU344
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 159 is_stmt 0 view .LVU345
+	movq	%r14, %rdi	# _ypmt_SEQ_actual,
+	call	yp_type@PLT	#
+.LVL119:
+	.loc 1 386 159 view .LVU346
+	movq	%rax, %r15	# tmp392, _ypmt_TYPE_type_a
+.LVL120:
+	.loc 1 386 186 is_stmt 1 view .LVU347
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 216 is_stmt 0 view .LVU348
+	movq	%r12, %rdi	# other,
+	call	yp_type@PLT	#
+.LVL121:
+	.loc 1 386 255 is_stmt 1 view .LVU349
+	.loc 1 386 260 view .LVU350
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 263 is_stmt 0 view .LVU351
+	cmpq	%rax, %r15	# _ypmt_TYPE_type_b, _ypmt_TYPE_type_a
+	jne	.L79	#,
+	.loc 1 386 258 is_stmt 1 discriminator 17 view .LVU352
+.LBE41:
+	.loc 1 386 127 discriminator 17 view .LVU353
+	.loc 1 386 57 discriminator 17 view .LVU354
+	.loc 1 386 218 discriminator 17 view .LVU355
+	movq	%r14, %rdi	# _ypmt_SEQ_actual,
+	call	yp_decref@PLT	#
+.LVL122:
+	.loc 1 386 218 is_stmt 0 discriminator 17 view .LVU356
+.LBE39:
+	.loc 1 386 141 is_stmt 1 discriminator 17 view .LVU357
+	movl	$1, %esi	#,
+	movq	%r13, %rdi	# _ypmt_TYPEC_a,
+	call	__addvdi3@PLT	#
+.LVL123:
+	movq	%rax, %r13	# tmp394, _ypmt_TYPEC_a
+.LVL124:
+	.loc 1 386 141 is_stmt 0 discriminator 17 view .LVU358
+	jmp	.L37	#
+.LVL125:
+.L77:
+.LBB44:
+	.loc 1 386 264 is_stmt 1 discriminator 8 view .LVU359
+	movq	%r13, %r8	# _ypmt_TYPEC_a,
+	leaq	.LC25(%rip), %rcx	#, tmp241
+	leaq	.LC29(%rip), %rdx	#, tmp242
+	movl	$386, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp243
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL126:
+.L78:
+.LBB42:
+	.loc 1 386 195 discriminator 11 view .LVU360
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 198 is_stmt 0 discriminator 11 view .LVU361
+	cmpq	%rax, yp_False(%rip)	# _ypmt_OBJ_result, yp_False
+	je	.L80	#,
+	.loc 1 386 109 is_stmt 1 discriminator 13 view .LVU362
+	.loc 1 386 114 discriminator 13 view .LVU363
+	.loc 1 386 119 discriminator 13 view .LVU364
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 123 is_stmt 0 discriminator 13 view .LVU365
+	call	yp_isexceptionC@PLT	#
+.LVL127:
+# Lib/munit_test/test_memory.c:386:         assert_sequence(list, other);
+	.loc 1 386 122 discriminator 13 view .LVU366
+	testl	%eax, %eax	# tmp391
+	je	.L41	#,
+	.loc 1 386 160 is_stmt 1 discriminator 14 view .LVU367
+	movq	-224(%rbp,%r13,8), %r9	# MEM[(char *[1] *)_239][_ypmt_SEQ_i_58],
+	movq	%r13, %r8	# _ypmt_TYPEC_a,
+	leaq	.LC25(%rip), %rcx	#, tmp249
+	leaq	.LC31(%rip), %rdx	#, tmp250
+	movl	$386, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp251
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL128:
+.L80:
+	.loc 1 386 231 discriminator 12 view .LVU368
+	movq	-224(%rbp,%r13,8), %r9	# MEM[(char *[1] *)_239][_ypmt_SEQ_i_58],
+	movq	%r13, %r8	# _ypmt_TYPEC_a,
+	leaq	.LC25(%rip), %rcx	#, tmp245
+	leaq	.LC30(%rip), %rdx	#, tmp246
+	movl	$386, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp247
+	movl	$0, %eax	#,
+.LVL129:
+	.loc 1 386 231 is_stmt 0 discriminator 12 view .LVU369
+	call	munit_errorf_ex@PLT	#
+.LVL130:
+.L41:
+	.loc 1 386 117 is_stmt 1 discriminator 15 view .LVU370
+	.loc 1 386 102 discriminator 15 view .LVU371
+	movq	-224(%rbp,%r13,8), %r9	# MEM[(char *[1] *)_239][_ypmt_SEQ_i_58],
+	movq	%r13, %r8	# _ypmt_TYPEC_a,
+	leaq	.LC25(%rip), %rcx	#, tmp253
+	leaq	.LC32(%rip), %rdx	#, tmp254
+	movl	$386, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp255
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL131:
+.L79:
+	.loc 1 386 102 is_stmt 0 discriminator 15 view .LVU372
+.LBE42:
+.LBB43:
+	.loc 1 386 309 is_stmt 1 discriminator 16 view .LVU373
+	pushq	%rax	# _ypmt_TYPE_type_b
+	pushq	%r15	# _ypmt_TYPE_type_a
+	movq	-224(%rbp,%r13,8), %r9	# MEM[(char *[1] *)_239][_ypmt_SEQ_i_58],
+	movq	%r13, %r8	# _ypmt_TYPEC_a,
+	leaq	.LC25(%rip), %rcx	#, tmp257
+	leaq	.LC33(%rip), %rdx	#, tmp258
+	movl	$386, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp259
+	movl	$0, %eax	#,
+.LVL132:
+	.loc 1 386 309 is_stmt 0 discriminator 16 view .LVU374
+	call	munit_errorf_ex@PLT	#
+.LVL133:
+.L75:
+	.loc 1 386 309 discriminator 16 view .LVU375
+.LBE43:
+.LBE44:
+.LBE46:
+.LBE54:
+.LBB55:
+	.loc 1 388 130 is_stmt 1 discriminator 1 view .LVU376
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp262
+	pushq	%r8	# tmp262
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC34(%rip), %rcx	#, tmp263
+	leaq	.LC11(%rip), %rdx	#, tmp264
+	movl	$388, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp265
+	movl	$0, %eax	#,
+.LVL134:
+	.loc 1 388 130 is_stmt 0 discriminator 1 view .LVU377
+	call	munit_errorf_ex@PLT	#
+.LVL135:
+.L76:
+	.loc 1 388 130 discriminator 1 view .LVU378
+.LBE55:
+.LBB56:
+	.loc 1 389 130 is_stmt 1 discriminator 1 view .LVU379
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	leaq	.LC13(%rip), %r8	#, tmp266
+	pushq	%r8	# tmp266
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC35(%rip), %r9	#,
+	leaq	.LC36(%rip), %rcx	#, tmp267
+	leaq	.LC11(%rip), %rdx	#, tmp268
+	movl	$389, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp269
+	movl	$0, %eax	#,
+.LVL136:
+	.loc 1 389 130 is_stmt 0 discriminator 1 view .LVU380
+	call	munit_errorf_ex@PLT	#
+.LVL137:
+.L47:
+	.loc 1 389 130 discriminator 1 view .LVU381
+.LBE56:
+.LBB57:
+.LBB53:
+	.loc 1 392 195 is_stmt 1 discriminator 4 view .LVU382
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp274
+	leaq	.LC18(%rip), %rdx	#, tmp275
+	movl	$392, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp276
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL138:
+.L46:
+	.loc 1 392 195 is_stmt 0 discriminator 4 view .LVU383
+.LBE53:
+	.loc 1 392 69 is_stmt 1 discriminator 2 view .LVU384
+	.loc 1 392 347 discriminator 2 view .LVU385
+	.loc 1 392 352 discriminator 2 view .LVU386
+# Lib/munit_test/test_memory.c:392:         assert_ssizeC_exc(yp_collect(0, &exc), ==, 0);  // generation 1 isn't examined
+	.loc 1 392 355 is_stmt 0 discriminator 2 view .LVU387
+	testq	%rax, %rax	# _ypmt_TYPEC_a
+	jne	.L81	#,
+	.loc 1 392 350 is_stmt 1 discriminator 6 view .LVU388
+.LBE57:
+	.loc 1 392 12 discriminator 6 view .LVU389
+	.loc 1 393 9 discriminator 6 view .LVU390
+.LBB58:
+	.loc 1 393 14 discriminator 6 view .LVU391
+	.loc 1 393 40 discriminator 6 view .LVU392
+	.loc 1 393 66 discriminator 6 view .LVU393
+.LBB59:
+	.loc 1 393 71 discriminator 6 view .LVU394
+# Lib/munit_test/test_memory.c:393:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 2);
+	.loc 1 393 81 is_stmt 0 discriminator 6 view .LVU395
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 393 10 is_stmt 1 discriminator 6 view .LVU396
+# Lib/munit_test/test_memory.c:393:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 2);
+	.loc 1 393 27 is_stmt 0 discriminator 6 view .LVU397
+	leaq	-216(%rbp), %rsi	#, tmp280
+	movl	$2, %edi	#,
+	call	yp_collect@PLT	#
+.LVL139:
+	.loc 1 393 27 discriminator 6 view .LVU398
+	movq	%rax, %r9	# tmp397, _ypmt_TYPEC_a
+.LVL140:
+	.loc 1 393 49 is_stmt 1 discriminator 6 view .LVU399
+	.loc 1 393 70 discriminator 6 view .LVU400
+# Lib/munit_test/test_memory.c:393:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 2);
+	.loc 1 393 78 is_stmt 0 discriminator 6 view .LVU401
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.26_29
+# Lib/munit_test/test_memory.c:393:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 2);
+	.loc 1 393 73 discriminator 6 view .LVU402
+	testq	%rdi, %rdi	# exc.26_29
+	je	.L49	#,
+	.loc 1 393 12 is_stmt 1 discriminator 1 view .LVU403
+# Lib/munit_test/test_memory.c:393:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 2);
+	.loc 1 393 16 is_stmt 0 discriminator 1 view .LVU404
+	call	yp_isexceptionC@PLT	#
+.LVL141:
+# Lib/munit_test/test_memory.c:393:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 2);
+	.loc 1 393 15 discriminator 1 view .LVU405
+	testl	%eax, %eax	# tmp398
+	je	.L50	#,
+	.loc 1 393 40 is_stmt 1 discriminator 3 view .LVU406
+	leaq	.LC35(%rip), %r8	#,
+	leaq	.LC5(%rip), %rcx	#, tmp281
+	leaq	.LC17(%rip), %rdx	#, tmp282
+	movl	$393, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp283
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL142:
+.L81:
+	.loc 1 393 40 is_stmt 0 discriminator 3 view .LVU407
+.LBE59:
+.LBE58:
+.LBB61:
+	.loc 1 392 393 is_stmt 1 discriminator 5 view .LVU408
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC16(%rip), %rcx	#, tmp277
+	leaq	.LC19(%rip), %rdx	#, tmp278
+	movl	$392, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp279
+	movl	$0, %eax	#,
+.LVL143:
+	.loc 1 392 393 is_stmt 0 discriminator 5 view .LVU409
+	call	munit_errorf_ex@PLT	#
+.LVL144:
+.L50:
+	.loc 1 392 393 discriminator 5 view .LVU410
+.LBE61:
+.LBB62:
+.LBB60:
+	.loc 1 393 195 is_stmt 1 discriminator 4 view .LVU411
+	leaq	.LC35(%rip), %r8	#,
+	leaq	.LC5(%rip), %rcx	#, tmp284
+	leaq	.LC18(%rip), %rdx	#, tmp285
+	movl	$393, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp286
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL145:
+.L49:
+	.loc 1 393 195 is_stmt 0 discriminator 4 view .LVU412
+.LBE60:
+	.loc 1 393 69 is_stmt 1 discriminator 2 view .LVU413
+	.loc 1 393 347 discriminator 2 view .LVU414
+	.loc 1 393 352 discriminator 2 view .LVU415
+# Lib/munit_test/test_memory.c:393:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 2);
+	.loc 1 393 355 is_stmt 0 discriminator 2 view .LVU416
+	cmpq	$2, %rax	#, _ypmt_TYPEC_a
+	jne	.L82	#,
+	.loc 1 393 350 is_stmt 1 discriminator 6 view .LVU417
+.LBE62:
+	.loc 1 393 12 discriminator 6 view .LVU418
+.LBE65:
+	.loc 1 397 5 discriminator 6 view .LVU419
+	call	yp_collect_disable@PLT	#
+.LVL146:
+.LBB66:
+	.loc 1 399 9 discriminator 6 view .LVU420
+# Lib/munit_test/test_memory.c:399:         ypObject *list = yp_listN(0);
+	.loc 1 399 26 is_stmt 0 discriminator 6 view .LVU421
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_listN@PLT	#
+.LVL147:
+	movq	%rax, %rbx	# tmp399, list
+.LVL148:
+	.loc 1 400 9 is_stmt 1 discriminator 6 view .LVU422
+.LBB67:
+	.loc 1 400 14 discriminator 6 view .LVU423
+# Lib/munit_test/test_memory.c:400:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 400 24 is_stmt 0 discriminator 6 view .LVU424
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 400 10 is_stmt 1 discriminator 6 view .LVU425
+# Lib/munit_test/test_memory.c:400:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 400 11 is_stmt 0 discriminator 6 view .LVU426
+	leaq	-216(%rbp), %rdx	#, tmp290
+	movq	%rax, %rsi	# list,
+	movq	%rax, %rdi	# list,
+	call	yp_append@PLT	#
+.LVL149:
+	.loc 1 400 41 is_stmt 1 discriminator 6 view .LVU427
+# Lib/munit_test/test_memory.c:400:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 400 49 is_stmt 0 discriminator 6 view .LVU428
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.28_31
+# Lib/munit_test/test_memory.c:400:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 400 44 discriminator 6 view .LVU429
+	testq	%rdi, %rdi	# exc.28_31
+	je	.L52	#,
+	.loc 1 400 12 is_stmt 1 discriminator 1 view .LVU430
+# Lib/munit_test/test_memory.c:400:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 400 16 is_stmt 0 discriminator 1 view .LVU431
+	call	yp_isexceptionC@PLT	#
+.LVL150:
+# Lib/munit_test/test_memory.c:400:         assert_not_raises_exc(yp_append(list, list, &exc));
+	.loc 1 400 15 discriminator 1 view .LVU432
+	testl	%eax, %eax	# tmp400
+	je	.L53	#,
+	.loc 1 400 40 is_stmt 1 discriminator 2 view .LVU433
+	leaq	.LC0(%rip), %rcx	#, tmp291
+	leaq	.LC1(%rip), %rdx	#, tmp292
+	movl	$400, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp293
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL151:
+.L82:
+	.loc 1 400 40 is_stmt 0 discriminator 2 view .LVU434
+.LBE67:
+.LBE66:
+.LBB74:
+.LBB63:
+	.loc 1 393 393 is_stmt 1 discriminator 5 view .LVU435
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	leaq	.LC35(%rip), %r8	#,
+	leaq	.LC5(%rip), %rcx	#, tmp287
+	leaq	.LC19(%rip), %rdx	#, tmp288
+	movl	$393, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp289
+	movl	$0, %eax	#,
+.LVL152:
+	.loc 1 393 393 is_stmt 0 discriminator 5 view .LVU436
+	call	munit_errorf_ex@PLT	#
+.LVL153:
+.L53:
+	.loc 1 393 393 discriminator 5 view .LVU437
+.LBE63:
+.LBE74:
+.LBB75:
+.LBB68:
+	.loc 1 400 180 is_stmt 1 discriminator 3 view .LVU438
+	leaq	.LC0(%rip), %rcx	#, tmp294
+	leaq	.LC3(%rip), %rdx	#, tmp295
+	movl	$400, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp296
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL154:
+.L52:
+.LBE68:
+	.loc 1 400 12 view .LVU439
+	.loc 1 401 9 view .LVU440
+.LBB69:
+	.loc 1 401 14 view .LVU441
+	.loc 1 401 40 view .LVU442
+	.loc 1 401 66 view .LVU443
+.LBB70:
+	.loc 1 401 71 view .LVU444
+# Lib/munit_test/test_memory.c:401:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 0);
+	.loc 1 401 81 is_stmt 0 view .LVU445
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 401 10 is_stmt 1 view .LVU446
+# Lib/munit_test/test_memory.c:401:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 0);
+	.loc 1 401 27 is_stmt 0 view .LVU447
+	leaq	-216(%rbp), %rsi	#, tmp297
+	movl	$2, %edi	#,
+	call	yp_collect@PLT	#
+.LVL155:
+	movq	%rax, %r9	# tmp401, _ypmt_TYPEC_a
+.LVL156:
+	.loc 1 401 49 is_stmt 1 view .LVU448
+	.loc 1 401 70 view .LVU449
+# Lib/munit_test/test_memory.c:401:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 0);
+	.loc 1 401 78 is_stmt 0 view .LVU450
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.30_33
+# Lib/munit_test/test_memory.c:401:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 0);
+	.loc 1 401 73 view .LVU451
+	testq	%rdi, %rdi	# exc.30_33
+	je	.L54	#,
+	.loc 1 401 12 is_stmt 1 discriminator 1 view .LVU452
+# Lib/munit_test/test_memory.c:401:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 0);
+	.loc 1 401 16 is_stmt 0 discriminator 1 view .LVU453
+	call	yp_isexceptionC@PLT	#
+.LVL157:
+# Lib/munit_test/test_memory.c:401:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 0);
+	.loc 1 401 15 discriminator 1 view .LVU454
+	testl	%eax, %eax	# tmp402
+	je	.L55	#,
+	.loc 1 401 40 is_stmt 1 discriminator 3 view .LVU455
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC5(%rip), %rcx	#, tmp298
+	leaq	.LC17(%rip), %rdx	#, tmp299
+	movl	$401, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp300
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL158:
+.L55:
+	.loc 1 401 195 discriminator 4 view .LVU456
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC5(%rip), %rcx	#, tmp301
+	leaq	.LC18(%rip), %rdx	#, tmp302
+	movl	$401, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp303
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL159:
+.L54:
+	.loc 1 401 195 is_stmt 0 discriminator 4 view .LVU457
+.LBE70:
+	.loc 1 401 69 is_stmt 1 discriminator 2 view .LVU458
+	.loc 1 401 347 discriminator 2 view .LVU459
+	.loc 1 401 352 discriminator 2 view .LVU460
+# Lib/munit_test/test_memory.c:401:         assert_ssizeC_exc(yp_collect(2, &exc), ==, 0);
+	.loc 1 401 355 is_stmt 0 discriminator 2 view .LVU461
+	testq	%rax, %rax	# _ypmt_TYPEC_a
+	jne	.L83	#,
+	.loc 1 401 350 is_stmt 1 discriminator 6 view .LVU462
+.LBE69:
+	.loc 1 401 12 discriminator 6 view .LVU463
+	.loc 1 402 9 discriminator 6 view .LVU464
+.LBB71:
+	.loc 1 402 14 discriminator 6 view .LVU465
+# Lib/munit_test/test_memory.c:402:         assert_not_raises_exc(yp_clear(list, &exc));
+	.loc 1 402 24 is_stmt 0 discriminator 6 view .LVU466
+	movq	$0, -216(%rbp)	#, MEM[(struct ypObject * *)_240]
+	.loc 1 402 10 is_stmt 1 discriminator 6 view .LVU467
+# Lib/munit_test/test_memory.c:402:         assert_not_raises_exc(yp_clear(list, &exc));
+	.loc 1 402 11 is_stmt 0 discriminator 6 view .LVU468
+	leaq	-216(%rbp), %rsi	#, tmp307
+	movq	%rbx, %rdi	# list,
+	call	yp_clear@PLT	#
+.LVL160:
+	.loc 1 402 34 is_stmt 1 discriminator 6 view .LVU469
+# Lib/munit_test/test_memory.c:402:         assert_not_raises_exc(yp_clear(list, &exc));
+	.loc 1 402 42 is_stmt 0 discriminator 6 view .LVU470
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240], exc.32_35
+# Lib/munit_test/test_memory.c:402:         assert_not_raises_exc(yp_clear(list, &exc));
+	.loc 1 402 37 discriminator 6 view .LVU471
+	testq	%rdi, %rdi	# exc.32_35
+	je	.L57	#,
+	.loc 1 402 12 is_stmt 1 discriminator 1 view .LVU472
+# Lib/munit_test/test_memory.c:402:         assert_not_raises_exc(yp_clear(list, &exc));
+	.loc 1 402 16 is_stmt 0 discriminator 1 view .LVU473
+	call	yp_isexceptionC@PLT	#
+.LVL161:
+# Lib/munit_test/test_memory.c:402:         assert_not_raises_exc(yp_clear(list, &exc));
+	.loc 1 402 15 discriminator 1 view .LVU474
+	testl	%eax, %eax	# tmp403
+	je	.L58	#,
+	.loc 1 402 40 is_stmt 1 discriminator 2 view .LVU475
+	leaq	.LC37(%rip), %rcx	#, tmp308
+	leaq	.LC1(%rip), %rdx	#, tmp309
+	movl	$402, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp310
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL162:
+.L83:
+	.loc 1 402 40 is_stmt 0 discriminator 2 view .LVU476
+.LBE71:
+.LBB72:
+	.loc 1 401 393 is_stmt 1 discriminator 5 view .LVU477
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC5(%rip), %rcx	#, tmp304
+	leaq	.LC19(%rip), %rdx	#, tmp305
+	movl	$401, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp306
+	movl	$0, %eax	#,
+.LVL163:
+	.loc 1 401 393 is_stmt 0 discriminator 5 view .LVU478
+	call	munit_errorf_ex@PLT	#
+.LVL164:
+.L58:
+	.loc 1 401 393 discriminator 5 view .LVU479
+.LBE72:
+.LBB73:
+	.loc 1 402 173 is_stmt 1 discriminator 3 view .LVU480
+	leaq	.LC37(%rip), %rcx	#, tmp311
+	leaq	.LC3(%rip), %rdx	#, tmp312
+	movl	$402, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp313
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL165:
+.L57:
+.LBE73:
+	.loc 1 402 12 view .LVU481
+	.loc 1 403 9 view .LVU482
+	movq	%rbx, %rdi	# list,
+	call	yp_decref@PLT	#
+.LVL166:
+.LBE75:
+	.loc 1 406 5 view .LVU483
+	leaq	-208(%rbp), %rdi	#, tmp314
+	call	yp_collect_stats@PLT	#
+.LVL167:
+	.loc 1 407 5 view .LVU484
+.LBB76:
+	.loc 1 407 10 view .LVU485
+# Lib/munit_test/test_memory.c:407:     assert_ssizeC(after.collections[0] - before.collections[0], ==, 4);
+	.loc 1 407 21 is_stmt 0 view .LVU486
+	movq	-128(%rbp), %rsi	# before.collections[0],
+	movq	-208(%rbp), %rdi	# after.collections[0],
+	call	__subvdi3@PLT	#
+.LVL168:
+	.loc 1 407 84 is_stmt 1 view .LVU487
+	.loc 1 407 115 view .LVU488
+# Lib/munit_test/test_memory.c:407:     assert_ssizeC(after.collections[0] - before.collections[0], ==, 4);
+	.loc 1 407 118 is_stmt 0 view .LVU489
+	cmpq	$4, %rax	#, munit_tmp_a_
+	jne	.L84	#,
+.LBE76:
+	.loc 1 407 8 is_stmt 1 discriminator 2 view .LVU490
+	.loc 1 408 5 discriminator 2 view .LVU491
+.LBB77:
+	.loc 1 408 10 discriminator 2 view .LVU492
+# Lib/munit_test/test_memory.c:408:     assert_ssizeC(after.collections[2] - before.collections[2], ==, 2);
+	.loc 1 408 21 is_stmt 0 discriminator 2 view .LVU493
+	movq	-112(%rbp), %rsi	# before.collections[2],
+	movq	-192(%rbp), %rdi	# after.collections[2],
+	call	__subvdi3@PLT	#
+.LVL169:
+	.loc 1 408 84 is_stmt 1 discriminator 2 view .LVU494
+	.loc 1 408 115 discriminator 2 view .LVU495
+# Lib/munit_test/test_memory.c:408:     assert_ssizeC(after.collections[2] - before.collections[2], ==, 2);
+	.loc 1 408 118 is_stmt 0 discriminator 2 view .LVU496
+	cmpq	$2, %rax	#, munit_tmp_a_
+	jne	.L85	#,
+.LBE77:
+	.loc 1 408 8 is_stmt 1 discriminator 2 view .LVU497
+	.loc 1 409 5 discriminator 2 view .LVU498
+.LBB78:
+	.loc 1 409 10 discriminator 2 view .LVU499
+# Lib/munit_test/test_memory.c:409:     assert_ssizeC(after.collected[0] - before.collected[0], ==, 4);
+	.loc 1 409 21 is_stmt 0 discriminator 2 view .LVU500
+	movq	-104(%rbp), %rsi	# before.collected[0],
+	movq	-184(%rbp), %rdi	# after.collected[0],
+	call	__subvdi3@PLT	#
+.LVL170:
+	.loc 1 409 80 is_stmt 1 discriminator 2 view .LVU501
+	.loc 1 409 111 discriminator 2 view .LVU502
+# Lib/munit_test/test_memory.c:409:     assert_ssizeC(after.collected[0] - before.collected[0], ==, 4);
+	.loc 1 409 114 is_stmt 0 discriminator 2 view .LVU503
+	cmpq	$4, %rax	#, munit_tmp_a_
+	jne	.L86	#,
+.LBE78:
+	.loc 1 409 8 is_stmt 1 discriminator 2 view .LVU504
+	.loc 1 410 5 discriminator 2 view .LVU505
+.LBB79:
+	.loc 1 410 10 discriminator 2 view .LVU506
+# Lib/munit_test/test_memory.c:410:     assert_ssizeC(after.collected[2] - before.collected[2], ==, 2);
+	.loc 1 410 21 is_stmt 0 discriminator 2 view .LVU507
+	movq	-88(%rbp), %rsi	# before.collected[2],
+	movq	-168(%rbp), %rdi	# after.collected[2],
+	call	__subvdi3@PLT	#
+.LVL171:
+	.loc 1 410 80 is_stmt 1 discriminator 2 view .LVU508
+	.loc 1 410 111 discriminator 2 view .LVU509
+# Lib/munit_test/test_memory.c:410:     assert_ssizeC(after.collected[2] - before.collected[2], ==, 2);
+	.loc 1 410 114 is_stmt 0 discriminator 2 view .LVU510
+	cmpq	$2, %rax	#, munit_tmp_a_
+	jne	.L87	#,
+.LBE79:
+	.loc 1 410 8 is_stmt 1 discriminator 2 view .LVU511
+	.loc 1 411 5 discriminator 2 view .LVU512
+.LBB80:
+	.loc 1 411 10 discriminator 2 view .LVU513
+# Lib/munit_test/test_memory.c:411:     assert_ssizeC(after.tracked[0] + after.tracked[1] + after.tracked[2], ==, 0);
+	.loc 1 411 54 is_stmt 0 discriminator 2 view .LVU514
+	movq	-152(%rbp), %rsi	# after.tracked[1],
+	movq	-160(%rbp), %rdi	# after.tracked[0],
+	call	__addvdi3@PLT	#
+.LVL172:
+	.loc 1 411 54 discriminator 2 view .LVU515
+	movq	%rax, %rdi	# tmp408, tmp335
+# Lib/munit_test/test_memory.c:411:     assert_ssizeC(after.tracked[0] + after.tracked[1] + after.tracked[2], ==, 0);
+	.loc 1 411 21 discriminator 2 view .LVU516
+	movq	-144(%rbp), %rsi	# after.tracked[2],
+	call	__addvdi3@PLT	#
+.LVL173:
+	.loc 1 411 94 is_stmt 1 discriminator 2 view .LVU517
+	.loc 1 411 125 discriminator 2 view .LVU518
+# Lib/munit_test/test_memory.c:411:     assert_ssizeC(after.tracked[0] + after.tracked[1] + after.tracked[2], ==, 0);
+	.loc 1 411 128 is_stmt 0 discriminator 2 view .LVU519
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L88	#,
+.LBE80:
+	.loc 1 411 8 is_stmt 1 discriminator 2 view .LVU520
+	.loc 1 414 5 discriminator 2 view .LVU521
+.LBB81:
+	.loc 1 414 10 discriminator 2 view .LVU522
+# Lib/munit_test/test_memory.c:414:     assert_ssizeC_raises_exc(yp_collect(-1, &exc), ==, -1, yp_ValueError);
+	.loc 1 414 20 is_stmt 0 discriminator 2 view .LVU523
+	movq	yp_ValueError(%rip), %r12	# yp_ValueError, yp_ValueError.34_49
+.LVL174:
+	.loc 1 414 20 discriminator 2 view .LVU524
+	movq	%r12, -224(%rbp)	# yp_ValueError.34_49, MEM[(struct ypObject *[1] *)_239][0]
+	.loc 1 414 58 is_stmt 1 discriminator 2 view .LVU525
+.LVL175:
+	.loc 1 414 173 discriminator 2 view .LVU526
+	.loc 1 414 199 discriminator 2 view .LVU527
+	.loc 1 414 225 discriminator 2 view .LVU528
+.LBB82:
+	.loc 1 414 230 discriminator 2 view .LVU529
+# Lib/munit_test/test_memory.c:414:     assert_ssizeC_raises_exc(yp_collect(-1, &exc), ==, -1, yp_ValueError);
+	.loc 1 414 240 is_stmt 0 discriminator 2 view .LVU530
+	movq	yp_None(%rip), %rax	# yp_None, tmp418
+.LVL176:
+	.loc 1 414 240 discriminator 2 view .LVU531
+	movq	%rax, -216(%rbp)	# tmp418, MEM[(struct ypObject * *)_240]
+	.loc 1 414 255 is_stmt 1 discriminator 2 view .LVU532
+	.loc 1 414 385 discriminator 2 view .LVU533
+# Lib/munit_test/test_memory.c:414:     assert_ssizeC_raises_exc(yp_collect(-1, &exc), ==, -1, yp_ValueError);
+	.loc 1 414 402 is_stmt 0 discriminator 2 view .LVU534
+	leaq	-216(%rbp), %rsi	#, tmp341
+	movl	$-1, %edi	#,
+	call	yp_collect@PLT	#
+.LVL177:
+	movq	%rax, %rbx	# tmp410, _ypmt_TYPEC_a
+.LVL178:
+	.loc 1 414 425 is_stmt 1 discriminator 2 view .LVU535
+# Lib/munit_test/test_memory.c:414:     assert_ssizeC_raises_exc(yp_collect(-1, &exc), ==, -1, yp_ValueError);
+	.loc 1 414 430 is_stmt 0 discriminator 2 view .LVU536
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240],
+	call	yp_isexceptionC@PLT	#
+.LVL179:
+# Lib/munit_test/test_memory.c:414:     assert_ssizeC_raises_exc(yp_collect(-1, &exc), ==, -1, yp_ValueError);
+	.loc 1 414 428 discriminator 2 view .LVU537
+	testl	%eax, %eax	# tmp411
+	je	.L89	#,
+	.loc 1 414 623 is_stmt 1 discriminator 4 view .LVU538
+# Lib/munit_test/test_memory.c:414:     assert_ssizeC_raises_exc(yp_collect(-1, &exc), ==, -1, yp_ValueError);
+	.loc 1 414 628 is_stmt 0 discriminator 4 view .LVU539
+	leaq	-224(%rbp), %rdx	#, tmp346
+	movl	$1, %esi	#,
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240],
+	call	yp_isexception_arrayC@PLT	#
+.LVL180:
+# Lib/munit_test/test_memory.c:414:     assert_ssizeC_raises_exc(yp_collect(-1, &exc), ==, -1, yp_ValueError);
+	.loc 1 414 626 discriminator 4 view .LVU540
+	testl	%eax, %eax	# tmp412
+	je	.L90	#,
+.LBE82:
+	.loc 1 414 228 is_stmt 1 discriminator 6 view .LVU541
+	.loc 1 414 867 discriminator 6 view .LVU542
+.LBE81:
+	.loc 1 414 872 discriminator 6 view .LVU543
+.LVL181:
+	.loc 1 414 6 discriminator 6 view .LVU544
+	.loc 1 414 28 discriminator 6 view .LVU545
+.LBB84:
+	.loc 1 414 870 discriminator 6 view .LVU546
+	.loc 1 414 263 discriminator 6 view .LVU547
+	.loc 1 414 268 discriminator 6 view .LVU548
+# Lib/munit_test/test_memory.c:414:     assert_ssizeC_raises_exc(yp_collect(-1, &exc), ==, -1, yp_ValueError);
+	.loc 1 414 271 is_stmt 0 discriminator 6 view .LVU549
+	cmpq	$-1, %rbx	#, _ypmt_TYPEC_a
+	jne	.L91	#,
+	.loc 1 414 266 is_stmt 1 discriminator 12 view .LVU550
+.LBE84:
+	.loc 1 414 8 discriminator 12 view .LVU551
+	.loc 1 415 5 discriminator 12 view .LVU552
+.LBB85:
+	.loc 1 415 10 discriminator 12 view .LVU553
+# Lib/munit_test/test_memory.c:415:     assert_ssizeC_raises_exc(yp_collect(3, &exc), ==, -1, yp_ValueError);
+	.loc 1 415 20 is_stmt 0 discriminator 12 view .LVU554
+	movq	%r12, -224(%rbp)	# yp_ValueError.34_49, MEM[(struct ypObject *[1] *)_239][0]
+	.loc 1 415 58 is_stmt 1 discriminator 12 view .LVU555
+.LVL182:
+	.loc 1 415 173 discriminator 12 view .LVU556
+	.loc 1 415 199 discriminator 12 view .LVU557
+	.loc 1 415 225 discriminator 12 view .LVU558
+.LBB86:
+	.loc 1 415 230 discriminator 12 view .LVU559
+# Lib/munit_test/test_memory.c:415:     assert_ssizeC_raises_exc(yp_collect(3, &exc), ==, -1, yp_ValueError);
+	.loc 1 415 240 is_stmt 0 discriminator 12 view .LVU560
+	movq	yp_None(%rip), %rax	# yp_None, tmp419
+	movq	%rax, -216(%rbp)	# tmp419, MEM[(struct ypObject * *)_240]
+	.loc 1 415 255 is_stmt 1 discriminator 12 view .LVU561
+	.loc 1 415 385 discriminator 12 view .LVU562
+# Lib/munit_test/test_memory.c:415:     assert_ssizeC_raises_exc(yp_collect(3, &exc), ==, -1, yp_ValueError);
+	.loc 1 415 402 is_stmt 0 discriminator 12 view .LVU563
+	leaq	-216(%rbp), %rsi	#, tmp355
+	movl	$3, %edi	#,
+	call	yp_collect@PLT	#
+.LVL183:
+	movq	%rax, %rbx	# tmp413, _ypmt_TYPEC_a
+.LVL184:
+	.loc 1 415 424 is_stmt 1 discriminator 12 view .LVU564
+# Lib/munit_test/test_memory.c:415:     assert_ssizeC_raises_exc(yp_collect(3, &exc), ==, -1, yp_ValueError);
+	.loc 1 415 429 is_stmt 0 discriminator 12 view .LVU565
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240],
+	call	yp_isexceptionC@PLT	#
+.LVL185:
+# Lib/munit_test/test_memory.c:415:     assert_ssizeC_raises_exc(yp_collect(3, &exc), ==, -1, yp_ValueError);
+	.loc 1 415 427 discriminator 12 view .LVU566
+	testl	%eax, %eax	# tmp414
+	je	.L92	#,
+	.loc 1 415 621 is_stmt 1 discriminator 4 view .LVU567
+# Lib/munit_test/test_memory.c:415:     assert_ssizeC_raises_exc(yp_collect(3, &exc), ==, -1, yp_ValueError);
+	.loc 1 415 626 is_stmt 0 discriminator 4 view .LVU568
+	leaq	-224(%rbp), %rdx	#, tmp360
+	movl	$1, %esi	#,
+	movq	-216(%rbp), %rdi	# MEM[(struct ypObject * *)_240],
+	call	yp_isexception_arrayC@PLT	#
+.LVL186:
+# Lib/munit_test/test_memory.c:415:     assert_ssizeC_raises_exc(yp_collect(3, &exc), ==, -1, yp_ValueError);
+	.loc 1 415 624 discriminator 4 view .LVU569
+	testl	%eax, %eax	# tmp415
+	je	.L93	#,
+.LBE86:
+	.loc 1 415 228 is_stmt 1 discriminator 6 view .LVU570
+	.loc 1 415 864 discriminator 6 view .LVU571
+.LBE85:
+	.loc 1 415 869 discriminator 6 view .LVU572
+.LVL187:
+	.loc 1 415 6 discriminator 6 view .LVU573
+	.loc 1 415 28 discriminator 6 view .LVU574
+.LBB88:
+	.loc 1 415 867 discriminator 6 view .LVU575
+	.loc 1 415 263 discriminator 6 view .LVU576
+	.loc 1 415 268 discriminator 6 view .LVU577
+# Lib/munit_test/test_memory.c:415:     assert_ssizeC_raises_exc(yp_collect(3, &exc), ==, -1, yp_ValueError);
+	.loc 1 415 271 is_stmt 0 discriminator 6 view .LVU578
+	cmpq	$-1, %rbx	#, _ypmt_TYPEC_a
+	jne	.L94	#,
+	.loc 1 415 266 is_stmt 1 discriminator 12 view .LVU579
+.LBE88:
+	.loc 1 415 8 discriminator 12 view .LVU580
+	.loc 1 417 5 discriminator 12 view .LVU581
+# Lib/munit_test/test_memory.c:418: }
+	.loc 1 418 1 is_stmt 0 discriminator 12 view .LVU582
+	movl	$0, %eax	#,
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+.LVL188:
+	.loc 1 418 1 discriminator 12 view .LVU583
+	popq	%r12	#
+	popq	%r13	#
+.LVL189:
+	.loc 1 418 1 discriminator 12 view .LVU584
+	popq	%r14	#
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL190:
+.L84:
+	.cfi_restore_state
+.LBB89:
+	.loc 1 407 154 is_stmt 1 discriminator 1 view .LVU585
+	subq	$8, %rsp	#,
+	pushq	$4	#
+	leaq	.LC13(%rip), %r8	#, tmp316
+	pushq	%r8	# tmp316
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC38(%rip), %r9	#,
+	leaq	.LC10(%rip), %rcx	#, tmp317
+	leaq	.LC11(%rip), %rdx	#, tmp318
+	movl	$407, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp319
+	movl	$0, %eax	#,
+.LVL191:
+	.loc 1 407 154 is_stmt 0 discriminator 1 view .LVU586
+	call	munit_errorf_ex@PLT	#
+.LVL192:
+.L85:
+	.loc 1 407 154 discriminator 1 view .LVU587
+.LBE89:
+.LBB90:
+	.loc 1 408 154 is_stmt 1 discriminator 1 view .LVU588
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	leaq	.LC13(%rip), %r8	#, tmp321
+	pushq	%r8	# tmp321
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC35(%rip), %r9	#,
+	leaq	.LC39(%rip), %rcx	#, tmp322
+	leaq	.LC11(%rip), %rdx	#, tmp323
+	movl	$408, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp324
+	movl	$0, %eax	#,
+.LVL193:
+	.loc 1 408 154 is_stmt 0 discriminator 1 view .LVU589
+	call	munit_errorf_ex@PLT	#
+.LVL194:
+.L86:
+	.loc 1 408 154 discriminator 1 view .LVU590
+.LBE90:
+.LBB91:
+	.loc 1 409 150 is_stmt 1 discriminator 1 view .LVU591
+	subq	$8, %rsp	#,
+	pushq	$4	#
+	leaq	.LC13(%rip), %r8	#, tmp326
+	pushq	%r8	# tmp326
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC38(%rip), %r9	#,
+	leaq	.LC40(%rip), %rcx	#, tmp327
+	leaq	.LC11(%rip), %rdx	#, tmp328
+	movl	$409, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp329
+	movl	$0, %eax	#,
+.LVL195:
+	.loc 1 409 150 is_stmt 0 discriminator 1 view .LVU592
+	call	munit_errorf_ex@PLT	#
+.LVL196:
+.L87:
+	.loc 1 409 150 discriminator 1 view .LVU593
+.LBE91:
+.LBB92:
+	.loc 1 410 150 is_stmt 1 discriminator 1 view .LVU594
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	leaq	.LC13(%rip), %r8	#, tmp331
+	pushq	%r8	# tmp331
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC35(%rip), %r9	#,
+	leaq	.LC41(%rip), %rcx	#, tmp332
+	leaq	.LC11(%rip), %rdx	#, tmp333
+	movl	$410, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp334
+	movl	$0, %eax	#,
+.LVL197:
+	.loc 1 410 150 is_stmt 0 discriminator 1 view .LVU595
+	call	munit_errorf_ex@PLT	#
+.LVL198:
+.L88:
+	.loc 1 410 150 discriminator 1 view .LVU596
+.LBE92:
+.LBB93:
+	.loc 1 411 164 is_stmt 1 discriminator 1 view .LVU597
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp337
+	pushq	%r8	# tmp337
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC42(%rip), %rcx	#, tmp338
+	leaq	.LC11(%rip), %rdx	#, tmp339
+	movl	$411, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp340
+	movl	$0, %eax	#,
+.LVL199:
+	.loc 1 411 164 is_stmt 0 discriminator 1 view .LVU598
+	call	munit_errorf_ex@PLT	#
+.LVL200:
+.L89:
+	.loc 1 411 164 discriminator 1 view .LVU599
+.LBE93:
+.LBB94:
+.LBB83:
+	.loc 1 414 454 is_stmt 1 discriminator 3 view .LVU600
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC44(%rip), %rcx	#, tmp343
+	leaq	.LC45(%rip), %rdx	#, tmp344
+	movl	$414, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp345
+	call	munit_errorf_ex@PLT	#
+.LVL201:
+.L90:
+	.loc 1 414 691 discriminator 5 view .LVU601
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC44(%rip), %rcx	#, tmp348
+	leaq	.LC46(%rip), %rdx	#, tmp349
+	movl	$414, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp350
+	call	munit_errorf_ex@PLT	#
+.LVL202:
+.L91:
+	.loc 1 414 691 is_stmt 0 discriminator 5 view .LVU602
+.LBE83:
+	.loc 1 414 309 is_stmt 1 discriminator 11 view .LVU603
+	subq	$8, %rsp	#,
+	pushq	$-1	#
+	movq	%rbx, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC47(%rip), %r8	#,
+	leaq	.LC44(%rip), %rcx	#, tmp352
+	leaq	.LC19(%rip), %rdx	#, tmp353
+	movl	$414, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp354
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL203:
+.L92:
+	.loc 1 414 309 is_stmt 0 discriminator 11 view .LVU604
+.LBE94:
+.LBB95:
+.LBB87:
+	.loc 1 415 453 is_stmt 1 discriminator 3 view .LVU605
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC48(%rip), %rcx	#, tmp357
+	leaq	.LC45(%rip), %rdx	#, tmp358
+	movl	$415, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp359
+	call	munit_errorf_ex@PLT	#
+.LVL204:
+.L93:
+	.loc 1 415 689 discriminator 5 view .LVU606
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC48(%rip), %rcx	#, tmp362
+	leaq	.LC46(%rip), %rdx	#, tmp363
+	movl	$415, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp364
+	call	munit_errorf_ex@PLT	#
+.LVL205:
+.L94:
+	.loc 1 415 689 is_stmt 0 discriminator 5 view .LVU607
+.LBE87:
+	.loc 1 415 309 is_stmt 1 discriminator 11 view .LVU608
+	subq	$8, %rsp	#,
+	pushq	$-1	#
+	movq	%rbx, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC47(%rip), %r8	#,
+	leaq	.LC48(%rip), %rcx	#, tmp366
+	leaq	.LC19(%rip), %rdx	#, tmp367
+	movl	$415, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp368
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL206:
+.LBE95:
+	.cfi_endproc
+.LFE38:
+	.size	test_collect, .-test_collect
+	.section	.rodata.str1.8
+	.align 8
+.LC49:
+	.string	"pthread_create(&thread, ((void *)0), _test_arena_thread_exit_list, &first)"
+	.align 8
+.LC50:
+	.string	"assertion failed: %s %s %s (%lld %s %lld)"
+	.align 8
+.LC51:
+	.string	"pthread_join(thread, ((void *)0))"
+	.align 8
+.LC52:
+	.string	"pthread_create(&thread, ((void *)0), _test_arena_thread_exit_list, &second)"
+	.section	.rodata.str1.1
+.LC53:
+	.string	"((void *)0)"
+.LC54:
+	.string	"!="
+.LC55:
+	.string	"first"
+	.section	.rodata.str1.8
+	.align 8
+.LC56:
+	.string	"assertion failed: %s %s %s (%p %s %p)"
+	.section	.rodata.str1.1
+.LC57:
+	.string	"second"
+	.text
+	.type	test_arena_thread_exit, @function
+test_arena_thread_exit:
+.LVL207:
+.LFB37:
+	.loc 1 334 1 view -0
+	.cfi_startproc
+	.loc 1 334 1 is_stmt 0 view .LVU610
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp	#,
+	.loc 1 335 5 is_stmt 1 view .LVU611
+	.loc 1 336 5 view .LVU612
+# Lib/munit_test/test_memory.c:336:     void     *first = NULL;
+	.loc 1 336 11 is_stmt 0 view .LVU613
+	movq	$0, -16(%rbp)	#, first
+	.loc 1 337 5 is_stmt 1 view .LVU614
+# Lib/munit_test/test_memory.c:337:     void     *second = NULL;
+	.loc 1 337 11 is_stmt 0 view .LVU615
+	movq	$0, -24(%rbp)	#, second
+	.loc 1 339 5 is_stmt 1 view .LVU616
+.LBB96:
+	.loc 1 339 10 view .LVU617
+# Lib/munit_test/test_memory.c:339:     assert_intC(pthread_create(&thread, NULL, _test_arena_thread_exit_list, &first), ==, 0);
+	.loc 1 339 35 is_stmt 0 view .LVU618
+	leaq	-16(%rbp), %rcx	#, tmp97
+	leaq	-8(%rbp), %rdi	#, tmp98
+.LVL208:
+	.loc 1 339 35 view .LVU619
+	leaq	_test_arena_thread_exit_list(%rip), %rdx	#, tmp99
+	movl	$0, %esi	#,
+.LVL209:
+	.loc 1 339 35 view .LVU620
+	call	pthread_create@PLT	#
+.LVL210:
+# Lib/munit_test/test_memory.c:339:     assert_intC(pthread_create(&thread, NULL, _test_arena_thread_exit_list, &first), ==, 0);
+	.loc 1 339 19 view .LVU621
+	cltq
+.LVL211:
+	.loc 1 339 46 is_stmt 1 view .LVU622
+	.loc 1 339 75 view .LVU623
+# Lib/munit_test/test_memory.c:339:     assert_intC(pthread_create(&thread, NULL, _test_arena_thread_exit_list, &first), ==, 0);
+	.loc 1 339 78 is_stmt 0 view .LVU624
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L103	#,
+.LBE96:
+	.loc 1 339 8 is_stmt 1 discriminator 2 view .LVU625
+	.loc 1 340 5 discriminator 2 view .LVU626
+.LBB97:
+	.loc 1 340 10 discriminator 2 view .LVU627
+# Lib/munit_test/test_memory.c:340:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 340 35 is_stmt 0 discriminator 2 view .LVU628
+	movl	$0, %esi	#,
+	movq	-8(%rbp), %rdi	# thread,
+	call	pthread_join@PLT	#
+.LVL212:
+# Lib/munit_test/test_memory.c:340:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 340 19 discriminator 2 view .LVU629
+	cltq
+.LVL213:
+	.loc 1 340 8 is_stmt 1 discriminator 2 view .LVU630
+	.loc 1 340 37 discriminator 2 view .LVU631
+# Lib/munit_test/test_memory.c:340:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 340 40 is_stmt 0 discriminator 2 view .LVU632
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L104	#,
+.LBE97:
+	.loc 1 340 8 is_stmt 1 discriminator 2 view .LVU633
+	.loc 1 341 5 discriminator 2 view .LVU634
+.LBB98:
+	.loc 1 341 10 discriminator 2 view .LVU635
+# Lib/munit_test/test_memory.c:341:     assert_intC(pthread_create(&thread, NULL, _test_arena_thread_exit_list, &second), ==, 0);
+	.loc 1 341 35 is_stmt 0 discriminator 2 view .LVU636
+	leaq	-24(%rbp), %rcx	#, tmp109
+	leaq	-8(%rbp), %rdi	#, tmp110
+	leaq	_test_arena_thread_exit_list(%rip), %rdx	#, tmp111
+	movl	$0, %esi	#,
+	call	pthread_create@PLT	#
+.LVL214:
+# Lib/munit_test/test_memory.c:341:     assert_intC(pthread_create(&thread, NULL, _test_arena_thread_exit_list, &second), ==, 0);
+	.loc 1 341 19 discriminator 2 view .LVU637
+	cltq
+.LVL215:
+	.loc 1 341 47 is_stmt 1 discriminator 2 view .LVU638
+	.loc 1 341 76 discriminator 2 view .LVU639
+# Lib/munit_test/test_memory.c:341:     assert_intC(pthread_create(&thread, NULL, _test_arena_thread_exit_list, &second), ==, 0);
+	.loc 1 341 79 is_stmt 0 discriminator 2 view .LVU640
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L105	#,
+.LBE98:
+	.loc 1 341 8 is_stmt 1 discriminator 2 view .LVU641
+	.loc 1 342 5 discriminator 2 view .LVU642
+.LBB99:
+	.loc 1 342 10 discriminator 2 view .LVU643
+# Lib/munit_test/test_memory.c:342:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 342 35 is_stmt 0 discriminator 2 view .LVU644
+	movl	$0, %esi	#,
+	movq	-8(%rbp), %rdi	# thread,
+	call	pthread_join@PLT	#
+.LVL216:
+# Lib/munit_test/test_memory.c:342:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 342 19 discriminator 2 view .LVU645
+	cltq
+.LVL217:
+	.loc 1 342 8 is_stmt 1 discriminator 2 view .LVU646
+	.loc 1 342 37 discriminator 2 view .LVU647
+# Lib/munit_test/test_memory.c:342:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 342 40 is_stmt 0 discriminator 2 view .LVU648
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L106	#,
+.LBE99:
+	.loc 1 342 8 is_stmt 1 discriminator 2 view .LVU649
+	.loc 1 345 5 discriminator 2 view .LVU650
+.LBB100:
+	.loc 1 345 10 discriminator 2 view .LVU651
+# Lib/munit_test/test_memory.c:345:     assert_not_null(first);
+	.loc 1 345 22 is_stmt 0 discriminator 2 view .LVU652
+	movq	-16(%rbp), %rax	# first, munit_tmp_a_
+.LVL218:
+	.loc 1 345 46 is_stmt 1 discriminator 2 view .LVU653
+	.loc 1 345 7 discriminator 2 view .LVU654
+# Lib/munit_test/test_memory.c:345:     assert_not_null(first);
+	.loc 1 345 10 is_stmt 0 discriminator 2 view .LVU655
+	testq	%rax, %rax	# munit_tmp_a_
+	je	.L107	#,
+.LBE100:
+	.loc 1 345 8 is_stmt 1 discriminator 2 view .LVU656
+	.loc 1 346 5 discriminator 2 view .LVU657
+.LBB101:
+	.loc 1 346 10 discriminator 2 view .LVU658
+# Lib/munit_test/test_memory.c:346:     assert_ptr(second, ==, first);
+	.loc 1 346 22 is_stmt 0 discriminator 2 view .LVU659
+	movq	-24(%rbp), %rdx	# second, munit_tmp_a_
+.LVL219:
+	.loc 1 346 47 is_stmt 1 discriminator 2 view .LVU660
+	.loc 1 346 83 discriminator 2 view .LVU661
+# Lib/munit_test/test_memory.c:346:     assert_ptr(second, ==, first);
+	.loc 1 346 86 is_stmt 0 discriminator 2 view .LVU662
+	cmpq	%rdx, %rax	# munit_tmp_a_, munit_tmp_a_
+	jne	.L108	#,
+.LBE101:
+	.loc 1 346 8 is_stmt 1 discriminator 2 view .LVU663
+	.loc 1 348 5 discriminator 2 view .LVU664
+# Lib/munit_test/test_memory.c:349: }
+	.loc 1 349 1 is_stmt 0 discriminator 2 view .LVU665
+	movl	$0, %eax	#,
+.LVL220:
+	.loc 1 349 1 discriminator 2 view .LVU666
+	leave	
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL221:
+	.loc 1 349 1 discriminator 2 view .LVU667
+	ret	
+.LVL222:
+.L103:
+	.cfi_restore_state
+.LBB102:
+	.loc 1 339 114 is_stmt 1 discriminator 1 view .LVU668
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp100
+	pushq	%r8	# tmp100
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC49(%rip), %rcx	#, tmp101
+	leaq	.LC50(%rip), %rdx	#, tmp102
+	movl	$339, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp103
+	movl	$0, %eax	#,
+.LVL223:
+	.loc 1 339 114 is_stmt 0 discriminator 1 view .LVU669
+	call	munit_errorf_ex@PLT	#
+.LVL224:
+.L104:
+	.loc 1 339 114 discriminator 1 view .LVU670
+.LBE102:
+.LBB103:
+	.loc 1 340 76 is_stmt 1 discriminator 1 view .LVU671
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp105
+	pushq	%r8	# tmp105
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC51(%rip), %rcx	#, tmp106
+	leaq	.LC50(%rip), %rdx	#, tmp107
+	movl	$340, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp108
+	movl	$0, %eax	#,
+.LVL225:
+	.loc 1 340 76 is_stmt 0 discriminator 1 view .LVU672
+	call	munit_errorf_ex@PLT	#
+.LVL226:
+.L105:
+	.loc 1 340 76 discriminator 1 view .LVU673
+.LBE103:
+.LBB104:
+	.loc 1 341 115 is_stmt 1 discriminator 1 view .LVU674
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp112
+	pushq	%r8	# tmp112
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC52(%rip), %rcx	#, tmp113
+	leaq	.LC50(%rip), %rdx	#, tmp114
+	movl	$341, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp115
+	movl	$0, %eax	#,
+.LVL227:
+	.loc 1 341 115 is_stmt 0 discriminator 1 view .LVU675
+	call	munit_errorf_ex@PLT	#
+.LVL228:
+.L106:
+	.loc 1 341 115 discriminator 1 view .LVU676
+.LBE104:
+.LBB105:
+	.loc 1 342 76 is_stmt 1 discriminator 1 view .LVU677
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp117
+	pushq	%r8	# tmp117
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC51(%rip), %rcx	#, tmp118
+	leaq	.LC50(%rip), %rdx	#, tmp119
+	movl	$342, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp120
+	movl	$0, %eax	#,
+.LVL229:
+	.loc 1 342 76 is_stmt 0 discriminator 1 view .LVU678
+	call	munit_errorf_ex@PLT	#
+.LVL230:
+.L107:
+	.loc 1 342 76 discriminator 1 view .LVU679
+.LBE105:
+.LBB106:
+	.loc 1 345 46 is_stmt 1 discriminator 1 view .LVU680
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC54(%rip), %r8	#, tmp121
+	pushq	%r8	# tmp121
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC53(%rip), %r9	#,
+	leaq	.LC55(%rip), %rcx	#, tmp122
+	leaq	.LC56(%rip), %rdx	#, tmp123
+	movl	$345, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp124
+	call	munit_errorf_ex@PLT	#
+.LVL231:
+.L108:
+	.loc 1 345 46 is_stmt 0 discriminator 1 view .LVU681
+.LBE106:
+.LBB107:
+	.loc 1 346 122 is_stmt 1 discriminator 1 view .LVU682
+	subq	$8, %rsp	#,
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC13(%rip), %r8	#, tmp125
+	pushq	%r8	# tmp125
+	pushq	%rdx	# munit_tmp_a_
+	leaq	.LC55(%rip), %r9	#,
+	leaq	.LC57(%rip), %rcx	#, tmp126
+	leaq	.LC56(%rip), %rdx	#, tmp127
+.LVL232:
+	.loc 1 346 122 is_stmt 0 discriminator 1 view .LVU683
+	movl	$346, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp128
+	movl	$0, %eax	#,
+.LVL233:
+	.loc 1 346 122 discriminator 1 view .LVU684
+	call	munit_errorf_ex@PLT	#
+.LVL234:
+	.loc 1 346 122 discriminator 1 view .LVU685
+.LBE107:
+	.cfi_endproc
+.LFE37:
+	.size	test_arena_thread_exit, .-test_arena_thread_exit
+	.section	.rodata.str1.8
+	.align 8
+.LC58:
+	.string	"pthread_create(&thread, ((void *)0), _test_freelists_thread_exit_fill, ((void *)0))"
+	.text
+	.type	test_freelists_thread_exit, @function
+test_freelists_thread_exit:
+.LVL235:
+.LFB33:
+	.loc 1 248 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 248 1 is_stmt 0 view .LVU687
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp	#,
+	.loc 1 249 5 is_stmt 1 view .LVU688
+	.loc 1 250 5 view .LVU689
+.LBB108:
+	.loc 1 250 10 view .LVU690
+# Lib/munit_test/test_memory.c:250:     assert_intC(pthread_create(&thread, NULL, _test_freelists_thread_exit_fill, NULL), ==, 0);
+	.loc 1 250 35 is_stmt 0 view .LVU691
+	leaq	-8(%rbp), %rdi	#, tmp90
+.LVL236:
+	.loc 1 250 35 view .LVU692
+	movl	$0, %ecx	#,
+	leaq	_test_freelists_thread_exit_fill(%rip), %rdx	#, tmp91
+	movl	$0, %esi	#,
+.LVL237:
+	.loc 1 250 35 view .LVU693
+	call	pthread_create@PLT	#
+.LVL238:
+# Lib/munit_test/test_memory.c:250:     assert_intC(pthread_create(&thread, NULL, _test_freelists_thread_exit_fill, NULL), ==, 0);
+	.loc 1 250 19 view .LVU694
+	cltq
+.LVL239:
+	.loc 1 250 8 is_stmt 1 view .LVU695
+	.loc 1 250 37 view .LVU696
+# Lib/munit_test/test_memory.c:250:     assert_intC(pthread_create(&thread, NULL, _test_freelists_thread_exit_fill, NULL), ==, 0);
+	.loc 1 250 40 is_stmt 0 view .LVU697
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L113	#,
+.LBE108:
+	.loc 1 250 8 is_stmt 1 discriminator 2 view .LVU698
+	.loc 1 251 5 discriminator 2 view .LVU699
+.LBB109:
+	.loc 1 251 10 discriminator 2 view .LVU700
+# Lib/munit_test/test_memory.c:251:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 251 35 is_stmt 0 discriminator 2 view .LVU701
+	movl	$0, %esi	#,
+	movq	-8(%rbp), %rdi	# thread,
+	call	pthread_join@PLT	#
+.LVL240:
+# Lib/munit_test/test_memory.c:251:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 251 19 discriminator 2 view .LVU702
+	cltq
+.LVL241:
+	.loc 1 251 8 is_stmt 1 discriminator 2 view .LVU703
+	.loc 1 251 37 discriminator 2 view .LVU704
+# Lib/munit_test/test_memory.c:251:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 251 40 is_stmt 0 discriminator 2 view .LVU705
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L114	#,
+.LBE109:
+	.loc 1 251 8 is_stmt 1 discriminator 2 view .LVU706
+	.loc 1 252 5 discriminator 2 view .LVU707
+# Lib/munit_test/test_memory.c:253: }
+	.loc 1 253 1 is_stmt 0 discriminator 2 view .LVU708
+	movl	$0, %eax	#,
+.LVL242:
+	.loc 1 253 1 discriminator 2 view .LVU709
+	leave	
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL243:
+.L113:
+	.cfi_restore_state
+.LBB110:
+	.loc 1 250 76 is_stmt 1 discriminator 1 view .LVU710
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp92
+	pushq	%r8	# tmp92
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC58(%rip), %rcx	#, tmp93
+	leaq	.LC50(%rip), %rdx	#, tmp94
+	movl	$250, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp95
+	movl	$0, %eax	#,
+.LVL244:
+	.loc 1 250 76 is_stmt 0 discriminator 1 view .LVU711
+	call	munit_errorf_ex@PLT	#
+.LVL245:
+.L114:
+	.loc 1 250 76 discriminator 1 view .LVU712
+.LBE110:
+.LBB111:
+	.loc 1 251 76 is_stmt 1 discriminator 1 view .LVU713
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp97
+	pushq	%r8	# tmp97
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC51(%rip), %rcx	#, tmp98
+	leaq	.LC50(%rip), %rdx	#, tmp99
+	movl	$251, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp100
+	movl	$0, %eax	#,
+.LVL246:
+	.loc 1 251 76 is_stmt 0 discriminator 1 view .LVU714
+	call	munit_errorf_ex@PLT	#
+.LVL247:
+	.loc 1 251 76 discriminator 1 view .LVU715
+.LBE111:
+	.cfi_endproc
+.LFE33:
+	.size	test_freelists_thread_exit, .-test_freelists_thread_exit
+	.section	.rodata.str1.8
+	.align 8
+.LC59:
+	.string	"pthread_create(&thread, ((void *)0), _test_thread_exit_malloc_free, &first)"
+	.align 8
+.LC60:
+	.string	"pthread_create(&thread, ((void *)0), _test_thread_exit_malloc_free, &second)"
+	.text
+	.type	test_malloc_thread_exit, @function
+test_malloc_thread_exit:
+.LVL248:
+.LFB30:
+	.loc 1 148 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 148 1 is_stmt 0 view .LVU717
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp	#,
+	.loc 1 149 5 is_stmt 1 view .LVU718
+	.loc 1 150 5 view .LVU719
+# Lib/munit_test/test_memory.c:150:     void     *first = NULL;
+	.loc 1 150 11 is_stmt 0 view .LVU720
+	movq	$0, -16(%rbp)	#, first
+	.loc 1 151 5 is_stmt 1 view .LVU721
+# Lib/munit_test/test_memory.c:151:     void     *second = NULL;
+	.loc 1 151 11 is_stmt 0 view .LVU722
+	movq	$0, -24(%rbp)	#, second
+	.loc 1 153 5 is_stmt 1 view .LVU723
+.LBB112:
+	.loc 1 153 10 view .LVU724
+# Lib/munit_test/test_memory.c:153:     assert_intC(pthread_create(&thread, NULL, _test_thread_exit_malloc_free, &first), ==, 0);
+	.loc 1 153 35 is_stmt 0 view .LVU725
+	leaq	-16(%rbp), %rcx	#, tmp97
+	leaq	-8(%rbp), %rdi	#, tmp98
+.LVL249:
+	.loc 1 153 35 view .LVU726
+	leaq	_test_thread_exit_malloc_free(%rip), %rdx	#, tmp99
+	movl	$0, %esi	#,
+.LVL250:
+	.loc 1 153 35 view .LVU727
+	call	pthread_create@PLT	#
+.LVL251:
+# Lib/munit_test/test_memory.c:153:     assert_intC(pthread_create(&thread, NULL, _test_thread_exit_malloc_free, &first), ==, 0);
+	.loc 1 153 19 view .LVU728
+	cltq
+.LVL252:
+	.loc 1 153 47 is_stmt 1 view .LVU729
+	.loc 1 153 76 view .LVU730
+# Lib/munit_test/test_memory.c:153:     assert_intC(pthread_create(&thread, NULL, _test_thread_exit_malloc_free, &first), ==, 0);
+	.loc 1 153 79 is_stmt 0 view .LVU731
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L123	#,
+.LBE112:
+	.loc 1 153 8 is_stmt 1 discriminator 2 view .LVU732
+	.loc 1 154 5 discriminator 2 view .LVU733
+.LBB113:
+	.loc 1 154 10 discriminator 2 view .LVU734
+# Lib/munit_test/test_memory.c:154:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 154 35 is_stmt 0 discriminator 2 view .LVU735
+	movl	$0, %esi	#,
+	movq	-8(%rbp), %rdi	# thread,
+	call	pthread_join@PLT	#
+.LVL253:
+# Lib/munit_test/test_memory.c:154:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 154 19 discriminator 2 view .LVU736
+	cltq
+.LVL254:
+	.loc 1 154 8 is_stmt 1 discriminator 2 view .LVU737
+	.loc 1 154 37 discriminator 2 view .LVU738
+# Lib/munit_test/test_memory.c:154:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 154 40 is_stmt 0 discriminator 2 view .LVU739
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L124	#,
+.LBE113:
+	.loc 1 154 8 is_stmt 1 discriminator 2 view .LVU740
+	.loc 1 155 5 discriminator 2 view .LVU741
+.LBB114:
+	.loc 1 155 10 discriminator 2 view .LVU742
+# Lib/munit_test/test_memory.c:155:     assert_intC(pthread_create(&thread, NULL, _test_thread_exit_malloc_free, &second), ==, 0);
+	.loc 1 155 35 is_stmt 0 discriminator 2 view .LVU743
+	leaq	-24(%rbp), %rcx	#, tmp109
+	leaq	-8(%rbp), %rdi	#, tmp110
+	leaq	_test_thread_exit_malloc_free(%rip), %rdx	#, tmp111
+	movl	$0, %esi	#,
+	call	pthread_create@PLT	#
+.LVL255:
+# Lib/munit_test/test_memory.c:155:     assert_intC(pthread_create(&thread, NULL, _test_thread_exit_malloc_free, &second), ==, 0);
+	.loc 1 155 19 discriminator 2 view .LVU744
+	cltq
+.LVL256:
+	.loc 1 155 48 is_stmt 1 discriminator 2 view .LVU745
+	.loc 1 155 77 discriminator 2 view .LVU746
+# Lib/munit_test/test_memory.c:155:     assert_intC(pthread_create(&thread, NULL, _test_thread_exit_malloc_free, &second), ==, 0);
+	.loc 1 155 80 is_stmt 0 discriminator 2 view .LVU747
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L125	#,
+.LBE114:
+	.loc 1 155 8 is_stmt 1 discriminator 2 view .LVU748
+	.loc 1 156 5 discriminator 2 view .LVU749
+.LBB115:
+	.loc 1 156 10 discriminator 2 view .LVU750
+# Lib/munit_test/test_memory.c:156:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 156 35 is_stmt 0 discriminator 2 view .LVU751
+	movl	$0, %esi	#,
+	movq	-8(%rbp), %rdi	# thread,
+	call	pthread_join@PLT	#
+.LVL257:
+# Lib/munit_test/test_memory.c:156:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 156 19 discriminator 2 view .LVU752
+	cltq
+.LVL258:
+	.loc 1 156 8 is_stmt 1 discriminator 2 view .LVU753
+	.loc 1 156 37 discriminator 2 view .LVU754
+# Lib/munit_test/test_memory.c:156:     assert_intC(pthread_join(thread, NULL), ==, 0);
+	.loc 1 156 40 is_stmt 0 discriminator 2 view .LVU755
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L126	#,
+.LBE115:
+	.loc 1 156 8 is_stmt 1 discriminator 2 view .LVU756
+	.loc 1 159 5 discriminator 2 view .LVU757
+.LBB116:
+	.loc 1 159 10 discriminator 2 view .LVU758
+# Lib/munit_test/test_memory.c:159:     assert_not_null(first);
+	.loc 1 159 22 is_stmt 0 discriminator 2 view .LVU759
+	movq	-16(%rbp), %rax	# first, munit_tmp_a_
+.LVL259:
+	.loc 1 159 46 is_stmt 1 discriminator 2 view .LVU760
+	.loc 1 159 7 discriminator 2 view .LVU761
+# Lib/munit_test/test_memory.c:159:     assert_not_null(first);
+	.loc 1 159 10 is_stmt 0 discriminator 2 view .LVU762
+	testq	%rax, %rax	# munit_tmp_a_
+	je	.L127	#,
+.LBE116:
+	.loc 1 159 8 is_stmt 1 discriminator 2 view .LVU763
+	.loc 1 160 5 discriminator 2 view .LVU764
+.LBB117:
+	.loc 1 160 10 discriminator 2 view .LVU765
+# Lib/munit_test/test_memory.c:160:     assert_ptr(second, ==, first);
+	.loc 1 160 22 is_stmt 0 discriminator 2 view .LVU766
+	movq	-24(%rbp), %rdx	# second, munit_tmp_a_
+.LVL260:
+	.loc 1 160 47 is_stmt 1 discriminator 2 view .LVU767
+	.loc 1 160 83 discriminator 2 view .LVU768
+# Lib/munit_test/test_memory.c:160:     assert_ptr(second, ==, first);
+	.loc 1 160 86 is_stmt 0 discriminator 2 view .LVU769
+	cmpq	%rdx, %rax	# munit_tmp_a_, munit_tmp_a_
+	jne	.L128	#,
+.LBE117:
+	.loc 1 160 8 is_stmt 1 discriminator 2 view .LVU770
+	.loc 1 162 5 discriminator 2 view .LVU771
+# Lib/munit_test/test_memory.c:163: }
+	.loc 1 163 1 is_stmt 0 discriminator 2 view .LVU772
+	movl	$0, %eax	#,
+.LVL261:
+	.loc 1 163 1 discriminator 2 view .LVU773
+	leave	
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL262:
+	.loc 1 163 1 discriminator 2 view .LVU774
+	ret	
+.LVL263:
+.L123:
+	.cfi_restore_state
+.LBB118:
+	.loc 1 153 115 is_stmt 1 discriminator 1 view .LVU775
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp100
+	pushq	%r8	# tmp100
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC59(%rip), %rcx	#, tmp101
+	leaq	.LC50(%rip), %rdx	#, tmp102
+	movl	$153, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp103
+	movl	$0, %eax	#,
+.LVL264:
+	.loc 1 153 115 is_stmt 0 discriminator 1 view .LVU776
+	call	munit_errorf_ex@PLT	#
+.LVL265:
+.L124:
+	.loc 1 153 115 discriminator 1 view .LVU777
+.LBE118:
+.LBB119:
+	.loc 1 154 76 is_stmt 1 discriminator 1 view .LVU778
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp105
+	pushq	%r8	# tmp105
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC51(%rip), %rcx	#, tmp106
+	leaq	.LC50(%rip), %rdx	#, tmp107
+	movl	$154, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp108
+	movl	$0, %eax	#,
+.LVL266:
+	.loc 1 154 76 is_stmt 0 discriminator 1 view .LVU779
+	call	munit_errorf_ex@PLT	#
+.LVL267:
+.L125:
+	.loc 1 154 76 discriminator 1 view .LVU780
+.LBE119:
+.LBB120:
+	.loc 1 155 116 is_stmt 1 discriminator 1 view .LVU781
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp112
+	pushq	%r8	# tmp112
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC60(%rip), %rcx	#, tmp113
+	leaq	.LC50(%rip), %rdx	#, tmp114
+	movl	$155, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp115
+	movl	$0, %eax	#,
+.LVL268:
+	.loc 1 155 116 is_stmt 0 discriminator 1 view .LVU782
+	call	munit_errorf_ex@PLT	#
+.LVL269:
+.L126:
+	.loc 1 155 116 discriminator 1 view .LVU783
+.LBE120:
+.LBB121:
+	.loc 1 156 76 is_stmt 1 discriminator 1 view .LVU784
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC13(%rip), %r8	#, tmp117
+	pushq	%r8	# tmp117
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC4(%rip), %r9	#,
+	leaq	.LC51(%rip), %rcx	#, tmp118
+	leaq	.LC50(%rip), %rdx	#, tmp119
+	movl	$156, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp120
+	movl	$0, %eax	#,
+.LVL270:
+	.loc 1 156 76 is_stmt 0 discriminator 1 view .LVU785
+	call	munit_errorf_ex@PLT	#
+.LVL271:
+.L127:
+	.loc 1 156 76 discriminator 1 view .LVU786
+.LBE121:
+.LBB122:
+	.loc 1 159 46 is_stmt 1 discriminator 1 view .LVU787
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC54(%rip), %r8	#, tmp121
+	pushq	%r8	# tmp121
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC53(%rip), %r9	#,
+	leaq	.LC55(%rip), %rcx	#, tmp122
+	leaq	.LC56(%rip), %rdx	#, tmp123
+	movl	$159, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp124
+	call	munit_errorf_ex@PLT	#
+.LVL272:
+.L128:
+	.loc 1 159 46 is_stmt 0 discriminator 1 view .LVU788
+.LBE122:
+.LBB123:
+	.loc 1 160 122 is_stmt 1 discriminator 1 view .LVU789
+	subq	$8, %rsp	#,
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC13(%rip), %r8	#, tmp125
+	pushq	%r8	# tmp125
+	pushq	%rdx	# munit_tmp_a_
+	leaq	.LC55(%rip), %r9	#,
+	leaq	.LC57(%rip), %rcx	#, tmp126
+	leaq	.LC56(%rip), %rdx	#, tmp127
+.LVL273:
+	.loc 1 160 122 is_stmt 0 discriminator 1 view .LVU790
+	movl	$160, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp128
+	movl	$0, %eax	#,
+.LVL274:
+	.loc 1 160 122 discriminator 1 view .LVU791
+	call	munit_errorf_ex@PLT	#
+.LVL275:
+	.loc 1 160 122 discriminator 1 view .LVU792
+.LBE123:
+	.cfi_endproc
+.LFE30:
+	.size	test_malloc_thread_exit, .-test_malloc_thread_exit
+	.type	_test_arena_thread_exit_list, @function
+_test_arena_thread_exit_list:
+.LVL276:
+.LFB36:
+	.loc 1 321 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 321 1 is_stmt 0 view .LVU794
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$16, %rsp	#,
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	movq	%rdi, %r12	# tmp94, p
+	.loc 1 322 5 is_stmt 1 view .LVU795
+# Lib/munit_test/test_memory.c:322:     ypObject *exc = yp_None;
+	.loc 1 322 15 is_stmt 0 view .LVU796
+	movq	yp_None(%rip), %rax	# yp_None, yp_None
+	movq	%rax, -24(%rbp)	# yp_None, exc
+	.loc 1 323 5 is_stmt 1 view .LVU797
+	.loc 1 324 5 view .LVU798
+	leaq	-24(%rbp), %rdi	#, tmp90
+.LVL277:
+	.loc 1 324 5 is_stmt 0 view .LVU799
+	call	yp_arena_begin@PLT	#
+.LVL278:
+	.loc 1 325 5 is_stmt 1 view .LVU800
+# Lib/munit_test/test_memory.c:325:     list = yp_listN(0);
+	.loc 1 325 12 is_stmt 0 view .LVU801
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_listN@PLT	#
+.LVL279:
+	movq	%rax, %rbx	# tmp95, list
+.LVL280:
+	.loc 1 326 5 is_stmt 1 view .LVU802
+# Lib/munit_test/test_memory.c:326:     *(void **)p = yp_isexceptionC(exc) ? NULL : list;
+	.loc 1 326 19 is_stmt 0 view .LVU803
+	movq	-24(%rbp), %rdi	# exc,
+	call	yp_isexceptionC@PLT	#
+.LVL281:
+# Lib/munit_test/test_memory.c:326:     *(void **)p = yp_isexceptionC(exc) ? NULL : list;
+	.loc 1 326 46 view .LVU804
+	testl	%eax, %eax	# tmp96
+	jne	.L131	#,
+	movq	%rbx, %rax	# list, iftmp.45_4
+.L130:
+# Lib/munit_test/test_memory.c:326:     *(void **)p = yp_isexceptionC(exc) ? NULL : list;
+	.loc 1 326 17 discriminator 4 view .LVU805
+	movq	%rax, (%r12)	# iftmp.45_4, MEM[(void * *)p_11(D)]
+	.loc 1 327 5 is_stmt 1 discriminator 4 view .LVU806
+	movq	%rbx, %rdi	# list,
+	call	yp_decref@PLT	#
+.LVL282:
+	.loc 1 328 5 discriminator 4 view .LVU807
+	leaq	-24(%rbp), %rdi	#, tmp92
+	call	yp_arena_end@PLT	#
+.LVL283:
+	.loc 1 329 5 discriminator 4 view .LVU808
+# Lib/munit_test/test_memory.c:330: }
+	.loc 1 330 1 is_stmt 0 discriminator 4 view .LVU809
+	movl	$0, %eax	#,
+	addq	$16, %rsp	#,
+	popq	%rbx	#
+.LVL284:
+	.loc 1 330 1 discriminator 4 view .LVU810
+	popq	%r12	#
+.LVL285:
+	.loc 1 330 1 discriminator 4 view .LVU811
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL286:
+.L131:
+	.cfi_restore_state
+# Lib/munit_test/test_memory.c:326:     *(void **)p = yp_isexceptionC(exc) ? NULL : list;
+	.loc 1 326 46 view .LVU812
+	movl	$0, %eax	#, iftmp.45_4
+	jmp	.L130	#
+	.cfi_endproc
+.LFE36:
+	.size	_test_arena_thread_exit_list, .-_test_arena_thread_exit_list
+	.section	.rodata.str1.1
+.LC61:
+	.string	"yp_append(list, value, &exc)"
+	.section	.rodata.str1.8
+	.align 8
+.LC62:
+	.string	"yp_setitem(dict, key, value, &exc)"
+	.align 8
+.LC63:
+	.string	"assertion failed: yp_lenC(%s, &exc) == %s; !yp_isexceptionC(exc)"
+	.align 8
+.LC64:
+	.string	"exc set to a non-exception: yp_lenC(%s, &exc) == %s"
+	.align 8
+.LC65:
+	.string	"assertion failed: yp_lenC(%s, &exc) == %s (%ld == %ld)"
+	.section	.rodata.str1.1
+.LC66:
+	.string	"dict"
+.LC67:
+	.string	"1024 * 1024"
+.LC68:
+	.string	"big"
+.LC69:
+	.string	"item"
+.LC70:
+	.string	"value"
+	.section	.rodata.str1.8
+	.align 8
+.LC71:
+	.string	"assertion failed: yp_is(%s, %s) == yp_True"
+	.align 8
+.LC72:
+	.string	"assertion failed: !yp_isexceptionC(yp_is(%s, %s))"
+	.align 8
+.LC73:
+	.string	"expected a bool or an exception: yp_is(%s, %s)"
+	.text
+	.type	_test_arena_temporaries, @function
+_test_arena_temporaries:
+.LFB34:
+	.loc 1 258 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$40, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 259 5 view .LVU814
+	.loc 1 260 5 view .LVU815
+# Lib/munit_test/test_memory.c:260:     ypObject  *list = yp_listN(0);
+	.loc 1 260 22 is_stmt 0 view .LVU816
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_listN@PLT	#
+.LVL287:
+	movq	%rax, %r14	# tmp165, list
+.LVL288:
+	.loc 1 261 5 is_stmt 1 view .LVU817
+# Lib/munit_test/test_memory.c:261:     ypObject  *dict = yp_dictK(0);
+	.loc 1 261 22 is_stmt 0 view .LVU818
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+.LVL289:
+	.loc 1 261 22 view .LVU819
+	call	yp_dictK@PLT	#
+.LVL290:
+	movq	%rax, %r15	# tmp166, dict
+.LVL291:
+	.loc 1 262 5 is_stmt 1 view .LVU820
+# Lib/munit_test/test_memory.c:262:     ypObject  *big = yp_bytesC(1024 * 1024, NULL);  // too large for the arena
+	.loc 1 262 21 is_stmt 0 view .LVU821
+	movl	$0, %esi	#,
+	movl	$1048576, %edi	#,
+	call	yp_bytesC@PLT	#
+.LVL292:
+	.loc 1 262 21 view .LVU822
+	movq	%rax, -72(%rbp)	# tmp167, %sfp
+.LVL293:
+	.loc 1 263 5 is_stmt 1 view .LVU823
+# Lib/munit_test/test_memory.c:263:     for (i = 0; i < 1000; i++) {
+	.loc 1 263 12 is_stmt 0 view .LVU824
+	movl	$0, %r13d	#, i
+.LVL294:
+.L134:
+	.loc 1 263 19 is_stmt 1 discriminator 1 view .LVU825
+	cmpq	$999, %r13	#, i
+	jg	.L155	#,
+.LBB124:
+	.loc 1 264 9 view .LVU826
+# Lib/munit_test/test_memory.c:264:         ypObject *key = yp_intC(i);
+	.loc 1 264 25 is_stmt 0 view .LVU827
+	movq	%r13, %rdi	# i,
+	call	yp_intC@PLT	#
+.LVL295:
+	movq	%rax, %rbx	# tmp168, key
+.LVL296:
+	.loc 1 265 9 is_stmt 1 view .LVU828
+# Lib/munit_test/test_memory.c:265:         ypObject *value = yp_tupleN(N(key, yp_None));
+	.loc 1 265 27 is_stmt 0 view .LVU829
+	movq	yp_None(%rip), %rdx	# yp_None,
+	movq	%rax, %rsi	# key,
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+.LVL297:
+	.loc 1 265 27 view .LVU830
+	call	yp_tupleN@PLT	#
+.LVL298:
+	movq	%rax, %r12	# tmp169, value
+.LVL299:
+	.loc 1 266 9 is_stmt 1 view .LVU831
+.LBB125:
+	.loc 1 266 14 view .LVU832
+# Lib/munit_test/test_memory.c:266:         assert_not_raises_exc(yp_append(list, value, &exc));
+	.loc 1 266 24 is_stmt 0 view .LVU833
+	movq	$0, -56(%rbp)	#, MEM[(struct ypObject * *)_81]
+	.loc 1 266 10 is_stmt 1 view .LVU834
+# Lib/munit_test/test_memory.c:266:         assert_not_raises_exc(yp_append(list, value, &exc));
+	.loc 1 266 11 is_stmt 0 view .LVU835
+	leaq	-56(%rbp), %rdx	#, tmp110
+	movq	%rax, %rsi	# value,
+	movq	%r14, %rdi	# list,
+	call	yp_append@PLT	#
+.LVL300:
+	.loc 1 266 42 is_stmt 1 view .LVU836
+# Lib/munit_test/test_memory.c:266:         assert_not_raises_exc(yp_append(list, value, &exc));
+	.loc 1 266 50 is_stmt 0 view .LVU837
+	movq	-56(%rbp), %rdi	# MEM[(struct ypObject * *)_81], exc.82_2
+# Lib/munit_test/test_memory.c:266:         assert_not_raises_exc(yp_append(list, value, &exc));
+	.loc 1 266 45 view .LVU838
+	testq	%rdi, %rdi	# exc.82_2
+	jne	.L156	#,
+.LBE125:
+	.loc 1 266 12 is_stmt 1 view .LVU839
+	.loc 1 267 9 view .LVU840
+.LBB126:
+	.loc 1 267 14 view .LVU841
+# Lib/munit_test/test_memory.c:267:         assert_not_raises_exc(yp_setitem(dict, key, value, &exc));
+	.loc 1 267 24 is_stmt 0 view .LVU842
+	movq	$0, -56(%rbp)	#, MEM[(struct ypObject * *)_81]
+	.loc 1 267 10 is_stmt 1 view .LVU843
+# Lib/munit_test/test_memory.c:267:         assert_not_raises_exc(yp_setitem(dict, key, value, &exc));
+	.loc 1 267 11 is_stmt 0 view .LVU844
+	leaq	-56(%rbp), %rcx	#, tmp117
+	movq	%r12, %rdx	# value,
+	movq	%rbx, %rsi	# key,
+	movq	%r15, %rdi	# dict,
+	call	yp_setitem@PLT	#
+.LVL301:
+	.loc 1 267 48 is_stmt 1 view .LVU845
+# Lib/munit_test/test_memory.c:267:         assert_not_raises_exc(yp_setitem(dict, key, value, &exc));
+	.loc 1 267 56 is_stmt 0 view .LVU846
+	movq	-56(%rbp), %rdi	# MEM[(struct ypObject * *)_81], exc.84_4
+# Lib/munit_test/test_memory.c:267:         assert_not_raises_exc(yp_setitem(dict, key, value, &exc));
+	.loc 1 267 51 view .LVU847
+	testq	%rdi, %rdi	# exc.84_4
+	jne	.L157	#,
+.LBE126:
+	.loc 1 267 12 is_stmt 1 discriminator 2 view .LVU848
+	.loc 1 268 9 discriminator 2 view .LVU849
+	movq	%r12, %rdx	# value,
+	movq	%rbx, %rsi	# key,
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_decrefN@PLT	#
+.LVL302:
+.LBE124:
+	.loc 1 263 28 discriminator 2 view .LVU850
+	movl	$1, %esi	#,
+	movq	%r13, %rdi	# i,
+	call	__addvdi3@PLT	#
+.LVL303:
+	movq	%rax, %r13	# tmp172, i
+.LVL304:
+	.loc 1 263 28 is_stmt 0 discriminator 2 view .LVU851
+	jmp	.L134	#
+.LVL305:
+.L156:
+.LBB129:
+.LBB127:
+	.loc 1 266 12 is_stmt 1 discriminator 1 view .LVU852
+# Lib/munit_test/test_memory.c:266:         assert_not_raises_exc(yp_append(list, value, &exc));
+	.loc 1 266 16 is_stmt 0 discriminator 1 view .LVU853
+	call	yp_isexceptionC@PLT	#
+.LVL306:
+# Lib/munit_test/test_memory.c:266:         assert_not_raises_exc(yp_append(list, value, &exc));
+	.loc 1 266 15 discriminator 1 view .LVU854
+	testl	%eax, %eax	# tmp170
+	je	.L136	#,
+	.loc 1 266 40 is_stmt 1 discriminator 2 view .LVU855
+	leaq	.LC61(%rip), %rcx	#, tmp111
+	leaq	.LC1(%rip), %rdx	#, tmp112
+	movl	$266, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp113
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL307:
+.L136:
+	.loc 1 266 181 discriminator 3 view .LVU856
+	leaq	.LC61(%rip), %rcx	#, tmp114
+	leaq	.LC3(%rip), %rdx	#, tmp115
+	movl	$266, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp116
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL308:
+.L157:
+	.loc 1 266 181 is_stmt 0 discriminator 3 view .LVU857
+.LBE127:
+.LBB128:
+	.loc 1 267 12 is_stmt 1 discriminator 1 view .LVU858
+# Lib/munit_test/test_memory.c:267:         assert_not_raises_exc(yp_setitem(dict, key, value, &exc));
+	.loc 1 267 16 is_stmt 0 discriminator 1 view .LVU859
+	call	yp_isexceptionC@PLT	#
+.LVL309:
+# Lib/munit_test/test_memory.c:267:         assert_not_raises_exc(yp_setitem(dict, key, value, &exc));
+	.loc 1 267 15 discriminator 1 view .LVU860
+	testl	%eax, %eax	# tmp171
+	je	.L138	#,
+	.loc 1 267 40 is_stmt 1 discriminator 2 view .LVU861
+	leaq	.LC62(%rip), %rcx	#, tmp118
+	leaq	.LC1(%rip), %rdx	#, tmp119
+	movl	$267, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp120
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL310:
+.L138:
+	.loc 1 267 187 discriminator 3 view .LVU862
+	leaq	.LC62(%rip), %rcx	#, tmp121
+	leaq	.LC3(%rip), %rdx	#, tmp122
+	movl	$267, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp123
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL311:
+.L155:
+	.loc 1 267 187 is_stmt 0 discriminator 3 view .LVU863
+.LBE128:
+.LBE129:
+	.loc 1 270 5 is_stmt 1 view .LVU864
+.LBB130:
+	.loc 1 270 10 view .LVU865
+	.loc 1 270 44 view .LVU866
+	.loc 1 270 84 view .LVU867
+.LBB131:
+	.loc 1 270 89 view .LVU868
+	.loc 1 270 118 view .LVU869
+.LBB132:
+	.loc 1 270 123 view .LVU870
+# Lib/munit_test/test_memory.c:270:     assert_len(list, 1000);
+	.loc 1 270 133 is_stmt 0 view .LVU871
+	movq	$0, -56(%rbp)	#, MEM[(struct ypObject * *)_81]
+	.loc 1 270 6 is_stmt 1 view .LVU872
+# Lib/munit_test/test_memory.c:270:     assert_len(list, 1000);
+	.loc 1 270 25 is_stmt 0 view .LVU873
+	leaq	-56(%rbp), %rsi	#, tmp125
+	movq	%r14, %rdi	# list,
+	call	yp_lenC@PLT	#
+.LVL312:
+	.loc 1 270 55 is_stmt 1 view .LVU874
+# Lib/munit_test/test_memory.c:270:     assert_len(list, 1000);
+	.loc 1 270 63 is_stmt 0 view .LVU875
+	movq	-56(%rbp), %rdi	# MEM[(struct ypObject * *)_81], exc.86_6
+# Lib/munit_test/test_memory.c:270:     assert_len(list, 1000);
+	.loc 1 270 58 view .LVU876
+	testq	%rdi, %rdi	# exc.86_6
+	je	.L140	#,
+	.loc 1 270 8 is_stmt 1 discriminator 1 view .LVU877
+# Lib/munit_test/test_memory.c:270:     assert_len(list, 1000);
+	.loc 1 270 12 is_stmt 0 discriminator 1 view .LVU878
+	call	yp_isexceptionC@PLT	#
+.LVL313:
+# Lib/munit_test/test_memory.c:270:     assert_len(list, 1000);
+	.loc 1 270 11 discriminator 1 view .LVU879
+	testl	%eax, %eax	# tmp174
+	je	.L141	#,
+	.loc 1 270 36 is_stmt 1 discriminator 3 view .LVU880
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC25(%rip), %rcx	#, tmp126
+	leaq	.LC63(%rip), %rdx	#, tmp127
+	movl	$270, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp128
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL314:
+.L141:
+	.loc 1 270 191 discriminator 4 view .LVU881
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC25(%rip), %rcx	#, tmp129
+	leaq	.LC64(%rip), %rdx	#, tmp130
+	movl	$270, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp131
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL315:
+.L140:
+	.loc 1 270 191 is_stmt 0 discriminator 4 view .LVU882
+.LBE132:
+	.loc 1 270 121 is_stmt 1 discriminator 2 view .LVU883
+	.loc 1 270 343 discriminator 2 view .LVU884
+# Lib/munit_test/test_memory.c:270:     assert_len(list, 1000);
+	.loc 1 270 346 is_stmt 0 discriminator 2 view .LVU885
+	cmpq	$1000, %rax	#, _ypmt_LEN_actual
+	jne	.L158	#,
+.LBE131:
+	.loc 1 270 87 is_stmt 1 discriminator 6 view .LVU886
+.LBE130:
+	.loc 1 270 8 discriminator 6 view .LVU887
+	.loc 1 271 5 discriminator 6 view .LVU888
+.LBB134:
+	.loc 1 271 10 discriminator 6 view .LVU889
+.LVL316:
+	.loc 1 271 44 discriminator 6 view .LVU890
+	.loc 1 271 84 discriminator 6 view .LVU891
+.LBB135:
+	.loc 1 271 89 discriminator 6 view .LVU892
+	.loc 1 271 118 discriminator 6 view .LVU893
+.LBB136:
+	.loc 1 271 123 discriminator 6 view .LVU894
+# Lib/munit_test/test_memory.c:271:     assert_len(dict, 1000);
+	.loc 1 271 133 is_stmt 0 discriminator 6 view .LVU895
+	movq	$0, -56(%rbp)	#, MEM[(struct ypObject * *)_81]
+	.loc 1 271 6 is_stmt 1 discriminator 6 view .LVU896
+# Lib/munit_test/test_memory.c:271:     assert_len(dict, 1000);
+	.loc 1 271 25 is_stmt 0 discriminator 6 view .LVU897
+	leaq	-56(%rbp), %rsi	#, tmp135
+	movq	%r15, %rdi	# dict,
+	call	yp_lenC@PLT	#
+.LVL317:
+	.loc 1 271 55 is_stmt 1 discriminator 6 view .LVU898
+# Lib/munit_test/test_memory.c:271:     assert_len(dict, 1000);
+	.loc 1 271 63 is_stmt 0 discriminator 6 view .LVU899
+	movq	-56(%rbp), %rdi	# MEM[(struct ypObject * *)_81], exc.88_8
+# Lib/munit_test/test_memory.c:271:     assert_len(dict, 1000);
+	.loc 1 271 58 discriminator 6 view .LVU900
+	testq	%rdi, %rdi	# exc.88_8
+	je	.L143	#,
+	.loc 1 271 8 is_stmt 1 discriminator 1 view .LVU901
+# Lib/munit_test/test_memory.c:271:     assert_len(dict, 1000);
+	.loc 1 271 12 is_stmt 0 discriminator 1 view .LVU902
+	call	yp_isexceptionC@PLT	#
+.LVL318:
+# Lib/munit_test/test_memory.c:271:     assert_len(dict, 1000);
+	.loc 1 271 11 discriminator 1 view .LVU903
+	testl	%eax, %eax	# tmp176
+	je	.L144	#,
+	.loc 1 271 36 is_stmt 1 discriminator 3 view .LVU904
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC66(%rip), %rcx	#, tmp136
+	leaq	.LC63(%rip), %rdx	#, tmp137
+	movl	$271, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp138
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL319:
+.L158:
+	.loc 1 271 36 is_stmt 0 discriminator 3 view .LVU905
+.LBE136:
+.LBE135:
+.LBE134:
+.LBB140:
+.LBB133:
+	.loc 1 270 389 is_stmt 1 discriminator 5 view .LVU906
+	subq	$8, %rsp	#,
+	pushq	$1000	#
+	movq	%rax, %r9	# _ypmt_LEN_actual,
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC25(%rip), %rcx	#, tmp132
+	leaq	.LC65(%rip), %rdx	#, tmp133
+	movl	$270, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp134
+	movl	$0, %eax	#,
+.LVL320:
+	.loc 1 270 389 is_stmt 0 discriminator 5 view .LVU907
+	call	munit_errorf_ex@PLT	#
+.LVL321:
+.L144:
+	.loc 1 270 389 discriminator 5 view .LVU908
+.LBE133:
+.LBE140:
+.LBB141:
+.LBB138:
+.LBB137:
+	.loc 1 271 191 is_stmt 1 discriminator 4 view .LVU909
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC66(%rip), %rcx	#, tmp139
+	leaq	.LC64(%rip), %rdx	#, tmp140
+	movl	$271, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp141
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL322:
+.L143:
+	.loc 1 271 191 is_stmt 0 discriminator 4 view .LVU910
+.LBE137:
+	.loc 1 271 121 is_stmt 1 discriminator 2 view .LVU911
+	.loc 1 271 343 discriminator 2 view .LVU912
+# Lib/munit_test/test_memory.c:271:     assert_len(dict, 1000);
+	.loc 1 271 346 is_stmt 0 discriminator 2 view .LVU913
+	cmpq	$1000, %rax	#, _ypmt_LEN_actual
+	jne	.L159	#,
+.LBE138:
+	.loc 1 271 87 is_stmt 1 discriminator 6 view .LVU914
+.LBE141:
+	.loc 1 271 8 discriminator 6 view .LVU915
+	.loc 1 272 5 discriminator 6 view .LVU916
+.LBB142:
+	.loc 1 272 10 discriminator 6 view .LVU917
+.LVL323:
+	.loc 1 272 43 discriminator 6 view .LVU918
+	.loc 1 272 90 discriminator 6 view .LVU919
+.LBB143:
+	.loc 1 272 95 discriminator 6 view .LVU920
+	.loc 1 272 124 discriminator 6 view .LVU921
+.LBB144:
+	.loc 1 272 129 discriminator 6 view .LVU922
+# Lib/munit_test/test_memory.c:272:     assert_len(big, 1024 * 1024);
+	.loc 1 272 139 is_stmt 0 discriminator 6 view .LVU923
+	movq	$0, -56(%rbp)	#, MEM[(struct ypObject * *)_81]
+	.loc 1 272 6 is_stmt 1 discriminator 6 view .LVU924
+# Lib/munit_test/test_memory.c:272:     assert_len(big, 1024 * 1024);
+	.loc 1 272 25 is_stmt 0 discriminator 6 view .LVU925
+	leaq	-56(%rbp), %rsi	#, tmp145
+	movq	-72(%rbp), %rdi	# %sfp,
+	call	yp_lenC@PLT	#
+.LVL324:
+	.loc 1 272 25 discriminator 6 view .LVU926
+	movq	%rax, %r9	# tmp177, _ypmt_LEN_actual
+.LVL325:
+	.loc 1 272 55 is_stmt 1 discriminator 6 view .LVU927
+# Lib/munit_test/test_memory.c:272:     assert_len(big, 1024 * 1024);
+	.loc 1 272 63 is_stmt 0 discriminator 6 view .LVU928
+	movq	-56(%rbp), %rdi	# MEM[(struct ypObject * *)_81], exc.90_10
+# Lib/munit_test/test_memory.c:272:     assert_len(big, 1024 * 1024);
+	.loc 1 272 58 discriminator 6 view .LVU929
+	testq	%rdi, %rdi	# exc.90_10
+	je	.L146	#,
+	.loc 1 272 8 is_stmt 1 discriminator 1 view .LVU930
+# Lib/munit_test/test_memory.c:272:     assert_len(big, 1024 * 1024);
+	.loc 1 272 12 is_stmt 0 discriminator 1 view .LVU931
+	call	yp_isexceptionC@PLT	#
+.LVL326:
+# Lib/munit_test/test_memory.c:272:     assert_len(big, 1024 * 1024);
+	.loc 1 272 11 discriminator 1 view .LVU932
+	testl	%eax, %eax	# tmp178
+	je	.L147	#,
+	.loc 1 272 36 is_stmt 1 discriminator 3 view .LVU933
+	leaq	.LC67(%rip), %r8	#,
+	leaq	.LC68(%rip), %rcx	#, tmp146
+	leaq	.LC63(%rip), %rdx	#, tmp147
+	movl	$272, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp148
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL327:
+.L159:
+	.loc 1 272 36 is_stmt 0 discriminator 3 view .LVU934
+.LBE144:
+.LBE143:
+.LBE142:
+.LBB148:
+.LBB139:
+	.loc 1 271 389 is_stmt 1 discriminator 5 view .LVU935
+	subq	$8, %rsp	#,
+	pushq	$1000	#
+	movq	%rax, %r9	# _ypmt_LEN_actual,
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC66(%rip), %rcx	#, tmp142
+	leaq	.LC65(%rip), %rdx	#, tmp143
+	movl	$271, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp144
+	movl	$0, %eax	#,
+.LVL328:
+	.loc 1 271 389 is_stmt 0 discriminator 5 view .LVU936
+	call	munit_errorf_ex@PLT	#
+.LVL329:
+.L147:
+	.loc 1 271 389 discriminator 5 view .LVU937
+.LBE139:
+.LBE148:
+.LBB149:
+.LBB146:
+.LBB145:
+	.loc 1 272 197 is_stmt 1 discriminator 4 view .LVU938
+	leaq	.LC67(%rip), %r8	#,
+	leaq	.LC68(%rip), %rcx	#, tmp149
+	leaq	.LC64(%rip), %rdx	#, tmp150
+	movl	$272, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp151
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL330:
+.L146:
+	.loc 1 272 197 is_stmt 0 discriminator 4 view .LVU939
+.LBE145:
+	.loc 1 272 127 is_stmt 1 discriminator 2 view .LVU940
+	.loc 1 272 355 discriminator 2 view .LVU941
+# Lib/munit_test/test_memory.c:272:     assert_len(big, 1024 * 1024);
+	.loc 1 272 358 is_stmt 0 discriminator 2 view .LVU942
+	cmpq	$1048576, %rax	#, _ypmt_LEN_actual
+	jne	.L160	#,
+.LBE146:
+	.loc 1 272 93 is_stmt 1 discriminator 6 view .LVU943
+.LBE149:
+	.loc 1 272 8 discriminator 6 view .LVU944
+	.loc 1 273 5 discriminator 6 view .LVU945
+.LBB150:
+	.loc 1 273 10 discriminator 6 view .LVU946
+# Lib/munit_test/test_memory.c:273:     ead(value, yp_getitem(dict, yp_i_two),
+	.loc 1 273 31 is_stmt 0 discriminator 6 view .LVU947
+	movq	yp_i_two(%rip), %rsi	# yp_i_two,
+	movq	%r15, %rdi	# dict,
+	call	yp_getitem@PLT	#
+.LVL331:
+	.loc 1 273 31 discriminator 6 view .LVU948
+	movq	%rax, %rbx	# tmp179, value
+.LVL332:
+	.loc 1 273 60 is_stmt 1 discriminator 6 view .LVU949
+.LBB151:
+	.loc 1 273 65 discriminator 6 view .LVU950
+# Lib/munit_test/test_memory.c:273:     ead(value, yp_getitem(dict, yp_i_two),
+	.loc 1 273 85 is_stmt 0 discriminator 6 view .LVU951
+	movl	$2, %esi	#,
+	movq	%r14, %rdi	# list,
+	call	yp_getindexC@PLT	#
+.LVL333:
+	.loc 1 273 85 discriminator 6 view .LVU952
+	movq	%rax, %rdi	# tmp180, item
+.LVL334:
+	.loc 1 273 109 is_stmt 1 discriminator 6 view .LVU953
+.LBB152:
+	.loc 1 273 114 discriminator 6 view .LVU954
+	.loc 1 273 147 discriminator 6 view .LVU955
+	.loc 1 273 179 discriminator 6 view .LVU956
+.LBB153:
+	.loc 1 273 184 discriminator 6 view .LVU957
+# Lib/munit_test/test_memory.c:273:     ead(value, yp_getitem(dict, yp_i_two),
+	.loc 1 273 255 is_stmt 0 discriminator 6 view .LVU958
+	cmpq	%rax, %rbx	# item, value
+	je	.L161	#,
+# Lib/munit_test/test_memory.c:273:     ead(value, yp_getitem(dict, yp_i_two),
+	.loc 1 273 255 discriminator 2 view .LVU959
+	movq	yp_False(%rip), %rax	# yp_False, iftmp.93_17
+.LVL335:
+.L150:
+	.loc 1 273 268 is_stmt 1 discriminator 4 view .LVU960
+	.loc 1 273 273 discriminator 4 view .LVU961
+# Lib/munit_test/test_memory.c:273:     ead(value, yp_getitem(dict, yp_i_two),
+	.loc 1 273 276 is_stmt 0 discriminator 4 view .LVU962
+	cmpq	%rax, yp_True(%rip)	# iftmp.93_17, yp_True
+	je	.L151	#,
+	.loc 1 273 315 is_stmt 1 discriminator 6 view .LVU963
+# Lib/munit_test/test_memory.c:273:     ead(value, yp_getitem(dict, yp_i_two),
+	.loc 1 273 318 is_stmt 0 discriminator 6 view .LVU964
+	cmpq	%rax, yp_False(%rip)	# iftmp.93_17, yp_False
+	je	.L162	#,
+	.loc 1 273 504 is_stmt 1 discriminator 8 view .LVU965
+	.loc 1 273 509 discriminator 8 view .LVU966
+	.loc 1 273 514 discriminator 8 view .LVU967
+# Lib/munit_test/test_memory.c:273:     ead(value, yp_getitem(dict, yp_i_two),
+	.loc 1 273 518 is_stmt 0 discriminator 8 view .LVU968
+	movq	%rax, %rdi	# iftmp.93_17,
+.LVL336:
+	.loc 1 273 518 discriminator 8 view .LVU969
+	call	yp_isexceptionC@PLT	#
+.LVL337:
+# Lib/munit_test/test_memory.c:273:     ead(value, yp_getitem(dict, yp_i_two),
+	.loc 1 273 517 discriminator 8 view .LVU970
+	testl	%eax, %eax	# tmp181
+	je	.L153	#,
+	.loc 1 273 555 is_stmt 1 discriminator 9 view .LVU971
+	leaq	.LC69(%rip), %r8	#,
+	leaq	.LC70(%rip), %rcx	#, tmp159
+	leaq	.LC72(%rip), %rdx	#, tmp160
+	movl	$274, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp161
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL338:
+.L160:
+	.loc 1 273 555 is_stmt 0 discriminator 9 view .LVU972
+.LBE153:
+.LBE152:
+.LBE151:
+.LBE150:
+.LBB157:
+.LBB147:
+	.loc 1 272 401 is_stmt 1 discriminator 5 view .LVU973
+	subq	$8, %rsp	#,
+	pushq	$1048576	#
+	leaq	.LC67(%rip), %r8	#,
+	leaq	.LC68(%rip), %rcx	#, tmp152
+	leaq	.LC65(%rip), %rdx	#, tmp153
+	movl	$272, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp154
+	movl	$0, %eax	#,
+.LVL339:
+	.loc 1 272 401 is_stmt 0 discriminator 5 view .LVU974
+	call	munit_errorf_ex@PLT	#
+.LVL340:
+.L161:
+	.loc 1 272 401 discriminator 5 view .LVU975
+.LBE147:
+.LBE157:
+.LBB158:
+.LBB156:
+.LBB155:
+.LBB154:
+# Lib/munit_test/test_memory.c:273:     ead(value, yp_getitem(dict, yp_i_two),
+	.loc 1 273 255 discriminator 1 view .LVU976
+	movq	yp_True(%rip), %rax	# yp_True, iftmp.93_17
+.LVL341:
+	.loc 1 273 255 discriminator 1 view .LVU977
+	jmp	.L150	#
+.LVL342:
+.L162:
+	.loc 1 273 351 is_stmt 1 discriminator 7 view .LVU978
+	leaq	.LC69(%rip), %r8	#,
+	leaq	.LC70(%rip), %rcx	#, tmp156
+	leaq	.LC71(%rip), %rdx	#, tmp157
+	movl	$274, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp158
+.LVL343:
+	.loc 1 273 351 is_stmt 0 discriminator 7 view .LVU979
+	movl	$0, %eax	#,
+.LVL344:
+	.loc 1 273 351 discriminator 7 view .LVU980
+	call	munit_errorf_ex@PLT	#
+.LVL345:
+.L153:
+	.loc 1 273 512 is_stmt 1 discriminator 10 view .LVU981
+	.loc 1 273 718 discriminator 10 view .LVU982
+	leaq	.LC69(%rip), %r8	#,
+	leaq	.LC70(%rip), %rcx	#, tmp162
+	leaq	.LC73(%rip), %rdx	#, tmp163
+	movl	$274, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp164
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL346:
+.L151:
+	.loc 1 273 308 view .LVU983
+	.loc 1 273 507 view .LVU984
+	.loc 1 273 271 view .LVU985
+.LBE154:
+	.loc 1 273 182 view .LVU986
+.LBE155:
+	.loc 1 273 112 view .LVU987
+	.loc 1 273 917 view .LVU988
+	call	yp_decref@PLT	#
+.LVL347:
+	.loc 1 273 917 is_stmt 0 view .LVU989
+.LBE156:
+	.loc 1 273 63 is_stmt 1 view .LVU990
+	.loc 1 273 947 view .LVU991
+	movq	%rbx, %rdi	# value,
+	call	yp_decref@PLT	#
+.LVL348:
+.LBE158:
+	.loc 1 273 8 view .LVU992
+	.loc 1 275 5 view .LVU993
+	movq	-72(%rbp), %rcx	# %sfp,
+	movq	%r15, %rdx	# dict,
+	movq	%r14, %rsi	# list,
+	movl	$3, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_decrefN@PLT	#
+.LVL349:
+# Lib/munit_test/test_memory.c:276: }
+	.loc 1 276 1 is_stmt 0 view .LVU994
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+.LVL350:
+	.loc 1 276 1 view .LVU995
+	popq	%r12	#
+	popq	%r13	#
+.LVL351:
+	.loc 1 276 1 view .LVU996
+	popq	%r14	#
+.LVL352:
+	.loc 1 276 1 view .LVU997
+	popq	%r15	#
+.LVL353:
+	.loc 1 276 1 view .LVU998
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+.LVL354:
+	.loc 1 276 1 view .LVU999
+	ret	
+	.cfi_endproc
+.LFE34:
+	.size	_test_arena_temporaries, .-_test_arena_temporaries
+	.section	.rodata.str1.1
+.LC74:
+	.string	"yp_arena_begin(&exc)"
+.LC75:
+	.string	"yp_arena_end(&exc)"
+	.section	.rodata.str1.8
+	.align 8
+.LC76:
+	.string	"yp_append(list, yp_i_two, &exc)"
+	.section	.rodata.str1.1
+.LC77:
+	.string	"yp_i_one"
+.LC78:
+	.string	"yp_i_two"
+.LC79:
+	.string	"yp_RuntimeError"
+	.text
+	.type	test_arena, @function
+test_arena:
+.LVL355:
+.LFB35:
+	.loc 1 279 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 279 1 is_stmt 0 view .LVU1001
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$56, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 281 5 is_stmt 1 view .LVU1002
+.LBB159:
+	.loc 1 281 10 view .LVU1003
+# Lib/munit_test/test_memory.c:281:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 281 20 is_stmt 0 view .LVU1004
+	movq	$0, -64(%rbp)	#, MEM[(struct ypObject * *)_175]
+	.loc 1 281 6 is_stmt 1 view .LVU1005
+# Lib/munit_test/test_memory.c:281:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 281 7 is_stmt 0 view .LVU1006
+	leaq	-64(%rbp), %rdi	#, tmp138
+.LVL356:
+	.loc 1 281 7 view .LVU1007
+	call	yp_arena_begin@PLT	#
+.LVL357:
+	.loc 1 281 30 is_stmt 1 view .LVU1008
+# Lib/munit_test/test_memory.c:281:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 281 38 is_stmt 0 view .LVU1009
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175], exc.47_1
+# Lib/munit_test/test_memory.c:281:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 281 33 view .LVU1010
+	testq	%rdi, %rdi	# exc.47_1
+	je	.L164	#,
+	.loc 1 281 8 is_stmt 1 discriminator 1 view .LVU1011
+# Lib/munit_test/test_memory.c:281:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 281 12 is_stmt 0 discriminator 1 view .LVU1012
+	call	yp_isexceptionC@PLT	#
+.LVL358:
+# Lib/munit_test/test_memory.c:281:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 281 11 discriminator 1 view .LVU1013
+	testl	%eax, %eax	# tmp279
+	je	.L165	#,
+	.loc 1 281 36 is_stmt 1 discriminator 2 view .LVU1014
+	leaq	.LC74(%rip), %rcx	#, tmp139
+	leaq	.LC1(%rip), %rdx	#, tmp140
+	movl	$281, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp141
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL359:
+.L165:
+	.loc 1 281 169 discriminator 3 view .LVU1015
+	leaq	.LC74(%rip), %rcx	#, tmp142
+	leaq	.LC3(%rip), %rdx	#, tmp143
+	movl	$281, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp144
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL360:
+.L164:
+.LBE159:
+	.loc 1 281 8 view .LVU1016
+	.loc 1 282 5 view .LVU1017
+	call	_test_arena_temporaries	#
+.LVL361:
+	.loc 1 283 5 view .LVU1018
+.LBB160:
+	.loc 1 283 10 view .LVU1019
+	.loc 1 283 36 view .LVU1020
+	.loc 1 283 62 view .LVU1021
+.LBB161:
+	.loc 1 283 67 view .LVU1022
+# Lib/munit_test/test_memory.c:283:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 283 77 is_stmt 0 view .LVU1023
+	movq	$0, -64(%rbp)	#, MEM[(struct ypObject * *)_175]
+	.loc 1 283 6 is_stmt 1 view .LVU1024
+# Lib/munit_test/test_memory.c:283:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 283 23 is_stmt 0 view .LVU1025
+	leaq	-64(%rbp), %rdi	#, tmp145
+	call	yp_arena_end@PLT	#
+.LVL362:
+	.loc 1 283 44 is_stmt 1 view .LVU1026
+	.loc 1 283 65 view .LVU1027
+# Lib/munit_test/test_memory.c:283:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 283 73 is_stmt 0 view .LVU1028
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175], exc.49_3
+# Lib/munit_test/test_memory.c:283:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 283 68 view .LVU1029
+	testq	%rdi, %rdi	# exc.49_3
+	je	.L166	#,
+	.loc 1 283 8 is_stmt 1 discriminator 1 view .LVU1030
+# Lib/munit_test/test_memory.c:283:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 283 12 is_stmt 0 discriminator 1 view .LVU1031
+	call	yp_isexceptionC@PLT	#
+.LVL363:
+# Lib/munit_test/test_memory.c:283:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 283 11 discriminator 1 view .LVU1032
+	testl	%eax, %eax	# tmp281
+	je	.L167	#,
+	.loc 1 283 36 is_stmt 1 discriminator 3 view .LVU1033
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp146
+	leaq	.LC17(%rip), %rdx	#, tmp147
+	movl	$283, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp148
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL364:
+.L167:
+	.loc 1 283 190 discriminator 4 view .LVU1034
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp149
+	leaq	.LC18(%rip), %rdx	#, tmp150
+	movl	$283, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp151
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL365:
+.L166:
+	.loc 1 283 190 is_stmt 0 discriminator 4 view .LVU1035
+.LBE161:
+	.loc 1 283 65 is_stmt 1 discriminator 2 view .LVU1036
+	.loc 1 283 341 discriminator 2 view .LVU1037
+	.loc 1 283 346 discriminator 2 view .LVU1038
+# Lib/munit_test/test_memory.c:283:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 283 349 is_stmt 0 discriminator 2 view .LVU1039
+	testq	%rax, %rax	# _ypmt_TYPEC_a
+	jne	.L204	#,
+	.loc 1 283 344 is_stmt 1 discriminator 6 view .LVU1040
+.LBE160:
+	.loc 1 283 8 discriminator 6 view .LVU1041
+	.loc 1 286 5 discriminator 6 view .LVU1042
+.LBB162:
+	.loc 1 286 10 discriminator 6 view .LVU1043
+# Lib/munit_test/test_memory.c:286:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 286 20 is_stmt 0 discriminator 6 view .LVU1044
+	movq	$0, -64(%rbp)	#, MEM[(struct ypObject * *)_175]
+	.loc 1 286 6 is_stmt 1 discriminator 6 view .LVU1045
+# Lib/munit_test/test_memory.c:286:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 286 7 is_stmt 0 discriminator 6 view .LVU1046
+	leaq	-64(%rbp), %rdi	#, tmp155
+	call	yp_arena_begin@PLT	#
+.LVL366:
+	.loc 1 286 30 is_stmt 1 discriminator 6 view .LVU1047
+# Lib/munit_test/test_memory.c:286:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 286 38 is_stmt 0 discriminator 6 view .LVU1048
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175], exc.51_5
+# Lib/munit_test/test_memory.c:286:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 286 33 discriminator 6 view .LVU1049
+	testq	%rdi, %rdi	# exc.51_5
+	je	.L169	#,
+	.loc 1 286 8 is_stmt 1 discriminator 1 view .LVU1050
+# Lib/munit_test/test_memory.c:286:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 286 12 is_stmt 0 discriminator 1 view .LVU1051
+	call	yp_isexceptionC@PLT	#
+.LVL367:
+# Lib/munit_test/test_memory.c:286:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 286 11 discriminator 1 view .LVU1052
+	testl	%eax, %eax	# tmp282
+	je	.L170	#,
+	.loc 1 286 36 is_stmt 1 discriminator 2 view .LVU1053
+	leaq	.LC74(%rip), %rcx	#, tmp156
+	leaq	.LC1(%rip), %rdx	#, tmp157
+	movl	$286, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp158
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL368:
+.L204:
+	.loc 1 286 36 is_stmt 0 discriminator 2 view .LVU1054
+.LBE162:
+.LBB163:
+	.loc 1 283 387 is_stmt 1 discriminator 5 view .LVU1055
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	movq	%rax, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp152
+	leaq	.LC19(%rip), %rdx	#, tmp153
+	movl	$283, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp154
+	movl	$0, %eax	#,
+.LVL369:
+	.loc 1 283 387 is_stmt 0 discriminator 5 view .LVU1056
+	call	munit_errorf_ex@PLT	#
+.LVL370:
+.L170:
+	.loc 1 283 387 discriminator 5 view .LVU1057
+.LBE163:
+.LBB164:
+	.loc 1 286 169 is_stmt 1 discriminator 3 view .LVU1058
+	leaq	.LC74(%rip), %rcx	#, tmp159
+	leaq	.LC3(%rip), %rdx	#, tmp160
+	movl	$286, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp161
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL371:
+.L169:
+.LBE164:
+	.loc 1 286 8 view .LVU1059
+	.loc 1 287 5 view .LVU1060
+	call	_test_arena_temporaries	#
+.LVL372:
+	.loc 1 288 5 view .LVU1061
+.LBB165:
+	.loc 1 288 10 view .LVU1062
+# Lib/munit_test/test_memory.c:288:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 288 20 is_stmt 0 view .LVU1063
+	movq	$0, -64(%rbp)	#, MEM[(struct ypObject * *)_175]
+	.loc 1 288 6 is_stmt 1 view .LVU1064
+# Lib/munit_test/test_memory.c:288:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 288 7 is_stmt 0 view .LVU1065
+	leaq	-64(%rbp), %rdi	#, tmp162
+	call	yp_arena_begin@PLT	#
+.LVL373:
+	.loc 1 288 30 is_stmt 1 view .LVU1066
+# Lib/munit_test/test_memory.c:288:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 288 38 is_stmt 0 view .LVU1067
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175], exc.53_7
+# Lib/munit_test/test_memory.c:288:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 288 33 view .LVU1068
+	testq	%rdi, %rdi	# exc.53_7
+	je	.L171	#,
+	.loc 1 288 8 is_stmt 1 discriminator 1 view .LVU1069
+# Lib/munit_test/test_memory.c:288:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 288 12 is_stmt 0 discriminator 1 view .LVU1070
+	call	yp_isexceptionC@PLT	#
+.LVL374:
+# Lib/munit_test/test_memory.c:288:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 288 11 discriminator 1 view .LVU1071
+	testl	%eax, %eax	# tmp283
+	je	.L172	#,
+	.loc 1 288 36 is_stmt 1 discriminator 2 view .LVU1072
+	leaq	.LC74(%rip), %rcx	#, tmp163
+	leaq	.LC1(%rip), %rdx	#, tmp164
+	movl	$288, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp165
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL375:
+.L172:
+	.loc 1 288 169 discriminator 3 view .LVU1073
+	leaq	.LC74(%rip), %rcx	#, tmp166
+	leaq	.LC3(%rip), %rdx	#, tmp167
+	movl	$288, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp168
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL376:
+.L171:
+.LBE165:
+	.loc 1 288 8 view .LVU1074
+	.loc 1 289 5 view .LVU1075
+	call	_test_arena_temporaries	#
+.LVL377:
+	.loc 1 290 5 view .LVU1076
+.LBB166:
+	.loc 1 290 10 view .LVU1077
+	.loc 1 290 36 view .LVU1078
+	.loc 1 290 62 view .LVU1079
+.LBB167:
+	.loc 1 290 67 view .LVU1080
+# Lib/munit_test/test_memory.c:290:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 290 77 is_stmt 0 view .LVU1081
+	movq	$0, -64(%rbp)	#, MEM[(struct ypObject * *)_175]
+	.loc 1 290 6 is_stmt 1 view .LVU1082
+# Lib/munit_test/test_memory.c:290:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 290 23 is_stmt 0 view .LVU1083
+	leaq	-64(%rbp), %rdi	#, tmp169
+	call	yp_arena_end@PLT	#
+.LVL378:
+	.loc 1 290 44 is_stmt 1 view .LVU1084
+	.loc 1 290 65 view .LVU1085
+# Lib/munit_test/test_memory.c:290:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 290 73 is_stmt 0 view .LVU1086
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175], exc.55_9
+# Lib/munit_test/test_memory.c:290:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 290 68 view .LVU1087
+	testq	%rdi, %rdi	# exc.55_9
+	je	.L173	#,
+	.loc 1 290 8 is_stmt 1 discriminator 1 view .LVU1088
+# Lib/munit_test/test_memory.c:290:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 290 12 is_stmt 0 discriminator 1 view .LVU1089
+	call	yp_isexceptionC@PLT	#
+.LVL379:
+# Lib/munit_test/test_memory.c:290:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 290 11 discriminator 1 view .LVU1090
+	testl	%eax, %eax	# tmp285
+	je	.L174	#,
+	.loc 1 290 36 is_stmt 1 discriminator 3 view .LVU1091
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp170
+	leaq	.LC17(%rip), %rdx	#, tmp171
+	movl	$290, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp172
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL380:
+.L174:
+	.loc 1 290 190 discriminator 4 view .LVU1092
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp173
+	leaq	.LC18(%rip), %rdx	#, tmp174
+	movl	$290, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp175
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL381:
+.L173:
+	.loc 1 290 190 is_stmt 0 discriminator 4 view .LVU1093
+.LBE167:
+	.loc 1 290 65 is_stmt 1 discriminator 2 view .LVU1094
+	.loc 1 290 341 discriminator 2 view .LVU1095
+	.loc 1 290 346 discriminator 2 view .LVU1096
+# Lib/munit_test/test_memory.c:290:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 290 349 is_stmt 0 discriminator 2 view .LVU1097
+	testq	%rax, %rax	# _ypmt_TYPEC_a
+	jne	.L205	#,
+	.loc 1 290 344 is_stmt 1 discriminator 6 view .LVU1098
+.LBE166:
+	.loc 1 290 8 discriminator 6 view .LVU1099
+	.loc 1 291 5 discriminator 6 view .LVU1100
+.LBB168:
+	.loc 1 291 10 discriminator 6 view .LVU1101
+# Lib/munit_test/test_memory.c:291:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 291 20 is_stmt 0 discriminator 6 view .LVU1102
+	movq	$0, -64(%rbp)	#, MEM[(struct ypObject * *)_175]
+	.loc 1 291 6 is_stmt 1 discriminator 6 view .LVU1103
+# Lib/munit_test/test_memory.c:291:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 291 7 is_stmt 0 discriminator 6 view .LVU1104
+	leaq	-64(%rbp), %rdi	#, tmp179
+	call	yp_arena_begin@PLT	#
+.LVL382:
+	.loc 1 291 30 is_stmt 1 discriminator 6 view .LVU1105
+# Lib/munit_test/test_memory.c:291:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 291 38 is_stmt 0 discriminator 6 view .LVU1106
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175], exc.57_11
+# Lib/munit_test/test_memory.c:291:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 291 33 discriminator 6 view .LVU1107
+	testq	%rdi, %rdi	# exc.57_11
+	je	.L176	#,
+	.loc 1 291 8 is_stmt 1 discriminator 1 view .LVU1108
+# Lib/munit_test/test_memory.c:291:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 291 12 is_stmt 0 discriminator 1 view .LVU1109
+	call	yp_isexceptionC@PLT	#
+.LVL383:
+# Lib/munit_test/test_memory.c:291:     assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 291 11 discriminator 1 view .LVU1110
+	testl	%eax, %eax	# tmp286
+	je	.L177	#,
+	.loc 1 291 36 is_stmt 1 discriminator 2 view .LVU1111
+	leaq	.LC74(%rip), %rcx	#, tmp180
+	leaq	.LC1(%rip), %rdx	#, tmp181
+	movl	$291, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp182
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL384:
+.L205:
+	.loc 1 291 36 is_stmt 0 discriminator 2 view .LVU1112
+.LBE168:
+.LBB169:
+	.loc 1 290 387 is_stmt 1 discriminator 5 view .LVU1113
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	movq	%rax, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp176
+	leaq	.LC19(%rip), %rdx	#, tmp177
+	movl	$290, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp178
+	movl	$0, %eax	#,
+.LVL385:
+	.loc 1 290 387 is_stmt 0 discriminator 5 view .LVU1114
+	call	munit_errorf_ex@PLT	#
+.LVL386:
+.L177:
+	.loc 1 290 387 discriminator 5 view .LVU1115
+.LBE169:
+.LBB170:
+	.loc 1 291 169 is_stmt 1 discriminator 3 view .LVU1116
+	leaq	.LC74(%rip), %rcx	#, tmp183
+	leaq	.LC3(%rip), %rdx	#, tmp184
+	movl	$291, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp185
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL387:
+.L176:
+.LBE170:
+	.loc 1 291 8 view .LVU1117
+	.loc 1 292 5 view .LVU1118
+.LBB171:
+	.loc 1 292 10 view .LVU1119
+	.loc 1 292 36 view .LVU1120
+	.loc 1 292 62 view .LVU1121
+.LBB172:
+	.loc 1 292 67 view .LVU1122
+# Lib/munit_test/test_memory.c:292:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 292 77 is_stmt 0 view .LVU1123
+	movq	$0, -64(%rbp)	#, MEM[(struct ypObject * *)_175]
+	.loc 1 292 6 is_stmt 1 view .LVU1124
+# Lib/munit_test/test_memory.c:292:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 292 23 is_stmt 0 view .LVU1125
+	leaq	-64(%rbp), %rdi	#, tmp186
+	call	yp_arena_end@PLT	#
+.LVL388:
+	movq	%rax, %r9	# tmp287, _ypmt_TYPEC_a
+.LVL389:
+	.loc 1 292 44 is_stmt 1 view .LVU1126
+	.loc 1 292 65 view .LVU1127
+# Lib/munit_test/test_memory.c:292:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 292 73 is_stmt 0 view .LVU1128
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175], exc.59_13
+# Lib/munit_test/test_memory.c:292:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 292 68 view .LVU1129
+	testq	%rdi, %rdi	# exc.59_13
+	je	.L178	#,
+	.loc 1 292 8 is_stmt 1 discriminator 1 view .LVU1130
+# Lib/munit_test/test_memory.c:292:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 292 12 is_stmt 0 discriminator 1 view .LVU1131
+	call	yp_isexceptionC@PLT	#
+.LVL390:
+# Lib/munit_test/test_memory.c:292:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 292 11 discriminator 1 view .LVU1132
+	testl	%eax, %eax	# tmp288
+	je	.L179	#,
+	.loc 1 292 36 is_stmt 1 discriminator 3 view .LVU1133
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp187
+	leaq	.LC17(%rip), %rdx	#, tmp188
+	movl	$292, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp189
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL391:
+.L179:
+	.loc 1 292 190 discriminator 4 view .LVU1134
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp190
+	leaq	.LC18(%rip), %rdx	#, tmp191
+	movl	$292, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp192
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL392:
+.L178:
+	.loc 1 292 190 is_stmt 0 discriminator 4 view .LVU1135
+.LBE172:
+	.loc 1 292 65 is_stmt 1 discriminator 2 view .LVU1136
+	.loc 1 292 341 discriminator 2 view .LVU1137
+	.loc 1 292 346 discriminator 2 view .LVU1138
+# Lib/munit_test/test_memory.c:292:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 292 349 is_stmt 0 discriminator 2 view .LVU1139
+	testq	%rax, %rax	# _ypmt_TYPEC_a
+	jne	.L206	#,
+	.loc 1 292 344 is_stmt 1 discriminator 6 view .LVU1140
+.LBE171:
+	.loc 1 292 8 discriminator 6 view .LVU1141
+	.loc 1 293 5 discriminator 6 view .LVU1142
+.LBB173:
+	.loc 1 293 10 discriminator 6 view .LVU1143
+	.loc 1 293 36 discriminator 6 view .LVU1144
+	.loc 1 293 62 discriminator 6 view .LVU1145
+.LBB174:
+	.loc 1 293 67 discriminator 6 view .LVU1146
+# Lib/munit_test/test_memory.c:293:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 293 77 is_stmt 0 discriminator 6 view .LVU1147
+	movq	$0, -64(%rbp)	#, MEM[(struct ypObject * *)_175]
+	.loc 1 293 6 is_stmt 1 discriminator 6 view .LVU1148
+# Lib/munit_test/test_memory.c:293:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 293 23 is_stmt 0 discriminator 6 view .LVU1149
+	leaq	-64(%rbp), %rdi	#, tmp196
+	call	yp_arena_end@PLT	#
+.LVL393:
+	.loc 1 293 23 discriminator 6 view .LVU1150
+	movq	%rax, %rbx	# tmp289, _ypmt_TYPEC_a
+.LVL394:
+	.loc 1 293 44 is_stmt 1 discriminator 6 view .LVU1151
+	.loc 1 293 65 discriminator 6 view .LVU1152
+# Lib/munit_test/test_memory.c:293:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 293 73 is_stmt 0 discriminator 6 view .LVU1153
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175], exc.61_15
+# Lib/munit_test/test_memory.c:293:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 293 68 discriminator 6 view .LVU1154
+	testq	%rdi, %rdi	# exc.61_15
+	je	.L181	#,
+	.loc 1 293 8 is_stmt 1 discriminator 1 view .LVU1155
+# Lib/munit_test/test_memory.c:293:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 293 12 is_stmt 0 discriminator 1 view .LVU1156
+	call	yp_isexceptionC@PLT	#
+.LVL395:
+# Lib/munit_test/test_memory.c:293:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 293 11 discriminator 1 view .LVU1157
+	testl	%eax, %eax	# tmp290
+	je	.L182	#,
+	.loc 1 293 36 is_stmt 1 discriminator 3 view .LVU1158
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp197
+	leaq	.LC17(%rip), %rdx	#, tmp198
+	movl	$293, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp199
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL396:
+.L206:
+	.loc 1 293 36 is_stmt 0 discriminator 3 view .LVU1159
+.LBE174:
+.LBE173:
+.LBB176:
+	.loc 1 292 387 is_stmt 1 discriminator 5 view .LVU1160
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp193
+	leaq	.LC19(%rip), %rdx	#, tmp194
+	movl	$292, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp195
+	movl	$0, %eax	#,
+.LVL397:
+	.loc 1 292 387 is_stmt 0 discriminator 5 view .LVU1161
+	call	munit_errorf_ex@PLT	#
+.LVL398:
+.L182:
+	.loc 1 292 387 discriminator 5 view .LVU1162
+.LBE176:
+.LBB177:
+.LBB175:
+	.loc 1 293 190 is_stmt 1 discriminator 4 view .LVU1163
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp200
+	leaq	.LC18(%rip), %rdx	#, tmp201
+	movl	$293, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp202
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL399:
+.L181:
+	.loc 1 293 190 is_stmt 0 discriminator 4 view .LVU1164
+.LBE175:
+	.loc 1 293 65 is_stmt 1 discriminator 2 view .LVU1165
+	.loc 1 293 341 discriminator 2 view .LVU1166
+	.loc 1 293 346 discriminator 2 view .LVU1167
+# Lib/munit_test/test_memory.c:293:     assert_ssizeC_exc(yp_arena_end(&exc), ==, 0);
+	.loc 1 293 349 is_stmt 0 discriminator 2 view .LVU1168
+	testq	%rax, %rax	# _ypmt_TYPEC_a
+	jne	.L207	#,
+	.loc 1 293 344 is_stmt 1 discriminator 6 view .LVU1169
+.LBE177:
+	.loc 1 293 8 discriminator 6 view .LVU1170
+.LBB178:
+	.loc 1 297 9 discriminator 6 view .LVU1171
+	.loc 1 298 9 discriminator 6 view .LVU1172
+.LBB179:
+	.loc 1 298 14 discriminator 6 view .LVU1173
+# Lib/munit_test/test_memory.c:298:         assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 298 24 is_stmt 0 discriminator 6 view .LVU1174
+	movq	$0, -64(%rbp)	#, MEM[(struct ypObject * *)_175]
+	.loc 1 298 10 is_stmt 1 discriminator 6 view .LVU1175
+# Lib/munit_test/test_memory.c:298:         assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 298 11 is_stmt 0 discriminator 6 view .LVU1176
+	leaq	-64(%rbp), %rdi	#, tmp206
+	call	yp_arena_begin@PLT	#
+.LVL400:
+	.loc 1 298 34 is_stmt 1 discriminator 6 view .LVU1177
+# Lib/munit_test/test_memory.c:298:         assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 298 42 is_stmt 0 discriminator 6 view .LVU1178
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175], exc.63_17
+# Lib/munit_test/test_memory.c:298:         assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 298 37 discriminator 6 view .LVU1179
+	testq	%rdi, %rdi	# exc.63_17
+	je	.L184	#,
+	.loc 1 298 12 is_stmt 1 discriminator 1 view .LVU1180
+# Lib/munit_test/test_memory.c:298:         assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 298 16 is_stmt 0 discriminator 1 view .LVU1181
+	call	yp_isexceptionC@PLT	#
+.LVL401:
+# Lib/munit_test/test_memory.c:298:         assert_not_raises_exc(yp_arena_begin(&exc));
+	.loc 1 298 15 discriminator 1 view .LVU1182
+	testl	%eax, %eax	# tmp291
+	je	.L185	#,
+	.loc 1 298 40 is_stmt 1 discriminator 2 view .LVU1183
+	leaq	.LC74(%rip), %rcx	#, tmp207
+	leaq	.LC1(%rip), %rdx	#, tmp208
+	movl	$298, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp209
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL402:
+.L207:
+	.loc 1 298 40 is_stmt 0 discriminator 2 view .LVU1184
+.LBE179:
+.LBE178:
+.LBB197:
+	.loc 1 293 387 is_stmt 1 discriminator 5 view .LVU1185
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	movq	%rax, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC4(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp203
+	leaq	.LC19(%rip), %rdx	#, tmp204
+	movl	$293, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp205
+	movl	$0, %eax	#,
+.LVL403:
+	.loc 1 293 387 is_stmt 0 discriminator 5 view .LVU1186
+	call	munit_errorf_ex@PLT	#
+.LVL404:
+.L185:
+	.loc 1 293 387 discriminator 5 view .LVU1187
+.LBE197:
+.LBB198:
+.LBB180:
+	.loc 1 298 173 is_stmt 1 discriminator 3 view .LVU1188
+	leaq	.LC74(%rip), %rcx	#, tmp210
+	leaq	.LC3(%rip), %rdx	#, tmp211
+	movl	$298, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp212
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL405:
+.L184:
+.LBE180:
+	.loc 1 298 12 view .LVU1189
+	.loc 1 299 9 view .LVU1190
+# Lib/munit_test/test_memory.c:299:         list = yp_listN(N(yp_i_one));
+	.loc 1 299 16 is_stmt 0 view .LVU1191
+	movq	yp_i_one(%rip), %r13	# yp_i_one, yp_i_one.65_19
+	movq	%r13, %rsi	# yp_i_one.65_19,
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_listN@PLT	#
+.LVL406:
+	movq	%rax, %r12	# tmp292, list
+.LVL407:
+	.loc 1 300 9 is_stmt 1 view .LVU1192
+	call	_test_arena_temporaries	#
+.LVL408:
+	.loc 1 302 9 view .LVU1193
+.LBB181:
+	.loc 1 302 14 view .LVU1194
+	.loc 1 302 40 view .LVU1195
+	.loc 1 302 66 view .LVU1196
+.LBB182:
+	.loc 1 302 71 view .LVU1197
+# Lib/munit_test/test_memory.c:302:         assert_ssizeC_exc(yp_arena_end(&exc), ==, 1);
+	.loc 1 302 81 is_stmt 0 view .LVU1198
+	movq	$0, -64(%rbp)	#, MEM[(struct ypObject * *)_175]
+	.loc 1 302 10 is_stmt 1 view .LVU1199
+# Lib/munit_test/test_memory.c:302:         assert_ssizeC_exc(yp_arena_end(&exc), ==, 1);
+	.loc 1 302 27 is_stmt 0 view .LVU1200
+	leaq	-64(%rbp), %rdi	#, tmp213
+	call	yp_arena_end@PLT	#
+.LVL409:
+	movq	%rax, %r9	# tmp293, _ypmt_TYPEC_a
+.LVL410:
+	.loc 1 302 48 is_stmt 1 view .LVU1201
+	.loc 1 302 69 view .LVU1202
+# Lib/munit_test/test_memory.c:302:         assert_ssizeC_exc(yp_arena_end(&exc), ==, 1);
+	.loc 1 302 77 is_stmt 0 view .LVU1203
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175], exc.66_20
+# Lib/munit_test/test_memory.c:302:         assert_ssizeC_exc(yp_arena_end(&exc), ==, 1);
+	.loc 1 302 72 view .LVU1204
+	testq	%rdi, %rdi	# exc.66_20
+	je	.L186	#,
+	.loc 1 302 12 is_stmt 1 discriminator 1 view .LVU1205
+# Lib/munit_test/test_memory.c:302:         assert_ssizeC_exc(yp_arena_end(&exc), ==, 1);
+	.loc 1 302 16 is_stmt 0 discriminator 1 view .LVU1206
+	call	yp_isexceptionC@PLT	#
+.LVL411:
+# Lib/munit_test/test_memory.c:302:         assert_ssizeC_exc(yp_arena_end(&exc), ==, 1);
+	.loc 1 302 15 discriminator 1 view .LVU1207
+	testl	%eax, %eax	# tmp294
+	je	.L187	#,
+	.loc 1 302 40 is_stmt 1 discriminator 3 view .LVU1208
+	leaq	.LC15(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp214
+	leaq	.LC17(%rip), %rdx	#, tmp215
+	movl	$302, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp216
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL412:
+.L187:
+	.loc 1 302 194 discriminator 4 view .LVU1209
+	leaq	.LC15(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp217
+	leaq	.LC18(%rip), %rdx	#, tmp218
+	movl	$302, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp219
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL413:
+.L186:
+	.loc 1 302 194 is_stmt 0 discriminator 4 view .LVU1210
+.LBE182:
+	.loc 1 302 69 is_stmt 1 discriminator 2 view .LVU1211
+	.loc 1 302 345 discriminator 2 view .LVU1212
+	.loc 1 302 350 discriminator 2 view .LVU1213
+# Lib/munit_test/test_memory.c:302:         assert_ssizeC_exc(yp_arena_end(&exc), ==, 1);
+	.loc 1 302 353 is_stmt 0 discriminator 2 view .LVU1214
+	cmpq	$1, %rax	#, _ypmt_TYPEC_a
+	jne	.L208	#,
+	.loc 1 302 348 is_stmt 1 discriminator 6 view .LVU1215
+.LBE181:
+	.loc 1 302 12 discriminator 6 view .LVU1216
+	.loc 1 306 9 discriminator 6 view .LVU1217
+	call	_test_arena_temporaries	#
+.LVL414:
+	.loc 1 307 9 discriminator 6 view .LVU1218
+.LBB183:
+	.loc 1 307 14 discriminator 6 view .LVU1219
+# Lib/munit_test/test_memory.c:307:         assert_not_raises_exc(yp_append(list, yp_i_two, &exc));
+	.loc 1 307 24 is_stmt 0 discriminator 6 view .LVU1220
+	movq	$0, -64(%rbp)	#, MEM[(struct ypObject * *)_175]
+	.loc 1 307 10 is_stmt 1 discriminator 6 view .LVU1221
+# Lib/munit_test/test_memory.c:307:         assert_not_raises_exc(yp_append(list, yp_i_two, &exc));
+	.loc 1 307 11 is_stmt 0 discriminator 6 view .LVU1222
+	movq	yp_i_two(%rip), %r14	# yp_i_two, yp_i_two.68_22
+	leaq	-64(%rbp), %rdx	#, tmp223
+	movq	%r14, %rsi	# yp_i_two.68_22,
+	movq	%r12, %rdi	# list,
+	call	yp_append@PLT	#
+.LVL415:
+	.loc 1 307 45 is_stmt 1 discriminator 6 view .LVU1223
+# Lib/munit_test/test_memory.c:307:         assert_not_raises_exc(yp_append(list, yp_i_two, &exc));
+	.loc 1 307 53 is_stmt 0 discriminator 6 view .LVU1224
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175], exc.69_23
+# Lib/munit_test/test_memory.c:307:         assert_not_raises_exc(yp_append(list, yp_i_two, &exc));
+	.loc 1 307 48 discriminator 6 view .LVU1225
+	testq	%rdi, %rdi	# exc.69_23
+	je	.L189	#,
+	.loc 1 307 12 is_stmt 1 discriminator 1 view .LVU1226
+# Lib/munit_test/test_memory.c:307:         assert_not_raises_exc(yp_append(list, yp_i_two, &exc));
+	.loc 1 307 16 is_stmt 0 discriminator 1 view .LVU1227
+	call	yp_isexceptionC@PLT	#
+.LVL416:
+# Lib/munit_test/test_memory.c:307:         assert_not_raises_exc(yp_append(list, yp_i_two, &exc));
+	.loc 1 307 15 discriminator 1 view .LVU1228
+	testl	%eax, %eax	# tmp295
+	je	.L190	#,
+	.loc 1 307 40 is_stmt 1 discriminator 2 view .LVU1229
+	leaq	.LC76(%rip), %rcx	#, tmp224
+	leaq	.LC1(%rip), %rdx	#, tmp225
+	movl	$307, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp226
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL417:
+.L208:
+	.loc 1 307 40 is_stmt 0 discriminator 2 view .LVU1230
+.LBE183:
+.LBB184:
+	.loc 1 302 391 is_stmt 1 discriminator 5 view .LVU1231
+	subq	$8, %rsp	#,
+	pushq	$1	#
+	leaq	.LC15(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp220
+	leaq	.LC19(%rip), %rdx	#, tmp221
+	movl	$302, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp222
+	movl	$0, %eax	#,
+.LVL418:
+	.loc 1 302 391 is_stmt 0 discriminator 5 view .LVU1232
+	call	munit_errorf_ex@PLT	#
+.LVL419:
+.L190:
+	.loc 1 302 391 discriminator 5 view .LVU1233
+.LBE184:
+.LBB185:
+	.loc 1 307 184 is_stmt 1 discriminator 3 view .LVU1234
+	leaq	.LC76(%rip), %rcx	#, tmp227
+	leaq	.LC3(%rip), %rdx	#, tmp228
+	movl	$307, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp229
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL420:
+.L189:
+.LBE185:
+	.loc 1 307 12 view .LVU1235
+	.loc 1 308 9 view .LVU1236
+.LBB186:
+	.loc 1 308 14 view .LVU1237
+	.loc 1 308 48 view .LVU1238
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 58 is_stmt 0 view .LVU1239
+	movq	%r13, -80(%rbp)	# yp_i_one.65_19, MEM[(struct ypObject *[2] *)_174][0]
+	movq	%r14, -72(%rbp)	# yp_i_two.68_22, MEM[(struct ypObject *[2] *)_174][1]
+	.loc 1 308 100 is_stmt 1 view .LVU1240
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 106 is_stmt 0 view .LVU1241
+	leaq	.LC77(%rip), %rax	#, tmp309
+	movq	%rax, -64(%rbp)	# tmp309, MEM[(char *[2] *)_175][0]
+	leaq	.LC78(%rip), %rax	#, tmp310
+	movq	%rax, -56(%rbp)	# tmp310, MEM[(char *[2] *)_175][1]
+	.loc 1 308 156 is_stmt 1 view .LVU1242
+.LBB187:
+	.loc 1 308 161 view .LVU1243
+.LVL421:
+	.loc 1 308 272 view .LVU1244
+	.loc 1 308 296 view .LVU1245
+.LBB188:
+	.loc 1 308 301 view .LVU1246
+	.loc 1 308 330 view .LVU1247
+.LBB189:
+	.loc 1 308 335 view .LVU1248
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 345 is_stmt 0 view .LVU1249
+	movq	$0, -88(%rbp)	#, exc
+	.loc 1 308 10 is_stmt 1 view .LVU1250
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 29 is_stmt 0 view .LVU1251
+	leaq	-88(%rbp), %rsi	#, tmp232
+	movq	%r12, %rdi	# list,
+	call	yp_lenC@PLT	#
+.LVL422:
+	movq	%rax, %r9	# tmp296, _ypmt_LEN_actual
+.LVL423:
+	.loc 1 308 59 is_stmt 1 view .LVU1252
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 67 is_stmt 0 view .LVU1253
+	movq	-88(%rbp), %rdi	# exc, exc.73_25
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 62 view .LVU1254
+	testq	%rdi, %rdi	# exc.73_25
+	je	.L191	#,
+	.loc 1 308 12 is_stmt 1 discriminator 1 view .LVU1255
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 16 is_stmt 0 discriminator 1 view .LVU1256
+	call	yp_isexceptionC@PLT	#
+.LVL424:
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 15 discriminator 1 view .LVU1257
+	testl	%eax, %eax	# tmp297
+	je	.L192	#,
+	.loc 1 308 40 is_stmt 1 discriminator 3 view .LVU1258
+	movl	$2, %r8d	#,
+	leaq	.LC25(%rip), %rcx	#, tmp233
+	leaq	.LC26(%rip), %rdx	#, tmp234
+	movl	$308, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp235
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL425:
+.L192:
+	.loc 1 308 59 discriminator 4 view .LVU1259
+	movl	$2, %r8d	#,
+	leaq	.LC25(%rip), %rcx	#, tmp236
+	leaq	.LC27(%rip), %rdx	#, tmp237
+	movl	$308, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp238
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL426:
+.L191:
+	.loc 1 308 59 is_stmt 0 discriminator 4 view .LVU1260
+.LBE189:
+	.loc 1 308 333 is_stmt 1 discriminator 2 view .LVU1261
+	.loc 1 308 47 discriminator 2 view .LVU1262
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 50 is_stmt 0 discriminator 2 view .LVU1263
+	cmpq	$2, %rax	#, _ypmt_LEN_actual
+	jne	.L209	#,
+.LVL427:
+.L193:
+	.loc 1 308 50 discriminator 2 view .LVU1264
+.LBE188:
+	.loc 1 308 115 is_stmt 1 discriminator 18 view .LVU1265
+	cmpq	$1, %rbx	#, _ypmt_TYPEC_a
+	jg	.L210	#,
+.LBB190:
+	.loc 1 308 147 discriminator 19 view .LVU1266
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 176 is_stmt 0 discriminator 19 view .LVU1267
+	movq	%rbx, %rsi	# _ypmt_TYPEC_a,
+	movq	%r12, %rdi	# list,
+	call	yp_getindexC@PLT	#
+.LVL428:
+	movq	%rax, %r13	# tmp298, _ypmt_SEQ_actual
+.LVL429:
+	.loc 1 308 218 is_stmt 1 discriminator 19 view .LVU1268
+	.loc 1 308 223 discriminator 19 view .LVU1269
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 227 is_stmt 0 discriminator 19 view .LVU1270
+	movq	%rax, %rdi	# _ypmt_SEQ_actual,
+	call	yp_isexceptionC@PLT	#
+.LVL430:
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 226 discriminator 19 view .LVU1271
+	testl	%eax, %eax	# tmp299
+	jne	.L211	#,
+	.loc 1 308 221 is_stmt 1 discriminator 9 view .LVU1272
+	.loc 1 308 54 discriminator 9 view .LVU1273
+	.loc 1 308 59 discriminator 9 view .LVU1274
+.LBB191:
+	.loc 1 308 64 discriminator 9 view .LVU1275
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 93 is_stmt 0 discriminator 9 view .LVU1276
+	movq	-80(%rbp,%rbx,8), %r14	# MEM[(struct ypObject *[2] *)_174][_ypmt_SEQ_i_42], _28
+	movq	%r14, %rsi	# _28,
+	movq	%r13, %rdi	# _ypmt_SEQ_actual,
+	call	yp_eq@PLT	#
+.LVL431:
+	movq	%rax, %rdi	# tmp300, _ypmt_OBJ_result
+.LVL432:
+	.loc 1 308 148 is_stmt 1 discriminator 9 view .LVU1277
+	.loc 1 308 153 discriminator 9 view .LVU1278
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 156 is_stmt 0 discriminator 9 view .LVU1279
+	cmpq	%rax, yp_True(%rip)	# _ypmt_OBJ_result, yp_True
+	jne	.L212	#,
+	.loc 1 308 188 is_stmt 1 view .LVU1280
+	.loc 1 308 112 view .LVU1281
+	.loc 1 308 151 view .LVU1282
+.LBE191:
+	.loc 1 308 62 view .LVU1283
+	.loc 1 308 124 view .LVU1284
+.LBB192:
+	.loc 1 308 129 view .LVU1285
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 159 is_stmt 0 view .LVU1286
+	movq	%r13, %rdi	# _ypmt_SEQ_actual,
+	call	yp_type@PLT	#
+.LVL433:
+	.loc 1 308 159 view .LVU1287
+	movq	%rax, %r15	# tmp302, _ypmt_TYPE_type_a
+.LVL434:
+	.loc 1 308 186 is_stmt 1 view .LVU1288
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 216 is_stmt 0 view .LVU1289
+	movq	%r14, %rdi	# _28,
+	call	yp_type@PLT	#
+.LVL435:
+	.loc 1 308 255 is_stmt 1 view .LVU1290
+	.loc 1 308 260 view .LVU1291
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 263 is_stmt 0 view .LVU1292
+	cmpq	%rax, %r15	# _ypmt_TYPE_type_b, _ypmt_TYPE_type_a
+	jne	.L213	#,
+	.loc 1 308 258 is_stmt 1 discriminator 17 view .LVU1293
+.LBE192:
+	.loc 1 308 127 discriminator 17 view .LVU1294
+	.loc 1 308 57 discriminator 17 view .LVU1295
+	.loc 1 308 218 discriminator 17 view .LVU1296
+	movq	%r13, %rdi	# _ypmt_SEQ_actual,
+	call	yp_decref@PLT	#
+.LVL436:
+	.loc 1 308 218 is_stmt 0 discriminator 17 view .LVU1297
+.LBE190:
+	.loc 1 308 141 is_stmt 1 discriminator 17 view .LVU1298
+	movl	$1, %esi	#,
+	movq	%rbx, %rdi	# _ypmt_TYPEC_a,
+	call	__addvdi3@PLT	#
+.LVL437:
+	movq	%rax, %rbx	# tmp304, _ypmt_TYPEC_a
+.LVL438:
+	.loc 1 308 141 is_stmt 0 discriminator 17 view .LVU1299
+	jmp	.L193	#
+.LVL439:
+.L209:
+.LBB195:
+	.loc 1 308 86 is_stmt 1 discriminator 5 view .LVU1300
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	movl	$2, %r8d	#,
+	leaq	.LC25(%rip), %rcx	#, tmp239
+	leaq	.LC28(%rip), %rdx	#, tmp240
+	movl	$308, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp241
+	movl	$0, %eax	#,
+.LVL440:
+	.loc 1 308 86 is_stmt 0 discriminator 5 view .LVU1301
+	call	munit_errorf_ex@PLT	#
+.LVL441:
+.L211:
+	.loc 1 308 86 discriminator 5 view .LVU1302
+.LBE195:
+.LBB196:
+	.loc 1 308 264 is_stmt 1 discriminator 8 view .LVU1303
+	movq	%rbx, %r8	# _ypmt_TYPEC_a,
+	leaq	.LC25(%rip), %rcx	#, tmp242
+	leaq	.LC29(%rip), %rdx	#, tmp243
+	movl	$308, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp244
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL442:
+.L212:
+.LBB193:
+	.loc 1 308 195 discriminator 11 view .LVU1304
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 198 is_stmt 0 discriminator 11 view .LVU1305
+	cmpq	%rax, yp_False(%rip)	# _ypmt_OBJ_result, yp_False
+	je	.L214	#,
+	.loc 1 308 109 is_stmt 1 discriminator 13 view .LVU1306
+	.loc 1 308 114 discriminator 13 view .LVU1307
+	.loc 1 308 119 discriminator 13 view .LVU1308
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 123 is_stmt 0 discriminator 13 view .LVU1309
+	call	yp_isexceptionC@PLT	#
+.LVL443:
+# Lib/munit_test/test_memory.c:308:         assert_sequence(list, yp_i_one, yp_i_two);
+	.loc 1 308 122 discriminator 13 view .LVU1310
+	testl	%eax, %eax	# tmp301
+	je	.L197	#,
+	.loc 1 308 160 is_stmt 1 discriminator 14 view .LVU1311
+	movq	-64(%rbp,%rbx,8), %r9	# MEM[(char *[2] *)_175][_ypmt_SEQ_i_42],
+	movq	%rbx, %r8	# _ypmt_TYPEC_a,
+	leaq	.LC25(%rip), %rcx	#, tmp250
+	leaq	.LC31(%rip), %rdx	#, tmp251
+	movl	$308, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp252
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL444:
+.L214:
+	.loc 1 308 231 discriminator 12 view .LVU1312
+	movq	-64(%rbp,%rbx,8), %r9	# MEM[(char *[2] *)_175][_ypmt_SEQ_i_42],
+	movq	%rbx, %r8	# _ypmt_TYPEC_a,
+	leaq	.LC25(%rip), %rcx	#, tmp246
+	leaq	.LC30(%rip), %rdx	#, tmp247
+	movl	$308, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp248
+	movl	$0, %eax	#,
+.LVL445:
+	.loc 1 308 231 is_stmt 0 discriminator 12 view .LVU1313
+	call	munit_errorf_ex@PLT	#
+.LVL446:
+.L197:
+	.loc 1 308 117 is_stmt 1 discriminator 15 view .LVU1314
+	.loc 1 308 102 discriminator 15 view .LVU1315
+	movq	-64(%rbp,%rbx,8), %r9	# MEM[(char *[2] *)_175][_ypmt_SEQ_i_42],
+	movq	%rbx, %r8	# _ypmt_TYPEC_a,
+	leaq	.LC25(%rip), %rcx	#, tmp254
+	leaq	.LC32(%rip), %rdx	#, tmp255
+	movl	$308, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp256
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL447:
+.L213:
+	.loc 1 308 102 is_stmt 0 discriminator 15 view .LVU1316
+.LBE193:
+.LBB194:
+	.loc 1 308 309 is_stmt 1 discriminator 16 view .LVU1317
+	pushq	%rax	# _ypmt_TYPE_type_b
+	pushq	%r15	# _ypmt_TYPE_type_a
+	movq	-64(%rbp,%rbx,8), %r9	# MEM[(char *[2] *)_175][_ypmt_SEQ_i_42],
+	movq	%rbx, %r8	# _ypmt_TYPEC_a,
+	leaq	.LC25(%rip), %rcx	#, tmp258
+	leaq	.LC33(%rip), %rdx	#, tmp259
+	movl	$308, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp260
+	movl	$0, %eax	#,
+.LVL448:
+	.loc 1 308 309 is_stmt 0 discriminator 16 view .LVU1318
+	call	munit_errorf_ex@PLT	#
+.LVL449:
+.L210:
+	.loc 1 308 309 discriminator 16 view .LVU1319
+.LBE194:
+.LBE196:
+.LBE187:
+	.loc 1 308 159 is_stmt 1 discriminator 20 view .LVU1320
+.LBE186:
+	.loc 1 308 12 discriminator 20 view .LVU1321
+	.loc 1 309 9 discriminator 20 view .LVU1322
+	movq	%r12, %rdi	# list,
+	call	yp_decref@PLT	#
+.LVL450:
+.LBE198:
+	.loc 1 313 5 discriminator 20 view .LVU1323
+.LBB199:
+	.loc 1 313 10 discriminator 20 view .LVU1324
+# Lib/munit_test/test_memory.c:313:     assert_ssizeC_raises_exc(yp_arena_end(&exc), ==, -1, yp_RuntimeError);
+	.loc 1 313 20 is_stmt 0 discriminator 20 view .LVU1325
+	movq	yp_RuntimeError(%rip), %rax	# yp_RuntimeError, yp_RuntimeError
+	movq	%rax, -80(%rbp)	# yp_RuntimeError, MEM[(struct ypObject *[1] *)_174][0]
+	.loc 1 313 60 is_stmt 1 discriminator 20 view .LVU1326
+.LVL451:
+	.loc 1 313 175 discriminator 20 view .LVU1327
+	.loc 1 313 201 discriminator 20 view .LVU1328
+	.loc 1 313 227 discriminator 20 view .LVU1329
+.LBB200:
+	.loc 1 313 232 discriminator 20 view .LVU1330
+# Lib/munit_test/test_memory.c:313:     assert_ssizeC_raises_exc(yp_arena_end(&exc), ==, -1, yp_RuntimeError);
+	.loc 1 313 242 is_stmt 0 discriminator 20 view .LVU1331
+	movq	yp_None(%rip), %rax	# yp_None, yp_None
+	movq	%rax, -64(%rbp)	# yp_None, MEM[(struct ypObject * *)_175]
+	.loc 1 313 257 is_stmt 1 discriminator 20 view .LVU1332
+	.loc 1 313 387 discriminator 20 view .LVU1333
+# Lib/munit_test/test_memory.c:313:     assert_ssizeC_raises_exc(yp_arena_end(&exc), ==, -1, yp_RuntimeError);
+	.loc 1 313 404 is_stmt 0 discriminator 20 view .LVU1334
+	leaq	-64(%rbp), %rdi	#, tmp264
+	call	yp_arena_end@PLT	#
+.LVL452:
+	movq	%rax, %rbx	# tmp305, _ypmt_TYPEC_a
+.LVL453:
+	.loc 1 313 425 is_stmt 1 discriminator 20 view .LVU1335
+# Lib/munit_test/test_memory.c:313:     assert_ssizeC_raises_exc(yp_arena_end(&exc), ==, -1, yp_RuntimeError);
+	.loc 1 313 430 is_stmt 0 discriminator 20 view .LVU1336
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175],
+	call	yp_isexceptionC@PLT	#
+.LVL454:
+# Lib/munit_test/test_memory.c:313:     assert_ssizeC_raises_exc(yp_arena_end(&exc), ==, -1, yp_RuntimeError);
+	.loc 1 313 428 discriminator 20 view .LVU1337
+	testl	%eax, %eax	# tmp306
+	je	.L215	#,
+	.loc 1 313 623 is_stmt 1 discriminator 4 view .LVU1338
+# Lib/munit_test/test_memory.c:313:     assert_ssizeC_raises_exc(yp_arena_end(&exc), ==, -1, yp_RuntimeError);
+	.loc 1 313 628 is_stmt 0 discriminator 4 view .LVU1339
+	leaq	-80(%rbp), %rdx	#, tmp269
+	movl	$1, %esi	#,
+	movq	-64(%rbp), %rdi	# MEM[(struct ypObject * *)_175],
+	call	yp_isexception_arrayC@PLT	#
+.LVL455:
+# Lib/munit_test/test_memory.c:313:     assert_ssizeC_raises_exc(yp_arena_end(&exc), ==, -1, yp_RuntimeError);
+	.loc 1 313 626 discriminator 4 view .LVU1340
+	testl	%eax, %eax	# tmp307
+	je	.L216	#,
+.LBE200:
+	.loc 1 313 230 is_stmt 1 discriminator 6 view .LVU1341
+	.loc 1 313 867 discriminator 6 view .LVU1342
+.LBE199:
+	.loc 1 313 872 discriminator 6 view .LVU1343
+.LVL456:
+	.loc 1 313 6 discriminator 6 view .LVU1344
+	.loc 1 313 28 discriminator 6 view .LVU1345
+.LBB202:
+	.loc 1 313 870 discriminator 6 view .LVU1346
+	.loc 1 313 263 discriminator 6 view .LVU1347
+	.loc 1 313 268 discriminator 6 view .LVU1348
+# Lib/munit_test/test_memory.c:313:     assert_ssizeC_raises_exc(yp_arena_end(&exc), ==, -1, yp_RuntimeError);
+	.loc 1 313 271 is_stmt 0 discriminator 6 view .LVU1349
+	cmpq	$-1, %rbx	#, _ypmt_TYPEC_a
+	jne	.L217	#,
+	.loc 1 313 266 is_stmt 1 discriminator 12 view .LVU1350
+.LBE202:
+	.loc 1 313 8 discriminator 12 view .LVU1351
+	.loc 1 315 5 discriminator 12 view .LVU1352
+# Lib/munit_test/test_memory.c:316: }
+	.loc 1 316 1 is_stmt 0 discriminator 12 view .LVU1353
+	movl	$0, %eax	#,
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+.LVL457:
+	.loc 1 316 1 discriminator 12 view .LVU1354
+	popq	%r12	#
+.LVL458:
+	.loc 1 316 1 discriminator 12 view .LVU1355
+	popq	%r13	#
+	popq	%r14	#
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL459:
+.L215:
+	.cfi_restore_state
+.LBB203:
+.LBB201:
+	.loc 1 313 454 is_stmt 1 discriminator 3 view .LVU1356
+	leaq	.LC79(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp266
+	leaq	.LC45(%rip), %rdx	#, tmp267
+	movl	$313, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp268
+	call	munit_errorf_ex@PLT	#
+.LVL460:
+.L216:
+	.loc 1 313 691 discriminator 5 view .LVU1357
+	leaq	.LC79(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp271
+	leaq	.LC46(%rip), %rdx	#, tmp272
+	movl	$313, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp273
+	call	munit_errorf_ex@PLT	#
+.LVL461:
+.L217:
+	.loc 1 313 691 is_stmt 0 discriminator 5 view .LVU1358
+.LBE201:
+	.loc 1 313 309 is_stmt 1 discriminator 11 view .LVU1359
+	subq	$8, %rsp	#,
+	pushq	$-1	#
+	movq	%rbx, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC47(%rip), %r8	#,
+	leaq	.LC75(%rip), %rcx	#, tmp275
+	leaq	.LC19(%rip), %rdx	#, tmp276
+	movl	$313, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp277
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL462:
+.LBE203:
+	.cfi_endproc
+.LFE35:
+	.size	test_arena, .-test_arena
+	.type	_test_freelists_thread_exit_fill, @function
+_test_freelists_thread_exit_fill:
+.LVL463:
+.LFB32:
+	.loc 1 240 1 view -0
+	.cfi_startproc
+	.loc 1 240 1 is_stmt 0 view .LVU1361
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$8, %rsp	#,
+	.cfi_offset 13, -24
+	.cfi_offset 12, -32
+	.cfi_offset 3, -40
+	.loc 1 241 5 is_stmt 1 view .LVU1362
+# Lib/munit_test/test_memory.c:241:     ypObject *tuple = yp_tupleN(N(yp_None, yp_None));
+	.loc 1 241 23 is_stmt 0 view .LVU1363
+	movq	yp_None(%rip), %rsi	# yp_None, yp_None.97_1
+	movq	%rsi, %rdx	# yp_None.97_1,
+	movl	$2, %edi	#,
+.LVL464:
+	.loc 1 241 23 view .LVU1364
+	movl	$0, %eax	#,
+	call	yp_tupleN@PLT	#
+.LVL465:
+	movq	%rax, %rbx	# tmp91, tuple
+.LVL466:
+	.loc 1 242 5 is_stmt 1 view .LVU1365
+	movq	%rax, %rdi	# tuple,
+	call	yp_iter@PLT	#
+.LVL467:
+	.loc 1 242 5 is_stmt 0 view .LVU1366
+	movq	%rax, %r13	# tmp92, _2
+	movsd	.LC80(%rip), %xmm0	#,
+	call	yp_floatCF@PLT	#
+.LVL468:
+	movq	%rax, %r12	# tmp93, _3
+	movl	$1000, %edi	#,
+	call	yp_intC@PLT	#
+.LVL469:
+	movq	%rax, %rsi	# tmp94, _4
+	movq	%rbx, %r8	# tuple,
+	movq	%r13, %rcx	# _2,
+	movq	%r12, %rdx	# _3,
+	movl	$4, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_decrefN@PLT	#
+.LVL470:
+	.loc 1 243 5 is_stmt 1 view .LVU1367
+# Lib/munit_test/test_memory.c:244: }
+	.loc 1 244 1 is_stmt 0 view .LVU1368
+	movl	$0, %eax	#,
+	addq	$8, %rsp	#,
+	popq	%rbx	#
+.LVL471:
+	.loc 1 244 1 view .LVU1369
+	popq	%r12	#
+	popq	%r13	#
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE32:
+	.size	_test_freelists_thread_exit_fill, .-_test_freelists_thread_exit_fill
+	.section	.rodata.str1.1
+.LC81:
+	.string	"yp_hashC(x, &exc)"
+.LC82:
+	.string	"x"
+	.section	.rodata.str1.8
+	.align 8
+.LC83:
+	.string	"assertion failed: !yp_isexceptionC(%s)"
+	.section	.rodata.str1.1
+.LC84:
+	.string	"yp_t_intstore"
+	.section	.rodata.str1.8
+	.align 8
+.LC85:
+	.string	"assertion failed: yp_type(%s) == %s (%p == %p) "
+	.section	.rodata.str1.1
+.LC86:
+	.string	"yp_TypeError"
+.LC87:
+	.string	"yp_t_int"
+.LC88:
+	.string	"3000"
+.LC89:
+	.string	"yp_asintC(x, &exc)"
+	.section	.rodata.str1.8
+	.align 8
+.LC90:
+	.string	"assertion failed: %s == %s (%lld == %lld) "
+	.section	.rodata.str1.1
+.LC92:
+	.string	"yp_t_floatstore"
+.LC94:
+	.string	"yp_t_float"
+	.section	.rodata.str1.8
+	.align 8
+.LC95:
+	.string	"assertion failed: yp_eq(%s, %s) == yp_True"
+	.align 8
+.LC96:
+	.string	"assertion failed: !yp_isexceptionC(yp_eq(%s, %s))"
+	.align 8
+.LC97:
+	.string	"expected a bool or an exception: yp_eq(%s, %s)"
+	.section	.rodata.str1.1
+.LC98:
+	.string	"items[2]"
+.LC99:
+	.string	"items[3]"
+	.section	.rodata.str1.8
+	.align 8
+.LC100:
+	.string	"expected_hash = yp_hashC(expected, &exc)"
+	.section	.rodata.str1.1
+.LC101:
+	.string	"expected_hash"
+.LC102:
+	.string	"items[0]"
+.LC103:
+	.string	"items[1]"
+.LC104:
+	.string	"yp_StopIteration"
+.LC105:
+	.string	"yp_next(x)"
+	.section	.rodata.str1.8
+	.align 8
+.LC106:
+	.string	"assertion failed: yp_isexceptionC(%s) (expected %s)"
+	.align 8
+.LC107:
+	.string	"assertion failed: yp_isexceptionCN(%s, N(%s))"
+	.text
+	.type	test_freelists, @function
+test_freelists:
+.LVL472:
+.LFB31:
+	.loc 1 169 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 169 1 is_stmt 0 view .LVU1371
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$104, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 170 5 is_stmt 1 view .LVU1372
+# Lib/munit_test/test_memory.c:170:     uniqueness_t *uq = uniqueness_new();
+	.loc 1 170 24 is_stmt 0 view .LVU1373
+	call	uniqueness_new@PLT	#
+.LVL473:
+	.loc 1 170 24 view .LVU1374
+	movq	%rax, %rbx	# tmp371, uq
+.LVL474:
+	.loc 1 171 5 is_stmt 1 view .LVU1375
+# Lib/munit_test/test_memory.c:171:     ypObject     *items[] = obj_array_init(4, rand_obj_any_hashable(uq));
+	.loc 1 171 27 is_stmt 0 view .LVU1376
+	movq	%rax, %rdi	# uq,
+	call	rand_obj_any_hashable@PLT	#
+.LVL475:
+# Lib/munit_test/test_memory.c:171:     ypObject     *items[] = obj_array_init(4, rand_obj_any_hashable(uq));
+	.loc 1 171 15 view .LVU1377
+	movq	%rax, -80(%rbp)	# tmp372, items[0]
+# Lib/munit_test/test_memory.c:171:     ypObject     *items[] = obj_array_init(4, rand_obj_any_hashable(uq));
+	.loc 1 171 56 view .LVU1378
+	movq	%rbx, %rdi	# uq,
+	call	rand_obj_any_hashable@PLT	#
+.LVL476:
+# Lib/munit_test/test_memory.c:171:     ypObject     *items[] = obj_array_init(4, rand_obj_any_hashable(uq));
+	.loc 1 171 15 view .LVU1379
+	movq	%rax, -72(%rbp)	# tmp373, items[1]
+# Lib/munit_test/test_memory.c:171:     ypObject     *items[] = obj_array_init(4, rand_obj_any_hashable(uq));
+	.loc 1 171 85 view .LVU1380
+	movq	%rbx, %rdi	# uq,
+	call	rand_obj_any_hashable@PLT	#
+.LVL477:
+# Lib/munit_test/test_memory.c:171:     ypObject     *items[] = obj_array_init(4, rand_obj_any_hashable(uq));
+	.loc 1 171 15 view .LVU1381
+	movq	%rax, -64(%rbp)	# tmp374, items[2]
+# Lib/munit_test/test_memory.c:171:     ypObject     *items[] = obj_array_init(4, rand_obj_any_hashable(uq));
+	.loc 1 171 114 view .LVU1382
+	movq	%rbx, %rdi	# uq,
+	call	rand_obj_any_hashable@PLT	#
+.LVL478:
+# Lib/munit_test/test_memory.c:171:     ypObject     *items[] = obj_array_init(4, rand_obj_any_hashable(uq));
+	.loc 1 171 15 view .LVU1383
+	movq	%rax, -56(%rbp)	# tmp375, items[3]
+.LBB204:
+	.loc 1 175 9 is_stmt 1 view .LVU1384
+# Lib/munit_test/test_memory.c:175:         ypObject *x = yp_intC(1000);
+	.loc 1 175 23 is_stmt 0 view .LVU1385
+	movl	$1000, %edi	#,
+	call	yp_intC@PLT	#
+.LVL479:
+	movq	%rax, %r12	# tmp376, x
+.LVL480:
+	.loc 1 176 9 is_stmt 1 view .LVU1386
+.LBB205:
+	.loc 1 176 14 view .LVU1387
+	.loc 1 176 39 view .LVU1388
+	.loc 1 176 64 view .LVU1389
+.LBB206:
+	.loc 1 176 69 view .LVU1390
+# Lib/munit_test/test_memory.c:176:         assert_hashC_exc(yp_hashC(x, &exc), ==, 1000);
+	.loc 1 176 79 is_stmt 0 view .LVU1391
+	movq	$0, -96(%rbp)	#, MEM[(struct ypObject * *)_271]
+	.loc 1 176 10 is_stmt 1 view .LVU1392
+# Lib/munit_test/test_memory.c:176:         assert_hashC_exc(yp_hashC(x, &exc), ==, 1000);
+	.loc 1 176 27 is_stmt 0 view .LVU1393
+	leaq	-96(%rbp), %rsi	#, tmp188
+	movq	%rax, %rdi	# x,
+	call	yp_hashC@PLT	#
+.LVL481:
+	.loc 1 176 47 is_stmt 1 view .LVU1394
+	.loc 1 176 71 view .LVU1395
+# Lib/munit_test/test_memory.c:176:         assert_hashC_exc(yp_hashC(x, &exc), ==, 1000);
+	.loc 1 176 79 is_stmt 0 view .LVU1396
+	movq	-96(%rbp), %rdi	# MEM[(struct ypObject * *)_271], exc.99_5
+# Lib/munit_test/test_memory.c:176:         assert_hashC_exc(yp_hashC(x, &exc), ==, 1000);
+	.loc 1 176 74 view .LVU1397
+	testq	%rdi, %rdi	# exc.99_5
+	je	.L221	#,
+	.loc 1 176 12 is_stmt 1 discriminator 1 view .LVU1398
+# Lib/munit_test/test_memory.c:176:         assert_hashC_exc(yp_hashC(x, &exc), ==, 1000);
+	.loc 1 176 16 is_stmt 0 discriminator 1 view .LVU1399
+	call	yp_isexceptionC@PLT	#
+.LVL482:
+# Lib/munit_test/test_memory.c:176:         assert_hashC_exc(yp_hashC(x, &exc), ==, 1000);
+	.loc 1 176 15 discriminator 1 view .LVU1400
+	testl	%eax, %eax	# tmp378
+	je	.L222	#,
+	.loc 1 176 40 is_stmt 1 discriminator 3 view .LVU1401
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp189
+	leaq	.LC17(%rip), %rdx	#, tmp190
+	movl	$176, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp191
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL483:
+.L222:
+	.loc 1 176 196 discriminator 4 view .LVU1402
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp192
+	leaq	.LC18(%rip), %rdx	#, tmp193
+	movl	$176, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp194
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL484:
+.L221:
+	.loc 1 176 196 is_stmt 0 discriminator 4 view .LVU1403
+.LBE206:
+	.loc 1 176 67 is_stmt 1 discriminator 2 view .LVU1404
+	.loc 1 176 349 discriminator 2 view .LVU1405
+	.loc 1 176 354 discriminator 2 view .LVU1406
+# Lib/munit_test/test_memory.c:176:         assert_hashC_exc(yp_hashC(x, &exc), ==, 1000);
+	.loc 1 176 357 is_stmt 0 discriminator 2 view .LVU1407
+	cmpq	$1000, %rax	#, _ypmt_TYPEC_a
+	jne	.L279	#,
+	.loc 1 176 352 is_stmt 1 discriminator 6 view .LVU1408
+.LBE205:
+	.loc 1 176 12 discriminator 6 view .LVU1409
+	.loc 1 177 9 discriminator 6 view .LVU1410
+	movq	%r12, %rdi	# x,
+	call	yp_decref@PLT	#
+.LVL485:
+	.loc 1 178 9 discriminator 6 view .LVU1411
+# Lib/munit_test/test_memory.c:178:         x = yp_intstoreC(2000);
+	.loc 1 178 13 is_stmt 0 discriminator 6 view .LVU1412
+	movl	$2000, %edi	#,
+	call	yp_intstoreC@PLT	#
+.LVL486:
+	movq	%rax, %r12	# tmp379, x
+.LVL487:
+	.loc 1 179 9 is_stmt 1 discriminator 6 view .LVU1413
+.LBB207:
+	.loc 1 179 14 discriminator 6 view .LVU1414
+	.loc 1 179 46 discriminator 6 view .LVU1415
+	.loc 1 179 95 discriminator 6 view .LVU1416
+	.loc 1 179 100 discriminator 6 view .LVU1417
+# Lib/munit_test/test_memory.c:179:         assert_type_is(x, yp_t_intstore);
+	.loc 1 179 104 is_stmt 0 discriminator 6 view .LVU1418
+	movq	%rax, %rdi	# x,
+	call	yp_isexceptionC@PLT	#
+.LVL488:
+# Lib/munit_test/test_memory.c:179:         assert_type_is(x, yp_t_intstore);
+	.loc 1 179 103 discriminator 6 view .LVU1419
+	testl	%eax, %eax	# tmp380
+	jne	.L280	#,
+	.loc 1 179 98 is_stmt 1 discriminator 2 view .LVU1420
+	.loc 1 179 261 discriminator 2 view .LVU1421
+.LBB208:
+	.loc 1 179 266 discriminator 2 view .LVU1422
+# Lib/munit_test/test_memory.c:179:         assert_type_is(x, yp_t_intstore);
+	.loc 1 179 298 is_stmt 0 discriminator 2 view .LVU1423
+	movq	%r12, %rdi	# x,
+	call	yp_type@PLT	#
+.LVL489:
+	.loc 1 179 323 is_stmt 1 discriminator 2 view .LVU1424
+	.loc 1 179 328 discriminator 2 view .LVU1425
+# Lib/munit_test/test_memory.c:179:         assert_type_is(x, yp_t_intstore);
+	.loc 1 179 331 is_stmt 0 discriminator 2 view .LVU1426
+	cmpq	%rax, yp_t_intstore(%rip)	# _ypmt_TYPE_type_obj, yp_t_intstore
+	jne	.L281	#,
+	.loc 1 179 326 is_stmt 1 discriminator 4 view .LVU1427
+.LBE208:
+	.loc 1 179 264 discriminator 4 view .LVU1428
+.LBE207:
+	.loc 1 179 12 discriminator 4 view .LVU1429
+	.loc 1 180 9 discriminator 4 view .LVU1430
+.LBB210:
+	.loc 1 180 14 discriminator 4 view .LVU1431
+# Lib/munit_test/test_memory.c:180:         assert_hashC_raises_exc(yp_hashC(x, &exc), ==, -1, yp_TypeError);
+	.loc 1 180 24 is_stmt 0 discriminator 4 view .LVU1432
+	movq	yp_TypeError(%rip), %rax	# yp_TypeError, yp_TypeError
+.LVL490:
+	.loc 1 180 24 discriminator 4 view .LVU1433
+	movq	%rax, -112(%rbp)	# yp_TypeError, MEM[(struct ypObject *[1] *)_270][0]
+	.loc 1 180 61 is_stmt 1 discriminator 4 view .LVU1434
+.LVL491:
+	.loc 1 180 176 discriminator 4 view .LVU1435
+	.loc 1 180 201 discriminator 4 view .LVU1436
+	.loc 1 180 226 discriminator 4 view .LVU1437
+.LBB211:
+	.loc 1 180 231 discriminator 4 view .LVU1438
+# Lib/munit_test/test_memory.c:180:         assert_hashC_raises_exc(yp_hashC(x, &exc), ==, -1, yp_TypeError);
+	.loc 1 180 241 is_stmt 0 discriminator 4 view .LVU1439
+	movq	yp_None(%rip), %rax	# yp_None, yp_None
+	movq	%rax, -96(%rbp)	# yp_None, MEM[(struct ypObject * *)_271]
+	.loc 1 180 256 is_stmt 1 discriminator 4 view .LVU1440
+	.loc 1 180 386 discriminator 4 view .LVU1441
+# Lib/munit_test/test_memory.c:180:         assert_hashC_raises_exc(yp_hashC(x, &exc), ==, -1, yp_TypeError);
+	.loc 1 180 403 is_stmt 0 discriminator 4 view .LVU1442
+	leaq	-96(%rbp), %rsi	#, tmp206
+	movq	%r12, %rdi	# x,
+	call	yp_hashC@PLT	#
+.LVL492:
+	movq	%rax, %r13	# tmp382, _ypmt_TYPEC_a
+.LVL493:
+	.loc 1 180 423 is_stmt 1 discriminator 4 view .LVU1443
+# Lib/munit_test/test_memory.c:180:         assert_hashC_raises_exc(yp_hashC(x, &exc), ==, -1, yp_TypeError);
+	.loc 1 180 428 is_stmt 0 discriminator 4 view .LVU1444
+	movq	-96(%rbp), %rdi	# MEM[(struct ypObject * *)_271],
+	call	yp_isexceptionC@PLT	#
+.LVL494:
+# Lib/munit_test/test_memory.c:180:         assert_hashC_raises_exc(yp_hashC(x, &exc), ==, -1, yp_TypeError);
+	.loc 1 180 426 discriminator 4 view .LVU1445
+	testl	%eax, %eax	# tmp383
+	je	.L282	#,
+	.loc 1 180 617 is_stmt 1 discriminator 4 view .LVU1446
+# Lib/munit_test/test_memory.c:180:         assert_hashC_raises_exc(yp_hashC(x, &exc), ==, -1, yp_TypeError);
+	.loc 1 180 622 is_stmt 0 discriminator 4 view .LVU1447
+	leaq	-112(%rbp), %rdx	#, tmp211
+	movl	$1, %esi	#,
+	movq	-96(%rbp), %rdi	# MEM[(struct ypObject * *)_271],
+	call	yp_isexception_arrayC@PLT	#
+.LVL495:
+# Lib/munit_test/test_memory.c:180:         assert_hashC_raises_exc(yp_hashC(x, &exc), ==, -1, yp_TypeError);
+	.loc 1 180 620 discriminator 4 view .LVU1448
+	testl	%eax, %eax	# tmp384
+	je	.L283	#,
+.LBE211:
+	.loc 1 180 229 is_stmt 1 discriminator 6 view .LVU1449
+	.loc 1 180 857 discriminator 6 view .LVU1450
+.LBE210:
+.LBE204:
+	.loc 1 180 862 discriminator 6 view .LVU1451
+.LVL496:
+	.loc 1 180 10 discriminator 6 view .LVU1452
+	.loc 1 180 32 discriminator 6 view .LVU1453
+.LBB231:
+.LBB213:
+	.loc 1 180 860 discriminator 6 view .LVU1454
+	.loc 1 180 267 discriminator 6 view .LVU1455
+	.loc 1 180 272 discriminator 6 view .LVU1456
+# Lib/munit_test/test_memory.c:180:         assert_hashC_raises_exc(yp_hashC(x, &exc), ==, -1, yp_TypeError);
+	.loc 1 180 275 is_stmt 0 discriminator 6 view .LVU1457
+	cmpq	$-1, %r13	#, _ypmt_TYPEC_a
+	jne	.L284	#,
+	.loc 1 180 270 is_stmt 1 discriminator 12 view .LVU1458
+.LBE213:
+	.loc 1 180 12 discriminator 12 view .LVU1459
+	.loc 1 181 9 discriminator 12 view .LVU1460
+	movq	%r12, %rdi	# x,
+	call	yp_decref@PLT	#
+.LVL497:
+	.loc 1 182 9 discriminator 12 view .LVU1461
+# Lib/munit_test/test_memory.c:182:         x = yp_intC(3000);
+	.loc 1 182 13 is_stmt 0 discriminator 12 view .LVU1462
+	movl	$3000, %edi	#,
+	call	yp_intC@PLT	#
+.LVL498:
+	movq	%rax, %r12	# tmp385, x
+.LVL499:
+	.loc 1 183 9 is_stmt 1 discriminator 12 view .LVU1463
+.LBB214:
+	.loc 1 183 14 discriminator 12 view .LVU1464
+	.loc 1 183 46 discriminator 12 view .LVU1465
+	.loc 1 183 90 discriminator 12 view .LVU1466
+	.loc 1 183 95 discriminator 12 view .LVU1467
+# Lib/munit_test/test_memory.c:183:         assert_type_is(x, yp_t_int);
+	.loc 1 183 99 is_stmt 0 discriminator 12 view .LVU1468
+	movq	%rax, %rdi	# x,
+	call	yp_isexceptionC@PLT	#
+.LVL500:
+# Lib/munit_test/test_memory.c:183:         assert_type_is(x, yp_t_int);
+	.loc 1 183 98 discriminator 12 view .LVU1469
+	testl	%eax, %eax	# tmp386
+	jne	.L285	#,
+	.loc 1 183 93 is_stmt 1 discriminator 2 view .LVU1470
+	.loc 1 183 256 discriminator 2 view .LVU1471
+.LBB215:
+	.loc 1 183 261 discriminator 2 view .LVU1472
+# Lib/munit_test/test_memory.c:183:         assert_type_is(x, yp_t_int);
+	.loc 1 183 293 is_stmt 0 discriminator 2 view .LVU1473
+	movq	%r12, %rdi	# x,
+	call	yp_type@PLT	#
+.LVL501:
+	.loc 1 183 318 is_stmt 1 discriminator 2 view .LVU1474
+	.loc 1 183 323 discriminator 2 view .LVU1475
+# Lib/munit_test/test_memory.c:183:         assert_type_is(x, yp_t_int);
+	.loc 1 183 326 is_stmt 0 discriminator 2 view .LVU1476
+	cmpq	%rax, yp_t_int(%rip)	# _ypmt_TYPE_type_obj, yp_t_int
+	jne	.L286	#,
+	.loc 1 183 321 is_stmt 1 discriminator 4 view .LVU1477
+.LBE215:
+	.loc 1 183 259 discriminator 4 view .LVU1478
+.LBE214:
+	.loc 1 183 12 discriminator 4 view .LVU1479
+	.loc 1 184 9 discriminator 4 view .LVU1480
+.LBB217:
+	.loc 1 184 14 discriminator 4 view .LVU1481
+	.loc 1 184 38 discriminator 4 view .LVU1482
+	.loc 1 184 62 discriminator 4 view .LVU1483
+.LBB218:
+	.loc 1 184 67 discriminator 4 view .LVU1484
+# Lib/munit_test/test_memory.c:184:         assert_intC_exc(yp_asintC(x, &exc), ==, 3000);
+	.loc 1 184 77 is_stmt 0 discriminator 4 view .LVU1485
+	movq	$0, -96(%rbp)	#, MEM[(struct ypObject * *)_271]
+	.loc 1 184 10 is_stmt 1 discriminator 4 view .LVU1486
+# Lib/munit_test/test_memory.c:184:         assert_intC_exc(yp_asintC(x, &exc), ==, 3000);
+	.loc 1 184 27 is_stmt 0 discriminator 4 view .LVU1487
+	leaq	-96(%rbp), %rsi	#, tmp226
+	movq	%r12, %rdi	# x,
+	call	yp_asintC@PLT	#
+.LVL502:
+	.loc 1 184 48 is_stmt 1 discriminator 4 view .LVU1488
+	.loc 1 184 72 discriminator 4 view .LVU1489
+# Lib/munit_test/test_memory.c:184:         assert_intC_exc(yp_asintC(x, &exc), ==, 3000);
+	.loc 1 184 80 is_stmt 0 discriminator 4 view .LVU1490
+	movq	-96(%rbp), %rdi	# MEM[(struct ypObject * *)_271], exc.105_15
+# Lib/munit_test/test_memory.c:184:         assert_intC_exc(yp_asintC(x, &exc), ==, 3000);
+	.loc 1 184 75 discriminator 4 view .LVU1491
+	testq	%rdi, %rdi	# exc.105_15
+	je	.L231	#,
+	.loc 1 184 12 is_stmt 1 discriminator 1 view .LVU1492
+# Lib/munit_test/test_memory.c:184:         assert_intC_exc(yp_asintC(x, &exc), ==, 3000);
+	.loc 1 184 16 is_stmt 0 discriminator 1 view .LVU1493
+	call	yp_isexceptionC@PLT	#
+.LVL503:
+# Lib/munit_test/test_memory.c:184:         assert_intC_exc(yp_asintC(x, &exc), ==, 3000);
+	.loc 1 184 15 discriminator 1 view .LVU1494
+	testl	%eax, %eax	# tmp389
+	je	.L232	#,
+	.loc 1 184 40 is_stmt 1 discriminator 3 view .LVU1495
+	leaq	.LC88(%rip), %r8	#,
+	leaq	.LC89(%rip), %rcx	#, tmp227
+	leaq	.LC17(%rip), %rdx	#, tmp228
+	movl	$184, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp229
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL504:
+.L279:
+	.loc 1 184 40 is_stmt 0 discriminator 3 view .LVU1496
+.LBE218:
+.LBE217:
+.LBB220:
+	.loc 1 176 395 is_stmt 1 discriminator 5 view .LVU1497
+	subq	$8, %rsp	#,
+	pushq	$1000	#
+	movq	%rax, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp195
+	leaq	.LC19(%rip), %rdx	#, tmp196
+	movl	$176, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp197
+	movl	$0, %eax	#,
+.LVL505:
+	.loc 1 176 395 is_stmt 0 discriminator 5 view .LVU1498
+	call	munit_errorf_ex@PLT	#
+.LVL506:
+.L280:
+	.loc 1 176 395 discriminator 5 view .LVU1499
+.LBE220:
+.LBB221:
+	.loc 1 179 139 is_stmt 1 discriminator 1 view .LVU1500
+	leaq	.LC82(%rip), %rcx	#, tmp198
+	leaq	.LC83(%rip), %rdx	#, tmp199
+	movl	$179, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp200
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL507:
+.L281:
+.LBB209:
+	.loc 1 179 381 discriminator 3 view .LVU1501
+	subq	$8, %rsp	#,
+	pushq	yp_t_intstore(%rip)	# yp_t_intstore
+	movq	%rax, %r9	# _ypmt_TYPE_type_obj,
+	leaq	.LC84(%rip), %r8	#,
+	leaq	.LC82(%rip), %rcx	#, tmp201
+	leaq	.LC85(%rip), %rdx	#, tmp202
+	movl	$179, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp203
+	movl	$0, %eax	#,
+.LVL508:
+	.loc 1 179 381 is_stmt 0 discriminator 3 view .LVU1502
+	call	munit_errorf_ex@PLT	#
+.LVL509:
+.L282:
+	.loc 1 179 381 discriminator 3 view .LVU1503
+.LBE209:
+.LBE221:
+.LBB222:
+.LBB212:
+	.loc 1 180 452 is_stmt 1 discriminator 3 view .LVU1504
+	leaq	.LC86(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp208
+	leaq	.LC45(%rip), %rdx	#, tmp209
+	movl	$180, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp210
+	call	munit_errorf_ex@PLT	#
+.LVL510:
+.L283:
+	.loc 1 180 685 discriminator 5 view .LVU1505
+	leaq	.LC86(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp213
+	leaq	.LC46(%rip), %rdx	#, tmp214
+	movl	$180, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp215
+	call	munit_errorf_ex@PLT	#
+.LVL511:
+.L284:
+	.loc 1 180 685 is_stmt 0 discriminator 5 view .LVU1506
+.LBE212:
+	.loc 1 180 313 is_stmt 1 discriminator 11 view .LVU1507
+	subq	$8, %rsp	#,
+	pushq	$-1	#
+	movq	%r13, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC47(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp217
+	leaq	.LC19(%rip), %rdx	#, tmp218
+	movl	$180, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp219
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL512:
+.L285:
+	.loc 1 180 313 is_stmt 0 discriminator 11 view .LVU1508
+.LBE222:
+.LBB223:
+	.loc 1 183 134 is_stmt 1 discriminator 1 view .LVU1509
+	leaq	.LC82(%rip), %rcx	#, tmp220
+	leaq	.LC83(%rip), %rdx	#, tmp221
+	movl	$183, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp222
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL513:
+.L286:
+.LBB216:
+	.loc 1 183 376 discriminator 3 view .LVU1510
+	subq	$8, %rsp	#,
+	pushq	yp_t_int(%rip)	# yp_t_int
+	movq	%rax, %r9	# _ypmt_TYPE_type_obj,
+	leaq	.LC87(%rip), %r8	#,
+	leaq	.LC82(%rip), %rcx	#, tmp223
+	leaq	.LC85(%rip), %rdx	#, tmp224
+	movl	$183, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp225
+	movl	$0, %eax	#,
+.LVL514:
+	.loc 1 183 376 is_stmt 0 discriminator 3 view .LVU1511
+	call	munit_errorf_ex@PLT	#
+.LVL515:
+.L232:
+	.loc 1 183 376 discriminator 3 view .LVU1512
+.LBE216:
+.LBE223:
+.LBB224:
+.LBB219:
+	.loc 1 184 197 is_stmt 1 discriminator 4 view .LVU1513
+	leaq	.LC88(%rip), %r8	#,
+	leaq	.LC89(%rip), %rcx	#, tmp230
+	leaq	.LC18(%rip), %rdx	#, tmp231
+	movl	$184, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp232
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL516:
+.L231:
+	.loc 1 184 197 is_stmt 0 discriminator 4 view .LVU1514
+.LBE219:
+	.loc 1 184 65 is_stmt 1 discriminator 2 view .LVU1515
+	.loc 1 184 351 discriminator 2 view .LVU1516
+	.loc 1 184 356 discriminator 2 view .LVU1517
+# Lib/munit_test/test_memory.c:184:         assert_intC_exc(yp_asintC(x, &exc), ==, 3000);
+	.loc 1 184 359 is_stmt 0 discriminator 2 view .LVU1518
+	cmpq	$3000, %rax	#, _ypmt_TYPEC_a
+	jne	.L287	#,
+	.loc 1 184 354 is_stmt 1 discriminator 6 view .LVU1519
+.LBE224:
+	.loc 1 184 12 discriminator 6 view .LVU1520
+	.loc 1 185 9 discriminator 6 view .LVU1521
+.LBB225:
+	.loc 1 185 14 discriminator 6 view .LVU1522
+	.loc 1 185 39 discriminator 6 view .LVU1523
+	.loc 1 185 64 discriminator 6 view .LVU1524
+.LBB226:
+	.loc 1 185 69 discriminator 6 view .LVU1525
+# Lib/munit_test/test_memory.c:185:         assert_hashC_exc(yp_hashC(x, &exc), ==, 3000);
+	.loc 1 185 79 is_stmt 0 discriminator 6 view .LVU1526
+	movq	$0, -96(%rbp)	#, MEM[(struct ypObject * *)_271]
+	.loc 1 185 10 is_stmt 1 discriminator 6 view .LVU1527
+# Lib/munit_test/test_memory.c:185:         assert_hashC_exc(yp_hashC(x, &exc), ==, 3000);
+	.loc 1 185 27 is_stmt 0 discriminator 6 view .LVU1528
+	leaq	-96(%rbp), %rsi	#, tmp236
+	movq	%r12, %rdi	# x,
+	call	yp_hashC@PLT	#
+.LVL517:
+	.loc 1 185 47 is_stmt 1 discriminator 6 view .LVU1529
+	.loc 1 185 71 discriminator 6 view .LVU1530
+# Lib/munit_test/test_memory.c:185:         assert_hashC_exc(yp_hashC(x, &exc), ==, 3000);
+	.loc 1 185 79 is_stmt 0 discriminator 6 view .LVU1531
+	movq	-96(%rbp), %rdi	# MEM[(struct ypObject * *)_271], exc.107_17
+# Lib/munit_test/test_memory.c:185:         assert_hashC_exc(yp_hashC(x, &exc), ==, 3000);
+	.loc 1 185 74 discriminator 6 view .LVU1532
+	testq	%rdi, %rdi	# exc.107_17
+	je	.L234	#,
+	.loc 1 185 12 is_stmt 1 discriminator 1 view .LVU1533
+# Lib/munit_test/test_memory.c:185:         assert_hashC_exc(yp_hashC(x, &exc), ==, 3000);
+	.loc 1 185 16 is_stmt 0 discriminator 1 view .LVU1534
+	call	yp_isexceptionC@PLT	#
+.LVL518:
+# Lib/munit_test/test_memory.c:185:         assert_hashC_exc(yp_hashC(x, &exc), ==, 3000);
+	.loc 1 185 15 discriminator 1 view .LVU1535
+	testl	%eax, %eax	# tmp391
+	je	.L235	#,
+	.loc 1 185 40 is_stmt 1 discriminator 3 view .LVU1536
+	leaq	.LC88(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp237
+	leaq	.LC17(%rip), %rdx	#, tmp238
+	movl	$185, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp239
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL519:
+.L287:
+	.loc 1 185 40 is_stmt 0 discriminator 3 view .LVU1537
+.LBE226:
+.LBE225:
+.LBB228:
+	.loc 1 184 397 is_stmt 1 discriminator 5 view .LVU1538
+	subq	$8, %rsp	#,
+	pushq	$3000	#
+	movq	%rax, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC88(%rip), %r8	#,
+	leaq	.LC89(%rip), %rcx	#, tmp233
+	leaq	.LC90(%rip), %rdx	#, tmp234
+	movl	$184, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp235
+	movl	$0, %eax	#,
+.LVL520:
+	.loc 1 184 397 is_stmt 0 discriminator 5 view .LVU1539
+	call	munit_errorf_ex@PLT	#
+.LVL521:
+.L235:
+	.loc 1 184 397 discriminator 5 view .LVU1540
+.LBE228:
+.LBB229:
+.LBB227:
+	.loc 1 185 196 is_stmt 1 discriminator 4 view .LVU1541
+	leaq	.LC88(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp240
+	leaq	.LC18(%rip), %rdx	#, tmp241
+	movl	$185, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp242
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL522:
+.L234:
+	.loc 1 185 196 is_stmt 0 discriminator 4 view .LVU1542
+.LBE227:
+	.loc 1 185 67 is_stmt 1 discriminator 2 view .LVU1543
+	.loc 1 185 349 discriminator 2 view .LVU1544
+	.loc 1 185 354 discriminator 2 view .LVU1545
+# Lib/munit_test/test_memory.c:185:         assert_hashC_exc(yp_hashC(x, &exc), ==, 3000);
+	.loc 1 185 357 is_stmt 0 discriminator 2 view .LVU1546
+	cmpq	$3000, %rax	#, _ypmt_TYPEC_a
+	jne	.L288	#,
+	.loc 1 185 352 is_stmt 1 discriminator 6 view .LVU1547
+.LBE229:
+	.loc 1 185 12 discriminator 6 view .LVU1548
+	.loc 1 186 9 discriminator 6 view .LVU1549
+	movq	%r12, %rdi	# x,
+	call	yp_decref@PLT	#
+.LVL523:
+	.loc 1 186 9 is_stmt 0 discriminator 6 view .LVU1550
+.LBE231:
+.LBB232:
+	.loc 1 191 9 is_stmt 1 discriminator 6 view .LVU1551
+# Lib/munit_test/test_memory.c:191:         ypObject *x = yp_floatCF(1.5);
+	.loc 1 191 23 is_stmt 0 discriminator 6 view .LVU1552
+	movsd	.LC80(%rip), %xmm0	#,
+	call	yp_floatCF@PLT	#
+.LVL524:
+	movq	%rax, %rdi	# tmp392, x
+.LVL525:
+	.loc 1 192 9 is_stmt 1 discriminator 6 view .LVU1553
+	call	yp_decref@PLT	#
+.LVL526:
+	.loc 1 193 9 discriminator 6 view .LVU1554
+# Lib/munit_test/test_memory.c:193:         x = yp_floatstoreCF(2.5);
+	.loc 1 193 13 is_stmt 0 discriminator 6 view .LVU1555
+	movsd	.LC91(%rip), %xmm0	#,
+	call	yp_floatstoreCF@PLT	#
+.LVL527:
+	movq	%rax, %r12	# tmp393, x
+.LVL528:
+	.loc 1 194 9 is_stmt 1 discriminator 6 view .LVU1556
+.LBB233:
+	.loc 1 194 14 discriminator 6 view .LVU1557
+	.loc 1 194 46 discriminator 6 view .LVU1558
+	.loc 1 194 97 discriminator 6 view .LVU1559
+	.loc 1 194 102 discriminator 6 view .LVU1560
+# Lib/munit_test/test_memory.c:194:         assert_type_is(x, yp_t_floatstore);
+	.loc 1 194 106 is_stmt 0 discriminator 6 view .LVU1561
+	movq	%rax, %rdi	# x,
+	call	yp_isexceptionC@PLT	#
+.LVL529:
+# Lib/munit_test/test_memory.c:194:         assert_type_is(x, yp_t_floatstore);
+	.loc 1 194 105 discriminator 6 view .LVU1562
+	testl	%eax, %eax	# tmp394
+	jne	.L289	#,
+	.loc 1 194 100 is_stmt 1 discriminator 2 view .LVU1563
+	.loc 1 194 263 discriminator 2 view .LVU1564
+.LBB234:
+	.loc 1 194 268 discriminator 2 view .LVU1565
+# Lib/munit_test/test_memory.c:194:         assert_type_is(x, yp_t_floatstore);
+	.loc 1 194 300 is_stmt 0 discriminator 2 view .LVU1566
+	movq	%r12, %rdi	# x,
+	call	yp_type@PLT	#
+.LVL530:
+	.loc 1 194 325 is_stmt 1 discriminator 2 view .LVU1567
+	.loc 1 194 330 discriminator 2 view .LVU1568
+# Lib/munit_test/test_memory.c:194:         assert_type_is(x, yp_t_floatstore);
+	.loc 1 194 333 is_stmt 0 discriminator 2 view .LVU1569
+	cmpq	%rax, yp_t_floatstore(%rip)	# _ypmt_TYPE_type_obj, yp_t_floatstore
+	jne	.L290	#,
+	.loc 1 194 328 is_stmt 1 discriminator 4 view .LVU1570
+.LBE234:
+	.loc 1 194 266 discriminator 4 view .LVU1571
+.LBE233:
+	.loc 1 194 12 discriminator 4 view .LVU1572
+	.loc 1 195 9 discriminator 4 view .LVU1573
+	movq	%r12, %rdi	# x,
+	call	yp_decref@PLT	#
+.LVL531:
+	.loc 1 196 9 discriminator 4 view .LVU1574
+# Lib/munit_test/test_memory.c:196:         x = yp_floatCF(2.0);
+	.loc 1 196 13 is_stmt 0 discriminator 4 view .LVU1575
+	movsd	.LC93(%rip), %xmm0	#,
+	call	yp_floatCF@PLT	#
+.LVL532:
+	movq	%rax, %r12	# tmp396, x
+.LVL533:
+	.loc 1 197 9 is_stmt 1 discriminator 4 view .LVU1576
+.LBB236:
+	.loc 1 197 14 discriminator 4 view .LVU1577
+	.loc 1 197 46 discriminator 4 view .LVU1578
+	.loc 1 197 92 discriminator 4 view .LVU1579
+	.loc 1 197 97 discriminator 4 view .LVU1580
+# Lib/munit_test/test_memory.c:197:         assert_type_is(x, yp_t_float);
+	.loc 1 197 101 is_stmt 0 discriminator 4 view .LVU1581
+	movq	%rax, %rdi	# x,
+	call	yp_isexceptionC@PLT	#
+.LVL534:
+# Lib/munit_test/test_memory.c:197:         assert_type_is(x, yp_t_float);
+	.loc 1 197 100 discriminator 4 view .LVU1582
+	testl	%eax, %eax	# tmp397
+	jne	.L291	#,
+	.loc 1 197 95 is_stmt 1 discriminator 2 view .LVU1583
+	.loc 1 197 258 discriminator 2 view .LVU1584
+.LBB237:
+	.loc 1 197 263 discriminator 2 view .LVU1585
+# Lib/munit_test/test_memory.c:197:         assert_type_is(x, yp_t_float);
+	.loc 1 197 295 is_stmt 0 discriminator 2 view .LVU1586
+	movq	%r12, %rdi	# x,
+	call	yp_type@PLT	#
+.LVL535:
+	.loc 1 197 320 is_stmt 1 discriminator 2 view .LVU1587
+	.loc 1 197 325 discriminator 2 view .LVU1588
+# Lib/munit_test/test_memory.c:197:         assert_type_is(x, yp_t_float);
+	.loc 1 197 328 is_stmt 0 discriminator 2 view .LVU1589
+	cmpq	%rax, yp_t_float(%rip)	# _ypmt_TYPE_type_obj, yp_t_float
+	jne	.L292	#,
+	.loc 1 197 323 is_stmt 1 discriminator 4 view .LVU1590
+.LBE237:
+	.loc 1 197 261 discriminator 4 view .LVU1591
+.LBE236:
+	.loc 1 197 12 discriminator 4 view .LVU1592
+	.loc 1 198 9 discriminator 4 view .LVU1593
+.LBB239:
+	.loc 1 198 14 discriminator 4 view .LVU1594
+.LVL536:
+	.loc 1 198 43 discriminator 4 view .LVU1595
+	.loc 1 198 79 discriminator 4 view .LVU1596
+.LBB240:
+	.loc 1 198 84 discriminator 4 view .LVU1597
+# Lib/munit_test/test_memory.c:198:         assert_obj(x, eq, yp_i_two);
+	.loc 1 198 113 is_stmt 0 discriminator 4 view .LVU1598
+	movq	yp_i_two(%rip), %rsi	# yp_i_two,
+	movq	%r12, %rdi	# x,
+	call	yp_eq@PLT	#
+.LVL537:
+	.loc 1 198 113 discriminator 4 view .LVU1599
+	movq	%rax, %rdi	# tmp399, _ypmt_OBJ_result
+.LVL538:
+	.loc 1 198 146 is_stmt 1 discriminator 4 view .LVU1600
+	.loc 1 198 151 discriminator 4 view .LVU1601
+# Lib/munit_test/test_memory.c:198:         assert_obj(x, eq, yp_i_two);
+	.loc 1 198 154 is_stmt 0 discriminator 4 view .LVU1602
+	cmpq	%rax, yp_True(%rip)	# _ypmt_OBJ_result, yp_True
+	je	.L241	#,
+	.loc 1 198 193 is_stmt 1 discriminator 2 view .LVU1603
+# Lib/munit_test/test_memory.c:198:         assert_obj(x, eq, yp_i_two);
+	.loc 1 198 196 is_stmt 0 discriminator 2 view .LVU1604
+	cmpq	%rax, yp_False(%rip)	# _ypmt_OBJ_result, yp_False
+	je	.L293	#,
+	.loc 1 198 382 is_stmt 1 discriminator 4 view .LVU1605
+	.loc 1 198 387 discriminator 4 view .LVU1606
+	.loc 1 198 392 discriminator 4 view .LVU1607
+# Lib/munit_test/test_memory.c:198:         assert_obj(x, eq, yp_i_two);
+	.loc 1 198 396 is_stmt 0 discriminator 4 view .LVU1608
+	call	yp_isexceptionC@PLT	#
+.LVL539:
+# Lib/munit_test/test_memory.c:198:         assert_obj(x, eq, yp_i_two);
+	.loc 1 198 395 discriminator 4 view .LVU1609
+	testl	%eax, %eax	# tmp400
+	je	.L243	#,
+	.loc 1 198 433 is_stmt 1 discriminator 5 view .LVU1610
+	leaq	.LC78(%rip), %r8	#,
+	leaq	.LC82(%rip), %rcx	#, tmp264
+	leaq	.LC96(%rip), %rdx	#, tmp265
+	movl	$198, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp266
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL540:
+.L288:
+	.loc 1 198 433 is_stmt 0 discriminator 5 view .LVU1611
+.LBE240:
+.LBE239:
+.LBE232:
+.LBB245:
+.LBB230:
+	.loc 1 185 395 is_stmt 1 discriminator 5 view .LVU1612
+	subq	$8, %rsp	#,
+	pushq	$3000	#
+	movq	%rax, %r9	# _ypmt_TYPEC_a,
+	leaq	.LC88(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp243
+	leaq	.LC19(%rip), %rdx	#, tmp244
+	movl	$185, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp245
+	movl	$0, %eax	#,
+.LVL541:
+	.loc 1 185 395 is_stmt 0 discriminator 5 view .LVU1613
+	call	munit_errorf_ex@PLT	#
+.LVL542:
+.L289:
+	.loc 1 185 395 discriminator 5 view .LVU1614
+.LBE230:
+.LBE245:
+.LBB246:
+.LBB242:
+	.loc 1 194 141 is_stmt 1 discriminator 1 view .LVU1615
+	leaq	.LC82(%rip), %rcx	#, tmp248
+	leaq	.LC83(%rip), %rdx	#, tmp249
+	movl	$194, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp250
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL543:
+.L290:
+.LBB235:
+	.loc 1 194 383 discriminator 3 view .LVU1616
+	subq	$8, %rsp	#,
+	pushq	yp_t_floatstore(%rip)	# yp_t_floatstore
+	movq	%rax, %r9	# _ypmt_TYPE_type_obj,
+	leaq	.LC92(%rip), %r8	#,
+	leaq	.LC82(%rip), %rcx	#, tmp251
+	leaq	.LC85(%rip), %rdx	#, tmp252
+	movl	$194, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp253
+	movl	$0, %eax	#,
+.LVL544:
+	.loc 1 194 383 is_stmt 0 discriminator 3 view .LVU1617
+	call	munit_errorf_ex@PLT	#
+.LVL545:
+.L291:
+	.loc 1 194 383 discriminator 3 view .LVU1618
+.LBE235:
+.LBE242:
+.LBB243:
+	.loc 1 197 136 is_stmt 1 discriminator 1 view .LVU1619
+	leaq	.LC82(%rip), %rcx	#, tmp255
+	leaq	.LC83(%rip), %rdx	#, tmp256
+	movl	$197, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp257
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL546:
+.L292:
+.LBB238:
+	.loc 1 197 378 discriminator 3 view .LVU1620
+	subq	$8, %rsp	#,
+	pushq	yp_t_float(%rip)	# yp_t_float
+	movq	%rax, %r9	# _ypmt_TYPE_type_obj,
+	leaq	.LC94(%rip), %r8	#,
+	leaq	.LC82(%rip), %rcx	#, tmp258
+	leaq	.LC85(%rip), %rdx	#, tmp259
+	movl	$197, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp260
+	movl	$0, %eax	#,
+.LVL547:
+	.loc 1 197 378 is_stmt 0 discriminator 3 view .LVU1621
+	call	munit_errorf_ex@PLT	#
+.LVL548:
+.L293:
+	.loc 1 197 378 discriminator 3 view .LVU1622
+.LBE238:
+.LBE243:
+.LBB244:
+.LBB241:
+	.loc 1 198 229 is_stmt 1 discriminator 3 view .LVU1623
+	leaq	.LC78(%rip), %r8	#,
+	leaq	.LC82(%rip), %rcx	#, tmp261
+	leaq	.LC95(%rip), %rdx	#, tmp262
+	movl	$198, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp263
+	movl	$0, %eax	#,
+.LVL549:
+	.loc 1 198 229 is_stmt 0 discriminator 3 view .LVU1624
+	call	munit_errorf_ex@PLT	#
+.LVL550:
+.L243:
+	.loc 1 198 390 is_stmt 1 discriminator 6 view .LVU1625
+	.loc 1 198 596 discriminator 6 view .LVU1626
+	leaq	.LC78(%rip), %r8	#,
+	leaq	.LC82(%rip), %rcx	#, tmp267
+	leaq	.LC97(%rip), %rdx	#, tmp268
+	movl	$198, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp269
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL551:
+.L241:
+	.loc 1 198 186 view .LVU1627
+	.loc 1 198 385 view .LVU1628
+	.loc 1 198 149 view .LVU1629
+.LBE241:
+	.loc 1 198 82 view .LVU1630
+.LBE244:
+	.loc 1 198 12 view .LVU1631
+	.loc 1 199 9 view .LVU1632
+	movq	%r12, %rdi	# x,
+	call	yp_decref@PLT	#
+.LVL552:
+	.loc 1 199 9 is_stmt 0 view .LVU1633
+.LBE246:
+.LBB247:
+	.loc 1 204 9 is_stmt 1 view .LVU1634
+# Lib/munit_test/test_memory.c:204:         ypObject *x = yp_tupleN(N(items[0], items[1]));
+	.loc 1 204 23 is_stmt 0 view .LVU1635
+	movq	-72(%rbp), %rdx	# items[1],
+	movq	-80(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_tupleN@PLT	#
+.LVL553:
+	movq	%rax, %r12	# tmp401, x
+.LVL554:
+	.loc 1 205 9 is_stmt 1 view .LVU1636
+# Lib/munit_test/test_memory.c:205:         ypObject *expected = yp_tupleN(N(items[2], items[3]));
+	.loc 1 205 30 is_stmt 0 view .LVU1637
+	movq	-56(%rbp), %rdx	# items[3],
+	movq	-64(%rbp), %rsi	# items[2],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+.LVL555:
+	.loc 1 205 30 view .LVU1638
+	call	yp_tupleN@PLT	#
+.LVL556:
+	movq	%rax, -136(%rbp)	# tmp402, %sfp
+.LVL557:
+	.loc 1 206 9 is_stmt 1 view .LVU1639
+	.loc 1 207 9 view .LVU1640
+.LBB248:
+	.loc 1 207 14 view .LVU1641
+# Lib/munit_test/test_memory.c:207:         assert_not_raises_exc(yp_hashC(x, &exc));
+	.loc 1 207 24 is_stmt 0 view .LVU1642
+	movq	$0, -96(%rbp)	#, MEM[(struct ypObject * *)_271]
+	.loc 1 207 10 is_stmt 1 view .LVU1643
+# Lib/munit_test/test_memory.c:207:         assert_not_raises_exc(yp_hashC(x, &exc));
+	.loc 1 207 11 is_stmt 0 view .LVU1644
+	leaq	-96(%rbp), %rsi	#, tmp274
+	movq	%r12, %rdi	# x,
+	call	yp_hashC@PLT	#
+.LVL558:
+	.loc 1 207 31 is_stmt 1 view .LVU1645
+# Lib/munit_test/test_memory.c:207:         assert_not_raises_exc(yp_hashC(x, &exc));
+	.loc 1 207 39 is_stmt 0 view .LVU1646
+	movq	-96(%rbp), %rdi	# MEM[(struct ypObject * *)_271], exc.111_28
+# Lib/munit_test/test_memory.c:207:         assert_not_raises_exc(yp_hashC(x, &exc));
+	.loc 1 207 34 view .LVU1647
+	testq	%rdi, %rdi	# exc.111_28
+	je	.L244	#,
+	.loc 1 207 12 is_stmt 1 discriminator 1 view .LVU1648
+# Lib/munit_test/test_memory.c:207:         assert_not_raises_exc(yp_hashC(x, &exc));
+	.loc 1 207 16 is_stmt 0 discriminator 1 view .LVU1649
+	call	yp_isexceptionC@PLT	#
+.LVL559:
+# Lib/munit_test/test_memory.c:207:         assert_not_raises_exc(yp_hashC(x, &exc));
+	.loc 1 207 15 discriminator 1 view .LVU1650
+	testl	%eax, %eax	# tmp403
+	je	.L245	#,
+	.loc 1 207 40 is_stmt 1 discriminator 2 view .LVU1651
+	leaq	.LC81(%rip), %rcx	#, tmp275
+	leaq	.LC1(%rip), %rdx	#, tmp276
+	movl	$207, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp277
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL560:
+.L245:
+	.loc 1 207 170 discriminator 3 view .LVU1652
+	leaq	.LC81(%rip), %rcx	#, tmp278
+	leaq	.LC3(%rip), %rdx	#, tmp279
+	movl	$207, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp280
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL561:
+.L244:
+.LBE248:
+	.loc 1 207 12 view .LVU1653
+	.loc 1 208 9 view .LVU1654
+	movq	%r12, %rdi	# x,
+	call	yp_decref@PLT	#
+.LVL562:
+	.loc 1 209 9 view .LVU1655
+# Lib/munit_test/test_memory.c:209:         x = yp_tupleN(N(items[2], items[3]));
+	.loc 1 209 13 is_stmt 0 view .LVU1656
+	movq	-56(%rbp), %rdx	# items[3],
+	movq	-64(%rbp), %rsi	# items[2],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_tupleN@PLT	#
+.LVL563:
+	movq	%rax, %r14	# tmp404, x
+.LVL564:
+	.loc 1 210 9 is_stmt 1 view .LVU1657
+.LBB249:
+	.loc 1 210 14 view .LVU1658
+	.loc 1 210 45 view .LVU1659
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 81 is_stmt 0 view .LVU1660
+	movq	-64(%rbp), %rax	# items[2], _32
+.LVL565:
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 55 view .LVU1661
+	movq	%rax, -112(%rbp)	# _32, MEM[(struct ypObject *[2] *)_270][0]
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 91 view .LVU1662
+	movq	-56(%rbp), %rax	# items[3], _33
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 55 view .LVU1663
+	movq	%rax, -104(%rbp)	# _33, MEM[(struct ypObject *[2] *)_270][1]
+	.loc 1 210 97 is_stmt 1 view .LVU1664
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 103 is_stmt 0 view .LVU1665
+	leaq	.LC98(%rip), %rax	#, tmp431
+	movq	%rax, -96(%rbp)	# tmp431, MEM[(char *[2] *)_271][0]
+	leaq	.LC99(%rip), %rax	#, tmp432
+	movq	%rax, -88(%rbp)	# tmp432, MEM[(char *[2] *)_271][1]
+	.loc 1 210 153 is_stmt 1 view .LVU1666
+.LBB250:
+	.loc 1 210 158 view .LVU1667
+.LVL566:
+	.loc 1 210 269 view .LVU1668
+	.loc 1 210 293 view .LVU1669
+.LBB251:
+	.loc 1 210 298 view .LVU1670
+	.loc 1 210 327 view .LVU1671
+.LBB252:
+	.loc 1 210 332 view .LVU1672
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 342 is_stmt 0 view .LVU1673
+	movq	$0, -120(%rbp)	#, exc
+	.loc 1 210 10 is_stmt 1 view .LVU1674
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 29 is_stmt 0 view .LVU1675
+	leaq	-120(%rbp), %rsi	#, tmp285
+	movq	%r14, %rdi	# x,
+	call	yp_lenC@PLT	#
+.LVL567:
+	.loc 1 210 59 is_stmt 1 view .LVU1676
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 67 is_stmt 0 view .LVU1677
+	movq	-120(%rbp), %rdi	# exc, exc.113_34
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 62 view .LVU1678
+	testq	%rdi, %rdi	# exc.113_34
+	je	.L246	#,
+	.loc 1 210 12 is_stmt 1 discriminator 1 view .LVU1679
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 16 is_stmt 0 discriminator 1 view .LVU1680
+	call	yp_isexceptionC@PLT	#
+.LVL568:
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 15 discriminator 1 view .LVU1681
+	testl	%eax, %eax	# tmp406
+	je	.L247	#,
+	.loc 1 210 40 is_stmt 1 discriminator 3 view .LVU1682
+	movl	$2, %r8d	#,
+	leaq	.LC82(%rip), %rcx	#, tmp286
+	leaq	.LC26(%rip), %rdx	#, tmp287
+	movl	$210, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp288
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL569:
+.L247:
+	.loc 1 210 56 discriminator 4 view .LVU1683
+	movl	$2, %r8d	#,
+	leaq	.LC82(%rip), %rcx	#, tmp289
+	leaq	.LC27(%rip), %rdx	#, tmp290
+	movl	$210, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp291
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL570:
+.L246:
+	.loc 1 210 56 is_stmt 0 discriminator 4 view .LVU1684
+.LBE252:
+	.loc 1 210 330 is_stmt 1 discriminator 2 view .LVU1685
+	.loc 1 210 44 discriminator 2 view .LVU1686
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 47 is_stmt 0 discriminator 2 view .LVU1687
+	cmpq	$2, %rax	#, _ypmt_LEN_actual
+	jne	.L294	#,
+.LBE251:
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 95 view .LVU1688
+	movl	$0, %r12d	#, _ypmt_SEQ_i
+.LVL571:
+.L248:
+	.loc 1 210 112 is_stmt 1 discriminator 18 view .LVU1689
+	cmpq	$1, %r12	#, _ypmt_SEQ_i
+	jg	.L295	#,
+.LBB253:
+	.loc 1 210 144 discriminator 19 view .LVU1690
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 173 is_stmt 0 discriminator 19 view .LVU1691
+	movq	%r12, %rsi	# _ypmt_SEQ_i,
+	movq	%r14, %rdi	# x,
+	call	yp_getindexC@PLT	#
+.LVL572:
+	movq	%rax, %r13	# tmp407, _ypmt_SEQ_actual
+.LVL573:
+	.loc 1 210 215 is_stmt 1 discriminator 19 view .LVU1692
+	.loc 1 210 220 discriminator 19 view .LVU1693
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 224 is_stmt 0 discriminator 19 view .LVU1694
+	movq	%rax, %rdi	# _ypmt_SEQ_actual,
+	call	yp_isexceptionC@PLT	#
+.LVL574:
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 223 discriminator 19 view .LVU1695
+	testl	%eax, %eax	# tmp408
+	jne	.L296	#,
+	.loc 1 210 218 is_stmt 1 discriminator 9 view .LVU1696
+	.loc 1 210 51 discriminator 9 view .LVU1697
+	.loc 1 210 56 discriminator 9 view .LVU1698
+.LBB254:
+	.loc 1 210 61 discriminator 9 view .LVU1699
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 90 is_stmt 0 discriminator 9 view .LVU1700
+	movq	-112(%rbp,%r12,8), %r15	# MEM[(struct ypObject *[2] *)_270][_ypmt_SEQ_i_59], _37
+	movq	%r15, %rsi	# _37,
+	movq	%r13, %rdi	# _ypmt_SEQ_actual,
+	call	yp_eq@PLT	#
+.LVL575:
+	.loc 1 210 145 is_stmt 1 discriminator 9 view .LVU1701
+	.loc 1 210 150 discriminator 9 view .LVU1702
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 153 is_stmt 0 discriminator 9 view .LVU1703
+	cmpq	%rax, yp_True(%rip)	# _ypmt_OBJ_result, yp_True
+	jne	.L297	#,
+	.loc 1 210 185 is_stmt 1 view .LVU1704
+	.loc 1 210 109 view .LVU1705
+	.loc 1 210 148 view .LVU1706
+.LBE254:
+	.loc 1 210 59 view .LVU1707
+	.loc 1 210 121 view .LVU1708
+.LBB255:
+	.loc 1 210 126 view .LVU1709
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 156 is_stmt 0 view .LVU1710
+	movq	%r13, %rdi	# _ypmt_SEQ_actual,
+	call	yp_type@PLT	#
+.LVL576:
+	.loc 1 210 156 view .LVU1711
+	movq	%rax, -144(%rbp)	# tmp411, %sfp
+.LVL577:
+	.loc 1 210 183 is_stmt 1 view .LVU1712
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 213 is_stmt 0 view .LVU1713
+	movq	%r15, %rdi	# _37,
+	call	yp_type@PLT	#
+.LVL578:
+	.loc 1 210 252 is_stmt 1 view .LVU1714
+	.loc 1 210 257 view .LVU1715
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 260 is_stmt 0 view .LVU1716
+	cmpq	%rax, -144(%rbp)	# _ypmt_TYPE_type_b, %sfp
+	jne	.L298	#,
+	.loc 1 210 255 is_stmt 1 discriminator 17 view .LVU1717
+.LBE255:
+	.loc 1 210 124 discriminator 17 view .LVU1718
+	.loc 1 210 54 discriminator 17 view .LVU1719
+	.loc 1 210 215 discriminator 17 view .LVU1720
+	movq	%r13, %rdi	# _ypmt_SEQ_actual,
+	call	yp_decref@PLT	#
+.LVL579:
+	.loc 1 210 215 is_stmt 0 discriminator 17 view .LVU1721
+.LBE253:
+	.loc 1 210 138 is_stmt 1 discriminator 17 view .LVU1722
+	movl	$1, %esi	#,
+	movq	%r12, %rdi	# _ypmt_SEQ_i,
+	call	__addvdi3@PLT	#
+.LVL580:
+	movq	%rax, %r12	# tmp413, _ypmt_SEQ_i
+.LVL581:
+	.loc 1 210 138 is_stmt 0 discriminator 17 view .LVU1723
+	jmp	.L248	#
+.LVL582:
+.L294:
+.LBB258:
+	.loc 1 210 83 is_stmt 1 discriminator 5 view .LVU1724
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	movq	%rax, %r9	# _ypmt_LEN_actual,
+	movl	$2, %r8d	#,
+	leaq	.LC82(%rip), %rcx	#, tmp292
+	leaq	.LC28(%rip), %rdx	#, tmp293
+	movl	$210, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp294
+	movl	$0, %eax	#,
+.LVL583:
+	.loc 1 210 83 is_stmt 0 discriminator 5 view .LVU1725
+	call	munit_errorf_ex@PLT	#
+.LVL584:
+.L296:
+	.loc 1 210 83 discriminator 5 view .LVU1726
+.LBE258:
+.LBB259:
+	.loc 1 210 261 is_stmt 1 discriminator 8 view .LVU1727
+	movq	%r12, %r8	# _ypmt_SEQ_i,
+	leaq	.LC82(%rip), %rcx	#, tmp295
+	leaq	.LC29(%rip), %rdx	#, tmp296
+	movl	$210, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp297
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL585:
+.L297:
+.LBB256:
+	.loc 1 210 192 discriminator 11 view .LVU1728
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 195 is_stmt 0 discriminator 11 view .LVU1729
+	cmpq	%rax, yp_False(%rip)	# _ypmt_OBJ_result, yp_False
+	je	.L299	#,
+	.loc 1 210 106 is_stmt 1 discriminator 13 view .LVU1730
+	.loc 1 210 111 discriminator 13 view .LVU1731
+	.loc 1 210 116 discriminator 13 view .LVU1732
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 120 is_stmt 0 discriminator 13 view .LVU1733
+	movq	%rax, %rdi	# _ypmt_OBJ_result,
+	call	yp_isexceptionC@PLT	#
+.LVL586:
+# Lib/munit_test/test_memory.c:210:         assert_sequence(x, items[2], items[3]);
+	.loc 1 210 119 discriminator 13 view .LVU1734
+	testl	%eax, %eax	# tmp410
+	je	.L252	#,
+	.loc 1 210 157 is_stmt 1 discriminator 14 view .LVU1735
+	movq	-96(%rbp,%r12,8), %r9	# MEM[(char *[2] *)_271][_ypmt_SEQ_i_59],
+	movq	%r12, %r8	# _ypmt_SEQ_i,
+	leaq	.LC82(%rip), %rcx	#, tmp303
+	leaq	.LC31(%rip), %rdx	#, tmp304
+	movl	$210, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp305
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL587:
+.L299:
+	.loc 1 210 228 discriminator 12 view .LVU1736
+	movq	-96(%rbp,%r12,8), %r9	# MEM[(char *[2] *)_271][_ypmt_SEQ_i_59],
+	movq	%r12, %r8	# _ypmt_SEQ_i,
+	leaq	.LC82(%rip), %rcx	#, tmp299
+	leaq	.LC30(%rip), %rdx	#, tmp300
+	movl	$210, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp301
+	movl	$0, %eax	#,
+.LVL588:
+	.loc 1 210 228 is_stmt 0 discriminator 12 view .LVU1737
+	call	munit_errorf_ex@PLT	#
+.LVL589:
+.L252:
+	.loc 1 210 114 is_stmt 1 discriminator 15 view .LVU1738
+	.loc 1 210 99 discriminator 15 view .LVU1739
+	movq	-96(%rbp,%r12,8), %r9	# MEM[(char *[2] *)_271][_ypmt_SEQ_i_59],
+	movq	%r12, %r8	# _ypmt_SEQ_i,
+	leaq	.LC82(%rip), %rcx	#, tmp307
+	leaq	.LC32(%rip), %rdx	#, tmp308
+	movl	$210, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp309
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL590:
+.L298:
+	.loc 1 210 99 is_stmt 0 discriminator 15 view .LVU1740
+.LBE256:
+.LBB257:
+	.loc 1 210 306 is_stmt 1 discriminator 16 view .LVU1741
+	pushq	%rax	# _ypmt_TYPE_type_b
+	pushq	-144(%rbp)	# %sfp
+	movq	-96(%rbp,%r12,8), %r9	# MEM[(char *[2] *)_271][_ypmt_SEQ_i_59],
+	movq	%r12, %r8	# _ypmt_SEQ_i,
+	leaq	.LC82(%rip), %rcx	#, tmp311
+	leaq	.LC33(%rip), %rdx	#, tmp312
+	movl	$210, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp313
+	movl	$0, %eax	#,
+.LVL591:
+	.loc 1 210 306 is_stmt 0 discriminator 16 view .LVU1742
+	call	munit_errorf_ex@PLT	#
+.LVL592:
+.L295:
+	.loc 1 210 306 discriminator 16 view .LVU1743
+.LBE257:
+.LBE259:
+.LBE250:
+	.loc 1 210 156 is_stmt 1 discriminator 20 view .LVU1744
+.LBE249:
+	.loc 1 210 12 discriminator 20 view .LVU1745
+	.loc 1 211 9 discriminator 20 view .LVU1746
+.LBB260:
+	.loc 1 211 14 discriminator 20 view .LVU1747
+# Lib/munit_test/test_memory.c:211:         assert_not_raises_exc(expected_hash = yp_hashC(expected, &exc));
+	.loc 1 211 24 is_stmt 0 discriminator 20 view .LVU1748
+	movq	$0, -96(%rbp)	#, MEM[(struct ypObject * *)_271]
+	.loc 1 211 10 is_stmt 1 discriminator 20 view .LVU1749
+# Lib/munit_test/test_memory.c:211:         assert_not_raises_exc(expected_hash = yp_hashC(expected, &exc));
+	.loc 1 211 27 is_stmt 0 discriminator 20 view .LVU1750
+	leaq	-96(%rbp), %rsi	#, tmp315
+	movq	-136(%rbp), %rdi	# %sfp,
+	call	yp_hashC@PLT	#
+.LVL593:
+	movq	%rax, %r12	# tmp414, expected_hash
+.LVL594:
+	.loc 1 211 54 is_stmt 1 discriminator 20 view .LVU1751
+# Lib/munit_test/test_memory.c:211:         assert_not_raises_exc(expected_hash = yp_hashC(expected, &exc));
+	.loc 1 211 62 is_stmt 0 discriminator 20 view .LVU1752
+	movq	-96(%rbp), %rdi	# MEM[(struct ypObject * *)_271], exc.117_44
+# Lib/munit_test/test_memory.c:211:         assert_not_raises_exc(expected_hash = yp_hashC(expected, &exc));
+	.loc 1 211 57 discriminator 20 view .LVU1753
+	testq	%rdi, %rdi	# exc.117_44
+	je	.L255	#,
+	.loc 1 211 12 is_stmt 1 discriminator 1 view .LVU1754
+# Lib/munit_test/test_memory.c:211:         assert_not_raises_exc(expected_hash = yp_hashC(expected, &exc));
+	.loc 1 211 16 is_stmt 0 discriminator 1 view .LVU1755
+	call	yp_isexceptionC@PLT	#
+.LVL595:
+# Lib/munit_test/test_memory.c:211:         assert_not_raises_exc(expected_hash = yp_hashC(expected, &exc));
+	.loc 1 211 15 discriminator 1 view .LVU1756
+	testl	%eax, %eax	# tmp415
+	je	.L256	#,
+	.loc 1 211 40 is_stmt 1 discriminator 2 view .LVU1757
+	leaq	.LC100(%rip), %rcx	#, tmp316
+	leaq	.LC1(%rip), %rdx	#, tmp317
+	movl	$211, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp318
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL596:
+.L256:
+	.loc 1 211 193 discriminator 3 view .LVU1758
+	leaq	.LC100(%rip), %rcx	#, tmp319
+	leaq	.LC3(%rip), %rdx	#, tmp320
+	movl	$211, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp321
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL597:
+.L255:
+	.loc 1 211 193 is_stmt 0 discriminator 3 view .LVU1759
+.LBE260:
+	.loc 1 211 12 is_stmt 1 view .LVU1760
+	.loc 1 212 9 view .LVU1761
+.LBB261:
+	.loc 1 212 14 view .LVU1762
+	.loc 1 212 39 view .LVU1763
+	.loc 1 212 64 view .LVU1764
+.LBB262:
+	.loc 1 212 69 view .LVU1765
+# Lib/munit_test/test_memory.c:212:         assert_hashC_exc(yp_hashC(x, &exc), ==, expected_hash);
+	.loc 1 212 79 is_stmt 0 view .LVU1766
+	movq	$0, -96(%rbp)	#, MEM[(struct ypObject * *)_271]
+	.loc 1 212 10 is_stmt 1 view .LVU1767
+# Lib/munit_test/test_memory.c:212:         assert_hashC_exc(yp_hashC(x, &exc), ==, expected_hash);
+	.loc 1 212 27 is_stmt 0 view .LVU1768
+	leaq	-96(%rbp), %rsi	#, tmp322
+	movq	%r14, %rdi	# x,
+	call	yp_hashC@PLT	#
+.LVL598:
+	.loc 1 212 27 view .LVU1769
+	movq	%rax, %r9	# tmp416, _ypmt_TYPEC_a
+.LVL599:
+	.loc 1 212 47 is_stmt 1 view .LVU1770
+	.loc 1 212 80 view .LVU1771
+# Lib/munit_test/test_memory.c:212:         assert_hashC_exc(yp_hashC(x, &exc), ==, expected_hash);
+	.loc 1 212 88 is_stmt 0 view .LVU1772
+	movq	-96(%rbp), %rdi	# MEM[(struct ypObject * *)_271], exc.119_46
+# Lib/munit_test/test_memory.c:212:         assert_hashC_exc(yp_hashC(x, &exc), ==, expected_hash);
+	.loc 1 212 83 view .LVU1773
+	testq	%rdi, %rdi	# exc.119_46
+	je	.L257	#,
+	.loc 1 212 12 is_stmt 1 discriminator 1 view .LVU1774
+# Lib/munit_test/test_memory.c:212:         assert_hashC_exc(yp_hashC(x, &exc), ==, expected_hash);
+	.loc 1 212 16 is_stmt 0 discriminator 1 view .LVU1775
+	call	yp_isexceptionC@PLT	#
+.LVL600:
+# Lib/munit_test/test_memory.c:212:         assert_hashC_exc(yp_hashC(x, &exc), ==, expected_hash);
+	.loc 1 212 15 discriminator 1 view .LVU1776
+	testl	%eax, %eax	# tmp417
+	je	.L258	#,
+	.loc 1 212 40 is_stmt 1 discriminator 3 view .LVU1777
+	leaq	.LC101(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp323
+	leaq	.LC17(%rip), %rdx	#, tmp324
+	movl	$212, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp325
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL601:
+.L258:
+	.loc 1 212 205 discriminator 4 view .LVU1778
+	leaq	.LC101(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp326
+	leaq	.LC18(%rip), %rdx	#, tmp327
+	movl	$212, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp328
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL602:
+.L257:
+	.loc 1 212 205 is_stmt 0 discriminator 4 view .LVU1779
+.LBE262:
+	.loc 1 212 67 is_stmt 1 discriminator 2 view .LVU1780
+	.loc 1 212 367 discriminator 2 view .LVU1781
+	.loc 1 212 372 discriminator 2 view .LVU1782
+# Lib/munit_test/test_memory.c:212:         assert_hashC_exc(yp_hashC(x, &exc), ==, expected_hash);
+	.loc 1 212 375 is_stmt 0 discriminator 2 view .LVU1783
+	cmpq	%rax, %r12	# _ypmt_TYPEC_a, expected_hash
+	jne	.L300	#,
+	.loc 1 212 370 is_stmt 1 discriminator 6 view .LVU1784
+.LBE261:
+	.loc 1 212 12 discriminator 6 view .LVU1785
+	.loc 1 213 9 discriminator 6 view .LVU1786
+	movq	-136(%rbp), %rdx	# %sfp,
+	movq	%r14, %rsi	# x,
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+.LVL603:
+	.loc 1 213 9 is_stmt 0 discriminator 6 view .LVU1787
+	call	yp_decrefN@PLT	#
+.LVL604:
+	.loc 1 213 9 discriminator 6 view .LVU1788
+.LBE247:
+.LBB264:
+	.loc 1 218 9 is_stmt 1 discriminator 6 view .LVU1789
+# Lib/munit_test/test_memory.c:218:         ypObject *tuple = yp_tupleN(N(items[0], items[1]));
+	.loc 1 218 27 is_stmt 0 discriminator 6 view .LVU1790
+	movq	-72(%rbp), %rdx	# items[1],
+	movq	-80(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_tupleN@PLT	#
+.LVL605:
+	movq	%rax, %r13	# tmp418, tuple
+.LVL606:
+	.loc 1 219 9 is_stmt 1 discriminator 6 view .LVU1791
+# Lib/munit_test/test_memory.c:219:         ypObject *x = yp_iter(tuple);
+	.loc 1 219 23 is_stmt 0 discriminator 6 view .LVU1792
+	movq	%rax, %rdi	# tuple,
+	call	yp_iter@PLT	#
+.LVL607:
+	.loc 1 219 23 discriminator 6 view .LVU1793
+	movq	%rax, %r12	# tmp419, x
+.LVL608:
+	.loc 1 220 9 is_stmt 1 discriminator 6 view .LVU1794
+.LBB265:
+	.loc 1 220 14 discriminator 6 view .LVU1795
+# Lib/munit_test/test_memory.c:220:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 220 34 is_stmt 0 discriminator 6 view .LVU1796
+	movq	%rax, %rdi	# x,
+	call	yp_next@PLT	#
+.LVL609:
+	.loc 1 220 34 discriminator 6 view .LVU1797
+	movq	%rax, %rdi	# tmp420, item
+.LVL610:
+	.loc 1 220 47 is_stmt 1 discriminator 6 view .LVU1798
+.LBB266:
+	.loc 1 220 52 discriminator 6 view .LVU1799
+	.loc 1 220 84 discriminator 6 view .LVU1800
+	.loc 1 220 120 discriminator 6 view .LVU1801
+.LBB267:
+	.loc 1 220 125 discriminator 6 view .LVU1802
+# Lib/munit_test/test_memory.c:220:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 220 196 is_stmt 0 discriminator 6 view .LVU1803
+	cmpq	-80(%rbp), %rax	# items[0], item
+	je	.L275	#,
+# Lib/munit_test/test_memory.c:220:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 220 196 discriminator 2 view .LVU1804
+	movq	yp_False(%rip), %rax	# yp_False, iftmp.121_60
+.LVL611:
+.L260:
+	.loc 1 220 209 is_stmt 1 discriminator 4 view .LVU1805
+	.loc 1 220 214 discriminator 4 view .LVU1806
+# Lib/munit_test/test_memory.c:220:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 220 217 is_stmt 0 discriminator 4 view .LVU1807
+	cmpq	%rax, yp_True(%rip)	# iftmp.121_60, yp_True
+	je	.L261	#,
+	.loc 1 220 256 is_stmt 1 discriminator 6 view .LVU1808
+# Lib/munit_test/test_memory.c:220:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 220 259 is_stmt 0 discriminator 6 view .LVU1809
+	cmpq	%rax, yp_False(%rip)	# iftmp.121_60, yp_False
+	je	.L301	#,
+	.loc 1 220 448 is_stmt 1 discriminator 8 view .LVU1810
+	.loc 1 220 453 discriminator 8 view .LVU1811
+	.loc 1 220 458 discriminator 8 view .LVU1812
+# Lib/munit_test/test_memory.c:220:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 220 462 is_stmt 0 discriminator 8 view .LVU1813
+	movq	%rax, %rdi	# iftmp.121_60,
+.LVL612:
+	.loc 1 220 462 discriminator 8 view .LVU1814
+	call	yp_isexceptionC@PLT	#
+.LVL613:
+# Lib/munit_test/test_memory.c:220:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 220 461 discriminator 8 view .LVU1815
+	testl	%eax, %eax	# tmp421
+	je	.L263	#,
+	.loc 1 220 499 is_stmt 1 discriminator 9 view .LVU1816
+	leaq	.LC102(%rip), %r8	#,
+	leaq	.LC69(%rip), %rcx	#, tmp337
+	leaq	.LC72(%rip), %rdx	#, tmp338
+	movl	$220, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp339
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL614:
+.L300:
+	.loc 1 220 499 is_stmt 0 discriminator 9 view .LVU1817
+.LBE267:
+.LBE266:
+.LBE265:
+.LBE264:
+.LBB281:
+.LBB263:
+	.loc 1 212 413 is_stmt 1 discriminator 5 view .LVU1818
+	subq	$8, %rsp	#,
+	pushq	%r12	# expected_hash
+	leaq	.LC101(%rip), %r8	#,
+	leaq	.LC81(%rip), %rcx	#, tmp329
+	leaq	.LC19(%rip), %rdx	#, tmp330
+	movl	$212, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp331
+	movl	$0, %eax	#,
+.LVL615:
+	.loc 1 212 413 is_stmt 0 discriminator 5 view .LVU1819
+	call	munit_errorf_ex@PLT	#
+.LVL616:
+.L275:
+	.loc 1 212 413 discriminator 5 view .LVU1820
+.LBE263:
+.LBE281:
+.LBB282:
+.LBB270:
+.LBB269:
+.LBB268:
+# Lib/munit_test/test_memory.c:220:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 220 196 view .LVU1821
+	movq	yp_True(%rip), %rax	# yp_True, iftmp.121_60
+.LVL617:
+	.loc 1 220 196 view .LVU1822
+	jmp	.L260	#
+.LVL618:
+.L301:
+	.loc 1 220 292 is_stmt 1 discriminator 7 view .LVU1823
+	leaq	.LC102(%rip), %r8	#,
+	leaq	.LC69(%rip), %rcx	#, tmp334
+	leaq	.LC71(%rip), %rdx	#, tmp335
+	movl	$220, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp336
+.LVL619:
+	.loc 1 220 292 is_stmt 0 discriminator 7 view .LVU1824
+	movl	$0, %eax	#,
+.LVL620:
+	.loc 1 220 292 discriminator 7 view .LVU1825
+	call	munit_errorf_ex@PLT	#
+.LVL621:
+.L263:
+	.loc 1 220 456 is_stmt 1 discriminator 10 view .LVU1826
+	.loc 1 220 665 discriminator 10 view .LVU1827
+	leaq	.LC102(%rip), %r8	#,
+	leaq	.LC69(%rip), %rcx	#, tmp340
+	leaq	.LC73(%rip), %rdx	#, tmp341
+	movl	$220, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp342
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL622:
+.L261:
+	.loc 1 220 249 view .LVU1828
+	.loc 1 220 451 view .LVU1829
+	.loc 1 220 212 view .LVU1830
+.LBE268:
+	.loc 1 220 123 view .LVU1831
+.LBE269:
+	.loc 1 220 50 view .LVU1832
+	.loc 1 220 867 view .LVU1833
+	call	yp_decref@PLT	#
+.LVL623:
+	.loc 1 220 867 is_stmt 0 view .LVU1834
+.LBE270:
+	.loc 1 220 12 is_stmt 1 view .LVU1835
+	.loc 1 221 9 view .LVU1836
+	movq	%r12, %rdi	# x,
+	call	yp_decref@PLT	#
+.LVL624:
+	.loc 1 222 9 view .LVU1837
+# Lib/munit_test/test_memory.c:222:         x = yp_iter(tuple);
+	.loc 1 222 13 is_stmt 0 view .LVU1838
+	movq	%r13, %rdi	# tuple,
+	call	yp_iter@PLT	#
+.LVL625:
+	movq	%rax, %r12	# tmp422, x
+.LVL626:
+	.loc 1 223 9 is_stmt 1 view .LVU1839
+.LBB271:
+	.loc 1 223 14 view .LVU1840
+# Lib/munit_test/test_memory.c:223:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 223 34 is_stmt 0 view .LVU1841
+	movq	%rax, %rdi	# x,
+	call	yp_next@PLT	#
+.LVL627:
+	.loc 1 223 34 view .LVU1842
+	movq	%rax, %rdi	# tmp423, item
+.LVL628:
+	.loc 1 223 47 is_stmt 1 view .LVU1843
+.LBB272:
+	.loc 1 223 52 view .LVU1844
+	.loc 1 223 84 view .LVU1845
+	.loc 1 223 120 view .LVU1846
+.LBB273:
+	.loc 1 223 125 view .LVU1847
+# Lib/munit_test/test_memory.c:223:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 223 196 is_stmt 0 view .LVU1848
+	cmpq	-80(%rbp), %rax	# items[0], item
+	je	.L276	#,
+# Lib/munit_test/test_memory.c:223:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 223 196 discriminator 2 view .LVU1849
+	movq	yp_False(%rip), %rax	# yp_False, iftmp.124_61
+.LVL629:
+.L264:
+	.loc 1 223 209 is_stmt 1 discriminator 4 view .LVU1850
+	.loc 1 223 214 discriminator 4 view .LVU1851
+# Lib/munit_test/test_memory.c:223:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 223 217 is_stmt 0 discriminator 4 view .LVU1852
+	cmpq	%rax, yp_True(%rip)	# iftmp.124_61, yp_True
+	je	.L265	#,
+	.loc 1 223 256 is_stmt 1 discriminator 6 view .LVU1853
+# Lib/munit_test/test_memory.c:223:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 223 259 is_stmt 0 discriminator 6 view .LVU1854
+	cmpq	%rax, yp_False(%rip)	# iftmp.124_61, yp_False
+	je	.L302	#,
+	.loc 1 223 448 is_stmt 1 discriminator 8 view .LVU1855
+	.loc 1 223 453 discriminator 8 view .LVU1856
+	.loc 1 223 458 discriminator 8 view .LVU1857
+# Lib/munit_test/test_memory.c:223:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 223 462 is_stmt 0 discriminator 8 view .LVU1858
+	movq	%rax, %rdi	# iftmp.124_61,
+.LVL630:
+	.loc 1 223 462 discriminator 8 view .LVU1859
+	call	yp_isexceptionC@PLT	#
+.LVL631:
+# Lib/munit_test/test_memory.c:223:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 223 461 discriminator 8 view .LVU1860
+	testl	%eax, %eax	# tmp424
+	je	.L267	#,
+	.loc 1 223 499 is_stmt 1 discriminator 9 view .LVU1861
+	leaq	.LC102(%rip), %r8	#,
+	leaq	.LC69(%rip), %rcx	#, tmp346
+	leaq	.LC72(%rip), %rdx	#, tmp347
+	movl	$223, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp348
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL632:
+.L276:
+# Lib/munit_test/test_memory.c:223:         ead(item, yp_next(x), assert_obj(item, is, items[0]));
+	.loc 1 223 196 is_stmt 0 view .LVU1862
+	movq	yp_True(%rip), %rax	# yp_True, iftmp.124_61
+.LVL633:
+	.loc 1 223 196 view .LVU1863
+	jmp	.L264	#
+.LVL634:
+.L302:
+	.loc 1 223 292 is_stmt 1 discriminator 7 view .LVU1864
+	leaq	.LC102(%rip), %r8	#,
+	leaq	.LC69(%rip), %rcx	#, tmp343
+	leaq	.LC71(%rip), %rdx	#, tmp344
+	movl	$223, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp345
+.LVL635:
+	.loc 1 223 292 is_stmt 0 discriminator 7 view .LVU1865
+	movl	$0, %eax	#,
+.LVL636:
+	.loc 1 223 292 discriminator 7 view .LVU1866
+	call	munit_errorf_ex@PLT	#
+.LVL637:
+.L267:
+	.loc 1 223 456 is_stmt 1 discriminator 10 view .LVU1867
+	.loc 1 223 665 discriminator 10 view .LVU1868
+	leaq	.LC102(%rip), %r8	#,
+	leaq	.LC69(%rip), %rcx	#, tmp349
+	leaq	.LC73(%rip), %rdx	#, tmp350
+	movl	$223, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp351
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL638:
+.L265:
+	.loc 1 223 249 view .LVU1869
+	.loc 1 223 451 view .LVU1870
+	.loc 1 223 212 view .LVU1871
+.LBE273:
+	.loc 1 223 123 view .LVU1872
+.LBE272:
+	.loc 1 223 50 view .LVU1873
+	.loc 1 223 867 view .LVU1874
+	call	yp_decref@PLT	#
+.LVL639:
+	.loc 1 223 867 is_stmt 0 view .LVU1875
+.LBE271:
+	.loc 1 223 12 is_stmt 1 view .LVU1876
+	.loc 1 224 9 view .LVU1877
+.LBB274:
+	.loc 1 224 14 view .LVU1878
+# Lib/munit_test/test_memory.c:224:         ead(item, yp_next(x), assert_obj(item, is, items[1]));
+	.loc 1 224 34 is_stmt 0 view .LVU1879
+	movq	%r12, %rdi	# x,
+	call	yp_next@PLT	#
+.LVL640:
+	movq	%rax, %rdi	# tmp425, item
+.LVL641:
+	.loc 1 224 47 is_stmt 1 view .LVU1880
+.LBB275:
+	.loc 1 224 52 view .LVU1881
+	.loc 1 224 84 view .LVU1882
+	.loc 1 224 120 view .LVU1883
+.LBB276:
+	.loc 1 224 125 view .LVU1884
+# Lib/munit_test/test_memory.c:224:         ead(item, yp_next(x), assert_obj(item, is, items[1]));
+	.loc 1 224 196 is_stmt 0 view .LVU1885
+	cmpq	-72(%rbp), %rax	# items[1], item
+	je	.L277	#,
+# Lib/munit_test/test_memory.c:224:         ead(item, yp_next(x), assert_obj(item, is, items[1]));
+	.loc 1 224 196 discriminator 2 view .LVU1886
+	movq	yp_False(%rip), %rax	# yp_False, iftmp.127_62
+.LVL642:
+.L268:
+	.loc 1 224 209 is_stmt 1 discriminator 4 view .LVU1887
+	.loc 1 224 214 discriminator 4 view .LVU1888
+# Lib/munit_test/test_memory.c:224:         ead(item, yp_next(x), assert_obj(item, is, items[1]));
+	.loc 1 224 217 is_stmt 0 discriminator 4 view .LVU1889
+	cmpq	%rax, yp_True(%rip)	# iftmp.127_62, yp_True
+	je	.L269	#,
+	.loc 1 224 256 is_stmt 1 discriminator 6 view .LVU1890
+# Lib/munit_test/test_memory.c:224:         ead(item, yp_next(x), assert_obj(item, is, items[1]));
+	.loc 1 224 259 is_stmt 0 discriminator 6 view .LVU1891
+	cmpq	%rax, yp_False(%rip)	# iftmp.127_62, yp_False
+	je	.L303	#,
+	.loc 1 224 448 is_stmt 1 discriminator 8 view .LVU1892
+	.loc 1 224 453 discriminator 8 view .LVU1893
+	.loc 1 224 458 discriminator 8 view .LVU1894
+# Lib/munit_test/test_memory.c:224:         ead(item, yp_next(x), assert_obj(item, is, items[1]));
+	.loc 1 224 462 is_stmt 0 discriminator 8 view .LVU1895
+	movq	%rax, %rdi	# iftmp.127_62,
+.LVL643:
+	.loc 1 224 462 discriminator 8 view .LVU1896
+	call	yp_isexceptionC@PLT	#
+.LVL644:
+# Lib/munit_test/test_memory.c:224:         ead(item, yp_next(x), assert_obj(item, is, items[1]));
+	.loc 1 224 461 discriminator 8 view .LVU1897
+	testl	%eax, %eax	# tmp426
+	je	.L271	#,
+	.loc 1 224 499 is_stmt 1 discriminator 9 view .LVU1898
+	leaq	.LC103(%rip), %r8	#,
+	leaq	.LC69(%rip), %rcx	#, tmp355
+	leaq	.LC72(%rip), %rdx	#, tmp356
+	movl	$224, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp357
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL645:
+.L277:
+# Lib/munit_test/test_memory.c:224:         ead(item, yp_next(x), assert_obj(item, is, items[1]));
+	.loc 1 224 196 is_stmt 0 view .LVU1899
+	movq	yp_True(%rip), %rax	# yp_True, iftmp.127_62
+.LVL646:
+	.loc 1 224 196 view .LVU1900
+	jmp	.L268	#
+.LVL647:
+.L303:
+	.loc 1 224 292 is_stmt 1 discriminator 7 view .LVU1901
+	leaq	.LC103(%rip), %r8	#,
+	leaq	.LC69(%rip), %rcx	#, tmp352
+	leaq	.LC71(%rip), %rdx	#, tmp353
+	movl	$224, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp354
+.LVL648:
+	.loc 1 224 292 is_stmt 0 discriminator 7 view .LVU1902
+	movl	$0, %eax	#,
+.LVL649:
+	.loc 1 224 292 discriminator 7 view .LVU1903
+	call	munit_errorf_ex@PLT	#
+.LVL650:
+.L271:
+	.loc 1 224 456 is_stmt 1 discriminator 10 view .LVU1904
+	.loc 1 224 665 discriminator 10 view .LVU1905
+	leaq	.LC103(%rip), %r8	#,
+	leaq	.LC69(%rip), %rcx	#, tmp358
+	leaq	.LC73(%rip), %rdx	#, tmp359
+	movl	$224, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp360
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL651:
+.L269:
+	.loc 1 224 249 view .LVU1906
+	.loc 1 224 451 view .LVU1907
+	.loc 1 224 212 view .LVU1908
+.LBE276:
+	.loc 1 224 123 view .LVU1909
+.LBE275:
+	.loc 1 224 50 view .LVU1910
+	.loc 1 224 867 view .LVU1911
+	call	yp_decref@PLT	#
+.LVL652:
+	.loc 1 224 867 is_stmt 0 view .LVU1912
+.LBE274:
+	.loc 1 224 12 is_stmt 1 view .LVU1913
+	.loc 1 225 9 view .LVU1914
+.LBB277:
+	.loc 1 225 14 view .LVU1915
+# Lib/munit_test/test_memory.c:225:         assert_raises(yp_next(x), yp_StopIteration);
+	.loc 1 225 24 is_stmt 0 view .LVU1916
+	movq	yp_StopIteration(%rip), %rax	# yp_StopIteration, yp_StopIteration
+	movq	%rax, -96(%rbp)	# yp_StopIteration, MEM[(struct ypObject *[1] *)_271][0]
+	.loc 1 225 70 is_stmt 1 view .LVU1917
+.LVL653:
+	.loc 1 225 196 view .LVU1918
+.LBB278:
+	.loc 1 225 201 view .LVU1919
+# Lib/munit_test/test_memory.c:225:         assert_raises(yp_next(x), yp_StopIteration);
+	.loc 1 225 237 is_stmt 0 view .LVU1920
+	movq	%r12, %rdi	# x,
+	call	yp_next@PLT	#
+.LVL654:
+	movq	%rax, %r14	# tmp427, _ypmt_RAISES_statement
+.LVL655:
+	.loc 1 225 250 is_stmt 1 view .LVU1921
+	.loc 1 225 255 view .LVU1922
+	.loc 1 225 386 view .LVU1923
+# Lib/munit_test/test_memory.c:225:         assert_raises(yp_next(x), yp_StopIteration);
+	.loc 1 225 391 is_stmt 0 view .LVU1924
+	movq	%rax, %rdi	# _ypmt_RAISES_statement,
+	call	yp_isexceptionC@PLT	#
+.LVL656:
+# Lib/munit_test/test_memory.c:225:         assert_raises(yp_next(x), yp_StopIteration);
+	.loc 1 225 389 view .LVU1925
+	testl	%eax, %eax	# tmp428
+	je	.L304	#,
+	.loc 1 225 591 is_stmt 1 discriminator 4 view .LVU1926
+# Lib/munit_test/test_memory.c:225:         assert_raises(yp_next(x), yp_StopIteration);
+	.loc 1 225 596 is_stmt 0 discriminator 4 view .LVU1927
+	leaq	-96(%rbp), %rdx	#, tmp365
+	movl	$1, %esi	#,
+	movq	%r14, %rdi	# _ypmt_RAISES_statement,
+	call	yp_isexception_arrayC@PLT	#
+.LVL657:
+# Lib/munit_test/test_memory.c:225:         assert_raises(yp_next(x), yp_StopIteration);
+	.loc 1 225 594 discriminator 4 view .LVU1928
+	testl	%eax, %eax	# tmp429
+	je	.L305	#,
+	.loc 1 225 253 is_stmt 1 discriminator 6 view .LVU1929
+.LBE278:
+	.loc 1 225 199 discriminator 6 view .LVU1930
+.LBE277:
+	.loc 1 225 12 discriminator 6 view .LVU1931
+	.loc 1 226 9 discriminator 6 view .LVU1932
+	movq	%r13, %rdx	# tuple,
+	movq	%r12, %rsi	# x,
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_decrefN@PLT	#
+.LVL658:
+.LBE282:
+	.loc 1 229 5 discriminator 6 view .LVU1933
+	call	yp_mem_clear_freelists@PLT	#
+.LVL659:
+	.loc 1 230 5 discriminator 6 view .LVU1934
+	call	yp_mem_clear_freelists@PLT	#
+.LVL660:
+	.loc 1 232 5 discriminator 6 view .LVU1935
+	leaq	-80(%rbp), %rsi	#, tmp369
+	movl	$4, %edi	#,
+	call	obj_array_decref2@PLT	#
+.LVL661:
+	.loc 1 233 5 discriminator 6 view .LVU1936
+	movq	%rbx, %rdi	# uq,
+	call	uniqueness_dealloc@PLT	#
+.LVL662:
+	.loc 1 234 5 discriminator 6 view .LVU1937
+# Lib/munit_test/test_memory.c:235: }
+	.loc 1 235 1 is_stmt 0 discriminator 6 view .LVU1938
+	movl	$0, %eax	#,
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+.LVL663:
+	.loc 1 235 1 discriminator 6 view .LVU1939
+	popq	%r12	#
+.LVL664:
+	.loc 1 235 1 discriminator 6 view .LVU1940
+	popq	%r13	#
+.LVL665:
+	.loc 1 235 1 discriminator 6 view .LVU1941
+	popq	%r14	#
+.LVL666:
+	.loc 1 235 1 discriminator 6 view .LVU1942
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL667:
+	.loc 1 235 1 discriminator 6 view .LVU1943
+	ret	
+.LVL668:
+.L304:
+	.cfi_restore_state
+.LBB283:
+.LBB280:
+.LBB279:
+	.loc 1 225 434 is_stmt 1 discriminator 3 view .LVU1944
+	leaq	.LC104(%rip), %r8	#,
+	leaq	.LC105(%rip), %rcx	#, tmp362
+	leaq	.LC106(%rip), %rdx	#, tmp363
+	movl	$225, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp364
+	call	munit_errorf_ex@PLT	#
+.LVL669:
+.L305:
+	.loc 1 225 684 discriminator 5 view .LVU1945
+	leaq	.LC104(%rip), %r8	#,
+	leaq	.LC105(%rip), %rcx	#, tmp366
+	leaq	.LC107(%rip), %rdx	#, tmp367
+	movl	$225, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp368
+	call	munit_errorf_ex@PLT	#
+.LVL670:
+.LBE279:
+.LBE280:
+.LBE283:
+	.cfi_endproc
+.LFE31:
+	.size	test_freelists, .-test_freelists
+	.type	_test_thread_exit_malloc_free, @function
+_test_thread_exit_malloc_free:
+.LVL671:
+.LFB29:
+	.loc 1 138 1 view -0
+	.cfi_startproc
+	.loc 1 138 1 is_stmt 0 view .LVU1947
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$16, %rsp	#,
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	movq	%rdi, %r12	# tmp87, p
+	.loc 1 139 5 is_stmt 1 view .LVU1948
+	.loc 1 140 5 view .LVU1949
+# Lib/munit_test/test_memory.c:140:     void      *buf = yp_mem_default_malloc(&actual, 200);
+	.loc 1 140 17 is_stmt 0 view .LVU1950
+	leaq	-24(%rbp), %rdi	#, tmp85
+.LVL672:
+	.loc 1 140 17 view .LVU1951
+	movl	$200, %esi	#,
+	call	yp_mem_default_malloc@PLT	#
+.LVL673:
+	movq	%rax, %rbx	# tmp88, buf
+.LVL674:
+	.loc 1 141 5 is_stmt 1 view .LVU1952
+# Lib/munit_test/test_memory.c:141:     if (buf != NULL) yp_mem_default_free(buf);
+	.loc 1 141 8 is_stmt 0 view .LVU1953
+	testq	%rax, %rax	# buf
+	je	.L307	#,
+	.loc 1 141 21 is_stmt 1 discriminator 1 view .LVU1954
+	movq	%rax, %rdi	# buf,
+	call	yp_mem_default_free@PLT	#
+.LVL675:
+.L307:
+	.loc 1 142 5 view .LVU1955
+# Lib/munit_test/test_memory.c:142:     *(void **)p = buf;
+	.loc 1 142 17 is_stmt 0 view .LVU1956
+	movq	%rbx, (%r12)	# buf, MEM[(void * *)p_6(D)]
+	.loc 1 143 5 is_stmt 1 view .LVU1957
+# Lib/munit_test/test_memory.c:144: }
+	.loc 1 144 1 is_stmt 0 view .LVU1958
+	movl	$0, %eax	#,
+	addq	$16, %rsp	#,
+	popq	%rbx	#
+.LVL676:
+	.loc 1 144 1 view .LVU1959
+	popq	%r12	#
+.LVL677:
+	.loc 1 144 1 view .LVU1960
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE29:
+	.size	_test_thread_exit_malloc_free, .-_test_thread_exit_malloc_free
+	.section	.rodata.str1.8
+	.align 8
+.LC108:
+	.string	"p = yp_mem_default_malloc(&actual, allocation_sizes[i])"
+	.section	.rodata.str1.1
+.LC109:
+	.string	"p"
+	.section	.rodata.str1.8
+	.align 8
+.LC110:
+	.string	"yp_mem_default_malloc_resize(&newactual, p, actual, 0)"
+	.section	.rodata.str1.1
+.LC111:
+	.string	"actual"
+.LC112:
+	.string	"newactual"
+	.text
+	.type	test_malloc_resize_inplace, @function
+test_malloc_resize_inplace:
+.LVL678:
+.LFB27:
+	.loc 1 117 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 117 1 is_stmt 0 view .LVU1962
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$16, %rsp	#,
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	.loc 1 118 5 is_stmt 1 view .LVU1963
+	.loc 1 119 5 view .LVU1964
+.LVL679:
+# Lib/munit_test/test_memory.c:119:     for (i = 0; i < yp_lengthof_array(allocation_sizes); i++) {
+	.loc 1 119 12 is_stmt 0 view .LVU1965
+	movl	$0, %r12d	#, i
+.LVL680:
+.L310:
+	.loc 1 119 19 is_stmt 1 discriminator 2 view .LVU1966
+	cmpq	$17, %r12	#, i
+	jg	.L316	#,
+.LBB284:
+	.loc 1 120 9 view .LVU1967
+	.loc 1 121 9 view .LVU1968
+	.loc 1 122 9 view .LVU1969
+	.loc 1 124 9 view .LVU1970
+.LBB285:
+	.loc 1 124 14 view .LVU1971
+# Lib/munit_test/test_memory.c:124:         assert_not_null(p = yp_mem_default_malloc(&actual, allocation_sizes[i]));
+	.loc 1 124 46 is_stmt 0 view .LVU1972
+	leaq	allocation_sizes(%rip), %rax	#, tmp92
+	movq	(%rax,%r12,8), %rsi	# allocation_sizes[i_3], allocation_sizes[i_3]
+	leaq	-32(%rbp), %rdi	#, tmp94
+	call	yp_mem_default_malloc@PLT	#
+.LVL681:
+	movq	%rax, %rbx	# tmp111, p
+.LVL682:
+	.loc 1 124 100 is_stmt 1 view .LVU1973
+	.loc 1 124 11 view .LVU1974
+# Lib/munit_test/test_memory.c:124:         assert_not_null(p = yp_mem_default_malloc(&actual, allocation_sizes[i]));
+	.loc 1 124 14 is_stmt 0 view .LVU1975
+	testq	%rax, %rax	# p
+	je	.L317	#,
+.LBE285:
+	.loc 1 124 12 is_stmt 1 discriminator 2 view .LVU1976
+	.loc 1 125 9 discriminator 2 view .LVU1977
+.LBB286:
+	.loc 1 125 14 discriminator 2 view .LVU1978
+# Lib/munit_test/test_memory.c:125:         assert_ptr(yp_mem_default_malloc_resize(&newactual, p, actual, 0), ==, p);
+	.loc 1 125 42 is_stmt 0 discriminator 2 view .LVU1979
+	leaq	-24(%rbp), %rdi	#, tmp100
+	movl	$0, %ecx	#,
+	movq	-32(%rbp), %rdx	# actual,
+	movq	%rax, %rsi	# p,
+	call	yp_mem_default_malloc_resize@PLT	#
+.LVL683:
+	.loc 1 125 99 is_stmt 1 discriminator 2 view .LVU1980
+	.loc 1 125 131 discriminator 2 view .LVU1981
+# Lib/munit_test/test_memory.c:125:         assert_ptr(yp_mem_default_malloc_resize(&newactual, p, actual, 0), ==, p);
+	.loc 1 125 134 is_stmt 0 discriminator 2 view .LVU1982
+	cmpq	%rax, %rbx	# munit_tmp_a_, p
+	jne	.L318	#,
+.LBE286:
+	.loc 1 125 12 is_stmt 1 discriminator 2 view .LVU1983
+	.loc 1 126 9 discriminator 2 view .LVU1984
+.LBB287:
+	.loc 1 126 14 discriminator 2 view .LVU1985
+# Lib/munit_test/test_memory.c:126:         assert_ssizeC(newactual, ==, actual);
+	.loc 1 126 25 is_stmt 0 discriminator 2 view .LVU1986
+	movq	-24(%rbp), %rax	# newactual, munit_tmp_a_
+.LVL684:
+	.loc 1 126 53 is_stmt 1 discriminator 2 view .LVU1987
+# Lib/munit_test/test_memory.c:126:         assert_ssizeC(newactual, ==, actual);
+	.loc 1 126 64 is_stmt 0 discriminator 2 view .LVU1988
+	movq	-32(%rbp), %rdx	# actual, munit_tmp_b_
+.LVL685:
+	.loc 1 126 89 is_stmt 1 discriminator 2 view .LVU1989
+# Lib/munit_test/test_memory.c:126:         assert_ssizeC(newactual, ==, actual);
+	.loc 1 126 92 is_stmt 0 discriminator 2 view .LVU1990
+	cmpq	%rdx, %rax	# munit_tmp_b_, munit_tmp_a_
+	jne	.L319	#,
+.LBE287:
+	.loc 1 126 12 is_stmt 1 discriminator 2 view .LVU1991
+	.loc 1 127 9 discriminator 2 view .LVU1992
+	movq	%rbx, %rdi	# p,
+	call	yp_mem_default_free@PLT	#
+.LVL686:
+	.loc 1 127 9 is_stmt 0 discriminator 2 view .LVU1993
+.LBE284:
+	.loc 1 119 110 is_stmt 1 discriminator 2 view .LVU1994
+	movl	$1, %esi	#,
+	movq	%r12, %rdi	# i,
+	call	__addvdi3@PLT	#
+.LVL687:
+	movq	%rax, %r12	# tmp113, i
+.LVL688:
+	.loc 1 119 110 is_stmt 0 discriminator 2 view .LVU1995
+	jmp	.L310	#
+.LVL689:
+.L317:
+.LBB291:
+.LBB288:
+	.loc 1 124 50 is_stmt 1 discriminator 1 view .LVU1996
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC54(%rip), %r8	#, tmp95
+	pushq	%r8	# tmp95
+	pushq	%rax	# p
+	leaq	.LC53(%rip), %r9	#,
+	leaq	.LC108(%rip), %rcx	#, tmp96
+	leaq	.LC56(%rip), %rdx	#, tmp97
+	movl	$124, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp98
+	movl	$0, %eax	#,
+.LVL690:
+	.loc 1 124 50 is_stmt 0 discriminator 1 view .LVU1997
+	call	munit_errorf_ex@PLT	#
+.LVL691:
+.L318:
+	.loc 1 124 50 discriminator 1 view .LVU1998
+.LBE288:
+.LBB289:
+	.loc 1 125 170 is_stmt 1 discriminator 1 view .LVU1999
+	subq	$8, %rsp	#,
+	pushq	%rbx	# p
+	leaq	.LC13(%rip), %r8	#, tmp101
+	pushq	%r8	# tmp101
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC109(%rip), %r9	#,
+	leaq	.LC110(%rip), %rcx	#, tmp102
+	leaq	.LC56(%rip), %rdx	#, tmp103
+	movl	$125, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp104
+	movl	$0, %eax	#,
+.LVL692:
+	.loc 1 125 170 is_stmt 0 discriminator 1 view .LVU2000
+	call	munit_errorf_ex@PLT	#
+.LVL693:
+.L319:
+	.loc 1 125 170 discriminator 1 view .LVU2001
+.LBE289:
+.LBB290:
+	.loc 1 126 128 is_stmt 1 discriminator 1 view .LVU2002
+	subq	$8, %rsp	#,
+	pushq	%rdx	# munit_tmp_b_
+	leaq	.LC13(%rip), %r8	#, tmp105
+	pushq	%r8	# tmp105
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC111(%rip), %r9	#,
+	leaq	.LC112(%rip), %rcx	#, tmp106
+	leaq	.LC11(%rip), %rdx	#, tmp107
+.LVL694:
+	.loc 1 126 128 is_stmt 0 discriminator 1 view .LVU2003
+	movl	$126, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp108
+	movl	$0, %eax	#,
+.LVL695:
+	.loc 1 126 128 discriminator 1 view .LVU2004
+	call	munit_errorf_ex@PLT	#
+.LVL696:
+.L316:
+	.loc 1 126 128 discriminator 1 view .LVU2005
+.LBE290:
+.LBE291:
+	.loc 1 130 5 is_stmt 1 view .LVU2006
+# Lib/munit_test/test_memory.c:131: }
+	.loc 1 131 1 is_stmt 0 view .LVU2007
+	movl	$0, %eax	#,
+	leaq	-16(%rbp), %rsp	#,
+	popq	%rbx	#
+	popq	%r12	#
+.LVL697:
+	.loc 1 131 1 view .LVU2008
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE27:
+	.size	test_malloc_resize_inplace, .-test_malloc_resize_inplace
+	.section	.rodata.str1.8
+	.align 8
+.LC113:
+	.string	"p = allocator->malloc(&actual, size)"
+	.align 8
+.LC114:
+	.string	"newp = allocator->malloc_resize(&newactual, p, newsize, 16)"
+	.section	.rodata.str1.1
+.LC115:
+	.string	"newsize"
+.LC116:
+	.string	">="
+.LC117:
+	.string	"0xCD"
+.LC118:
+	.string	"((yp_uint8_t *)p)[k]"
+	.text
+	.type	_test_malloc_resize, @function
+_test_malloc_resize:
+.LVL698:
+.LFB25:
+	.loc 1 75 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 75 1 is_stmt 0 view .LVU2010
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$40, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	%rdi, %r15	# tmp130, allocator
+	.loc 1 76 5 is_stmt 1 view .LVU2011
+	.loc 1 77 5 view .LVU2012
+.LVL699:
+# Lib/munit_test/test_memory.c:77:     for (i = 0; i < yp_lengthof_array(allocation_sizes); i++) {
+	.loc 1 77 12 is_stmt 0 view .LVU2013
+	movq	$0, -72(%rbp)	#, %sfp
+# Lib/munit_test/test_memory.c:77:     for (i = 0; i < yp_lengthof_array(allocation_sizes); i++) {
+	.loc 1 77 5 view .LVU2014
+	jmp	.L321	#
+.LVL700:
+.L335:
+.LBB292:
+.LBB293:
+	.loc 1 86 54 is_stmt 1 discriminator 1 view .LVU2015
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC54(%rip), %r8	#, tmp108
+	pushq	%r8	# tmp108
+	pushq	%rax	# p
+	leaq	.LC53(%rip), %r9	#,
+	leaq	.LC113(%rip), %rcx	#, tmp109
+	leaq	.LC56(%rip), %rdx	#, tmp110
+	movl	$86, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp111
+	movl	$0, %eax	#,
+.LVL701:
+	.loc 1 86 54 is_stmt 0 discriminator 1 view .LVU2016
+	call	munit_errorf_ex@PLT	#
+.LVL702:
+.L336:
+	.loc 1 86 54 discriminator 1 view .LVU2017
+.LBE293:
+.LBB294:
+	.loc 1 89 54 is_stmt 1 discriminator 1 view .LVU2018
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC54(%rip), %r8	#, tmp115
+	pushq	%r8	# tmp115
+	pushq	%rax	# newp
+	leaq	.LC53(%rip), %r9	#,
+	leaq	.LC114(%rip), %rcx	#, tmp116
+	leaq	.LC56(%rip), %rdx	#, tmp117
+	movl	$89, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp118
+	movl	$0, %eax	#,
+.LVL703:
+	.loc 1 89 54 is_stmt 0 discriminator 1 view .LVU2019
+	call	munit_errorf_ex@PLT	#
+.LVL704:
+.L337:
+	.loc 1 89 54 discriminator 1 view .LVU2020
+.LBE294:
+.LBB295:
+	.loc 1 90 133 is_stmt 1 discriminator 1 view .LVU2021
+	subq	$8, %rsp	#,
+	pushq	%r14	# newsize
+	leaq	.LC116(%rip), %r8	#, tmp119
+	pushq	%r8	# tmp119
+	pushq	%rdx	# munit_tmp_a_
+	leaq	.LC115(%rip), %r9	#,
+	leaq	.LC112(%rip), %rcx	#, tmp120
+	leaq	.LC11(%rip), %rdx	#, tmp121
+.LVL705:
+	.loc 1 90 133 is_stmt 0 discriminator 1 view .LVU2022
+	movl	$90, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp122
+	movl	$0, %eax	#,
+.LVL706:
+	.loc 1 90 133 discriminator 1 view .LVU2023
+	call	munit_errorf_ex@PLT	#
+.LVL707:
+.L338:
+	.loc 1 90 133 discriminator 1 view .LVU2024
+.LBE295:
+.LBB296:
+.LBB297:
+	.loc 1 96 145 is_stmt 1 discriminator 1 view .LVU2025
+	subq	$8, %rsp	#,
+	pushq	$205	#
+	leaq	.LC13(%rip), %r8	#, tmp123
+	pushq	%r8	# tmp123
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC117(%rip), %r9	#,
+	leaq	.LC118(%rip), %rcx	#, tmp124
+	leaq	.LC50(%rip), %rdx	#, tmp125
+	movl	$96, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp126
+.LVL708:
+	.loc 1 96 145 is_stmt 0 discriminator 1 view .LVU2026
+	movl	$0, %eax	#,
+.LVL709:
+	.loc 1 96 145 discriminator 1 view .LVU2027
+	call	munit_errorf_ex@PLT	#
+.LVL710:
+.L325:
+	.loc 1 96 145 discriminator 1 view .LVU2028
+.LBE297:
+.LBE296:
+	.loc 1 100 17 is_stmt 1 view .LVU2029
+	movl	$239, %esi	#,
+	movq	%rax, %rdi	# newp,
+	call	memset@PLT	#
+.LVL711:
+	.loc 1 101 17 view .LVU2030
+	movq	%rbx, %rdi	# p,
+	call	*16(%r15)	# allocator_23(D)->free
+.LVL712:
+.L329:
+	.loc 1 103 13 discriminator 2 view .LVU2031
+	movq	%r12, %rdi	# newp,
+	call	*16(%r15)	# allocator_23(D)->free
+.LVL713:
+.LBE292:
+	.loc 1 78 114 discriminator 2 view .LVU2032
+	movl	$1, %esi	#,
+	movq	%r13, %rdi	# j,
+	call	__addvdi3@PLT	#
+.LVL714:
+	movq	%rax, %r13	# tmp134, j
+.LVL715:
+.L331:
+	.loc 1 78 23 discriminator 1 view .LVU2033
+	cmpq	$17, %r13	#, j
+	jg	.L334	#,
+.LBB303:
+	.loc 1 79 13 view .LVU2034
+# Lib/munit_test/test_memory.c:79:             yp_ssize_t size = allocation_sizes[i];
+	.loc 1 79 24 is_stmt 0 view .LVU2035
+	leaq	allocation_sizes(%rip), %rax	#, tmp104
+	movq	-72(%rbp), %rcx	# %sfp, i
+	movq	(%rax,%rcx,8), %rsi	# allocation_sizes[i_12], size
+.LVL716:
+	.loc 1 80 13 is_stmt 1 view .LVU2036
+# Lib/munit_test/test_memory.c:80:             yp_ssize_t newsize = allocation_sizes[j];
+	.loc 1 80 24 is_stmt 0 view .LVU2037
+	movq	(%rax,%r13,8), %r14	# allocation_sizes[j_13], newsize
+.LVL717:
+	.loc 1 81 13 is_stmt 1 view .LVU2038
+	.loc 1 82 13 view .LVU2039
+# Lib/munit_test/test_memory.c:82:             yp_ssize_t newactual = -1;
+	.loc 1 82 24 is_stmt 0 view .LVU2040
+	movq	$-1, -56(%rbp)	#, newactual
+	.loc 1 83 13 is_stmt 1 view .LVU2041
+	.loc 1 84 13 view .LVU2042
+	.loc 1 86 13 view .LVU2043
+.LBB299:
+	.loc 1 86 18 view .LVU2044
+# Lib/munit_test/test_memory.c:86:             assert_not_null(p = allocator->malloc(&actual, size));
+	.loc 1 86 50 is_stmt 0 view .LVU2045
+	leaq	-64(%rbp), %rdi	#, tmp107
+	call	*(%r15)	# allocator_23(D)->malloc
+.LVL718:
+	.loc 1 86 50 view .LVU2046
+	movq	%rax, %rbx	# tmp131, p
+.LVL719:
+	.loc 1 86 85 is_stmt 1 view .LVU2047
+	.loc 1 86 15 view .LVU2048
+# Lib/munit_test/test_memory.c:86:             assert_not_null(p = allocator->malloc(&actual, size));
+	.loc 1 86 18 is_stmt 0 view .LVU2049
+	testq	%rax, %rax	# p
+	je	.L335	#,
+.LBE299:
+	.loc 1 86 16 is_stmt 1 discriminator 2 view .LVU2050
+	.loc 1 87 13 discriminator 2 view .LVU2051
+	movq	-64(%rbp), %rdx	# actual,
+	movl	$205, %esi	#,
+	movq	%rax, %rdi	# p,
+	call	memset@PLT	#
+.LVL720:
+	.loc 1 89 13 discriminator 2 view .LVU2052
+.LBB300:
+	.loc 1 89 18 discriminator 2 view .LVU2053
+# Lib/munit_test/test_memory.c:89:             assert_not_null(newp = allocator->malloc_resize(&newactual, p, newsize, 16));
+	.loc 1 89 53 is_stmt 0 discriminator 2 view .LVU2054
+	leaq	-56(%rbp), %rdi	#, tmp114
+	movl	$16, %ecx	#,
+	movq	%r14, %rdx	# newsize,
+	movq	%rbx, %rsi	# p,
+	call	*8(%r15)	# allocator_23(D)->malloc_resize
+.LVL721:
+	movq	%rax, %r12	# tmp132, newp
+.LVL722:
+	.loc 1 89 108 is_stmt 1 discriminator 2 view .LVU2055
+	.loc 1 89 15 discriminator 2 view .LVU2056
+# Lib/munit_test/test_memory.c:89:             assert_not_null(newp = allocator->malloc_resize(&newactual, p, newsize, 16));
+	.loc 1 89 18 is_stmt 0 discriminator 2 view .LVU2057
+	testq	%rax, %rax	# newp
+	je	.L336	#,
+.LBE300:
+	.loc 1 89 16 is_stmt 1 discriminator 2 view .LVU2058
+	.loc 1 90 13 discriminator 2 view .LVU2059
+.LBB301:
+	.loc 1 90 18 discriminator 2 view .LVU2060
+# Lib/munit_test/test_memory.c:90:             assert_ssizeC(newactual, >=, newsize);
+	.loc 1 90 29 is_stmt 0 discriminator 2 view .LVU2061
+	movq	-56(%rbp), %rdx	# newactual, munit_tmp_a_
+.LVL723:
+	.loc 1 90 57 is_stmt 1 discriminator 2 view .LVU2062
+	.loc 1 90 94 discriminator 2 view .LVU2063
+# Lib/munit_test/test_memory.c:90:             assert_ssizeC(newactual, >=, newsize);
+	.loc 1 90 97 is_stmt 0 discriminator 2 view .LVU2064
+	cmpq	%rdx, %r14	# munit_tmp_a_, newsize
+	jg	.L337	#,
+.LBE301:
+	.loc 1 90 16 is_stmt 1 discriminator 2 view .LVU2065
+	.loc 1 91 13 discriminator 2 view .LVU2066
+# Lib/munit_test/test_memory.c:91:             if (newp == p) {
+	.loc 1 91 16 is_stmt 0 discriminator 2 view .LVU2067
+	cmpq	%rax, %rbx	# newp, p
+	jne	.L325	#,
+.LBB302:
+	.loc 1 93 17 is_stmt 1 view .LVU2068
+	.loc 1 94 17 view .LVU2069
+# Lib/munit_test/test_memory.c:94:                 yp_ssize_t preserved = actual < newsize ? actual : newsize;
+	.loc 1 94 66 is_stmt 0 view .LVU2070
+	movq	-64(%rbp), %rax	# actual, actual.136_5
+.LVL724:
+# Lib/munit_test/test_memory.c:94:                 yp_ssize_t preserved = actual < newsize ? actual : newsize;
+	.loc 1 94 28 view .LVU2071
+	cmpq	%r14, %rax	# newsize, actual.136_5
+	cmovle	%rax, %r14	# actual.136_5,, preserved
+.LVL725:
+	.loc 1 95 17 is_stmt 1 view .LVU2072
+# Lib/munit_test/test_memory.c:95:                 for (k = 0; k < preserved; k++) {
+	.loc 1 95 24 is_stmt 0 view .LVU2073
+	movl	$0, %edi	#, k
+.LVL726:
+.L326:
+	.loc 1 95 31 is_stmt 1 discriminator 2 view .LVU2074
+	cmpq	%r14, %rdi	# preserved, k
+	jge	.L329	#,
+	.loc 1 96 21 view .LVU2075
+.LBB298:
+	.loc 1 96 26 view .LVU2076
+# Lib/munit_test/test_memory.c:96:                     assert_intC(((yp_uint8_t *)p)[k], ==, 0xCD);
+	.loc 1 96 35 is_stmt 0 view .LVU2077
+	movzbl	(%rbx,%rdi), %eax	# *_7, munit_tmp_a_
+.LVL727:
+	.loc 1 96 74 is_stmt 1 view .LVU2078
+	.loc 1 96 106 view .LVU2079
+# Lib/munit_test/test_memory.c:96:                     assert_intC(((yp_uint8_t *)p)[k], ==, 0xCD);
+	.loc 1 96 109 is_stmt 0 view .LVU2080
+	cmpq	$205, %rax	#, munit_tmp_a_
+	jne	.L338	#,
+.LBE298:
+	.loc 1 96 24 is_stmt 1 discriminator 2 view .LVU2081
+	.loc 1 95 45 discriminator 2 view .LVU2082
+	movl	$1, %esi	#,
+	call	__addvdi3@PLT	#
+.LVL728:
+	.loc 1 95 45 is_stmt 0 discriminator 2 view .LVU2083
+	movq	%rax, %rdi	# tmp133, k
+.LVL729:
+	.loc 1 95 45 discriminator 2 view .LVU2084
+	jmp	.L326	#
+.LVL730:
+.L334:
+	.loc 1 95 45 discriminator 2 view .LVU2085
+.LBE302:
+.LBE303:
+	.loc 1 77 110 is_stmt 1 discriminator 2 view .LVU2086
+	movl	$1, %esi	#,
+	movq	-72(%rbp), %rdi	# %sfp,
+	call	__addvdi3@PLT	#
+.LVL731:
+	movq	%rax, -72(%rbp)	# tmp135, %sfp
+.LVL732:
+.L321:
+	.loc 1 77 19 discriminator 1 view .LVU2087
+	cmpq	$17, -72(%rbp)	#, %sfp
+	jg	.L339	#,
+# Lib/munit_test/test_memory.c:78:         for (j = 0; j < yp_lengthof_array(allocation_sizes); j++) {
+	.loc 1 78 16 is_stmt 0 view .LVU2088
+	movl	$0, %r13d	#, j
+	jmp	.L331	#
+.L339:
+# Lib/munit_test/test_memory.c:106: }
+	.loc 1 106 1 view .LVU2089
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+	popq	%r12	#
+	popq	%r13	#
+	popq	%r14	#
+	popq	%r15	#
+.LVL733:
+	.loc 1 106 1 view .LVU2090
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+.LVL734:
+	.loc 1 106 1 view .LVU2091
+	ret	
+	.cfi_endproc
+.LFE25:
+	.size	_test_malloc_resize, .-_test_malloc_resize
+	.type	test_malloc_resize, @function
+test_malloc_resize:
+.LVL735:
+.LFB26:
+	.loc 1 109 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 109 1 is_stmt 0 view .LVU2093
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	.loc 1 110 5 is_stmt 1 view .LVU2094
+	leaq	allocator_default(%rip), %rdi	#, tmp85
+.LVL736:
+	.loc 1 110 5 is_stmt 0 view .LVU2095
+	call	_test_malloc_resize	#
+.LVL737:
+	.loc 1 111 5 is_stmt 1 view .LVU2096
+	leaq	allocator_system(%rip), %rdi	#, tmp86
+	call	_test_malloc_resize	#
+.LVL738:
+	.loc 1 112 5 view .LVU2097
+# Lib/munit_test/test_memory.c:113: }
+	.loc 1 113 1 is_stmt 0 view .LVU2098
+	movl	$0, %eax	#,
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE26:
+	.size	test_malloc_resize, .-test_malloc_resize
+	.section	.rodata.str1.8
+	.align 8
+.LC119:
+	.string	"p[i] = yp_mem_default_malloc(&actual, 24)"
+	.section	.rodata.str1.1
+.LC120:
+	.string	"(int)(i % 256)"
+.LC121:
+	.string	"((yp_uint8_t *)p[i])[j]"
+	.text
+	.type	test_malloc_reuse, @function
+test_malloc_reuse:
+.LVL739:
+.LFB24:
+	.loc 1 48 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 48 1 is_stmt 0 view .LVU2100
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%rbx	#
+	subq	$24, %rsp	#,
+	.cfi_offset 3, -24
+	.loc 1 50 5 is_stmt 1 view .LVU2101
+	.loc 1 51 5 view .LVU2102
+	.loc 1 52 5 view .LVU2103
+	.loc 1 54 5 view .LVU2104
+.LVL740:
+# Lib/munit_test/test_memory.c:54:     for (i = 0; i < reuse_COUNT; i++) {
+	.loc 1 54 12 is_stmt 0 view .LVU2105
+	movl	$0, %ebx	#, i
+.LVL741:
+.L343:
+	.loc 1 54 19 is_stmt 1 discriminator 2 view .LVU2106
+	cmpq	$999, %rbx	#, i
+	jg	.L357	#,
+	.loc 1 55 9 view .LVU2107
+.LBB304:
+	.loc 1 55 14 view .LVU2108
+# Lib/munit_test/test_memory.c:55:         assert_not_null(p[i] = yp_mem_default_malloc(&actual, 24));
+	.loc 1 55 49 is_stmt 0 view .LVU2109
+	leaq	-24(%rbp), %rdi	#, tmp106
+	movl	$24, %esi	#,
+	call	yp_mem_default_malloc@PLT	#
+.LVL742:
+# Lib/munit_test/test_memory.c:55:         assert_not_null(p[i] = yp_mem_default_malloc(&actual, 24));
+	.loc 1 55 47 view .LVU2110
+	leaq	p.0(%rip), %rdx	#, tmp107
+	movq	%rax, (%rdx,%rbx,8)	# _1, p[i_15]
+.LVL743:
+	.loc 1 55 86 is_stmt 1 view .LVU2111
+	.loc 1 55 11 view .LVU2112
+# Lib/munit_test/test_memory.c:55:         assert_not_null(p[i] = yp_mem_default_malloc(&actual, 24));
+	.loc 1 55 14 is_stmt 0 view .LVU2113
+	testq	%rax, %rax	# _1
+	je	.L358	#,
+.LBE304:
+	.loc 1 55 12 is_stmt 1 discriminator 2 view .LVU2114
+	.loc 1 56 9 discriminator 2 view .LVU2115
+# Lib/munit_test/test_memory.c:56:         memset(p[i], (int)(i % 256), 24);
+	.loc 1 56 30 is_stmt 0 discriminator 2 view .LVU2116
+	movq	%rbx, %rcx	# i, tmp112
+	sarq	$63, %rcx	#, tmp112
+	shrq	$56, %rcx	#, tmp113
+	leaq	(%rbx,%rcx), %rdx	#, tmp114
+	movzbl	%dl, %edx	# tmp114, tmp115
+	subq	%rcx, %rdx	# tmp113, tmp116
+# Lib/munit_test/test_memory.c:56:         memset(p[i], (int)(i % 256), 24);
+	.loc 1 56 9 discriminator 2 view .LVU2117
+	movd	%edx, %xmm0	# tmp116, tmp121
+	punpcklbw	%xmm0, %xmm0	# tmp121, tmp122
+	punpcklwd	%xmm0, %xmm0	# tmp122, tmp123
+	pshufd	$0, %xmm0, %xmm0	#, tmp123, tmp124
+	movups	%xmm0, (%rax)	# tmp124, MEM <char[1:24]> [(void *)_1]
+	movq	%xmm0, 16(%rax)	# tmp124, MEM <char[1:24]> [(void *)_1]
+	.loc 1 54 28 is_stmt 1 discriminator 2 view .LVU2118
+	movl	$1, %esi	#,
+	movq	%rbx, %rdi	# i,
+	call	__addvdi3@PLT	#
+.LVL744:
+	.loc 1 54 28 is_stmt 0 discriminator 2 view .LVU2119
+	movq	%rax, %rbx	# tmp165, i
+.LVL745:
+	.loc 1 54 28 discriminator 2 view .LVU2120
+	jmp	.L343	#
+.LVL746:
+.L358:
+.LBB305:
+	.loc 1 55 50 is_stmt 1 discriminator 1 view .LVU2121
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC54(%rip), %r8	#, tmp108
+	pushq	%r8	# tmp108
+	pushq	%rax	# _1
+	leaq	.LC53(%rip), %r9	#,
+	leaq	.LC119(%rip), %rcx	#, tmp109
+	leaq	.LC56(%rip), %rdx	#, tmp110
+	movl	$55, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp111
+	call	munit_errorf_ex@PLT	#
+.LVL747:
+.L357:
+	.loc 1 55 50 is_stmt 0 discriminator 1 view .LVU2122
+.LBE305:
+# Lib/munit_test/test_memory.c:59:     for (i = 0; i < reuse_COUNT; i += 2) yp_mem_default_free(p[i]);
+	.loc 1 59 12 view .LVU2123
+	movl	$0, %ebx	#, i
+.LVL748:
+	.loc 1 59 12 view .LVU2124
+	jmp	.L346	#
+.LVL749:
+.L347:
+	.loc 1 59 35 is_stmt 1 discriminator 3 view .LVU2125
+	leaq	p.0(%rip), %rax	#, tmp126
+	movq	(%rax,%rbx,8), %rdi	# p[i_16], p[i_16]
+	call	yp_mem_default_free@PLT	#
+.LVL750:
+	.loc 1 59 29 discriminator 3 view .LVU2126
+	movl	$2, %esi	#,
+	movq	%rbx, %rdi	# i,
+	call	__addvdi3@PLT	#
+.LVL751:
+	movq	%rax, %rbx	# tmp166, i
+.LVL752:
+.L346:
+	.loc 1 59 19 discriminator 1 view .LVU2127
+	cmpq	$999, %rbx	#, i
+	jle	.L347	#,
+# Lib/munit_test/test_memory.c:60:     for (i = 0; i < reuse_COUNT; i += 2) {
+	.loc 1 60 12 is_stmt 0 view .LVU2128
+	movl	$0, %ebx	#, i
+.LVL753:
+.L348:
+	.loc 1 60 19 is_stmt 1 discriminator 2 view .LVU2129
+	cmpq	$999, %rbx	#, i
+	jg	.L359	#,
+	.loc 1 61 9 view .LVU2130
+.LBB306:
+	.loc 1 61 14 view .LVU2131
+# Lib/munit_test/test_memory.c:61:         assert_not_null(p[i] = yp_mem_default_malloc(&actual, 24));
+	.loc 1 61 49 is_stmt 0 view .LVU2132
+	leaq	-24(%rbp), %rdi	#, tmp129
+	movl	$24, %esi	#,
+	call	yp_mem_default_malloc@PLT	#
+.LVL754:
+# Lib/munit_test/test_memory.c:61:         assert_not_null(p[i] = yp_mem_default_malloc(&actual, 24));
+	.loc 1 61 47 view .LVU2133
+	leaq	p.0(%rip), %rdx	#, tmp130
+	movq	%rax, (%rdx,%rbx,8)	# _5, p[i_17]
+.LVL755:
+	.loc 1 61 86 is_stmt 1 view .LVU2134
+	.loc 1 61 11 view .LVU2135
+# Lib/munit_test/test_memory.c:61:         assert_not_null(p[i] = yp_mem_default_malloc(&actual, 24));
+	.loc 1 61 14 is_stmt 0 view .LVU2136
+	testq	%rax, %rax	# _5
+	je	.L360	#,
+.LBE306:
+	.loc 1 61 12 is_stmt 1 discriminator 2 view .LVU2137
+	.loc 1 62 9 discriminator 2 view .LVU2138
+# Lib/munit_test/test_memory.c:62:         memset(p[i], (int)(i % 256), 24);
+	.loc 1 62 30 is_stmt 0 discriminator 2 view .LVU2139
+	movq	%rbx, %rcx	# i, tmp135
+	sarq	$63, %rcx	#, tmp135
+	shrq	$56, %rcx	#, tmp136
+	leaq	(%rbx,%rcx), %rdx	#, tmp137
+	movzbl	%dl, %edx	# tmp137, tmp138
+	subq	%rcx, %rdx	# tmp136, tmp139
+# Lib/munit_test/test_memory.c:62:         memset(p[i], (int)(i % 256), 24);
+	.loc 1 62 9 discriminator 2 view .LVU2140
+	movd	%edx, %xmm0	# tmp139, tmp144
+	punpcklbw	%xmm0, %xmm0	# tmp144, tmp145
+	punpcklwd	%xmm0, %xmm0	# tmp145, tmp146
+	pshufd	$0, %xmm0, %xmm0	#, tmp146, tmp147
+	movups	%xmm0, (%rax)	# tmp147, MEM <char[1:24]> [(void *)_5]
+	movq	%xmm0, 16(%rax)	# tmp147, MEM <char[1:24]> [(void *)_5]
+	.loc 1 60 29 is_stmt 1 discriminator 2 view .LVU2141
+	movl	$2, %esi	#,
+	movq	%rbx, %rdi	# i,
+	call	__addvdi3@PLT	#
+.LVL756:
+	.loc 1 60 29 is_stmt 0 discriminator 2 view .LVU2142
+	movq	%rax, %rbx	# tmp168, i
+.LVL757:
+	.loc 1 60 29 discriminator 2 view .LVU2143
+	jmp	.L348	#
+.LVL758:
+.L360:
+.LBB307:
+	.loc 1 61 50 is_stmt 1 discriminator 1 view .LVU2144
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC54(%rip), %r8	#, tmp131
+	pushq	%r8	# tmp131
+	pushq	%rax	# _5
+	leaq	.LC53(%rip), %r9	#,
+	leaq	.LC119(%rip), %rcx	#, tmp132
+	leaq	.LC56(%rip), %rdx	#, tmp133
+	movl	$61, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp134
+	call	munit_errorf_ex@PLT	#
+.LVL759:
+.L359:
+	.loc 1 61 50 is_stmt 0 discriminator 1 view .LVU2145
+.LBE307:
+# Lib/munit_test/test_memory.c:64:     for (i = 0; i < reuse_COUNT; i++) {
+	.loc 1 64 12 view .LVU2146
+	movl	$0, %ebx	#, i
+.LVL760:
+	.loc 1 64 12 view .LVU2147
+	jmp	.L351	#
+.LVL761:
+.L363:
+.LBB308:
+	.loc 1 65 171 is_stmt 1 discriminator 2 view .LVU2148
+	subq	$8, %rsp	#,
+	pushq	%rdx	# munit_tmp_b_
+	leaq	.LC13(%rip), %r8	#, tmp155
+	pushq	%r8	# tmp155
+	pushq	%rcx	# munit_tmp_a_
+	leaq	.LC120(%rip), %r9	#,
+	leaq	.LC121(%rip), %rcx	#, tmp156
+.LVL762:
+	.loc 1 65 171 is_stmt 0 discriminator 2 view .LVU2149
+	leaq	.LC50(%rip), %rdx	#, tmp157
+.LVL763:
+	.loc 1 65 171 discriminator 2 view .LVU2150
+	movl	$65, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp158
+.LVL764:
+	.loc 1 65 171 discriminator 2 view .LVU2151
+	movl	$0, %eax	#,
+.LVL765:
+	.loc 1 65 171 discriminator 2 view .LVU2152
+	call	munit_errorf_ex@PLT	#
+.LVL766:
+.L362:
+	.loc 1 65 171 discriminator 2 view .LVU2153
+.LBE308:
+	.loc 1 66 9 is_stmt 1 discriminator 2 view .LVU2154
+	leaq	p.0(%rip), %rax	#, tmp160
+	movq	(%rax,%rbx,8), %rdi	# p[i_18], p[i_18]
+.LVL767:
+	.loc 1 66 9 is_stmt 0 discriminator 2 view .LVU2155
+	call	yp_mem_default_free@PLT	#
+.LVL768:
+	.loc 1 64 28 is_stmt 1 discriminator 2 view .LVU2156
+	movl	$1, %esi	#,
+	movq	%rbx, %rdi	# i,
+	call	__addvdi3@PLT	#
+.LVL769:
+	movq	%rax, %rbx	# tmp170, i
+.LVL770:
+.L351:
+	.loc 1 64 19 discriminator 1 view .LVU2157
+	cmpq	$999, %rbx	#, i
+	jg	.L361	#,
+# Lib/munit_test/test_memory.c:65:         for (j = 0; j < 24; j++) assert_intC(((yp_uint8_t *)p[i])[j], ==, (int)(i % 256));
+	.loc 1 65 16 is_stmt 0 view .LVU2158
+	movl	$0, %edi	#, j
+.L354:
+.LVL771:
+	.loc 1 65 23 is_stmt 1 discriminator 4 view .LVU2159
+	cmpq	$23, %rdi	#, j
+	jg	.L362	#,
+	.loc 1 65 34 discriminator 5 view .LVU2160
+.LBB309:
+	.loc 1 65 39 discriminator 5 view .LVU2161
+# Lib/munit_test/test_memory.c:65:         for (j = 0; j < 24; j++) assert_intC(((yp_uint8_t *)p[i])[j], ==, (int)(i % 256));
+	.loc 1 65 80 is_stmt 0 discriminator 5 view .LVU2162
+	leaq	p.0(%rip), %rax	#, tmp149
+	movq	(%rax,%rbx,8), %rax	# p[i_18], _8
+# Lib/munit_test/test_memory.c:65:         for (j = 0; j < 24; j++) assert_intC(((yp_uint8_t *)p[i])[j], ==, (int)(i % 256));
+	.loc 1 65 48 discriminator 5 view .LVU2163
+	movzbl	(%rax,%rdi), %ecx	# *_10, munit_tmp_a_
+.LVL772:
+	.loc 1 65 90 is_stmt 1 discriminator 5 view .LVU2164
+# Lib/munit_test/test_memory.c:65:         for (j = 0; j < 24; j++) assert_intC(((yp_uint8_t *)p[i])[j], ==, (int)(i % 256));
+	.loc 1 65 123 is_stmt 0 discriminator 5 view .LVU2165
+	movq	%rbx, %rax	# i, tmp150
+	sarq	$63, %rax	#, tmp150
+	shrq	$56, %rax	#, tmp151
+	leaq	(%rbx,%rax), %rdx	#, tmp152
+	movzbl	%dl, %edx	# tmp152, tmp153
+	subq	%rax, %rdx	# tmp151, tmp154
+# Lib/munit_test/test_memory.c:65:         for (j = 0; j < 24; j++) assert_intC(((yp_uint8_t *)p[i])[j], ==, (int)(i % 256));
+	.loc 1 65 99 discriminator 5 view .LVU2166
+	movslq	%edx, %rdx	# tmp154, munit_tmp_b_
+.LVL773:
+	.loc 1 65 132 is_stmt 1 discriminator 5 view .LVU2167
+# Lib/munit_test/test_memory.c:65:         for (j = 0; j < 24; j++) assert_intC(((yp_uint8_t *)p[i])[j], ==, (int)(i % 256));
+	.loc 1 65 135 is_stmt 0 discriminator 5 view .LVU2168
+	cmpq	%rdx, %rcx	# munit_tmp_b_, munit_tmp_a_
+	jne	.L363	#,
+.LBE309:
+	.loc 1 65 37 is_stmt 1 discriminator 3 view .LVU2169
+	.loc 1 65 30 discriminator 3 view .LVU2170
+	movl	$1, %esi	#,
+	call	__addvdi3@PLT	#
+.LVL774:
+	.loc 1 65 30 is_stmt 0 discriminator 3 view .LVU2171
+	movq	%rax, %rdi	# tmp169, j
+.LVL775:
+	.loc 1 65 30 discriminator 3 view .LVU2172
+	jmp	.L354	#
+.LVL776:
+.L361:
+	.loc 1 69 5 is_stmt 1 view .LVU2173
+# Lib/munit_test/test_memory.c:71: }
+	.loc 1 71 1 is_stmt 0 view .LVU2174
+	movl	$0, %eax	#,
+	movq	-8(%rbp), %rbx	#,
+.LVL777:
+	.loc 1 71 1 view .LVU2175
+	leave	
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE24:
+	.size	test_malloc_reuse, .-test_malloc_reuse
+	.section	.rodata.str1.1
+.LC122:
+	.string	"size"
+	.text
+	.type	_test_malloc, @function
+_test_malloc:
+.LVL778:
+.LFB22:
+	.loc 1 26 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 26 1 is_stmt 0 view .LVU2177
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$16, %rsp	#,
+	.cfi_offset 14, -24
+	.cfi_offset 13, -32
+	.cfi_offset 12, -40
+	.cfi_offset 3, -48
+	movq	%rdi, %r14	# tmp102, allocator
+	.loc 1 27 5 is_stmt 1 view .LVU2178
+	.loc 1 28 5 view .LVU2179
+.LVL779:
+# Lib/munit_test/test_memory.c:28:     for (i = 0; i < yp_lengthof_array(allocation_sizes); i++) {
+	.loc 1 28 12 is_stmt 0 view .LVU2180
+	movl	$0, %ebx	#, i
+.LVL780:
+.L365:
+	.loc 1 28 19 is_stmt 1 discriminator 2 view .LVU2181
+	cmpq	$17, %rbx	#, i
+	jg	.L370	#,
+.LBB310:
+	.loc 1 29 9 view .LVU2182
+# Lib/munit_test/test_memory.c:29:         yp_ssize_t size = allocation_sizes[i];
+	.loc 1 29 20 is_stmt 0 view .LVU2183
+	leaq	allocation_sizes(%rip), %rax	#, tmp90
+	movq	(%rax,%rbx,8), %r13	# allocation_sizes[i_4], size
+.LVL781:
+	.loc 1 30 9 is_stmt 1 view .LVU2184
+# Lib/munit_test/test_memory.c:30:         yp_ssize_t actual = -1;
+	.loc 1 30 20 is_stmt 0 view .LVU2185
+	movq	$-1, -40(%rbp)	#, actual
+	.loc 1 31 9 is_stmt 1 view .LVU2186
+	.loc 1 32 9 view .LVU2187
+.LBB311:
+	.loc 1 32 14 view .LVU2188
+# Lib/munit_test/test_memory.c:32:         assert_not_null(p = allocator->malloc(&actual, size));
+	.loc 1 32 46 is_stmt 0 view .LVU2189
+	leaq	-40(%rbp), %rdi	#, tmp92
+	movq	%r13, %rsi	# size,
+	call	*(%r14)	# allocator_9(D)->malloc
+.LVL782:
+	movq	%rax, %r12	# tmp103, p
+.LVL783:
+	.loc 1 32 81 is_stmt 1 view .LVU2190
+	.loc 1 32 11 view .LVU2191
+# Lib/munit_test/test_memory.c:32:         assert_not_null(p = allocator->malloc(&actual, size));
+	.loc 1 32 14 is_stmt 0 view .LVU2192
+	testq	%rax, %rax	# p
+	je	.L371	#,
+.LBE311:
+	.loc 1 32 12 is_stmt 1 discriminator 2 view .LVU2193
+	.loc 1 33 9 discriminator 2 view .LVU2194
+.LBB312:
+	.loc 1 33 14 discriminator 2 view .LVU2195
+# Lib/munit_test/test_memory.c:33:         assert_ssizeC(actual, >=, size);
+	.loc 1 33 25 is_stmt 0 discriminator 2 view .LVU2196
+	movq	-40(%rbp), %rdx	# actual, munit_tmp_a_
+.LVL784:
+	.loc 1 33 50 is_stmt 1 discriminator 2 view .LVU2197
+	.loc 1 33 84 discriminator 2 view .LVU2198
+# Lib/munit_test/test_memory.c:33:         assert_ssizeC(actual, >=, size);
+	.loc 1 33 87 is_stmt 0 discriminator 2 view .LVU2199
+	cmpq	%rdx, %r13	# munit_tmp_a_, size
+	jg	.L372	#,
+.LBE312:
+	.loc 1 33 12 is_stmt 1 discriminator 2 view .LVU2200
+	.loc 1 34 9 discriminator 2 view .LVU2201
+	movl	$171, %esi	#,
+	movq	%rax, %rdi	# p,
+	call	memset@PLT	#
+.LVL785:
+	.loc 1 35 9 discriminator 2 view .LVU2202
+	movq	%r12, %rdi	# p,
+	call	*16(%r14)	# allocator_9(D)->free
+.LVL786:
+.LBE310:
+	.loc 1 28 110 discriminator 2 view .LVU2203
+	movl	$1, %esi	#,
+	movq	%rbx, %rdi	# i,
+	call	__addvdi3@PLT	#
+.LVL787:
+	movq	%rax, %rbx	# tmp104, i
+.LVL788:
+	.loc 1 28 110 is_stmt 0 discriminator 2 view .LVU2204
+	jmp	.L365	#
+.LVL789:
+.L371:
+.LBB315:
+.LBB313:
+	.loc 1 32 50 is_stmt 1 discriminator 1 view .LVU2205
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC54(%rip), %r8	#, tmp93
+	pushq	%r8	# tmp93
+	pushq	%rax	# p
+	leaq	.LC53(%rip), %r9	#,
+	leaq	.LC113(%rip), %rcx	#, tmp94
+	leaq	.LC56(%rip), %rdx	#, tmp95
+	movl	$32, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp96
+	movl	$0, %eax	#,
+.LVL790:
+	.loc 1 32 50 is_stmt 0 discriminator 1 view .LVU2206
+	call	munit_errorf_ex@PLT	#
+.LVL791:
+.L372:
+	.loc 1 32 50 discriminator 1 view .LVU2207
+.LBE313:
+.LBB314:
+	.loc 1 33 123 is_stmt 1 discriminator 1 view .LVU2208
+	subq	$8, %rsp	#,
+	pushq	%r13	# size
+	leaq	.LC116(%rip), %r8	#, tmp97
+	pushq	%r8	# tmp97
+	pushq	%rdx	# munit_tmp_a_
+	leaq	.LC122(%rip), %r9	#,
+	leaq	.LC111(%rip), %rcx	#, tmp98
+	leaq	.LC11(%rip), %rdx	#, tmp99
+.LVL792:
+	.loc 1 33 123 is_stmt 0 discriminator 1 view .LVU2209
+	movl	$33, %esi	#,
+	leaq	.LC2(%rip), %rdi	#, tmp100
+	movl	$0, %eax	#,
+.LVL793:
+	.loc 1 33 123 discriminator 1 view .LVU2210
+	call	munit_errorf_ex@PLT	#
+.LVL794:
+.L370:
+	.loc 1 33 123 discriminator 1 view .LVU2211
+.LBE314:
+.LBE315:
+# Lib/munit_test/test_memory.c:37: }
+	.loc 1 37 1 view .LVU2212
+	leaq	-32(%rbp), %rsp	#,
+	popq	%rbx	#
+.LVL795:
+	.loc 1 37 1 view .LVU2213
+	popq	%r12	#
+	popq	%r13	#
+	popq	%r14	#
+.LVL796:
+	.loc 1 37 1 view .LVU2214
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE22:
+	.size	_test_malloc, .-_test_malloc
+	.type	test_malloc, @function
+test_malloc:
+.LVL797:
+.LFB23:
+	.loc 1 40 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 40 1 is_stmt 0 view .LVU2216
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	.loc 1 41 5 is_stmt 1 view .LVU2217
+	leaq	allocator_default(%rip), %rdi	#, tmp85
+.LVL798:
+	.loc 1 41 5 is_stmt 0 view .LVU2218
+	call	_test_malloc	#
+.LVL799:
+	.loc 1 42 5 is_stmt 1 view .LVU2219
+	leaq	allocator_system(%rip), %rdi	#, tmp86
+	call	_test_malloc	#
+.LVL800:
+	.loc 1 43 5 view .LVU2220
+# Lib/munit_test/test_memory.c:44: }
+	.loc 1 44 1 is_stmt 0 view .LVU2221
+	movl	$0, %eax	#,
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE23:
+	.size	test_malloc, .-test_malloc
+	.globl	test_memory_initialize
+	.hidden	test_memory_initialize
+	.type	test_memory_initialize, @function
+test_memory_initialize:
+.LFB40:
+	.loc 1 464 42 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 464 43 view .LVU2223
+	ret	
+	.cfi_endproc
+.LFE40:
+	.size	test_memory_initialize, .-test_memory_initialize
+	.local	p.0
+	.comm	p.0,8000,32
+	.hidden	test_memory_tests
+	.globl	test_memory_tests
+	.section	.rodata.str1.1
+.LC123:
+	.string	"/test_malloc"
+.LC124:
+	.string	"/test_malloc_reuse"
+.LC125:
+	.string	"/test_malloc_resize"
+.LC126:
+	.string	"/test_malloc_resize_inplace"
+.LC127:
+	.string	"/test_malloc_thread_exit"
+.LC128:
+	.string	"/test_freelists"
+.LC129:
+	.string	"/test_freelists_thread_exit"
+.LC130:
+	.string	"/test_arena"
+.LC131:
+	.string	"/test_arena_thread_exit"
+.LC132:
+	.string	"/test_collect"
+.LC133:
+	.string	"/test_collect_automatic"
+	.section	.data.rel,"aw"
+	.align 32
+	.type	test_memory_tests, @object
+	.size	test_memory_tests, 576
+test_memory_tests:
+# name:
+	.quad	.LC123
+# test:
+	.quad	test_malloc
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	0
+# name:
+	.quad	.LC124
+# test:
+	.quad	test_malloc_reuse
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	0
+# name:
+	.quad	.LC125
+# test:
+	.quad	test_malloc_resize
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	0
+# name:
+	.quad	.LC126
+# test:
+	.quad	test_malloc_resize_inplace
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	0
+# name:
+	.quad	.LC127
+# test:
+	.quad	test_malloc_thread_exit
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	0
+# name:
+	.quad	.LC128
+# test:
+	.quad	test_freelists
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	0
+# name:
+	.quad	.LC129
+# test:
+	.quad	test_freelists_thread_exit
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	0
+# name:
+	.quad	.LC130
+# test:
+	.quad	test_arena
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	0
+# name:
+	.quad	.LC131
+# test:
+	.quad	test_arena_thread_exit
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	0
+# name:
+	.quad	.LC132
+# test:
+	.quad	test_collect
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	0
+# name:
+	.quad	.LC133
+# test:
+	.quad	test_collect_automatic
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	0
+# name:
+	.quad	0
+	.zero	40
+	.section	.rodata
+	.align 32
+	.type	allocation_sizes, @object
+	.size	allocation_sizes, 144
+allocation_sizes:
+	.quad	0
+	.quad	1
+	.quad	7
+	.quad	8
+	.quad	15
+	.quad	16
+	.quad	17
+	.quad	31
+	.quad	32
+	.quad	33
+	.quad	100
+	.quad	128
+	.quad	255
+	.quad	256
+	.quad	257
+	.quad	1000
+	.quad	4096
+	.quad	100000
+	.section	.data.rel
+	.align 16
+	.type	allocator_system, @object
+	.size	allocator_system, 24
+allocator_system:
+# malloc:
+	.quad	yp_mem_system_malloc
+# malloc_resize:
+	.quad	yp_mem_system_malloc_resize
+# free:
+	.quad	yp_mem_system_free
+	.align 16
+	.type	allocator_default, @object
+	.size	allocator_default, 24
+allocator_default:
+# malloc:
+	.quad	yp_mem_default_malloc
+# malloc_resize:
+	.quad	yp_mem_default_malloc_resize
+# free:
+	.quad	yp_mem_default_free
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC80:
+	.long	0
+	.long	1073217536
+	.align 8
+.LC91:
+	.long	0
+	.long	1074003968
+	.align 8
+.LC93:
+	.long	0
+	.long	1073741824
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 6 "./nohtyP.h"
+	.file 7 "Tools/munit/munit.h"
+	.file 8 "Lib/munit_test/unittest.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "/usr/include/pthread.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x7c78
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3b
+	.long	.LASF1891
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1646
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1647
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1648
+	.uleb128 0x3c
+	.byte	0x8
+	.uleb128 0x2b
+	.long	0x47
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1649
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1650
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1651
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1652
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1653
+	.uleb128 0x10
+	.long	.LASF1655
+	.byte	0x2
+	.byte	0xc2
+	.byte	0x12
+	.long	0x71
+	.uleb128 0xb
+	.long	0x89
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1654
+	.uleb128 0x21
+	.long	0x89
+	.uleb128 0x10
+	.long	.LASF1656
+	.byte	0x3
+	.byte	0x6c
+	.byte	0x13
+	.long	0x78
+	.uleb128 0x10
+	.long	.LASF1657
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x39
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1658
+	.uleb128 0x10
+	.long	.LASF1659
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x39
+	.uleb128 0x3e
+	.long	.LASF1662
+	.byte	0x38
+	.byte	0x5
+	.byte	0x38
+	.byte	0x7
+	.long	0xe4
+	.uleb128 0x32
+	.long	.LASF1660
+	.byte	0x3a
+	.byte	0x8
+	.long	0xe4
+	.uleb128 0x32
+	.long	.LASF1661
+	.byte	0x3b
+	.byte	0xc
+	.long	0x71
+	.byte	0
+	.uleb128 0x18
+	.long	0x89
+	.long	0xf4
+	.uleb128 0x1a
+	.long	0x39
+	.byte	0x37
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1662
+	.byte	0x5
+	.byte	0x3e
+	.byte	0x1e
+	.long	0xc0
+	.uleb128 0x21
+	.long	0xf4
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1663
+	.uleb128 0x10
+	.long	.LASF1664
+	.byte	0x6
+	.byte	0x8b
+	.byte	0x1a
+	.long	0x118
+	.uleb128 0x24
+	.long	.LASF1697
+	.byte	0x20
+	.byte	0x6
+	.value	0x944
+	.byte	0x8
+	.long	0x197
+	.uleb128 0x9
+	.long	.LASF1665
+	.byte	0x6
+	.value	0x945
+	.byte	0x13
+	.long	0x374
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1666
+	.byte	0x6
+	.value	0x946
+	.byte	0x10
+	.long	0x1ad
+	.byte	0x2
+	.uleb128 0x9
+	.long	.LASF1667
+	.byte	0x6
+	.value	0x947
+	.byte	0x10
+	.long	0x1ad
+	.byte	0x3
+	.uleb128 0x9
+	.long	.LASF1668
+	.byte	0x6
+	.value	0x948
+	.byte	0x11
+	.long	0x1d6
+	.byte	0x4
+	.uleb128 0x9
+	.long	.LASF1669
+	.byte	0x6
+	.value	0x949
+	.byte	0x12
+	.long	0x381
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF1670
+	.byte	0x6
+	.value	0x94a
+	.byte	0x12
+	.long	0x381
+	.byte	0xc
+	.uleb128 0x9
+	.long	.LASF1671
+	.byte	0x6
+	.value	0x94b
+	.byte	0xf
+	.long	0x20d
+	.byte	0x10
+	.uleb128 0x9
+	.long	.LASF1672
+	.byte	0x6
+	.value	0x94c
+	.byte	0xb
+	.long	0x47
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF1684
+	.byte	0x6
+	.byte	0x8e
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0xb
+	.long	0x10c
+	.uleb128 0x21
+	.long	0x1a3
+	.uleb128 0x10
+	.long	.LASF1673
+	.byte	0x6
+	.byte	0xb0
+	.byte	0x17
+	.long	0x4e
+	.uleb128 0x21
+	.long	0x1ad
+	.uleb128 0x10
+	.long	.LASF1674
+	.byte	0x6
+	.byte	0xb2
+	.byte	0x18
+	.long	0x55
+	.uleb128 0x10
+	.long	.LASF1675
+	.byte	0x6
+	.byte	0xb4
+	.byte	0xd
+	.long	0x6a
+	.uleb128 0x10
+	.long	.LASF1676
+	.byte	0x6
+	.byte	0xb5
+	.byte	0x16
+	.long	0x40
+	.uleb128 0x10
+	.long	.LASF1677
+	.byte	0x6
+	.byte	0xba
+	.byte	0x13
+	.long	0x105
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1678
+	.uleb128 0x10
+	.long	.LASF1679
+	.byte	0x6
+	.byte	0xbd
+	.byte	0x10
+	.long	0x32
+	.uleb128 0x10
+	.long	.LASF1680
+	.byte	0x6
+	.byte	0xc1
+	.byte	0x11
+	.long	0x95
+	.uleb128 0x10
+	.long	.LASF1681
+	.byte	0x6
+	.byte	0xcb
+	.byte	0x14
+	.long	0x201
+	.uleb128 0x10
+	.long	.LASF1682
+	.byte	0x6
+	.byte	0xce
+	.byte	0x14
+	.long	0x1e2
+	.uleb128 0x10
+	.long	.LASF1683
+	.byte	0x6
+	.byte	0xd1
+	.byte	0x16
+	.long	0x1f5
+	.uleb128 0x14
+	.long	.LASF1685
+	.byte	0x6
+	.value	0x1bf
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x14
+	.long	.LASF1686
+	.byte	0x6
+	.value	0x1c0
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x14
+	.long	.LASF1687
+	.byte	0x6
+	.value	0x610
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x14
+	.long	.LASF1688
+	.byte	0x6
+	.value	0x611
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x14
+	.long	.LASF1689
+	.byte	0x6
+	.value	0x66a
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x14
+	.long	.LASF1690
+	.byte	0x6
+	.value	0x66c
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x14
+	.long	.LASF1691
+	.byte	0x6
+	.value	0x66e
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x14
+	.long	.LASF1692
+	.byte	0x6
+	.value	0x670
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x14
+	.long	.LASF1693
+	.byte	0x6
+	.value	0x769
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x14
+	.long	.LASF1694
+	.byte	0x6
+	.value	0x77b
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x14
+	.long	.LASF1695
+	.byte	0x6
+	.value	0x77f
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x14
+	.long	.LASF1696
+	.byte	0x6
+	.value	0x780
+	.byte	0x3f
+	.long	0x1a8
+	.uleb128 0x1c
+	.long	0x47
+	.long	0x2e1
+	.uleb128 0x5
+	.long	0x2e1
+	.uleb128 0x5
+	.long	0x201
+	.byte	0
+	.uleb128 0xb
+	.long	0x201
+	.uleb128 0xb
+	.long	0x2cd
+	.uleb128 0x1c
+	.long	0x47
+	.long	0x309
+	.uleb128 0x5
+	.long	0x2e1
+	.uleb128 0x5
+	.long	0x47
+	.uleb128 0x5
+	.long	0x201
+	.uleb128 0x5
+	.long	0x201
+	.byte	0
+	.uleb128 0xb
+	.long	0x2eb
+	.uleb128 0x33
+	.long	0x319
+	.uleb128 0x5
+	.long	0x47
+	.byte	0
+	.uleb128 0xb
+	.long	0x30e
+	.uleb128 0x24
+	.long	.LASF1698
+	.byte	0x48
+	.byte	0x6
+	.value	0x852
+	.byte	0x10
+	.long	0x357
+	.uleb128 0x9
+	.long	.LASF1699
+	.byte	0x6
+	.value	0x853
+	.byte	0x10
+	.long	0x357
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1700
+	.byte	0x6
+	.value	0x854
+	.byte	0x10
+	.long	0x357
+	.byte	0x18
+	.uleb128 0x9
+	.long	.LASF1701
+	.byte	0x6
+	.value	0x855
+	.byte	0x10
+	.long	0x357
+	.byte	0x30
+	.byte	0
+	.uleb128 0x18
+	.long	0x201
+	.long	0x367
+	.uleb128 0x1a
+	.long	0x39
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1702
+	.byte	0x6
+	.value	0x856
+	.byte	0x3
+	.long	0x31e
+	.uleb128 0xe
+	.long	.LASF1703
+	.byte	0x6
+	.value	0x942
+	.byte	0x15
+	.long	0x1be
+	.uleb128 0xe
+	.long	.LASF1704
+	.byte	0x6
+	.value	0x943
+	.byte	0x14
+	.long	0x1ca
+	.uleb128 0xb
+	.long	0x393
+	.uleb128 0x40
+	.uleb128 0xb
+	.long	0x90
+	.uleb128 0x34
+	.long	0x40
+	.value	0x195
+	.long	0x3bd
+	.uleb128 0x20
+	.long	.LASF1705
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1706
+	.byte	0x1
+	.uleb128 0x20
+	.long	.LASF1707
+	.byte	0x2
+	.uleb128 0x20
+	.long	.LASF1708
+	.byte	0x3
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1709
+	.byte	0x7
+	.value	0x1a0
+	.byte	0x3
+	.long	0x399
+	.uleb128 0x2c
+	.byte	0x10
+	.value	0x1a2
+	.long	0x3ef
+	.uleb128 0x9
+	.long	.LASF1710
+	.byte	0x7
+	.value	0x1a3
+	.byte	0x9
+	.long	0x84
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1711
+	.byte	0x7
+	.value	0x1a4
+	.byte	0xa
+	.long	0x3ef
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	0x84
+	.uleb128 0xe
+	.long	.LASF1712
+	.byte	0x7
+	.value	0x1a5
+	.byte	0x3
+	.long	0x3ca
+	.uleb128 0x2c
+	.byte	0x10
+	.value	0x1a7
+	.long	0x426
+	.uleb128 0x9
+	.long	.LASF1710
+	.byte	0x7
+	.value	0x1a8
+	.byte	0x9
+	.long	0x84
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1713
+	.byte	0x7
+	.value	0x1a9
+	.byte	0x9
+	.long	0x84
+	.byte	0x8
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1714
+	.byte	0x7
+	.value	0x1aa
+	.byte	0x3
+	.long	0x401
+	.uleb128 0x21
+	.long	0x426
+	.uleb128 0x34
+	.long	0x40
+	.value	0x1ae
+	.long	0x456
+	.uleb128 0x20
+	.long	.LASF1715
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1716
+	.byte	0x1
+	.uleb128 0x20
+	.long	.LASF1717
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1718
+	.byte	0x7
+	.value	0x1b2
+	.byte	0x3
+	.long	0x438
+	.uleb128 0xe
+	.long	.LASF1719
+	.byte	0x7
+	.value	0x1b4
+	.byte	0x18
+	.long	0x470
+	.uleb128 0xb
+	.long	0x475
+	.uleb128 0x1c
+	.long	0x3bd
+	.long	0x489
+	.uleb128 0x5
+	.long	0x489
+	.uleb128 0x5
+	.long	0x47
+	.byte	0
+	.uleb128 0xb
+	.long	0x433
+	.uleb128 0xe
+	.long	.LASF1720
+	.byte	0x7
+	.value	0x1b5
+	.byte	0x12
+	.long	0x49b
+	.uleb128 0xb
+	.long	0x4a0
+	.uleb128 0x1c
+	.long	0x47
+	.long	0x4b4
+	.uleb128 0x5
+	.long	0x489
+	.uleb128 0x5
+	.long	0x47
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1721
+	.byte	0x7
+	.value	0x1b6
+	.byte	0x11
+	.long	0x319
+	.uleb128 0x2c
+	.byte	0x30
+	.value	0x1b8
+	.long	0x51e
+	.uleb128 0x9
+	.long	.LASF1710
+	.byte	0x7
+	.value	0x1b9
+	.byte	0x9
+	.long	0x84
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1722
+	.byte	0x7
+	.value	0x1ba
+	.byte	0x11
+	.long	0x463
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF1723
+	.byte	0x7
+	.value	0x1bb
+	.byte	0x12
+	.long	0x48e
+	.byte	0x10
+	.uleb128 0x9
+	.long	.LASF1724
+	.byte	0x7
+	.value	0x1bc
+	.byte	0x15
+	.long	0x4b4
+	.byte	0x18
+	.uleb128 0x9
+	.long	.LASF1725
+	.byte	0x7
+	.value	0x1bd
+	.byte	0x14
+	.long	0x456
+	.byte	0x20
+	.uleb128 0x9
+	.long	.LASF1726
+	.byte	0x7
+	.value	0x1be
+	.byte	0x17
+	.long	0x51e
+	.byte	0x28
+	.byte	0
+	.uleb128 0xb
+	.long	0x3f4
+	.uleb128 0xe
+	.long	.LASF1727
+	.byte	0x7
+	.value	0x1bf
+	.byte	0x3
+	.long	0x4c1
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1728
+	.uleb128 0x13
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1729
+	.uleb128 0xe
+	.long	.LASF1730
+	.byte	0x8
+	.value	0x371
+	.byte	0x20
+	.long	0x54b
+	.uleb128 0x24
+	.long	.LASF1731
+	.byte	0x90
+	.byte	0x8
+	.value	0x37f
+	.byte	0x10
+	.long	0x6aa
+	.uleb128 0x9
+	.long	.LASF1710
+	.byte	0x8
+	.value	0x380
+	.byte	0xb
+	.long	0x84
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1732
+	.byte	0x8
+	.value	0x381
+	.byte	0xf
+	.long	0x1a3
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF1733
+	.byte	0x8
+	.value	0x382
+	.byte	0xf
+	.long	0x1a3
+	.byte	0x10
+	.uleb128 0x9
+	.long	.LASF1734
+	.byte	0x8
+	.value	0x383
+	.byte	0x15
+	.long	0x7b3
+	.byte	0x18
+	.uleb128 0x9
+	.long	.LASF1735
+	.byte	0x8
+	.value	0x385
+	.byte	0x1c
+	.long	0x74a
+	.byte	0x20
+	.uleb128 0x9
+	.long	.LASF1736
+	.byte	0x8
+	.value	0x387
+	.byte	0x10
+	.long	0x6f0
+	.byte	0x28
+	.uleb128 0x9
+	.long	.LASF1737
+	.byte	0x8
+	.value	0x388
+	.byte	0x12
+	.long	0x7b8
+	.byte	0x30
+	.uleb128 0x9
+	.long	.LASF1738
+	.byte	0x8
+	.value	0x38d
+	.byte	0x13
+	.long	0x711
+	.byte	0x38
+	.uleb128 0x9
+	.long	.LASF1739
+	.byte	0x8
+	.value	0x38e
+	.byte	0x14
+	.long	0x782
+	.byte	0x40
+	.uleb128 0x9
+	.long	.LASF1740
+	.byte	0x8
+	.value	0x393
+	.byte	0x13
+	.long	0x711
+	.byte	0x48
+	.uleb128 0x9
+	.long	.LASF1741
+	.byte	0x8
+	.value	0x394
+	.byte	0x14
+	.long	0x782
+	.byte	0x50
+	.uleb128 0x9
+	.long	.LASF1742
+	.byte	0x8
+	.value	0x398
+	.byte	0x14
+	.long	0x782
+	.byte	0x58
+	.uleb128 0x9
+	.long	.LASF1743
+	.byte	0x8
+	.value	0x39b
+	.byte	0x9
+	.long	0x6a
+	.byte	0x60
+	.uleb128 0x9
+	.long	.LASF1744
+	.byte	0x8
+	.value	0x39c
+	.byte	0x9
+	.long	0x6a
+	.byte	0x64
+	.uleb128 0x9
+	.long	.LASF1745
+	.byte	0x8
+	.value	0x39d
+	.byte	0x9
+	.long	0x6a
+	.byte	0x68
+	.uleb128 0x9
+	.long	.LASF1746
+	.byte	0x8
+	.value	0x39e
+	.byte	0x9
+	.long	0x6a
+	.byte	0x6c
+	.uleb128 0x9
+	.long	.LASF1747
+	.byte	0x8
+	.value	0x39f
+	.byte	0x9
+	.long	0x6a
+	.byte	0x70
+	.uleb128 0x9
+	.long	.LASF1748
+	.byte	0x8
+	.value	0x3a0
+	.byte	0x9
+	.long	0x6a
+	.byte	0x74
+	.uleb128 0x9
+	.long	.LASF1749
+	.byte	0x8
+	.value	0x3a1
+	.byte	0x9
+	.long	0x6a
+	.byte	0x78
+	.uleb128 0x9
+	.long	.LASF1750
+	.byte	0x8
+	.value	0x3a2
+	.byte	0x9
+	.long	0x6a
+	.byte	0x7c
+	.uleb128 0x9
+	.long	.LASF1751
+	.byte	0x8
+	.value	0x3a3
+	.byte	0x9
+	.long	0x6a
+	.byte	0x80
+	.uleb128 0x9
+	.long	.LASF1752
+	.byte	0x8
+	.value	0x3a4
+	.byte	0x9
+	.long	0x6a
+	.byte	0x84
+	.uleb128 0x9
+	.long	.LASF1753
+	.byte	0x8
+	.value	0x3a5
+	.byte	0x9
+	.long	0x6a
+	.byte	0x88
+	.uleb128 0x9
+	.long	.LASF1754
+	.byte	0x8
+	.value	0x3a6
+	.byte	0x9
+	.long	0x6a
+	.byte	0x8c
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1755
+	.byte	0x8
+	.value	0x372
+	.byte	0x1d
+	.long	0x6b7
+	.uleb128 0x24
+	.long	.LASF1756
+	.byte	0x18
+	.byte	0x8
+	.value	0x3b6
+	.byte	0x10
+	.long	0x6f0
+	.uleb128 0x9
+	.long	.LASF1757
+	.byte	0x8
+	.value	0x3b7
+	.byte	0x15
+	.long	0x7b3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1739
+	.byte	0x8
+	.value	0x3b8
+	.byte	0x14
+	.long	0x782
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF1741
+	.byte	0x8
+	.value	0x3b9
+	.byte	0x14
+	.long	0x782
+	.byte	0x10
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1758
+	.byte	0x8
+	.value	0x373
+	.byte	0x15
+	.long	0x6fd
+	.uleb128 0xb
+	.long	0x702
+	.uleb128 0x1c
+	.long	0x1a3
+	.long	0x711
+	.uleb128 0x5
+	.long	0x1a3
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1759
+	.byte	0x8
+	.value	0x374
+	.byte	0x15
+	.long	0x71e
+	.uleb128 0xb
+	.long	0x723
+	.uleb128 0x1c
+	.long	0x1a3
+	.long	0x733
+	.uleb128 0x5
+	.long	0x6a
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1760
+	.byte	0x8
+	.value	0x375
+	.byte	0x2a
+	.long	0x745
+	.uleb128 0x21
+	.long	0x733
+	.uleb128 0x35
+	.long	.LASF1763
+	.uleb128 0xe
+	.long	.LASF1761
+	.byte	0x8
+	.value	0x376
+	.byte	0x15
+	.long	0x757
+	.uleb128 0xb
+	.long	0x75c
+	.uleb128 0x1c
+	.long	0x1a3
+	.long	0x76b
+	.uleb128 0x5
+	.long	0x76b
+	.byte	0
+	.uleb128 0xb
+	.long	0x740
+	.uleb128 0xe
+	.long	.LASF1762
+	.byte	0x8
+	.value	0x377
+	.byte	0x1e
+	.long	0x77d
+	.uleb128 0x35
+	.long	.LASF1764
+	.uleb128 0xe
+	.long	.LASF1765
+	.byte	0x8
+	.value	0x378
+	.byte	0x10
+	.long	0x78f
+	.uleb128 0xb
+	.long	0x794
+	.uleb128 0x33
+	.long	0x7a9
+	.uleb128 0x5
+	.long	0x7a9
+	.uleb128 0x5
+	.long	0x201
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0xb
+	.long	0x770
+	.uleb128 0xb
+	.long	0x1a3
+	.uleb128 0xb
+	.long	0x53e
+	.uleb128 0xb
+	.long	0x6aa
+	.uleb128 0x24
+	.long	.LASF1766
+	.byte	0x8
+	.byte	0x8
+	.value	0x3d7
+	.byte	0x10
+	.long	0x7da
+	.uleb128 0x9
+	.long	.LASF1757
+	.byte	0x8
+	.value	0x3d8
+	.byte	0x15
+	.long	0x7b3
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1767
+	.byte	0x8
+	.value	0x3d9
+	.byte	0x3
+	.long	0x7bd
+	.uleb128 0x18
+	.long	0x523
+	.long	0x7f2
+	.uleb128 0x41
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1768
+	.byte	0x8
+	.value	0x4ac
+	.byte	0x12
+	.long	0x7e7
+	.uleb128 0x42
+	.long	.LASF1769
+	.byte	0x18
+	.byte	0x1
+	.byte	0x8
+	.byte	0x10
+	.long	0x831
+	.uleb128 0x2d
+	.long	.LASF1770
+	.byte	0x9
+	.byte	0xd
+	.long	0x2e6
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1771
+	.byte	0xa
+	.byte	0xd
+	.long	0x309
+	.byte	0x8
+	.uleb128 0x2d
+	.long	.LASF1772
+	.byte	0xb
+	.byte	0xc
+	.long	0x319
+	.byte	0x10
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1773
+	.byte	0x1
+	.byte	0xc
+	.byte	0x3
+	.long	0x7ff
+	.uleb128 0xf
+	.long	.LASF1774
+	.byte	0xe
+	.byte	0x14
+	.long	0x831
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocator_default
+	.uleb128 0xf
+	.long	.LASF1775
+	.byte	0x10
+	.byte	0x14
+	.long	0x831
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocator_system
+	.uleb128 0x18
+	.long	0x201
+	.long	0x877
+	.uleb128 0x1a
+	.long	0x39
+	.byte	0x11
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1776
+	.byte	0x14
+	.byte	0x13
+	.long	0x867
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocation_sizes
+	.uleb128 0x18
+	.long	0x84
+	.long	0x89c
+	.uleb128 0x1a
+	.long	0x39
+	.byte	0x1
+	.byte	0
+	.uleb128 0x18
+	.long	0x523
+	.long	0x8ac
+	.uleb128 0x1a
+	.long	0x39
+	.byte	0xb
+	.byte	0
+	.uleb128 0x43
+	.long	0x7f2
+	.byte	0x1
+	.value	0x1bf
+	.byte	0xb
+	.long	0x89c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	test_memory_tests
+	.uleb128 0x1d
+	.long	.LASF1777
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xe
+	.long	0x47
+	.long	0x8e3
+	.uleb128 0x5
+	.long	0x47
+	.uleb128 0x5
+	.long	0x6a
+	.uleb128 0x5
+	.long	0xa1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1781
+	.byte	0x6
+	.value	0x818
+	.byte	0x34
+	.long	0x8f6
+	.uleb128 0x5
+	.long	0x47
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1778
+	.byte	0x6
+	.value	0x816
+	.byte	0x35
+	.long	0x47
+	.long	0x91c
+	.uleb128 0x5
+	.long	0x2e1
+	.uleb128 0x5
+	.long	0x47
+	.uleb128 0x5
+	.long	0x201
+	.uleb128 0x5
+	.long	0x201
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1779
+	.byte	0x6
+	.value	0x815
+	.byte	0x35
+	.long	0x47
+	.long	0x938
+	.uleb128 0x5
+	.long	0x2e1
+	.uleb128 0x5
+	.long	0x201
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1780
+	.byte	0x6
+	.value	0x80e
+	.byte	0x35
+	.long	0x47
+	.long	0x95e
+	.uleb128 0x5
+	.long	0x2e1
+	.uleb128 0x5
+	.long	0x47
+	.uleb128 0x5
+	.long	0x201
+	.uleb128 0x5
+	.long	0x201
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1782
+	.byte	0x6
+	.value	0x810
+	.byte	0x34
+	.long	0x971
+	.uleb128 0x5
+	.long	0x47
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1783
+	.byte	0x6
+	.value	0x80d
+	.byte	0x35
+	.long	0x47
+	.long	0x98d
+	.uleb128 0x5
+	.long	0x2e1
+	.uleb128 0x5
+	.long	0x201
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1784
+	.byte	0x8
+	.value	0x437
+	.byte	0xd
+	.long	0x9a0
+	.uleb128 0x5
+	.long	0x7a9
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1785
+	.byte	0x8
+	.value	0x473
+	.byte	0xd
+	.long	0x9b8
+	.uleb128 0x5
+	.long	0x201
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF1811
+	.value	0x81d
+	.uleb128 0xd
+	.long	.LASF1786
+	.byte	0x6
+	.value	0x278
+	.byte	0x39
+	.long	0x1a3
+	.long	0x9d6
+	.uleb128 0x5
+	.long	0x1a3
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1787
+	.byte	0x6
+	.byte	0xee
+	.byte	0x39
+	.long	0x1a3
+	.long	0x9ec
+	.uleb128 0x5
+	.long	0x225
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1788
+	.byte	0x6
+	.value	0x5e5
+	.byte	0x38
+	.long	0x219
+	.long	0xa08
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1789
+	.byte	0x6
+	.byte	0xde
+	.byte	0x39
+	.long	0x1a3
+	.long	0xa1e
+	.uleb128 0x5
+	.long	0x219
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1790
+	.byte	0x6
+	.value	0x21a
+	.byte	0x39
+	.long	0x20d
+	.long	0xa3a
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1791
+	.byte	0x8
+	.value	0x440
+	.byte	0x12
+	.long	0x1a3
+	.long	0xa51
+	.uleb128 0x5
+	.long	0x7a9
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF1892
+	.byte	0x8
+	.value	0x434
+	.byte	0x16
+	.long	0x7a9
+	.uleb128 0x1d
+	.long	.LASF1792
+	.byte	0x6
+	.byte	0xed
+	.byte	0x39
+	.long	0x1a3
+	.long	0xa74
+	.uleb128 0x5
+	.long	0x225
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1793
+	.byte	0x6
+	.value	0x22c
+	.byte	0x39
+	.long	0x1a3
+	.long	0xa8b
+	.uleb128 0x5
+	.long	0x1a3
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1794
+	.byte	0x6
+	.value	0x3c1
+	.byte	0x39
+	.long	0x1a3
+	.long	0xaa7
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x1a3
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1795
+	.byte	0x6
+	.byte	0xdd
+	.byte	0x39
+	.long	0x1a3
+	.long	0xabd
+	.uleb128 0x5
+	.long	0x219
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1796
+	.byte	0x6
+	.value	0x106
+	.byte	0x39
+	.long	0x1a3
+	.long	0xad9
+	.uleb128 0x5
+	.long	0x201
+	.uleb128 0x5
+	.long	0xad9
+	.byte	0
+	.uleb128 0xb
+	.long	0x1b9
+	.uleb128 0xd
+	.long	.LASF1797
+	.byte	0x6
+	.value	0x836
+	.byte	0x3a
+	.long	0x201
+	.long	0xaf5
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1798
+	.byte	0x6
+	.value	0x831
+	.byte	0x34
+	.long	0xb08
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1799
+	.byte	0xa
+	.byte	0xdb
+	.byte	0xc
+	.long	0x6a
+	.long	0xb23
+	.uleb128 0x5
+	.long	0xb4
+	.uleb128 0x5
+	.long	0xb23
+	.byte	0
+	.uleb128 0xb
+	.long	0x47
+	.uleb128 0x1d
+	.long	.LASF1800
+	.byte	0xa
+	.byte	0xca
+	.byte	0xc
+	.long	0x6a
+	.long	0xb4d
+	.uleb128 0x5
+	.long	0xb52
+	.uleb128 0x5
+	.long	0xb5c
+	.uleb128 0x5
+	.long	0xb61
+	.uleb128 0x5
+	.long	0x49
+	.byte	0
+	.uleb128 0xb
+	.long	0xb4
+	.uleb128 0x2b
+	.long	0xb4d
+	.uleb128 0xb
+	.long	0x100
+	.uleb128 0x2b
+	.long	0xb57
+	.uleb128 0xb
+	.long	0xb66
+	.uleb128 0x1c
+	.long	0x47
+	.long	0xb75
+	.uleb128 0x5
+	.long	0x47
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1801
+	.byte	0x8
+	.value	0x34f
+	.byte	0xc
+	.long	0x6a
+	.long	0xb96
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x201
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1802
+	.byte	0x6
+	.value	0x2aa
+	.byte	0x34
+	.long	0xbae
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1732
+	.byte	0x6
+	.value	0x65a
+	.byte	0x39
+	.long	0x1a3
+	.long	0xbc5
+	.uleb128 0x5
+	.long	0x1a3
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1803
+	.byte	0x6
+	.value	0x1f4
+	.byte	0x39
+	.long	0x1a3
+	.long	0xbe1
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x1a3
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1804
+	.byte	0x6
+	.value	0x2cb
+	.byte	0x39
+	.long	0x1a3
+	.long	0xbfd
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x201
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1805
+	.byte	0x6
+	.value	0x2a7
+	.byte	0x3a
+	.long	0x201
+	.long	0xc19
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF1806
+	.byte	0x9d
+	.long	0xc2a
+	.uleb128 0x5
+	.long	0x6a
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1807
+	.byte	0x6
+	.value	0x2fa
+	.byte	0x34
+	.long	0xc4c
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x201
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1808
+	.byte	0x6
+	.value	0x3d6
+	.byte	0x34
+	.long	0xc6e
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1809
+	.byte	0x6
+	.value	0x15a
+	.byte	0x39
+	.long	0x1a3
+	.long	0xc86
+	.uleb128 0x5
+	.long	0x6a
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1810
+	.byte	0x6
+	.value	0x187
+	.byte	0x39
+	.long	0x1a3
+	.long	0xc9e
+	.uleb128 0x5
+	.long	0x6a
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF1812
+	.value	0x84a
+	.uleb128 0xd
+	.long	.LASF1813
+	.byte	0x6
+	.value	0x84f
+	.byte	0x3a
+	.long	0x201
+	.long	0xcc1
+	.uleb128 0x5
+	.long	0x6a
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF1814
+	.byte	0x9a
+	.long	0xcd1
+	.uleb128 0x5
+	.long	0x1a3
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF1815
+	.byte	0x7
+	.byte	0xc4
+	.byte	0x6
+	.long	0xcee
+	.uleb128 0x5
+	.long	0x394
+	.uleb128 0x5
+	.long	0x6a
+	.uleb128 0x5
+	.long	0x394
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1816
+	.byte	0x6
+	.byte	0xa1
+	.byte	0x33
+	.long	0x6a
+	.long	0xd04
+	.uleb128 0x5
+	.long	0x1a3
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1817
+	.byte	0x6
+	.value	0x318
+	.byte	0x34
+	.long	0xd21
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x1a3
+	.uleb128 0x5
+	.long	0x7ae
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1818
+	.byte	0x6
+	.value	0x15c
+	.byte	0x39
+	.long	0x1a3
+	.long	0xd39
+	.uleb128 0x5
+	.long	0x6a
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1819
+	.byte	0x6
+	.value	0x846
+	.byte	0x34
+	.long	0xd4c
+	.uleb128 0x5
+	.long	0x201
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1820
+	.byte	0x6
+	.value	0x859
+	.byte	0x34
+	.long	0xd5f
+	.uleb128 0x5
+	.long	0xd5f
+	.byte	0
+	.uleb128 0xb
+	.long	0x367
+	.uleb128 0x17
+	.long	.LASF1821
+	.byte	0x8
+	.value	0x498
+	.byte	0xd
+	.long	0xd77
+	.uleb128 0x5
+	.long	0xd77
+	.byte	0
+	.uleb128 0xb
+	.long	0x7da
+	.uleb128 0xd
+	.long	.LASF1822
+	.byte	0x8
+	.value	0x497
+	.byte	0x13
+	.long	0xd77
+	.long	0xd98
+	.uleb128 0x5
+	.long	0x489
+	.uleb128 0x5
+	.long	0x47
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF1893
+	.byte	0x1
+	.value	0x1d0
+	.byte	0xd
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x25
+	.long	.LASF1832
+	.value	0x1a5
+	.byte	0x14
+	.long	0x3bd
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x125a
+	.uleb128 0x1e
+	.long	.LASF1823
+	.value	0x1a5
+	.byte	0x40
+	.long	0x489
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1e
+	.long	.LASF1824
+	.value	0x1a5
+	.byte	0x55
+	.long	0xd77
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x15
+	.long	.LASF1825
+	.value	0x1a7
+	.byte	0x18
+	.long	0x367
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x15
+	.long	.LASF1826
+	.value	0x1a8
+	.byte	0x18
+	.long	0x367
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x27
+	.string	"i"
+	.value	0x1a9
+	.byte	0x10
+	.long	0x201
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x4
+	.long	.LLRL3
+	.long	0xf40
+	.uleb128 0x7
+	.long	.LASF1827
+	.value	0x1ae
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x4
+	.long	.LLRL5
+	.long	0xf14
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x1af
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.uleb128 0x2
+	.quad	.LVL7
+	.long	0xd04
+	.long	0xe8a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL12
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL13
+	.long	0xcd1
+	.long	0xed7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL14
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL5
+	.long	0xd21
+	.long	0xf2b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL8
+	.long	0xcc1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL6
+	.long	0x109b
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x1b2
+	.byte	0x15
+	.long	0x201
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x16
+	.long	.LASF1829
+	.value	0x1b2
+	.byte	0x2f
+	.long	0x201
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.long	0x1051
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x1b2
+	.byte	0x4d
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.uleb128 0x2
+	.quad	.LVL15
+	.long	0xca5
+	.long	0xfad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL16
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL17
+	.long	0xcd1
+	.long	0x1007
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL18
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL31
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL8
+	.long	0x1130
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x1b6
+	.byte	0x15
+	.long	0x201
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x1b6
+	.byte	0x5f
+	.long	0x201
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x6
+	.quad	.LVL21
+	.long	0x7c69
+	.uleb128 0x3
+	.quad	.LVL33
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1b6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL11
+	.long	0x11f9
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x1b7
+	.byte	0x15
+	.long	0x201
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x1b7
+	.byte	0xb3
+	.long	0x201
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x6
+	.quad	.LVL22
+	.long	0x7c72
+	.uleb128 0x6
+	.quad	.LVL23
+	.long	0x7c72
+	.uleb128 0x6
+	.quad	.LVL24
+	.long	0x7c72
+	.uleb128 0x6
+	.quad	.LVL25
+	.long	0x7c72
+	.uleb128 0x6
+	.quad	.LVL26
+	.long	0x7c69
+	.uleb128 0x3
+	.quad	.LVL35
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL2
+	.long	0xd4c
+	.long	0x1212
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL3
+	.long	0xd39
+	.long	0x122a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x64
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL9
+	.long	0x7c72
+	.uleb128 0x6
+	.quad	.LVL19
+	.long	0xc9e
+	.uleb128 0x3
+	.quad	.LVL20
+	.long	0xd4c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1833
+	.value	0x160
+	.byte	0x14
+	.long	0x3bd
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d64
+	.uleb128 0x1e
+	.long	.LASF1823
+	.value	0x160
+	.byte	0x36
+	.long	0x489
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1e
+	.long	.LASF1824
+	.value	0x160
+	.byte	0x4b
+	.long	0xd77
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x15
+	.long	.LASF1825
+	.value	0x162
+	.byte	0x18
+	.long	0x367
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x15
+	.long	.LASF1826
+	.value	0x163
+	.byte	0x18
+	.long	0x367
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x4
+	.long	.LLRL16
+	.long	0x153c
+	.uleb128 0x7
+	.long	.LASF1827
+	.value	0x16a
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0xc
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.long	0x13b5
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x16b
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL42
+	.long	0xd04
+	.long	0x132b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL43
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL44
+	.long	0xcd1
+	.long	0x1378
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x16b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL45
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x16b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL18
+	.long	0x1510
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x16d
+	.byte	0x19
+	.long	0x201
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x16
+	.long	.LASF1829
+	.value	0x16d
+	.byte	0x33
+	.long	0x201
+	.byte	0x1
+	.uleb128 0xc
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.long	0x14c6
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x16d
+	.byte	0x51
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL47
+	.long	0xca5
+	.long	0x1422
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL48
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL49
+	.long	0xcd1
+	.long	0x147c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x16d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL50
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x16d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL64
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x16d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL40
+	.long	0xd21
+	.long	0x1527
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL46
+	.long	0xcc1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL20
+	.long	0x18f4
+	.uleb128 0x7
+	.long	.LASF1834
+	.value	0x172
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x7
+	.long	.LASF1827
+	.value	0x173
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x7
+	.long	.LASF1835
+	.value	0x174
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x4
+	.long	.LLRL24
+	.long	0x1649
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x175
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL60
+	.long	0xc4c
+	.long	0x15bf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL61
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL62
+	.long	0xcd1
+	.long	0x160c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x175
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL65
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x175
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.long	0x1722
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x176
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL66
+	.long	0xc2a
+	.long	0x1698
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL67
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL68
+	.long	0xcd1
+	.long	0x16e5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x176
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL69
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x176
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL25
+	.long	0x187d
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x178
+	.byte	0x19
+	.long	0x201
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x16
+	.long	.LASF1829
+	.value	0x178
+	.byte	0x33
+	.long	0x201
+	.byte	0x3
+	.uleb128 0xc
+	.quad	.LBB23
+	.quad	.LBE23-.LBB23
+	.long	0x1833
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x178
+	.byte	0x51
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL71
+	.long	0xca5
+	.long	0x178f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL72
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL73
+	.long	0xcd1
+	.long	0x17e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x178
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL74
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x178
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL85
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x178
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL52
+	.long	0xc86
+	.long	0x1894
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL55
+	.long	0xd21
+	.long	0x18ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL58
+	.long	0xc6e
+	.long	0x18ce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL70
+	.long	0xc19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL27
+	.long	0x2390
+	.uleb128 0x7
+	.long	.LASF1827
+	.value	0x17d
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x7
+	.long	.LASF1836
+	.value	0x17e
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x4
+	.long	.LLRL30
+	.long	0x19ed
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x17f
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL81
+	.long	0xd04
+	.long	0x1963
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL82
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL83
+	.long	0xcd1
+	.long	0x19b0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x17f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL86
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x17f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL31
+	.long	0x1b4e
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x181
+	.byte	0x19
+	.long	0x201
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x16
+	.long	.LASF1829
+	.value	0x181
+	.byte	0x33
+	.long	0x201
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.long	0x1afe
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x181
+	.byte	0x51
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL88
+	.long	0xca5
+	.long	0x1a5a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL90
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL91
+	.long	0xcd1
+	.long	0x1ab4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x181
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL92
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x181
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL101
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x181
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL33
+	.long	0x1f5a
+	.uleb128 0x7
+	.long	.LASF1837
+	.value	0x182
+	.byte	0x18
+	.long	0x1a3
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x47
+	.long	.LASF1848
+	.byte	0x1
+	.value	0x182
+	.byte	0x3a
+	.long	0x2d64
+	.uleb128 0x15
+	.long	.LASF1838
+	.value	0x182
+	.byte	0x5d
+	.long	0x2d74
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x19
+	.long	.LLRL35
+	.uleb128 0x7
+	.long	.LASF1839
+	.value	0x182
+	.byte	0x90
+	.long	0x201
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x7
+	.long	.LASF1840
+	.value	0x182
+	.byte	0xff
+	.long	0x201
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x4
+	.long	.LLRL38
+	.long	0x1ce2
+	.uleb128 0x2e
+	.long	.LASF1841
+	.value	0x182
+	.value	0x11c
+	.long	0x201
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x4
+	.long	.LLRL40
+	.long	0x1ca0
+	.uleb128 0x38
+	.string	"exc"
+	.value	0x182
+	.value	0x13d
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL96
+	.long	0xbfd
+	.long	0x1c0c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL98
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL99
+	.long	0xcd1
+	.long	0x1c5e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x182
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL102
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x182
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL113
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x182
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL41
+	.long	0x1f4b
+	.uleb128 0x7
+	.long	.LASF1842
+	.value	0x182
+	.byte	0x9d
+	.long	0x1a3
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x4
+	.long	.LLRL43
+	.long	0x1e16
+	.uleb128 0x7
+	.long	.LASF1843
+	.value	0x182
+	.byte	0x4a
+	.long	0x1a3
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x2
+	.quad	.LVL117
+	.long	0xbc5
+	.long	0x1d3a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL127
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL128
+	.long	0xcd1
+	.long	0x1d8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x182
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL130
+	.long	0xcd1
+	.long	0x1dd3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x182
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL131
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x182
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL45
+	.long	0x1eba
+	.uleb128 0x7
+	.long	.LASF1844
+	.value	0x182
+	.byte	0x8b
+	.long	0x1a3
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x7
+	.long	.LASF1845
+	.value	0x182
+	.byte	0xc4
+	.long	0x1a3
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x2
+	.quad	.LVL119
+	.long	0xbae
+	.long	0x1e5f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL121
+	.long	0xbae
+	.long	0x1e77
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL133
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x182
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL114
+	.long	0xbe1
+	.long	0x1ed8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL116
+	.long	0xcee
+	.long	0x1ef0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL122
+	.long	0xcc1
+	.long	0x1f08
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL126
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x182
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL123
+	.long	0x7c72
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL48
+	.long	0x1fe2
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x184
+	.byte	0x19
+	.long	0x201
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x184
+	.byte	0x47
+	.long	0x201
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x3
+	.quad	.LVL135
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x184
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL51
+	.long	0x206a
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x185
+	.byte	0x19
+	.long	0x201
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x185
+	.byte	0x47
+	.long	0x201
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x3
+	.quad	.LVL137
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x185
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC36
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL54
+	.long	0x21c0
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x188
+	.byte	0x19
+	.long	0x201
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x7
+	.long	.LASF1829
+	.value	0x188
+	.byte	0x33
+	.long	0x201
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x4
+	.long	.LLRL57
+	.long	0x2176
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x188
+	.byte	0x51
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL108
+	.long	0xca5
+	.long	0x20d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL110
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL111
+	.long	0xcd1
+	.long	0x212c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x188
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL138
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x188
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL144
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x188
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL58
+	.long	0x2316
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x189
+	.byte	0x19
+	.long	0x201
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x7
+	.long	.LASF1829
+	.value	0x189
+	.byte	0x33
+	.long	0x201
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x4
+	.long	.LLRL61
+	.long	0x22cc
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x189
+	.byte	0x51
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL139
+	.long	0xca5
+	.long	0x2228
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL141
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL142
+	.long	0xcd1
+	.long	0x2282
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x189
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL145
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x189
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL153
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x189
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL76
+	.long	0xd21
+	.long	0x232d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL79
+	.long	0xd21
+	.long	0x234a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL87
+	.long	0xcc1
+	.long	0x2362
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL104
+	.long	0xd4c
+	.long	0x237b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL107
+	.long	0xcc1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL62
+	.long	0x26be
+	.uleb128 0x7
+	.long	.LASF1827
+	.value	0x18f
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x4
+	.long	.LLRL64
+	.long	0x2475
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x190
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL149
+	.long	0xd04
+	.long	0x23eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL150
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL151
+	.long	0xcd1
+	.long	0x2438
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x190
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL154
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x190
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL65
+	.long	0x25d0
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x191
+	.byte	0x19
+	.long	0x201
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x16
+	.long	.LASF1829
+	.value	0x191
+	.byte	0x33
+	.long	0x201
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB70
+	.quad	.LBE70-.LBB70
+	.long	0x2586
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x191
+	.byte	0x51
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL155
+	.long	0xca5
+	.long	0x24e2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL157
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL158
+	.long	0xcd1
+	.long	0x253c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x191
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL159
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x191
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL164
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x191
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL67
+	.long	0x2692
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x192
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL160
+	.long	0xb96
+	.long	0x2608
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL161
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL162
+	.long	0xcd1
+	.long	0x2655
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x192
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL165
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x192
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL147
+	.long	0xd21
+	.long	0x26a9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL166
+	.long	0xcc1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL68
+	.long	0x274c
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x197
+	.byte	0x15
+	.long	0x201
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x16
+	.long	.LASF1831
+	.value	0x197
+	.byte	0x5f
+	.long	0x201
+	.byte	0x4
+	.uleb128 0x6
+	.quad	.LVL168
+	.long	0x7c69
+	.uleb128 0x3
+	.quad	.LVL192
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x197
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC38
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL70
+	.long	0x27e1
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x198
+	.byte	0x15
+	.long	0x201
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x198
+	.byte	0x5f
+	.long	0x201
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x6
+	.quad	.LVL169
+	.long	0x7c69
+	.uleb128 0x3
+	.quad	.LVL194
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x198
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL73
+	.long	0x2876
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x199
+	.byte	0x15
+	.long	0x201
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x199
+	.byte	0x5b
+	.long	0x201
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x6
+	.quad	.LVL170
+	.long	0x7c69
+	.uleb128 0x3
+	.quad	.LVL196
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x199
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC38
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL76
+	.long	0x290b
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x19a
+	.byte	0x15
+	.long	0x201
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x19a
+	.byte	0x5b
+	.long	0x201
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x6
+	.quad	.LVL171
+	.long	0x7c69
+	.uleb128 0x3
+	.quad	.LVL198
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x19a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL79
+	.long	0x29ad
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x19b
+	.byte	0x15
+	.long	0x201
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x19b
+	.byte	0x69
+	.long	0x201
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x6
+	.quad	.LVL172
+	.long	0x7c72
+	.uleb128 0x6
+	.quad	.LVL173
+	.long	0x7c72
+	.uleb128 0x3
+	.quad	.LVL200
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x19b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL82
+	.long	0x2b5f
+	.uleb128 0x15
+	.long	.LASF1846
+	.value	0x19e
+	.byte	0x14
+	.long	0x2d64
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x7
+	.long	.LASF1847
+	.value	0x19e
+	.byte	0x45
+	.long	0x201
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x19e
+	.byte	0xb8
+	.long	0x201
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x7
+	.long	.LASF1829
+	.value	0x19e
+	.byte	0xd2
+	.long	0x201
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x4
+	.long	.LLRL86
+	.long	0x2afc
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x19e
+	.byte	0xf0
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL177
+	.long	0xca5
+	.long	0x2a3a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL179
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL180
+	.long	0xb75
+	.long	0x2a65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL201
+	.long	0xcd1
+	.long	0x2ab2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x19e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL202
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x19e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x2b0f
+	.uleb128 0x2f
+	.string	"exc"
+	.value	0x19e
+	.value	0x372
+	.long	0x1a3
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL203
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x19e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL87
+	.long	0x2d10
+	.uleb128 0x15
+	.long	.LASF1846
+	.value	0x19f
+	.byte	0x14
+	.long	0x2d64
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x7
+	.long	.LASF1847
+	.value	0x19f
+	.byte	0x45
+	.long	0x201
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x19f
+	.byte	0xb8
+	.long	0x201
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x7
+	.long	.LASF1829
+	.value	0x19f
+	.byte	0xd2
+	.long	0x201
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x4
+	.long	.LLRL91
+	.long	0x2cad
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x19f
+	.byte	0xf0
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL183
+	.long	0xca5
+	.long	0x2beb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL185
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL186
+	.long	0xb75
+	.long	0x2c16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL204
+	.long	0xcd1
+	.long	0x2c63
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x19f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL205
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x19f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x2cc0
+	.uleb128 0x2f
+	.string	"exc"
+	.value	0x19f
+	.value	0x36f
+	.long	0x1a3
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL206
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x19f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL38
+	.long	0xd4c
+	.long	0x2d29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL39
+	.long	0xd39
+	.long	0x2d41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL146
+	.long	0xc9e
+	.uleb128 0x3
+	.quad	.LVL167
+	.long	0xd4c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x1a3
+	.long	0x2d74
+	.uleb128 0x1a
+	.long	0x39
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x84
+	.long	0x2d84
+	.uleb128 0x1a
+	.long	0x39
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1849
+	.value	0x14d
+	.byte	0x14
+	.long	0x3bd
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x31af
+	.uleb128 0x1e
+	.long	.LASF1823
+	.value	0x14d
+	.byte	0x40
+	.long	0x489
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x1e
+	.long	.LASF1824
+	.value	0x14d
+	.byte	0x55
+	.long	0xd77
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x15
+	.long	.LASF1850
+	.value	0x14f
+	.byte	0xf
+	.long	0xb4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x15
+	.long	.LASF1851
+	.value	0x150
+	.byte	0xb
+	.long	0x47
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x15
+	.long	.LASF1852
+	.value	0x151
+	.byte	0xb
+	.long	0x47
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LLRL94
+	.long	0x2eac
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x153
+	.byte	0x13
+	.long	0x219
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x16
+	.long	.LASF1831
+	.value	0x153
+	.byte	0x37
+	.long	0x219
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL210
+	.long	0xb28
+	.long	0x2e55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_test_arena_thread_exit_list
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL224
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x153
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC49
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL96
+	.long	0x2f4b
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x154
+	.byte	0x13
+	.long	0x219
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x154
+	.byte	0x11
+	.long	0x219
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x2
+	.quad	.LVL212
+	.long	0xb08
+	.long	0x2ef4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL226
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x154
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL99
+	.long	0x3003
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x155
+	.byte	0x13
+	.long	0x219
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x155
+	.byte	0x38
+	.long	0x219
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x2
+	.quad	.LVL214
+	.long	0xb28
+	.long	0x2fac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_test_arena_thread_exit_list
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL228
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x155
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL102
+	.long	0x30a2
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x156
+	.byte	0x13
+	.long	0x219
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x156
+	.byte	0x11
+	.long	0x219
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x2
+	.quad	.LVL216
+	.long	0xb08
+	.long	0x304b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL230
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x156
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL105
+	.long	0x312a
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x159
+	.byte	0x16
+	.long	0x38e
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x159
+	.byte	0x3a
+	.long	0x38e
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x3
+	.quad	.LVL231
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x159
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LLRL108
+	.uleb128 0x7
+	.long	.LASF1830
+	.value	0x15a
+	.byte	0x16
+	.long	0x38e
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x7
+	.long	.LASF1831
+	.value	0x15a
+	.byte	0x3b
+	.long	0x38e
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x3
+	.quad	.LVL234
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x15a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC57
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC55
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1853
+	.value	0x140
+	.byte	0xe
+	.long	0x47
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3270
+	.uleb128 0x48
+	.string	"p"
+	.byte	0x1
+	.value	0x140
+	.byte	0x31
+	.long	0x47
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x142
+	.byte	0xf
+	.long	0x1a3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	.LASF1827
+	.value	0x143
+	.byte	0xf
+	.long	0x1a3
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x2
+	.quad	.LVL278
+	.long	0xaf5
+	.long	0x321f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL279
+	.long	0xd21
+	.long	0x3236
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL281
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL282
+	.long	0xcc1
+	.long	0x325b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL283
+	.long	0xade
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1854
+	.value	0x116
+	.byte	0x14
+	.long	0x3bd
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4458
+	.uleb128 0x1e
+	.long	.LASF1823
+	.value	0x116
+	.byte	0x34
+	.long	0x489
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x1e
+	.long	.LASF1824
+	.value	0x116
+	.byte	0x49
+	.long	0xd77
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0xc
+	.quad	.LBB159
+	.quad	.LBE159-.LBB159
+	.long	0x3382
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x119
+	.byte	0x14
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL357
+	.long	0xaf5
+	.long	0x32f8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL358
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL359
+	.long	0xcd1
+	.long	0x3345
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x119
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL360
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x119
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL171
+	.long	0x34d8
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x11b
+	.byte	0x15
+	.long	0x201
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0x16
+	.long	.LASF1829
+	.value	0x11b
+	.byte	0x2f
+	.long	0x201
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB161
+	.quad	.LBE161-.LBB161
+	.long	0x348e
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x11b
+	.byte	0x4d
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL362
+	.long	0xade
+	.long	0x33ea
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL363
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL364
+	.long	0xcd1
+	.long	0x3444
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x11b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL365
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x11b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL370
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x11b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL173
+	.long	0x3594
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x11e
+	.byte	0x14
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL366
+	.long	0xaf5
+	.long	0x350a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL367
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL368
+	.long	0xcd1
+	.long	0x3557
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x11e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL371
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x11e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB165
+	.quad	.LBE165-.LBB165
+	.long	0x365c
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x120
+	.byte	0x14
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL373
+	.long	0xaf5
+	.long	0x35d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL374
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL375
+	.long	0xcd1
+	.long	0x361f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x120
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL376
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x120
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL174
+	.long	0x37b2
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x122
+	.byte	0x15
+	.long	0x201
+	.long	.LLST175
+	.long	.LVUS175
+	.uleb128 0x16
+	.long	.LASF1829
+	.value	0x122
+	.byte	0x2f
+	.long	0x201
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB167
+	.quad	.LBE167-.LBB167
+	.long	0x3768
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x122
+	.byte	0x4d
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL378
+	.long	0xade
+	.long	0x36c4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL379
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL380
+	.long	0xcd1
+	.long	0x371e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x122
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL381
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x122
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL386
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x122
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL176
+	.long	0x386e
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x123
+	.byte	0x14
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL382
+	.long	0xaf5
+	.long	0x37e4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL383
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL384
+	.long	0xcd1
+	.long	0x3831
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x123
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL387
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x123
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL177
+	.long	0x39c4
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x124
+	.byte	0x15
+	.long	0x201
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x16
+	.long	.LASF1829
+	.value	0x124
+	.byte	0x2f
+	.long	0x201
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB172
+	.quad	.LBE172-.LBB172
+	.long	0x397a
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x124
+	.byte	0x4d
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL388
+	.long	0xade
+	.long	0x38d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL390
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL391
+	.long	0xcd1
+	.long	0x3930
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x124
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL392
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x124
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL398
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x124
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL179
+	.long	0x3b1b
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x125
+	.byte	0x15
+	.long	0x201
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0x7
+	.long	.LASF1829
+	.value	0x125
+	.byte	0x2f
+	.long	0x201
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0x4
+	.long	.LLRL182
+	.long	0x3acb
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x125
+	.byte	0x4d
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL393
+	.long	0xade
+	.long	0x3a27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL395
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL396
+	.long	0xcd1
+	.long	0x3a81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x125
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL399
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x125
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL404
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x125
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL183
+	.long	0x428b
+	.uleb128 0x7
+	.long	.LASF1827
+	.value	0x129
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x4
+	.long	.LLRL185
+	.long	0x3bf4
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x12a
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL400
+	.long	0xaf5
+	.long	0x3b6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL401
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL402
+	.long	0xcd1
+	.long	0x3bb7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL405
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL186
+	.long	0x3d4a
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x12e
+	.byte	0x19
+	.long	0x201
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0x16
+	.long	.LASF1829
+	.value	0x12e
+	.byte	0x33
+	.long	0x201
+	.byte	0x1
+	.uleb128 0xc
+	.quad	.LBB182
+	.quad	.LBE182-.LBB182
+	.long	0x3d00
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x12e
+	.byte	0x51
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL409
+	.long	0xade
+	.long	0x3c5c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL411
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL412
+	.long	0xcd1
+	.long	0x3cb6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL413
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL419
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL188
+	.long	0x3e12
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x133
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL415
+	.long	0xd04
+	.long	0x3d88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL416
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL417
+	.long	0xcd1
+	.long	0x3dd5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x133
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC76
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL420
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x133
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC76
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB186
+	.quad	.LBE186-.LBB186
+	.long	0x423f
+	.uleb128 0x7
+	.long	.LASF1837
+	.value	0x134
+	.byte	0x18
+	.long	0x1a3
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x15
+	.long	.LASF1848
+	.value	0x134
+	.byte	0x3a
+	.long	0x4458
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x15
+	.long	.LASF1838
+	.value	0x134
+	.byte	0x6a
+	.long	0x88c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x29
+	.quad	.LBB187
+	.quad	.LBE187-.LBB187
+	.uleb128 0x16
+	.long	.LASF1839
+	.value	0x134
+	.byte	0xac
+	.long	0x201
+	.byte	0x2
+	.uleb128 0x2e
+	.long	.LASF1840
+	.value	0x134
+	.value	0x11b
+	.long	0x201
+	.long	.LLST190
+	.long	.LVUS190
+	.uleb128 0x4
+	.long	.LLRL191
+	.long	0x3fc7
+	.uleb128 0x2e
+	.long	.LASF1841
+	.value	0x134
+	.value	0x138
+	.long	0x201
+	.long	.LLST192
+	.long	.LVUS192
+	.uleb128 0xc
+	.quad	.LBB189
+	.quad	.LBE189-.LBB189
+	.long	0x3f85
+	.uleb128 0x38
+	.string	"exc"
+	.value	0x134
+	.value	0x159
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x2
+	.quad	.LVL422
+	.long	0xbfd
+	.long	0x3ef1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL424
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL425
+	.long	0xcd1
+	.long	0x3f43
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x134
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL426
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x134
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL441
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x134
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL193
+	.long	0x4230
+	.uleb128 0x7
+	.long	.LASF1842
+	.value	0x134
+	.byte	0x9d
+	.long	0x1a3
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x4
+	.long	.LLRL195
+	.long	0x40fb
+	.uleb128 0x7
+	.long	.LASF1843
+	.value	0x134
+	.byte	0x4a
+	.long	0x1a3
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0x2
+	.quad	.LVL431
+	.long	0xbc5
+	.long	0x401f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL443
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL444
+	.long	0xcd1
+	.long	0x4072
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x134
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL446
+	.long	0xcd1
+	.long	0x40b8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x134
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL447
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x134
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL197
+	.long	0x419f
+	.uleb128 0x7
+	.long	.LASF1844
+	.value	0x134
+	.byte	0x8b
+	.long	0x1a3
+	.long	.LLST198
+	.long	.LVUS198
+	.uleb128 0x7
+	.long	.LASF1845
+	.value	0x134
+	.byte	0xc4
+	.long	0x1a3
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x2
+	.quad	.LVL433
+	.long	0xbae
+	.long	0x4144
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL435
+	.long	0xbae
+	.long	0x415c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL449
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x134
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL428
+	.long	0xbe1
+	.long	0x41bd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL430
+	.long	0xcee
+	.long	0x41d5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL436
+	.long	0xcc1
+	.long	0x41ed
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL442
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x134
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL437
+	.long	0x7c72
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL406
+	.long	0xd21
+	.long	0x425c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL408
+	.long	0x4468
+	.uleb128 0x6
+	.quad	.LVL414
+	.long	0x4468
+	.uleb128 0x3
+	.quad	.LVL450
+	.long	0xcc1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL200
+	.long	0x4430
+	.uleb128 0x15
+	.long	.LASF1846
+	.value	0x139
+	.byte	0x14
+	.long	0x2d64
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x16
+	.long	.LASF1847
+	.value	0x139
+	.byte	0x47
+	.long	0x201
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF1828
+	.value	0x139
+	.byte	0xba
+	.long	0x201
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x7
+	.long	.LASF1829
+	.value	0x139
+	.byte	0xd4
+	.long	0x201
+	.long	.LLST202
+	.long	.LVUS202
+	.uleb128 0x4
+	.long	.LLRL203
+	.long	0x43cd
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x139
+	.byte	0xf2
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL452
+	.long	0xade
+	.long	0x430b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL454
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL455
+	.long	0xb75
+	.long	0x4336
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL460
+	.long	0xcd1
+	.long	0x4383
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x139
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC79
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL461
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x139
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC79
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x43e0
+	.uleb128 0x2f
+	.string	"exc"
+	.value	0x139
+	.value	0x372
+	.long	0x1a3
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL462
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x139
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL361
+	.long	0x4468
+	.uleb128 0x6
+	.quad	.LVL372
+	.long	0x4468
+	.uleb128 0x6
+	.quad	.LVL377
+	.long	0x4468
+	.byte	0
+	.uleb128 0x18
+	.long	0x1a3
+	.long	0x4468
+	.uleb128 0x1a
+	.long	0x39
+	.byte	0x1
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF1879
+	.byte	0x1
+	.value	0x101
+	.byte	0xd
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4d9c
+	.uleb128 0x27
+	.string	"i"
+	.value	0x103
+	.byte	0x10
+	.long	0x201
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0x7
+	.long	.LASF1827
+	.value	0x104
+	.byte	0xf
+	.long	0x1a3
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x7
+	.long	.LASF1834
+	.value	0x105
+	.byte	0xf
+	.long	0x1a3
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x27
+	.string	"big"
+	.value	0x106
+	.byte	0xf
+	.long	0x1a3
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x4
+	.long	.LLRL143
+	.long	0x46f1
+	.uleb128 0x27
+	.string	"key"
+	.value	0x108
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x7
+	.long	.LASF1713
+	.value	0x109
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x4
+	.long	.LLRL146
+	.long	0x45ce
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x10a
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x2
+	.quad	.LVL300
+	.long	0xd04
+	.long	0x4544
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL306
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL307
+	.long	0xcd1
+	.long	0x4591
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x10a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC61
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL308
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x10a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC61
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL147
+	.long	0x469c
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x10b
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x2
+	.quad	.LVL301
+	.long	0xc4c
+	.long	0x4612
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL309
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL310
+	.long	0xcd1
+	.long	0x465f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x10b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC62
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL311
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x10b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC62
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL295
+	.long	0xaa7
+	.long	0x46b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL298
+	.long	0xc6e
+	.long	0x46d1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL302
+	.long	0xc19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL148
+	.long	0x4869
+	.uleb128 0x7
+	.long	.LASF1855
+	.value	0x10e
+	.byte	0x14
+	.long	0x1a3
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x4a
+	.long	.LASF1856
+	.byte	0x1
+	.value	0x10e
+	.byte	0x37
+	.long	0x201
+	.value	0x3e8
+	.uleb128 0x19
+	.long	.LLRL148
+	.uleb128 0x7
+	.long	.LASF1841
+	.value	0x10e
+	.byte	0x64
+	.long	0x201
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0xc
+	.quad	.LBB132
+	.quad	.LBE132-.LBB132
+	.long	0x481e
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x10e
+	.byte	0x85
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x2
+	.quad	.LVL312
+	.long	0xbfd
+	.long	0x477a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL313
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL314
+	.long	0xcd1
+	.long	0x47d4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x10e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC63
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL315
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x10e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL321
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x10e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL151
+	.long	0x49da
+	.uleb128 0x7
+	.long	.LASF1855
+	.value	0x10f
+	.byte	0x14
+	.long	0x1a3
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x7
+	.long	.LASF1856
+	.value	0x10f
+	.byte	0x37
+	.long	0x201
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x19
+	.long	.LLRL151
+	.uleb128 0x7
+	.long	.LASF1841
+	.value	0x10f
+	.byte	0x64
+	.long	0x201
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x4
+	.long	.LLRL155
+	.long	0x498f
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x10f
+	.byte	0x85
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x2
+	.quad	.LVL317
+	.long	0xbfd
+	.long	0x48eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL318
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL319
+	.long	0xcd1
+	.long	0x4945
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x10f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC63
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC66
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL322
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x10f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC66
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL329
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x10f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC66
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL156
+	.long	0x4b4d
+	.uleb128 0x7
+	.long	.LASF1855
+	.value	0x110
+	.byte	0x14
+	.long	0x1a3
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x7
+	.long	.LASF1856
+	.value	0x110
+	.byte	0x36
+	.long	0x201
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x19
+	.long	.LLRL156
+	.uleb128 0x7
+	.long	.LASF1841
+	.value	0x110
+	.byte	0x6a
+	.long	0x201
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x4
+	.long	.LLRL160
+	.long	0x4b02
+	.uleb128 0xa
+	.string	"exc"
+	.value	0x110
+	.byte	0x8b
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x2
+	.quad	.LVL324
+	.long	0xbfd
+	.long	0x4a5e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL326
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL327
+	.long	0xcd1
+	.long	0x4ab8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x110
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC63
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC67
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL330
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x110
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC67
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL340
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x110
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC67
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL161
+	.long	0x4d1b
+	.uleb128 0x7
+	.long	.LASF1713
+	.value	0x111
+	.byte	0x15
+	.long	0x1a3
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x4
+	.long	.LLRL163
+	.long	0x4cee
+	.uleb128 0x7
+	.long	.LASF1857
+	.value	0x111
+	.byte	0x4c
+	.long	0x1a3
+	.long	.LLST164
+	.long	.LVUS164
+	.uleb128 0x4
+	.long	.LLRL165
+	.long	0x4cc3
+	.uleb128 0x7
+	.long	.LASF1858
+	.value	0x111
+	.byte	0x7c
+	.long	0x1a3
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0x7
+	.long	.LASF1859
+	.value	0x111
+	.byte	0x9d
+	.long	0x1a3
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0x19
+	.long	.LLRL165
+	.uleb128 0x7
+	.long	.LASF1843
+	.value	0x111
+	.byte	0xc2
+	.long	0x1a3
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x6
+	.quad	.LVL337
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL338
+	.long	0xcd1
+	.long	0x4c2b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x112
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC70
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL345
+	.long	0xcd1
+	.long	0x4c78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x112
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC70
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL346
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x112
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC73
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC70
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL333
+	.long	0xbe1
+	.long	0x4ce0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL347
+	.long	0xcc1
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL331
+	.long	0xa8b
+	.long	0x4d06
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL348
+	.long	0xcc1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL287
+	.long	0xd21
+	.long	0x4d32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL290
+	.long	0xc86
+	.long	0x4d49
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL292
+	.long	0xabd
+	.long	0x4d67
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL303
+	.long	0x7c72
+	.uleb128 0x3
+	.quad	.LVL349
+	.long	0xc19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1860
+	.byte	0xf7
+	.byte	0x14
+	.long	0x3bd
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4f37
+	.uleb128 0x11
+	.long	.LASF1823
+	.byte	0xf7
+	.byte	0x44
+	.long	0x489
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x11
+	.long	.LASF1824
+	.byte	0xf7
+	.byte	0x59
+	.long	0xd77
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0xf
+	.long	.LASF1850
+	.byte	0xf9
+	.byte	0xf
+	.long	0xb4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LLRL113
+	.long	0x4e9e
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0xfa
+	.byte	0x13
+	.long	0x219
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x2a
+	.long	.LASF1831
+	.byte	0xfa
+	.byte	0x11
+	.long	0x219
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL238
+	.long	0xb28
+	.long	0x4e48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_test_freelists_thread_exit_fill
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL245
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xfa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC58
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LLRL115
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0xfb
+	.byte	0x13
+	.long	0x219
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0xfb
+	.byte	0x11
+	.long	0x219
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x2
+	.quad	.LVL240
+	.long	0xb08
+	.long	0x4ee0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL247
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xfb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1861
+	.byte	0xef
+	.byte	0xe
+	.long	0x47
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x500d
+	.uleb128 0x11
+	.long	.LASF1862
+	.byte	0xef
+	.byte	0x35
+	.long	0x47
+	.long	.LLST204
+	.long	.LVUS204
+	.uleb128 0x8
+	.long	.LASF1835
+	.byte	0xf1
+	.byte	0xf
+	.long	0x1a3
+	.long	.LLST205
+	.long	.LVUS205
+	.uleb128 0x2
+	.quad	.LVL465
+	.long	0xc6e
+	.long	0x4f95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL467
+	.long	0xa74
+	.long	0x4fad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL468
+	.long	0xa5e
+	.long	0x4fce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x32
+	.byte	0x8
+	.long	0
+	.long	0x3ff80000
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL469
+	.long	0xaa7
+	.long	0x4fe7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL470
+	.long	0xc19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1863
+	.byte	0xa8
+	.byte	0x14
+	.long	0x3bd
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6baf
+	.uleb128 0x11
+	.long	.LASF1823
+	.byte	0xa8
+	.byte	0x38
+	.long	0x489
+	.long	.LLST206
+	.long	.LVUS206
+	.uleb128 0x11
+	.long	.LASF1824
+	.byte	0xa8
+	.byte	0x4d
+	.long	0xd77
+	.long	.LLST207
+	.long	.LVUS207
+	.uleb128 0x12
+	.string	"uq"
+	.byte	0xaa
+	.byte	0x13
+	.long	0x7a9
+	.long	.LLST208
+	.long	.LVUS208
+	.uleb128 0xf
+	.long	.LASF1864
+	.byte	0xab
+	.byte	0xf
+	.long	0x6baf
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LLRL209
+	.long	0x58b5
+	.uleb128 0x12
+	.string	"x"
+	.byte	0xaf
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST210
+	.long	.LVUS210
+	.uleb128 0x4
+	.long	.LLRL211
+	.long	0x51e7
+	.uleb128 0x8
+	.long	.LASF1828
+	.byte	0xb0
+	.byte	0x18
+	.long	0x20d
+	.long	.LLST212
+	.long	.LVUS212
+	.uleb128 0x4b
+	.long	.LASF1829
+	.byte	0x1
+	.byte	0xb0
+	.byte	0x31
+	.long	0x20d
+	.value	0x3e8
+	.uleb128 0xc
+	.quad	.LBB206
+	.quad	.LBE206-.LBB206
+	.long	0x519e
+	.uleb128 0x1f
+	.string	"exc"
+	.byte	0xb0
+	.byte	0x4f
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x2
+	.quad	.LVL481
+	.long	0xa1e
+	.long	0x50fc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL482
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL483
+	.long	0xcd1
+	.long	0x5155
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL484
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL506
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL213
+	.long	0x52e0
+	.uleb128 0x8
+	.long	.LASF1865
+	.byte	0xb3
+	.byte	0x18
+	.long	0x1a3
+	.long	.LLST214
+	.long	.LVUS214
+	.uleb128 0x26
+	.long	.LASF1866
+	.byte	0xb3
+	.byte	0x38
+	.long	0x1a3
+	.uleb128 0x4
+	.long	.LLRL215
+	.long	0x528c
+	.uleb128 0x23
+	.long	.LASF1867
+	.byte	0xb3
+	.value	0x114
+	.long	0x1a3
+	.long	.LLST216
+	.long	.LVUS216
+	.uleb128 0x2
+	.quad	.LVL489
+	.long	0xbae
+	.long	0x5243
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL509
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC84
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL488
+	.long	0xcee
+	.long	0x52a4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL507
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC83
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL217
+	.long	0x548a
+	.uleb128 0xf
+	.long	.LASF1846
+	.byte	0xb4
+	.byte	0x18
+	.long	0x2d64
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x8
+	.long	.LASF1847
+	.byte	0xb4
+	.byte	0x48
+	.long	0x201
+	.long	.LLST218
+	.long	.LVUS218
+	.uleb128 0x8
+	.long	.LASF1828
+	.byte	0xb4
+	.byte	0xba
+	.long	0x20d
+	.long	.LLST219
+	.long	.LVUS219
+	.uleb128 0x8
+	.long	.LASF1829
+	.byte	0xb4
+	.byte	0xd3
+	.long	0x20d
+	.long	.LLST220
+	.long	.LVUS220
+	.uleb128 0x4
+	.long	.LLRL221
+	.long	0x5428
+	.uleb128 0x1f
+	.string	"exc"
+	.byte	0xb4
+	.byte	0xf1
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x2
+	.quad	.LVL492
+	.long	0xa1e
+	.long	0x5368
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL494
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL495
+	.long	0xb75
+	.long	0x5393
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL510
+	.long	0xcd1
+	.long	0x53df
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC86
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL511
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC86
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x543b
+	.uleb128 0x4c
+	.string	"exc"
+	.byte	0x1
+	.byte	0xb4
+	.value	0x368
+	.long	0x1a3
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL512
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL222
+	.long	0x5583
+	.uleb128 0x8
+	.long	.LASF1865
+	.byte	0xb7
+	.byte	0x18
+	.long	0x1a3
+	.long	.LLST223
+	.long	.LVUS223
+	.uleb128 0x26
+	.long	.LASF1866
+	.byte	0xb7
+	.byte	0x38
+	.long	0x1a3
+	.uleb128 0x4
+	.long	.LLRL224
+	.long	0x552f
+	.uleb128 0x23
+	.long	.LASF1867
+	.byte	0xb7
+	.value	0x10f
+	.long	0x1a3
+	.long	.LLST225
+	.long	.LVUS225
+	.uleb128 0x2
+	.quad	.LVL501
+	.long	0xbae
+	.long	0x54e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL515
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC87
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL500
+	.long	0xcee
+	.long	0x5547
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL513
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC83
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL226
+	.long	0x56d4
+	.uleb128 0x8
+	.long	.LASF1828
+	.byte	0xb8
+	.byte	0x17
+	.long	0x219
+	.long	.LLST227
+	.long	.LVUS227
+	.uleb128 0x8
+	.long	.LASF1829
+	.byte	0xb8
+	.byte	0x2f
+	.long	0x219
+	.long	.LLST228
+	.long	.LVUS228
+	.uleb128 0x4
+	.long	.LLRL229
+	.long	0x568b
+	.uleb128 0x1f
+	.string	"exc"
+	.byte	0xb8
+	.byte	0x4d
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x2
+	.quad	.LVL502
+	.long	0x9ec
+	.long	0x55e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL503
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL504
+	.long	0xcd1
+	.long	0x5642
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC89
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL516
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC89
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL521
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC90
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC89
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL230
+	.long	0x5825
+	.uleb128 0x8
+	.long	.LASF1828
+	.byte	0xb9
+	.byte	0x18
+	.long	0x20d
+	.long	.LLST231
+	.long	.LVUS231
+	.uleb128 0x8
+	.long	.LASF1829
+	.byte	0xb9
+	.byte	0x31
+	.long	0x20d
+	.long	.LLST232
+	.long	.LVUS232
+	.uleb128 0x4
+	.long	.LLRL233
+	.long	0x57dc
+	.uleb128 0x1f
+	.string	"exc"
+	.byte	0xb9
+	.byte	0x4f
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x2
+	.quad	.LVL517
+	.long	0xa1e
+	.long	0x573a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL518
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL519
+	.long	0xcd1
+	.long	0x5793
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL522
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL542
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL479
+	.long	0xaa7
+	.long	0x583e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL485
+	.long	0xcc1
+	.long	0x5856
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL486
+	.long	0xa08
+	.long	0x586f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x7d0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL497
+	.long	0xcc1
+	.long	0x5887
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL498
+	.long	0xaa7
+	.long	0x58a0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0xbb8
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL523
+	.long	0xcc1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL234
+	.long	0x5ca4
+	.uleb128 0x12
+	.string	"x"
+	.byte	0xbf
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST235
+	.long	.LVUS235
+	.uleb128 0x4
+	.long	.LLRL236
+	.long	0x59c8
+	.uleb128 0x8
+	.long	.LASF1865
+	.byte	0xc2
+	.byte	0x18
+	.long	0x1a3
+	.long	.LLST237
+	.long	.LVUS237
+	.uleb128 0x26
+	.long	.LASF1866
+	.byte	0xc2
+	.byte	0x38
+	.long	0x1a3
+	.uleb128 0x4
+	.long	.LLRL238
+	.long	0x5974
+	.uleb128 0x23
+	.long	.LASF1867
+	.byte	0xc2
+	.value	0x116
+	.long	0x1a3
+	.long	.LLST239
+	.long	.LVUS239
+	.uleb128 0x2
+	.quad	.LVL530
+	.long	0xbae
+	.long	0x592b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL545
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC92
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL529
+	.long	0xcee
+	.long	0x598c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL543
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC83
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL240
+	.long	0x5ac1
+	.uleb128 0x8
+	.long	.LASF1865
+	.byte	0xc5
+	.byte	0x18
+	.long	0x1a3
+	.long	.LLST241
+	.long	.LVUS241
+	.uleb128 0x26
+	.long	.LASF1866
+	.byte	0xc5
+	.byte	0x38
+	.long	0x1a3
+	.uleb128 0x4
+	.long	.LLRL242
+	.long	0x5a6d
+	.uleb128 0x23
+	.long	.LASF1867
+	.byte	0xc5
+	.value	0x111
+	.long	0x1a3
+	.long	.LLST243
+	.long	.LVUS243
+	.uleb128 0x2
+	.quad	.LVL535
+	.long	0xbae
+	.long	0x5a24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL548
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC94
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL534
+	.long	0xcee
+	.long	0x5a85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL546
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC83
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL244
+	.long	0x5c07
+	.uleb128 0x8
+	.long	.LASF1858
+	.byte	0xc6
+	.byte	0x18
+	.long	0x1a3
+	.long	.LLST245
+	.long	.LVUS245
+	.uleb128 0x26
+	.long	.LASF1859
+	.byte	0xc6
+	.byte	0x35
+	.long	0x1a3
+	.uleb128 0x19
+	.long	.LLRL244
+	.uleb128 0x8
+	.long	.LASF1843
+	.byte	0xc6
+	.byte	0x5e
+	.long	0x1a3
+	.long	.LLST246
+	.long	.LVUS246
+	.uleb128 0x2
+	.quad	.LVL537
+	.long	0xbc5
+	.long	0x5b18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL539
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL540
+	.long	0xcd1
+	.long	0x5b71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC96
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC78
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL550
+	.long	0xcd1
+	.long	0x5bbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC78
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL551
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC97
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC78
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL524
+	.long	0xa5e
+	.long	0x5c28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x32
+	.byte	0x8
+	.long	0
+	.long	0x3ff80000
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL526
+	.long	0xcc1
+	.uleb128 0x2
+	.quad	.LVL527
+	.long	0x9d6
+	.long	0x5c56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x32
+	.byte	0x8
+	.long	0
+	.long	0x40040000
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL531
+	.long	0xcc1
+	.long	0x5c6e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL532
+	.long	0xa5e
+	.long	0x5c8f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x32
+	.byte	0x8
+	.long	0
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL552
+	.long	0xcc1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL247
+	.long	0x6473
+	.uleb128 0x12
+	.string	"x"
+	.byte	0xcc
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST248
+	.long	.LVUS248
+	.uleb128 0x8
+	.long	.LASF1868
+	.byte	0xcd
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST249
+	.long	.LVUS249
+	.uleb128 0x8
+	.long	.LASF1869
+	.byte	0xce
+	.byte	0x13
+	.long	0x20d
+	.long	.LLST250
+	.long	.LVUS250
+	.uleb128 0xc
+	.quad	.LBB248
+	.quad	.LBE248-.LBB248
+	.long	0x5daf
+	.uleb128 0x1f
+	.string	"exc"
+	.byte	0xcf
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x2
+	.quad	.LVL558
+	.long	0xa1e
+	.long	0x5d27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL559
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL560
+	.long	0xcd1
+	.long	0x5d73
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xcf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL561
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xcf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB249
+	.quad	.LBE249-.LBB249
+	.long	0x61ca
+	.uleb128 0x8
+	.long	.LASF1837
+	.byte	0xd2
+	.byte	0x18
+	.long	0x1a3
+	.long	.LLST251
+	.long	.LVUS251
+	.uleb128 0xf
+	.long	.LASF1848
+	.byte	0xd2
+	.byte	0x37
+	.long	0x4458
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0xf
+	.long	.LASF1838
+	.byte	0xd2
+	.byte	0x67
+	.long	0x88c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x29
+	.quad	.LBB250
+	.quad	.LBE250-.LBB250
+	.uleb128 0x2a
+	.long	.LASF1839
+	.byte	0xd2
+	.byte	0xa9
+	.long	0x201
+	.byte	0x2
+	.uleb128 0x23
+	.long	.LASF1840
+	.byte	0xd2
+	.value	0x118
+	.long	0x201
+	.long	.LLST252
+	.long	.LVUS252
+	.uleb128 0x4
+	.long	.LLRL253
+	.long	0x5f5b
+	.uleb128 0x23
+	.long	.LASF1841
+	.byte	0xd2
+	.value	0x135
+	.long	0x201
+	.long	.LLST254
+	.long	.LVUS254
+	.uleb128 0xc
+	.quad	.LBB252
+	.quad	.LBE252-.LBB252
+	.long	0x5f1a
+	.uleb128 0x4d
+	.string	"exc"
+	.byte	0x1
+	.byte	0xd2
+	.value	0x156
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x2
+	.quad	.LVL567
+	.long	0xbfd
+	.long	0x5e88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL568
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL569
+	.long	0xcd1
+	.long	0x5ed9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL570
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL584
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL255
+	.long	0x61bb
+	.uleb128 0x8
+	.long	.LASF1842
+	.byte	0xd2
+	.byte	0x9a
+	.long	0x1a3
+	.long	.LLST256
+	.long	.LVUS256
+	.uleb128 0x4
+	.long	.LLRL257
+	.long	0x608a
+	.uleb128 0x8
+	.long	.LASF1843
+	.byte	0xd2
+	.byte	0x47
+	.long	0x1a3
+	.long	.LLST258
+	.long	.LVUS258
+	.uleb128 0x2
+	.quad	.LVL575
+	.long	0xbc5
+	.long	0x5fb1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL586
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL587
+	.long	0xcd1
+	.long	0x6003
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL589
+	.long	0xcd1
+	.long	0x6048
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL590
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL259
+	.long	0x612b
+	.uleb128 0x8
+	.long	.LASF1844
+	.byte	0xd2
+	.byte	0x88
+	.long	0x1a3
+	.long	.LLST260
+	.long	.LVUS260
+	.uleb128 0x8
+	.long	.LASF1845
+	.byte	0xd2
+	.byte	0xc1
+	.long	0x1a3
+	.long	.LLST261
+	.long	.LVUS261
+	.uleb128 0x2
+	.quad	.LVL576
+	.long	0xbae
+	.long	0x60d1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL578
+	.long	0xbae
+	.long	0x60e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL592
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL572
+	.long	0xbe1
+	.long	0x6149
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL574
+	.long	0xcee
+	.long	0x6161
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL579
+	.long	0xcc1
+	.long	0x6179
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL585
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL580
+	.long	0x7c72
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB260
+	.quad	.LBE260-.LBB260
+	.long	0x6297
+	.uleb128 0x1f
+	.string	"exc"
+	.byte	0xd3
+	.byte	0x18
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x2
+	.quad	.LVL593
+	.long	0xa1e
+	.long	0x620f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -152
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL595
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL596
+	.long	0xcd1
+	.long	0x625b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC100
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL597
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC100
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL262
+	.long	0x63f4
+	.uleb128 0x8
+	.long	.LASF1828
+	.byte	0xd4
+	.byte	0x18
+	.long	0x20d
+	.long	.LLST263
+	.long	.LVUS263
+	.uleb128 0x8
+	.long	.LASF1829
+	.byte	0xd4
+	.byte	0x31
+	.long	0x20d
+	.long	.LLST264
+	.long	.LVUS264
+	.uleb128 0xc
+	.quad	.LBB262
+	.quad	.LBE262-.LBB262
+	.long	0x63ab
+	.uleb128 0x1f
+	.string	"exc"
+	.byte	0xd4
+	.byte	0x4f
+	.long	0x1a3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x2
+	.quad	.LVL598
+	.long	0xa1e
+	.long	0x6309
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL600
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL601
+	.long	0xcd1
+	.long	0x6362
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC101
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL602
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC101
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL616
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xd4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC101
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL553
+	.long	0xc6e
+	.long	0x640b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL556
+	.long	0xc6e
+	.long	0x6422
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL562
+	.long	0xcc1
+	.long	0x643a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL563
+	.long	0xc6e
+	.long	0x6451
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL604
+	.long	0xc19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -152
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL265
+	.long	0x6af5
+	.uleb128 0x8
+	.long	.LASF1835
+	.byte	0xda
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST266
+	.long	.LVUS266
+	.uleb128 0x12
+	.string	"x"
+	.byte	0xdb
+	.byte	0x13
+	.long	0x1a3
+	.long	.LLST267
+	.long	.LVUS267
+	.uleb128 0x4
+	.long	.LLRL268
+	.long	0x6618
+	.uleb128 0x8
+	.long	.LASF1857
+	.byte	0xdc
+	.byte	0x19
+	.long	0x1a3
+	.long	.LLST269
+	.long	.LVUS269
+	.uleb128 0x4
+	.long	.LLRL270
+	.long	0x65f2
+	.uleb128 0x8
+	.long	.LASF1858
+	.byte	0xdc
+	.byte	0x3e
+	.long	0x1a3
+	.long	.LLST271
+	.long	.LVUS271
+	.uleb128 0x8
+	.long	.LASF1859
+	.byte	0xdc
+	.byte	0x5e
+	.long	0x1a3
+	.long	.LLST272
+	.long	.LVUS272
+	.uleb128 0x19
+	.long	.LLRL270
+	.uleb128 0x8
+	.long	.LASF1843
+	.byte	0xdc
+	.byte	0x87
+	.long	0x1a3
+	.long	.LLST273
+	.long	.LVUS273
+	.uleb128 0x6
+	.quad	.LVL613
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL614
+	.long	0xcd1
+	.long	0x655c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xdc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC102
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL621
+	.long	0xcd1
+	.long	0x65a8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xdc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC102
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL622
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xdc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC73
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC102
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL609
+	.long	0x9bf
+	.long	0x660a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL623
+	.long	0xcc1
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB271
+	.quad	.LBE271-.LBB271
+	.long	0x67b4
+	.uleb128 0x8
+	.long	.LASF1857
+	.byte	0xdf
+	.byte	0x19
+	.long	0x1a3
+	.long	.LLST274
+	.long	.LVUS274
+	.uleb128 0xc
+	.quad	.LBB272
+	.quad	.LBE272-.LBB272
+	.long	0x678e
+	.uleb128 0x8
+	.long	.LASF1858
+	.byte	0xdf
+	.byte	0x3e
+	.long	0x1a3
+	.long	.LLST275
+	.long	.LVUS275
+	.uleb128 0x8
+	.long	.LASF1859
+	.byte	0xdf
+	.byte	0x5e
+	.long	0x1a3
+	.long	.LLST276
+	.long	.LVUS276
+	.uleb128 0x29
+	.quad	.LBB273
+	.quad	.LBE273-.LBB273
+	.uleb128 0x8
+	.long	.LASF1843
+	.byte	0xdf
+	.byte	0x87
+	.long	0x1a3
+	.long	.LLST277
+	.long	.LVUS277
+	.uleb128 0x6
+	.quad	.LVL631
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL632
+	.long	0xcd1
+	.long	0x66f8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xdf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC102
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL637
+	.long	0xcd1
+	.long	0x6744
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xdf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC102
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL638
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xdf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC73
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC102
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL627
+	.long	0x9bf
+	.long	0x67a6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL639
+	.long	0xcc1
+	.byte	0
+	.uleb128 0xc
+	.quad	.LBB274
+	.quad	.LBE274-.LBB274
+	.long	0x6950
+	.uleb128 0x8
+	.long	.LASF1857
+	.byte	0xe0
+	.byte	0x19
+	.long	0x1a3
+	.long	.LLST278
+	.long	.LVUS278
+	.uleb128 0xc
+	.quad	.LBB275
+	.quad	.LBE275-.LBB275
+	.long	0x692a
+	.uleb128 0x8
+	.long	.LASF1858
+	.byte	0xe0
+	.byte	0x3e
+	.long	0x1a3
+	.long	.LLST279
+	.long	.LVUS279
+	.uleb128 0x8
+	.long	.LASF1859
+	.byte	0xe0
+	.byte	0x5e
+	.long	0x1a3
+	.long	.LLST280
+	.long	.LVUS280
+	.uleb128 0x29
+	.quad	.LBB276
+	.quad	.LBE276-.LBB276
+	.uleb128 0x8
+	.long	.LASF1843
+	.byte	0xe0
+	.byte	0x87
+	.long	0x1a3
+	.long	.LLST281
+	.long	.LVUS281
+	.uleb128 0x6
+	.quad	.LVL644
+	.long	0xcee
+	.uleb128 0x2
+	.quad	.LVL645
+	.long	0xcd1
+	.long	0x6894
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC103
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL650
+	.long	0xcd1
+	.long	0x68e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC103
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL651
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC73
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC103
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL640
+	.long	0x9bf
+	.long	0x6942
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL652
+	.long	0xcc1
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL282
+	.long	0x6a76
+	.uleb128 0xf
+	.long	.LASF1870
+	.byte	0xe1
+	.byte	0x18
+	.long	0x2d64
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x2a
+	.long	.LASF1871
+	.byte	0xe1
+	.byte	0x51
+	.long	0x201
+	.byte	0x1
+	.uleb128 0x19
+	.long	.LLRL283
+	.uleb128 0x8
+	.long	.LASF1872
+	.byte	0xe1
+	.byte	0xd3
+	.long	0x1a3
+	.long	.LLST284
+	.long	.LVUS284
+	.uleb128 0x2
+	.quad	.LVL654
+	.long	0x9bf
+	.long	0x69a4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL656
+	.long	0xcee
+	.long	0x69bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL657
+	.long	0xb75
+	.long	0x69e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL669
+	.long	0xcd1
+	.long	0x6a2c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC106
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC105
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC104
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL670
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC107
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC105
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC104
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL605
+	.long	0xc6e
+	.long	0x6a8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL607
+	.long	0xa74
+	.long	0x6aa5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL624
+	.long	0xcc1
+	.long	0x6abd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL625
+	.long	0xa74
+	.long	0x6ad5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL658
+	.long	0xc19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL473
+	.long	0xa51
+	.uleb128 0x2
+	.quad	.LVL475
+	.long	0xa3a
+	.long	0x6b1a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL476
+	.long	0xa3a
+	.long	0x6b32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL477
+	.long	0xa3a
+	.long	0x6b4a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL478
+	.long	0xa3a
+	.long	0x6b62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL659
+	.long	0x9b8
+	.uleb128 0x6
+	.quad	.LVL660
+	.long	0x9b8
+	.uleb128 0x2
+	.quad	.LVL661
+	.long	0x9a0
+	.long	0x6b9a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL662
+	.long	0x98d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x1a3
+	.long	0x6bbf
+	.uleb128 0x1a
+	.long	0x39
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1873
+	.byte	0x93
+	.byte	0x14
+	.long	0x3bd
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6fd2
+	.uleb128 0x11
+	.long	.LASF1823
+	.byte	0x93
+	.byte	0x41
+	.long	0x489
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x11
+	.long	.LASF1824
+	.byte	0x93
+	.byte	0x56
+	.long	0xd77
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0xf
+	.long	.LASF1850
+	.byte	0x95
+	.byte	0xf
+	.long	0xb4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xf
+	.long	.LASF1851
+	.byte	0x96
+	.byte	0xb
+	.long	0x47
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xf
+	.long	.LASF1852
+	.byte	0x97
+	.byte	0xb
+	.long	0x47
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LLRL120
+	.long	0x6cde
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x99
+	.byte	0x13
+	.long	0x219
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x2a
+	.long	.LASF1831
+	.byte	0x99
+	.byte	0x38
+	.long	0x219
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL251
+	.long	0xb28
+	.long	0x6c88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_test_thread_exit_malloc_free
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL265
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x99
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL122
+	.long	0x6d7a
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x9a
+	.byte	0x13
+	.long	0x219
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x9a
+	.byte	0x11
+	.long	0x219
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x2
+	.quad	.LVL253
+	.long	0xb08
+	.long	0x6d24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL267
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x9a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL125
+	.long	0x6e2f
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x9b
+	.byte	0x13
+	.long	0x219
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x9b
+	.byte	0x39
+	.long	0x219
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x2
+	.quad	.LVL255
+	.long	0xb28
+	.long	0x6dd9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_test_thread_exit_malloc_free
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL269
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x9b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL128
+	.long	0x6ecb
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x9c
+	.byte	0x13
+	.long	0x219
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x9c
+	.byte	0x11
+	.long	0x219
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x2
+	.quad	.LVL257
+	.long	0xb08
+	.long	0x6e75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL271
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x9c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL131
+	.long	0x6f50
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x9f
+	.byte	0x16
+	.long	0x38e
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x9f
+	.byte	0x3a
+	.long	0x38e
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x3
+	.quad	.LVL272
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x9f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LLRL134
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0xa0
+	.byte	0x16
+	.long	0x38e
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0xa0
+	.byte	0x3b
+	.long	0x38e
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x3
+	.quad	.LVL275
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC57
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC55
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1874
+	.byte	0x89
+	.byte	0xe
+	.long	0x47
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7059
+	.uleb128 0x4e
+	.string	"p"
+	.byte	0x1
+	.byte	0x89
+	.byte	0x32
+	.long	0x47
+	.long	.LLST285
+	.long	.LVUS285
+	.uleb128 0xf
+	.long	.LASF1875
+	.byte	0x8b
+	.byte	0x10
+	.long	0x201
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x12
+	.string	"buf"
+	.byte	0x8c
+	.byte	0xb
+	.long	0x47
+	.long	.LLST286
+	.long	.LVUS286
+	.uleb128 0x2
+	.quad	.LVL673
+	.long	0x971
+	.long	0x7044
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc8
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL675
+	.long	0x95e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1876
+	.byte	0x74
+	.byte	0x14
+	.long	0x3bd
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x72e7
+	.uleb128 0x11
+	.long	.LASF1823
+	.byte	0x74
+	.byte	0x44
+	.long	0x489
+	.long	.LLST287
+	.long	.LVUS287
+	.uleb128 0x11
+	.long	.LASF1824
+	.byte	0x74
+	.byte	0x59
+	.long	0xd77
+	.long	.LLST288
+	.long	.LVUS288
+	.uleb128 0x12
+	.string	"i"
+	.byte	0x76
+	.byte	0x10
+	.long	0x201
+	.long	.LLST289
+	.long	.LVUS289
+	.uleb128 0x4
+	.long	.LLRL290
+	.long	0x72d9
+	.uleb128 0xf
+	.long	.LASF1875
+	.byte	0x78
+	.byte	0x14
+	.long	0x201
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xf
+	.long	.LASF1877
+	.byte	0x79
+	.byte	0x14
+	.long	0x201
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x12
+	.string	"p"
+	.byte	0x7a
+	.byte	0xf
+	.long	0x47
+	.long	.LLST291
+	.long	.LVUS291
+	.uleb128 0x4
+	.long	.LLRL292
+	.long	0x7197
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x7c
+	.byte	0x1a
+	.long	0x38e
+	.long	.LLST291
+	.long	.LVUS291
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x7c
+	.byte	0x70
+	.long	0x38e
+	.long	.LLST294
+	.long	.LVUS294
+	.uleb128 0x2
+	.quad	.LVL681
+	.long	0x971
+	.long	0x7141
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xf
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	allocation_sizes
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL691
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC108
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL295
+	.long	0x723f
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x7d
+	.byte	0x1a
+	.long	0x38e
+	.long	.LLST296
+	.long	.LVUS296
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x7d
+	.byte	0x6f
+	.long	0x38e
+	.long	.LLST297
+	.long	.LVUS297
+	.uleb128 0x2
+	.quad	.LVL683
+	.long	0x938
+	.long	0x71e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL693
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC110
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC109
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL298
+	.long	0x72c4
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x7e
+	.byte	0x19
+	.long	0x201
+	.long	.LLST299
+	.long	.LVUS299
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x7e
+	.byte	0x40
+	.long	0x201
+	.long	.LLST300
+	.long	.LVUS300
+	.uleb128 0x3
+	.quad	.LVL696
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC112
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC111
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL686
+	.long	0x95e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL687
+	.long	0x7c72
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1878
+	.byte	0x6c
+	.byte	0x14
+	.long	0x3bd
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7369
+	.uleb128 0x11
+	.long	.LASF1823
+	.byte	0x6c
+	.byte	0x3c
+	.long	0x489
+	.long	.LLST324
+	.long	.LVUS324
+	.uleb128 0x11
+	.long	.LASF1824
+	.byte	0x6c
+	.byte	0x51
+	.long	0xd77
+	.long	.LLST325
+	.long	.LVUS325
+	.uleb128 0x2
+	.quad	.LVL737
+	.long	0x7369
+	.long	0x734d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocator_default
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL738
+	.long	0x7369
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocator_system
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF1880
+	.byte	0x4a
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7746
+	.uleb128 0x11
+	.long	.LASF1881
+	.byte	0x4a
+	.byte	0x2e
+	.long	0x7746
+	.long	.LLST301
+	.long	.LVUS301
+	.uleb128 0x12
+	.string	"i"
+	.byte	0x4c
+	.byte	0x10
+	.long	0x201
+	.long	.LLST302
+	.long	.LVUS302
+	.uleb128 0x12
+	.string	"j"
+	.byte	0x4c
+	.byte	0x13
+	.long	0x201
+	.long	.LLST303
+	.long	.LVUS303
+	.uleb128 0x4
+	.long	.LLRL304
+	.long	0x772b
+	.uleb128 0x8
+	.long	.LASF1882
+	.byte	0x4f
+	.byte	0x18
+	.long	0x201
+	.long	.LLST305
+	.long	.LVUS305
+	.uleb128 0x8
+	.long	.LASF1883
+	.byte	0x50
+	.byte	0x18
+	.long	0x201
+	.long	.LLST306
+	.long	.LVUS306
+	.uleb128 0xf
+	.long	.LASF1875
+	.byte	0x51
+	.byte	0x18
+	.long	0x201
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xf
+	.long	.LASF1877
+	.byte	0x52
+	.byte	0x18
+	.long	0x201
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x12
+	.string	"p"
+	.byte	0x53
+	.byte	0x13
+	.long	0x47
+	.long	.LLST307
+	.long	.LVUS307
+	.uleb128 0x8
+	.long	.LASF1884
+	.byte	0x54
+	.byte	0x13
+	.long	0x47
+	.long	.LLST308
+	.long	.LVUS308
+	.uleb128 0x4
+	.long	.LLRL309
+	.long	0x74da
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x56
+	.byte	0x1e
+	.long	0x38e
+	.long	.LLST307
+	.long	.LVUS307
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x56
+	.byte	0x61
+	.long	0x38e
+	.long	.LLST311
+	.long	.LVUS311
+	.uleb128 0x2
+	.quad	.LVL702
+	.long	0xcd1
+	.long	0x74b3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC113
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.byte	0
+	.uleb128 0x30
+	.quad	.LVL718
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x11
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	allocation_sizes
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL312
+	.long	0x7585
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x59
+	.byte	0x1e
+	.long	0x38e
+	.long	.LLST308
+	.long	.LVUS308
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x59
+	.byte	0x78
+	.long	0x38e
+	.long	.LLST314
+	.long	.LVUS314
+	.uleb128 0x2
+	.quad	.LVL704
+	.long	0xcd1
+	.long	0x7562
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC114
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.byte	0
+	.uleb128 0x30
+	.quad	.LVL721
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL315
+	.long	0x760a
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x5a
+	.byte	0x1d
+	.long	0x201
+	.long	.LLST316
+	.long	.LVUS316
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x5a
+	.byte	0x44
+	.long	0x201
+	.long	.LLST317
+	.long	.LVUS317
+	.uleb128 0x3
+	.quad	.LVL707
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC112
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC116
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC115
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL318
+	.long	0x76ca
+	.uleb128 0x12
+	.string	"k"
+	.byte	0x5d
+	.byte	0x1c
+	.long	0x201
+	.long	.LLST319
+	.long	.LVUS319
+	.uleb128 0x8
+	.long	.LASF1885
+	.byte	0x5e
+	.byte	0x1c
+	.long	0x201
+	.long	.LLST320
+	.long	.LVUS320
+	.uleb128 0x4
+	.long	.LLRL321
+	.long	0x76bc
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x60
+	.byte	0x23
+	.long	0x219
+	.long	.LLST322
+	.long	.LVUS322
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x60
+	.byte	0x53
+	.long	0x219
+	.long	.LLST323
+	.long	.LVUS323
+	.uleb128 0x3
+	.quad	.LVL710
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC118
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC117
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL728
+	.long	0x7c72
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL711
+	.long	0x8c3
+	.long	0x76e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xef
+	.byte	0
+	.uleb128 0x31
+	.quad	.LVL712
+	.long	0x76fc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x31
+	.quad	.LVL713
+	.long	0x7710
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL720
+	.long	0x8c3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xcd
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL714
+	.long	0x7c72
+	.uleb128 0x6
+	.quad	.LVL731
+	.long	0x7c72
+	.byte	0
+	.uleb128 0xb
+	.long	0x831
+	.uleb128 0x1b
+	.long	.LASF1886
+	.byte	0x2f
+	.byte	0x14
+	.long	0x3bd
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x79fa
+	.uleb128 0x11
+	.long	.LASF1823
+	.byte	0x2f
+	.byte	0x3b
+	.long	0x489
+	.long	.LLST326
+	.long	.LVUS326
+	.uleb128 0x11
+	.long	.LASF1824
+	.byte	0x2f
+	.byte	0x50
+	.long	0xd77
+	.long	.LLST327
+	.long	.LVUS327
+	.uleb128 0x1f
+	.string	"p"
+	.byte	0x32
+	.byte	0x12
+	.long	0x79fa
+	.uleb128 0x9
+	.byte	0x3
+	.quad	p.0
+	.uleb128 0xf
+	.long	.LASF1875
+	.byte	0x33
+	.byte	0x10
+	.long	0x201
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x12
+	.string	"i"
+	.byte	0x34
+	.byte	0x10
+	.long	0x201
+	.long	.LLST328
+	.long	.LVUS328
+	.uleb128 0x12
+	.string	"j"
+	.byte	0x34
+	.byte	0x13
+	.long	0x201
+	.long	.LLST329
+	.long	.LVUS329
+	.uleb128 0x4
+	.long	.LLRL330
+	.long	0x7877
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x37
+	.byte	0x1a
+	.long	0x38e
+	.long	.LLST331
+	.long	.LVUS331
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x37
+	.byte	0x62
+	.long	0x38e
+	.long	.LLST332
+	.long	.LVUS332
+	.uleb128 0x2
+	.quad	.LVL742
+	.long	0x971
+	.long	0x7821
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL747
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x37
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC119
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL333
+	.long	0x7919
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x3d
+	.byte	0x1a
+	.long	0x38e
+	.long	.LLST334
+	.long	.LVUS334
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x3d
+	.byte	0x62
+	.long	0x38e
+	.long	.LLST335
+	.long	.LVUS335
+	.uleb128 0x2
+	.quad	.LVL754
+	.long	0x971
+	.long	0x78c3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL759
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC119
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL336
+	.long	0x799e
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x41
+	.byte	0x30
+	.long	0x219
+	.long	.LLST337
+	.long	.LVUS337
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x41
+	.byte	0x63
+	.long	0x219
+	.long	.LLST338
+	.long	.LVUS338
+	.uleb128 0x3
+	.quad	.LVL766
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC121
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC120
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL744
+	.long	0x7c72
+	.uleb128 0x6
+	.quad	.LVL750
+	.long	0x95e
+	.uleb128 0x6
+	.quad	.LVL751
+	.long	0x7c72
+	.uleb128 0x6
+	.quad	.LVL756
+	.long	0x7c72
+	.uleb128 0x6
+	.quad	.LVL768
+	.long	0x95e
+	.uleb128 0x6
+	.quad	.LVL769
+	.long	0x7c72
+	.uleb128 0x6
+	.quad	.LVL774
+	.long	0x7c72
+	.byte	0
+	.uleb128 0x18
+	.long	0x47
+	.long	0x7a0b
+	.uleb128 0x4f
+	.long	0x39
+	.value	0x3e7
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1887
+	.byte	0x27
+	.byte	0x14
+	.long	0x3bd
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7a8d
+	.uleb128 0x11
+	.long	.LASF1823
+	.byte	0x27
+	.byte	0x35
+	.long	0x489
+	.long	.LLST350
+	.long	.LVUS350
+	.uleb128 0x11
+	.long	.LASF1824
+	.byte	0x27
+	.byte	0x4a
+	.long	0xd77
+	.long	.LLST351
+	.long	.LVUS351
+	.uleb128 0x2
+	.quad	.LVL799
+	.long	0x7a8d
+	.long	0x7a71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocator_default
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL800
+	.long	0x7a8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	allocator_system
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF1888
+	.byte	0x19
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7c69
+	.uleb128 0x11
+	.long	.LASF1881
+	.byte	0x19
+	.byte	0x27
+	.long	0x7746
+	.long	.LLST339
+	.long	.LVUS339
+	.uleb128 0x12
+	.string	"i"
+	.byte	0x1b
+	.byte	0x10
+	.long	0x201
+	.long	.LLST340
+	.long	.LVUS340
+	.uleb128 0x4
+	.long	.LLRL341
+	.long	0x7c5b
+	.uleb128 0x8
+	.long	.LASF1882
+	.byte	0x1d
+	.byte	0x14
+	.long	0x201
+	.long	.LLST342
+	.long	.LVUS342
+	.uleb128 0xf
+	.long	.LASF1875
+	.byte	0x1e
+	.byte	0x14
+	.long	0x201
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x12
+	.string	"p"
+	.byte	0x1f
+	.byte	0xf
+	.long	0x47
+	.long	.LLST343
+	.long	.LVUS343
+	.uleb128 0x4
+	.long	.LLRL344
+	.long	0x7ba7
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x20
+	.byte	0x1a
+	.long	0x38e
+	.long	.LLST343
+	.long	.LVUS343
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x20
+	.byte	0x5d
+	.long	0x38e
+	.long	.LLST346
+	.long	.LVUS346
+	.uleb128 0x31
+	.quad	.LVL782
+	.long	0x7b51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL791
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC113
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LLRL347
+	.long	0x7c2c
+	.uleb128 0x8
+	.long	.LASF1830
+	.byte	0x21
+	.byte	0x19
+	.long	0x201
+	.long	.LLST348
+	.long	.LVUS348
+	.uleb128 0x8
+	.long	.LASF1831
+	.byte	0x21
+	.byte	0x3d
+	.long	0x201
+	.long	.LLST349
+	.long	.LVUS349
+	.uleb128 0x3
+	.quad	.LVL794
+	.long	0xcd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC111
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC116
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC122
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL785
+	.long	0x8c3
+	.long	0x7c4a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xab
+	.byte	0
+	.uleb128 0x30
+	.quad	.LVL786
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL787
+	.long	0x7c72
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF1889
+	.long	.LASF1889
+	.uleb128 0x3a
+	.long	.LASF1890
+	.long	.LASF1890
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 52
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 52
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU9
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU79
+	.uleb128 .LVU80
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU13
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU30
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU39
+	.uleb128 .LVU45
+	.uleb128 .LVU48
+	.uleb128 .LVU56
+	.uleb128 .LVU80
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU60
+	.uleb128 .LVU67
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU85
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU61
+	.uleb128 .LVU80
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU72
+	.uleb128 .LVU78
+	.uleb128 .LVU85
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU88
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU73
+	.uleb128 .LVU80
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x3e8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x3e8
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL38-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL38-1-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU98
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU143
+	.uleb128 .LVU159
+	.uleb128 .LVU162
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU121
+	.uleb128 .LVU127
+	.uleb128 .LVU130
+	.uleb128 .LVU139
+	.uleb128 .LVU159
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU162
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU140
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU159
+	.uleb128 .LVU162
+	.uleb128 .LVU210
+	.uleb128 .LVU222
+	.uleb128 .LVU225
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU143
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU159
+	.uleb128 .LVU162
+	.uleb128 .LVU207
+	.uleb128 .LVU222
+	.uleb128 .LVU225
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU147
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 .LVU159
+	.uleb128 .LVU162
+	.uleb128 .LVU237
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU188
+	.uleb128 .LVU194
+	.uleb128 .LVU197
+	.uleb128 .LVU206
+	.uleb128 .LVU222
+	.uleb128 .LVU224
+	.uleb128 .LVU224
+	.uleb128 .LVU225
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU207
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU222
+	.uleb128 .LVU225
+	.uleb128 .LVU422
+	.uleb128 .LVU434
+	.uleb128 .LVU437
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU210
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 .LVU222
+	.uleb128 .LVU225
+	.uleb128 .LVU524
+	.uleb128 .LVU585
+	.uleb128 .LVU599
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU237
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 .LVU285
+	.uleb128 .LVU321
+	.uleb128 .LVU324
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL90-1-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU255
+	.uleb128 .LVU276
+	.uleb128 .LVU279
+	.uleb128 .LVU422
+	.uleb128 .LVU434
+	.uleb128 .LVU437
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU261
+	.uleb128 .LVU276
+	.uleb128 .LVU279
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU285
+	.uleb128 .LVU321
+	.uleb128 .LVU324
+	.uleb128 .LVU358
+	.uleb128 .LVU358
+	.uleb128 .LVU359
+	.uleb128 .LVU359
+	.uleb128 .LVU584
+	.uleb128 .LVU585
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU269
+	.uleb128 .LVU274
+	.uleb128 .LVU281
+	.uleb128 .LVU285
+	.uleb128 .LVU321
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU324
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU327
+	.uleb128 .LVU330
+	.uleb128 .LVU330
+	.uleb128 .LVU375
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU336
+	.uleb128 .LVU346
+	.uleb128 .LVU360
+	.uleb128 .LVU366
+	.uleb128 .LVU368
+	.uleb128 .LVU369
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU347
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 .LVU359
+	.uleb128 .LVU372
+	.uleb128 .LVU375
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL121-1-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU349
+	.uleb128 .LVU356
+	.uleb128 .LVU372
+	.uleb128 .LVU374
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU293
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU305
+	.uleb128 .LVU375
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 .LVU381
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU294
+	.uleb128 .LVU321
+	.uleb128 .LVU375
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU300
+	.uleb128 .LVU305
+	.uleb128 .LVU378
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU301
+	.uleb128 .LVU321
+	.uleb128 .LVU378
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU313
+	.uleb128 .LVU319
+	.uleb128 .LVU383
+	.uleb128 .LVU398
+	.uleb128 .LVU407
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU410
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU314
+	.uleb128 .LVU321
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU399
+	.uleb128 .LVU405
+	.uleb128 .LVU412
+	.uleb128 .LVU420
+	.uleb128 .LVU434
+	.uleb128 .LVU436
+	.uleb128 .LVU436
+	.uleb128 .LVU437
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU400
+	.uleb128 .LVU407
+	.uleb128 .LVU410
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU422
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 .LVU434
+	.uleb128 .LVU437
+	.uleb128 .LVU535
+	.uleb128 .LVU585
+	.uleb128 .LVU599
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL149-1-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU448
+	.uleb128 .LVU454
+	.uleb128 .LVU457
+	.uleb128 .LVU469
+	.uleb128 .LVU476
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU479
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU487
+	.uleb128 .LVU494
+	.uleb128 .LVU585
+	.uleb128 .LVU586
+	.uleb128 .LVU586
+	.uleb128 .LVU587
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU494
+	.uleb128 .LVU501
+	.uleb128 .LVU587
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 .LVU590
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU495
+	.uleb128 .LVU585
+	.uleb128 .LVU587
+	.uleb128 0
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU501
+	.uleb128 .LVU508
+	.uleb128 .LVU590
+	.uleb128 .LVU592
+	.uleb128 .LVU592
+	.uleb128 .LVU593
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU502
+	.uleb128 .LVU585
+	.uleb128 .LVU590
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU508
+	.uleb128 .LVU515
+	.uleb128 .LVU593
+	.uleb128 .LVU595
+	.uleb128 .LVU595
+	.uleb128 .LVU596
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL198-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU509
+	.uleb128 .LVU585
+	.uleb128 .LVU593
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU517
+	.uleb128 .LVU531
+	.uleb128 .LVU596
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU599
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL200-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU518
+	.uleb128 .LVU585
+	.uleb128 .LVU596
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU526
+	.uleb128 .LVU585
+	.uleb128 .LVU599
+	.uleb128 0
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU535
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU564
+	.uleb128 .LVU599
+	.uleb128 .LVU604
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL179-1-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU545
+	.uleb128 .LVU585
+	.uleb128 .LVU602
+	.uleb128 0
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU556
+	.uleb128 .LVU585
+	.uleb128 .LVU604
+	.uleb128 0
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU564
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU583
+	.uleb128 .LVU604
+	.uleb128 0
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL185-1-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU574
+	.uleb128 .LVU585
+	.uleb128 .LVU607
+	.uleb128 0
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 0
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 0
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS93:
+	.uleb128 0
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 0
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU622
+	.uleb128 .LVU629
+	.uleb128 .LVU668
+	.uleb128 .LVU669
+	.uleb128 .LVU669
+	.uleb128 .LVU670
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU630
+	.uleb128 .LVU637
+	.uleb128 .LVU670
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 .LVU673
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU631
+	.uleb128 .LVU668
+	.uleb128 .LVU670
+	.uleb128 0
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU638
+	.uleb128 .LVU645
+	.uleb128 .LVU673
+	.uleb128 .LVU675
+	.uleb128 .LVU675
+	.uleb128 .LVU676
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL228-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU639
+	.uleb128 .LVU668
+	.uleb128 .LVU673
+	.uleb128 0
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU646
+	.uleb128 .LVU653
+	.uleb128 .LVU676
+	.uleb128 .LVU678
+	.uleb128 .LVU678
+	.uleb128 .LVU679
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU647
+	.uleb128 .LVU668
+	.uleb128 .LVU676
+	.uleb128 0
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU653
+	.uleb128 .LVU666
+	.uleb128 .LVU666
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU668
+	.uleb128 .LVU679
+	.uleb128 .LVU681
+	.uleb128 .LVU681
+	.uleb128 .LVU684
+	.uleb128 .LVU684
+	.uleb128 .LVU685
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -24
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL231-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU654
+	.uleb128 .LVU668
+	.uleb128 .LVU679
+	.uleb128 0
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU660
+	.uleb128 .LVU668
+	.uleb128 .LVU681
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 .LVU685
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL234-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU661
+	.uleb128 .LVU666
+	.uleb128 .LVU666
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU668
+	.uleb128 .LVU681
+	.uleb128 .LVU684
+	.uleb128 .LVU684
+	.uleb128 .LVU685
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -24
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+.LVUS137:
+	.uleb128 0
+	.uleb128 .LVU799
+	.uleb128 .LVU799
+	.uleb128 .LVU811
+	.uleb128 .LVU811
+	.uleb128 .LVU812
+	.uleb128 .LVU812
+	.uleb128 0
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU802
+	.uleb128 .LVU804
+	.uleb128 .LVU804
+	.uleb128 .LVU810
+	.uleb128 .LVU812
+	.uleb128 0
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL281-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL281-1-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS169:
+	.uleb128 0
+	.uleb128 .LVU1007
+	.uleb128 .LVU1007
+	.uleb128 0
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS170:
+	.uleb128 0
+	.uleb128 .LVU1008
+	.uleb128 .LVU1008
+	.uleb128 0
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 .LVL357-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL357-1-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS172:
+	.uleb128 .LVU1026
+	.uleb128 .LVU1032
+	.uleb128 .LVU1035
+	.uleb128 .LVU1047
+	.uleb128 .LVU1054
+	.uleb128 .LVU1056
+	.uleb128 .LVU1056
+	.uleb128 .LVU1057
+.LLST172:
+	.byte	0x4
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 .LVL363-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL366-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 .LVL370-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU1084
+	.uleb128 .LVU1090
+	.uleb128 .LVU1093
+	.uleb128 .LVU1105
+	.uleb128 .LVU1112
+	.uleb128 .LVU1114
+	.uleb128 .LVU1114
+	.uleb128 .LVU1115
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL379-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 .LVL382-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 .LVL386-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU1126
+	.uleb128 .LVU1132
+	.uleb128 .LVU1135
+	.uleb128 .LVU1150
+	.uleb128 .LVU1159
+	.uleb128 .LVU1161
+	.uleb128 .LVU1161
+	.uleb128 .LVU1162
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 .LVL390-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL393-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 .LVL398-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU1151
+	.uleb128 .LVU1157
+	.uleb128 .LVU1157
+	.uleb128 .LVU1159
+	.uleb128 .LVU1162
+	.uleb128 .LVU1164
+	.uleb128 .LVU1164
+	.uleb128 .LVU1177
+	.uleb128 .LVU1177
+	.uleb128 .LVU1184
+	.uleb128 .LVU1184
+	.uleb128 .LVU1186
+	.uleb128 .LVU1186
+	.uleb128 .LVU1264
+	.uleb128 .LVU1300
+	.uleb128 .LVU1302
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL395-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL395-1-.Ltext0
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 .LVL400-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL400-1-.Ltext0
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU1152
+	.uleb128 .LVU1159
+	.uleb128 .LVU1162
+	.uleb128 0
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU1192
+	.uleb128 .LVU1193
+	.uleb128 .LVU1193
+	.uleb128 .LVU1355
+	.uleb128 .LVU1356
+	.uleb128 0
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL407-.Ltext0
+	.uleb128 .LVL408-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL408-1-.Ltext0
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL459-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU1201
+	.uleb128 .LVU1207
+	.uleb128 .LVU1210
+	.uleb128 .LVU1218
+	.uleb128 .LVU1230
+	.uleb128 .LVU1232
+	.uleb128 .LVU1232
+	.uleb128 .LVU1233
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 .LVL411-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL414-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 .LVL419-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU1238
+	.uleb128 .LVU1355
+	.uleb128 .LVU1356
+	.uleb128 0
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL459-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS190:
+	.uleb128 .LVU1264
+	.uleb128 .LVU1299
+	.uleb128 .LVU1299
+	.uleb128 .LVU1300
+	.uleb128 .LVU1302
+	.uleb128 .LVU1335
+.LLST190:
+	.byte	0x4
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU1252
+	.uleb128 .LVU1257
+	.uleb128 .LVU1260
+	.uleb128 .LVU1264
+	.uleb128 .LVU1300
+	.uleb128 .LVU1301
+	.uleb128 .LVU1301
+	.uleb128 .LVU1302
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 .LVL424-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 .LVL441-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS194:
+	.uleb128 .LVU1268
+	.uleb128 .LVU1271
+	.uleb128 .LVU1271
+	.uleb128 .LVU1300
+	.uleb128 .LVU1302
+	.uleb128 .LVU1319
+.LLST194:
+	.byte	0x4
+	.uleb128 .LVL429-.Ltext0
+	.uleb128 .LVL430-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL430-1-.Ltext0
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU1277
+	.uleb128 .LVU1287
+	.uleb128 .LVU1304
+	.uleb128 .LVU1310
+	.uleb128 .LVU1312
+	.uleb128 .LVU1313
+.LLST196:
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL433-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL443-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU1288
+	.uleb128 .LVU1290
+	.uleb128 .LVU1290
+	.uleb128 .LVU1300
+	.uleb128 .LVU1316
+	.uleb128 .LVU1319
+.LLST198:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL435-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL435-1-.Ltext0
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU1290
+	.uleb128 .LVU1297
+	.uleb128 .LVU1316
+	.uleb128 .LVU1318
+.LLST199:
+	.byte	0x4
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 .LVL436-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU1335
+	.uleb128 .LVU1337
+	.uleb128 .LVU1337
+	.uleb128 .LVU1354
+	.uleb128 .LVU1356
+	.uleb128 0
+.LLST201:
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL454-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL454-1-.Ltext0
+	.uleb128 .LVL457-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL459-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU1345
+	.uleb128 .LVU1356
+	.uleb128 .LVU1358
+	.uleb128 0
+.LLST202:
+	.byte	0x4
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 .LVL459-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL461-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU824
+	.uleb128 .LVU825
+	.uleb128 .LVU825
+	.uleb128 .LVU851
+	.uleb128 .LVU851
+	.uleb128 .LVU852
+	.uleb128 .LVU852
+	.uleb128 .LVU996
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU817
+	.uleb128 .LVU819
+	.uleb128 .LVU819
+	.uleb128 .LVU997
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU820
+	.uleb128 .LVU822
+	.uleb128 .LVU822
+	.uleb128 .LVU998
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL292-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL292-1-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU823
+	.uleb128 .LVU825
+	.uleb128 .LVU825
+	.uleb128 .LVU999
+	.uleb128 .LVU999
+	.uleb128 0
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -80
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU828
+	.uleb128 .LVU830
+	.uleb128 .LVU830
+	.uleb128 .LVU863
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU831
+	.uleb128 .LVU836
+	.uleb128 .LVU836
+	.uleb128 .LVU863
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL300-1-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU866
+	.uleb128 .LVU997
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU874
+	.uleb128 .LVU879
+	.uleb128 .LVU882
+	.uleb128 .LVU898
+	.uleb128 .LVU905
+	.uleb128 .LVU907
+	.uleb128 .LVU907
+	.uleb128 .LVU908
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL313-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL317-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU890
+	.uleb128 .LVU905
+	.uleb128 .LVU908
+	.uleb128 .LVU998
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS153:
+	.uleb128 .LVU891
+	.uleb128 .LVU905
+	.uleb128 .LVU908
+	.uleb128 0
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x3e8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x3e8
+	.byte	0x9f
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU898
+	.uleb128 .LVU903
+	.uleb128 .LVU910
+	.uleb128 .LVU926
+	.uleb128 .LVU934
+	.uleb128 .LVU936
+	.uleb128 .LVU936
+	.uleb128 .LVU937
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL318-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL324-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL329-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU918
+	.uleb128 .LVU934
+	.uleb128 .LVU937
+	.uleb128 .LVU999
+	.uleb128 .LVU999
+	.uleb128 0
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -80
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU919
+	.uleb128 .LVU934
+	.uleb128 .LVU937
+	.uleb128 0
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU927
+	.uleb128 .LVU932
+	.uleb128 .LVU939
+	.uleb128 .LVU948
+	.uleb128 .LVU972
+	.uleb128 .LVU974
+	.uleb128 .LVU974
+	.uleb128 .LVU975
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL326-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL331-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL340-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU949
+	.uleb128 .LVU952
+	.uleb128 .LVU952
+	.uleb128 .LVU972
+	.uleb128 .LVU975
+	.uleb128 .LVU995
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL333-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL333-1-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU953
+	.uleb128 .LVU960
+	.uleb128 .LVU960
+	.uleb128 .LVU969
+	.uleb128 .LVU975
+	.uleb128 .LVU977
+	.uleb128 .LVU977
+	.uleb128 .LVU979
+	.uleb128 .LVU983
+	.uleb128 .LVU989
+.LLST164:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL347-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU955
+	.uleb128 .LVU972
+	.uleb128 .LVU975
+	.uleb128 .LVU995
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU956
+	.uleb128 .LVU960
+	.uleb128 .LVU960
+	.uleb128 .LVU969
+	.uleb128 .LVU975
+	.uleb128 .LVU977
+	.uleb128 .LVU977
+	.uleb128 .LVU979
+	.uleb128 .LVU983
+	.uleb128 .LVU989
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL347-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU960
+	.uleb128 .LVU970
+	.uleb128 .LVU978
+	.uleb128 .LVU980
+	.uleb128 .LVU983
+	.uleb128 .LVU989
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL337-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL347-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS111:
+	.uleb128 0
+	.uleb128 .LVU692
+	.uleb128 .LVU692
+	.uleb128 0
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU693
+	.uleb128 .LVU693
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU695
+	.uleb128 .LVU702
+	.uleb128 .LVU710
+	.uleb128 .LVU711
+	.uleb128 .LVU711
+	.uleb128 .LVU712
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL245-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU703
+	.uleb128 .LVU709
+	.uleb128 .LVU712
+	.uleb128 .LVU714
+	.uleb128 .LVU714
+	.uleb128 .LVU715
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU704
+	.uleb128 .LVU710
+	.uleb128 .LVU712
+	.uleb128 0
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS204:
+	.uleb128 0
+	.uleb128 .LVU1364
+	.uleb128 .LVU1364
+	.uleb128 0
+.LLST204:
+	.byte	0x4
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS205:
+	.uleb128 .LVU1365
+	.uleb128 .LVU1366
+	.uleb128 .LVU1366
+	.uleb128 .LVU1369
+.LLST205:
+	.byte	0x4
+	.uleb128 .LVL466-.Ltext0
+	.uleb128 .LVL467-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL467-1-.Ltext0
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS206:
+	.uleb128 0
+	.uleb128 .LVU1374
+	.uleb128 .LVU1374
+	.uleb128 0
+.LLST206:
+	.byte	0x4
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 .LVL473-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL473-1-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS207:
+	.uleb128 0
+	.uleb128 .LVU1374
+	.uleb128 .LVU1374
+	.uleb128 0
+.LLST207:
+	.byte	0x4
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 .LVL473-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL473-1-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS208:
+	.uleb128 .LVU1375
+	.uleb128 .LVU1377
+	.uleb128 .LVU1377
+	.uleb128 .LVU1939
+	.uleb128 .LVU1944
+	.uleb128 0
+.LLST208:
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL475-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL475-1-.Ltext0
+	.uleb128 .LVL663-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL668-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU1386
+	.uleb128 .LVU1394
+	.uleb128 .LVU1394
+	.uleb128 .LVU1413
+	.uleb128 .LVU1413
+	.uleb128 .LVU1419
+	.uleb128 .LVU1419
+	.uleb128 .LVU1463
+	.uleb128 .LVU1463
+	.uleb128 .LVU1469
+	.uleb128 .LVU1469
+	.uleb128 .LVU1556
+	.uleb128 .LVU1611
+	.uleb128 .LVU1614
+.LLST210:
+	.byte	0x4
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 .LVL481-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL481-1-.Ltext0
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 .LVL488-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL488-1-.Ltext0
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 .LVL500-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL500-1-.Ltext0
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS212:
+	.uleb128 .LVU1394
+	.uleb128 .LVU1400
+	.uleb128 .LVU1403
+	.uleb128 .LVU1411
+	.uleb128 .LVU1496
+	.uleb128 .LVU1498
+	.uleb128 .LVU1498
+	.uleb128 .LVU1499
+.LLST212:
+	.byte	0x4
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 .LVL482-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL485-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 .LVL506-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS214:
+	.uleb128 .LVU1415
+	.uleb128 .LVU1419
+	.uleb128 .LVU1419
+	.uleb128 .LVU1463
+	.uleb128 .LVU1499
+	.uleb128 .LVU1508
+.LLST214:
+	.byte	0x4
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 .LVL488-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL488-1-.Ltext0
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU1424
+	.uleb128 .LVU1433
+	.uleb128 .LVU1501
+	.uleb128 .LVU1502
+	.uleb128 .LVU1502
+	.uleb128 .LVU1503
+.LLST216:
+	.byte	0x4
+	.uleb128 .LVL489-.Ltext0
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LVL509-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU1435
+	.uleb128 .LVU1496
+	.uleb128 .LVU1503
+	.uleb128 0
+.LLST218:
+	.byte	0x4
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL509-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS219:
+	.uleb128 .LVU1443
+	.uleb128 .LVU1445
+	.uleb128 .LVU1445
+	.uleb128 .LVU1496
+	.uleb128 .LVU1503
+	.uleb128 .LVU1689
+	.uleb128 .LVU1724
+	.uleb128 .LVU1726
+.LLST219:
+	.byte	0x4
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 .LVL494-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL494-1-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL509-.Ltext0
+	.uleb128 .LVL571-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 .LVL584-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS220:
+	.uleb128 .LVU1453
+	.uleb128 .LVU1496
+	.uleb128 .LVU1506
+	.uleb128 0
+.LLST220:
+	.byte	0x4
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS223:
+	.uleb128 .LVU1465
+	.uleb128 .LVU1469
+	.uleb128 .LVU1469
+	.uleb128 .LVU1496
+	.uleb128 .LVU1508
+	.uleb128 .LVU1556
+	.uleb128 .LVU1611
+	.uleb128 .LVU1614
+.LLST223:
+	.byte	0x4
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 .LVL500-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL500-1-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS225:
+	.uleb128 .LVU1474
+	.uleb128 .LVU1488
+	.uleb128 .LVU1510
+	.uleb128 .LVU1511
+	.uleb128 .LVU1511
+	.uleb128 .LVU1512
+.LLST225:
+	.byte	0x4
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 .LVL502-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 .LVL515-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS227:
+	.uleb128 .LVU1488
+	.uleb128 .LVU1494
+	.uleb128 .LVU1514
+	.uleb128 .LVU1529
+	.uleb128 .LVU1537
+	.uleb128 .LVU1539
+	.uleb128 .LVU1539
+	.uleb128 .LVU1540
+.LLST227:
+	.byte	0x4
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 .LVL503-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 .LVL517-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 .LVL521-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS228:
+	.uleb128 .LVU1489
+	.uleb128 .LVU1496
+	.uleb128 .LVU1512
+	.uleb128 0
+.LLST228:
+	.byte	0x4
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0xbb8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0xbb8
+	.byte	0x9f
+	.byte	0
+.LVUS231:
+	.uleb128 .LVU1529
+	.uleb128 .LVU1535
+	.uleb128 .LVU1542
+	.uleb128 .LVU1550
+	.uleb128 .LVU1611
+	.uleb128 .LVU1613
+	.uleb128 .LVU1613
+	.uleb128 .LVU1614
+.LLST231:
+	.byte	0x4
+	.uleb128 .LVL517-.Ltext0
+	.uleb128 .LVL518-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL523-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 .LVL542-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS232:
+	.uleb128 .LVU1530
+	.uleb128 .LVU1537
+	.uleb128 .LVU1540
+	.uleb128 0
+.LLST232:
+	.byte	0x4
+	.uleb128 .LVL517-.Ltext0
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0xbb8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL521-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0xbb8
+	.byte	0x9f
+	.byte	0
+.LVUS235:
+	.uleb128 .LVU1553
+	.uleb128 .LVU1554
+	.uleb128 .LVU1556
+	.uleb128 .LVU1562
+	.uleb128 .LVU1562
+	.uleb128 .LVU1576
+	.uleb128 .LVU1576
+	.uleb128 .LVU1582
+	.uleb128 .LVU1582
+	.uleb128 .LVU1611
+	.uleb128 .LVU1614
+	.uleb128 .LVU1636
+.LLST235:
+	.byte	0x4
+	.uleb128 .LVL525-.Ltext0
+	.uleb128 .LVL526-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 .LVL529-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL529-1-.Ltext0
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 .LVL534-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL534-1-.Ltext0
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 .LVL554-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS237:
+	.uleb128 .LVU1558
+	.uleb128 .LVU1562
+	.uleb128 .LVU1562
+	.uleb128 .LVU1576
+	.uleb128 .LVU1614
+	.uleb128 .LVU1618
+.LLST237:
+	.byte	0x4
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 .LVL529-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL529-1-.Ltext0
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 .LVL545-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS239:
+	.uleb128 .LVU1567
+	.uleb128 .LVU1574
+	.uleb128 .LVU1616
+	.uleb128 .LVU1617
+	.uleb128 .LVU1617
+	.uleb128 .LVU1618
+.LLST239:
+	.byte	0x4
+	.uleb128 .LVL530-.Ltext0
+	.uleb128 .LVL531-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL543-.Ltext0
+	.uleb128 .LVL544-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL544-.Ltext0
+	.uleb128 .LVL545-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS241:
+	.uleb128 .LVU1578
+	.uleb128 .LVU1582
+	.uleb128 .LVU1582
+	.uleb128 .LVU1611
+	.uleb128 .LVU1618
+	.uleb128 .LVU1636
+.LLST241:
+	.byte	0x4
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 .LVL534-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL534-1-.Ltext0
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL545-.Ltext0
+	.uleb128 .LVL554-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS243:
+	.uleb128 .LVU1587
+	.uleb128 .LVU1599
+	.uleb128 .LVU1620
+	.uleb128 .LVU1621
+	.uleb128 .LVU1621
+	.uleb128 .LVU1622
+.LLST243:
+	.byte	0x4
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 .LVL537-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL546-.Ltext0
+	.uleb128 .LVL547-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL547-.Ltext0
+	.uleb128 .LVL548-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS245:
+	.uleb128 .LVU1595
+	.uleb128 .LVU1611
+	.uleb128 .LVU1622
+	.uleb128 .LVU1636
+.LLST245:
+	.byte	0x4
+	.uleb128 .LVL536-.Ltext0
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 .LVL554-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS246:
+	.uleb128 .LVU1600
+	.uleb128 .LVU1609
+	.uleb128 .LVU1622
+	.uleb128 .LVU1624
+	.uleb128 .LVU1627
+	.uleb128 .LVU1633
+.LLST246:
+	.byte	0x4
+	.uleb128 .LVL538-.Ltext0
+	.uleb128 .LVL539-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 .LVL549-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 .LVL552-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS248:
+	.uleb128 .LVU1636
+	.uleb128 .LVU1638
+	.uleb128 .LVU1638
+	.uleb128 .LVU1657
+	.uleb128 .LVU1657
+	.uleb128 .LVU1661
+	.uleb128 .LVU1661
+	.uleb128 .LVU1921
+.LLST248:
+	.byte	0x4
+	.uleb128 .LVL554-.Ltext0
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 .LVL564-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL564-.Ltext0
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LVL655-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS249:
+	.uleb128 .LVU1639
+	.uleb128 .LVU1645
+	.uleb128 .LVU1645
+	.uleb128 .LVU1943
+	.uleb128 .LVU1943
+	.uleb128 .LVU1944
+	.uleb128 .LVU1944
+	.uleb128 0
+.LLST249:
+	.byte	0x4
+	.uleb128 .LVL557-.Ltext0
+	.uleb128 .LVL558-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL558-1-.Ltext0
+	.uleb128 .LVL667-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.byte	0x4
+	.uleb128 .LVL667-.Ltext0
+	.uleb128 .LVL668-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -144
+	.byte	0x4
+	.uleb128 .LVL668-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.byte	0
+.LVUS250:
+	.uleb128 .LVU1751
+	.uleb128 .LVU1756
+	.uleb128 .LVU1756
+	.uleb128 .LVU1759
+	.uleb128 .LVU1759
+	.uleb128 .LVU1769
+	.uleb128 .LVU1769
+	.uleb128 .LVU1794
+	.uleb128 .LVU1817
+	.uleb128 .LVU1820
+.LLST250:
+	.byte	0x4
+	.uleb128 .LVL594-.Ltext0
+	.uleb128 .LVL595-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL595-1-.Ltext0
+	.uleb128 .LVL597-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL597-.Ltext0
+	.uleb128 .LVL598-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL598-1-.Ltext0
+	.uleb128 .LVL608-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS251:
+	.uleb128 .LVU1659
+	.uleb128 .LVU1661
+	.uleb128 .LVU1661
+	.uleb128 .LVU1921
+.LLST251:
+	.byte	0x4
+	.uleb128 .LVL564-.Ltext0
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LVL655-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS252:
+	.uleb128 .LVU1689
+	.uleb128 .LVU1723
+	.uleb128 .LVU1723
+	.uleb128 .LVU1724
+	.uleb128 .LVU1726
+	.uleb128 .LVU1751
+.LLST252:
+	.byte	0x4
+	.uleb128 .LVL571-.Ltext0
+	.uleb128 .LVL581-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL581-.Ltext0
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL584-.Ltext0
+	.uleb128 .LVL594-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS254:
+	.uleb128 .LVU1676
+	.uleb128 .LVU1681
+	.uleb128 .LVU1684
+	.uleb128 .LVU1689
+	.uleb128 .LVU1724
+	.uleb128 .LVU1725
+	.uleb128 .LVU1725
+	.uleb128 .LVU1726
+.LLST254:
+	.byte	0x4
+	.uleb128 .LVL567-.Ltext0
+	.uleb128 .LVL568-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL570-.Ltext0
+	.uleb128 .LVL571-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 .LVL583-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL583-.Ltext0
+	.uleb128 .LVL584-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS256:
+	.uleb128 .LVU1692
+	.uleb128 .LVU1695
+	.uleb128 .LVU1695
+	.uleb128 .LVU1724
+	.uleb128 .LVU1726
+	.uleb128 .LVU1743
+.LLST256:
+	.byte	0x4
+	.uleb128 .LVL573-.Ltext0
+	.uleb128 .LVL574-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL574-1-.Ltext0
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL584-.Ltext0
+	.uleb128 .LVL592-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS258:
+	.uleb128 .LVU1701
+	.uleb128 .LVU1711
+	.uleb128 .LVU1728
+	.uleb128 .LVU1734
+	.uleb128 .LVU1736
+	.uleb128 .LVU1737
+.LLST258:
+	.byte	0x4
+	.uleb128 .LVL575-.Ltext0
+	.uleb128 .LVL576-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL585-.Ltext0
+	.uleb128 .LVL586-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL587-.Ltext0
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS260:
+	.uleb128 .LVU1712
+	.uleb128 .LVU1714
+	.uleb128 .LVU1714
+	.uleb128 .LVU1724
+	.uleb128 .LVU1740
+	.uleb128 .LVU1743
+.LLST260:
+	.byte	0x4
+	.uleb128 .LVL577-.Ltext0
+	.uleb128 .LVL578-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL578-1-.Ltext0
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x4
+	.uleb128 .LVL590-.Ltext0
+	.uleb128 .LVL592-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0
+.LVUS261:
+	.uleb128 .LVU1714
+	.uleb128 .LVU1721
+	.uleb128 .LVU1740
+	.uleb128 .LVU1742
+.LLST261:
+	.byte	0x4
+	.uleb128 .LVL578-.Ltext0
+	.uleb128 .LVL579-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL590-.Ltext0
+	.uleb128 .LVL591-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS263:
+	.uleb128 .LVU1770
+	.uleb128 .LVU1776
+	.uleb128 .LVU1779
+	.uleb128 .LVU1787
+	.uleb128 .LVU1787
+	.uleb128 .LVU1788
+	.uleb128 .LVU1817
+	.uleb128 .LVU1819
+	.uleb128 .LVU1819
+	.uleb128 .LVU1820
+.LLST263:
+	.byte	0x4
+	.uleb128 .LVL599-.Ltext0
+	.uleb128 .LVL600-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL603-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL603-.Ltext0
+	.uleb128 .LVL604-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL615-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL615-.Ltext0
+	.uleb128 .LVL616-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS264:
+	.uleb128 .LVU1771
+	.uleb128 .LVU1794
+	.uleb128 .LVU1817
+	.uleb128 .LVU1820
+.LLST264:
+	.byte	0x4
+	.uleb128 .LVL599-.Ltext0
+	.uleb128 .LVL608-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS266:
+	.uleb128 .LVU1791
+	.uleb128 .LVU1793
+	.uleb128 .LVU1793
+	.uleb128 .LVU1817
+	.uleb128 .LVU1820
+	.uleb128 .LVU1941
+	.uleb128 .LVU1944
+	.uleb128 0
+.LLST266:
+	.byte	0x4
+	.uleb128 .LVL606-.Ltext0
+	.uleb128 .LVL607-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL607-1-.Ltext0
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 .LVL665-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL668-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS267:
+	.uleb128 .LVU1794
+	.uleb128 .LVU1797
+	.uleb128 .LVU1797
+	.uleb128 .LVU1817
+	.uleb128 .LVU1820
+	.uleb128 .LVU1839
+	.uleb128 .LVU1839
+	.uleb128 .LVU1842
+	.uleb128 .LVU1842
+	.uleb128 .LVU1940
+	.uleb128 .LVU1944
+	.uleb128 0
+.LLST267:
+	.byte	0x4
+	.uleb128 .LVL608-.Ltext0
+	.uleb128 .LVL609-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL609-1-.Ltext0
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 .LVL627-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL627-1-.Ltext0
+	.uleb128 .LVL664-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL668-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS269:
+	.uleb128 .LVU1798
+	.uleb128 .LVU1805
+	.uleb128 .LVU1805
+	.uleb128 .LVU1814
+	.uleb128 .LVU1820
+	.uleb128 .LVU1822
+	.uleb128 .LVU1822
+	.uleb128 .LVU1824
+	.uleb128 .LVU1828
+	.uleb128 .LVU1834
+.LLST269:
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 .LVL623-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS271:
+	.uleb128 .LVU1800
+	.uleb128 .LVU1805
+	.uleb128 .LVU1805
+	.uleb128 .LVU1814
+	.uleb128 .LVU1820
+	.uleb128 .LVU1822
+	.uleb128 .LVU1822
+	.uleb128 .LVU1824
+	.uleb128 .LVU1828
+	.uleb128 .LVU1834
+.LLST271:
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 .LVL623-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS272:
+	.uleb128 .LVU1801
+	.uleb128 .LVU1815
+	.uleb128 .LVU1820
+	.uleb128 .LVU1826
+	.uleb128 .LVU1828
+	.uleb128 .LVU1834
+.LLST272:
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL613-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 .LVL621-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 .LVL623-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+.LVUS273:
+	.uleb128 .LVU1805
+	.uleb128 .LVU1815
+	.uleb128 .LVU1823
+	.uleb128 .LVU1825
+	.uleb128 .LVU1828
+	.uleb128 .LVU1834
+.LLST273:
+	.byte	0x4
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 .LVL613-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL620-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 .LVL623-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS274:
+	.uleb128 .LVU1843
+	.uleb128 .LVU1850
+	.uleb128 .LVU1850
+	.uleb128 .LVU1859
+	.uleb128 .LVU1862
+	.uleb128 .LVU1863
+	.uleb128 .LVU1863
+	.uleb128 .LVU1865
+	.uleb128 .LVU1869
+	.uleb128 .LVU1875
+.LLST274:
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 .LVL639-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS275:
+	.uleb128 .LVU1845
+	.uleb128 .LVU1850
+	.uleb128 .LVU1850
+	.uleb128 .LVU1859
+	.uleb128 .LVU1862
+	.uleb128 .LVU1863
+	.uleb128 .LVU1863
+	.uleb128 .LVU1865
+	.uleb128 .LVU1869
+	.uleb128 .LVU1875
+.LLST275:
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 .LVL639-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS276:
+	.uleb128 .LVU1846
+	.uleb128 .LVU1860
+	.uleb128 .LVU1862
+	.uleb128 .LVU1867
+	.uleb128 .LVU1869
+	.uleb128 .LVU1875
+.LLST276:
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL631-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 .LVL637-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 .LVL639-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+.LVUS277:
+	.uleb128 .LVU1850
+	.uleb128 .LVU1860
+	.uleb128 .LVU1864
+	.uleb128 .LVU1866
+	.uleb128 .LVU1869
+	.uleb128 .LVU1875
+.LLST277:
+	.byte	0x4
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 .LVL631-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL634-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 .LVL639-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS278:
+	.uleb128 .LVU1880
+	.uleb128 .LVU1887
+	.uleb128 .LVU1887
+	.uleb128 .LVU1896
+	.uleb128 .LVU1899
+	.uleb128 .LVU1900
+	.uleb128 .LVU1900
+	.uleb128 .LVU1902
+	.uleb128 .LVU1906
+	.uleb128 .LVU1912
+.LLST278:
+	.byte	0x4
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 .LVL643-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 .LVL648-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS279:
+	.uleb128 .LVU1882
+	.uleb128 .LVU1887
+	.uleb128 .LVU1887
+	.uleb128 .LVU1896
+	.uleb128 .LVU1899
+	.uleb128 .LVU1900
+	.uleb128 .LVU1900
+	.uleb128 .LVU1902
+	.uleb128 .LVU1906
+	.uleb128 .LVU1912
+.LLST279:
+	.byte	0x4
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 .LVL643-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 .LVL648-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS280:
+	.uleb128 .LVU1883
+	.uleb128 .LVU1897
+	.uleb128 .LVU1899
+	.uleb128 .LVU1904
+	.uleb128 .LVU1906
+	.uleb128 .LVU1912
+.LLST280:
+	.byte	0x4
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 .LVL644-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 .LVL650-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS281:
+	.uleb128 .LVU1887
+	.uleb128 .LVU1897
+	.uleb128 .LVU1901
+	.uleb128 .LVU1903
+	.uleb128 .LVU1906
+	.uleb128 .LVU1912
+.LLST281:
+	.byte	0x4
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 .LVL644-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 .LVL649-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS284:
+	.uleb128 .LVU1921
+	.uleb128 .LVU1925
+	.uleb128 .LVU1925
+	.uleb128 .LVU1942
+	.uleb128 .LVU1944
+	.uleb128 0
+.LLST284:
+	.byte	0x4
+	.uleb128 .LVL655-.Ltext0
+	.uleb128 .LVL656-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL656-1-.Ltext0
+	.uleb128 .LVL666-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL668-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS118:
+	.uleb128 0
+	.uleb128 .LVU726
+	.uleb128 .LVU726
+	.uleb128 0
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS119:
+	.uleb128 0
+	.uleb128 .LVU727
+	.uleb128 .LVU727
+	.uleb128 0
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU729
+	.uleb128 .LVU736
+	.uleb128 .LVU775
+	.uleb128 .LVU776
+	.uleb128 .LVU776
+	.uleb128 .LVU777
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU737
+	.uleb128 .LVU744
+	.uleb128 .LVU777
+	.uleb128 .LVU779
+	.uleb128 .LVU779
+	.uleb128 .LVU780
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL255-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU738
+	.uleb128 .LVU775
+	.uleb128 .LVU777
+	.uleb128 0
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU745
+	.uleb128 .LVU752
+	.uleb128 .LVU780
+	.uleb128 .LVU782
+	.uleb128 .LVU782
+	.uleb128 .LVU783
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL269-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU746
+	.uleb128 .LVU775
+	.uleb128 .LVU780
+	.uleb128 0
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU753
+	.uleb128 .LVU760
+	.uleb128 .LVU783
+	.uleb128 .LVU785
+	.uleb128 .LVU785
+	.uleb128 .LVU786
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU754
+	.uleb128 .LVU775
+	.uleb128 .LVU783
+	.uleb128 0
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU760
+	.uleb128 .LVU773
+	.uleb128 .LVU773
+	.uleb128 .LVU774
+	.uleb128 .LVU774
+	.uleb128 .LVU775
+	.uleb128 .LVU786
+	.uleb128 .LVU788
+	.uleb128 .LVU788
+	.uleb128 .LVU791
+	.uleb128 .LVU791
+	.uleb128 .LVU792
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -24
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL275-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU761
+	.uleb128 .LVU775
+	.uleb128 .LVU786
+	.uleb128 0
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU767
+	.uleb128 .LVU775
+	.uleb128 .LVU788
+	.uleb128 .LVU790
+	.uleb128 .LVU790
+	.uleb128 .LVU792
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU768
+	.uleb128 .LVU773
+	.uleb128 .LVU773
+	.uleb128 .LVU774
+	.uleb128 .LVU774
+	.uleb128 .LVU775
+	.uleb128 .LVU788
+	.uleb128 .LVU791
+	.uleb128 .LVU791
+	.uleb128 .LVU792
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -24
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL275-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+.LVUS285:
+	.uleb128 0
+	.uleb128 .LVU1951
+	.uleb128 .LVU1951
+	.uleb128 .LVU1960
+	.uleb128 .LVU1960
+	.uleb128 0
+.LLST285:
+	.byte	0x4
+	.uleb128 .LVL671-.Ltext0
+	.uleb128 .LVL672-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL672-.Ltext0
+	.uleb128 .LVL677-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL677-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS286:
+	.uleb128 .LVU1952
+	.uleb128 .LVU1955
+	.uleb128 .LVU1955
+	.uleb128 .LVU1959
+	.uleb128 .LVU1959
+	.uleb128 .LVU1960
+	.uleb128 .LVU1960
+	.uleb128 0
+.LLST286:
+	.byte	0x4
+	.uleb128 .LVL674-.Ltext0
+	.uleb128 .LVL675-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL675-1-.Ltext0
+	.uleb128 .LVL676-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL676-.Ltext0
+	.uleb128 .LVL677-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL677-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS287:
+	.uleb128 0
+	.uleb128 .LVU1966
+	.uleb128 .LVU1966
+	.uleb128 0
+.LLST287:
+	.byte	0x4
+	.uleb128 .LVL678-.Ltext0
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS288:
+	.uleb128 0
+	.uleb128 .LVU1966
+	.uleb128 .LVU1966
+	.uleb128 0
+.LLST288:
+	.byte	0x4
+	.uleb128 .LVL678-.Ltext0
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS289:
+	.uleb128 .LVU1965
+	.uleb128 .LVU1966
+	.uleb128 .LVU1966
+	.uleb128 .LVU1995
+	.uleb128 .LVU1995
+	.uleb128 .LVU1996
+	.uleb128 .LVU1996
+	.uleb128 .LVU2008
+.LLST289:
+	.byte	0x4
+	.uleb128 .LVL679-.Ltext0
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LVL688-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL688-.Ltext0
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 .LVL697-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS291:
+	.uleb128 .LVU1973
+	.uleb128 .LVU1980
+	.uleb128 .LVU1980
+	.uleb128 .LVU1996
+	.uleb128 .LVU1996
+	.uleb128 .LVU1997
+	.uleb128 .LVU1997
+	.uleb128 .LVU2005
+.LLST291:
+	.byte	0x4
+	.uleb128 .LVL682-.Ltext0
+	.uleb128 .LVL683-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL683-1-.Ltext0
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 .LVL690-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL690-.Ltext0
+	.uleb128 .LVL696-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS294:
+	.uleb128 .LVU1974
+	.uleb128 .LVU2005
+.LLST294:
+	.byte	0x4
+	.uleb128 .LVL682-.Ltext0
+	.uleb128 .LVL696-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS296:
+	.uleb128 .LVU1980
+	.uleb128 .LVU1987
+	.uleb128 .LVU1998
+	.uleb128 .LVU2000
+	.uleb128 .LVU2000
+	.uleb128 .LVU2001
+.LLST296:
+	.byte	0x4
+	.uleb128 .LVL683-.Ltext0
+	.uleb128 .LVL684-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 .LVL692-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL692-.Ltext0
+	.uleb128 .LVL693-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS297:
+	.uleb128 .LVU1981
+	.uleb128 .LVU1996
+	.uleb128 .LVU1998
+	.uleb128 .LVU2005
+.LLST297:
+	.byte	0x4
+	.uleb128 .LVL683-.Ltext0
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 .LVL696-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS299:
+	.uleb128 .LVU1987
+	.uleb128 .LVU1993
+	.uleb128 .LVU2001
+	.uleb128 .LVU2004
+	.uleb128 .LVU2004
+	.uleb128 .LVU2005
+.LLST299:
+	.byte	0x4
+	.uleb128 .LVL684-.Ltext0
+	.uleb128 .LVL686-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL693-.Ltext0
+	.uleb128 .LVL695-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL695-.Ltext0
+	.uleb128 .LVL696-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+.LVUS300:
+	.uleb128 .LVU1989
+	.uleb128 .LVU1993
+	.uleb128 .LVU2001
+	.uleb128 .LVU2003
+	.uleb128 .LVU2003
+	.uleb128 .LVU2005
+.LLST300:
+	.byte	0x4
+	.uleb128 .LVL685-.Ltext0
+	.uleb128 .LVL686-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL693-.Ltext0
+	.uleb128 .LVL694-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL694-.Ltext0
+	.uleb128 .LVL696-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+.LVUS324:
+	.uleb128 0
+	.uleb128 .LVU2095
+	.uleb128 .LVU2095
+	.uleb128 0
+.LLST324:
+	.byte	0x4
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 .LVL736-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL736-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS325:
+	.uleb128 0
+	.uleb128 .LVU2096
+	.uleb128 .LVU2096
+	.uleb128 0
+.LLST325:
+	.byte	0x4
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 .LVL737-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL737-1-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS301:
+	.uleb128 0
+	.uleb128 .LVU2015
+	.uleb128 .LVU2015
+	.uleb128 .LVU2090
+	.uleb128 .LVU2090
+	.uleb128 0
+.LLST301:
+	.byte	0x4
+	.uleb128 .LVL698-.Ltext0
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL733-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL733-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS302:
+	.uleb128 .LVU2013
+	.uleb128 .LVU2015
+	.uleb128 .LVU2015
+	.uleb128 .LVU2091
+	.uleb128 .LVU2091
+	.uleb128 0
+.LLST302:
+	.byte	0x4
+	.uleb128 .LVL699-.Ltext0
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL734-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL734-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -80
+	.byte	0
+.LVUS303:
+	.uleb128 .LVU2015
+	.uleb128 .LVU2087
+.LLST303:
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL732-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS305:
+	.uleb128 .LVU2015
+	.uleb128 .LVU2033
+	.uleb128 .LVU2036
+	.uleb128 .LVU2046
+	.uleb128 .LVU2046
+	.uleb128 .LVU2085
+.LLST305:
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 0x10
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	allocation_sizes
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 .LVL718-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL718-1-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x10
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	allocation_sizes
+	.byte	0x22
+	.byte	0
+.LVUS306:
+	.uleb128 .LVU2015
+	.uleb128 .LVU2024
+	.uleb128 .LVU2024
+	.uleb128 .LVU2028
+	.uleb128 .LVU2028
+	.uleb128 .LVU2031
+	.uleb128 .LVU2031
+	.uleb128 .LVU2033
+	.uleb128 .LVU2038
+	.uleb128 .LVU2072
+	.uleb128 .LVU2072
+	.uleb128 .LVU2085
+.LLST306:
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 0xe
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	allocation_sizes
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 0xe
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	allocation_sizes
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL717-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0xe
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	allocation_sizes
+	.byte	0x22
+	.byte	0
+.LVUS307:
+	.uleb128 .LVU2015
+	.uleb128 .LVU2016
+	.uleb128 .LVU2016
+	.uleb128 .LVU2033
+	.uleb128 .LVU2047
+	.uleb128 .LVU2052
+	.uleb128 .LVU2052
+	.uleb128 .LVU2085
+.LLST307:
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL701-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL701-.Ltext0
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL719-.Ltext0
+	.uleb128 .LVL720-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL720-1-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS308:
+	.uleb128 .LVU2017
+	.uleb128 .LVU2019
+	.uleb128 .LVU2019
+	.uleb128 .LVU2020
+	.uleb128 .LVU2020
+	.uleb128 .LVU2023
+	.uleb128 .LVU2023
+	.uleb128 .LVU2028
+	.uleb128 .LVU2028
+	.uleb128 .LVU2030
+	.uleb128 .LVU2030
+	.uleb128 .LVU2033
+	.uleb128 .LVU2055
+	.uleb128 .LVU2071
+	.uleb128 .LVU2071
+	.uleb128 .LVU2085
+.LLST308:
+	.byte	0x4
+	.uleb128 .LVL702-.Ltext0
+	.uleb128 .LVL703-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL703-.Ltext0
+	.uleb128 .LVL704-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL704-.Ltext0
+	.uleb128 .LVL706-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL706-.Ltext0
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 .LVL711-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL711-1-.Ltext0
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL722-.Ltext0
+	.uleb128 .LVL724-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL724-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS311:
+	.uleb128 .LVU2015
+	.uleb128 .LVU2033
+	.uleb128 .LVU2048
+	.uleb128 .LVU2085
+.LLST311:
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL719-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS314:
+	.uleb128 .LVU2017
+	.uleb128 .LVU2033
+	.uleb128 .LVU2056
+	.uleb128 .LVU2085
+.LLST314:
+	.byte	0x4
+	.uleb128 .LVL702-.Ltext0
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL722-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS316:
+	.uleb128 .LVU2020
+	.uleb128 .LVU2022
+	.uleb128 .LVU2022
+	.uleb128 .LVU2024
+	.uleb128 .LVU2028
+	.uleb128 .LVU2030
+	.uleb128 .LVU2062
+	.uleb128 .LVU2074
+.LLST316:
+	.byte	0x4
+	.uleb128 .LVL704-.Ltext0
+	.uleb128 .LVL705-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL705-.Ltext0
+	.uleb128 .LVL707-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 .LVL711-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS317:
+	.uleb128 .LVU2020
+	.uleb128 .LVU2024
+	.uleb128 .LVU2024
+	.uleb128 .LVU2028
+	.uleb128 .LVU2028
+	.uleb128 .LVU2031
+	.uleb128 .LVU2031
+	.uleb128 .LVU2033
+	.uleb128 .LVU2063
+	.uleb128 .LVU2072
+	.uleb128 .LVU2072
+	.uleb128 .LVU2085
+.LLST317:
+	.byte	0x4
+	.uleb128 .LVL704-.Ltext0
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 0xe
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	allocation_sizes
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 0xe
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	allocation_sizes
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0xe
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	allocation_sizes
+	.byte	0x22
+	.byte	0
+.LVUS319:
+	.uleb128 .LVU2024
+	.uleb128 .LVU2026
+	.uleb128 .LVU2073
+	.uleb128 .LVU2074
+	.uleb128 .LVU2074
+	.uleb128 .LVU2083
+	.uleb128 .LVU2084
+	.uleb128 .LVU2085
+.LLST319:
+	.byte	0x4
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 .LVL708-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 .LVL728-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL729-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS320:
+	.uleb128 .LVU2024
+	.uleb128 .LVU2028
+	.uleb128 .LVU2072
+	.uleb128 .LVU2085
+.LLST320:
+	.byte	0x4
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS322:
+	.uleb128 .LVU2024
+	.uleb128 .LVU2027
+	.uleb128 .LVU2027
+	.uleb128 .LVU2028
+	.uleb128 .LVU2078
+	.uleb128 .LVU2083
+.LLST322:
+	.byte	0x4
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 .LVL709-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL709-.Ltext0
+	.uleb128 .LVL710-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL727-.Ltext0
+	.uleb128 .LVL728-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS323:
+	.uleb128 .LVU2024
+	.uleb128 .LVU2028
+	.uleb128 .LVU2079
+	.uleb128 .LVU2085
+.LLST323:
+	.byte	0x4
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xcd
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL727-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xcd
+	.byte	0x9f
+	.byte	0
+.LVUS326:
+	.uleb128 0
+	.uleb128 .LVU2106
+	.uleb128 .LVU2106
+	.uleb128 0
+.LLST326:
+	.byte	0x4
+	.uleb128 .LVL739-.Ltext0
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS327:
+	.uleb128 0
+	.uleb128 .LVU2106
+	.uleb128 .LVU2106
+	.uleb128 0
+.LLST327:
+	.byte	0x4
+	.uleb128 .LVL739-.Ltext0
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS328:
+	.uleb128 .LVU2105
+	.uleb128 .LVU2106
+	.uleb128 .LVU2106
+	.uleb128 .LVU2120
+	.uleb128 .LVU2120
+	.uleb128 .LVU2121
+	.uleb128 .LVU2121
+	.uleb128 .LVU2124
+	.uleb128 .LVU2125
+	.uleb128 .LVU2143
+	.uleb128 .LVU2143
+	.uleb128 .LVU2144
+	.uleb128 .LVU2144
+	.uleb128 .LVU2147
+	.uleb128 .LVU2148
+	.uleb128 .LVU2175
+.LLST328:
+	.byte	0x4
+	.uleb128 .LVL740-.Ltext0
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 .LVL745-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL745-.Ltext0
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL749-.Ltext0
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 .LVL777-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS329:
+	.uleb128 .LVU2148
+	.uleb128 .LVU2151
+	.uleb128 .LVU2153
+	.uleb128 .LVU2155
+	.uleb128 .LVU2159
+	.uleb128 .LVU2171
+	.uleb128 .LVU2172
+	.uleb128 .LVU2173
+.LLST329:
+	.byte	0x4
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 .LVL767-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL771-.Ltext0
+	.uleb128 .LVL774-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL775-.Ltext0
+	.uleb128 .LVL776-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS331:
+	.uleb128 .LVU2111
+	.uleb128 .LVU2119
+	.uleb128 .LVU2121
+	.uleb128 .LVU2122
+.LLST331:
+	.byte	0x4
+	.uleb128 .LVL743-.Ltext0
+	.uleb128 .LVL744-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 .LVL747-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS332:
+	.uleb128 .LVU2112
+	.uleb128 .LVU2122
+.LLST332:
+	.byte	0x4
+	.uleb128 .LVL743-.Ltext0
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS334:
+	.uleb128 .LVU2134
+	.uleb128 .LVU2142
+	.uleb128 .LVU2144
+	.uleb128 .LVU2145
+.LLST334:
+	.byte	0x4
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 .LVL756-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL759-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS335:
+	.uleb128 .LVU2135
+	.uleb128 .LVU2145
+.LLST335:
+	.byte	0x4
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 .LVL759-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS337:
+	.uleb128 .LVU2148
+	.uleb128 .LVU2149
+	.uleb128 .LVU2149
+	.uleb128 .LVU2153
+	.uleb128 .LVU2164
+	.uleb128 .LVU2171
+.LLST337:
+	.byte	0x4
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 .LVL766-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL772-.Ltext0
+	.uleb128 .LVL774-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS338:
+	.uleb128 .LVU2148
+	.uleb128 .LVU2150
+	.uleb128 .LVU2150
+	.uleb128 .LVU2152
+	.uleb128 .LVU2152
+	.uleb128 .LVU2153
+	.uleb128 .LVU2167
+	.uleb128 .LVU2171
+	.uleb128 .LVU2171
+	.uleb128 .LVU2173
+.LLST338:
+	.byte	0x4
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 0x12
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x8
+	.byte	0x38
+	.byte	0x25
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x8
+	.byte	0x38
+	.byte	0x25
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL773-.Ltext0
+	.uleb128 .LVL774-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL774-1-.Ltext0
+	.uleb128 .LVL776-.Ltext0
+	.uleb128 0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x8
+	.byte	0x38
+	.byte	0x25
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x8
+	.byte	0x38
+	.byte	0x25
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x9f
+	.byte	0
+.LVUS350:
+	.uleb128 0
+	.uleb128 .LVU2218
+	.uleb128 .LVU2218
+	.uleb128 0
+.LLST350:
+	.byte	0x4
+	.uleb128 .LVL797-.Ltext0
+	.uleb128 .LVL798-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL798-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS351:
+	.uleb128 0
+	.uleb128 .LVU2219
+	.uleb128 .LVU2219
+	.uleb128 0
+.LLST351:
+	.byte	0x4
+	.uleb128 .LVL797-.Ltext0
+	.uleb128 .LVL799-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL799-1-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS339:
+	.uleb128 0
+	.uleb128 .LVU2181
+	.uleb128 .LVU2181
+	.uleb128 .LVU2214
+	.uleb128 .LVU2214
+	.uleb128 0
+.LLST339:
+	.byte	0x4
+	.uleb128 .LVL778-.Ltext0
+	.uleb128 .LVL780-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL780-.Ltext0
+	.uleb128 .LVL796-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL796-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS340:
+	.uleb128 .LVU2180
+	.uleb128 .LVU2181
+	.uleb128 .LVU2181
+	.uleb128 .LVU2204
+	.uleb128 .LVU2204
+	.uleb128 .LVU2205
+	.uleb128 .LVU2205
+	.uleb128 .LVU2213
+.LLST340:
+	.byte	0x4
+	.uleb128 .LVL779-.Ltext0
+	.uleb128 .LVL780-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL780-.Ltext0
+	.uleb128 .LVL788-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL788-.Ltext0
+	.uleb128 .LVL789-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL789-.Ltext0
+	.uleb128 .LVL795-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS342:
+	.uleb128 .LVU2184
+	.uleb128 .LVU2211
+.LLST342:
+	.byte	0x4
+	.uleb128 .LVL781-.Ltext0
+	.uleb128 .LVL794-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS343:
+	.uleb128 .LVU2190
+	.uleb128 .LVU2202
+	.uleb128 .LVU2202
+	.uleb128 .LVU2205
+	.uleb128 .LVU2205
+	.uleb128 .LVU2206
+	.uleb128 .LVU2206
+	.uleb128 .LVU2207
+	.uleb128 .LVU2207
+	.uleb128 .LVU2210
+	.uleb128 .LVU2210
+	.uleb128 .LVU2211
+.LLST343:
+	.byte	0x4
+	.uleb128 .LVL783-.Ltext0
+	.uleb128 .LVL785-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL785-1-.Ltext0
+	.uleb128 .LVL789-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL789-.Ltext0
+	.uleb128 .LVL790-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL790-.Ltext0
+	.uleb128 .LVL791-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL791-.Ltext0
+	.uleb128 .LVL793-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL793-.Ltext0
+	.uleb128 .LVL794-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS346:
+	.uleb128 .LVU2191
+	.uleb128 .LVU2211
+.LLST346:
+	.byte	0x4
+	.uleb128 .LVL783-.Ltext0
+	.uleb128 .LVL794-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS348:
+	.uleb128 .LVU2197
+	.uleb128 .LVU2202
+	.uleb128 .LVU2207
+	.uleb128 .LVU2209
+	.uleb128 .LVU2209
+	.uleb128 .LVU2211
+.LLST348:
+	.byte	0x4
+	.uleb128 .LVL784-.Ltext0
+	.uleb128 .LVL785-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL791-.Ltext0
+	.uleb128 .LVL792-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL792-.Ltext0
+	.uleb128 .LVL794-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+.LVUS349:
+	.uleb128 .LVU2198
+	.uleb128 .LVU2205
+	.uleb128 .LVU2207
+	.uleb128 .LVU2211
+.LLST349:
+	.byte	0x4
+	.uleb128 .LVL784-.Ltext0
+	.uleb128 .LVL789-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL791-.Ltext0
+	.uleb128 .LVL794-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0
+.LLRL24:
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0
+.LLRL30:
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0
+.LLRL48:
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0
+.LLRL51:
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0
+.LLRL54:
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0
+.LLRL57:
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0
+.LLRL58:
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0
+.LLRL61:
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0
+.LLRL62:
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0
+.LLRL64:
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0
+.LLRL65:
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0
+.LLRL67:
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0
+.LLRL68:
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0
+.LLRL73:
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0
+.LLRL76:
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB92-.Ltext0
+	.uleb128 .LBE92-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB93-.Ltext0
+	.uleb128 .LBE93-.Ltext0
+	.byte	0
+.LLRL82:
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0
+.LLRL86:
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0
+.LLRL87:
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0
+.LLRL91:
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0
+.LLRL96:
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB103-.Ltext0
+	.uleb128 .LBE103-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0
+.LLRL102:
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0
+.LLRL105:
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0
+.LLRL108:
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0
+.LLRL113:
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0
+.LLRL115:
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0
+.LLRL120:
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0
+.LLRL122:
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB119-.Ltext0
+	.uleb128 .LBE119-.Ltext0
+	.byte	0
+.LLRL125:
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0
+.LLRL128:
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0
+.LLRL131:
+	.byte	0x4
+	.uleb128 .LBB116-.Ltext0
+	.uleb128 .LBE116-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0
+.LLRL134:
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0
+.LLRL143:
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB129-.Ltext0
+	.uleb128 .LBE129-.Ltext0
+	.byte	0
+.LLRL146:
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0
+.LLRL147:
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB128-.Ltext0
+	.uleb128 .LBE128-.Ltext0
+	.byte	0
+.LLRL148:
+	.byte	0x4
+	.uleb128 .LBB130-.Ltext0
+	.uleb128 .LBE130-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB140-.Ltext0
+	.uleb128 .LBE140-.Ltext0
+	.byte	0
+.LLRL151:
+	.byte	0x4
+	.uleb128 .LBB134-.Ltext0
+	.uleb128 .LBE134-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB148-.Ltext0
+	.uleb128 .LBE148-.Ltext0
+	.byte	0
+.LLRL155:
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0
+.LLRL156:
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB149-.Ltext0
+	.uleb128 .LBE149-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB157-.Ltext0
+	.uleb128 .LBE157-.Ltext0
+	.byte	0
+.LLRL160:
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0
+.LLRL161:
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0
+.LLRL163:
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0
+.LLRL165:
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB155-.Ltext0
+	.uleb128 .LBE155-.Ltext0
+	.byte	0
+.LLRL171:
+	.byte	0x4
+	.uleb128 .LBB160-.Ltext0
+	.uleb128 .LBE160-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB163-.Ltext0
+	.uleb128 .LBE163-.Ltext0
+	.byte	0
+.LLRL173:
+	.byte	0x4
+	.uleb128 .LBB162-.Ltext0
+	.uleb128 .LBE162-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB164-.Ltext0
+	.uleb128 .LBE164-.Ltext0
+	.byte	0
+.LLRL174:
+	.byte	0x4
+	.uleb128 .LBB166-.Ltext0
+	.uleb128 .LBE166-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0
+.LLRL176:
+	.byte	0x4
+	.uleb128 .LBB168-.Ltext0
+	.uleb128 .LBE168-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0
+.LLRL177:
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB176-.Ltext0
+	.uleb128 .LBE176-.Ltext0
+	.byte	0
+.LLRL179:
+	.byte	0x4
+	.uleb128 .LBB173-.Ltext0
+	.uleb128 .LBE173-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB177-.Ltext0
+	.uleb128 .LBE177-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB197-.Ltext0
+	.uleb128 .LBE197-.Ltext0
+	.byte	0
+.LLRL182:
+	.byte	0x4
+	.uleb128 .LBB174-.Ltext0
+	.uleb128 .LBE174-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB175-.Ltext0
+	.uleb128 .LBE175-.Ltext0
+	.byte	0
+.LLRL183:
+	.byte	0x4
+	.uleb128 .LBB178-.Ltext0
+	.uleb128 .LBE178-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB198-.Ltext0
+	.uleb128 .LBE198-.Ltext0
+	.byte	0
+.LLRL185:
+	.byte	0x4
+	.uleb128 .LBB179-.Ltext0
+	.uleb128 .LBE179-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0
+.LLRL186:
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB184-.Ltext0
+	.uleb128 .LBE184-.Ltext0
+	.byte	0
+.LLRL188:
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB185-.Ltext0
+	.uleb128 .LBE185-.Ltext0
+	.byte	0
+.LLRL191:
+	.byte	0x4
+	.uleb128 .LBB188-.Ltext0
+	.uleb128 .LBE188-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB195-.Ltext0
+	.uleb128 .LBE195-.Ltext0
+	.byte	0
+.LLRL193:
+	.byte	0x4
+	.uleb128 .LBB190-.Ltext0
+	.uleb128 .LBE190-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB196-.Ltext0
+	.uleb128 .LBE196-.Ltext0
+	.byte	0
+.LLRL195:
+	.byte	0x4
+	.uleb128 .LBB191-.Ltext0
+	.uleb128 .LBE191-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB193-.Ltext0
+	.uleb128 .LBE193-.Ltext0
+	.byte	0
+.LLRL197:
+	.byte	0x4
+	.uleb128 .LBB192-.Ltext0
+	.uleb128 .LBE192-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB194-.Ltext0
+	.uleb128 .LBE194-.Ltext0
+	.byte	0
+.LLRL200:
+	.byte	0x4
+	.uleb128 .LBB199-.Ltext0
+	.uleb128 .LBE199-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB202-.Ltext0
+	.uleb128 .LBE202-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB203-.Ltext0
+	.uleb128 .LBE203-.Ltext0
+	.byte	0
+.LLRL203:
+	.byte	0x4
+	.uleb128 .LBB200-.Ltext0
+	.uleb128 .LBE200-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB201-.Ltext0
+	.uleb128 .LBE201-.Ltext0
+	.byte	0
+.LLRL209:
+	.byte	0x4
+	.uleb128 .LBB204-.Ltext0
+	.uleb128 .LBE204-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB231-.Ltext0
+	.uleb128 .LBE231-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB245-.Ltext0
+	.uleb128 .LBE245-.Ltext0
+	.byte	0
+.LLRL211:
+	.byte	0x4
+	.uleb128 .LBB205-.Ltext0
+	.uleb128 .LBE205-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB220-.Ltext0
+	.uleb128 .LBE220-.Ltext0
+	.byte	0
+.LLRL213:
+	.byte	0x4
+	.uleb128 .LBB207-.Ltext0
+	.uleb128 .LBE207-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB221-.Ltext0
+	.uleb128 .LBE221-.Ltext0
+	.byte	0
+.LLRL215:
+	.byte	0x4
+	.uleb128 .LBB208-.Ltext0
+	.uleb128 .LBE208-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB209-.Ltext0
+	.uleb128 .LBE209-.Ltext0
+	.byte	0
+.LLRL217:
+	.byte	0x4
+	.uleb128 .LBB210-.Ltext0
+	.uleb128 .LBE210-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB213-.Ltext0
+	.uleb128 .LBE213-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB222-.Ltext0
+	.uleb128 .LBE222-.Ltext0
+	.byte	0
+.LLRL221:
+	.byte	0x4
+	.uleb128 .LBB211-.Ltext0
+	.uleb128 .LBE211-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB212-.Ltext0
+	.uleb128 .LBE212-.Ltext0
+	.byte	0
+.LLRL222:
+	.byte	0x4
+	.uleb128 .LBB214-.Ltext0
+	.uleb128 .LBE214-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB223-.Ltext0
+	.uleb128 .LBE223-.Ltext0
+	.byte	0
+.LLRL224:
+	.byte	0x4
+	.uleb128 .LBB215-.Ltext0
+	.uleb128 .LBE215-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB216-.Ltext0
+	.uleb128 .LBE216-.Ltext0
+	.byte	0
+.LLRL226:
+	.byte	0x4
+	.uleb128 .LBB217-.Ltext0
+	.uleb128 .LBE217-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB224-.Ltext0
+	.uleb128 .LBE224-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB228-.Ltext0
+	.uleb128 .LBE228-.Ltext0
+	.byte	0
+.LLRL229:
+	.byte	0x4
+	.uleb128 .LBB218-.Ltext0
+	.uleb128 .LBE218-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB219-.Ltext0
+	.uleb128 .LBE219-.Ltext0
+	.byte	0
+.LLRL230:
+	.byte	0x4
+	.uleb128 .LBB225-.Ltext0
+	.uleb128 .LBE225-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB229-.Ltext0
+	.uleb128 .LBE229-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB230-.Ltext0
+	.uleb128 .LBE230-.Ltext0
+	.byte	0
+.LLRL233:
+	.byte	0x4
+	.uleb128 .LBB226-.Ltext0
+	.uleb128 .LBE226-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB227-.Ltext0
+	.uleb128 .LBE227-.Ltext0
+	.byte	0
+.LLRL234:
+	.byte	0x4
+	.uleb128 .LBB232-.Ltext0
+	.uleb128 .LBE232-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB246-.Ltext0
+	.uleb128 .LBE246-.Ltext0
+	.byte	0
+.LLRL236:
+	.byte	0x4
+	.uleb128 .LBB233-.Ltext0
+	.uleb128 .LBE233-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB242-.Ltext0
+	.uleb128 .LBE242-.Ltext0
+	.byte	0
+.LLRL238:
+	.byte	0x4
+	.uleb128 .LBB234-.Ltext0
+	.uleb128 .LBE234-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB235-.Ltext0
+	.uleb128 .LBE235-.Ltext0
+	.byte	0
+.LLRL240:
+	.byte	0x4
+	.uleb128 .LBB236-.Ltext0
+	.uleb128 .LBE236-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB243-.Ltext0
+	.uleb128 .LBE243-.Ltext0
+	.byte	0
+.LLRL242:
+	.byte	0x4
+	.uleb128 .LBB237-.Ltext0
+	.uleb128 .LBE237-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB238-.Ltext0
+	.uleb128 .LBE238-.Ltext0
+	.byte	0
+.LLRL244:
+	.byte	0x4
+	.uleb128 .LBB239-.Ltext0
+	.uleb128 .LBE239-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB244-.Ltext0
+	.uleb128 .LBE244-.Ltext0
+	.byte	0
+.LLRL247:
+	.byte	0x4
+	.uleb128 .LBB247-.Ltext0
+	.uleb128 .LBE247-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB281-.Ltext0
+	.uleb128 .LBE281-.Ltext0
+	.byte	0
+.LLRL253:
+	.byte	0x4
+	.uleb128 .LBB251-.Ltext0
+	.uleb128 .LBE251-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB258-.Ltext0
+	.uleb128 .LBE258-.Ltext0
+	.byte	0
+.LLRL255:
+	.byte	0x4
+	.uleb128 .LBB253-.Ltext0
+	.uleb128 .LBE253-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB259-.Ltext0
+	.uleb128 .LBE259-.Ltext0
+	.byte	0
+.LLRL257:
+	.byte	0x4
+	.uleb128 .LBB254-.Ltext0
+	.uleb128 .LBE254-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB256-.Ltext0
+	.uleb128 .LBE256-.Ltext0
+	.byte	0
+.LLRL259:
+	.byte	0x4
+	.uleb128 .LBB255-.Ltext0
+	.uleb128 .LBE255-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB257-.Ltext0
+	.uleb128 .LBE257-.Ltext0
+	.byte	0
+.LLRL262:
+	.byte	0x4
+	.uleb128 .LBB261-.Ltext0
+	.uleb128 .LBE261-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB263-.Ltext0
+	.uleb128 .LBE263-.Ltext0
+	.byte	0
+.LLRL265:
+	.byte	0x4
+	.uleb128 .LBB264-.Ltext0
+	.uleb128 .LBE264-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB282-.Ltext0
+	.uleb128 .LBE282-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB283-.Ltext0
+	.uleb128 .LBE283-.Ltext0
+	.byte	0
+.LLRL268:
+	.byte	0x4
+	.uleb128 .LBB265-.Ltext0
+	.uleb128 .LBE265-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB270-.Ltext0
+	.uleb128 .LBE270-.Ltext0
+	.byte	0
+.LLRL270:
+	.byte	0x4
+	.uleb128 .LBB266-.Ltext0
+	.uleb128 .LBE266-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB269-.Ltext0
+	.uleb128 .LBE269-.Ltext0
+	.byte	0
+.LLRL282:
+	.byte	0x4
+	.uleb128 .LBB277-.Ltext0
+	.uleb128 .LBE277-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB280-.Ltext0
+	.uleb128 .LBE280-.Ltext0
+	.byte	0
+.LLRL283:
+	.byte	0x4
+	.uleb128 .LBB278-.Ltext0
+	.uleb128 .LBE278-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB279-.Ltext0
+	.uleb128 .LBE279-.Ltext0
+	.byte	0
+.LLRL290:
+	.byte	0x4
+	.uleb128 .LBB284-.Ltext0
+	.uleb128 .LBE284-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB291-.Ltext0
+	.uleb128 .LBE291-.Ltext0
+	.byte	0
+.LLRL292:
+	.byte	0x4
+	.uleb128 .LBB285-.Ltext0
+	.uleb128 .LBE285-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB288-.Ltext0
+	.uleb128 .LBE288-.Ltext0
+	.byte	0
+.LLRL295:
+	.byte	0x4
+	.uleb128 .LBB286-.Ltext0
+	.uleb128 .LBE286-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB289-.Ltext0
+	.uleb128 .LBE289-.Ltext0
+	.byte	0
+.LLRL298:
+	.byte	0x4
+	.uleb128 .LBB287-.Ltext0
+	.uleb128 .LBE287-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB290-.Ltext0
+	.uleb128 .LBE290-.Ltext0
+	.byte	0
+.LLRL304:
+	.byte	0x4
+	.uleb128 .LBB292-.Ltext0
+	.uleb128 .LBE292-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB303-.Ltext0
+	.uleb128 .LBE303-.Ltext0
+	.byte	0
+.LLRL309:
+	.byte	0x4
+	.uleb128 .LBB293-.Ltext0
+	.uleb128 .LBE293-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB299-.Ltext0
+	.uleb128 .LBE299-.Ltext0
+	.byte	0
+.LLRL312:
+	.byte	0x4
+	.uleb128 .LBB294-.Ltext0
+	.uleb128 .LBE294-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB300-.Ltext0
+	.uleb128 .LBE300-.Ltext0
+	.byte	0
+.LLRL315:
+	.byte	0x4
+	.uleb128 .LBB295-.Ltext0
+	.uleb128 .LBE295-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB301-.Ltext0
+	.uleb128 .LBE301-.Ltext0
+	.byte	0
+.LLRL318:
+	.byte	0x4
+	.uleb128 .LBB296-.Ltext0
+	.uleb128 .LBE296-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB302-.Ltext0
+	.uleb128 .LBE302-.Ltext0
+	.byte	0
+.LLRL321:
+	.byte	0x4
+	.uleb128 .LBB297-.Ltext0
+	.uleb128 .LBE297-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB298-.Ltext0
+	.uleb128 .LBE298-.Ltext0
+	.byte	0
+.LLRL330:
+	.byte	0x4
+	.uleb128 .LBB304-.Ltext0
+	.uleb128 .LBE304-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB305-.Ltext0
+	.uleb128 .LBE305-.Ltext0
+	.byte	0
+.LLRL333:
+	.byte	0x4
+	.uleb128 .LBB306-.Ltext0
+	.uleb128 .LBE306-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB307-.Ltext0
+	.uleb128 .LBE307-.Ltext0
+	.byte	0
+.LLRL336:
+	.byte	0x4
+	.uleb128 .LBB308-.Ltext0
+	.uleb128 .LBE308-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB309-.Ltext0
+	.uleb128 .LBE309-.Ltext0
+	.byte	0
+.LLRL341:
+	.byte	0x4
+	.uleb128 .LBB310-.Ltext0
+	.uleb128 .LBE310-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB315-.Ltext0
+	.uleb128 .LBE315-.Ltext0
+	.byte	0
+.LLRL344:
+	.byte	0x4
+	.uleb128 .LBB311-.Ltext0
+	.uleb128 .LBE311-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB313-.Ltext0
+	.uleb128 .LBE313-.Ltext0
+	.byte	0
+.LLRL347:
+	.byte	0x4
+	.uleb128 .LBB312-.Ltext0
+	.uleb128 .LBE312-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB314-.Ltext0
+	.uleb128 .LBE314-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF394
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h"
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF395
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF396
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0xc
+	.file 14 "/usr/include/limits.h"
+	.byte	0x3
+	.uleb128 0xcb
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h"
+	.byte	0x3
+	.uleb128 0xc3
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF572
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/local_lim.h"
+	.byte	0x3
+	.uleb128 0xa1
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 26 "/usr/include/linux/limits.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF636
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF643
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h"
+	.byte	0x3
+	.uleb128 0xc7
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0x8
+	.long	.LASF663
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF714
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF715
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF775
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF789
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF790
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF791
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF792
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF814
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.file 38 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF816
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF833
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF846
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF851
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF855
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF872
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF873
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF874
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF886
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF893
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF894
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF972
+	.file 54 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF995
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1031
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 59 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1062
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x3c
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 62 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3e
+	.file 63 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1069
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1132
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.file 66 "/usr/include/inttypes.h"
+	.byte	0x3
+	.uleb128 0x6b
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x3
+	.uleb128 0x135
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1344
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1345
+	.byte	0x4
+	.byte	0x4
+	.file 69 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 70 "/usr/include/stdio.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1378
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1379
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1380
+	.byte	0x4
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1381
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1382
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1383
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1579
+	.byte	0x3
+	.uleb128 0x86
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1580
+	.file 79 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1586
+	.byte	0x4
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.file 83 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1619
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1620
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1623
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1624
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF390
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unittest.h.2.f0a7d71e5425ff1436838cf2eea9b2ab,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.23.3c23ae3e8f372a0298be6ce978307bc7,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.32.6a1c51cbc8834927c9b529a347d7b23f,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF571
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix1_lim.h.32.a7cb894e219b90f9f73cd9217f417c40,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF602
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.25.97ee4129efb08ad296101237bcd3401b,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF606
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.3.0a3ae0fffe30e22dfdd77ac2c1b1fbdd,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF620
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.42.a403368f4a1bbbff510e22bd9037c5aa,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2a
+	.long	.LASF621
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF622
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF623
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF624
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF625
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF626
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF627
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF633
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF635
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.84.535be492ad9773d11e46b49da2c4d18d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF642
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix2_lim.h.23.56b9c4f885cbac0b652f53ee56b244b1,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF662
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.60.7bfe30ae3ff4e90f07238e284348f8e7,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF664
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF666
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF668
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF670
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF672
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF674
+	.byte	0x6
+	.uleb128 0x62
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF676
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF678
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF680
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF682
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF684
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF686
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF688
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF690
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF692
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF694
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF696
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF570
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF699
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF713
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF730
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF772
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF774
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF788
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.f6fdfdd3074dba759703a90896f28cf6,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF820
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF822
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF824
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF828
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF832
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF845
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF850
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF867
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF871
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF885
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF889
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.nohtyP.h.97.2e0fa8bba9384abbe6f78eb6f8754f10,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x342
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x34b
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x808
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x809
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x80a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x933
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x93d
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x95b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x95d
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x95f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x975
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x979
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x97b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x97d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x97e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x97f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x980
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x983
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x984
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x985
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x986
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x987
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x9b5
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x9b7
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x9bb
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x9be
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x9c0
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x9c4
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9c9
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9d2
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9d3
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x9d4
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x9d6
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x9d7
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x9d8
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x9de
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9e3
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e8
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9e9
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x9eb
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x9ec
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x9f2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x9fa
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x9fb
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x9fc
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xa02
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xa03
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xa04
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xa06
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xa08
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xa0b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xa14
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xa1b
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xa1c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xa1d
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xa1f
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xa21
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xa24
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xa2d
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xa3c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xa3d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xa3e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xa40
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xa42
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xa44
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xa47
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xa50
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xa51
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xa55
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xa57
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xa58
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xa59
+	.long	.LASF971
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.2a7f4947d4b7296e7e393bf9a618c3c1,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF990
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF991
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF992
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1004
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1016
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1023
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1030
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1052
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1058
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1061
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.31.44de592716652d75a04e2faa46853d09,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1064
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1068
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1131
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.47.1ef7fb496f1b65128a348b451b57d412,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1140
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.inttypes.h.23.2397f598c39b8a2316c758c5353fd94b,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1298
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.114.92fe5c078131265938a549edd1319448,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1342
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.310.45d0a216137ebcf1d6d874c8ac8a068a,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1360
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.f07083f9b666a9e5c52a336c758fdd72,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1373
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1374
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF992
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1376
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1374
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF992
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1375
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1391
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.93.8171f82adf48af92ec67424d5f5b709c,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1400
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1407
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1412
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1416
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF1417
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unittest.h.26.cfd313572d0c5f6e4458388009f5c7dd,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x354
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x468
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x470
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x477
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1577
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1585
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1601
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1603
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1618
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time.h.65.ad8b7cdf304665ee800a89090a0d61aa,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1622
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1645
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1863:
+	.string	"test_freelists"
+.LASF914:
+	.string	"_ypStringLib_ENC_CODE_LATIN_1 (1u)"
+.LASF1593:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1661:
+	.string	"__align"
+.LASF1704:
+	.string	"_yp_ob_len_t"
+.LASF679:
+	.string	"SHRT_MAX"
+.LASF1885:
+	.string	"preserved"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1787:
+	.string	"yp_floatstoreCF"
+.LASF1453:
+	.string	"_STRINGIFY27(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1586:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF984:
+	.string	"_WCHAR_T_DEFINED "
+.LASF674:
+	.string	"CHAR_MIN SCHAR_MIN"
+.LASF935:
+	.ascii	"_yp_IMMORTAL_F"
+	.string	"UNCTION5(qual,name,code,parameters_len,parameters) static struct _ypFunctionObject _ ##name ##_struct = { _yp_IMMORTAL_HEAD_INIT(_ypFunction_CODE, 0, (parameters_len), (parameters)), (code), NULL}; qual ypObject *const _yp_UNUSED name = _yp_CONST_REF(name)"
+.LASF846:
+	.string	"_SYS_SELECT_H 1"
+.LASF1314:
+	.string	"munit_error(msg) munit_errorf(\"%s\", msg)"
+.LASF680:
+	.string	"SHRT_MAX __SHRT_MAX__"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1209:
+	.string	"PRIXLEAST8 \"X\""
+.LASF1473:
+	.string	"_COMMA_REPEAT13(x) x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1189:
+	.string	"PRIuFAST8 \"u\""
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF398:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1237:
+	.string	"SCNdFAST8 \"hhd\""
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF722:
+	.string	"__SQUAD_TYPE long int"
+.LASF1743:
+	.string	"is_mutable"
+.LASF1073:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF818:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1354:
+	.string	"munit_assert_not_null(ptr) munit_assert_ptr(ptr, !=, NULL)"
+.LASF1424:
+	.string	"_PP_NARG(prefix,...) _ESC(_PP_ARG_N(prefix, __VA_ARGS__))"
+.LASF1838:
+	.string	"_ypmt_SEQ_item_strs"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1222:
+	.string	"PRIXMAX __PRI64_PREFIX \"X\""
+.LASF784:
+	.string	"__pid_t_defined "
+.LASF817:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1156:
+	.string	"PRIdFAST64 __PRI64_PREFIX \"d\""
+.LASF1069:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1585:
+	.string	"SCHED_RR 2"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF629:
+	.string	"_POSIX_THREAD_KEYS_MAX 128"
+.LASF1001:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF631:
+	.string	"_POSIX_THREAD_DESTRUCTOR_ITERATIONS 4"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1066:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1171:
+	.string	"PRIo32 \"o\""
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1603:
+	.string	"__sched_priority sched_priority"
+.LASF1063:
+	.string	"MUNIT_VERSION(major,minor,revision) (((major) << 16) | ((minor) << 8) | (revision))"
+.LASF572:
+	.string	"_BITS_POSIX1_LIM_H 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1728:
+	.string	"_Bool"
+.LASF1668:
+	.string	"ob_refcnt"
+.LASF1536:
+	.ascii	"_assert_typeC_raises_exc(T,a_statement,op,b_statement,excs,v"
+	.ascii	"al_pri,a_fmt,b_fmt,excs_fmt,a_str,b_str,excs_str) do { ypObj"
+	.ascii	"ect *_ypmt_TYPEC_excs[] = {UNPACK excs}; yp_ssize_t _ypmt_TY"
+	.ascii	"PEC_n = yp_lengthof_array(_ypmt_TYPEC_excs); T _ypmt_TYPEC_a"
+	.ascii	"; T _ypmt_TYPEC_b; _assert_raises_exc(_ypmt_TYP"
+	.string	"EC_a = (a_statement), _ypmt_TYPEC_n, _ypmt_TYPEC_excs, a_fmt, excs_fmt, a_str, excs_str); _assert_not_raises_exc(_ypmt_TYPEC_b = (b_statement), b_fmt, b_str); _assert_typeC(_ypmt_TYPEC_a, op, _ypmt_TYPEC_b, val_pri, a_fmt, b_fmt, a_str, b_str); } while (0)"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1258:
+	.string	"SCNuLEAST16 \"hu\""
+.LASF644:
+	.string	"_BITS_POSIX2_LIM_H 1"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF607:
+	.string	"_LINUX_LIMITS_H "
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1300:
+	.string	"MUNIT_LIKELY(expr) (__builtin_expect ((expr), 1))"
+.LASF1588:
+	.string	"__CPU_SETSIZE 1024"
+.LASF570:
+	.string	"LLONG_MAX __LONG_LONG_MAX__"
+.LASF1714:
+	.string	"MunitParameter"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1612:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF1692:
+	.string	"yp_t_floatstore"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1559:
+	.string	"assert_setlike(obj,...) do { ypObject *_ypmt_SET_obj = (obj); ypObject *_ypmt_SET_items[] = {__VA_ARGS__}; char *_ypmt_SET_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_setlike(_ypmt_SET_obj, _ypmt_SET_items, \"%s\", _ypmt_SET_item_strs, #obj); } while (0)"
+.LASF1316:
+	.string	"munit_assert_true(expr) do { if (!MUNIT_LIKELY(expr)) { munit_error(\"assertion failed: \" #expr \" is not true\"); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF589:
+	.string	"_POSIX_PIPE_BUF 512"
+.LASF1705:
+	.string	"MUNIT_OK"
+.LASF1385:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1468:
+	.string	"_COMMA_REPEAT8(x) x, x, x, x, x, x, x, x"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF394:
+	.string	"yp_NOHTYP_H "
+.LASF1265:
+	.string	"SCNo8 \"hho\""
+.LASF1197:
+	.string	"PRIxLEAST8 \"x\""
+.LASF421:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF651:
+	.string	"_POSIX2_LINE_MAX 2048"
+.LASF1331:
+	.string	"munit_assert_float(a,op,b) munit_assert_type(float, \"f\", a, op, b)"
+.LASF396:
+	.string	"_GCC_NEXT_LIMITS_H "
+.LASF1843:
+	.string	"_ypmt_OBJ_result"
+.LASF1736:
+	.string	"new_"
+.LASF976:
+	.string	"__WCHAR_T__ "
+.LASF995:
+	.string	"_STDLIB_H 1"
+.LASF1009:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF947:
+	.string	"yp_ELSE } } if(_yp_IF_cond == yp_False) { {"
+.LASF702:
+	.string	"__need___va_list"
+.LASF1884:
+	.string	"newp"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF616:
+	.string	"PIPE_BUF 4096"
+.LASF928:
+	.ascii	"_yp_IMMORTAL_STR_LATIN_1(qual,name,value) static const char "
+	.ascii	"_ ##name ##_dat"
+	.string	"a[] = (value); static struct _ypStringLibObject _ ##name ##_struct = { _yp_IMMORTAL_HEAD_INIT(_ypStr_CODE, _ypStringLib_ENC_CODE_LATIN_1, sizeof(_ ##name ##_data) - 1, (void *)_ ##name ##_data), }; qual ypObject *const _yp_UNUSED name = _yp_CONST_REF(name)"
+.LASF670:
+	.string	"SCHAR_MAX __SCHAR_MAX__"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF688:
+	.string	"UINT_MAX (INT_MAX * 2U + 1U)"
+.LASF1386:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1248:
+	.string	"SCNiLEAST64 __PRI64_PREFIX \"i\""
+.LASF1323:
+	.string	"munit_assert_ushort(a,op,b) munit_assert_type(unsigned short, MUNIT_SHORT_MODIFIER \"u\", a, op, b)"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF907:
+	.string	"_ypObject_HEAD ypObject ob_base"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1665:
+	.string	"ob_type"
+.LASF1824:
+	.string	"fixture"
+.LASF829:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF772:
+	.string	"__FD_SETSIZE 1024"
+.LASF730:
+	.string	"__STD_TYPE typedef"
+.LASF599:
+	.string	"_POSIX_TIMER_MAX 32"
+.LASF1592:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF612:
+	.string	"MAX_CANON 255"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1544:
+	.string	"yp_is(a,b) ((a) == (b) ? yp_True : yp_False)"
+.LASF950:
+	.string	"yp_ENDIF } } }"
+.LASF1319:
+	.string	"munit_assert_type(T,fmt,a,op,b) munit_assert_type_full(\"\", \"\", T, fmt, a, op, b)"
+.LASF630:
+	.string	"PTHREAD_KEYS_MAX 1024"
+.LASF1208:
+	.string	"PRIX64 __PRI64_PREFIX \"X\""
+.LASF1306:
+	.string	"MUNIT_SHORT_MODIFIER \"h\""
+.LASF1832:
+	.string	"test_collect_automatic"
+.LASF782:
+	.string	"__uid_t_defined "
+.LASF1492:
+	.string	"_COMMA_REPEAT32(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1099:
+	.string	"INT_FAST8_MAX (127)"
+.LASF910:
+	.string	"_ypObject_REFCNT_IMMORTAL (0x7FFFFFFFu)"
+.LASF1673:
+	.string	"yp_uint8_t"
+.LASF1384:
+	.string	"__struct_FILE_defined 1"
+.LASF1391:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF1755:
+	.string	"peer_type_t"
+.LASF1556:
+	.ascii	"_assert_sequence(obj,items,obj_fmt,item_strs,...) do { yp_ss"
+	.ascii	"ize_t _ypmt_SEQ_n = yp_lengthof_array(items); yp_ssize_t _yp"
+	.ascii	"mt_SEQ_i; _assert_len(obj, _ypmt_SEQ_n, obj_fmt, \"%\" PRIss"
+	.ascii	"ize, __VA_ARGS__, _ypmt_SEQ_n); for (_ypmt_SEQ_i = 0; _ypmt_"
+	.ascii	"SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_ac"
+	.ascii	"tual = yp_getindexC(obj, _ypmt_SEQ_i); _assert_not_exception"
+	.ascii	"(_ypmt_SEQ_actual, \"yp_getindexC(\" o"
+	.string	"bj_fmt \", %\" PRIssize \")\", __VA_ARGS__, _ypmt_SEQ_i); _assert_eq_same_type(_ypmt_SEQ_actual, items[_ypmt_SEQ_i], \"yp_getindexC(\" obj_fmt \", %\" PRIssize \")\", \"%s\", __VA_ARGS__, _ypmt_SEQ_i, item_strs[_ypmt_SEQ_i]); yp_decref(_ypmt_SEQ_actual); } } while (0)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1887:
+	.string	"test_malloc"
+.LASF908:
+	.string	"_ypSmallObject_HEAD struct _ypSmallObject ob_base"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1701:
+	.string	"tracked"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1397:
+	.string	"SEEK_SET 0"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1490:
+	.string	"_COMMA_REPEAT30(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF952:
+	.string	"yp_WHILE(expression) _yp_WHILE(expression, ((void)0))"
+.LASF419:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1682:
+	.string	"yp_int_t"
+.LASF638:
+	.string	"TTY_NAME_MAX 32"
+.LASF1889:
+	.string	"__subvdi3"
+.LASF1231:
+	.string	"SCNd32 \"d\""
+.LASF1854:
+	.string	"test_arena"
+.LASF711:
+	.string	"_VA_LIST_DEFINED "
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF781:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1566:
+	.ascii	"_faulty_iter_tests(setup,iter_name,iter_supplier,statement,a"
+	.ascii	"ssertion,tear_down,exc_suffix,statement_str) do { yp_ssize_t"
+	.ascii	" _ypmt_FLT_ITR_len = yp_lenC_not_raises(iter_supplier); if ("
+	.ascii	"_ypmt_FLT_ITR_len < 2) { munit_error(\"iter_supplier must co"
+	.ascii	"ntain at least two entries\"); } _faulty_iter_test_raises(se"
+	.ascii	"tup, iter_name, yp_StopIteration, statement, tear_down, \"ex"
+	.ascii	"c_passthrough\", exc_suffix, yp_StopIteration, statement_str"
+	.ascii	"); _faulty_iter_test_raises(setup, iter_name, new_faulty_ite"
+	.ascii	"r(iter_supplier, 0, yp_SyntaxError, _ypmt_FLT_ITR_len), stat"
+	.ascii	"ement, tear_down, \"fail_start\", exc_suffix, yp_SyntaxError"
+	.ascii	", statement_str); _faulty_iter_test_raises(setup, iter_name,"
+	.ascii	" new_faulty_iter(iter_supplier, 1, yp_SyntaxError, _ypmt_FLT"
+	.ascii	"_ITR_len), statement, tear_down, \"fail_mid\", exc_suffix, y"
+	.ascii	"p_SyntaxError, statement_str); _faulty_iter_test_raises(setu"
+	.ascii	"p, iter_name, new_faulty_iter(iter_supplier, 0, yp_Generator"
+	.ascii	"Exit, _ypmt_FLT_ITR_len), statement, tear_down, \"fail_start"
+	.ascii	"\", exc_suffix, yp_GeneratorExit, statement_str); _faulty_it"
+	.ascii	"er_test_raises(setup, iter_name, new_faulty_iter( iter_suppl"
+	.ascii	"ier, _ypmt_FLT_ITR_len, yp_GeneratorExit, _ypmt_FLT_ITR_len)"
+	.ascii	", statement, tear_down, \"fail_end\", exc_suffix, yp_Generat"
+	.ascii	"orExit, statement_str); _faulty_iter_test_succeeds(setup, it"
+	.ascii	"er_name, new_faulty_iter(iter_supplier, _ypmt_FLT_ITR_len + "
+	.ascii	"1, yp_SyntaxError, 1), statement, assertion, tear_down, \"hi"
+	.ascii	"nt_small\","
+	.string	" exc_suffix, statement_str); _faulty_iter_test_succeeds(setup, iter_name, new_faulty_iter(iter_supplier, _ypmt_FLT_ITR_len + 1, yp_SyntaxError, _ypmt_FLT_ITR_len + 100), statement, assertion, tear_down, \"hint_large\", exc_suffix, statement_str); } while (0)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF975:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1716:
+	.string	"MUNIT_TEST_OPTION_SINGLE_ITERATION"
+.LASF1881:
+	.string	"allocator"
+.LASF410:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1537:
+	.string	"assert_intC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_int_t, a, op, b, (__VA_ARGS__), PRIint, \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF1445:
+	.string	"_STRINGIFY19(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s"
+.LASF1164:
+	.string	"PRIiLEAST64 __PRI64_PREFIX \"i\""
+.LASF1126:
+	.string	"UINT8_C(c) c"
+.LASF1341:
+	.string	"munit_assert_uint64(a,op,b) munit_assert_type(munit_uint64_t, PRIu64, a, op, b)"
+.LASF569:
+	.string	"LLONG_MIN (-LLONG_MAX-1)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1076:
+	.string	"INT16_MAX (32767)"
+.LASF575:
+	.string	"_POSIX_ARG_MAX 4096"
+.LASF1278:
+	.string	"SCNx16 \"hx\""
+.LASF1147:
+	.string	"PRId32 \"d\""
+.LASF650:
+	.string	"_POSIX2_EXPR_NEST_MAX 32"
+.LASF1048:
+	.string	"__f64x(x) x ##f64x"
+.LASF1150:
+	.string	"PRIdLEAST16 \"d\""
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1289:
+	.string	"SCNdMAX __PRI64_PREFIX \"d\""
+.LASF1712:
+	.string	"MunitParameterEnum"
+.LASF1522:
+	.string	"assert_not_raises(statement) _assert_not_raises((statement), \"%s\", #statement)"
+.LASF433:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1176:
+	.string	"PRIoLEAST64 __PRI64_PREFIX \"o\""
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF617:
+	.string	"XATTR_NAME_MAX 255"
+.LASF938:
+	.string	"yp_IMMORTAL_FUNCTION_static(name,code,parameters) _yp_IMMORTAL_FUNCTION(static, name, code, parameters)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1136:
+	.string	"munit_uint16_t uint16_t"
+.LASF768:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1365:
+	.string	"_T_PTRDIFF_ "
+.LASF1188:
+	.string	"PRIuLEAST64 __PRI64_PREFIX \"u\""
+.LASF1240:
+	.string	"SCNdFAST64 __PRI64_PREFIX \"d\""
+.LASF1659:
+	.string	"pthread_t"
+.LASF1557:
+	.ascii	"as"
+	.string	"sert_sequence(obj,...) do { ypObject *_ypmt_SEQ_obj = (obj); ypObject *_ypmt_SEQ_items[] = {__VA_ARGS__}; char *_ypmt_SEQ_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_sequence(_ypmt_SEQ_obj, _ypmt_SEQ_items, \"%s\", _ypmt_SEQ_item_strs, #obj); } while (0)"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF805:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1100:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1671:
+	.string	"ob_hash"
+.LASF1518:
+	.string	"_assert_not_exception(obj,obj_fmt,...) do { if (yp_isexceptionC(obj)) { munit_errorf(\"assertion failed: !yp_isexceptionC(\" obj_fmt \")\", __VA_ARGS__); } } while (0)"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF966:
+	.string	"yp1(self,method) yp_ ##method(self)"
+.LASF1466:
+	.string	"_COMMA_REPEAT6(x) x, x, x, x, x, x"
+.LASF1103:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1870:
+	.string	"_ypmt_RAISES_expected"
+.LASF727:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1483:
+	.string	"_COMMA_REPEAT23(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF921:
+	.string	"_ypFunction_CODE (28u)"
+.LASF1026:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF917:
+	.string	"_ypBaseException_CODE (2u)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF642:
+	.string	"SEM_VALUE_MAX (2147483647)"
+.LASF858:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1814:
+	.string	"yp_decref"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1345:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1800:
+	.string	"pthread_create"
+.LASF1798:
+	.string	"yp_arena_begin"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF401:
+	.string	"__USE_ISOC11"
+.LASF1760:
+	.string	"rand_obj_supplier_memo_t"
+.LASF1741:
+	.string	"rand_values"
+.LASF1503:
+	.string	"yp_lengthof_array(x) (yp_sizeof(x) / yp_sizeof((x)[0]))"
+.LASF579:
+	.string	"_POSIX_LINK_MAX 8"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1416:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF831:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1823:
+	.string	"params"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF713:
+	.string	"__va_list__ "
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1254:
+	.string	"SCNu16 \"hu\""
+.LASF513:
+	.string	"__always_inline"
+.LASF970:
+	.string	"yp4(self,method,a1,a2,a3) yp_ ##method(self, a1, a2, a3)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1032:
+	.string	"__HAVE_FLOAT16 0"
+.LASF968:
+	.string	"yp(self,method,...) yp_ ##method(self, __VA_ARGS__)"
+.LASF1340:
+	.string	"munit_assert_int64(a,op,b) munit_assert_type(munit_int64_t, PRIi64, a, op, b)"
+.LASF1555:
+	.string	"assert_len(obj,expected) do { ypObject *_ypmt_LEN_obj = (obj); yp_ssize_t _ypmt_LEN_expected = (expected); _assert_len(_ypmt_LEN_obj, _ypmt_LEN_expected, \"%s\", \"%s\", #obj, #expected); } while (0)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF632:
+	.string	"PTHREAD_DESTRUCTOR_ITERATIONS _POSIX_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF1711:
+	.string	"values"
+.LASF677:
+	.string	"SHRT_MIN"
+.LASF964:
+	.string	"yp_FOR_EXCEPT_AS(target) yp_FOR_EXCEPT ypObject *target = _yp_FOR_item;"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1531:
+	.ascii	"assert_raises_exc(statem"
+	.string	"ent,...) do { ypObject *_ypmt_RAISES_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_RAISES_n = yp_lengthof_array(_ypmt_RAISES_expected); _assert_raises_exc((statement), _ypmt_RAISES_n, _ypmt_RAISES_expected, \"%s\", \"%s\", #statement, #__VA_ARGS__); } while (0)"
+.LASF1742:
+	.string	"rand_ordered_items"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF940:
+	.string	"yp_IMMORTAL_FUNCTION2_static(name,code) _yp_IMMORTAL_FUNCTION5(static, name, code, 0, NULL)"
+.LASF1067:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1218:
+	.string	"PRIiMAX __PRI64_PREFIX \"i\""
+.LASF1422:
+	.string	"PRIssize PRId64"
+.LASF1153:
+	.string	"PRIdFAST8 \"d\""
+.LASF1754:
+	.string	"hashable_items_only"
+.LASF1305:
+	.string	"MUNIT_CHAR_MODIFIER \"hh\""
+.LASF663:
+	.string	"_GCC_NEXT_LIMITS_H"
+.LASF915:
+	.string	"_ypStringLib_ENC_CODE_UCS_2 (2u)"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1472:
+	.string	"_COMMA_REPEAT12(x) x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1095:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1646:
+	.string	"double"
+.LASF1456:
+	.string	"_STRINGIFY30(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D"
+.LASF1514:
+	.string	"assert_not_null(ptr) munit_assert_not_null(ptr)"
+.LASF749:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF696:
+	.string	"LLONG_MIN (-LLONG_MAX - 1LL)"
+.LASF1715:
+	.string	"MUNIT_TEST_OPTION_NONE"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF725:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF798:
+	.string	"_T_SIZE_ "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1549:
+	.ascii	"a"
+	.string	"ssert_type_is(obj,expected) do { ypObject *_ypmt_TYPE_obj = (obj); ypObject *_ypmt_TYPE_expected = (expected); _assert_not_exception(_ypmt_TYPE_obj, \"%s\", #obj); _assert_type_is(_ypmt_TYPE_obj, _ypmt_TYPE_expected, \"%s\", \"%s\", #obj, #expected); } while (0)"
+.LASF842:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1181:
+	.string	"PRIu8 \"u\""
+.LASF1577:
+	.string	"SUITE_OF_SUITES_DECLS(name) extern MunitSuite name ##_suites[]; extern void name ##_initialize(void)"
+.LASF850:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1653:
+	.string	"long int"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1539:
+	.string	"assert_ssizeC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_ssize_t, a, op, b, (__VA_ARGS__), PRIssize, \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF1606:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1772:
+	.string	"free"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1869:
+	.string	"expected_hash"
+.LASF1619:
+	.string	"__struct_tm_defined 1"
+.LASF585:
+	.string	"_POSIX_NAME_MAX 14"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF672:
+	.string	"UCHAR_MAX (SCHAR_MAX * 2 + 1)"
+.LASF1012:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1591:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1122:
+	.string	"INT8_C(c) c"
+.LASF1415:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF809:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF900:
+	.string	"yp_SLICE_DEFAULT yp_SSIZE_T_MIN"
+.LASF1036:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1417:
+	.string	"__STDIO_INLINE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1696:
+	.string	"yp_ValueError"
+.LASF1245:
+	.string	"SCNiLEAST8 \"hhi\""
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF658:
+	.string	"COLL_WEIGHTS_MAX 255"
+.LASF626:
+	.string	"__undef_OPEN_MAX"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1144:
+	.string	"__PRIPTR_PREFIX \"l\""
+.LASF1287:
+	.string	"SCNxFAST32 __PRIPTR_PREFIX \"x\""
+.LASF615:
+	.string	"PATH_MAX 4096"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1124:
+	.string	"INT32_C(c) c"
+.LASF1527:
+	.string	"assert_isexception_exc assert_raises_exc"
+.LASF1709:
+	.string	"MunitResult"
+.LASF1226:
+	.string	"PRIuPTR __PRIPTR_PREFIX \"u\""
+.LASF1443:
+	.string	"_STRINGIFY17(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q"
+.LASF648:
+	.string	"_POSIX2_BC_STRING_MAX 1000"
+.LASF1871:
+	.string	"_ypmt_RAISES_n"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1633:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF1849:
+	.string	"test_arena_thread_exit"
+.LASF1781:
+	.string	"yp_mem_system_free"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF944:
+	.string	"_yp_ELIF(expression,decref_expression) } } if(_yp_IF_cond == yp_False) { _yp_IF_expr = (expression); _yp_IF_cond = yp_bool(_yp_IF_expr); decref_expression; if(_yp_IF_cond == yp_True) {"
+.LASF1028:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1812:
+	.string	"yp_collect_disable"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF698:
+	.string	"ULLONG_MAX"
+.LASF806:
+	.string	"_SIZE_T_DECLARED "
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1848:
+	.string	"_ypmt_SEQ_items"
+.LASF1706:
+	.string	"MUNIT_FAIL"
+.LASF1837:
+	.string	"_ypmt_SEQ_obj"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1072:
+	.string	"INT16_MIN (-32767-1)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1152:
+	.string	"PRIdLEAST64 __PRI64_PREFIX \"d\""
+.LASF1400:
+	.string	"P_tmpdir \"/tmp\""
+.LASF1638:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF1318:
+	.ascii	"munit_assert_type_full(prefix,suffix,T,fmt,a,op,b) do { T mu"
+	.ascii	"nit_tmp_a_ = (a); T munit_tmp_b_ = (b); if ("
+	.string	"!(munit_tmp_a_ op munit_tmp_b_)) { munit_errorf(\"assertion failed: %s %s %s (\" prefix \"%\" fmt suffix \" %s \" prefix \"%\" fmt suffix \")\", #a, #op, #b, munit_tmp_a_, #op, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF1773:
+	.string	"allocator_t"
+.LASF1321:
+	.string	"munit_assert_uchar(a,op,b) munit_assert_type_full(\"'\\\\x\", \"'\", unsigned char, \"02\" MUNIT_CHAR_MODIFIER \"x\", a, op, b)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1700:
+	.string	"collected"
+.LASF1850:
+	.string	"thread"
+.LASF1672:
+	.string	"ob_data"
+.LASF1723:
+	.string	"setup"
+.LASF828:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1201:
+	.string	"PRIxFAST8 \"x\""
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1335:
+	.string	"munit_assert_uint8(a,op,b) munit_assert_type(munit_uint8_t, PRIu8, a, op, b)"
+.LASF1232:
+	.string	"SCNd64 __PRI64_PREFIX \"d\""
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF603:
+	.string	"__undef_NR_OPEN "
+.LASF1819:
+	.string	"yp_collect_enable"
+.LASF1451:
+	.string	"_STRINGIFY25(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1757:
+	.string	"type"
+.LASF821:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1442:
+	.string	"_STRINGIFY16(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p"
+.LASF1060:
+	.string	"alloca"
+.LASF1058:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF854:
+	.string	"__timeval_defined 1"
+.LASF1233:
+	.string	"SCNdLEAST8 \"hhd\""
+.LASF1371:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1670:
+	.string	"ob_alloclen"
+.LASF586:
+	.string	"_POSIX_NGROUPS_MAX 8"
+.LASF1104:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF619:
+	.string	"XATTR_LIST_MAX 65536"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1121:
+	.string	"WINT_MAX (4294967295u)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1051:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF662:
+	.string	"RE_DUP_MAX (0x7fff)"
+.LASF666:
+	.string	"CHAR_BIT __CHAR_BIT__"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1568:
+	.ascii	"faulty_iter_tests_exc(setup,iter_name,iter_supplier,statemen"
+	.ascii	"t,assertion,tear_down) do { ypObject *_ypmt_FLT_ITR_supplie"
+	.string	"r = (iter_supplier); char _ypmt_FLT_ITR_statement_str[] = #statement; _faulty_iter_tests((setup), (iter_name), _ypmt_FLT_ITR_supplier, (statement), (assertion), (tear_down), _exc, _ypmt_FLT_ITR_statement_str); yp_decref(_ypmt_FLT_ITR_supplier); } while (0)"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1250:
+	.string	"SCNiFAST16 __PRIPTR_PREFIX \"i\""
+.LASF1607:
+	.string	"CLOCK_REALTIME 0"
+.LASF1852:
+	.string	"second"
+.LASF1739:
+	.string	"rand_items"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF405:
+	.string	"__USE_POSIX"
+.LASF1627:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF987:
+	.string	"__INT_WCHAR_T_H "
+.LASF779:
+	.string	"__gid_t_defined "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1162:
+	.string	"PRIiLEAST16 \"i\""
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1308:
+	.string	"MUNIT_PUSH_DISABLE_MSVC_C4127_ "
+.LASF1538:
+	.string	"assert_floatC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_float_t, a, op, b, (__VA_ARGS__), \"lf\", \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1478:
+	.string	"_COMMA_REPEAT18(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1213:
+	.string	"PRIXFAST8 \"X\""
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF847:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1160:
+	.string	"PRIi64 __PRI64_PREFIX \"i\""
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1102:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1858:
+	.string	"_ypmt_OBJ_a"
+.LASF1859:
+	.string	"_ypmt_OBJ_b"
+.LASF841:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1476:
+	.string	"_COMMA_REPEAT16(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF645:
+	.string	"_POSIX2_BC_BASE_MAX 99"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1262:
+	.string	"SCNuFAST16 __PRIPTR_PREFIX \"u\""
+.LASF1022:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF780:
+	.string	"__mode_t_defined "
+.LASF1753:
+	.string	"original_object_return"
+.LASF1312:
+	.string	"munit_log(level,msg) munit_logf(level, \"%s\", msg)"
+.LASF1185:
+	.string	"PRIuLEAST8 \"u\""
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1494:
+	.string	"_COMMA_REPEAT34(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1047:
+	.string	"__f32x(x) x ##f32x"
+.LASF1580:
+	.string	"_PTHREAD_H 1"
+.LASF1211:
+	.string	"PRIXLEAST32 \"X\""
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF933:
+	.string	"yp_IMMORTAL_BYTES_static(name,value) _yp_IMMORTAL_BYTES(static, name, value)"
+.LASF1488:
+	.string	"_COMMA_REPEAT28(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1609:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1086:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1770:
+	.string	"malloc"
+.LASF1639:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF1649:
+	.string	"unsigned char"
+.LASF1688:
+	.string	"yp_i_two"
+.LASF1674:
+	.string	"yp_uint16_t"
+.LASF1096:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1605:
+	.string	"_BITS_TIME_H 1"
+.LASF610:
+	.string	"ARG_MAX 131072"
+.LASF1783:
+	.string	"yp_mem_default_malloc"
+.LASF1309:
+	.string	"MUNIT_POP_DISABLE_MSVC_C4127_ "
+.LASF584:
+	.string	"_POSIX_MQ_PRIO_MAX 32"
+.LASF1521:
+	.string	"_assert_not_raises(statement,statement_fmt,...) do { ypObject *_ypmt_NOT_RAISES_obj = statement; _assert_not_exception(_ypmt_NOT_RAISES_obj, statement_fmt, __VA_ARGS__); } while (0)"
+.LASF955:
+	.string	"yp_WHILE_EXCEPT } if(yp_isexceptionC(_yp_WHILE_cond)) {"
+.LASF1332:
+	.string	"munit_assert_double(a,op,b) munit_assert_type(double, \"g\", a, op, b)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1372:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1541:
+	.ascii	"_assert_bool(obj,value,n"
+	.string	"ot_value,obj_fmt,...) do { if (obj == value) { } else if (obj == not_value) { munit_errorf(\"assertion failed: \" obj_fmt \" == \" #value, __VA_ARGS__); } else { _ypmt_error_exception(obj, \"expected a bool or an exception\", obj_fmt, __VA_ARGS__); } } while (0)"
+.LASF1542:
+	.string	"assert_falsy(obj) do { ypObject *_ypmt_FALSY_result = yp_bool(obj); _assert_bool(_ypmt_FALSY_result, yp_False, yp_True, \"yp_bool(%s)\", #obj); } while (0)"
+.LASF1329:
+	.string	"munit_assert_ullong(a,op,b) munit_assert_type(unsigned long long int, \"llu\", a, op, b)"
+.LASF1751:
+	.string	"is_callable"
+.LASF358:
+	.string	"__k8 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF590:
+	.string	"_POSIX_RE_DUP_MAX 255"
+.LASF1678:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF403:
+	.string	"__USE_ISOC95"
+.LASF1685:
+	.string	"yp_True"
+.LASF402:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1589:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF1123:
+	.string	"INT16_C(c) c"
+.LASF1285:
+	.string	"SCNxFAST8 \"hhx\""
+.LASF1334:
+	.string	"munit_assert_int8(a,op,b) munit_assert_type(munit_int8_t, PRIi8, a, op, b)"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1149:
+	.string	"PRIdLEAST8 \"d\""
+.LASF1418:
+	.string	"TRUE (1 == 1)"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF814:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1364:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF826:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF412:
+	.string	"__USE_XOPEN2K"
+.LASF678:
+	.string	"SHRT_MIN (-SHRT_MAX - 1)"
+.LASF408:
+	.string	"__USE_POSIX199506"
+.LASF1675:
+	.string	"yp_int32_t"
+.LASF1693:
+	.string	"yp_StopIteration"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF941:
+	.string	"_yp_IF(expression,decref_expression) { ypObject *_yp_IF_expr; ypObject *_yp_IF_cond; { _yp_IF_expr = (expression); _yp_IF_cond = yp_bool(_yp_IF_expr); decref_expression; if(_yp_IF_cond == yp_True) {"
+.LASF654:
+	.string	"BC_BASE_MAX _POSIX2_BC_BASE_MAX"
+.LASF1293:
+	.string	"SCNxMAX __PRI64_PREFIX \"x\""
+.LASF1573:
+	.string	"obj_array_fill(array,uq,filler) (filler)((uq), yp_lengthof_array(array), (array))"
+.LASF844:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF640:
+	.string	"HOST_NAME_MAX 64"
+.LASF1517:
+	.string	"assert_hashC(a,op,b) munit_assert_type(yp_hash_t, PRIssize, a, op, b)"
+.LASF1630:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF1529:
+	.ascii	"assert_raises(st"
+	.string	"atement,...) do { ypObject *_ypmt_RAISES_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_RAISES_n = yp_lengthof_array(_ypmt_RAISES_expected); _assert_raises((statement), _ypmt_RAISES_n, _ypmt_RAISES_expected, \"%s\", \"%s\", #statement, #__VA_ARGS__); } while (0)"
+.LASF1091:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1221:
+	.string	"PRIxMAX __PRI64_PREFIX \"x\""
+.LASF512:
+	.string	"__wur "
+.LASF894:
+	.string	"__have_pthread_attr_t 1"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1253:
+	.string	"SCNu8 \"hhu\""
+.LASF1145:
+	.string	"PRId8 \"d\""
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1011:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1581:
+	.string	"_SCHED_H 1"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1563:
+	.string	"ead(name,expression,assertion) do { ypObject *(name) = (expression); assertion; yp_decref(name); } while (0)"
+.LASF988:
+	.string	"_GCC_WCHAR_T "
+.LASF1217:
+	.string	"PRIdMAX __PRI64_PREFIX \"d\""
+.LASF1732:
+	.string	"yp_type"
+.LASF1207:
+	.string	"PRIX32 \"X\""
+.LASF1223:
+	.string	"PRIdPTR __PRIPTR_PREFIX \"d\""
+.LASF1271:
+	.string	"SCNoLEAST32 \"o\""
+.LASF789:
+	.string	"__clock_t_defined 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1632:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF983:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF741:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1530:
+	.ascii	"_assert_raises_exc(statement,n,expected,statement_fmt,expect"
+	.ascii	"ed_fmt,...) do { ypObject *exc = yp_None; if (n < 1) { munit"
+	.ascii	"_error(\"missing expected exception in assertion\"); } state"
+	.ascii	"ment; if (!yp_isexceptionC(exc)) { munit_errorf(\"assertion "
+	.ascii	"failed: \""
+	.string	" statement_fmt \"; yp_isexceptionC(exc) (expected \" expected_fmt \")\", __VA_ARGS__); } if (!yp_isexception_arrayC(exc, n, expected)) { munit_errorf(\"assertion failed: \" statement_fmt \"; yp_isexceptionCN(exc, N(\" expected_fmt \"))\", __VA_ARGS__); } } while (0)"
+.LASF1448:
+	.string	"_STRINGIFY22(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v"
+.LASF1856:
+	.string	"_ypmt_LEN_expected"
+.LASF1834:
+	.string	"dict"
+.LASF857:
+	.string	"__NFDBITS"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1070:
+	.string	"__intptr_t_defined "
+.LASF635:
+	.string	"AIO_PRIO_DELTA_MAX 20"
+.LASF1078:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1089:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF602:
+	.string	"_POSIX_CLOCKRES_MIN 20000000"
+.LASF1014:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1291:
+	.string	"SCNoMAX __PRI64_PREFIX \"o\""
+.LASF576:
+	.string	"_POSIX_CHILD_MAX 25"
+.LASF1350:
+	.ascii	"munit_assert_memory_not_equal(size,a,b) do { const unsigned "
+	.ascii	"char* munit_tmp_a_ = (const unsigned char*) (a); const unsig"
+	.ascii	"ned char* munit_tmp_b_ = (const unsigned char*) (b); const s"
+	.ascii	"ize_t munit_tmp_si"
+	.string	"ze_ = (size); if (MUNIT_UNLIKELY(memcmp(munit_tmp_a_, munit_tmp_b_, munit_tmp_size_)) == 0) { munit_errorf(\"assertion failed: memory %s != %s (%zu bytes)\", #a, #b, munit_tmp_size_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF708:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1509:
+	.string	"_assert_ptr(a,op,b,a_fmt,b_fmt,...) _assert_typeC(a, op, b, \"p\", a_fmt, b_fmt, __VA_ARGS__)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1225:
+	.string	"PRIoPTR __PRIPTR_PREFIX \"o\""
+.LASF723:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF415:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1342:
+	.ascii	"munit_assert_double_equal(a,b,precision) do { const double m"
+	.ascii	"unit_tmp_a_ = (a); const double munit_tmp_b_ = (b); const do"
+	.ascii	"uble munit_tmp_diff_ = ((munit_tmp_a_ - munit_tmp_b_) < 0) ?"
+	.ascii	" -(munit_tmp_a_ - munit_tmp_b_) : (munit_tmp_a_ - munit_tmp_"
+	.ascii	"b_)"
+	.string	"; if (MUNIT_UNLIKELY(munit_tmp_diff_ > 1e- ##precision)) { munit_errorf(\"assertion failed: %s == %s (%0.\" #precision \"g == %0.\" #precision \"g)\", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF792:
+	.string	"__timer_t_defined 1"
+.LASF1106:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1064:
+	.string	"MUNIT_CURRENT_VERSION MUNIT_VERSION(0, 4, 1)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1378:
+	.string	"__need___va_list "
+.LASF1215:
+	.string	"PRIXFAST32 __PRIPTR_PREFIX \"X\""
+.LASF1698:
+	.string	"_yp_collect_stats_t"
+.LASF1037:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1575:
+	.string	"INCREMENTAL_RESIZE_LEN 16"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1459:
+	.string	"_STRINGIFY33(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F,G) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F, #G"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1399:
+	.string	"SEEK_END 2"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF852:
+	.string	"____sigset_t_defined "
+.LASF816:
+	.string	"_ENDIAN_H 1"
+.LASF380:
+	.string	"MUNIT_TEST_NAME_LEN 58"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF701:
+	.string	"_ANSI_STDARG_H_ "
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1128:
+	.string	"UINT32_C(c) c ## U"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1836:
+	.string	"other"
+.LASF1793:
+	.string	"yp_iter"
+.LASF1082:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1146:
+	.string	"PRId16 \"d\""
+.LASF1737:
+	.string	"peers"
+.LASF924:
+	.string	"_yp_IMMORTAL_HEAD_INIT(type,type_flags,len,data) {(type), 0, (type_flags), _ypObject_REFCNT_IMMORTAL, (len), _ypObject_LEN_INVALID, _ypObject_HASH_INVALID, (data)}"
+.LASF1748:
+	.string	"is_string"
+.LASF1722:
+	.string	"test"
+.LASF1155:
+	.string	"PRIdFAST32 __PRIPTR_PREFIX \"d\""
+.LASF1441:
+	.string	"_STRINGIFY15(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o"
+.LASF709:
+	.string	"_VA_LIST_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF819:
+	.string	"__BIG_ENDIAN 4321"
+.LASF661:
+	.string	"CHARCLASS_NAME_MAX 2048"
+.LASF895:
+	.string	"ypAPI extern __attribute__((visibility(\"default\")))"
+.LASF1450:
+	.string	"_STRINGIFY24(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x"
+.LASF1792:
+	.string	"yp_floatCF"
+.LASF1039:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1125:
+	.string	"INT64_C(c) c ## L"
+.LASF659:
+	.string	"EXPR_NEST_MAX _POSIX2_EXPR_NEST_MAX"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1817:
+	.string	"yp_append"
+.LASF1062:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1470:
+	.string	"_COMMA_REPEAT10(x) x, x, x, x, x, x, x, x, x, x"
+.LASF729:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF773:
+	.string	"_BITS_TIME64_H 1"
+.LASF885:
+	.string	"__ONCE_ALIGNMENT "
+.LASF932:
+	.string	"yp_IMMORTAL_INT_static(name,value) _yp_IMMORTAL_INT(static, name, value)"
+.LASF1101:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1235:
+	.string	"SCNdLEAST32 \"d\""
+.LASF1270:
+	.string	"SCNoLEAST16 \"ho\""
+.LASF1325:
+	.string	"munit_assert_uint(a,op,b) munit_assert_type(unsigned int, \"u\", a, op, b)"
+.LASF753:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1449:
+	.string	"_STRINGIFY23(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w"
+.LASF694:
+	.string	"ULONG_MAX (LONG_MAX * 2UL + 1UL)"
+.LASF1005:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1660:
+	.string	"__size"
+.LASF1746:
+	.string	"is_collection"
+.LASF1873:
+	.string	"test_malloc_thread_exit"
+.LASF1882:
+	.string	"size"
+.LASF568:
+	.string	"MB_LEN_MAX 16"
+.LASF1411:
+	.string	"__attr_dealloc_fclose"
+.LASF417:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF815:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1320:
+	.string	"munit_assert_char(a,op,b) munit_assert_type_full(\"'\\\\x\", \"'\", char, \"02\" MUNIT_CHAR_MODIFIER \"x\", a, op, b)"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1157:
+	.string	"PRIi8 \"i\""
+.LASF717:
+	.string	"__U16_TYPE unsigned short int"
+.LASF655:
+	.string	"BC_DIM_MAX _POSIX2_BC_DIM_MAX"
+.LASF838:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1826:
+	.string	"after"
+.LASF1558:
+	.ascii	"_assert_setlike(obj,items,obj_fmt,item_strs,...) do { yp_ssi"
+	.ascii	"ze_t _ypmt_SET_n = yp_lengthof_array(items); int _ypmt_SET_f"
+	.ascii	"ound[yp_lengthof_array(items)] = {0}; yp_uint64_t _ypmt_SET_"
+	.ascii	"mi_state; ypObject *_ypmt_SET_mi; ypObject *_ypmt_SET_actual"
+	.ascii	"; yp_ssize_t _ypmt_SET_i; _assert_len(obj, _ypmt_SET_n, obj_"
+	.ascii	"fmt, \"%\" PRIssize, __VA_ARGS__, _ypmt_SET_n); _assert_not_"
+	.ascii	"raises(_ypmt_SET_mi = yp_miniiter(obj, &_ypmt_SET_mi_state),"
+	.ascii	" \"yp_miniiter(\" obj_fmt \", &mi_state)\", __VA_ARGS__); wh"
+	.ascii	"ile (_assert_setlike_helper(_ypmt_SET_mi, &_ypmt_SET_mi_stat"
+	.ascii	"e, _ypmt_SET_n, items, &_ypmt_SET_actual , &_ypmt_SET_i)) { "
+	.ascii	"_assert_not_exception(_ypmt_SET_actual, \"yp_miniiter_next(y"
+	.ascii	"p_miniiter(\" obj_fmt \", &mi_state), &mi_state)\", __VA_ARG"
+	.ascii	"S__); if (_ypmt_SET_i >= _ypmt_SET_n) { munit_errorf(\"unexp"
+	.ascii	"ected item yielded from \" obj_fmt, __VA_ARGS__); } if (_ypm"
+	.ascii	"t_SET_found[_ypmt_SET_i]) { munit_errorf( \"%s yielded twice"
+	.ascii	" from \" obj_fmt, item_strs[_ypmt_SET_i], __VA_ARGS__); } _y"
+	.ascii	"pmt_SET_found[_ypmt_SET_i] = TRUE; _assert_same_type(_ypmt_S"
+	.ascii	"ET_actual, items[_ypmt_SET_i], \"<item in \" obj_fmt \">\", "
+	.ascii	"\"%s\", __VA_ARGS__, item_strs[_ypmt_SET_i]); y"
+	.string	"p_decref(_ypmt_SET_actual); } for (_ypmt_SET_i = 0; _ypmt_SET_i < _ypmt_SET_n; _ypmt_SET_i++) { if (!_ypmt_SET_found[_ypmt_SET_i]) { munit_errorf(\"%s not yielded from \" obj_fmt, item_strs[_ypmt_SET_i], __VA_ARGS__); } } yp_decref(_ypmt_SET_mi); } while (0)"
+.LASF1511:
+	.string	"assert_false(expr) munit_assert_false(expr)"
+.LASF1431:
+	.string	"_STRINGIFY5(a,b,c,d,e) #a, #b, #c, #d, #e"
+.LASF1419:
+	.string	"FALSE (0 == 1)"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1279:
+	.string	"SCNx32 \"x\""
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1878:
+	.string	"test_malloc_resize"
+.LASF1383:
+	.string	"__FILE_defined 1"
+.LASF1034:
+	.string	"__HAVE_FLOAT64 1"
+.LASF808:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF592:
+	.string	"_POSIX_SEM_NSEMS_MAX 256"
+.LASF897:
+	.string	"yp_SSIZE_T_MIN (-yp_SSIZE_T_MAX - 1)"
+.LASF803:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1635:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1855:
+	.string	"_ypmt_LEN_obj"
+.LASF1657:
+	.string	"size_t"
+.LASF1471:
+	.string	"_COMMA_REPEAT11(x) x, x, x, x, x, x, x, x, x, x, x"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1452:
+	.string	"_STRINGIFY26(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z"
+.LASF827:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF392:
+	.string	"unittest_snprintf snprintf"
+.LASF1139:
+	.string	"munit_int64_t int64_t"
+.LASF755:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1501:
+	.string	"yp_offsetof(structType,member) ((yp_ssize_t)offsetof(structType, member))"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1877:
+	.string	"newactual"
+.LASF721:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF993:
+	.string	"NULL"
+.LASF1528:
+	.string	"_assert_raises(statement,n,expected,statement_fmt,expected_fmt,...) do { ypObject *_ypmt_RAISES_statement = statement; _assert_isexception( _ypmt_RAISES_statement, n, expected, statement_fmt, expected_fmt, __VA_ARGS__); } while (0)"
+.LASF1263:
+	.string	"SCNuFAST32 __PRIPTR_PREFIX \"u\""
+.LASF656:
+	.string	"BC_SCALE_MAX _POSIX2_BC_SCALE_MAX"
+.LASF886:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF397:
+	.string	"_LIBC_LIMITS_H_ 1"
+.LASF901:
+	.string	"yp_SLICE_LAST yp_SSIZE_T_MAX"
+.LASF1862:
+	.string	"unused"
+.LASF409:
+	.string	"__USE_XOPEN"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1846:
+	.string	"_ypmt_TYPEC_excs"
+.LASF432:
+	.string	"_DEFAULT_SOURCE"
+.LASF381:
+	.string	"MUNIT_NO_BUFFER 1"
+.LASF431:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1440:
+	.string	"_STRINGIFY14(a,b,c,d,e,f,g,h,i,j,k,l,m,n) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n"
+.LASF778:
+	.string	"__dev_t_defined "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1425:
+	.ascii	"_PP_ARG_N(prefix,_1,_2,_3,_4,_5,_"
+	.string	"6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66,n,...) prefix ##n"
+.LASF837:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF903:
+	.string	"yp_HASH_ALGORITHM_SIPHASH13 (1)"
+.LASF608:
+	.string	"NR_OPEN 1024"
+.LASF1844:
+	.string	"_ypmt_TYPE_type_a"
+.LASF1845:
+	.string	"_ypmt_TYPE_type_b"
+.LASF1579:
+	.string	"reuse_COUNT"
+.LASF734:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1163:
+	.string	"PRIiLEAST32 \"i\""
+.LASF1016:
+	.string	"__WCOREFLAG 0x80"
+.LASF1118:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF898:
+	.string	"yp_INT_T_MAX LLONG_MAX"
+.LASF1564:
+	.ascii	"_faulty_iter_test_raises(setup,iter_name,iter_expression,sta"
+	.ascii	"tement,tear_down,test_name,exc_suffix,expected,statement_str"
+	.ascii	") do { ypObject *_ypmt_FLT_ITR_expecte"
+	.string	"d[] = {expected}; ypObject *iter_name; UNPACK setup; iter_name = iter_expression; _assert_raises ##exc_suffix(statement, 1, _ypmt_FLT_ITR_expected, \"%s /*\" test_name \"*/\", \"%s\", statement_str, #expected); yp_decref(iter_name); UNPACK tear_down; } while (0)"
+.LASF1241:
+	.string	"SCNi8 \"hhi\""
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF965:
+	.string	"yp_ENDFOR } } yp_decref(_yp_FOR_iter); }"
+.LASF693:
+	.string	"ULONG_MAX"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF957:
+	.string	"yp_ENDWHILE } }"
+.LASF793:
+	.string	"__need_size_t "
+.LASF704:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1464:
+	.string	"_COMMA_REPEAT4(x) x, x, x, x"
+.LASF960:
+	.string	"yp_FORd(target,expression) _yp_FOR(target, expression, yp_decref(_yp_FOR_expr))"
+.LASF887:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF994:
+	.string	"NULL ((void *)0)"
+.LASF1803:
+	.string	"yp_eq"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF790:
+	.string	"__clockid_t_defined 1"
+.LASF991:
+	.string	"_BSD_WCHAR_T_"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1030:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF801:
+	.string	"_SIZE_T_ "
+.LASF760:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1594:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1286:
+	.string	"SCNxFAST16 __PRIPTR_PREFIX \"x\""
+.LASF812:
+	.string	"__need_size_t"
+.LASF1352:
+	.string	"munit_assert_ptr_not_equal(a,b) munit_assert_ptr(a, !=, b)"
+.LASF1851:
+	.string	"first"
+.LASF1374:
+	.string	"__need_ptrdiff_t"
+.LASF830:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1621:
+	.string	"TIME_UTC 1"
+.LASF1216:
+	.string	"PRIXFAST64 __PRI64_PREFIX \"X\""
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1666:
+	.string	"ob_flags"
+.LASF686:
+	.string	"INT_MAX __INT_MAX__"
+.LASF1315:
+	.string	"munit_assert(expr) do { if (!MUNIT_LIKELY(expr)) { munit_error(\"assertion failed: \" #expr); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF393:
+	.string	"yp_FUTURE "
+.LASF1361:
+	.string	"_STDDEF_H "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1116:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1641:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1719:
+	.string	"MunitTestFunc"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1816:
+	.string	"yp_isexceptionC"
+.LASF1132:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF832:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1618:
+	.string	"TIMER_ABSTIME 1"
+.LASF1131:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF411:
+	.string	"__USE_UNIX98"
+.LASF1203:
+	.string	"PRIxFAST32 __PRIPTR_PREFIX \"x\""
+.LASF1734:
+	.string	"pair"
+.LASF913:
+	.string	"_ypStringLib_ENC_CODE_BYTES (0u)"
+.LASF1454:
+	.string	"_STRINGIFY28(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B"
+.LASF1864:
+	.string	"items"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF614:
+	.string	"NAME_MAX 255"
+.LASF739:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1551:
+	.ascii	"ass"
+	.string	"ert_same_type(a,b) do { ypObject *_ypmt_TYPE_a = (a); ypObject *_ypmt_TYPE_b = (b); _assert_not_exception(_ypmt_TYPE_a, \"%s\", #a); _assert_not_exception(_ypmt_TYPE_b, \"%s\", #b); _assert_same_type(_ypmt_TYPE_a, _ypmt_TYPE_b, \"%s\", \"%s\", #a, #b); } while (0)"
+.LASF1019:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1260:
+	.string	"SCNuLEAST64 __PRI64_PREFIX \"u\""
+.LASF1679:
+	.string	"yp_float64_t"
+.LASF1273:
+	.string	"SCNoFAST8 \"hho\""
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF604:
+	.string	"__undef_LINK_MAX "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF767:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF961:
+	.string	"yp_FOR_return(expression) return yp_decref(_yp_FOR_iter), (expression)"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1355:
+	.string	"munit_assert_ptr_null(ptr) munit_assert_ptr(ptr, ==, NULL)"
+.LASF624:
+	.string	"__undef_LINK_MAX"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1259:
+	.string	"SCNuLEAST32 \"u\""
+.LASF1479:
+	.string	"_COMMA_REPEAT19(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1083:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1129:
+	.string	"UINT64_C(c) c ## UL"
+.LASF769:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF697:
+	.string	"LLONG_MAX"
+.LASF1224:
+	.string	"PRIiPTR __PRIPTR_PREFIX \"i\""
+.LASF1029:
+	.string	"__f128(x) x ##f128"
+.LASF870:
+	.string	"__fsblkcnt_t_defined "
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1084:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF951:
+	.string	"_yp_WHILE(expression,decref_expression) { ypObject *_yp_WHILE_expr; ypObject *_yp_WHILE_cond; while(_yp_WHILE_expr = (expression), _yp_WHILE_cond = yp_bool(_yp_WHILE_expr), decref_expression, _yp_WHILE_cond == yp_True) {"
+.LASF692:
+	.string	"LONG_MAX __LONG_MAX__"
+.LASF1707:
+	.string	"MUNIT_SKIP"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF825:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF703:
+	.string	"__GNUC_VA_LIST "
+.LASF1697:
+	.string	"_ypObject"
+.LASF1830:
+	.string	"munit_tmp_a_"
+.LASF1631:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF627:
+	.string	"ARG_MAX"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1640:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1713:
+	.string	"value"
+.LASF871:
+	.string	"__fsfilcnt_t_defined "
+.LASF1686:
+	.string	"yp_False"
+.LASF996:
+	.string	"WNOHANG 1"
+.LASF1357:
+	.string	"munit_malloc(size) munit_malloc_ex(__FILE__, __LINE__, (size))"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1548:
+	.string	"_assert_type_is(obj,expected,obj_fmt,expected_fmt,...) do { ypObject *_ypmt_TYPE_type_obj = yp_type(obj); _assert_ptr(_ypmt_TYPE_type_obj, ==, expected, \"yp_type(\" obj_fmt \")\", expected_fmt, __VA_ARGS__); } while (0)"
+.LASF1297:
+	.string	"SCNuPTR __PRIPTR_PREFIX \"u\""
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1244:
+	.string	"SCNi64 __PRI64_PREFIX \"i\""
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1053:
+	.string	"__ldiv_t_defined 1"
+.LASF389:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF571:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1)"
+.LASF611:
+	.string	"LINK_MAX 127"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF967:
+	.string	"yp2(self,method,a1) yp_ ##method(self, a1)"
+.LASF1613:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1583:
+	.string	"SCHED_OTHER 0"
+.LASF1394:
+	.string	"_IONBF 2"
+.LASF649:
+	.string	"_POSIX2_COLL_WEIGHTS_MAX 2"
+.LASF1570:
+	.ascii	"define_function(name,code,parameters) yp_pa"
+	.string	"rameter_decl_t _ ##name ##_parameters[] = {UNPACK parameters}; yp_function_decl_t _ ##name ##_declaration = { (code), 0, yp_lengthof_array(_ ##name ##_parameters), _ ##name ##_parameters, NULL, NULL}; ypObject *name = yp_functionC(&_ ##name ##_declaration)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1463:
+	.string	"_COMMA_REPEAT3(x) x, x, x"
+.LASF1474:
+	.string	"_COMMA_REPEAT14(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1565:
+	.ascii	"_faulty_iter_test_succeeds(setup,iter_name,iter_expression,s"
+	.ascii	"tatement,assertion,tear_down,t"
+	.string	"est_name,exc_suffix,statement_str) do { ypObject *iter_name; UNPACK setup; iter_name = iter_expression; _assert_not_raises ##exc_suffix(statement, \"%s /*\" test_name \"*/\", statement_str); UNPACK assertion; yp_decref(iter_name); UNPACK tear_down; } while (0)"
+.LASF1831:
+	.string	"munit_tmp_b_"
+.LASF1813:
+	.string	"yp_collect"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1093:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1134:
+	.string	"munit_uint8_t uint8_t"
+.LASF1403:
+	.string	"TMP_MAX 238328"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1758:
+	.string	"objobjfunc"
+.LASF998:
+	.string	"WSTOPPED 2"
+.LASF1805:
+	.string	"yp_lenC"
+.LASF1582:
+	.string	"_BITS_SCHED_H 1"
+.LASF868:
+	.string	"__blksize_t_defined "
+.LASF1655:
+	.string	"__ssize_t"
+.LASF929:
+	.string	"yp_IMMORTAL_INT(name,value) _yp_IMMORTAL_INT(, name, value)"
+.LASF691:
+	.string	"LONG_MAX"
+.LASF1477:
+	.string	"_COMMA_REPEAT17(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF999:
+	.string	"WEXITED 4"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF690:
+	.string	"LONG_MIN (-LONG_MAX - 1L)"
+.LASF1512:
+	.string	"assert_ptr(a,op,b) munit_assert_ptr(a, op, b)"
+.LASF466:
+	.string	"__PMT"
+.LASF989:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1578:
+	.string	"reuse_COUNT 1000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1433:
+	.string	"_STRINGIFY7(a,b,c,d,e,f,g) #a, #b, #c, #d, #e, #f, #g"
+.LASF884:
+	.string	"__LOCK_ALIGNMENT "
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1747:
+	.string	"is_sequence"
+.LASF1892:
+	.string	"uniqueness_new"
+.LASF385:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1299:
+	.string	"munit_bool _Bool"
+.LASF861:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF613:
+	.string	"MAX_INPUT 255"
+.LASF1519:
+	.string	"assert_not_exception(obj) do { ypObject *_ypmt_NOT_EXC_obj = (obj); _assert_not_exception(_ypmt_NOT_EXC_obj, \"%s\", #obj); } while (0)"
+.LASF1130:
+	.string	"INTMAX_C(c) c ## L"
+.LASF628:
+	.string	"__undef_ARG_MAX"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1347:
+	.ascii	"munit_assert_string_equal(a,b) do { const char* munit_tmp_a_"
+	.ascii	" = a; const char* munit"
+	.string	"_tmp_b_ = b; if (MUNIT_UNLIKELY(strcmp(munit_tmp_a_, munit_tmp_b_) != 0)) { munit_errorf(\"assertion failed: string %s == %s (\\\"%s\\\" == \\\"%s\\\")\", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF641:
+	.string	"MQ_PRIO_MAX 32768"
+.LASF1708:
+	.string	"MUNIT_ERROR"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1027:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1731:
+	.string	"_fixture_type_t"
+.LASF1266:
+	.string	"SCNo16 \"ho\""
+.LASF1267:
+	.string	"SCNo32 \"o\""
+.LASF783:
+	.string	"__off_t_defined "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1532:
+	.ascii	"_assert_typeC_exc(T,a_statement,op,b_statement,val_pri,a_fmt"
+	.ascii	",b_fmt,...) do "
+	.string	"{ T _ypmt_TYPEC_a; T _ypmt_TYPEC_b; _assert_not_raises_exc(_ypmt_TYPEC_a = (a_statement); _ypmt_TYPEC_b = (b_statement), a_fmt \" \" #op \" \" b_fmt, __VA_ARGS__); _assert_typeC(_ypmt_TYPEC_a, op, _ypmt_TYPEC_b, val_pri, a_fmt, b_fmt, __VA_ARGS__); } while (0)"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1689:
+	.string	"yp_t_int"
+.LASF1000:
+	.string	"WCONTINUED 8"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF977:
+	.string	"_WCHAR_T "
+.LASF720:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF695:
+	.string	"LLONG_MIN"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF652:
+	.string	"_POSIX2_RE_DUP_MAX 255"
+.LASF1269:
+	.string	"SCNoLEAST8 \"hho\""
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1776:
+	.string	"allocation_sizes"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1524:
+	.string	"assert_not_raises_exc(statement) _assert_not_raises_exc((statement), \"%s\", #statement)"
+.LASF1097:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF647:
+	.string	"_POSIX2_BC_SCALE_MAX 99"
+.LASF1077:
+	.string	"INT32_MAX (2147483647)"
+.LASF1487:
+	.string	"_COMMA_REPEAT27(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1615:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF981:
+	.string	"_WCHAR_T_ "
+.LASF1735:
+	.string	"_new_rand"
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF605:
+	.string	"__undef_OPEN_MAX "
+.LASF1616:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF953:
+	.string	"yp_WHILEd(expression) _yp_WHILE(expression, yp_decref(_yp_WHILE_expr))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1288:
+	.string	"SCNxFAST64 __PRI64_PREFIX \"x\""
+.LASF1602:
+	.string	"sched_priority sched_priority"
+.LASF1043:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF574:
+	.string	"_POSIX_AIO_MAX 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1109:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1087:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1624:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF797:
+	.string	"_SYS_SIZE_T_H "
+.LASF745:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1777:
+	.string	"memset"
+.LASF1497:
+	.string	"K(...) (VA_ARGC(__VA_ARGS__) / 2), __VA_ARGS__"
+.LASF609:
+	.string	"NGROUPS_MAX 65536"
+.LASF1801:
+	.string	"yp_isexception_arrayC"
+.LASF1339:
+	.string	"munit_assert_uint32(a,op,b) munit_assert_type(munit_uint32_t, PRIu32, a, op, b)"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1387:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF587:
+	.string	"_POSIX_OPEN_MAX 20"
+.LASF707:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1204:
+	.string	"PRIxFAST64 __PRI64_PREFIX \"x\""
+.LASF1195:
+	.string	"PRIx32 \"x\""
+.LASF943:
+	.string	"yp_IFd(expression) _yp_IF(expression, yp_decref(_yp_IF_expr))"
+.LASF1680:
+	.string	"yp_ssize_t"
+.LASF1710:
+	.string	"name"
+.LASF906:
+	.string	"_yp_UNPACK(...) __VA_ARGS__"
+.LASF423:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1634:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF573:
+	.string	"_POSIX_AIO_LISTIO_MAX 2"
+.LASF1550:
+	.string	"_assert_same_type(a,b,a_fmt,b_fmt,...) do { ypObject *_ypmt_TYPE_type_a = yp_type(a); ypObject *_ypmt_TYPE_type_b = yp_type(b); _assert_ptr(_ypmt_TYPE_type_a, ==, _ypmt_TYPE_type_b, \"yp_type(\" a_fmt \")\", \"yp_type(\" b_fmt \")\", __VA_ARGS__); } while (0)"
+.LASF588:
+	.string	"_POSIX_PATH_MAX 256"
+.LASF856:
+	.string	"__suseconds_t_defined "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1114:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF756:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1137:
+	.string	"munit_int32_t int32_t"
+.LASF873:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1205:
+	.string	"PRIX8 \"X\""
+.LASF1465:
+	.string	"_COMMA_REPEAT5(x) x, x, x, x, x"
+.LASF865:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1390:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF1426:
+	.string	"_PP_RSEQ_N() 66,65,64,63,62,61,60, 59,58,57,56,55,54,53,52,51,50, 49,48,47,46,45,44,43,42,41,40, 39,38,37,36,35,34,33,32,31,30, 29,28,27,26,25,24,23,22,21,20, 19,18,17,16,15,14,13,12,11,10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0"
+.LASF414:
+	.string	"__USE_XOPEN2K8"
+.LASF1117:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF848:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF757:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF813:
+	.string	"__need_NULL"
+.LASF1375:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF920:
+	.string	"_ypStr_CODE (18u)"
+.LASF1276:
+	.string	"SCNoFAST64 __PRI64_PREFIX \"o\""
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1247:
+	.string	"SCNiLEAST32 \"i\""
+.LASF416:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1210:
+	.string	"PRIXLEAST16 \"X\""
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1767:
+	.string	"fixture_t"
+.LASF911:
+	.string	"_ypObject_HASH_INVALID ((yp_hash_t) - 1)"
+.LASF1242:
+	.string	"SCNi16 \"hi\""
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF1804:
+	.string	"yp_getindexC"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1520:
+	.string	"_ypmt_error_exception(exc,non_exc_fmt,obj_fmt,...) do { _assert_not_exception(exc, obj_fmt, __VA_ARGS__); munit_errorf(non_exc_fmt \": \" obj_fmt, __VA_ARGS__); } while (0)"
+.LASF1255:
+	.string	"SCNu32 \"u\""
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1180:
+	.string	"PRIoFAST64 __PRI64_PREFIX \"o\""
+.LASF581:
+	.string	"_POSIX_MAX_CANON 255"
+.LASF1608:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1381:
+	.string	"_____fpos64_t_defined 1"
+.LASF1402:
+	.string	"L_tmpnam 20"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1174:
+	.string	"PRIoLEAST16 \"o\""
+.LASF1457:
+	.string	"_STRINGIFY31(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E"
+.LASF1587:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF1841:
+	.string	"_ypmt_LEN_actual"
+.LASF391:
+	.string	"yp_MUNIT_TEST_UNITTEST_H "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1880:
+	.string	"_test_malloc_resize"
+.LASF1283:
+	.string	"SCNxLEAST32 \"x\""
+.LASF904:
+	.string	"yp_HASH_ALGORITHM_WYHASH (2)"
+.LASF1669:
+	.string	"ob_len"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF742:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1167:
+	.string	"PRIiFAST32 __PRIPTR_PREFIX \"i\""
+.LASF899:
+	.string	"yp_INT_T_MIN LLONG_MIN"
+.LASF1249:
+	.string	"SCNiFAST8 \"hhi\""
+.LASF1343:
+	.string	"_STRING_H 1"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1650:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF923:
+	.string	"yp_CONST_REF _yp_CONST_REF"
+.LASF1651:
+	.string	"signed char"
+.LASF1044:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1294:
+	.string	"SCNdPTR __PRIPTR_PREFIX \"d\""
+.LASF1790:
+	.string	"yp_hashC"
+.LASF949:
+	.string	"yp_ELSE_EXCEPT_AS(target) yp_ELSE_EXCEPT ypObject *target = _yp_IF_cond;"
+.LASF601:
+	.string	"_POSIX_TZNAME_MAX 6"
+.LASF1179:
+	.string	"PRIoFAST32 __PRIPTR_PREFIX \"o\""
+.LASF833:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF794:
+	.string	"__size_t__ "
+.LASF1482:
+	.string	"_COMMA_REPEAT22(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1561:
+	.string	"assert_mapping(obj,...) do { ypObject *_ypmt_MAP_obj = (obj); ypObject *_ypmt_MAP_items[] = {__VA_ARGS__}; char *_ypmt_MAP_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_mapping(_ypmt_MAP_obj, _ypmt_MAP_items, \"%s\", _ypmt_MAP_item_strs, #obj); } while (0)"
+.LASF1006:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF985:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1191:
+	.string	"PRIuFAST32 __PRIPTR_PREFIX \"u\""
+.LASF791:
+	.string	"__time_t_defined 1"
+.LASF840:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF864:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF1396:
+	.string	"EOF (-1)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF777:
+	.string	"__ino_t_defined "
+.LASF1496:
+	.string	"N(...) VA_ARGC(__VA_ARGS__), __VA_ARGS__"
+.LASF1111:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF902:
+	.string	"yp_HASH_ALGORITHM_DEFAULT (0)"
+.LASF1807:
+	.string	"yp_setindexC"
+.LASF1177:
+	.string	"PRIoFAST8 \"o\""
+.LASF1893:
+	.string	"test_memory_initialize"
+.LASF1296:
+	.string	"SCNoPTR __PRIPTR_PREFIX \"o\""
+.LASF893:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1187:
+	.string	"PRIuLEAST32 \"u\""
+.LASF400:
+	.string	"_FEATURES_H 1"
+.LASF1046:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1333:
+	.string	"munit_assert_ptr(a,op,b) munit_assert_type(const void*, \"p\", a, op, b)"
+.LASF802:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1643:
+	.string	"__cleanup_fct_attribute "
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1891:
+	.string	"GNU C17 12.2.0 -m64 -mtune=generic -march=x86-64 -g3 -Og -fvisibility=hidden -ftrapv -fstack-clash-protection -fno-omit-frame-pointer -fasynchronous-unwind-tables"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF872:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF738:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1004:
+	.string	"__WCLONE 0x80000000"
+.LASF1730:
+	.string	"fixture_type_t"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF867:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1206:
+	.string	"PRIX16 \"X\""
+.LASF1020:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1569:
+	.ascii	"sprintf_array(array,fmt,..."
+	.string	") do { yp_ssize_t _ypmt_SPRINTF_len = yp_lengthof_array(array); yp_ssize_t result = (yp_ssize_t)unittest_snprintf( (array), (size_t)_ypmt_SPRINTF_len, fmt, __VA_ARGS__); assert_ssizeC(result, >=, 0); assert_ssizeC(result, <, _ypmt_SPRINTF_len); } while (0)"
+.LASF743:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1035:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1142:
+	.string	"____gwchar_t_defined 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1420:
+	.string	"yp_ARCH_64_BIT 1"
+.LASF971:
+	.string	"yp5(self,method,a1,a2,a3,a4) yp_ ##method(self, a1, a2, a3, a4)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1774:
+	.string	"allocator_default"
+.LASF1622:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF1796:
+	.string	"yp_bytesC"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1828:
+	.string	"_ypmt_TYPEC_a"
+.LASF1829:
+	.string	"_ypmt_TYPEC_b"
+.LASF1545:
+	.string	"yp_is_not(a,b) ((a) != (b) ? yp_True : yp_False)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF735:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1847:
+	.string	"_ypmt_TYPEC_n"
+.LASF1363:
+	.string	"_ANSI_STDDEF_H "
+.LASF1699:
+	.string	"collections"
+.LASF1791:
+	.string	"rand_obj_any_hashable"
+.LASF620:
+	.string	"RTSIG_MAX 32"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF969:
+	.string	"yp3(self,method,a1,a2) yp_ ##method(self, a1, a2)"
+.LASF1280:
+	.string	"SCNx64 __PRI64_PREFIX \"x\""
+.LASF689:
+	.string	"LONG_MIN"
+.LASF1141:
+	.string	"_INTTYPES_H 1"
+.LASF1860:
+	.string	"test_freelists_thread_exit"
+.LASF918:
+	.string	"_ypInt_CODE (10u)"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1135:
+	.string	"munit_int16_t int16_t"
+.LASF583:
+	.string	"_POSIX_MQ_OPEN_MAX 8"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1499:
+	.string	"UNPACK(...) __VA_ARGS__"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1140:
+	.string	"munit_uint64_t uint64_t"
+.LASF1508:
+	.string	"_assert_typeC(a,op,b,val_pri,a_fmt,b_fmt,...) do { if (!(a op b)) { munit_errorf(\"assertion failed: \" a_fmt \" \" #op \" \" b_fmt \" (%\" val_pri \" \" #op \" %\" val_pri \") \", __VA_ARGS__, a, b); } } while (0)"
+.LASF1455:
+	.string	"_STRINGIFY29(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1098:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1786:
+	.string	"yp_next"
+.LASF1023:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF788:
+	.string	"__key_t_defined "
+.LASF1045:
+	.string	"__f32(x) x ##f32"
+.LASF1353:
+	.string	"munit_assert_null(ptr) munit_assert_ptr(ptr, ==, NULL)"
+.LASF737:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1695:
+	.string	"yp_TypeError"
+.LASF1398:
+	.string	"SEEK_CUR 1"
+.LASF1133:
+	.string	"munit_int8_t int8_t"
+.LASF835:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF736:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1462:
+	.string	"_COMMA_REPEAT2(x) x, x"
+.LASF406:
+	.string	"__USE_POSIX2"
+.LASF824:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF934:
+	.string	"yp_IMMORTAL_STR_LATIN_1_static(name,value) _yp_IMMORTAL_STR_LATIN_1(static, name, value)"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF595:
+	.string	"_POSIX_SSIZE_MAX 32767"
+.LASF1481:
+	.string	"_COMMA_REPEAT21(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1407:
+	.string	"FOPEN_MAX 16"
+.LASF1840:
+	.string	"_ypmt_SEQ_i"
+.LASF726:
+	.string	"__SLONG32_TYPE int"
+.LASF1257:
+	.string	"SCNuLEAST8 \"hhu\""
+.LASF937:
+	.string	"yp_IMMORTAL_FUNCTION(name,code,parameters) _yp_IMMORTAL_FUNCTION(, name, code, parameters)"
+.LASF1625:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF1839:
+	.string	"_ypmt_SEQ_n"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1075:
+	.string	"INT8_MAX (127)"
+.LASF653:
+	.string	"_POSIX2_CHARCLASS_NAME_MAX 14"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1081:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1460:
+	.string	"_STRINGIFY34(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F,G,H) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F, #G, #H"
+.LASF1230:
+	.string	"SCNd16 \"hd\""
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1687:
+	.string	"yp_i_one"
+.LASF1200:
+	.string	"PRIxLEAST64 __PRI64_PREFIX \"x\""
+.LASF939:
+	.string	"yp_IMMORTAL_FUNCTION2(name,code) _yp_IMMORTAL_FUNCTION5(, name, code, 0, NULL)"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF404:
+	.string	"__USE_ISOCXX11"
+.LASF1173:
+	.string	"PRIoLEAST8 \"o\""
+.LASF1169:
+	.string	"PRIo8 \"o\""
+.LASF1389:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1513:
+	.string	"assert_null(ptr) munit_assert_null(ptr)"
+.LASF430:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1071:
+	.string	"INT8_MIN (-128)"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1079:
+	.string	"UINT8_MAX (255)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1301:
+	.string	"MUNIT_UNLIKELY(expr) (__builtin_expect ((expr), 0))"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1408:
+	.string	"stdin stdin"
+.LASF1159:
+	.string	"PRIi32 \"i\""
+.LASF1239:
+	.string	"SCNdFAST32 __PRIPTR_PREFIX \"d\""
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1664:
+	.string	"ypObject"
+.LASF1421:
+	.string	"PRIint \"lld\""
+.LASF877:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1351:
+	.string	"munit_assert_ptr_equal(a,b) munit_assert_ptr(a, ==, b)"
+.LASF1368:
+	.string	"_PTRDIFF_T_ "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1088:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1759:
+	.string	"objvarargfunc"
+.LASF1611:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF1533:
+	.string	"assert_intC_exc(a,op,b) _assert_typeC_exc(yp_int_t, a, op, b, PRIint, \"%s\", \"%s\", #a, #b)"
+.LASF909:
+	.string	"_yp_INLINE_DATA(elemType) elemType ob_inline_data[]"
+.LASF1246:
+	.string	"SCNiLEAST16 \"hi\""
+.LASF1367:
+	.string	"__PTRDIFF_T "
+.LASF669:
+	.string	"SCHAR_MAX"
+.LASF855:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF387:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1057:
+	.string	"EXIT_SUCCESS 0"
+.LASF1194:
+	.string	"PRIx16 \"x\""
+.LASF1597:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1184:
+	.string	"PRIu64 __PRI64_PREFIX \"u\""
+.LASF1820:
+	.string	"yp_collect_stats"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF958:
+	.ascii	"_yp_FOR(target,expression,decref_expression) { yp_uint64_t _"
+	.ascii	"yp_FOR_state; ypObject *_yp_FOR_item; int _yp_FOR_iter_exhau"
+	.ascii	"sted = 0; ypObject *_yp_FOR_expr = (expression); ypObject *_"
+	.ascii	"yp_FOR_iter = yp_miniiter(_yp_FOR_expr, &_yp_FOR_state); dec"
+	.ascii	"ref_expression; while(1) { _yp_FOR_item = yp_"
+	.string	"miniiter_next(&_yp_FOR_iter, &_yp_FOR_state); if(yp_isexceptionC(_yp_FOR_item)) { if(yp_isexceptionC(_yp_FOR_iter)) break; if(yp_isexceptionC2(_yp_FOR_item, yp_StopIteration)) _yp_FOR_iter_exhausted = 1; break; } yp_decref(target); target = _yp_FOR_item; {"
+.LASF759:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF719:
+	.string	"__U32_TYPE unsigned int"
+.LASF1502:
+	.string	"yp_sizeof_member(structType,member) yp_sizeof(((structType *)0)->member)"
+.LASF1535:
+	.string	"assert_hashC_exc(a,op,b) _assert_typeC_exc(yp_hash_t, a, op, b, PRIssize, \"%s\", \"%s\", #a, #b)"
+.LASF1429:
+	.string	"_STRINGIFY3(a,b,c) #a, #b, #c"
+.LASF1252:
+	.string	"SCNiFAST64 __PRI64_PREFIX \"i\""
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF591:
+	.string	"_POSIX_RTSIG_MAX 8"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1822:
+	.string	"fixture_setup"
+.LASF1554:
+	.ascii	"_assert_len(obj,expected,obj_fmt,expected_fmt,...) do { yp_s"
+	.ascii	"size_t _ypmt_LEN_actual; _assert_not_raises_exc(_ypmt_LEN_ac"
+	.ascii	"tual = yp_lenC(obj, &exc), \"yp_lenC(\""
+	.string	" obj_fmt \", &exc) == \" expected_fmt, __VA_ARGS__); if (_ypmt_LEN_actual != expected) { munit_errorf(\"assertion failed: yp_lenC(\" obj_fmt \", &exc) == \" expected_fmt \" (%\" PRIssize \" == %\" PRIssize \")\", __VA_ARGS__, _ypmt_LEN_actual, expected); } } while (0)"
+.LASF1598:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1409:
+	.string	"stdout stdout"
+.LASF1484:
+	.string	"_COMMA_REPEAT24(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF954:
+	.string	"yp_WHILE_ELSE } if(_yp_WHILE_cond == yp_False) {"
+.LASF948:
+	.string	"yp_ELSE_EXCEPT } } if(yp_isexceptionC(_yp_IF_cond)) { {"
+.LASF1827:
+	.string	"list"
+.LASF1778:
+	.string	"yp_mem_system_malloc_resize"
+.LASF800:
+	.string	"__SIZE_T "
+.LASF1327:
+	.string	"munit_assert_ulong(a,op,b) munit_assert_type(unsigned long int, \"lu\", a, op, b)"
+.LASF633:
+	.string	"_POSIX_THREAD_THREADS_MAX 64"
+.LASF714:
+	.string	"_SYS_TYPES_H 1"
+.LASF1168:
+	.string	"PRIiFAST64 __PRI64_PREFIX \"i\""
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1049:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF395:
+	.string	"_GCC_LIMITS_H_ "
+.LASF922:
+	.string	"_yp_CONST_REF(name) ((ypObject *)&_ ##name ##_struct)"
+.LASF916:
+	.string	"_ypStringLib_ENC_CODE_UCS_4 (3u)"
+.LASF747:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF763:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1406:
+	.string	"FOPEN_MAX"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1729:
+	.string	"long double"
+.LASF1628:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1298:
+	.string	"SCNxPTR __PRIPTR_PREFIX \"x\""
+.LASF1510:
+	.string	"assert_true(expr) munit_assert_true(expr)"
+.LASF799:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1050:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF859:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1182:
+	.string	"PRIu16 \"u\""
+.LASF1677:
+	.string	"yp_int64_t"
+.LASF990:
+	.string	"__DEFINED_wchar_t "
+.LASF1326:
+	.string	"munit_assert_long(a,op,b) munit_assert_type(long int, \"ld\", a, op, b)"
+.LASF1604:
+	.string	"_TIME_H 1"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1052:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF429:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF715:
+	.string	"_BITS_TYPES_H 1"
+.LASF606:
+	.string	"__undef_ARG_MAX "
+.LASF1172:
+	.string	"PRIo64 __PRI64_PREFIX \"o\""
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF618:
+	.string	"XATTR_SIZE_MAX 65536"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1092:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF853:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1629:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF978:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1500:
+	.string	"yp_sizeof(x) ((yp_ssize_t)sizeof(x))"
+.LASF1480:
+	.string	"_COMMA_REPEAT20(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF687:
+	.string	"UINT_MAX"
+.LASF1085:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1842:
+	.string	"_ypmt_SEQ_actual"
+.LASF1055:
+	.string	"RAND_MAX 2147483647"
+.LASF1485:
+	.string	"_COMMA_REPEAT25(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1243:
+	.string	"SCNi32 \"i\""
+.LASF1281:
+	.string	"SCNxLEAST8 \"hhx\""
+.LASF718:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1360:
+	.string	"munit_newa(type,nmemb) ((type*) munit_calloc((nmemb), sizeof(type)))"
+.LASF1610:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF639:
+	.string	"LOGIN_NAME_MAX 256"
+.LASF379:
+	.string	"MUNIT_DISABLE_TIMING 1"
+.LASF1436:
+	.string	"_STRINGIFY10(a,b,c,d,e,f,g,h,i,j) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1815:
+	.string	"munit_errorf_ex"
+.LASF1295:
+	.string	"SCNiPTR __PRIPTR_PREFIX \"i\""
+.LASF1413:
+	.string	"_BITS_STDIO_H 1"
+.LASF1654:
+	.string	"char"
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF962:
+	.string	"yp_FOR_ELSE } } if(_yp_FOR_iter_exhausted) { {"
+.LASF1272:
+	.string	"SCNoLEAST64 __PRI64_PREFIX \"o\""
+.LASF1726:
+	.string	"parameters"
+.LASF1437:
+	.string	"_STRINGIFY11(a,b,c,d,e,f,g,h,i,j,k) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k"
+.LASF1874:
+	.string	"_test_thread_exit_malloc_free"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1175:
+	.string	"PRIoLEAST32 \"o\""
+.LASF1038:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1356:
+	.string	"munit_assert_ptr_not_null(ptr) munit_assert_ptr(ptr, !=, NULL)"
+.LASF1214:
+	.string	"PRIXFAST16 __PRIPTR_PREFIX \"X\""
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1165:
+	.string	"PRIiFAST8 \"i\""
+.LASF1691:
+	.string	"yp_t_float"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1835:
+	.string	"tuple"
+.LASF1806:
+	.string	"yp_decrefN"
+.LASF986:
+	.string	"___int_wchar_t_h "
+.LASF1311:
+	.string	"munit_logf(level,format,...) munit_logf_ex(level, __FILE__, __LINE__, format, __VA_ARGS__)"
+.LASF1811:
+	.string	"yp_mem_clear_freelists"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF796:
+	.string	"_SIZE_T "
+.LASF997:
+	.string	"WUNTRACED 2"
+.LASF705:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF1317:
+	.string	"munit_assert_false(expr) do { if (!MUNIT_LIKELY(!(expr))) { munit_error(\"assertion failed: \" #expr \" is not false\"); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF843:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF671:
+	.string	"UCHAR_MAX"
+.LASF1562:
+	.ascii	"assert_ptr_array(array,...) do { void **_ypmt_PTR_ARR_array "
+	.ascii	"= (void **)(array); void *_ypmt_PTR_ARR_items[] = {__VA_ARGS"
+	.ascii	"__}; char *_ypmt_PTR_ARR_item_strs[] = {STRINGIFY(__VA_ARGS_"
+	.ascii	"_)}; yp_ssize_t _ypmt_PTR_ARR_n = yp_lengthof_array(_ypmt_PT"
+	.ascii	"R_ARR_items); yp_ssize_t _ypmt_PTR_ARR_i; if (_ypmt_PTR_ARR_"
+	.ascii	"n < 1) { munit_error(\"missing expected items in assertion\""
+	.ascii	"); } for (_ypmt_PTR_ARR_i = 0; "
+	.string	"_ypmt_PTR_ARR_i < _ypmt_PTR_ARR_n; _ypmt_PTR_ARR_i++) { _assert_ptr(_ypmt_PTR_ARR_array[_ypmt_PTR_ARR_i], ==, _ypmt_PTR_ARR_items[_ypmt_PTR_ARR_i], \"%s[%\" PRIssize \"]\", \"%s\", #array, _ypmt_PTR_ARR_i, _ypmt_PTR_ARR_item_strs[_ypmt_PTR_ARR_i]); } } while (0)"
+.LASF1068:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1567:
+	.ascii	"faulty_iter_tests(setup,iter_name,iter_supplier,statement,as"
+	.ascii	"sertion,tear_down) do { ypObject *_ypmt_FLT_ITR_sup"
+	.string	"plier = (iter_supplier); char _ypmt_FLT_ITR_statement_str[] = #statement; _faulty_iter_tests((setup), (iter_name), _ypmt_FLT_ITR_supplier, (statement), (assertion), (tear_down), , _ypmt_FLT_ITR_statement_str); yp_decref(_ypmt_FLT_ITR_supplier); } while (0)"
+.LASF1290:
+	.string	"SCNiMAX __PRI64_PREFIX \"i\""
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1154:
+	.string	"PRIdFAST16 __PRIPTR_PREFIX \"d\""
+.LASF1785:
+	.string	"obj_array_decref2"
+.LASF1515:
+	.string	"assert_intC(a,op,b) munit_assert_type(yp_int_t, PRIint, a, op, b)"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF750:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF804:
+	.string	"_SIZE_T_DEFINED "
+.LASF1821:
+	.string	"fixture_tear_down"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1439:
+	.string	"_STRINGIFY13(a,b,c,d,e,f,g,h,i,j,k,l,m) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m"
+.LASF382:
+	.string	"MUNIT_OUTPUT_FILE stderr"
+.LASF1762:
+	.string	"uniqueness_t"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF775:
+	.string	"__STD_TYPE"
+.LASF761:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1094:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF733:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1033:
+	.string	"__HAVE_FLOAT32 1"
+.LASF384:
+	.string	"_DEBUG 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF811:
+	.string	"__size_t "
+.LASF974:
+	.string	"__need_NULL "
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1401:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1434:
+	.string	"_STRINGIFY8(a,b,c,d,e,f,g,h) #a, #b, #c, #d, #e, #f, #g, #h"
+.LASF1766:
+	.string	"_fixture_t"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1284:
+	.string	"SCNxLEAST64 __PRI64_PREFIX \"x\""
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1261:
+	.string	"SCNuFAST8 \"hhu\""
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1667:
+	.string	"ob_type_flags"
+.LASF892:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1617:
+	.string	"CLOCK_TAI 11"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1768:
+	.string	"test_memory_tests"
+.LASF1543:
+	.string	"assert_truthy(obj) do { ypObject *_ypmt_TRUTHY_result = yp_bool(obj); _assert_bool(_ypmt_TRUTHY_result, yp_True, yp_False, \"yp_bool(%s)\", #obj); } while (0)"
+.LASF1074:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF388:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1596:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF1119:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF851:
+	.string	"__sigset_t_defined 1"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF992:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF1108:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1366:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1330:
+	.string	"munit_assert_size(a,op,b) munit_assert_type(size_t, MUNIT_SIZE_MODIFIER \"u\", a, op, b)"
+.LASF1234:
+	.string	"SCNdLEAST16 \"hd\""
+.LASF1623:
+	.string	"_BITS_SETJMP_H 1"
+.LASF706:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF1833:
+	.string	"test_collect"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF963:
+	.string	"yp_FOR_EXCEPT } } if(!_yp_FOR_iter_exhausted && yp_isexceptionC(_yp_FOR_item)) { {"
+.LASF1486:
+	.string	"_COMMA_REPEAT26(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1504:
+	.string	"yp_lengthof_array_member(structType,member) yp_lengthof_array(((structType *)0)->member)"
+.LASF371:
+	.string	"__linux 1"
+.LASF1236:
+	.string	"SCNdLEAST64 __PRI64_PREFIX \"d\""
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1599:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1041:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF785:
+	.string	"__id_t_defined "
+.LASF625:
+	.string	"OPEN_MAX"
+.LASF1229:
+	.string	"SCNd8 \"hhd\""
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF890:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1013:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1620:
+	.string	"__itimerspec_defined 1"
+.LASF1808:
+	.string	"yp_setitem"
+.LASF1428:
+	.string	"_STRINGIFY2(a,b) #a, #b"
+.LASF889:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF435:
+	.string	"__USE_ISOC11 1"
+.LASF787:
+	.string	"__daddr_t_defined "
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1198:
+	.string	"PRIxLEAST16 \"x\""
+.LASF1003:
+	.string	"__WALL 0x40000000"
+.LASF1794:
+	.string	"yp_getitem"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1302:
+	.string	"MUNIT_UNUSED __attribute__((__unused__))"
+.LASF822:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF836:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF376:
+	.string	"unix 1"
+.LASF426:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1703:
+	.string	"_yp_ob_type_t"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1170:
+	.string	"PRIo16 \"o\""
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1886:
+	.string	"test_malloc_reuse"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF875:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF418:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1015:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1797:
+	.string	"yp_arena_end"
+.LASF1264:
+	.string	"SCNuFAST64 __PRI64_PREFIX \"u\""
+.LASF1890:
+	.string	"__addvdi3"
+.LASF643:
+	.string	"SSIZE_MAX LONG_MAX"
+.LASF1322:
+	.string	"munit_assert_short(a,op,b) munit_assert_type(short, MUNIT_SHORT_MODIFIER \"d\", a, op, b)"
+.LASF1809:
+	.string	"yp_tupleN"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF675:
+	.string	"CHAR_MAX"
+.LASF1303:
+	.string	"MUNIT_ARRAY_PARAM(name) name"
+.LASF1219:
+	.string	"PRIoMAX __PRI64_PREFIX \"o\""
+.LASF956:
+	.string	"yp_WHILE_EXCEPT_AS(target) yp_WHILE_EXCEPT ypObject *target = _yp_WHILE_cond;"
+.LASF1576:
+	.string	"SUITE_OF_TESTS_DECLS(name) extern MunitTest name ##_tests[]; extern void name ##_initialize(void)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF839:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1148:
+	.string	"PRId64 __PRI64_PREFIX \"d\""
+.LASF748:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1414:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF820:
+	.string	"__PDP_ENDIAN 3412"
+.LASF594:
+	.string	"_POSIX_SIGQUEUE_MAX 32"
+.LASF684:
+	.string	"INT_MIN (-INT_MAX - 1)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF905:
+	.string	"_yp_UNUSED __attribute__((unused))"
+.LASF1349:
+	.ascii	"munit_assert_memory_equal(size,a,b) do { const unsigned char"
+	.ascii	"* munit_tmp_a_ = (const unsigned char*) (a); const unsigned "
+	.ascii	"char* munit_tmp_b_ = (const unsigned char*) (b); const size_"
+	.ascii	"t munit_tmp_size_ = (size); if (MUNIT_UNLIKELY(memcmp(munit_"
+	.ascii	"tmp_a_, munit_tmp_b_, munit_tmp_size_)) != 0) { size_t munit"
+	.ascii	"_tmp_pos_; for (munit_tmp_pos_ = 0 ; munit_tmp_pos_ < munit_"
+	.ascii	"tmp_size_ ; munit_tmp_pos_++) { if (munit"
+	.string	"_tmp_a_[munit_tmp_pos_] != munit_tmp_b_[munit_tmp_pos_]) { munit_errorf(\"assertion failed: memory %s == %s, at offset %\" MUNIT_SIZE_MODIFIER \"u\", #a, #b, munit_tmp_pos_); break; } } } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF1784:
+	.string	"uniqueness_dealloc"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1656:
+	.string	"ssize_t"
+.LASF1866:
+	.string	"_ypmt_TYPE_expected"
+.LASF758:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1348:
+	.ascii	"munit_assert_string_not_equal(a,b) do { const char* munit_tm"
+	.ascii	"p_a_ = a; const char* munit"
+	.string	"_tmp_b_ = b; if (MUNIT_UNLIKELY(strcmp(munit_tmp_a_, munit_tmp_b_) == 0)) { munit_errorf(\"assertion failed: string %s != %s (\\\"%s\\\" == \\\"%s\\\")\", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF646:
+	.string	"_POSIX2_BC_DIM_MAX 2048"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF982:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1493:
+	.string	"_COMMA_REPEAT33(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1644:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF1412:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF1054:
+	.string	"__lldiv_t_defined 1"
+.LASF1090:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF578:
+	.string	"_POSIX_HOST_NAME_MAX 255"
+.LASF664:
+	.string	"_LIMITS_H___ "
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1876:
+	.string	"test_malloc_resize_inplace"
+.LASF1752:
+	.string	"is_patterned"
+.LASF1825:
+	.string	"before"
+.LASF668:
+	.string	"SCHAR_MIN (-SCHAR_MAX - 1)"
+.LASF1540:
+	.string	"assert_hashC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_hash_t, a, op, b, (__VA_ARGS__), PRIssize, \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF422:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1779:
+	.string	"yp_mem_system_malloc"
+.LASF1010:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1749:
+	.string	"is_setlike"
+.LASF1690:
+	.string	"yp_t_intstore"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1338:
+	.string	"munit_assert_int32(a,op,b) munit_assert_type(munit_int32_t, PRIi32, a, op, b)"
+.LASF1683:
+	.string	"yp_float_t"
+.LASF1875:
+	.string	"actual"
+.LASF1143:
+	.string	"__PRI64_PREFIX \"l\""
+.LASF942:
+	.string	"yp_IF(expression) _yp_IF(expression, ((void)0))"
+.LASF1507:
+	.string	"SUITE_OF_SUITES(name) { \"/\" #name, NULL, (name ##_suites), 1, MUNIT_SUITE_OPTION_NONE }"
+.LASF657:
+	.string	"BC_STRING_MAX _POSIX2_BC_STRING_MAX"
+.LASF1810:
+	.string	"yp_dictK"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1857:
+	.string	"item"
+.LASF936:
+	.string	"_yp_IMMORTAL_FUNCTION(qual,name,code,parameters) static yp_parameter_decl_t _ ##name ##_parameters[] = {_yp_UNPACK parameters}; _yp_IMMORTAL_FUNCTION5( qual, name, code, yp_lengthof_array(_ ##name ##_parameters), _ ##name ##_parameters)"
+.LASF582:
+	.string	"_POSIX_MAX_INPUT 255"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF724:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF413:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1031:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1872:
+	.string	"_ypmt_RAISES_statement"
+.LASF1105:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1780:
+	.string	"yp_mem_default_malloc_resize"
+.LASF869:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1002:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF979:
+	.string	"_T_WCHAR "
+.LASF1256:
+	.string	"SCNu64 __PRI64_PREFIX \"u\""
+.LASF810:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1080:
+	.string	"UINT16_MAX (65535)"
+.LASF1227:
+	.string	"PRIxPTR __PRIPTR_PREFIX \"x\""
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF766:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1362:
+	.string	"_STDDEF_H_ "
+.LASF1491:
+	.string	"_COMMA_REPEAT31(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF774:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1183:
+	.string	"PRIu32 \"u\""
+.LASF1377:
+	.string	"_STDIO_H 1"
+.LASF731:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF927:
+	.ascii	"_yp_IMMORTAL_BYTES(qual,name,value) static const char _"
+	.string	" ##name ##_data[] = (value); static struct _ypStringLibObject _ ##name ##_struct = {_yp_IMMORTAL_HEAD_INIT(_ypBytes_CODE, _ypStringLib_ENC_CODE_BYTES, sizeof(_ ##name ##_data) - 1, (void *)_ ##name ##_data)}; qual ypObject *const name = _yp_CONST_REF(name)"
+.LASF667:
+	.string	"SCHAR_MIN"
+.LASF770:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1127:
+	.string	"UINT16_C(c) c"
+.LASF876:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1059:
+	.string	"_ALLOCA_H 1"
+.LASF1113:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1614:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1379:
+	.string	"_____fpos_t_defined 1"
+.LASF1676:
+	.string	"yp_uint32_t"
+.LASF1552:
+	.string	"_assert_eq_same_type(a,b,a_fmt,b_fmt,...) do { _assert_obj(a, eq, b, a_fmt, b_fmt, __VA_ARGS__); _assert_same_type(a, b, a_fmt, b_fmt, __VA_ARGS__); } while (0)"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1802:
+	.string	"yp_clear"
+.LASF1461:
+	.string	"_COMMA_REPEAT1(x) x"
+.LASF407:
+	.string	"__USE_POSIX199309"
+.LASF1115:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1547:
+	.string	"assert_obj(a,op,b) do { ypObject *_ypmt_OBJ_a = (a); ypObject *_ypmt_OBJ_b = (b); _assert_obj(_ypmt_OBJ_a, op, _ypmt_OBJ_b, \"%s\", \"%s\", #a, #b); } while (0)"
+.LASF685:
+	.string	"INT_MAX"
+.LASF1775:
+	.string	"allocator_system"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF622:
+	.string	"__undef_NR_OPEN"
+.LASF1369:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF980:
+	.string	"__WCHAR_T "
+.LASF1274:
+	.string	"SCNoFAST16 __PRIPTR_PREFIX \"o\""
+.LASF1336:
+	.string	"munit_assert_int16(a,op,b) munit_assert_type(munit_int16_t, PRIi16, a, op, b)"
+.LASF776:
+	.string	"__u_char_defined "
+.LASF1590:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF386:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1277:
+	.string	"SCNx8 \"hhx\""
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF665:
+	.string	"CHAR_BIT"
+.LASF1008:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF860:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF973:
+	.string	"__need_wchar_t "
+.LASF1251:
+	.string	"SCNiFAST32 __PRIPTR_PREFIX \"i\""
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1040:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1186:
+	.string	"PRIuLEAST16 \"u\""
+.LASF434:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF676:
+	.string	"CHAR_MAX SCHAR_MAX"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1658:
+	.string	"long long unsigned int"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF771:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1192:
+	.string	"PRIuFAST64 __PRI64_PREFIX \"u\""
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1268:
+	.string	"SCNo64 __PRI64_PREFIX \"o\""
+.LASF1110:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1275:
+	.string	"SCNoFAST32 __PRIPTR_PREFIX \"o\""
+.LASF1553:
+	.string	"assert_eq_same_type(a,b) do { ypObject *_ypmt_EQ_TYPE_a = (a); ypObject *_ypmt_EQ_TYPE_b = (b); _assert_eq_same_type(_ypmt_EQ_TYPE_a, _ypmt_EQ_TYPE_b, \"%s\", \"%s\", #a, #b); } while (0)"
+.LASF1637:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1025:
+	.string	"__HAVE_FLOAT128 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1761:
+	.string	"rand_obj_supplier_func"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF849:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF636:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1818:
+	.string	"yp_listN"
+.LASF1788:
+	.string	"yp_asintC"
+.LASF1065:
+	.string	"_STDINT_H 1"
+.LASF699:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1ULL)"
+.LASF1430:
+	.string	"_STRINGIFY4(a,b,c,d) #a, #b, #c, #d"
+.LASF1024:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF764:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1151:
+	.string	"PRIdLEAST32 \"d\""
+.LASF710:
+	.string	"_VA_LIST "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1626:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1867:
+	.string	"_ypmt_TYPE_type_obj"
+.LASF1750:
+	.string	"is_mapping"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF634:
+	.string	"PTHREAD_THREADS_MAX"
+.LASF1056:
+	.string	"EXIT_FAILURE 1"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF959:
+	.string	"yp_FOR(target,expression) _yp_FOR(target, expression, ((void)0))"
+.LASF1212:
+	.string	"PRIXLEAST64 __PRI64_PREFIX \"X\""
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF746:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1718:
+	.string	"MunitTestOptions"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1395:
+	.string	"BUFSIZ 8192"
+.LASF930:
+	.string	"yp_IMMORTAL_BYTES(name,value) _yp_IMMORTAL_BYTES(, name, value)"
+.LASF925:
+	.string	"_yp_IMMORTAL_SMALL_HEAD_INIT(type,type_flags) {(type), 0, (type_flags), _ypObject_REFCNT_IMMORTAL}"
+.LASF862:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1526:
+	.ascii	"assert_isexception(obj,...) do { ypObject *_ypmt"
+	.string	"_ISEXC_obj = (obj); ypObject *_ypmt_ISEXC_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_ISEXC_n = yp_lengthof_array(_ypmt_ISEXC_expected); _assert_isexception(_ypmt_ISEXC_obj, _ypmt_ISEXC_n, _ypmt_ISEXC_expected, \"%s\", \"%s\", #obj, #__VA_ARGS__); } while (0)"
+.LASF945:
+	.string	"yp_ELIF(expression) _yp_ELIF(expression, ((void)0))"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF765:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1346:
+	.string	"_STRINGS_H 1"
+.LASF1359:
+	.string	"munit_calloc(nmemb,size) munit_malloc((nmemb) * (size))"
+.LASF577:
+	.string	"_POSIX_DELAYTIMER_MAX 32"
+.LASF712:
+	.string	"_VA_LIST_T_H "
+.LASF786:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1771:
+	.string	"malloc_resize"
+.LASF1382:
+	.string	"____FILE_defined 1"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1662:
+	.string	"pthread_attr_t"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1516:
+	.string	"assert_ssizeC(a,op,b) munit_assert_type(yp_ssize_t, PRIssize, a, op, b)"
+.LASF866:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1763:
+	.string	"_rand_obj_supplier_memo_t"
+.LASF1717:
+	.string	"MUNIT_TEST_OPTION_TODO"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1042:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF383:
+	.string	"yp_ENABLE_SHARED 1"
+.LASF1756:
+	.string	"_peer_type_t"
+.LASF1282:
+	.string	"SCNxLEAST16 \"hx\""
+.LASF1694:
+	.string	"yp_RuntimeError"
+.LASF1888:
+	.string	"_test_malloc"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1410:
+	.string	"stderr stderr"
+.LASF1584:
+	.string	"SCHED_FIFO 1"
+.LASF1600:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF1427:
+	.string	"_STRINGIFY1(a) #a"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF874:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF926:
+	.string	"_yp_IMMORTAL_INT(qual,name,value) static struct _ypIntObject _ ##name ##_struct = { _yp_IMMORTAL_SMALL_HEAD_INIT(_ypInt_CODE, 0), (value)}; qual ypObject *const name = _yp_CONST_REF(name)"
+.LASF1601:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1061:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1782:
+	.string	"yp_mem_default_free"
+.LASF1112:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1370:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF896:
+	.string	"yp_SSIZE_T_MAX SSIZE_MAX"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF762:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1865:
+	.string	"_ypmt_TYPE_obj"
+.LASF1764:
+	.string	"_uniqueness_t"
+.LASF1574:
+	.string	"obj_array_decref(array) obj_array_decref2(yp_lengthof_array(array), (array))"
+.LASF673:
+	.string	"CHAR_MIN"
+.LASF1681:
+	.string	"yp_hash_t"
+.LASF1595:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF1861:
+	.string	"_test_freelists_thread_exit_fill"
+.LASF1523:
+	.ascii	"_assert_not_raises_exc(statement,statement_fmt,...) do { y"
+	.string	"pObject *exc = NULL; statement; if (exc != NULL) { if (yp_isexceptionC(exc)) { munit_errorf(\"assertion failed: \" statement_fmt \"; !yp_isexceptionC(exc)\", __VA_ARGS__); } munit_errorf(\"exc set to a non-exception: \" statement_fmt, __VA_ARGS__); } } while (0)"
+.LASF834:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1789:
+	.string	"yp_intstoreC"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1404:
+	.string	"FILENAME_MAX 4096"
+.LASF1158:
+	.string	"PRIi16 \"i\""
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF863:
+	.string	"NFDBITS __NFDBITS"
+.LASF1663:
+	.string	"long long int"
+.LASF752:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1120:
+	.string	"WINT_MIN (0u)"
+.LASF1447:
+	.string	"_STRINGIFY21(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1307:
+	.string	"MUNIT_NO_RETURN _Noreturn"
+.LASF1740:
+	.string	"newK"
+.LASF1765:
+	.string	"rand_objs_func"
+.LASF1506:
+	.string	"SUITE_OF_TESTS(name) { \"/\" #name, (name ##_tests), NULL, 1, MUNIT_SUITE_OPTION_NONE }"
+.LASF1534:
+	.string	"assert_ssizeC_exc(a,op,b) _assert_typeC_exc(yp_ssize_t, a, op, b, PRIssize, \"%s\", \"%s\", #a, #b)"
+.LASF1017:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF919:
+	.string	"_ypBytes_CODE (16u)"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF931:
+	.string	"yp_IMMORTAL_STR_LATIN_1(name,value) _yp_IMMORTAL_STR_LATIN_1(, name, value)"
+.LASF1721:
+	.string	"MunitTestTearDown"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1388:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF1166:
+	.string	"PRIiFAST16 __PRIPTR_PREFIX \"i\""
+.LASF1444:
+	.string	"_STRINGIFY18(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r"
+.LASF807:
+	.string	"__DEFINED_size_t "
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF972:
+	.string	"MUNIT_H "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF912:
+	.string	"_ypObject_LEN_INVALID ((yp_ssize_t) - 1)"
+.LASF888:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1799:
+	.string	"pthread_join"
+.LASF1007:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF598:
+	.string	"_POSIX_SYMLOOP_MAX 8"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1178:
+	.string	"PRIoFAST16 __PRIPTR_PREFIX \"o\""
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1423:
+	.string	"_ESC(...) __VA_ARGS__"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF580:
+	.string	"_POSIX_LOGIN_NAME_MAX 9"
+.LASF1313:
+	.string	"munit_errorf(format,...) munit_errorf_ex(__FILE__, __LINE__, format, __VA_ARGS__)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF420:
+	.string	"__USE_ATFILE"
+.LASF1393:
+	.string	"_IOLBF 1"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1546:
+	.string	"_assert_obj(a,op,b,a_fmt,b_fmt,...) do { ypObject *_ypmt_OBJ_result = yp_ ##op(a, b); _assert_bool(_ypmt_OBJ_result, yp_True, yp_False, \"yp_\" #op \"(\" a_fmt \", \" b_fmt \")\", __VA_ARGS__); } while (0)"
+.LASF1190:
+	.string	"PRIuFAST16 __PRIPTR_PREFIX \"u\""
+.LASF1199:
+	.string	"PRIxLEAST32 \"x\""
+.LASF1702:
+	.string	"yp_collect_stats_t"
+.LASF1560:
+	.ascii	"_assert_mapping(obj,items,obj_fmt,item_strs,...) do { yp_ssi"
+	.ascii	"ze_t _ypmt_MAP_k = yp_lengthof_array(items) / 2; int _ypmt_M"
+	.ascii	"AP_found[yp_lengthof_array(items) / 2] = {0}; yp_uint64_t _y"
+	.ascii	"pmt_MAP_mi_state; ypObject *_ypmt_MAP_mi; ypObject *_ypmt_MA"
+	.ascii	"P_actual_key; ypObject *_ypmt_MAP_actual_value; yp_ssize_t _"
+	.ascii	"ypmt_MAP_ki; if (yp_lengthof_array(items) % 2 != 0) { munit_"
+	.ascii	"error(\"expected an even number of objects for the (key, val"
+	.ascii	"ue) pairs\"); } _assert_len(obj, _ypmt_MAP_k, obj_fmt, \"%\""
+	.ascii	" PRIssize, __VA_ARGS__, _ypmt_MAP_k); _assert_not_raises(_yp"
+	.ascii	"mt_MAP_mi = yp_miniiter_items(obj, &_ypmt_MAP_mi_state), \"y"
+	.ascii	"p_miniiter_items(\" obj_fmt \", &mi_state)\", __VA_ARGS__); "
+	.ascii	"while (_assert_mapping_helper(_ypmt_MAP_mi, &_ypmt_MAP_mi_st"
+	.ascii	"ate, _ypmt_MAP_k, items, &_ypmt_MAP_actual_key , &_ypmt_MAP_"
+	.ascii	"actual_value , &_ypmt_MAP_ki)) { _assert_not_exception(_ypmt"
+	.ascii	"_MAP_actual_key, \"yp_miniiter_items_next(yp_miniiter_items("
+	.ascii	"\" obj_fmt \", &mi_state), &mi_state)\", __VA_ARGS__); if (_"
+	.ascii	"ypmt_MAP_ki >= _ypmt_MAP_k) { munit_errorf(\"unexpected item"
+	.ascii	" yielded from \" obj_fmt, __VA_ARGS__); } if (_ypmt_MAP_foun"
+	.ascii	"d[_ypmt_MAP_ki]) { munit_errorf(\"%s yielded twice from \" o"
+	.ascii	"bj_fmt, item_strs[_ypmt_MAP_ki * 2], __VA_ARGS__); } _ypmt_M"
+	.ascii	"AP_found[_ypmt_MAP_ki] = TRUE; _assert_same_type(_ypmt_MAP_a"
+	.ascii	"ctual_key, items[_ypmt_MAP_ki * 2], \"<key in \" obj_fmt \">"
+	.ascii	"\", \"%s\", __VA_ARGS__, item_strs[_ypmt_MAP_ki * 2]); _asse"
+	.ascii	"rt_eq_same_type(_ypmt_MAP_actual_value, items[_ypmt_MAP_ki *"
+	.ascii	" 2 + 1], \"<value \" obj_fmt \"[%s]>\", \"%s\", __VA_ARGS__,"
+	.ascii	" item_strs[_ypmt_MAP_ki * 2], item_strs[_ypmt_MAP_ki * 2 + 1"
+	.ascii	"]); yp_decref(_ypmt_MAP_actual_key); yp_decref(_ypmt_M"
+	.string	"AP_actual_value); } for (_ypmt_MAP_ki = 0; _ypmt_MAP_ki < _ypmt_MAP_k; _ypmt_MAP_ki++) { if (!_ypmt_MAP_found[_ypmt_MAP_ki]) { munit_errorf( \"%s not yielded from \" obj_fmt, item_strs[_ypmt_MAP_ki * 2], __VA_ARGS__); } } yp_decref(_ypmt_MAP_mi); } while (0)"
+.LASF891:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1636:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF1018:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1647:
+	.string	"long unsigned int"
+.LASF1392:
+	.string	"_IOFBF 0"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1107:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF425:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1572:
+	.string	"obj_array_init(n,expression) {_COMMA_REPEAT ##n((expression))}"
+.LASF946:
+	.string	"yp_ELIFd(expression) _yp_ELIF(expression, yp_decref(_yp_IF_expr))"
+.LASF1879:
+	.string	"_test_arena_temporaries"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1724:
+	.string	"tear_down"
+.LASF754:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1446:
+	.string	"_STRINGIFY20(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1328:
+	.string	"munit_assert_llong(a,op,b) munit_assert_type(long long int, \"lld\", a, op, b)"
+.LASF1642:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF1571:
+	.string	"define_function2(name,code) yp_function_decl_t _ ##name ##_declaration = {(code), 0, 0, NULL, NULL, NULL}; ypObject *name = yp_functionC(&_ ##name ##_declaration)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1193:
+	.string	"PRIx8 \"x\""
+.LASF1495:
+	.string	"VA_ARGC(...) (_PP_NARG(, __VA_ARGS__, _PP_RSEQ_N()))"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1344:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1868:
+	.string	"expected"
+.LASF751:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1720:
+	.string	"MunitTestSetup"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF744:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1744:
+	.string	"is_numeric"
+.LASF1376:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF1525:
+	.ascii	"_assert_isexception(obj,n,expected,obj_fmt,expected_fmt,...)"
+	.ascii	" do { if (n < 1) { munit_error(\"missing expected exception "
+	.ascii	"in assertion\"); } if (!yp_isexceptionC(obj)) { munit_error"
+	.string	"f(\"assertion failed: yp_isexceptionC(\" obj_fmt \") (expected \" expected_fmt \")\", __VA_ARGS__); } if (!yp_isexception_arrayC(obj, n, expected)) { munit_errorf(\"assertion failed: yp_isexceptionCN(\" obj_fmt \", N(\" expected_fmt \"))\", __VA_ARGS__); } } while (0)"
+.LASF1733:
+	.string	"falsy"
+.LASF1438:
+	.string	"_STRINGIFY12(a,b,c,d,e,f,g,h,i,j,k,l) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l"
+.LASF683:
+	.string	"INT_MIN"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1196:
+	.string	"PRIx64 __PRI64_PREFIX \"x\""
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF660:
+	.string	"LINE_MAX _POSIX2_LINE_MAX"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF795:
+	.string	"__SIZE_T__ "
+.LASF1292:
+	.string	"SCNuMAX __PRI64_PREFIX \"u\""
+.LASF1684:
+	.string	"yp_None"
+.LASF1475:
+	.string	"_COMMA_REPEAT15(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF740:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF390:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF597:
+	.string	"_POSIX_SYMLINK_MAX 255"
+.LASF1304:
+	.string	"MUNIT_SIZE_MODIFIER \"z\""
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1220:
+	.string	"PRIuMAX __PRI64_PREFIX \"u\""
+.LASF600:
+	.string	"_POSIX_TTY_NAME_MAX 9"
+.LASF1432:
+	.string	"_STRINGIFY6(a,b,c,d,e,f) #a, #b, #c, #d, #e, #f"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1467:
+	.string	"_COMMA_REPEAT7(x) x, x, x, x, x, x, x"
+.LASF621:
+	.string	"NR_OPEN"
+.LASF1310:
+	.string	"MUNIT_PRINTF(string_index,first_to_check) __attribute__((format (printf, string_index, first_to_check)))"
+.LASF1358:
+	.string	"munit_new(type) ((type*) munit_malloc(sizeof(type)))"
+.LASF1435:
+	.string	"_STRINGIFY9(a,b,c,d,e,f,g,h,i) #a, #b, #c, #d, #e, #f, #g, #h, #i"
+.LASF1648:
+	.string	"unsigned int"
+.LASF1645:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1228:
+	.string	"PRIXPTR __PRIPTR_PREFIX \"X\""
+.LASF845:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1505:
+	.string	"TEST(name,parameters) { \"/\" #name, (MunitTestFunc)(name), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, parameters }"
+.LASF682:
+	.string	"USHRT_MAX (SHRT_MAX * 2 + 1)"
+.LASF1795:
+	.string	"yp_intC"
+.LASF596:
+	.string	"_POSIX_STREAM_MAX 8"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1498:
+	.string	"STRINGIFY(...) _ESC(_PP_NARG(_STRINGIFY, __VA_ARGS__, _PP_RSEQ_N())(__VA_ARGS__))"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1405:
+	.string	"L_ctermid 9"
+.LASF823:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1489:
+	.string	"_COMMA_REPEAT29(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1745:
+	.string	"is_iterable"
+.LASF732:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF593:
+	.string	"_POSIX_SEM_VALUE_MAX 32767"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1738:
+	.string	"newN"
+.LASF1652:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF716:
+	.string	"__S16_TYPE short int"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1324:
+	.string	"munit_assert_int(a,op,b) munit_assert_type(int, \"d\", a, op, b)"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1380:
+	.string	"____mbstate_t_defined 1"
+.LASF1853:
+	.string	"_test_arena_thread_exit_list"
+.LASF681:
+	.string	"USHRT_MAX"
+.LASF1727:
+	.string	"MunitTest"
+.LASF728:
+	.string	"__S64_TYPE long int"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF637:
+	.string	"DELAYTIMER_MAX 2147483647"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1138:
+	.string	"munit_uint32_t uint32_t"
+.LASF1161:
+	.string	"PRIiLEAST8 \"i\""
+.LASF623:
+	.string	"LINK_MAX"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1725:
+	.string	"options"
+.LASF1337:
+	.string	"munit_assert_uint16(a,op,b) munit_assert_type(munit_uint16_t, PRIu16, a, op, b)"
+.LASF700:
+	.string	"_STDARG_H "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1373:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1202:
+	.string	"PRIxFAST16 __PRIPTR_PREFIX \"x\""
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1021:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1769:
+	.string	"_allocator_t"
+.LASF1469:
+	.string	"_COMMA_REPEAT9(x) x, x, x, x, x, x, x, x, x"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1458:
+	.string	"_STRINGIFY32(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1238:
+	.string	"SCNdFAST16 __PRIPTR_PREFIX \"d\""
+.LASF1883:
+	.string	"newsize"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"Lib/munit_test/test_memory.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
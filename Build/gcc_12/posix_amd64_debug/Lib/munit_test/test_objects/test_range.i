@@ -0,0 +1,9993 @@
+# 0 "Lib/munit_test/test_objects/test_range.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+#define __STDC__ 1
+# 0 "<built-in>"
+#define __STDC_VERSION__ 201710L
+# 0 "<built-in>"
+#define __STDC_UTF_16__ 1
+# 0 "<built-in>"
+#define __STDC_UTF_32__ 1
+# 0 "<built-in>"
+#define __STDC_HOSTED__ 1
+# 0 "<built-in>"
+#define __GNUC__ 12
+# 0 "<built-in>"
+#define __GNUC_MINOR__ 2
+# 0 "<built-in>"
+#define __GNUC_PATCHLEVEL__ 0
+# 0 "<built-in>"
+#define __VERSION__ "12.2.0"
+# 0 "<built-in>"
+#define __ATOMIC_RELAXED 0
+# 0 "<built-in>"
+#define __ATOMIC_SEQ_CST 5
+# 0 "<built-in>"
+#define __ATOMIC_ACQUIRE 2
+# 0 "<built-in>"
+#define __ATOMIC_RELEASE 3
+# 0 "<built-in>"
+#define __ATOMIC_ACQ_REL 4
+# 0 "<built-in>"
+#define __ATOMIC_CONSUME 1
+# 0 "<built-in>"
+#define __pic__ 2
+# 0 "<built-in>"
+#define __PIC__ 2
+# 0 "<built-in>"
+#define __pie__ 2
+# 0 "<built-in>"
+#define __PIE__ 2
+# 0 "<built-in>"
+#define __OPTIMIZE__ 1
+# 0 "<built-in>"
+#define __FINITE_MATH_ONLY__ 0
+# 0 "<built-in>"
+#define _LP64 1
+# 0 "<built-in>"
+#define __LP64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_INT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_SHORT__ 2
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_DOUBLE__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_DOUBLE__ 16
+# 0 "<built-in>"
+#define __SIZEOF_SIZE_T__ 8
+# 0 "<built-in>"
+#define __CHAR_BIT__ 8
+# 0 "<built-in>"
+#define __BIGGEST_ALIGNMENT__ 16
+# 0 "<built-in>"
+#define __ORDER_LITTLE_ENDIAN__ 1234
+# 0 "<built-in>"
+#define __ORDER_BIG_ENDIAN__ 4321
+# 0 "<built-in>"
+#define __ORDER_PDP_ENDIAN__ 3412
+# 0 "<built-in>"
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __SIZEOF_POINTER__ 8
+# 0 "<built-in>"
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+# 0 "<built-in>"
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+# 0 "<built-in>"
+#define __SIZE_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __PTRDIFF_TYPE__ long int
+# 0 "<built-in>"
+#define __WCHAR_TYPE__ int
+# 0 "<built-in>"
+#define __WINT_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __INTMAX_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTMAX_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __CHAR16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __CHAR32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __SIG_ATOMIC_TYPE__ int
+# 0 "<built-in>"
+#define __INT8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT32_TYPE__ int
+# 0 "<built-in>"
+#define __INT64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_LEAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_LEAST16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT_LEAST32_TYPE__ int
+# 0 "<built-in>"
+#define __INT_LEAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_LEAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_LEAST16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_FAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_FAST16_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST32_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_FAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_FAST16_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST32_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INTPTR_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTPTR_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __GXX_ABI_VERSION 1017
+# 0 "<built-in>"
+#define __SCHAR_MAX__ 0x7f
+# 0 "<built-in>"
+#define __SHRT_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __LONG_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+# 0 "<built-in>"
+#define __WCHAR_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+# 0 "<built-in>"
+#define __WINT_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __WINT_MIN__ 0U
+# 0 "<built-in>"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __SCHAR_WIDTH__ 8
+# 0 "<built-in>"
+#define __SHRT_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_WIDTH__ 32
+# 0 "<built-in>"
+#define __LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __LONG_LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __WCHAR_WIDTH__ 32
+# 0 "<built-in>"
+#define __WINT_WIDTH__ 32
+# 0 "<built-in>"
+#define __PTRDIFF_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIZE_WIDTH__ 64
+# 0 "<built-in>"
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTMAX_C(c) c ## L
+# 0 "<built-in>"
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINTMAX_C(c) c ## UL
+# 0 "<built-in>"
+#define __INTMAX_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+# 0 "<built-in>"
+#define __SIG_ATOMIC_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __UINT8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INT_LEAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT8_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_LEAST16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT16_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST16_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_LEAST32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT32_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST32_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT64_C(c) c ## L
+# 0 "<built-in>"
+#define __INT_LEAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_LEAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT8_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT16_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT32_C(c) c ## U
+# 0 "<built-in>"
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT64_C(c) c ## UL
+# 0 "<built-in>"
+#define __INT_FAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT_FAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST16_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST32_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_FAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTPTR_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __GCC_IEC_559 2
+# 0 "<built-in>"
+#define __GCC_IEC_559_COMPLEX 2
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD__ 0
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+# 0 "<built-in>"
+#define __DEC_EVAL_METHOD__ 2
+# 0 "<built-in>"
+#define __FLT_RADIX__ 2
+# 0 "<built-in>"
+#define __FLT_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT_DIG__ 6
+# 0 "<built-in>"
+#define __FLT_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+# 0 "<built-in>"
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+# 0 "<built-in>"
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+# 0 "<built-in>"
+#define __FLT_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DBL_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __DBL_DIG__ 15
+# 0 "<built-in>"
+#define __DBL_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __DBL_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __DBL_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __DBL_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __DBL_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+# 0 "<built-in>"
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+# 0 "<built-in>"
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+# 0 "<built-in>"
+#define __DBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __DBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __LDBL_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __LDBL_DIG__ 18
+# 0 "<built-in>"
+#define __LDBL_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __LDBL_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __LDBL_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __LDBL_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+# 0 "<built-in>"
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+# 0 "<built-in>"
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+# 0 "<built-in>"
+#define __LDBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __LDBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT16_MANT_DIG__ 11
+# 0 "<built-in>"
+#define __FLT16_DIG__ 3
+# 0 "<built-in>"
+#define __FLT16_MIN_EXP__ (-13)
+# 0 "<built-in>"
+#define __FLT16_MIN_10_EXP__ (-4)
+# 0 "<built-in>"
+#define __FLT16_MAX_EXP__ 16
+# 0 "<built-in>"
+#define __FLT16_MAX_10_EXP__ 4
+# 0 "<built-in>"
+#define __FLT16_DECIMAL_DIG__ 5
+# 0 "<built-in>"
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+# 0 "<built-in>"
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+# 0 "<built-in>"
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+# 0 "<built-in>"
+#define __FLT16_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT16_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT32_DIG__ 6
+# 0 "<built-in>"
+#define __FLT32_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT32_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT32_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT32_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT32_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+# 0 "<built-in>"
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+# 0 "<built-in>"
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+# 0 "<built-in>"
+#define __FLT32_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT64_DIG__ 15
+# 0 "<built-in>"
+#define __FLT64_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT64_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT64_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT64_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT64_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+# 0 "<built-in>"
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+# 0 "<built-in>"
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+# 0 "<built-in>"
+#define __FLT64_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT128_MANT_DIG__ 113
+# 0 "<built-in>"
+#define __FLT128_DIG__ 33
+# 0 "<built-in>"
+#define __FLT128_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT128_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT128_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT128_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT128_DECIMAL_DIG__ 36
+# 0 "<built-in>"
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+# 0 "<built-in>"
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+# 0 "<built-in>"
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+# 0 "<built-in>"
+#define __FLT128_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT128_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32X_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT32X_DIG__ 15
+# 0 "<built-in>"
+#define __FLT32X_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT32X_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT32X_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT32X_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT32X_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+# 0 "<built-in>"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+# 0 "<built-in>"
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+# 0 "<built-in>"
+#define __FLT32X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64X_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __FLT64X_DIG__ 18
+# 0 "<built-in>"
+#define __FLT64X_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT64X_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT64X_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT64X_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+# 0 "<built-in>"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+# 0 "<built-in>"
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+# 0 "<built-in>"
+#define __FLT64X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DEC32_MANT_DIG__ 7
+# 0 "<built-in>"
+#define __DEC32_MIN_EXP__ (-94)
+# 0 "<built-in>"
+#define __DEC32_MAX_EXP__ 97
+# 0 "<built-in>"
+#define __DEC32_MIN__ 1E-95DF
+# 0 "<built-in>"
+#define __DEC32_MAX__ 9.999999E96DF
+# 0 "<built-in>"
+#define __DEC32_EPSILON__ 1E-6DF
+# 0 "<built-in>"
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+# 0 "<built-in>"
+#define __DEC64_MANT_DIG__ 16
+# 0 "<built-in>"
+#define __DEC64_MIN_EXP__ (-382)
+# 0 "<built-in>"
+#define __DEC64_MAX_EXP__ 385
+# 0 "<built-in>"
+#define __DEC64_MIN__ 1E-383DD
+# 0 "<built-in>"
+#define __DEC64_MAX__ 9.999999999999999E384DD
+# 0 "<built-in>"
+#define __DEC64_EPSILON__ 1E-15DD
+# 0 "<built-in>"
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+# 0 "<built-in>"
+#define __DEC128_MANT_DIG__ 34
+# 0 "<built-in>"
+#define __DEC128_MIN_EXP__ (-6142)
+# 0 "<built-in>"
+#define __DEC128_MAX_EXP__ 6145
+# 0 "<built-in>"
+#define __DEC128_MIN__ 1E-6143DL
+# 0 "<built-in>"
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+# 0 "<built-in>"
+#define __DEC128_EPSILON__ 1E-33DL
+# 0 "<built-in>"
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+# 0 "<built-in>"
+#define __REGISTER_PREFIX__ 
+# 0 "<built-in>"
+#define __USER_LABEL_PREFIX__ 
+# 0 "<built-in>"
+#define __GNUC_STDC_INLINE__ 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+# 0 "<built-in>"
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+# 0 "<built-in>"
+#define __GCC_DESTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_CONSTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+# 0 "<built-in>"
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+# 0 "<built-in>"
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+# 0 "<built-in>"
+#define __PRAGMA_REDEFINE_EXTNAME 1
+# 0 "<built-in>"
+#define __SIZEOF_INT128__ 16
+# 0 "<built-in>"
+#define __SIZEOF_WCHAR_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_WINT_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_PTRDIFF_T__ 8
+# 0 "<built-in>"
+#define __amd64 1
+# 0 "<built-in>"
+#define __amd64__ 1
+# 0 "<built-in>"
+#define __x86_64 1
+# 0 "<built-in>"
+#define __x86_64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT80__ 16
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT128__ 16
+# 0 "<built-in>"
+#define __ATOMIC_HLE_ACQUIRE 65536
+# 0 "<built-in>"
+#define __ATOMIC_HLE_RELEASE 131072
+# 0 "<built-in>"
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+# 0 "<built-in>"
+#define __k8 1
+# 0 "<built-in>"
+#define __k8__ 1
+# 0 "<built-in>"
+#define __code_model_small__ 1
+# 0 "<built-in>"
+#define __MMX__ 1
+# 0 "<built-in>"
+#define __SSE__ 1
+# 0 "<built-in>"
+#define __SSE2__ 1
+# 0 "<built-in>"
+#define __FXSR__ 1
+# 0 "<built-in>"
+#define __SSE_MATH__ 1
+# 0 "<built-in>"
+#define __SSE2_MATH__ 1
+# 0 "<built-in>"
+#define __MMX_WITH_SSE__ 1
+# 0 "<built-in>"
+#define __SEG_FS 1
+# 0 "<built-in>"
+#define __SEG_GS 1
+# 0 "<built-in>"
+#define __gnu_linux__ 1
+# 0 "<built-in>"
+#define __linux 1
+# 0 "<built-in>"
+#define __linux__ 1
+# 0 "<built-in>"
+#define linux 1
+# 0 "<built-in>"
+#define __unix 1
+# 0 "<built-in>"
+#define __unix__ 1
+# 0 "<built-in>"
+#define unix 1
+# 0 "<built-in>"
+#define __ELF__ 1
+# 0 "<built-in>"
+#define __DECIMAL_BID_FORMAT__ 1
+# 0 "<command-line>"
+#define MUNIT_DISABLE_TIMING 1
+# 0 "<command-line>"
+#define MUNIT_TEST_NAME_LEN 58
+# 0 "<command-line>"
+#define MUNIT_NO_BUFFER 1
+# 0 "<command-line>"
+#define MUNIT_OUTPUT_FILE stderr
+# 0 "<command-line>"
+#define yp_ENABLE_SHARED 1
+# 0 "<command-line>"
+#define _DEBUG 1
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 19 "/usr/include/stdc-predef.h" 3 4
+#define _STDC_PREDEF_H 1
+# 38 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559__ 1
+#define __STDC_IEC_60559_BFP__ 201404L
+# 48 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559_COMPLEX__ 1
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+# 62 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_ISO_10646__ 201706L
+# 0 "<command-line>" 2
+# 1 "Lib/munit_test/test_objects/test_range.c"
+
+# 1 "Lib/munit_test/unittest.h" 1
+
+#define yp_MUNIT_TEST_UNITTEST_H 
+# 14 "Lib/munit_test/unittest.h"
+#define unittest_snprintf snprintf
+
+
+#define yp_FUTURE 
+# 1 "./nohtyP.h" 1
+# 78 "./nohtyP.h"
+#define yp_NOHTYP_H 
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+#define _GCC_LIMITS_H_ 
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 1 3 4
+
+
+
+
+
+#define _GCC_NEXT_LIMITS_H 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 203 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/include/limits.h" 1 3 4
+# 23 "/usr/include/limits.h" 3 4
+#define _LIBC_LIMITS_H_ 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+# 1 "/usr/include/features.h" 1 3 4
+# 19 "/usr/include/features.h" 3 4
+#define _FEATURES_H 1
+# 126 "/usr/include/features.h" 3 4
+#undef __USE_ISOC11
+#undef __USE_ISOC99
+#undef __USE_ISOC95
+#undef __USE_ISOCXX11
+#undef __USE_POSIX
+#undef __USE_POSIX2
+#undef __USE_POSIX199309
+#undef __USE_POSIX199506
+#undef __USE_XOPEN
+#undef __USE_XOPEN_EXTENDED
+#undef __USE_UNIX98
+#undef __USE_XOPEN2K
+#undef __USE_XOPEN2KXSI
+#undef __USE_XOPEN2K8
+#undef __USE_XOPEN2K8XSI
+#undef __USE_LARGEFILE
+#undef __USE_LARGEFILE64
+#undef __USE_FILE_OFFSET64
+#undef __USE_MISC
+#undef __USE_ATFILE
+#undef __USE_DYNAMIC_STACK_SIZE
+#undef __USE_GNU
+#undef __USE_FORTIFY_LEVEL
+#undef __KERNEL_STRICT_NAMES
+#undef __GLIBC_USE_ISOC2X
+#undef __GLIBC_USE_DEPRECATED_GETS
+#undef __GLIBC_USE_DEPRECATED_SCANF
+
+
+
+
+#define __KERNEL_STRICT_NAMES 
+# 168 "/usr/include/features.h" 3 4
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+# 182 "/usr/include/features.h" 3 4
+#define __glibc_clang_prereq(maj,min) 0
+
+
+
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+# 235 "/usr/include/features.h" 3 4
+#undef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+
+
+
+
+
+
+
+#define __GLIBC_USE_ISOC2X 0
+
+
+
+
+
+#define __USE_ISOC11 1
+
+
+
+
+
+
+#define __USE_ISOC99 1
+
+
+
+
+
+
+#define __USE_ISOC95 1
+# 285 "/usr/include/features.h" 3 4
+#define __USE_POSIX_IMPLICITLY 1
+
+#undef _POSIX_SOURCE
+#define _POSIX_SOURCE 1
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+# 325 "/usr/include/features.h" 3 4
+#define __USE_POSIX 1
+
+
+
+#define __USE_POSIX2 1
+
+
+
+#define __USE_POSIX199309 1
+
+
+
+#define __USE_POSIX199506 1
+
+
+
+#define __USE_XOPEN2K 1
+#undef __USE_ISOC95
+#define __USE_ISOC95 1
+#undef __USE_ISOC99
+#define __USE_ISOC99 1
+
+
+
+#define __USE_XOPEN2K8 1
+#undef _ATFILE_SOURCE
+#define _ATFILE_SOURCE 1
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+
+
+#define __USE_MISC 1
+
+
+
+#define __USE_ATFILE 1
+# 431 "/usr/include/features.h" 3 4
+#define __USE_FORTIFY_LEVEL 0
+
+
+
+
+
+
+
+#define __GLIBC_USE_DEPRECATED_GETS 0
+# 462 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+# 475 "/usr/include/features.h" 3 4
+#undef __GNU_LIBRARY__
+#define __GNU_LIBRARY__ 6
+
+
+
+#define __GLIBC__ 2
+#define __GLIBC_MINOR__ 36
+
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define _SYS_CDEFS_H 1
+# 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#undef __P
+#undef __PMT
+# 45 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+
+
+
+
+#define __glibc_has_builtin(name) __has_builtin (name)
+
+
+
+
+
+
+#define __glibc_has_extension(ext) 0
+
+
+
+
+
+
+
+#define __LEAF , __leaf__
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+# 79 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define __THROWNL __attribute__ ((__nothrow__))
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+# 118 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __P(args) args
+#define __PMT(args) args
+
+
+
+
+#define __CONCAT(x,y) x ## y
+#define __STRING(x) #x
+
+
+#define __ptr_t void *
+
+
+
+
+
+
+
+#define __BEGIN_DECLS 
+#define __END_DECLS 
+
+
+
+
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+
+
+
+
+
+
+
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define __glibc_objsize(__o) __bos (__o)
+# 205 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+# 218 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __flexarr []
+#define __glibc_c99_flexarr_available 1
+# 249 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+
+
+
+
+
+
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+
+
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+# 283 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+
+
+
+
+
+
+
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+# 300 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+# 310 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_pure__ __attribute__ ((__pure__))
+
+
+
+
+
+
+#define __attribute_const__ __attribute__ ((__const__))
+
+
+
+
+
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+# 332 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_used__ __attribute__ ((__used__))
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+
+
+
+
+
+
+
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+# 351 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+# 364 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+# 374 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+# 386 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+
+
+
+
+
+#define __nonnull(params) __attribute_nonnull__ (params)
+
+
+
+
+
+
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+# 408 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+# 417 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __wur 
+
+
+
+
+
+
+
+#undef __always_inline
+#define __always_inline __inline __attribute__ ((__always_inline__))
+# 435 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+# 453 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+# 463 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __fortify_function __extern_always_inline __attribute_artificial__
+
+
+
+
+
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+# 497 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __restrict_arr __restrict
+# 512 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+# 534 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+
+
+
+
+
+#undef __attribute_copy__
+
+
+
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 618 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define __LDBL_REDIR(name,proto) name proto
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __LDBL_REDIR2_DECL(name) 
+#define __LDBL_REDIR_DECL(name) 
+
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+# 637 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+# 656 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __HAVE_GENERIC_SELECTION 1
+# 667 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_access(x) __attribute__ ((__access__ x))
+
+
+
+
+
+
+
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+
+
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+# 691 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+# 702 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+# 490 "/usr/include/features.h" 2 3 4
+# 505 "/usr/include/features.h" 3 4
+#define __USE_EXTERN_INLINES 1
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 3 4
+#define __stub___compat_bdflush 
+#define __stub_chflags 
+#define __stub_fchflags 
+#define __stub_gtty 
+#define __stub_revoke 
+#define __stub_setlogin 
+#define __stub_sigreturn 
+#define __stub_stty 
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/limits.h" 2 3 4
+
+
+
+
+
+#define MB_LEN_MAX 16
+# 132 "/usr/include/limits.h" 3 4
+#define LLONG_MIN (-LLONG_MAX-1)
+
+
+#define LLONG_MAX __LONG_LONG_MAX__
+
+
+#define ULLONG_MAX (LLONG_MAX * 2ULL + 1)
+# 195 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+#define _BITS_POSIX1_LIM_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 28 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+
+
+
+
+#define _POSIX_AIO_LISTIO_MAX 2
+
+
+#define _POSIX_AIO_MAX 1
+
+
+#define _POSIX_ARG_MAX 4096
+
+
+
+#define _POSIX_CHILD_MAX 25
+
+
+
+
+
+#define _POSIX_DELAYTIMER_MAX 32
+
+
+
+#define _POSIX_HOST_NAME_MAX 255
+
+
+#define _POSIX_LINK_MAX 8
+
+
+#define _POSIX_LOGIN_NAME_MAX 9
+
+
+#define _POSIX_MAX_CANON 255
+
+
+
+#define _POSIX_MAX_INPUT 255
+
+
+#define _POSIX_MQ_OPEN_MAX 8
+
+
+#define _POSIX_MQ_PRIO_MAX 32
+
+
+#define _POSIX_NAME_MAX 14
+
+
+
+#define _POSIX_NGROUPS_MAX 8
+
+
+
+
+
+
+#define _POSIX_OPEN_MAX 20
+# 97 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+#define _POSIX_PATH_MAX 256
+
+
+#define _POSIX_PIPE_BUF 512
+
+
+
+#define _POSIX_RE_DUP_MAX 255
+
+
+#define _POSIX_RTSIG_MAX 8
+
+
+#define _POSIX_SEM_NSEMS_MAX 256
+
+
+#define _POSIX_SEM_VALUE_MAX 32767
+
+
+#define _POSIX_SIGQUEUE_MAX 32
+
+
+#define _POSIX_SSIZE_MAX 32767
+
+
+#define _POSIX_STREAM_MAX 8
+
+
+#define _POSIX_SYMLINK_MAX 255
+
+
+
+#define _POSIX_SYMLOOP_MAX 8
+
+
+#define _POSIX_TIMER_MAX 32
+
+
+#define _POSIX_TTY_NAME_MAX 9
+
+
+
+#define _POSIX_TZNAME_MAX 6
+# 157 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+#define _POSIX_CLOCKRES_MIN 20000000
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+#define __undef_NR_OPEN 
+
+
+#define __undef_LINK_MAX 
+
+
+#define __undef_OPEN_MAX 
+
+
+#define __undef_ARG_MAX 
+
+
+
+# 1 "/usr/include/linux/limits.h" 1 3 4
+
+
+#define _LINUX_LIMITS_H 
+
+#define NR_OPEN 1024
+
+#define NGROUPS_MAX 65536
+#define ARG_MAX 131072
+#define LINK_MAX 127
+#define MAX_CANON 255
+#define MAX_INPUT 255
+#define NAME_MAX 255
+#define PATH_MAX 4096
+#define PIPE_BUF 4096
+#define XATTR_NAME_MAX 255
+#define XATTR_SIZE_MAX 65536
+#define XATTR_LIST_MAX 65536
+
+#define RTSIG_MAX 32
+# 39 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+
+
+
+#undef NR_OPEN
+#undef __undef_NR_OPEN
+
+
+
+#undef LINK_MAX
+#undef __undef_LINK_MAX
+
+
+
+#undef OPEN_MAX
+#undef __undef_OPEN_MAX
+
+
+
+#undef ARG_MAX
+#undef __undef_ARG_MAX
+
+
+
+#define _POSIX_THREAD_KEYS_MAX 128
+
+#define PTHREAD_KEYS_MAX 1024
+
+
+#define _POSIX_THREAD_DESTRUCTOR_ITERATIONS 4
+
+#define PTHREAD_DESTRUCTOR_ITERATIONS _POSIX_THREAD_DESTRUCTOR_ITERATIONS
+
+
+#define _POSIX_THREAD_THREADS_MAX 64
+
+#undef PTHREAD_THREADS_MAX
+
+
+
+#define AIO_PRIO_DELTA_MAX 20
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h" 3 4
+#define PTHREAD_STACK_MIN 16384
+# 30 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 2 3 4
+# 82 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+
+
+#define DELAYTIMER_MAX 2147483647
+
+
+#define TTY_NAME_MAX 32
+
+
+#define LOGIN_NAME_MAX 256
+
+
+#define HOST_NAME_MAX 64
+
+
+#define MQ_PRIO_MAX 32768
+
+
+#define SEM_VALUE_MAX (2147483647)
+# 162 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+
+
+
+
+
+
+
+#define SSIZE_MAX LONG_MAX
+# 196 "/usr/include/limits.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h" 3 4
+#define _BITS_POSIX2_LIM_H 1
+
+
+
+#define _POSIX2_BC_BASE_MAX 99
+
+
+#define _POSIX2_BC_DIM_MAX 2048
+
+
+#define _POSIX2_BC_SCALE_MAX 99
+
+
+#define _POSIX2_BC_STRING_MAX 1000
+
+
+
+#define _POSIX2_COLL_WEIGHTS_MAX 2
+
+
+
+#define _POSIX2_EXPR_NEST_MAX 32
+
+
+#define _POSIX2_LINE_MAX 2048
+
+
+
+#define _POSIX2_RE_DUP_MAX 255
+
+
+
+#define _POSIX2_CHARCLASS_NAME_MAX 14
+
+
+
+
+
+
+
+#define BC_BASE_MAX _POSIX2_BC_BASE_MAX
+
+
+#define BC_DIM_MAX _POSIX2_BC_DIM_MAX
+
+
+#define BC_SCALE_MAX _POSIX2_BC_SCALE_MAX
+
+
+#define BC_STRING_MAX _POSIX2_BC_STRING_MAX
+
+
+#define COLL_WEIGHTS_MAX 255
+
+
+#define EXPR_NEST_MAX _POSIX2_EXPR_NEST_MAX
+
+
+#define LINE_MAX _POSIX2_LINE_MAX
+
+
+#define CHARCLASS_NAME_MAX 2048
+
+
+
+#define RE_DUP_MAX (0x7fff)
+# 200 "/usr/include/limits.h" 2 3 4
+# 204 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 2 3 4
+#undef _GCC_NEXT_LIMITS_H
+# 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 60 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+#define _LIMITS_H___ 
+
+
+#undef CHAR_BIT
+#define CHAR_BIT __CHAR_BIT__
+
+
+
+
+
+
+
+#undef SCHAR_MIN
+#define SCHAR_MIN (-SCHAR_MAX - 1)
+#undef SCHAR_MAX
+#define SCHAR_MAX __SCHAR_MAX__
+
+
+#undef UCHAR_MAX
+
+
+
+#define UCHAR_MAX (SCHAR_MAX * 2 + 1)
+# 96 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+#undef CHAR_MIN
+#define CHAR_MIN SCHAR_MIN
+#undef CHAR_MAX
+#define CHAR_MAX SCHAR_MAX
+
+
+
+#undef SHRT_MIN
+#define SHRT_MIN (-SHRT_MAX - 1)
+#undef SHRT_MAX
+#define SHRT_MAX __SHRT_MAX__
+
+
+#undef USHRT_MAX
+
+
+
+#define USHRT_MAX (SHRT_MAX * 2 + 1)
+
+
+
+#undef INT_MIN
+#define INT_MIN (-INT_MAX - 1)
+#undef INT_MAX
+#define INT_MAX __INT_MAX__
+
+
+#undef UINT_MAX
+#define UINT_MAX (INT_MAX * 2U + 1U)
+
+
+
+#undef LONG_MIN
+#define LONG_MIN (-LONG_MAX - 1L)
+#undef LONG_MAX
+#define LONG_MAX __LONG_MAX__
+
+
+#undef ULONG_MAX
+#define ULONG_MAX (LONG_MAX * 2UL + 1UL)
+
+
+
+#undef LLONG_MIN
+#define LLONG_MIN (-LLONG_MAX - 1LL)
+#undef LLONG_MAX
+#define LLONG_MAX __LONG_LONG_MAX__
+
+
+#undef ULLONG_MAX
+#define ULLONG_MAX (LLONG_MAX * 2ULL + 1ULL)
+# 83 "./nohtyP.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+#define _STDARG_H 
+#define _ANSI_STDARG_H_ 
+
+#undef __need___va_list
+
+
+
+
+#define __GNUC_VA_LIST 
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+
+
+
+
+
+
+#define va_start(v,l) __builtin_va_start(v,l)
+#define va_end(v) __builtin_va_end(v)
+#define va_arg(v,l) __builtin_va_arg(v,l)
+
+
+#define va_copy(d,s) __builtin_va_copy(d,s)
+
+#define __va_copy(d,s) __builtin_va_copy(d,s)
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+
+
+
+
+
+#define _VA_LIST_ 
+
+
+#define _VA_LIST 
+
+
+#define _VA_LIST_DEFINED 
+
+
+#define _VA_LIST_T_H 
+
+
+#define __va_list__ 
+# 84 "./nohtyP.h" 2
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+#define _SYS_TYPES_H 1
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define _BITS_TYPES_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 109 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __S16_TYPE short int
+#define __U16_TYPE unsigned short int
+#define __S32_TYPE int
+#define __U32_TYPE unsigned int
+#define __SLONGWORD_TYPE long int
+#define __ULONGWORD_TYPE unsigned long int
+# 128 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __SQUAD_TYPE long int
+#define __UQUAD_TYPE unsigned long int
+#define __SWORD_TYPE long int
+#define __UWORD_TYPE unsigned long int
+#define __SLONG32_TYPE int
+#define __ULONG32_TYPE unsigned int
+#define __S64_TYPE long int
+#define __U64_TYPE unsigned long int
+
+#define __STD_TYPE typedef
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define _BITS_TYPESIZES_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+
+
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define __UID_T_TYPE __U32_TYPE
+#define __GID_T_TYPE __U32_TYPE
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __MODE_T_TYPE __U32_TYPE
+
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+
+
+
+
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define __PID_T_TYPE __S32_TYPE
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __ID_T_TYPE __U32_TYPE
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define __USECONDS_T_TYPE __U32_TYPE
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define __DADDR_T_TYPE __S32_TYPE
+#define __KEY_T_TYPE __S32_TYPE
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __TIMER_T_TYPE void *
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+
+
+
+
+
+#define __OFF_T_MATCHES_OFF64_T 1
+
+
+#define __INO_T_MATCHES_INO64_T 1
+
+
+#define __RLIM_T_MATCHES_RLIM64_T 1
+
+
+#define __STATFS_MATCHES_STATFS64 1
+
+
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+# 103 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __FD_SETSIZE 1024
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/time64.h" 3 4
+#define _BITS_TIME64_H 1
+
+
+
+
+
+#define __TIME64_T_TYPE __TIME_T_TYPE
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 226 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#undef __STD_TYPE
+# 30 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+#define __u_char_defined 
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+
+
+
+#define __ino_t_defined 
+
+
+
+
+
+
+
+typedef __dev_t dev_t;
+#define __dev_t_defined 
+
+
+
+typedef __gid_t gid_t;
+#define __gid_t_defined 
+
+
+
+typedef __mode_t mode_t;
+#define __mode_t_defined 
+
+
+
+typedef __nlink_t nlink_t;
+#define __nlink_t_defined 
+
+
+
+typedef __uid_t uid_t;
+#define __uid_t_defined 
+
+
+
+
+typedef __off_t off_t;
+
+
+
+#define __off_t_defined 
+
+
+
+
+
+
+
+typedef __pid_t pid_t;
+#define __pid_t_defined 
+
+
+
+
+typedef __id_t id_t;
+#define __id_t_defined 
+
+
+
+typedef __ssize_t ssize_t;
+#define __ssize_t_defined 
+
+
+
+
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+#define __daddr_t_defined 
+
+
+
+
+typedef __key_t key_t;
+#define __key_t_defined 
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+#define __clock_t_defined 1
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+#define __clockid_t_defined 1
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+
+#define __time_t_defined 1
+
+
+
+
+
+
+
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+#define __timer_t_defined 1
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 143 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 185 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __size_t__ 
+#define __SIZE_T__ 
+#define _SIZE_T 
+#define _SYS_SIZE_T_H 
+#define _T_SIZE_ 
+#define _T_SIZE 
+#define __SIZE_T 
+#define _SIZE_T_ 
+#define _BSD_SIZE_T_ 
+#define _SIZE_T_DEFINED_ 
+#define _SIZE_T_DEFINED 
+#define _BSD_SIZE_T_DEFINED_ 
+#define _SIZE_T_DECLARED 
+#define __DEFINED_size_t 
+#define ___int_size_t_h 
+#define _GCC_SIZE_T 
+#define _SIZET_ 
+
+
+
+
+
+
+#define __size_t 
+
+
+
+
+
+typedef long unsigned int size_t;
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+#define _BITS_STDINT_INTN_H 1
+
+
+
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+
+
+
+
+
+
+#define __BIT_TYPES_DEFINED__ 1
+
+
+
+
+# 1 "/usr/include/endian.h" 1 3 4
+# 19 "/usr/include/endian.h" 3 4
+#define _ENDIAN_H 1
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+#define _BITS_ENDIAN_H 1
+# 30 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+#define __LITTLE_ENDIAN 1234
+#define __BIG_ENDIAN 4321
+#define __PDP_ENDIAN 3412
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+
+#define _BITS_ENDIANNESS_H 1
+
+
+
+
+
+
+#define __BYTE_ORDER __LITTLE_ENDIAN
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+
+
+
+
+#define __FLOAT_WORD_ORDER __BYTE_ORDER
+
+
+
+#define __LONG_LONG_PAIR(HI,LO) LO, HI
+# 25 "/usr/include/endian.h" 2 3 4
+
+
+#define LITTLE_ENDIAN __LITTLE_ENDIAN
+#define BIG_ENDIAN __BIG_ENDIAN
+#define PDP_ENDIAN __PDP_ENDIAN
+#define BYTE_ORDER __BYTE_ORDER
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+#define _BITS_BYTESWAP_H 1
+
+
+
+
+
+#define __bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))
+
+
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+#define __bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+
+
+#define __bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56) | (((x) & 0x00ff000000000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+#define _BITS_UINTN_IDENTITY_H 1
+
+
+
+
+
+
+
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+
+
+#define htobe16(x) __bswap_16 (x)
+#define htole16(x) __uint16_identity (x)
+#define be16toh(x) __bswap_16 (x)
+#define le16toh(x) __uint16_identity (x)
+
+#define htobe32(x) __bswap_32 (x)
+#define htole32(x) __uint32_identity (x)
+#define be32toh(x) __bswap_32 (x)
+#define le32toh(x) __uint32_identity (x)
+
+#define htobe64(x) __bswap_64 (x)
+#define htole64(x) __uint64_identity (x)
+#define be64toh(x) __bswap_64 (x)
+#define le64toh(x) __uint64_identity (x)
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+#define _SYS_SELECT_H 1
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/select.h" 3 4
+#define __FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)
+
+
+
+
+
+
+#define __FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))
+
+#define __FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))
+
+#define __FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+#define __sigset_t_defined 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+#define ____sigset_t_defined 
+
+#define _SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+#define __timeval_defined 1
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+
+
+#define _STRUCT_TIMESPEC 1
+
+
+
+
+
+
+
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+#define __suseconds_t_defined 
+
+
+
+
+typedef long int __fd_mask;
+
+
+#undef __NFDBITS
+
+#define __NFDBITS (8 * (int) sizeof (__fd_mask))
+#define __FD_ELT(d) ((d) / __NFDBITS)
+#define __FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))
+
+
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+#define __FDS_BITS(set) ((set)->__fds_bits)
+
+  } fd_set;
+
+
+#define FD_SETSIZE __FD_SETSIZE
+
+
+
+typedef __fd_mask fd_mask;
+
+
+#define NFDBITS __NFDBITS
+
+
+
+
+#define FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)
+#define FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)
+#define FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)
+#define FD_ZERO(fdsetp) __FD_ZERO (fdsetp)
+
+
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+#define __blksize_t_defined 
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+#define __blkcnt_t_defined 
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+#define __fsblkcnt_t_defined 
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+#define __fsfilcnt_t_defined 
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+#define _BITS_PTHREADTYPES_COMMON_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+#define _THREAD_SHARED_TYPES_H 1
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+#define _BITS_PTHREADTYPES_ARCH_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+
+
+
+#define __SIZEOF_PTHREAD_MUTEX_T 40
+#define __SIZEOF_PTHREAD_ATTR_T 56
+#define __SIZEOF_PTHREAD_RWLOCK_T 56
+#define __SIZEOF_PTHREAD_BARRIER_T 32
+# 41 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+#define __SIZEOF_PTHREAD_MUTEXATTR_T 4
+#define __SIZEOF_PTHREAD_COND_T 48
+#define __SIZEOF_PTHREAD_CONDATTR_T 4
+#define __SIZEOF_PTHREAD_RWLOCKATTR_T 8
+#define __SIZEOF_PTHREAD_BARRIERATTR_T 4
+
+#define __LOCK_ALIGNMENT 
+#define __ONCE_ALIGNMENT 
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+#define _BITS_ATOMIC_WIDE_COUNTER_H 
+
+
+
+
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+#define _THREAD_MUTEX_INTERNAL_H 1
+
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+#define __PTHREAD_MUTEX_HAVE_PREV 1
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+
+
+#define __PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+#define _RWLOCK_INTERNAL_H 
+
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+#define __PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+
+
+#define __PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+
+#define __ONCE_FLAG_INIT { 0 }
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+#define __have_pthread_attr_t 1
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 85 "./nohtyP.h" 2
+# 97 "./nohtyP.h"
+#define ypAPI extern __attribute__((visibility("default")))
+# 114 "./nohtyP.h"
+
+# 114 "./nohtyP.h"
+typedef struct _yp_initialize_parameters_t yp_initialize_parameters_t;
+typedef struct _yp_generator_decl_t yp_generator_decl_t;
+typedef struct _yp_function_decl_t yp_function_decl_t;
+typedef struct _yp_state_decl_t yp_state_decl_t;
+# 127 "./nohtyP.h"
+extern __attribute__((visibility("default"))) void yp_initialize(const yp_initialize_parameters_t *args);
+# 139 "./nohtyP.h"
+typedef struct _ypObject ypObject;
+
+
+extern __attribute__((visibility("default"))) ypObject *const yp_None;
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_incref(ypObject *x);
+
+
+extern __attribute__((visibility("default"))) void yp_increfN(int n, ...);
+extern __attribute__((visibility("default"))) void yp_increfNV(int n, va_list args);
+
+
+
+extern __attribute__((visibility("default"))) void yp_decref(ypObject *x);
+
+
+extern __attribute__((visibility("default"))) void yp_decrefN(int n, ...);
+extern __attribute__((visibility("default"))) void yp_decrefNV(int n, va_list args);
+
+
+extern __attribute__((visibility("default"))) int yp_isexceptionC(ypObject *x);
+# 175 "./nohtyP.h"
+typedef signed char yp_int8_t;
+typedef unsigned char yp_uint8_t;
+typedef short yp_int16_t;
+typedef unsigned short yp_uint16_t;
+
+typedef int yp_int32_t;
+typedef unsigned int yp_uint32_t;
+
+
+
+
+typedef long long yp_int64_t;
+typedef unsigned long long yp_uint64_t;
+typedef float yp_float32_t;
+typedef double yp_float64_t;
+
+
+
+typedef ssize_t yp_ssize_t;
+#define yp_SSIZE_T_MAX SSIZE_MAX
+
+
+
+
+
+
+
+#define yp_SSIZE_T_MIN (-yp_SSIZE_T_MAX - 1)
+typedef yp_ssize_t yp_hash_t;
+
+
+typedef yp_int64_t yp_int_t;
+#define yp_INT_T_MAX LLONG_MAX
+#define yp_INT_T_MIN LLONG_MIN
+typedef yp_float64_t yp_float_t;
+# 221 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_intC(yp_int_t value);
+extern __attribute__((visibility("default"))) ypObject *yp_intstoreC(yp_int_t value);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_int_baseC(ypObject *x, yp_int_t base);
+extern __attribute__((visibility("default"))) ypObject *yp_intstore_baseC(ypObject *x, yp_int_t base);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_int(ypObject *x);
+extern __attribute__((visibility("default"))) ypObject *yp_intstore(ypObject *x);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_floatCF(yp_float_t value);
+extern __attribute__((visibility("default"))) ypObject *yp_floatstoreCF(yp_float_t value);
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_float(ypObject *x);
+extern __attribute__((visibility("default"))) ypObject *yp_floatstore(ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_generatorC(yp_generator_decl_t *declaration);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_rangeC3(yp_int_t start, yp_int_t stop, yp_int_t step);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_rangeC(yp_int_t stop);
+
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_bytesC(yp_ssize_t len, const yp_uint8_t *source);
+extern __attribute__((visibility("default"))) ypObject *yp_bytearrayC(yp_ssize_t len, const yp_uint8_t *source);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_bytes3(ypObject *source, ypObject *encoding, ypObject *errors);
+extern __attribute__((visibility("default"))) ypObject *yp_bytearray3(ypObject *source, ypObject *encoding, ypObject *errors);
+# 277 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_bytes(ypObject *source);
+extern __attribute__((visibility("default"))) ypObject *yp_bytearray(ypObject *source);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_bytearray0(void);
+
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_str_frombytesC4(
+        yp_ssize_t len, const yp_uint8_t *source, ypObject *encoding, ypObject *errors);
+extern __attribute__((visibility("default"))) ypObject *yp_chrarray_frombytesC4(
+        yp_ssize_t len, const yp_uint8_t *source, ypObject *encoding, ypObject *errors);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_str_frombytesC2(yp_ssize_t len, const yp_uint8_t *source);
+extern __attribute__((visibility("default"))) ypObject *yp_chrarray_frombytesC2(yp_ssize_t len, const yp_uint8_t *source);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_str3(ypObject *source, ypObject *encoding, ypObject *errors);
+extern __attribute__((visibility("default"))) ypObject *yp_chrarray3(ypObject *source, ypObject *encoding, ypObject *errors);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_str(ypObject *object);
+extern __attribute__((visibility("default"))) ypObject *yp_chrarray(ypObject *object);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_chrarray0(void);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_chrC(yp_int_t i);
+# 328 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_bytesviewC3(ypObject *source, yp_ssize_t i, yp_ssize_t j);
+extern __attribute__((visibility("default"))) ypObject *yp_strviewC3(ypObject *source, yp_ssize_t i, yp_ssize_t j);
+# 340 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_intern(ypObject *s);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_internC(yp_ssize_t len, const yp_uint8_t *source);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_tupleN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_tupleNV(int n, va_list args);
+extern __attribute__((visibility("default"))) ypObject *yp_listN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_listNV(int n, va_list args);
+
+
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_tuple_repeatCN(yp_ssize_t factor, int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_tuple_repeatCNV(yp_ssize_t factor, int n, va_list args);
+extern __attribute__((visibility("default"))) ypObject *yp_list_repeatCN(yp_ssize_t factor, int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_list_repeatCNV(yp_ssize_t factor, int n, va_list args);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_tuple(ypObject *iterable);
+extern __attribute__((visibility("default"))) ypObject *yp_list(ypObject *iterable);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_frozensetN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_frozensetNV(int n, va_list args);
+extern __attribute__((visibility("default"))) ypObject *yp_setN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_setNV(int n, va_list args);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_frozenset(ypObject *iterable);
+extern __attribute__((visibility("default"))) ypObject *yp_set(ypObject *iterable);
+
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_set_fromlength_hintC(yp_ssize_t length_hint);
+
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_frozendictK(int k, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_frozendictKV(int k, va_list args);
+extern __attribute__((visibility("default"))) ypObject *yp_dictK(int k, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_dictKV(int k, va_list args);
+
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_frozendict_fromkeysN(ypObject *value, int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_frozendict_fromkeysNV(ypObject *value, int n, va_list args);
+extern __attribute__((visibility("default"))) ypObject *yp_dict_fromkeysN(ypObject *value, int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_dict_fromkeysNV(ypObject *value, int n, va_list args);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_frozendict_fromkeys(ypObject *iterable, ypObject *value);
+extern __attribute__((visibility("default"))) ypObject *yp_dict_fromkeys(ypObject *iterable, ypObject *value);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_frozendict(ypObject *x);
+extern __attribute__((visibility("default"))) ypObject *yp_dict(ypObject *x);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_dict_fromlength_hintC(yp_ssize_t length_hint);
+
+
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_frozenintdict(ypObject *x);
+extern __attribute__((visibility("default"))) ypObject *yp_intdict(ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_intdict_fromlength_hintC(yp_ssize_t length_hint);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_functionC(yp_function_decl_t *declaration);
+# 447 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *const yp_True;
+extern __attribute__((visibility("default"))) ypObject *const yp_False;
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_bool(ypObject *x);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_not(ypObject *x);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_or(ypObject *x, ypObject *y);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_orN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_orNV(int n, va_list args);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_anyN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_anyNV(int n, va_list args);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_any(ypObject *iterable);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_and(ypObject *x, ypObject *y);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_andN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_andNV(int n, va_list args);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_allN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_allNV(int n, va_list args);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_all(ypObject *iterable);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_lt(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_le(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_eq(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_ne(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_ge(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_gt(ypObject *x, ypObject *y);
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_max_keyN(ypObject *key, int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_max_keyNV(ypObject *key, int n, va_list args);
+extern __attribute__((visibility("default"))) ypObject *yp_min_keyN(ypObject *key, int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_min_keyNV(ypObject *key, int n, va_list args);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_maxN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_maxNV(int n, va_list args);
+extern __attribute__((visibility("default"))) ypObject *yp_minN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_minNV(int n, va_list args);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_max_key(ypObject *iterable, ypObject *key);
+extern __attribute__((visibility("default"))) ypObject *yp_min_key(ypObject *iterable, ypObject *key);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_max(ypObject *iterable);
+extern __attribute__((visibility("default"))) ypObject *yp_min(ypObject *iterable);
+# 538 "./nohtyP.h"
+extern __attribute__((visibility("default"))) yp_hash_t yp_hashC(ypObject *x, ypObject **exc);
+
+
+
+
+extern __attribute__((visibility("default"))) yp_hash_t yp_currenthashC(ypObject *x, ypObject **exc);
+# 556 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_iter(ypObject *x);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_iter2(ypObject *callable, ypObject *sentinel);
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_unpackN(ypObject *iterable, int n, ...);
+extern __attribute__((visibility("default"))) void yp_unpackNV(ypObject *iterable, int n, va_list args);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_filter(ypObject *function, ypObject *iterable);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_filterfalse(ypObject *function, ypObject *iterable);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_reversed(ypObject *iterable);
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_sorted3(ypObject *iterable, ypObject *key, ypObject *reverse);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_sorted(ypObject *iterable);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_zipN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_zipNV(int n, va_list args);
+
+typedef struct _yp_generator_decl_t {
+
+
+
+
+
+
+    ypObject *(*func)(ypObject *g, ypObject *value);
+
+
+
+    yp_ssize_t length_hint;
+
+
+
+    void *state;
+
+
+    yp_state_decl_t *state_decl;
+} yp_generator_decl_t;
+# 629 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_send(ypObject *iterator, ypObject *value);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_next(ypObject *iterator);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_next2(ypObject *iterator, ypObject *default_);
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_throw(ypObject *iterator, ypObject *exception);
+
+
+
+
+
+extern __attribute__((visibility("default"))) yp_ssize_t yp_length_hintC(ypObject *iterator, ypObject **exc);
+
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_close(ypObject *iterator, ypObject **exc);
+# 665 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_contains(ypObject *container, ypObject *x);
+extern __attribute__((visibility("default"))) ypObject *yp_in(ypObject *x, ypObject *container);
+
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_contains_manyC(
+        ypObject *container, yp_ssize_t n, ypObject *const *keys, ypObject **out);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_not_in(ypObject *x, ypObject *container);
+
+
+extern __attribute__((visibility("default"))) yp_ssize_t yp_lenC(ypObject *container, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_clear(ypObject *container, ypObject **exc);
+
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_reserveC(ypObject *container, yp_ssize_t n, ypObject **exc);
+# 708 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_concat(ypObject *sequence, ypObject *x);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_repeatC(ypObject *sequence, yp_ssize_t factor);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_getindexC(ypObject *sequence, yp_ssize_t i);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_getsliceC4(ypObject *sequence, yp_ssize_t i, yp_ssize_t j, yp_ssize_t k);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_getitem(ypObject *sequence, ypObject *i);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_getdefault(ypObject *sequence, ypObject *i, ypObject *default_);
+
+
+
+
+
+extern __attribute__((visibility("default"))) yp_ssize_t yp_findC5(
+        ypObject *sequence, ypObject *x, yp_ssize_t i, yp_ssize_t j, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) yp_ssize_t yp_findC(ypObject *sequence, ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) yp_ssize_t yp_indexC5(
+        ypObject *sequence, ypObject *x, yp_ssize_t i, yp_ssize_t j, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_ssize_t yp_indexC(ypObject *sequence, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) yp_ssize_t yp_rfindC5(
+        ypObject *sequence, ypObject *x, yp_ssize_t i, yp_ssize_t j, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_ssize_t yp_rfindC(ypObject *sequence, ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_ssize_t yp_rindexC5(
+        ypObject *sequence, ypObject *x, yp_ssize_t i, yp_ssize_t j, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_ssize_t yp_rindexC(ypObject *sequence, ypObject *x, ypObject **exc);
+
+
+
+
+extern __attribute__((visibility("default"))) yp_ssize_t yp_countC5(
+        ypObject *sequence, ypObject *x, yp_ssize_t i, yp_ssize_t j, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) yp_ssize_t yp_countC(ypObject *sequence, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_setindexC(ypObject *sequence, yp_ssize_t i, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_setsliceC6(
+        ypObject *sequence, yp_ssize_t i, yp_ssize_t j, yp_ssize_t k, ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_setitem(ypObject *sequence, ypObject *i, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_delindexC(ypObject *sequence, yp_ssize_t i, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_dropindexC(ypObject *sequence, yp_ssize_t i, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_delsliceC5(
+        ypObject *sequence, yp_ssize_t i, yp_ssize_t j, yp_ssize_t k, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_delitem(ypObject *sequence, ypObject *i, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_dropitem(ypObject *sequence, ypObject *i, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_append(ypObject *sequence, ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_push(ypObject *sequence, ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_extend(ypObject *sequence, ypObject *t, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_irepeatC(ypObject *sequence, yp_ssize_t factor, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_insertC(ypObject *sequence, yp_ssize_t i, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_popindexC(ypObject *sequence, yp_ssize_t i);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_pop(ypObject *sequence);
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_remove(ypObject *sequence, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_discard(ypObject *sequence, ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_reverse(ypObject *sequence, ypObject **exc);
+# 834 "./nohtyP.h"
+#define yp_SLICE_DEFAULT yp_SSIZE_T_MIN
+# 843 "./nohtyP.h"
+#define yp_SLICE_LAST yp_SSIZE_T_MAX
+# 856 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *const yp_tuple_empty;
+extern __attribute__((visibility("default"))) ypObject *const yp_range_empty;
+# 867 "./nohtyP.h"
+extern __attribute__((visibility("default"))) void yp_sort4(ypObject *sq, ypObject *key, ypObject *reverse, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_sort(ypObject *sq, ypObject **exc);
+# 882 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_isdisjoint(ypObject *set, ypObject *x);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_issubset(ypObject *set, ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_lt(ypObject *set, ypObject *x);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_issuperset(ypObject *set, ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_gt(ypObject *set, ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_union(ypObject *set, ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_intersection(ypObject *set, ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_difference(ypObject *set, ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_symmetric_difference(ypObject *set, ypObject *x);
+
+
+extern __attribute__((visibility("default"))) void yp_update(ypObject *set, ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_intersection_update(ypObject *set, ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_difference_update(ypObject *set, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_symmetric_difference_update(ypObject *set, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_push(ypObject *set, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_pushunique(ypObject *set, ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_remove(ypObject *set, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_discard(ypObject *set, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_pop(ypObject *set);
+
+
+extern __attribute__((visibility("default"))) ypObject *const yp_frozenset_empty;
+# 961 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_getitem(ypObject *mapping, ypObject *key);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_getdefault(ypObject *mapping, ypObject *key, ypObject *default_);
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_getitem_manyC(ypObject *mapping, yp_ssize_t n, ypObject *const *keys, ypObject **out);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_iter_items(ypObject *mapping);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_iter_keys(ypObject *mapping);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_iter_values(ypObject *mapping);
+
+
+extern __attribute__((visibility("default"))) void yp_setitem(ypObject *mapping, ypObject *key, ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_delitem(ypObject *mapping, ypObject *key, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_dropitem(ypObject *mapping, ypObject *key, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_popvalue2(ypObject *mapping, ypObject *key);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_popvalue3(ypObject *mapping, ypObject *key, ypObject *default_);
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_popitem(ypObject *mapping, ypObject **key, ypObject **value);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_setdefault(ypObject *mapping, ypObject *key, ypObject *default_);
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_updateK(ypObject *mapping, ypObject **exc, int k, ...);
+extern __attribute__((visibility("default"))) void yp_updateKV(ypObject *mapping, ypObject **exc, int k, va_list args);
+
+
+extern __attribute__((visibility("default"))) void yp_update(ypObject *mapping, ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) ypObject *const yp_frozendict_empty;
+# 1043 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *const yp_s_ascii;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_latin_1;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_utf_8;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_utf_16;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_utf_16be;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_utf_16le;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_utf_32;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_utf_32be;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_utf_32le;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_ucs_2;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_ucs_4;
+
+
+
+extern __attribute__((visibility("default"))) ypObject *const yp_s_strict;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_replace;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_ignore;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_xmlcharrefreplace;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_backslashreplace;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_surrogateescape;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_surrogatepass;
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_isalnum(ypObject *s);
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_isalpha(ypObject *s);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_isdecimal(ypObject *s);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_isdigit(ypObject *s);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_isidentifier(ypObject *s);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_islower(ypObject *s);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_isnumeric(ypObject *s);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_isprintable(ypObject *s);
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_isspace(ypObject *s);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_isupper(ypObject *s);
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_startswithC4(ypObject *s, ypObject *prefix, yp_ssize_t start, yp_ssize_t end);
+extern __attribute__((visibility("default"))) ypObject *yp_startswith(ypObject *s, ypObject *prefix);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_endswithC4(ypObject *s, ypObject *suffix, yp_ssize_t start, yp_ssize_t end);
+extern __attribute__((visibility("default"))) ypObject *yp_endswith(ypObject *s, ypObject *suffix);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_lower(ypObject *s);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_upper(ypObject *s);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_casefold(ypObject *s);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_swapcase(ypObject *s);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_capitalize(ypObject *s);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_ljustC3(ypObject *s, yp_ssize_t width, yp_int_t ord_fillchar);
+extern __attribute__((visibility("default"))) ypObject *yp_ljustC(ypObject *s, yp_ssize_t width);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_rjustC3(ypObject *s, yp_ssize_t width, yp_int_t ord_fillchar);
+extern __attribute__((visibility("default"))) ypObject *yp_rjustC(ypObject *s, yp_ssize_t width);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_centerC3(ypObject *s, yp_ssize_t width, yp_int_t ord_fillchar);
+extern __attribute__((visibility("default"))) ypObject *yp_centerC(ypObject *s, yp_ssize_t width);
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_expandtabsC(ypObject *s, yp_ssize_t tabsize);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_replaceC4(ypObject *s, ypObject *oldsub, ypObject *newsub, yp_ssize_t count);
+extern __attribute__((visibility("default"))) ypObject *yp_replace(ypObject *s, ypObject *oldsub, ypObject *newsub);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_lstrip2(ypObject *s, ypObject *chars);
+extern __attribute__((visibility("default"))) ypObject *yp_lstrip(ypObject *s);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_rstrip2(ypObject *s, ypObject *chars);
+extern __attribute__((visibility("default"))) ypObject *yp_rstrip(ypObject *s);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_strip2(ypObject *s, ypObject *chars);
+extern __attribute__((visibility("default"))) ypObject *yp_strip(ypObject *s);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_join(ypObject *s, ypObject *iterable);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_joinN(ypObject *s, int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_joinNV(ypObject *s, int n, va_list args);
+
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_partition(
+        ypObject *s, ypObject *sep, ypObject **part0, ypObject **part1, ypObject **part2);
+
+
+
+extern __attribute__((visibility("default"))) void yp_rpartition(
+        ypObject *s, ypObject *sep, ypObject **part0, ypObject **part1, ypObject **part2);
+# 1212 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_splitC3(ypObject *s, ypObject *sep, yp_ssize_t maxsplit);
+extern __attribute__((visibility("default"))) ypObject *yp_split2(ypObject *s, ypObject *sep);
+
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_split(ypObject *s);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_rsplitC3(ypObject *s, ypObject *sep, yp_ssize_t maxsplit);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_splitlines2(ypObject *s, ypObject *keepends);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_encode3(ypObject *s, ypObject *encoding, ypObject *errors);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_encode(ypObject *s);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_decode3(ypObject *b, ypObject *encoding, ypObject *errors);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_decode(ypObject *b);
+
+
+extern __attribute__((visibility("default"))) ypObject *const yp_bytes_empty;
+extern __attribute__((visibility("default"))) ypObject *const yp_str_empty;
+# 1260 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_formatN(ypObject *s, int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_formatNV(ypObject *s, int n, va_list args);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_formatK(ypObject *s, int k, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_formatKV(ypObject *s, int k, va_list args);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_format(ypObject *s, ypObject *sequence, ypObject *mapping);
+# 1286 "./nohtyP.h"
+extern __attribute__((visibility("default"))) int yp_iscallableC(ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_callN(ypObject *c, int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_callNV(ypObject *c, int n, va_list args);
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_call_stars(ypObject *c, ypObject *args, ypObject *kwargs);
+
+
+typedef struct _yp_parameter_decl_t {
+# 1325 "./nohtyP.h"
+    ypObject *name;
+
+
+
+
+    ypObject *default_;
+} yp_parameter_decl_t;
+
+
+typedef struct _yp_function_decl_t {
+# 1345 "./nohtyP.h"
+    ypObject *(*code)(ypObject *f, yp_ssize_t n, ypObject *const *argarray);
+
+
+    yp_uint32_t flags;
+
+
+    yp_int32_t parameters_len;
+
+
+    yp_parameter_decl_t *parameters;
+
+
+
+    void *state;
+
+
+    yp_state_decl_t *state_decl;
+} yp_function_decl_t;
+
+
+extern __attribute__((visibility("default"))) ypObject *const yp_s_slash;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_star;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_star_args;
+extern __attribute__((visibility("default"))) ypObject *const yp_s_star_star_kwargs;
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *const yp_func_chr;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_func_hash;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_func_iscallable;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_func_len;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_func_reversed;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_func_sorted;
+# 1402 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_add(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_sub(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_mul(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_truediv(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_floordiv(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_mod(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) void yp_divmod(ypObject *x, ypObject *y, ypObject **div, ypObject **mod);
+extern __attribute__((visibility("default"))) ypObject *yp_pow(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_pow3(ypObject *x, ypObject *y, ypObject *z);
+extern __attribute__((visibility("default"))) ypObject *yp_neg(ypObject *x);
+extern __attribute__((visibility("default"))) ypObject *yp_pos(ypObject *x);
+extern __attribute__((visibility("default"))) ypObject *yp_abs(ypObject *x);
+extern __attribute__((visibility("default"))) ypObject *yp_lshift(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_rshift(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_amp(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_xor(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_bar(ypObject *x, ypObject *y);
+extern __attribute__((visibility("default"))) ypObject *yp_invert(ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) void yp_iadd(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_isub(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_imul(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_itruediv(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ifloordiv(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_imod(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ipow(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ipow4(ypObject *x, ypObject *y, ypObject *z, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ineg(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ipos(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_iabs(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ilshift(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_irshift(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_iamp(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ixor(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ibar(ypObject *x, ypObject *y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_iinvert(ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_iaddC(ypObject *x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_isubC(ypObject *x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_imulC(ypObject *x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_itruedivC(ypObject *x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ifloordivC(ypObject *x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_imodC(ypObject *x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ipowC(ypObject *x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ipowC4(ypObject *x, yp_int_t y, yp_int_t z, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ilshiftC(ypObject *x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_irshiftC(ypObject *x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_iampC(ypObject *x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ixorC(ypObject *x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ibarC(ypObject *x, yp_int_t y, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_iaddCF(ypObject *x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_isubCF(ypObject *x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_imulCF(ypObject *x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_itruedivCF(ypObject *x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ifloordivCF(ypObject *x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_imodCF(ypObject *x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_ipowCF(ypObject *x, yp_float_t y, ypObject **exc);
+# 1472 "./nohtyP.h"
+extern __attribute__((visibility("default"))) yp_int_t yp_addL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_subL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_mulL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_truedivL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_floordivL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_modL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_divmodL(yp_int_t x, yp_int_t y, yp_int_t *div, yp_int_t *mod, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_powL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_powL4(yp_int_t x, yp_int_t y, yp_int_t z, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_negL(yp_int_t x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_posL(yp_int_t x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_absL(yp_int_t x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_lshiftL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_rshiftL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_ampL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_xorL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_barL(yp_int_t x, yp_int_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_invertL(yp_int_t x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) yp_float_t yp_addLF(yp_float_t x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_subLF(yp_float_t x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_mulLF(yp_float_t x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_truedivLF(yp_float_t x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_floordivLF(yp_float_t x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_modLF(yp_float_t x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_divmodLF(
+              yp_float_t x, yp_float_t y, yp_float_t *div, yp_float_t *mod, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_powLF(yp_float_t x, yp_float_t y, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_negLF(yp_float_t x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_posLF(yp_float_t x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_absLF(yp_float_t x, ypObject **exc);
+
+
+
+
+extern __attribute__((visibility("default"))) yp_int_t yp_asintC(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int8_t yp_asint8C(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_uint8_t yp_asuint8C(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int16_t yp_asint16C(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_uint16_t yp_asuint16C(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int32_t yp_asint32C(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_uint32_t yp_asuint32C(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int64_t yp_asint64C(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_uint64_t yp_asuint64C(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_asfloatC(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float32_t yp_asfloat32C(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float64_t yp_asfloat64C(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_ssize_t yp_asssizeC(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_hash_t yp_ashashC(ypObject *x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_float_t yp_asfloatL(yp_int_t x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_asintLF(yp_float_t x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_roundC(ypObject *x, int ndigits);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_sumN(int n, ...);
+extern __attribute__((visibility("default"))) ypObject *yp_sumNV(int n, va_list args);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_sum_start(ypObject *iterable, ypObject *start);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_sum(ypObject *iterable);
+
+
+
+extern __attribute__((visibility("default"))) yp_int_t yp_bit_lengthC(ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) ypObject *const yp_sys_maxint;
+extern __attribute__((visibility("default"))) ypObject *const yp_sys_minint;
+
+
+extern __attribute__((visibility("default"))) ypObject *const yp_i_neg_one;
+extern __attribute__((visibility("default"))) ypObject *const yp_i_zero;
+extern __attribute__((visibility("default"))) ypObject *const yp_i_one;
+extern __attribute__((visibility("default"))) ypObject *const yp_i_two;
+# 1575 "./nohtyP.h"
+extern __attribute__((visibility("default"))) void yp_freeze(ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) void yp_deepfreeze(ypObject *x, ypObject **exc);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_unfrozen_copy(ypObject *x);
+# 1593 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_unfrozen_deepcopy(ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_frozen_copy(ypObject *x);
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_frozen_deepcopy(ypObject *x);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_copy(ypObject *x);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_deepcopy(ypObject *x);
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_invalidate(ypObject *x, ypObject **exc);
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_deepinvalidate(ypObject *x, ypObject **exc);
+# 1626 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_type(ypObject *object);
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_invalidated;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_exception;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_type;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_NoneType;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_bool;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_int;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_intstore;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_float;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_floatstore;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_iter;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_bytes;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_bytearray;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_str;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_chrarray;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_tuple;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_list;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_frozenset;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_set;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_frozendict;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_dict;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_range;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_function;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_frozenintdict;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_t_intdict;
+# 1704 "./nohtyP.h"
+typedef struct _yp_state_decl_t {
+
+    yp_ssize_t size;
+
+
+
+    yp_ssize_t offsets_len;
+# 1724 "./nohtyP.h"
+    yp_ssize_t offsets[];
+} yp_state_decl_t;
+# 1761 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_miniiter(ypObject *x, yp_uint64_t *state);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_miniiter_next(ypObject *mi, yp_uint64_t *state);
+
+
+
+
+extern __attribute__((visibility("default"))) yp_ssize_t yp_miniiter_length_hintC(ypObject *mi, yp_uint64_t *state, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_miniiter_keys(ypObject *x, yp_uint64_t *state);
+extern __attribute__((visibility("default"))) ypObject *yp_miniiter_values(ypObject *x, yp_uint64_t *state);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_miniiter_items(ypObject *x, yp_uint64_t *state);
+
+
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_miniiter_items_next(
+        ypObject *mi, yp_uint64_t *state, ypObject **key, ypObject **value);
+# 1805 "./nohtyP.h"
+extern __attribute__((visibility("default"))) int yp_o2i_containsC(ypObject *container, yp_int_t x, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_o2i_pushC(ypObject *container, yp_int_t x, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_o2i_popC(ypObject *container, ypObject **exc);
+extern __attribute__((visibility("default"))) yp_int_t yp_o2i_getitemC(ypObject *container, ypObject *key, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_o2i_setitemC(ypObject *container, ypObject *key, yp_int_t x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_o2s_setitemC5(
+        ypObject *container, ypObject *key, yp_ssize_t x_len, const yp_uint8_t *x, ypObject **exc);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_i2o_getitemC(ypObject *container, yp_int_t key);
+extern __attribute__((visibility("default"))) void yp_i2o_setitemC(ypObject *container, yp_int_t key, ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) yp_int_t yp_i2i_getitemC(ypObject *container, yp_int_t key, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_i2i_setitemC(ypObject *container, yp_int_t key, yp_int_t x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) void yp_i2s_setitemC5(
+        ypObject *container, yp_int_t key, yp_ssize_t x_len, const yp_uint8_t *x, ypObject **exc);
+# 1839 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_s2o_getitemC3(ypObject *container, yp_ssize_t key_len, const yp_uint8_t *key);
+extern __attribute__((visibility("default"))) void yp_s2o_setitemC5(ypObject *container, yp_ssize_t key_len, const yp_uint8_t *key,
+             ypObject *x, ypObject **exc);
+
+
+extern __attribute__((visibility("default"))) yp_int_t yp_s2i_getitemC4(
+        ypObject *container, yp_ssize_t key_len, const yp_uint8_t *key, ypObject **exc);
+extern __attribute__((visibility("default"))) void yp_s2i_setitemC5(
+        ypObject *container, yp_ssize_t key_len, const yp_uint8_t *key, yp_int_t x, ypObject **exc);
+# 1892 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *const yp_BaseException;
+extern __attribute__((visibility("default"))) ypObject *const yp_SystemExit;
+extern __attribute__((visibility("default"))) ypObject *const yp_KeyboardInterrupt;
+extern __attribute__((visibility("default"))) ypObject *const yp_GeneratorExit;
+extern __attribute__((visibility("default"))) ypObject *const yp_Exception;
+extern __attribute__((visibility("default"))) ypObject *const yp_StopIteration;
+extern __attribute__((visibility("default"))) ypObject *const yp_ArithmeticError;
+extern __attribute__((visibility("default"))) ypObject *const yp_FloatingPointError;
+extern __attribute__((visibility("default"))) ypObject *const yp_OverflowError;
+extern __attribute__((visibility("default"))) ypObject *const yp_ZeroDivisionError;
+extern __attribute__((visibility("default"))) ypObject *const yp_AssertionError;
+extern __attribute__((visibility("default"))) ypObject *const yp_AttributeError;
+extern __attribute__((visibility("default"))) ypObject *const yp_BufferError;
+extern __attribute__((visibility("default"))) ypObject *const yp_EOFError;
+extern __attribute__((visibility("default"))) ypObject *const yp_ImportError;
+extern __attribute__((visibility("default"))) ypObject *const yp_LookupError;
+extern __attribute__((visibility("default"))) ypObject *const yp_IndexError;
+extern __attribute__((visibility("default"))) ypObject *const yp_KeyError;
+extern __attribute__((visibility("default"))) ypObject *const yp_MemoryError;
+extern __attribute__((visibility("default"))) ypObject *const yp_NameError;
+extern __attribute__((visibility("default"))) ypObject *const yp_UnboundLocalError;
+extern __attribute__((visibility("default"))) ypObject *const yp_OSError;
+extern __attribute__((visibility("default"))) ypObject *const yp_ReferenceError;
+extern __attribute__((visibility("default"))) ypObject *const yp_RuntimeError;
+extern __attribute__((visibility("default"))) ypObject *const yp_NotImplementedError;
+extern __attribute__((visibility("default"))) ypObject *const yp_SyntaxError;
+extern __attribute__((visibility("default"))) ypObject *const yp_SystemError;
+extern __attribute__((visibility("default"))) ypObject *const yp_TypeError;
+extern __attribute__((visibility("default"))) ypObject *const yp_ValueError;
+extern __attribute__((visibility("default"))) ypObject *const yp_UnicodeError;
+extern __attribute__((visibility("default"))) ypObject *const yp_UnicodeEncodeError;
+extern __attribute__((visibility("default"))) ypObject *const yp_UnicodeDecodeError;
+extern __attribute__((visibility("default"))) ypObject *const yp_UnicodeTranslateError;
+
+
+extern __attribute__((visibility("default"))) ypObject *const yp_MethodError;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_MemorySizeOverflowError;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_ParameterSyntaxError;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_SystemLimitationError;
+
+extern __attribute__((visibility("default"))) ypObject *const yp_InvalidatedError;
+
+
+
+
+extern __attribute__((visibility("default"))) int yp_isexceptionC2(ypObject *x, ypObject *exception);
+
+
+
+extern __attribute__((visibility("default"))) int yp_isexceptionCN(ypObject *x, int n, ...);
+extern __attribute__((visibility("default"))) int yp_isexceptionCNV(ypObject *x, int n, va_list args);
+# 1972 "./nohtyP.h"
+typedef struct _yp_initialize_parameters_t {
+    yp_ssize_t sizeof_struct;
+# 1984 "./nohtyP.h"
+    void *(*yp_malloc)(yp_ssize_t *actual, yp_ssize_t size);
+# 2000 "./nohtyP.h"
+    void *(*yp_malloc_resize)(yp_ssize_t *actual, void *p, yp_ssize_t size, yp_ssize_t extra);
+
+
+    void (*yp_free)(void *p);
+
+
+
+
+
+
+
+    int everything_immortal;
+
+
+
+
+
+    yp_ssize_t freelist_max_int;
+    yp_ssize_t freelist_max_float;
+    yp_ssize_t freelist_max_tuple;
+    yp_ssize_t freelist_max_iter;
+# 2030 "./nohtyP.h"
+    yp_ssize_t ideal_size;
+
+
+
+
+
+    int hash_algorithm;
+
+
+
+
+
+
+    yp_uint64_t hash_seed;
+
+
+
+
+
+
+
+    yp_ssize_t incremental_resize_len;
+
+} yp_initialize_parameters_t;
+
+
+#define yp_HASH_ALGORITHM_DEFAULT (0)
+#define yp_HASH_ALGORITHM_SIPHASH13 (1)
+#define yp_HASH_ALGORITHM_WYHASH (2)
+
+
+extern __attribute__((visibility("default"))) void *yp_mem_default_malloc(yp_ssize_t *actual, yp_ssize_t size);
+extern __attribute__((visibility("default"))) void *yp_mem_default_malloc_resize(
+        yp_ssize_t *actual, void *p, yp_ssize_t size, yp_ssize_t extra);
+extern __attribute__((visibility("default"))) void yp_mem_default_free(void *p);
+
+
+
+
+extern __attribute__((visibility("default"))) void *yp_mem_system_malloc(yp_ssize_t *actual, yp_ssize_t size);
+extern __attribute__((visibility("default"))) void *yp_mem_system_malloc_resize(
+        yp_ssize_t *actual, void *p, yp_ssize_t size, yp_ssize_t extra);
+extern __attribute__((visibility("default"))) void yp_mem_system_free(void *p);
+
+
+
+
+extern __attribute__((visibility("default"))) void yp_mem_clear_freelists(void);
+# 2097 "./nohtyP.h"
+extern __attribute__((visibility("default"))) void yp_arena_begin(ypObject **exc);
+
+
+
+
+extern __attribute__((visibility("default"))) yp_ssize_t yp_arena_end(ypObject **exc);
+# 2118 "./nohtyP.h"
+extern __attribute__((visibility("default"))) void yp_collect_enable(yp_ssize_t threshold);
+
+
+
+extern __attribute__((visibility("default"))) void yp_collect_disable(void);
+
+
+
+
+extern __attribute__((visibility("default"))) yp_ssize_t yp_collect(int generation, ypObject **exc);
+
+
+typedef struct _yp_collect_stats_t {
+    yp_ssize_t collections[3];
+    yp_ssize_t collected[3];
+    yp_ssize_t tracked[3];
+} yp_collect_stats_t;
+
+
+extern __attribute__((visibility("default"))) void yp_collect_stats(yp_collect_stats_t *stats);
+# 2153 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_iter_stateCX(ypObject *iterator, yp_ssize_t *size, void **state);
+
+
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_function_stateCX(ypObject *function, yp_ssize_t *size, void **state);
+# 2170 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_asbytesCX(ypObject *seq, yp_ssize_t *len, const yp_uint8_t **bytes);
+# 2181 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_asencodedCX(
+        ypObject *seq, yp_ssize_t *size, const yp_uint8_t **encoded, ypObject **encoding);
+
+
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_itemarrayCX(ypObject *seq, yp_ssize_t *len, ypObject *const **array);
+# 2198 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_call_arrayX(yp_ssize_t n, ypObject **args);
+# 2207 "./nohtyP.h"
+extern __attribute__((visibility("default"))) ypObject *yp_o2s_getitemCX(ypObject *container, ypObject *key, yp_ssize_t *size,
+        const yp_uint8_t **encoded, ypObject **encoding);
+
+
+
+
+extern __attribute__((visibility("default"))) ypObject *yp_i2s_getitemCX(ypObject *container, yp_int_t key, yp_ssize_t *size,
+        const yp_uint8_t **encoded, ypObject **encoding);
+# 2355 "./nohtyP.h"
+#define _yp_UNUSED __attribute__((unused))
+# 2365 "./nohtyP.h"
+#define _yp_UNPACK(...) __VA_ARGS__
+
+
+
+
+typedef yp_uint16_t _yp_ob_type_t;
+typedef yp_int32_t _yp_ob_len_t;
+struct _ypObject {
+    _yp_ob_type_t ob_type;
+    yp_uint8_t ob_flags;
+    yp_uint8_t ob_type_flags;
+    yp_uint32_t ob_refcnt;
+    _yp_ob_len_t ob_len;
+    _yp_ob_len_t ob_alloclen;
+    yp_hash_t ob_hash;
+    void *ob_data;
+
+};
+
+
+
+struct _ypSmallObject {
+    _yp_ob_type_t ob_type;
+    yp_uint8_t ob_flags;
+    yp_uint8_t ob_type_flags;
+    yp_uint32_t ob_refcnt;
+
+};
+
+
+#define _ypObject_HEAD ypObject ob_base
+
+#define _ypSmallObject_HEAD struct _ypSmallObject ob_base
+
+#define _yp_INLINE_DATA(elemType) elemType ob_inline_data[]
+
+
+struct _ypIntObject {
+    struct _ypSmallObject ob_base;
+    yp_int_t value;
+};
+struct _ypStringLibObject {
+
+
+    ypObject ob_base;
+    yp_uint8_t ob_inline_data[];
+};
+typedef struct _ypFunctionObject {
+    ypObject ob_base;
+    ypObject *(*ob_code)(ypObject *, yp_ssize_t, ypObject *const *);
+    void *ob_state;
+
+    yp_parameter_decl_t ob_inline_data[];
+} ypFunctionObject;
+
+
+#define _ypObject_REFCNT_IMMORTAL (0x7FFFFFFFu)
+
+
+
+#define _ypObject_HASH_INVALID ((yp_hash_t) - 1)
+
+#define _ypObject_LEN_INVALID ((yp_ssize_t) - 1)
+
+#define _ypStringLib_ENC_CODE_BYTES (0u)
+#define _ypStringLib_ENC_CODE_LATIN_1 (1u)
+#define _ypStringLib_ENC_CODE_UCS_2 (2u)
+#define _ypStringLib_ENC_CODE_UCS_4 (3u)
+
+
+#define _ypBaseException_CODE (2u)
+#define _ypInt_CODE (10u)
+#define _ypBytes_CODE (16u)
+#define _ypStr_CODE (18u)
+#define _ypFunction_CODE (28u)
+# 2485 "./nohtyP.h"
+#define _yp_CONST_REF(name) ((ypObject *)&_ ##name ##_struct)
+
+#define yp_CONST_REF _yp_CONST_REF
+
+
+
+#define _yp_IMMORTAL_HEAD_INIT(type,type_flags,len,data) {(type), 0, (type_flags), _ypObject_REFCNT_IMMORTAL, (len), _ypObject_LEN_INVALID, _ypObject_HASH_INVALID, (data)}
+
+
+#define _yp_IMMORTAL_SMALL_HEAD_INIT(type,type_flags) {(type), 0, (type_flags), _ypObject_REFCNT_IMMORTAL}
+
+#define _yp_IMMORTAL_INT(qual,name,value) static struct _ypIntObject _ ##name ##_struct = { _yp_IMMORTAL_SMALL_HEAD_INIT(_ypInt_CODE, 0), (value)}; qual ypObject *const name = _yp_CONST_REF(name)
+
+
+
+#define _yp_IMMORTAL_BYTES(qual,name,value) static const char _ ##name ##_data[] = (value); static struct _ypStringLibObject _ ##name ##_struct = {_yp_IMMORTAL_HEAD_INIT(_ypBytes_CODE, _ypStringLib_ENC_CODE_BYTES, sizeof(_ ##name ##_data) - 1, (void *)_ ##name ##_data)}; qual ypObject *const name = _yp_CONST_REF(name)
+
+
+
+
+#define _yp_IMMORTAL_STR_LATIN_1(qual,name,value) static const char _ ##name ##_data[] = (value); static struct _ypStringLibObject _ ##name ##_struct = { _yp_IMMORTAL_HEAD_INIT(_ypStr_CODE, _ypStringLib_ENC_CODE_LATIN_1, sizeof(_ ##name ##_data) - 1, (void *)_ ##name ##_data), }; qual ypObject *const _yp_UNUSED name = _yp_CONST_REF(name)
+# 2514 "./nohtyP.h"
+#define yp_IMMORTAL_INT(name,value) _yp_IMMORTAL_INT(, name, value)
+#define yp_IMMORTAL_BYTES(name,value) _yp_IMMORTAL_BYTES(, name, value)
+#define yp_IMMORTAL_STR_LATIN_1(name,value) _yp_IMMORTAL_STR_LATIN_1(, name, value)
+
+#define yp_IMMORTAL_INT_static(name,value) _yp_IMMORTAL_INT(static, name, value)
+#define yp_IMMORTAL_BYTES_static(name,value) _yp_IMMORTAL_BYTES(static, name, value)
+#define yp_IMMORTAL_STR_LATIN_1_static(name,value) _yp_IMMORTAL_STR_LATIN_1(static, name, value)
+
+
+
+
+
+#define _yp_IMMORTAL_FUNCTION5(qual,name,code,parameters_len,parameters) static struct _ypFunctionObject _ ##name ##_struct = { _yp_IMMORTAL_HEAD_INIT(_ypFunction_CODE, 0, (parameters_len), (parameters)), (code), NULL}; qual ypObject *const _yp_UNUSED name = _yp_CONST_REF(name)
+
+
+
+
+#define _yp_IMMORTAL_FUNCTION(qual,name,code,parameters) static yp_parameter_decl_t _ ##name ##_parameters[] = {_yp_UNPACK parameters}; _yp_IMMORTAL_FUNCTION5( qual, name, code, yp_lengthof_array(_ ##name ##_parameters), _ ##name ##_parameters)
+
+
+
+
+#define yp_IMMORTAL_FUNCTION(name,code,parameters) _yp_IMMORTAL_FUNCTION(, name, code, parameters)
+#define yp_IMMORTAL_FUNCTION_static(name,code,parameters) _yp_IMMORTAL_FUNCTION(static, name, code, parameters)
+
+#define yp_IMMORTAL_FUNCTION2(name,code) _yp_IMMORTAL_FUNCTION5(, name, code, 0, NULL)
+#define yp_IMMORTAL_FUNCTION2_static(name,code) _yp_IMMORTAL_FUNCTION5(static, name, code, 0, NULL)
+
+
+
+
+
+#define _yp_IF(expression,decref_expression) { ypObject *_yp_IF_expr; ypObject *_yp_IF_cond; { _yp_IF_expr = (expression); _yp_IF_cond = yp_bool(_yp_IF_expr); decref_expression; if(_yp_IF_cond == yp_True) {
+
+
+
+
+
+
+
+#define yp_IF(expression) _yp_IF(expression, ((void)0))
+#define yp_IFd(expression) _yp_IF(expression, yp_decref(_yp_IF_expr))
+#define _yp_ELIF(expression,decref_expression) } } if(_yp_IF_cond == yp_False) { _yp_IF_expr = (expression); _yp_IF_cond = yp_bool(_yp_IF_expr); decref_expression; if(_yp_IF_cond == yp_True) {
+
+
+
+
+
+#define yp_ELIF(expression) _yp_ELIF(expression, ((void)0))
+#define yp_ELIFd(expression) _yp_ELIF(expression, yp_decref(_yp_IF_expr))
+#define yp_ELSE } } if(_yp_IF_cond == yp_False) { {
+
+#define yp_ELSE_EXCEPT } } if(yp_isexceptionC(_yp_IF_cond)) { {
+
+#define yp_ELSE_EXCEPT_AS(target) yp_ELSE_EXCEPT ypObject *target = _yp_IF_cond;
+
+
+#define yp_ENDIF } } }
+# 2580 "./nohtyP.h"
+#define _yp_WHILE(expression,decref_expression) { ypObject *_yp_WHILE_expr; ypObject *_yp_WHILE_cond; while(_yp_WHILE_expr = (expression), _yp_WHILE_cond = yp_bool(_yp_WHILE_expr), decref_expression, _yp_WHILE_cond == yp_True) {
+
+
+
+
+
+
+#define yp_WHILE(expression) _yp_WHILE(expression, ((void)0))
+#define yp_WHILEd(expression) _yp_WHILE(expression, yp_decref(_yp_WHILE_expr))
+#define yp_WHILE_ELSE } if(_yp_WHILE_cond == yp_False) {
+
+#define yp_WHILE_EXCEPT } if(yp_isexceptionC(_yp_WHILE_cond)) {
+
+#define yp_WHILE_EXCEPT_AS(target) yp_WHILE_EXCEPT ypObject *target = _yp_WHILE_cond;
+
+
+#define yp_ENDWHILE } }
+# 2605 "./nohtyP.h"
+#define _yp_FOR(target,expression,decref_expression) { yp_uint64_t _yp_FOR_state; ypObject *_yp_FOR_item; int _yp_FOR_iter_exhausted = 0; ypObject *_yp_FOR_expr = (expression); ypObject *_yp_FOR_iter = yp_miniiter(_yp_FOR_expr, &_yp_FOR_state); decref_expression; while(1) { _yp_FOR_item = yp_miniiter_next(&_yp_FOR_iter, &_yp_FOR_state); if(yp_isexceptionC(_yp_FOR_item)) { if(yp_isexceptionC(_yp_FOR_iter)) break; if(yp_isexceptionC2(_yp_FOR_item, yp_StopIteration)) _yp_FOR_iter_exhausted = 1; break; } yp_decref(target); target = _yp_FOR_item; {
+# 2620 "./nohtyP.h"
+#define yp_FOR(target,expression) _yp_FOR(target, expression, ((void)0))
+#define yp_FORd(target,expression) _yp_FOR(target, expression, yp_decref(_yp_FOR_expr))
+#define yp_FOR_return(expression) return yp_decref(_yp_FOR_iter), (expression)
+
+#define yp_FOR_ELSE } } if(_yp_FOR_iter_exhausted) { {
+
+#define yp_FOR_EXCEPT } } if(!_yp_FOR_iter_exhausted && yp_isexceptionC(_yp_FOR_item)) { {
+
+#define yp_FOR_EXCEPT_AS(target) yp_FOR_EXCEPT ypObject *target = _yp_FOR_item;
+
+
+#define yp_ENDFOR } } yp_decref(_yp_FOR_iter); }
+# 2640 "./nohtyP.h"
+#define yp1(self,method) yp_ ##method(self)
+#define yp2(self,method,a1) yp_ ##method(self, a1)
+
+
+
+#define yp(self,method,...) yp_ ##method(self, __VA_ARGS__)
+
+#define yp3(self,method,a1,a2) yp_ ##method(self, a1, a2)
+#define yp4(self,method,a1,a2,a3) yp_ ##method(self, a1, a2, a3)
+#define yp5(self,method,a1,a2,a3,a4) yp_ ##method(self, a1, a2, a3, a4)
+# 19 "Lib/munit_test/unittest.h" 2
+
+# 1 "Tools/munit/munit.h" 1
+# 26 "Tools/munit/munit.h"
+#define MUNIT_H 
+
+
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 25 "/usr/include/stdlib.h" 3 4
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+#define __need_size_t 
+#define __need_wchar_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 267 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __wchar_t__ 
+#define __WCHAR_T__ 
+#define _WCHAR_T 
+#define _T_WCHAR_ 
+#define _T_WCHAR 
+#define __WCHAR_T 
+#define _WCHAR_T_ 
+#define _BSD_WCHAR_T_ 
+#define _WCHAR_T_DEFINED_ 
+#define _WCHAR_T_DEFINED 
+#define _WCHAR_T_H 
+#define ___int_wchar_t_h 
+#define __INT_WCHAR_T_H 
+#define _GCC_WCHAR_T 
+#define _WCHAR_T_DECLARED 
+#define __DEFINED_wchar_t 
+# 295 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef _BSD_WCHAR_T_
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+#define _STDLIB_H 1
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 3 4
+#define WNOHANG 1
+#define WUNTRACED 2
+
+
+
+#define WSTOPPED 2
+#define WEXITED 4
+#define WCONTINUED 8
+#define WNOWAIT 0x01000000
+
+
+#define __WNOTHREAD 0x20000000
+
+#define __WALL 0x40000000
+#define __WCLONE 0x80000000
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 3 4
+#define __WEXITSTATUS(status) (((status) & 0xff00) >> 8)
+
+
+#define __WTERMSIG(status) ((status) & 0x7f)
+
+
+#define __WSTOPSIG(status) __WEXITSTATUS(status)
+
+
+#define __WIFEXITED(status) (__WTERMSIG(status) == 0)
+
+
+#define __WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)
+
+
+
+#define __WIFSTOPPED(status) (((status) & 0xff) == 0x7f)
+
+
+
+
+#define __WIFCONTINUED(status) ((status) == __W_CONTINUED)
+
+
+
+#define __WCOREDUMP(status) ((status) & __WCOREFLAG)
+
+
+#define __W_EXITCODE(ret,sig) ((ret) << 8 | (sig))
+#define __W_STOPCODE(sig) ((sig) << 8 | 0x7f)
+#define __W_CONTINUED 0xffff
+#define __WCOREFLAG 0x80
+# 42 "/usr/include/stdlib.h" 2 3 4
+
+
+#define WEXITSTATUS(status) __WEXITSTATUS (status)
+#define WTERMSIG(status) __WTERMSIG (status)
+#define WSTOPSIG(status) __WSTOPSIG (status)
+#define WIFEXITED(status) __WIFEXITED (status)
+#define WIFSIGNALED(status) __WIFSIGNALED (status)
+#define WIFSTOPPED(status) __WIFSTOPPED (status)
+
+#define WIFCONTINUED(status) __WIFCONTINUED (status)
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define _BITS_FLOATN_H 
+# 33 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __HAVE_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_DISTINCT_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_FLOAT64X 1
+
+
+
+
+
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+# 66 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __f128(x) x ##f128
+# 78 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __CFLOAT128 _Complex _Float128
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define _BITS_FLOATN_COMMON_H 
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_FLOAT16 0
+#define __HAVE_FLOAT32 1
+#define __HAVE_FLOAT64 1
+#define __HAVE_FLOAT32X 1
+#define __HAVE_FLOAT128X 0
+# 52 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __HAVE_DISTINCT_FLOAT32 0
+#define __HAVE_DISTINCT_FLOAT64 0
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+
+
+
+
+
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+
+
+
+
+
+
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+# 93 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f32(x) x ##f32
+# 105 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64(x) x ##f64
+
+
+
+
+
+
+
+#define __f32x(x) x ##f32x
+# 125 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64x(x) x ##f64x
+# 151 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT32 _Complex _Float32
+# 163 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64 _Complex _Float64
+
+
+
+
+
+
+
+#define __CFLOAT32X _Complex _Float32x
+# 183 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64X _Complex _Float64x
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 57 "/usr/include/stdlib.h" 2 3 4
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+#define __ldiv_t_defined 1
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+#define __lldiv_t_defined 1
+
+
+
+
+#define RAND_MAX 2147483647
+
+
+
+
+#define EXIT_FAILURE 1
+#define EXIT_SUCCESS 0
+
+
+
+#define MB_CUR_MAX (__ctype_get_mb_cur_max ())
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+# 402 "/usr/include/stdlib.h" 3 4
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 19 "/usr/include/alloca.h" 3 4
+#define _ALLOCA_H 1
+
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+#undef alloca
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+#define alloca(size) __builtin_alloca (size)
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+#define __COMPAR_FN_T 
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 30 "Tools/munit/munit.h" 2
+
+#define MUNIT_VERSION(major,minor,revision) (((major) << 16) | ((minor) << 8) | (revision))
+
+
+#define MUNIT_CURRENT_VERSION MUNIT_VERSION(0, 4, 1)
+# 46 "Tools/munit/munit.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 23 "/usr/include/stdint.h" 3 4
+#define _STDINT_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/stdint.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define _BITS_WCHAR_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define __WCHAR_MAX __WCHAR_MAX__
+
+
+
+
+
+
+
+#define __WCHAR_MIN __WCHAR_MIN__
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+#define _BITS_STDINT_UINTN_H 1
+
+
+
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+#define __intptr_t_defined 
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+
+
+
+#define __INT64_C(c) c ## L
+#define __UINT64_C(c) c ## UL
+# 116 "/usr/include/stdint.h" 3 4
+#define INT8_MIN (-128)
+#define INT16_MIN (-32767-1)
+#define INT32_MIN (-2147483647-1)
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT8_MAX (127)
+#define INT16_MAX (32767)
+#define INT32_MAX (2147483647)
+#define INT64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT8_MAX (255)
+#define UINT16_MAX (65535)
+#define UINT32_MAX (4294967295U)
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_LEAST8_MIN (-128)
+#define INT_LEAST16_MIN (-32767-1)
+#define INT_LEAST32_MIN (-2147483647-1)
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_LEAST8_MAX (127)
+#define INT_LEAST16_MAX (32767)
+#define INT_LEAST32_MAX (2147483647)
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_LEAST8_MAX (255)
+#define UINT_LEAST16_MAX (65535)
+#define UINT_LEAST32_MAX (4294967295U)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_FAST8_MIN (-128)
+
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+
+
+
+
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_FAST8_MAX (127)
+
+#define INT_FAST16_MAX (9223372036854775807L)
+#define INT_FAST32_MAX (9223372036854775807L)
+
+
+
+
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_FAST8_MAX (255)
+
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define UINT_FAST32_MAX (18446744073709551615UL)
+
+
+
+
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define INTPTR_MAX (9223372036854775807L)
+#define UINTPTR_MAX (18446744073709551615UL)
+# 197 "/usr/include/stdint.h" 3 4
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+
+
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define PTRDIFF_MAX (9223372036854775807L)
+# 222 "/usr/include/stdint.h" 3 4
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define SIG_ATOMIC_MAX (2147483647)
+
+
+
+#define SIZE_MAX (18446744073709551615UL)
+# 239 "/usr/include/stdint.h" 3 4
+#define WCHAR_MIN __WCHAR_MIN
+#define WCHAR_MAX __WCHAR_MAX
+
+
+
+#define WINT_MIN (0u)
+#define WINT_MAX (4294967295u)
+
+
+#define INT8_C(c) c
+#define INT16_C(c) c
+#define INT32_C(c) c
+
+#define INT64_C(c) c ## L
+
+
+
+
+
+#define UINT8_C(c) c
+#define UINT16_C(c) c
+#define UINT32_C(c) c ## U
+
+#define UINT64_C(c) c ## UL
+
+
+
+
+
+
+#define INTMAX_C(c) c ## L
+#define UINTMAX_C(c) c ## UL
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+
+
+
+#define _GCC_WRAP_STDINT_H 
+# 47 "Tools/munit/munit.h" 2
+#define munit_int8_t int8_t
+#define munit_uint8_t uint8_t
+#define munit_int16_t int16_t
+#define munit_uint16_t uint16_t
+#define munit_int32_t int32_t
+#define munit_uint32_t uint32_t
+#define munit_int64_t int64_t
+#define munit_uint64_t uint64_t
+# 107 "Tools/munit/munit.h"
+# 1 "/usr/include/inttypes.h" 1 3 4
+# 23 "/usr/include/inttypes.h" 3 4
+#define _INTTYPES_H 1
+# 34 "/usr/include/inttypes.h" 3 4
+typedef int __gwchar_t;
+
+
+
+
+
+#define ____gwchar_t_defined 1
+
+
+
+#define __PRI64_PREFIX "l"
+#define __PRIPTR_PREFIX "l"
+# 54 "/usr/include/inttypes.h" 3 4
+#define PRId8 "d"
+#define PRId16 "d"
+#define PRId32 "d"
+#define PRId64 __PRI64_PREFIX "d"
+
+#define PRIdLEAST8 "d"
+#define PRIdLEAST16 "d"
+#define PRIdLEAST32 "d"
+#define PRIdLEAST64 __PRI64_PREFIX "d"
+
+#define PRIdFAST8 "d"
+#define PRIdFAST16 __PRIPTR_PREFIX "d"
+#define PRIdFAST32 __PRIPTR_PREFIX "d"
+#define PRIdFAST64 __PRI64_PREFIX "d"
+
+
+#define PRIi8 "i"
+#define PRIi16 "i"
+#define PRIi32 "i"
+#define PRIi64 __PRI64_PREFIX "i"
+
+#define PRIiLEAST8 "i"
+#define PRIiLEAST16 "i"
+#define PRIiLEAST32 "i"
+#define PRIiLEAST64 __PRI64_PREFIX "i"
+
+#define PRIiFAST8 "i"
+#define PRIiFAST16 __PRIPTR_PREFIX "i"
+#define PRIiFAST32 __PRIPTR_PREFIX "i"
+#define PRIiFAST64 __PRI64_PREFIX "i"
+
+
+#define PRIo8 "o"
+#define PRIo16 "o"
+#define PRIo32 "o"
+#define PRIo64 __PRI64_PREFIX "o"
+
+#define PRIoLEAST8 "o"
+#define PRIoLEAST16 "o"
+#define PRIoLEAST32 "o"
+#define PRIoLEAST64 __PRI64_PREFIX "o"
+
+#define PRIoFAST8 "o"
+#define PRIoFAST16 __PRIPTR_PREFIX "o"
+#define PRIoFAST32 __PRIPTR_PREFIX "o"
+#define PRIoFAST64 __PRI64_PREFIX "o"
+
+
+#define PRIu8 "u"
+#define PRIu16 "u"
+#define PRIu32 "u"
+#define PRIu64 __PRI64_PREFIX "u"
+
+#define PRIuLEAST8 "u"
+#define PRIuLEAST16 "u"
+#define PRIuLEAST32 "u"
+#define PRIuLEAST64 __PRI64_PREFIX "u"
+
+#define PRIuFAST8 "u"
+#define PRIuFAST16 __PRIPTR_PREFIX "u"
+#define PRIuFAST32 __PRIPTR_PREFIX "u"
+#define PRIuFAST64 __PRI64_PREFIX "u"
+
+
+#define PRIx8 "x"
+#define PRIx16 "x"
+#define PRIx32 "x"
+#define PRIx64 __PRI64_PREFIX "x"
+
+#define PRIxLEAST8 "x"
+#define PRIxLEAST16 "x"
+#define PRIxLEAST32 "x"
+#define PRIxLEAST64 __PRI64_PREFIX "x"
+
+#define PRIxFAST8 "x"
+#define PRIxFAST16 __PRIPTR_PREFIX "x"
+#define PRIxFAST32 __PRIPTR_PREFIX "x"
+#define PRIxFAST64 __PRI64_PREFIX "x"
+
+
+#define PRIX8 "X"
+#define PRIX16 "X"
+#define PRIX32 "X"
+#define PRIX64 __PRI64_PREFIX "X"
+
+#define PRIXLEAST8 "X"
+#define PRIXLEAST16 "X"
+#define PRIXLEAST32 "X"
+#define PRIXLEAST64 __PRI64_PREFIX "X"
+
+#define PRIXFAST8 "X"
+#define PRIXFAST16 __PRIPTR_PREFIX "X"
+#define PRIXFAST32 __PRIPTR_PREFIX "X"
+#define PRIXFAST64 __PRI64_PREFIX "X"
+
+
+
+#define PRIdMAX __PRI64_PREFIX "d"
+#define PRIiMAX __PRI64_PREFIX "i"
+#define PRIoMAX __PRI64_PREFIX "o"
+#define PRIuMAX __PRI64_PREFIX "u"
+#define PRIxMAX __PRI64_PREFIX "x"
+#define PRIXMAX __PRI64_PREFIX "X"
+
+
+
+#define PRIdPTR __PRIPTR_PREFIX "d"
+#define PRIiPTR __PRIPTR_PREFIX "i"
+#define PRIoPTR __PRIPTR_PREFIX "o"
+#define PRIuPTR __PRIPTR_PREFIX "u"
+#define PRIxPTR __PRIPTR_PREFIX "x"
+#define PRIXPTR __PRIPTR_PREFIX "X"
+
+
+
+
+
+#define SCNd8 "hhd"
+#define SCNd16 "hd"
+#define SCNd32 "d"
+#define SCNd64 __PRI64_PREFIX "d"
+
+#define SCNdLEAST8 "hhd"
+#define SCNdLEAST16 "hd"
+#define SCNdLEAST32 "d"
+#define SCNdLEAST64 __PRI64_PREFIX "d"
+
+#define SCNdFAST8 "hhd"
+#define SCNdFAST16 __PRIPTR_PREFIX "d"
+#define SCNdFAST32 __PRIPTR_PREFIX "d"
+#define SCNdFAST64 __PRI64_PREFIX "d"
+
+
+#define SCNi8 "hhi"
+#define SCNi16 "hi"
+#define SCNi32 "i"
+#define SCNi64 __PRI64_PREFIX "i"
+
+#define SCNiLEAST8 "hhi"
+#define SCNiLEAST16 "hi"
+#define SCNiLEAST32 "i"
+#define SCNiLEAST64 __PRI64_PREFIX "i"
+
+#define SCNiFAST8 "hhi"
+#define SCNiFAST16 __PRIPTR_PREFIX "i"
+#define SCNiFAST32 __PRIPTR_PREFIX "i"
+#define SCNiFAST64 __PRI64_PREFIX "i"
+
+
+#define SCNu8 "hhu"
+#define SCNu16 "hu"
+#define SCNu32 "u"
+#define SCNu64 __PRI64_PREFIX "u"
+
+#define SCNuLEAST8 "hhu"
+#define SCNuLEAST16 "hu"
+#define SCNuLEAST32 "u"
+#define SCNuLEAST64 __PRI64_PREFIX "u"
+
+#define SCNuFAST8 "hhu"
+#define SCNuFAST16 __PRIPTR_PREFIX "u"
+#define SCNuFAST32 __PRIPTR_PREFIX "u"
+#define SCNuFAST64 __PRI64_PREFIX "u"
+
+
+#define SCNo8 "hho"
+#define SCNo16 "ho"
+#define SCNo32 "o"
+#define SCNo64 __PRI64_PREFIX "o"
+
+#define SCNoLEAST8 "hho"
+#define SCNoLEAST16 "ho"
+#define SCNoLEAST32 "o"
+#define SCNoLEAST64 __PRI64_PREFIX "o"
+
+#define SCNoFAST8 "hho"
+#define SCNoFAST16 __PRIPTR_PREFIX "o"
+#define SCNoFAST32 __PRIPTR_PREFIX "o"
+#define SCNoFAST64 __PRI64_PREFIX "o"
+
+
+#define SCNx8 "hhx"
+#define SCNx16 "hx"
+#define SCNx32 "x"
+#define SCNx64 __PRI64_PREFIX "x"
+
+#define SCNxLEAST8 "hhx"
+#define SCNxLEAST16 "hx"
+#define SCNxLEAST32 "x"
+#define SCNxLEAST64 __PRI64_PREFIX "x"
+
+#define SCNxFAST8 "hhx"
+#define SCNxFAST16 __PRIPTR_PREFIX "x"
+#define SCNxFAST32 __PRIPTR_PREFIX "x"
+#define SCNxFAST64 __PRI64_PREFIX "x"
+
+
+
+#define SCNdMAX __PRI64_PREFIX "d"
+#define SCNiMAX __PRI64_PREFIX "i"
+#define SCNoMAX __PRI64_PREFIX "o"
+#define SCNuMAX __PRI64_PREFIX "u"
+#define SCNxMAX __PRI64_PREFIX "x"
+
+
+#define SCNdPTR __PRIPTR_PREFIX "d"
+#define SCNiPTR __PRIPTR_PREFIX "i"
+#define SCNoPTR __PRIPTR_PREFIX "o"
+#define SCNuPTR __PRIPTR_PREFIX "u"
+#define SCNxPTR __PRIPTR_PREFIX "x"
+
+
+
+
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } imaxdiv_t;
+# 290 "/usr/include/inttypes.h" 3 4
+extern intmax_t imaxabs (intmax_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern imaxdiv_t imaxdiv (intmax_t __numer, intmax_t __denom)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern intmax_t strtoimax (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern uintmax_t strtoumax (const char *__restrict __nptr,
+       char ** __restrict __endptr, int __base) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern intmax_t wcstoimax (const __gwchar_t *__restrict __nptr,
+      __gwchar_t **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern uintmax_t wcstoumax (const __gwchar_t *__restrict __nptr,
+       __gwchar_t ** __restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 108 "Tools/munit/munit.h" 2
+
+
+
+
+
+
+#define munit_bool _Bool
+# 125 "Tools/munit/munit.h"
+#define MUNIT_LIKELY(expr) (__builtin_expect ((expr), 1))
+#define MUNIT_UNLIKELY(expr) (__builtin_expect ((expr), 0))
+#define MUNIT_UNUSED __attribute__((__unused__))
+
+
+
+
+
+
+
+#define MUNIT_ARRAY_PARAM(name) name
+
+
+
+
+
+#define MUNIT_SIZE_MODIFIER "z"
+#define MUNIT_CHAR_MODIFIER "hh"
+#define MUNIT_SHORT_MODIFIER "h"
+# 155 "Tools/munit/munit.h"
+#define MUNIT_NO_RETURN _Noreturn
+# 168 "Tools/munit/munit.h"
+#define MUNIT_PUSH_DISABLE_MSVC_C4127_ 
+#define MUNIT_POP_DISABLE_MSVC_C4127_ 
+
+
+
+# 172 "Tools/munit/munit.h"
+typedef enum {
+  MUNIT_LOG_DEBUG,
+  MUNIT_LOG_INFO,
+  MUNIT_LOG_WARNING,
+  MUNIT_LOG_ERROR
+} MunitLogLevel;
+
+
+#define MUNIT_PRINTF(string_index,first_to_check) __attribute__((format (printf, string_index, first_to_check)))
+
+
+
+
+__attribute__((format (printf, 4, 5)))
+void munit_logf_ex(MunitLogLevel level, const char* filename, int line, const char* format, ...);
+
+#define munit_logf(level,format,...) munit_logf_ex(level, __FILE__, __LINE__, format, __VA_ARGS__)
+
+
+#define munit_log(level,msg) munit_logf(level, "%s", msg)
+
+
+_Noreturn
+__attribute__((format (printf, 3, 4)))
+void munit_errorf_ex(const char* filename, int line, const char* format, ...);
+
+#define munit_errorf(format,...) munit_errorf_ex(__FILE__, __LINE__, format, __VA_ARGS__)
+
+
+#define munit_error(msg) munit_errorf("%s", msg)
+
+
+#define munit_assert(expr) do { if (!MUNIT_LIKELY(expr)) { munit_error("assertion failed: " #expr); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_
+# 213 "Tools/munit/munit.h"
+#define munit_assert_true(expr) do { if (!MUNIT_LIKELY(expr)) { munit_error("assertion failed: " #expr " is not true"); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_
+# 222 "Tools/munit/munit.h"
+#define munit_assert_false(expr) do { if (!MUNIT_LIKELY(!(expr))) { munit_error("assertion failed: " #expr " is not false"); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_
+# 231 "Tools/munit/munit.h"
+#define munit_assert_type_full(prefix,suffix,T,fmt,a,op,b) do { T munit_tmp_a_ = (a); T munit_tmp_b_ = (b); if (!(munit_tmp_a_ op munit_tmp_b_)) { munit_errorf("assertion failed: %s %s %s (" prefix "%" fmt suffix " %s " prefix "%" fmt suffix ")", #a, #op, #b, munit_tmp_a_, #op, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_
+# 243 "Tools/munit/munit.h"
+#define munit_assert_type(T,fmt,a,op,b) munit_assert_type_full("", "", T, fmt, a, op, b)
+
+
+#define munit_assert_char(a,op,b) munit_assert_type_full("'\\x", "'", char, "02" MUNIT_CHAR_MODIFIER "x", a, op, b)
+
+#define munit_assert_uchar(a,op,b) munit_assert_type_full("'\\x", "'", unsigned char, "02" MUNIT_CHAR_MODIFIER "x", a, op, b)
+
+#define munit_assert_short(a,op,b) munit_assert_type(short, MUNIT_SHORT_MODIFIER "d", a, op, b)
+
+#define munit_assert_ushort(a,op,b) munit_assert_type(unsigned short, MUNIT_SHORT_MODIFIER "u", a, op, b)
+
+#define munit_assert_int(a,op,b) munit_assert_type(int, "d", a, op, b)
+
+#define munit_assert_uint(a,op,b) munit_assert_type(unsigned int, "u", a, op, b)
+
+#define munit_assert_long(a,op,b) munit_assert_type(long int, "ld", a, op, b)
+
+#define munit_assert_ulong(a,op,b) munit_assert_type(unsigned long int, "lu", a, op, b)
+
+#define munit_assert_llong(a,op,b) munit_assert_type(long long int, "lld", a, op, b)
+
+#define munit_assert_ullong(a,op,b) munit_assert_type(unsigned long long int, "llu", a, op, b)
+
+
+#define munit_assert_size(a,op,b) munit_assert_type(size_t, MUNIT_SIZE_MODIFIER "u", a, op, b)
+
+
+#define munit_assert_float(a,op,b) munit_assert_type(float, "f", a, op, b)
+
+#define munit_assert_double(a,op,b) munit_assert_type(double, "g", a, op, b)
+
+#define munit_assert_ptr(a,op,b) munit_assert_type(const void*, "p", a, op, b)
+
+
+#define munit_assert_int8(a,op,b) munit_assert_type(munit_int8_t, PRIi8, a, op, b)
+
+#define munit_assert_uint8(a,op,b) munit_assert_type(munit_uint8_t, PRIu8, a, op, b)
+
+#define munit_assert_int16(a,op,b) munit_assert_type(munit_int16_t, PRIi16, a, op, b)
+
+#define munit_assert_uint16(a,op,b) munit_assert_type(munit_uint16_t, PRIu16, a, op, b)
+
+#define munit_assert_int32(a,op,b) munit_assert_type(munit_int32_t, PRIi32, a, op, b)
+
+#define munit_assert_uint32(a,op,b) munit_assert_type(munit_uint32_t, PRIu32, a, op, b)
+
+#define munit_assert_int64(a,op,b) munit_assert_type(munit_int64_t, PRIi64, a, op, b)
+
+#define munit_assert_uint64(a,op,b) munit_assert_type(munit_uint64_t, PRIu64, a, op, b)
+
+
+#define munit_assert_double_equal(a,b,precision) do { const double munit_tmp_a_ = (a); const double munit_tmp_b_ = (b); const double munit_tmp_diff_ = ((munit_tmp_a_ - munit_tmp_b_) < 0) ? -(munit_tmp_a_ - munit_tmp_b_) : (munit_tmp_a_ - munit_tmp_b_); if (MUNIT_UNLIKELY(munit_tmp_diff_ > 1e- ##precision)) { munit_errorf("assertion failed: %s == %s (%0." #precision "g == %0." #precision "g)", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_
+# 309 "Tools/munit/munit.h"
+# 1 "/usr/include/string.h" 1 3 4
+# 23 "/usr/include/string.h" 3 4
+#define _STRING_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+#define _BITS_TYPES_LOCALE_T_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+#define _BITS_TYPES___LOCALE_T_H 1
+
+
+
+
+
+
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 19 "/usr/include/strings.h" 3 4
+#define _STRINGS_H 1
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 310 "Tools/munit/munit.h" 2
+#define munit_assert_string_equal(a,b) do { const char* munit_tmp_a_ = a; const char* munit_tmp_b_ = b; if (MUNIT_UNLIKELY(strcmp(munit_tmp_a_, munit_tmp_b_) != 0)) { munit_errorf("assertion failed: string %s == %s (\"%s\" == \"%s\")", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_
+# 322 "Tools/munit/munit.h"
+#define munit_assert_string_not_equal(a,b) do { const char* munit_tmp_a_ = a; const char* munit_tmp_b_ = b; if (MUNIT_UNLIKELY(strcmp(munit_tmp_a_, munit_tmp_b_) == 0)) { munit_errorf("assertion failed: string %s != %s (\"%s\" == \"%s\")", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_
+# 334 "Tools/munit/munit.h"
+#define munit_assert_memory_equal(size,a,b) do { const unsigned char* munit_tmp_a_ = (const unsigned char*) (a); const unsigned char* munit_tmp_b_ = (const unsigned char*) (b); const size_t munit_tmp_size_ = (size); if (MUNIT_UNLIKELY(memcmp(munit_tmp_a_, munit_tmp_b_, munit_tmp_size_)) != 0) { size_t munit_tmp_pos_; for (munit_tmp_pos_ = 0 ; munit_tmp_pos_ < munit_tmp_size_ ; munit_tmp_pos_++) { if (munit_tmp_a_[munit_tmp_pos_] != munit_tmp_b_[munit_tmp_pos_]) { munit_errorf("assertion failed: memory %s == %s, at offset %" MUNIT_SIZE_MODIFIER "u", #a, #b, munit_tmp_pos_); break; } } } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_
+# 353 "Tools/munit/munit.h"
+#define munit_assert_memory_not_equal(size,a,b) do { const unsigned char* munit_tmp_a_ = (const unsigned char*) (a); const unsigned char* munit_tmp_b_ = (const unsigned char*) (b); const size_t munit_tmp_size_ = (size); if (MUNIT_UNLIKELY(memcmp(munit_tmp_a_, munit_tmp_b_, munit_tmp_size_)) == 0) { munit_errorf("assertion failed: memory %s != %s (%zu bytes)", #a, #b, munit_tmp_size_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_
+# 366 "Tools/munit/munit.h"
+#define munit_assert_ptr_equal(a,b) munit_assert_ptr(a, ==, b)
+
+#define munit_assert_ptr_not_equal(a,b) munit_assert_ptr(a, !=, b)
+
+#define munit_assert_null(ptr) munit_assert_ptr(ptr, ==, NULL)
+
+#define munit_assert_not_null(ptr) munit_assert_ptr(ptr, !=, NULL)
+
+#define munit_assert_ptr_null(ptr) munit_assert_ptr(ptr, ==, NULL)
+
+#define munit_assert_ptr_not_null(ptr) munit_assert_ptr(ptr, !=, NULL)
+
+
+
+
+
+# 381 "Tools/munit/munit.h"
+void* munit_malloc_ex(const char* filename, int line, size_t size);
+
+#define munit_malloc(size) munit_malloc_ex(__FILE__, __LINE__, (size))
+
+
+#define munit_new(type) ((type*) munit_malloc(sizeof(type)))
+
+
+#define munit_calloc(nmemb,size) munit_malloc((nmemb) * (size))
+
+
+#define munit_newa(type,nmemb) ((type*) munit_calloc((nmemb), sizeof(type)))
+
+
+
+
+void munit_rand_seed(uint32_t seed);
+uint32_t munit_rand_uint32(void);
+int munit_rand_int_range(int min, int max);
+double munit_rand_double(void);
+void munit_rand_memory(size_t size, uint8_t buffer[size]);
+
+
+
+typedef enum {
+
+  MUNIT_OK,
+
+  MUNIT_FAIL,
+
+  MUNIT_SKIP,
+
+
+
+  MUNIT_ERROR
+} MunitResult;
+
+typedef struct {
+  char* name;
+  char** values;
+} MunitParameterEnum;
+
+typedef struct {
+  char* name;
+  char* value;
+} MunitParameter;
+
+const char* munit_parameters_get(const MunitParameter params[], const char* key);
+
+typedef enum {
+  MUNIT_TEST_OPTION_NONE = 0,
+  MUNIT_TEST_OPTION_SINGLE_ITERATION = 1 << 0,
+  MUNIT_TEST_OPTION_TODO = 1 << 1
+} MunitTestOptions;
+
+typedef MunitResult (* MunitTestFunc)(const MunitParameter params[], void* user_data_or_fixture);
+typedef void* (* MunitTestSetup)(const MunitParameter params[], void* user_data);
+typedef void (* MunitTestTearDown)(void* fixture);
+
+typedef struct {
+  char* name;
+  MunitTestFunc test;
+  MunitTestSetup setup;
+  MunitTestTearDown tear_down;
+  MunitTestOptions options;
+  MunitParameterEnum* parameters;
+} MunitTest;
+
+typedef enum {
+  MUNIT_SUITE_OPTION_NONE = 0
+} MunitSuiteOptions;
+
+typedef struct MunitSuite_ MunitSuite;
+
+struct MunitSuite_ {
+  char* prefix;
+  MunitTest* tests;
+  MunitSuite* suites;
+  unsigned int iterations;
+  MunitSuiteOptions options;
+};
+
+int munit_suite_main(const MunitSuite* suite, void* user_data, int argc, char* const argv[argc + 1]);
+
+
+
+
+typedef struct MunitArgument_ MunitArgument;
+
+struct MunitArgument_ {
+  char* name;
+  _Bool (* parse_argument)(const MunitSuite* suite, void* user_data, int* arg, int argc, char* const argv[argc + 1]);
+  void (* write_help)(const MunitArgument* argument, void* user_data);
+};
+
+int munit_suite_main_custom(const MunitSuite* suite,
+                            void* user_data,
+                            int argc, char* const argv[argc + 1],
+                            const MunitArgument arguments[]);
+# 21 "Lib/munit_test/unittest.h" 2
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _STDDEF_H 
+#define _STDDEF_H_ 
+
+#define _ANSI_STDDEF_H 
+# 132 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _PTRDIFF_T 
+#define _T_PTRDIFF_ 
+#define _T_PTRDIFF 
+#define __PTRDIFF_T 
+#define _PTRDIFF_T_ 
+#define _BSD_PTRDIFF_T_ 
+#define ___int_ptrdiff_t_h 
+#define _GCC_PTRDIFF_T 
+#define _PTRDIFF_T_DECLARED 
+#define __DEFINED_ptrdiff_t 
+
+
+
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+
+
+
+
+#define _GCC_MAX_ALIGN_T 
+
+
+
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 23 "Lib/munit_test/unittest.h" 2
+# 1 "/usr/include/stdio.h" 1 3 4
+# 24 "/usr/include/stdio.h" 3 4
+#define _STDIO_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 34 "/usr/include/stdio.h" 2 3 4
+
+#define __need___va_list 
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+#define _____fpos_t_defined 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+
+#define ____mbstate_t_defined 1
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+
+#define _____fpos64_t_defined 1
+
+
+
+
+
+
+
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+#define ____FILE_defined 1
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+#define __FILE_defined 1
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+#define __struct_FILE_defined 1
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+
+
+#define __getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)
+
+
+
+#define __putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))
+
+
+
+
+#define _IO_EOF_SEEN 0x0010
+#define __feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)
+
+#define _IO_ERR_SEEN 0x0020
+#define __ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)
+
+#define _IO_USER_LOCK 0x8000
+# 44 "/usr/include/stdio.h" 2 3 4
+# 84 "/usr/include/stdio.h" 3 4
+typedef __fpos_t fpos_t;
+# 93 "/usr/include/stdio.h" 3 4
+#define _IOFBF 0
+#define _IOLBF 1
+#define _IONBF 2
+
+
+
+#define BUFSIZ 8192
+
+
+
+
+#define EOF (-1)
+
+
+
+
+#define SEEK_SET 0
+#define SEEK_CUR 1
+#define SEEK_END 2
+# 120 "/usr/include/stdio.h" 3 4
+#define P_tmpdir "/tmp"
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 3 4
+#define _BITS_STDIO_LIM_H 1
+
+
+
+
+
+#define L_tmpnam 20
+#define TMP_MAX 238328
+#define FILENAME_MAX 4096
+
+
+#define L_ctermid 9
+
+
+
+
+
+#undef FOPEN_MAX
+#define FOPEN_MAX 16
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+#define stdin stdin
+#define stdout stdout
+#define stderr stderr
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+
+#undef __attr_dealloc_fclose
+#define __attr_dealloc_fclose __attr_dealloc (fclose, 1)
+
+
+
+
+
+
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 434 "/usr/include/stdio.h" 3 4
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+#define _BITS_STDIO_H 1
+# 29 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+#define __STDIO_INLINE __extern_inline
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 147 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+#define fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin_constant_p (size) && __builtin_constant_p (n) && (size_t) (size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > 0; --__cnt) { int __c = getc_unlocked (__stream); if (__c == EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) (n) - __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))
+# 171 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+#define fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builtin_constant_p (size) && __builtin_constant_p (n) && (size_t) (size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ const char *__ptr = (const char *) (ptr); FILE *__stream = (stream); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stream) == EOF) break; ((size_t) (size) * (size_t) (n) - __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))
+# 193 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+#undef __STDIO_INLINE
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 24 "Lib/munit_test/unittest.h" 2
+
+
+#define TRUE (1 == 1)
+#define FALSE (0 == 1)
+
+
+
+
+#define yp_ARCH_64_BIT 1
+# 44 "Lib/munit_test/unittest.h"
+#define PRIint "lld"
+# 56 "Lib/munit_test/unittest.h"
+#define PRIssize PRId64
+
+
+
+
+
+#define _ESC(...) __VA_ARGS__
+
+
+
+#define _PP_NARG(prefix,...) _ESC(_PP_ARG_N(prefix, __VA_ARGS__))
+#define _PP_ARG_N(prefix,_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66,n,...) prefix ##n
+
+
+
+
+
+
+
+#define _PP_RSEQ_N() 66,65,64,63,62,61,60, 59,58,57,56,55,54,53,52,51,50, 49,48,47,46,45,44,43,42,41,40, 39,38,37,36,35,34,33,32,31,30, 29,28,27,26,25,24,23,22,21,20, 19,18,17,16,15,14,13,12,11,10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+# 91 "Lib/munit_test/unittest.h"
+#define _STRINGIFY1(a) #a
+#define _STRINGIFY2(a,b) #a, #b
+#define _STRINGIFY3(a,b,c) #a, #b, #c
+#define _STRINGIFY4(a,b,c,d) #a, #b, #c, #d
+#define _STRINGIFY5(a,b,c,d,e) #a, #b, #c, #d, #e
+#define _STRINGIFY6(a,b,c,d,e,f) #a, #b, #c, #d, #e, #f
+#define _STRINGIFY7(a,b,c,d,e,f,g) #a, #b, #c, #d, #e, #f, #g
+#define _STRINGIFY8(a,b,c,d,e,f,g,h) #a, #b, #c, #d, #e, #f, #g, #h
+#define _STRINGIFY9(a,b,c,d,e,f,g,h,i) #a, #b, #c, #d, #e, #f, #g, #h, #i
+#define _STRINGIFY10(a,b,c,d,e,f,g,h,i,j) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j
+#define _STRINGIFY11(a,b,c,d,e,f,g,h,i,j,k) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k
+#define _STRINGIFY12(a,b,c,d,e,f,g,h,i,j,k,l) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l
+#define _STRINGIFY13(a,b,c,d,e,f,g,h,i,j,k,l,m) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m
+#define _STRINGIFY14(a,b,c,d,e,f,g,h,i,j,k,l,m,n) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n
+#define _STRINGIFY15(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o
+#define _STRINGIFY16(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p
+#define _STRINGIFY17(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q
+#define _STRINGIFY18(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r
+#define _STRINGIFY19(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s
+#define _STRINGIFY20(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t
+#define _STRINGIFY21(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u
+#define _STRINGIFY22(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v
+#define _STRINGIFY23(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w
+#define _STRINGIFY24(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x
+#define _STRINGIFY25(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y
+#define _STRINGIFY26(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z
+#define _STRINGIFY27(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A
+#define _STRINGIFY28(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B
+#define _STRINGIFY29(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C
+#define _STRINGIFY30(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D
+#define _STRINGIFY31(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E
+#define _STRINGIFY32(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F
+#define _STRINGIFY33(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F,G) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F, #G
+#define _STRINGIFY34(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F,G,H) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F, #G, #H
+
+
+
+
+
+
+#define _COMMA_REPEAT1(x) x
+#define _COMMA_REPEAT2(x) x, x
+#define _COMMA_REPEAT3(x) x, x, x
+#define _COMMA_REPEAT4(x) x, x, x, x
+#define _COMMA_REPEAT5(x) x, x, x, x, x
+#define _COMMA_REPEAT6(x) x, x, x, x, x, x
+#define _COMMA_REPEAT7(x) x, x, x, x, x, x, x
+#define _COMMA_REPEAT8(x) x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT9(x) x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT10(x) x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT11(x) x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT12(x) x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT13(x) x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT14(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT15(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT16(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT17(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT18(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT19(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT20(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT21(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT22(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT23(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT24(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT25(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT26(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT27(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT28(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT29(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT30(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT31(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT32(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT33(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+#define _COMMA_REPEAT34(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+
+
+
+#define VA_ARGC(...) (_PP_NARG(, __VA_ARGS__, _PP_RSEQ_N()))
+#define N(...) VA_ARGC(__VA_ARGS__), __VA_ARGS__
+#define K(...) (VA_ARGC(__VA_ARGS__) / 2), __VA_ARGS__
+#define STRINGIFY(...) _ESC(_PP_NARG(_STRINGIFY, __VA_ARGS__, _PP_RSEQ_N())(__VA_ARGS__))
+#define UNPACK(...) __VA_ARGS__
+
+
+#define yp_sizeof(x) ((yp_ssize_t)sizeof(x))
+#define yp_offsetof(structType,member) ((yp_ssize_t)offsetof(structType, member))
+#define yp_sizeof_member(structType,member) yp_sizeof(((structType *)0)->member)
+
+
+#define yp_lengthof_array(x) (yp_sizeof(x) / yp_sizeof((x)[0]))
+
+
+#define yp_lengthof_array_member(structType,member) yp_lengthof_array(((structType *)0)->member)
+
+
+
+#define TEST(name,parameters) { "/" #name, (MunitTestFunc)(name), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, parameters }
+# 197 "Lib/munit_test/unittest.h"
+#define SUITE_OF_TESTS(name) { "/" #name, (name ##_tests), NULL, 1, MUNIT_SUITE_OPTION_NONE }
+# 206 "Lib/munit_test/unittest.h"
+#define SUITE_OF_SUITES(name) { "/" #name, NULL, (name ##_suites), 1, MUNIT_SUITE_OPTION_NONE }
+# 218 "Lib/munit_test/unittest.h"
+#define _assert_typeC(a,op,b,val_pri,a_fmt,b_fmt,...) do { if (!(a op b)) { munit_errorf("assertion failed: " a_fmt " " #op " " b_fmt " (%" val_pri " " #op " %" val_pri ") ", __VA_ARGS__, a, b); } } while (0)
+# 228 "Lib/munit_test/unittest.h"
+#define _assert_ptr(a,op,b,a_fmt,b_fmt,...) _assert_typeC(a, op, b, "p", a_fmt, b_fmt, __VA_ARGS__)
+
+
+
+#define assert_true(expr) munit_assert_true(expr)
+#define assert_false(expr) munit_assert_false(expr)
+#define assert_ptr(a,op,b) munit_assert_ptr(a, op, b)
+#define assert_null(ptr) munit_assert_null(ptr)
+#define assert_not_null(ptr) munit_assert_not_null(ptr)
+#define assert_intC(a,op,b) munit_assert_type(yp_int_t, PRIint, a, op, b)
+#define assert_ssizeC(a,op,b) munit_assert_type(yp_ssize_t, PRIssize, a, op, b)
+#define assert_hashC(a,op,b) munit_assert_type(yp_hash_t, PRIssize, a, op, b)
+
+
+#define _assert_not_exception(obj,obj_fmt,...) do { if (yp_isexceptionC(obj)) { munit_errorf("assertion failed: !yp_isexceptionC(" obj_fmt ")", __VA_ARGS__); } } while (0)
+
+
+
+
+
+
+
+#define assert_not_exception(obj) do { ypObject *_ypmt_NOT_EXC_obj = (obj); _assert_not_exception(_ypmt_NOT_EXC_obj, "%s", #obj); } while (0)
+# 259 "Lib/munit_test/unittest.h"
+#define _ypmt_error_exception(exc,non_exc_fmt,obj_fmt,...) do { _assert_not_exception(exc, obj_fmt, __VA_ARGS__); munit_errorf(non_exc_fmt ": " obj_fmt, __VA_ARGS__); } while (0)
+
+
+
+
+
+
+#define _assert_not_raises(statement,statement_fmt,...) do { ypObject *_ypmt_NOT_RAISES_obj = statement; _assert_not_exception(_ypmt_NOT_RAISES_obj, statement_fmt, __VA_ARGS__); } while (0)
+
+
+
+
+
+
+#define assert_not_raises(statement) _assert_not_raises((statement), "%s", #statement)
+
+
+#define _assert_not_raises_exc(statement,statement_fmt,...) do { ypObject *exc = NULL; statement; if (exc != NULL) { if (yp_isexceptionC(exc)) { munit_errorf("assertion failed: " statement_fmt "; !yp_isexceptionC(exc)", __VA_ARGS__); } munit_errorf("exc set to a non-exception: " statement_fmt, __VA_ARGS__); } } while (0)
+# 294 "Lib/munit_test/unittest.h"
+#define assert_not_raises_exc(statement) _assert_not_raises_exc((statement), "%s", #statement)
+
+#define _assert_isexception(obj,n,expected,obj_fmt,expected_fmt,...) do { if (n < 1) { munit_error("missing expected exception in assertion"); } if (!yp_isexceptionC(obj)) { munit_errorf("assertion failed: yp_isexceptionC(" obj_fmt ") (expected " expected_fmt ")", __VA_ARGS__); } if (!yp_isexception_arrayC(obj, n, expected)) { munit_errorf("assertion failed: yp_isexceptionCN(" obj_fmt ", N(" expected_fmt "))", __VA_ARGS__); } } while (0)
+# 313 "Lib/munit_test/unittest.h"
+#define assert_isexception(obj,...) do { ypObject *_ypmt_ISEXC_obj = (obj); ypObject *_ypmt_ISEXC_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_ISEXC_n = yp_lengthof_array(_ypmt_ISEXC_expected); _assert_isexception(_ypmt_ISEXC_obj, _ypmt_ISEXC_n, _ypmt_ISEXC_expected, "%s", "%s", #obj, #__VA_ARGS__); } while (0)
+# 330 "Lib/munit_test/unittest.h"
+#define assert_isexception_exc assert_raises_exc
+
+
+#define _assert_raises(statement,n,expected,statement_fmt,expected_fmt,...) do { ypObject *_ypmt_RAISES_statement = statement; _assert_isexception( _ypmt_RAISES_statement, n, expected, statement_fmt, expected_fmt, __VA_ARGS__); } while (0)
+
+
+
+
+
+
+
+#define assert_raises(statement,...) do { ypObject *_ypmt_RAISES_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_RAISES_n = yp_lengthof_array(_ypmt_RAISES_expected); _assert_raises((statement), _ypmt_RAISES_n, _ypmt_RAISES_expected, "%s", "%s", #statement, #__VA_ARGS__); } while (0)
+# 350 "Lib/munit_test/unittest.h"
+#define _assert_raises_exc(statement,n,expected,statement_fmt,expected_fmt,...) do { ypObject *exc = yp_None; if (n < 1) { munit_error("missing expected exception in assertion"); } statement; if (!yp_isexceptionC(exc)) { munit_errorf("assertion failed: " statement_fmt "; yp_isexceptionC(exc) (expected " expected_fmt ")", __VA_ARGS__); } if (!yp_isexception_arrayC(exc, n, expected)) { munit_errorf("assertion failed: " statement_fmt "; yp_isexceptionCN(exc, N(" expected_fmt "))", __VA_ARGS__); } } while (0)
+# 373 "Lib/munit_test/unittest.h"
+#define assert_raises_exc(statement,...) do { ypObject *_ypmt_RAISES_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_RAISES_n = yp_lengthof_array(_ypmt_RAISES_expected); _assert_raises_exc((statement), _ypmt_RAISES_n, _ypmt_RAISES_expected, "%s", "%s", #statement, #__VA_ARGS__); } while (0)
+# 383 "Lib/munit_test/unittest.h"
+#define _assert_typeC_exc(T,a_statement,op,b_statement,val_pri,a_fmt,b_fmt,...) do { T _ypmt_TYPEC_a; T _ypmt_TYPEC_b; _assert_not_raises_exc(_ypmt_TYPEC_a = (a_statement); _ypmt_TYPEC_b = (b_statement), a_fmt " " #op " " b_fmt, __VA_ARGS__); _assert_typeC(_ypmt_TYPEC_a, op, _ypmt_TYPEC_b, val_pri, a_fmt, b_fmt, __VA_ARGS__); } while (0)
+# 397 "Lib/munit_test/unittest.h"
+#define assert_intC_exc(a,op,b) _assert_typeC_exc(yp_int_t, a, op, b, PRIint, "%s", "%s", #a, #b)
+#define assert_ssizeC_exc(a,op,b) _assert_typeC_exc(yp_ssize_t, a, op, b, PRIssize, "%s", "%s", #a, #b)
+
+#define assert_hashC_exc(a,op,b) _assert_typeC_exc(yp_hash_t, a, op, b, PRIssize, "%s", "%s", #a, #b)
+
+
+
+
+
+#define _assert_typeC_raises_exc(T,a_statement,op,b_statement,excs,val_pri,a_fmt,b_fmt,excs_fmt,a_str,b_str,excs_str) do { ypObject *_ypmt_TYPEC_excs[] = {UNPACK excs}; yp_ssize_t _ypmt_TYPEC_n = yp_lengthof_array(_ypmt_TYPEC_excs); T _ypmt_TYPEC_a; T _ypmt_TYPEC_b; _assert_raises_exc(_ypmt_TYPEC_a = (a_statement), _ypmt_TYPEC_n, _ypmt_TYPEC_excs, a_fmt, excs_fmt, a_str, excs_str); _assert_not_raises_exc(_ypmt_TYPEC_b = (b_statement), b_fmt, b_str); _assert_typeC(_ypmt_TYPEC_a, op, _ypmt_TYPEC_b, val_pri, a_fmt, b_fmt, a_str, b_str); } while (0)
+# 424 "Lib/munit_test/unittest.h"
+#define assert_intC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_int_t, a, op, b, (__VA_ARGS__), PRIint, "%s", "%s", "%s", #a, #b, #__VA_ARGS__)
+
+
+#define assert_floatC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_float_t, a, op, b, (__VA_ARGS__), "lf", "%s", "%s", "%s", #a, #b, #__VA_ARGS__)
+
+
+#define assert_ssizeC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_ssize_t, a, op, b, (__VA_ARGS__), PRIssize, "%s", "%s", "%s", #a, #b, #__VA_ARGS__)
+
+
+#define assert_hashC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_hash_t, a, op, b, (__VA_ARGS__), PRIssize, "%s", "%s", "%s", #a, #b, #__VA_ARGS__)
+
+
+
+
+#define _assert_bool(obj,value,not_value,obj_fmt,...) do { if (obj == value) { } else if (obj == not_value) { munit_errorf("assertion failed: " obj_fmt " == " #value, __VA_ARGS__); } else { _ypmt_error_exception(obj, "expected a bool or an exception", obj_fmt, __VA_ARGS__); } } while (0)
+# 449 "Lib/munit_test/unittest.h"
+#define assert_falsy(obj) do { ypObject *_ypmt_FALSY_result = yp_bool(obj); _assert_bool(_ypmt_FALSY_result, yp_False, yp_True, "yp_bool(%s)", #obj); } while (0)
+
+
+
+
+
+#define assert_truthy(obj) do { ypObject *_ypmt_TRUTHY_result = yp_bool(obj); _assert_bool(_ypmt_TRUTHY_result, yp_True, yp_False, "yp_bool(%s)", #obj); } while (0)
+
+
+
+
+
+
+#define yp_is(a,b) ((a) == (b) ? yp_True : yp_False)
+#define yp_is_not(a,b) ((a) != (b) ? yp_True : yp_False)
+
+
+#define _assert_obj(a,op,b,a_fmt,b_fmt,...) do { ypObject *_ypmt_OBJ_result = yp_ ##op(a, b); _assert_bool(_ypmt_OBJ_result, yp_True, yp_False, "yp_" #op "(" a_fmt ", " b_fmt ")", __VA_ARGS__); } while (0)
+# 475 "Lib/munit_test/unittest.h"
+#define assert_obj(a,op,b) do { ypObject *_ypmt_OBJ_a = (a); ypObject *_ypmt_OBJ_b = (b); _assert_obj(_ypmt_OBJ_a, op, _ypmt_OBJ_b, "%s", "%s", #a, #b); } while (0)
+
+
+
+
+
+
+#define _assert_type_is(obj,expected,obj_fmt,expected_fmt,...) do { ypObject *_ypmt_TYPE_type_obj = yp_type(obj); _assert_ptr(_ypmt_TYPE_type_obj, ==, expected, "yp_type(" obj_fmt ")", expected_fmt, __VA_ARGS__); } while (0)
+
+
+
+
+
+
+
+#define assert_type_is(obj,expected) do { ypObject *_ypmt_TYPE_obj = (obj); ypObject *_ypmt_TYPE_expected = (expected); _assert_not_exception(_ypmt_TYPE_obj, "%s", #obj); _assert_type_is(_ypmt_TYPE_obj, _ypmt_TYPE_expected, "%s", "%s", #obj, #expected); } while (0)
+
+
+
+
+
+
+
+#define _assert_same_type(a,b,a_fmt,b_fmt,...) do { ypObject *_ypmt_TYPE_type_a = yp_type(a); ypObject *_ypmt_TYPE_type_b = yp_type(b); _assert_ptr(_ypmt_TYPE_type_a, ==, _ypmt_TYPE_type_b, "yp_type(" a_fmt ")", "yp_type(" b_fmt ")", __VA_ARGS__); } while (0)
+# 507 "Lib/munit_test/unittest.h"
+#define assert_same_type(a,b) do { ypObject *_ypmt_TYPE_a = (a); ypObject *_ypmt_TYPE_b = (b); _assert_not_exception(_ypmt_TYPE_a, "%s", #a); _assert_not_exception(_ypmt_TYPE_b, "%s", #b); _assert_same_type(_ypmt_TYPE_a, _ypmt_TYPE_b, "%s", "%s", #a, #b); } while (0)
+# 516 "Lib/munit_test/unittest.h"
+#define _assert_eq_same_type(a,b,a_fmt,b_fmt,...) do { _assert_obj(a, eq, b, a_fmt, b_fmt, __VA_ARGS__); _assert_same_type(a, b, a_fmt, b_fmt, __VA_ARGS__); } while (0)
+
+
+
+
+
+
+#define assert_eq_same_type(a,b) do { ypObject *_ypmt_EQ_TYPE_a = (a); ypObject *_ypmt_EQ_TYPE_b = (b); _assert_eq_same_type(_ypmt_EQ_TYPE_a, _ypmt_EQ_TYPE_b, "%s", "%s", #a, #b); } while (0)
+
+
+
+
+
+
+
+#define _assert_len(obj,expected,obj_fmt,expected_fmt,...) do { yp_ssize_t _ypmt_LEN_actual; _assert_not_raises_exc(_ypmt_LEN_actual = yp_lenC(obj, &exc), "yp_lenC(" obj_fmt ", &exc) == " expected_fmt, __VA_ARGS__); if (_ypmt_LEN_actual != expected) { munit_errorf("assertion failed: yp_lenC(" obj_fmt ", &exc) == " expected_fmt " (%" PRIssize " == %" PRIssize ")", __VA_ARGS__, _ypmt_LEN_actual, expected); } } while (0)
+# 543 "Lib/munit_test/unittest.h"
+#define assert_len(obj,expected) do { ypObject *_ypmt_LEN_obj = (obj); yp_ssize_t _ypmt_LEN_expected = (expected); _assert_len(_ypmt_LEN_obj, _ypmt_LEN_expected, "%s", "%s", #obj, #expected); } while (0)
+# 552 "Lib/munit_test/unittest.h"
+#define _assert_sequence(obj,items,obj_fmt,item_strs,...) do { yp_ssize_t _ypmt_SEQ_n = yp_lengthof_array(items); yp_ssize_t _ypmt_SEQ_i; _assert_len(obj, _ypmt_SEQ_n, obj_fmt, "%" PRIssize, __VA_ARGS__, _ypmt_SEQ_n); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(obj, _ypmt_SEQ_i); _assert_not_exception(_ypmt_SEQ_actual, "yp_getindexC(" obj_fmt ", %" PRIssize ")", __VA_ARGS__, _ypmt_SEQ_i); _assert_eq_same_type(_ypmt_SEQ_actual, items[_ypmt_SEQ_i], "yp_getindexC(" obj_fmt ", %" PRIssize ")", "%s", __VA_ARGS__, _ypmt_SEQ_i, item_strs[_ypmt_SEQ_i]); yp_decref(_ypmt_SEQ_actual); } } while (0)
+# 570 "Lib/munit_test/unittest.h"
+#define assert_sequence(obj,...) do { ypObject *_ypmt_SEQ_obj = (obj); ypObject *_ypmt_SEQ_items[] = {__VA_ARGS__}; char *_ypmt_SEQ_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_sequence(_ypmt_SEQ_obj, _ypmt_SEQ_items, "%s", _ypmt_SEQ_item_strs, #obj); } while (0)
+
+
+
+
+
+
+
+
+# 578 "Lib/munit_test/unittest.h"
+extern int _assert_setlike_helper(ypObject *mi, yp_uint64_t *mi_state, yp_ssize_t n,
+        ypObject **items, ypObject **actual, yp_ssize_t *items_i);
+
+
+
+#define _assert_setlike(obj,items,obj_fmt,item_strs,...) do { yp_ssize_t _ypmt_SET_n = yp_lengthof_array(items); int _ypmt_SET_found[yp_lengthof_array(items)] = {0}; yp_uint64_t _ypmt_SET_mi_state; ypObject *_ypmt_SET_mi; ypObject *_ypmt_SET_actual; yp_ssize_t _ypmt_SET_i; _assert_len(obj, _ypmt_SET_n, obj_fmt, "%" PRIssize, __VA_ARGS__, _ypmt_SET_n); _assert_not_raises(_ypmt_SET_mi = yp_miniiter(obj, &_ypmt_SET_mi_state), "yp_miniiter(" obj_fmt ", &mi_state)", __VA_ARGS__); while (_assert_setlike_helper(_ypmt_SET_mi, &_ypmt_SET_mi_state, _ypmt_SET_n, items, &_ypmt_SET_actual , &_ypmt_SET_i)) { _assert_not_exception(_ypmt_SET_actual, "yp_miniiter_next(yp_miniiter(" obj_fmt ", &mi_state), &mi_state)", __VA_ARGS__); if (_ypmt_SET_i >= _ypmt_SET_n) { munit_errorf("unexpected item yielded from " obj_fmt, __VA_ARGS__); } if (_ypmt_SET_found[_ypmt_SET_i]) { munit_errorf( "%s yielded twice from " obj_fmt, item_strs[_ypmt_SET_i], __VA_ARGS__); } _ypmt_SET_found[_ypmt_SET_i] = TRUE; _assert_same_type(_ypmt_SET_actual, items[_ypmt_SET_i], "<item in " obj_fmt ">", "%s", __VA_ARGS__, item_strs[_ypmt_SET_i]); yp_decref(_ypmt_SET_actual); } for (_ypmt_SET_i = 0; _ypmt_SET_i < _ypmt_SET_n; _ypmt_SET_i++) { if (!_ypmt_SET_found[_ypmt_SET_i]) { munit_errorf("%s not yielded from " obj_fmt, item_strs[_ypmt_SET_i], __VA_ARGS__); } } yp_decref(_ypmt_SET_mi); } while (0)
+# 630 "Lib/munit_test/unittest.h"
+#define assert_setlike(obj,...) do { ypObject *_ypmt_SET_obj = (obj); ypObject *_ypmt_SET_items[] = {__VA_ARGS__}; char *_ypmt_SET_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_setlike(_ypmt_SET_obj, _ypmt_SET_items, "%s", _ypmt_SET_item_strs, #obj); } while (0)
+
+
+
+
+
+
+
+extern int _assert_mapping_helper(ypObject *mi, yp_uint64_t *mi_state, yp_ssize_t k,
+        ypObject **items, ypObject **actual_key, ypObject **actual_value, yp_ssize_t *items_i);
+
+
+
+#define _assert_mapping(obj,items,obj_fmt,item_strs,...) do { yp_ssize_t _ypmt_MAP_k = yp_lengthof_array(items) / 2; int _ypmt_MAP_found[yp_lengthof_array(items) / 2] = {0}; yp_uint64_t _ypmt_MAP_mi_state; ypObject *_ypmt_MAP_mi; ypObject *_ypmt_MAP_actual_key; ypObject *_ypmt_MAP_actual_value; yp_ssize_t _ypmt_MAP_ki; if (yp_lengthof_array(items) % 2 != 0) { munit_error("expected an even number of objects for the (key, value) pairs"); } _assert_len(obj, _ypmt_MAP_k, obj_fmt, "%" PRIssize, __VA_ARGS__, _ypmt_MAP_k); _assert_not_raises(_ypmt_MAP_mi = yp_miniiter_items(obj, &_ypmt_MAP_mi_state), "yp_miniiter_items(" obj_fmt ", &mi_state)", __VA_ARGS__); while (_assert_mapping_helper(_ypmt_MAP_mi, &_ypmt_MAP_mi_state, _ypmt_MAP_k, items, &_ypmt_MAP_actual_key , &_ypmt_MAP_actual_value , &_ypmt_MAP_ki)) { _assert_not_exception(_ypmt_MAP_actual_key, "yp_miniiter_items_next(yp_miniiter_items(" obj_fmt ", &mi_state), &mi_state)", __VA_ARGS__); if (_ypmt_MAP_ki >= _ypmt_MAP_k) { munit_errorf("unexpected item yielded from " obj_fmt, __VA_ARGS__); } if (_ypmt_MAP_found[_ypmt_MAP_ki]) { munit_errorf("%s yielded twice from " obj_fmt, item_strs[_ypmt_MAP_ki * 2], __VA_ARGS__); } _ypmt_MAP_found[_ypmt_MAP_ki] = TRUE; _assert_same_type(_ypmt_MAP_actual_key, items[_ypmt_MAP_ki * 2], "<key in " obj_fmt ">", "%s", __VA_ARGS__, item_strs[_ypmt_MAP_ki * 2]); _assert_eq_same_type(_ypmt_MAP_actual_value, items[_ypmt_MAP_ki * 2 + 1], "<value " obj_fmt "[%s]>", "%s", __VA_ARGS__, item_strs[_ypmt_MAP_ki * 2], item_strs[_ypmt_MAP_ki * 2 + 1]); yp_decref(_ypmt_MAP_actual_key); yp_decref(_ypmt_MAP_actual_value); } for (_ypmt_MAP_ki = 0; _ypmt_MAP_ki < _ypmt_MAP_k; _ypmt_MAP_ki++) { if (!_ypmt_MAP_found[_ypmt_MAP_ki]) { munit_errorf( "%s not yielded from " obj_fmt, item_strs[_ypmt_MAP_ki * 2], __VA_ARGS__); } } yp_decref(_ypmt_MAP_mi); } while (0)
+# 701 "Lib/munit_test/unittest.h"
+#define assert_mapping(obj,...) do { ypObject *_ypmt_MAP_obj = (obj); ypObject *_ypmt_MAP_items[] = {__VA_ARGS__}; char *_ypmt_MAP_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_mapping(_ypmt_MAP_obj, _ypmt_MAP_items, "%s", _ypmt_MAP_item_strs, #obj); } while (0)
+# 711 "Lib/munit_test/unittest.h"
+#define assert_ptr_array(array,...) do { void **_ypmt_PTR_ARR_array = (void **)(array); void *_ypmt_PTR_ARR_items[] = {__VA_ARGS__}; char *_ypmt_PTR_ARR_item_strs[] = {STRINGIFY(__VA_ARGS__)}; yp_ssize_t _ypmt_PTR_ARR_n = yp_lengthof_array(_ypmt_PTR_ARR_items); yp_ssize_t _ypmt_PTR_ARR_i; if (_ypmt_PTR_ARR_n < 1) { munit_error("missing expected items in assertion"); } for (_ypmt_PTR_ARR_i = 0; _ypmt_PTR_ARR_i < _ypmt_PTR_ARR_n; _ypmt_PTR_ARR_i++) { _assert_ptr(_ypmt_PTR_ARR_array[_ypmt_PTR_ARR_i], ==, _ypmt_PTR_ARR_items[_ypmt_PTR_ARR_i], "%s[%" PRIssize "]", "%s", #array, _ypmt_PTR_ARR_i, _ypmt_PTR_ARR_item_strs[_ypmt_PTR_ARR_i]); } } while (0)
+# 732 "Lib/munit_test/unittest.h"
+#define ead(name,expression,assertion) do { ypObject *(name) = (expression); assertion; yp_decref(name); } while (0)
+
+
+
+
+
+
+
+#define _faulty_iter_test_raises(setup,iter_name,iter_expression,statement,tear_down,test_name,exc_suffix,expected,statement_str) do { ypObject *_ypmt_FLT_ITR_expected[] = {expected}; ypObject *iter_name; UNPACK setup; iter_name = iter_expression; _assert_raises ##exc_suffix(statement, 1, _ypmt_FLT_ITR_expected, "%s /*" test_name "*/", "%s", statement_str, #expected); yp_decref(iter_name); UNPACK tear_down; } while (0)
+# 754 "Lib/munit_test/unittest.h"
+#define _faulty_iter_test_succeeds(setup,iter_name,iter_expression,statement,assertion,tear_down,test_name,exc_suffix,statement_str) do { ypObject *iter_name; UNPACK setup; iter_name = iter_expression; _assert_not_raises ##exc_suffix(statement, "%s /*" test_name "*/", statement_str); UNPACK assertion; yp_decref(iter_name); UNPACK tear_down; } while (0)
+# 768 "Lib/munit_test/unittest.h"
+#define _faulty_iter_tests(setup,iter_name,iter_supplier,statement,assertion,tear_down,exc_suffix,statement_str) do { yp_ssize_t _ypmt_FLT_ITR_len = yp_lenC_not_raises(iter_supplier); if (_ypmt_FLT_ITR_len < 2) { munit_error("iter_supplier must contain at least two entries"); } _faulty_iter_test_raises(setup, iter_name, yp_StopIteration, statement, tear_down, "exc_passthrough", exc_suffix, yp_StopIteration, statement_str); _faulty_iter_test_raises(setup, iter_name, new_faulty_iter(iter_supplier, 0, yp_SyntaxError, _ypmt_FLT_ITR_len), statement, tear_down, "fail_start", exc_suffix, yp_SyntaxError, statement_str); _faulty_iter_test_raises(setup, iter_name, new_faulty_iter(iter_supplier, 1, yp_SyntaxError, _ypmt_FLT_ITR_len), statement, tear_down, "fail_mid", exc_suffix, yp_SyntaxError, statement_str); _faulty_iter_test_raises(setup, iter_name, new_faulty_iter(iter_supplier, 0, yp_GeneratorExit, _ypmt_FLT_ITR_len), statement, tear_down, "fail_start", exc_suffix, yp_GeneratorExit, statement_str); _faulty_iter_test_raises(setup, iter_name, new_faulty_iter( iter_supplier, _ypmt_FLT_ITR_len, yp_GeneratorExit, _ypmt_FLT_ITR_len), statement, tear_down, "fail_end", exc_suffix, yp_GeneratorExit, statement_str); _faulty_iter_test_succeeds(setup, iter_name, new_faulty_iter(iter_supplier, _ypmt_FLT_ITR_len + 1, yp_SyntaxError, 1), statement, assertion, tear_down, "hint_small", exc_suffix, statement_str); _faulty_iter_test_succeeds(setup, iter_name, new_faulty_iter(iter_supplier, _ypmt_FLT_ITR_len + 1, yp_SyntaxError, _ypmt_FLT_ITR_len + 100), statement, assertion, tear_down, "hint_large", exc_suffix, statement_str); } while (0)
+# 821 "Lib/munit_test/unittest.h"
+#define faulty_iter_tests(setup,iter_name,iter_supplier,statement,assertion,tear_down) do { ypObject *_ypmt_FLT_ITR_supplier = (iter_supplier); char _ypmt_FLT_ITR_statement_str[] = #statement; _faulty_iter_tests((setup), (iter_name), _ypmt_FLT_ITR_supplier, (statement), (assertion), (tear_down), , _ypmt_FLT_ITR_statement_str); yp_decref(_ypmt_FLT_ITR_supplier); } while (0)
+# 836 "Lib/munit_test/unittest.h"
+#define faulty_iter_tests_exc(setup,iter_name,iter_supplier,statement,assertion,tear_down) do { ypObject *_ypmt_FLT_ITR_supplier = (iter_supplier); char _ypmt_FLT_ITR_statement_str[] = #statement; _faulty_iter_tests((setup), (iter_name), _ypmt_FLT_ITR_supplier, (statement), (assertion), (tear_down), _exc, _ypmt_FLT_ITR_statement_str); yp_decref(_ypmt_FLT_ITR_supplier); } while (0)
+# 847 "Lib/munit_test/unittest.h"
+extern int yp_isexception_arrayC(ypObject *x, yp_ssize_t n, ypObject **exceptions);
+
+
+
+
+#define sprintf_array(array,fmt,...) do { yp_ssize_t _ypmt_SPRINTF_len = yp_lengthof_array(array); yp_ssize_t result = (yp_ssize_t)unittest_snprintf( (array), (size_t)_ypmt_SPRINTF_len, fmt, __VA_ARGS__); assert_ssizeC(result, >=, 0); assert_ssizeC(result, <, _ypmt_SPRINTF_len); } while (0)
+# 865 "Lib/munit_test/unittest.h"
+#define define_function(name,code,parameters) yp_parameter_decl_t _ ##name ##_parameters[] = {UNPACK parameters}; yp_function_decl_t _ ##name ##_declaration = { (code), 0, yp_lengthof_array(_ ##name ##_parameters), _ ##name ##_parameters, NULL, NULL}; ypObject *name = yp_functionC(&_ ##name ##_declaration)
+
+
+
+
+
+
+#define define_function2(name,code) yp_function_decl_t _ ##name ##_declaration = {(code), 0, 0, NULL, NULL, NULL}; ypObject *name = yp_functionC(&_ ##name ##_declaration)
+
+
+
+
+
+extern void pprint(FILE *f, ypObject *obj);
+
+
+typedef struct _fixture_type_t fixture_type_t;
+typedef struct _peer_type_t peer_type_t;
+typedef ypObject *(*objobjfunc)(ypObject *);
+typedef ypObject *(*objvarargfunc)(int, ...);
+typedef struct _rand_obj_supplier_memo_t rand_obj_supplier_memo_t;
+typedef ypObject *(*rand_obj_supplier_func)(const rand_obj_supplier_memo_t *);
+typedef struct _uniqueness_t uniqueness_t;
+typedef void (*rand_objs_func)(uniqueness_t *, yp_ssize_t, ypObject **);
+
+
+
+
+
+
+typedef struct _fixture_type_t {
+    char *name;
+    ypObject *yp_type;
+    ypObject *falsy;
+    fixture_type_t *pair;
+
+    rand_obj_supplier_func _new_rand;
+
+    objobjfunc new_;
+    peer_type_t *peers;
+
+
+
+
+    objvarargfunc newN;
+    rand_objs_func rand_items;
+
+
+
+
+    objvarargfunc newK;
+    rand_objs_func rand_values;
+
+
+
+    rand_objs_func rand_ordered_items;
+
+
+    int is_mutable;
+    int is_numeric;
+    int is_iterable;
+    int is_collection;
+    int is_sequence;
+    int is_string;
+    int is_setlike;
+    int is_mapping;
+    int is_callable;
+    int is_patterned;
+    int original_object_return;
+    int hashable_items_only;
+} fixture_type_t;
+# 950 "Lib/munit_test/unittest.h"
+typedef struct _peer_type_t {
+    fixture_type_t *type;
+    rand_objs_func rand_items;
+    rand_objs_func rand_values;
+} peer_type_t;
+
+
+
+extern fixture_type_t *fixture_type_type;
+extern fixture_type_t *fixture_type_NoneType;
+extern fixture_type_t *fixture_type_bool;
+extern fixture_type_t *fixture_type_int;
+extern fixture_type_t *fixture_type_intstore;
+extern fixture_type_t *fixture_type_float;
+extern fixture_type_t *fixture_type_floatstore;
+extern fixture_type_t *fixture_type_iter;
+extern fixture_type_t *fixture_type_range;
+extern fixture_type_t *fixture_type_bytes;
+extern fixture_type_t *fixture_type_bytearray;
+extern fixture_type_t *fixture_type_str;
+extern fixture_type_t *fixture_type_chrarray;
+extern fixture_type_t *fixture_type_tuple;
+extern fixture_type_t *fixture_type_list;
+extern fixture_type_t *fixture_type_frozenset;
+extern fixture_type_t *fixture_type_set;
+extern fixture_type_t *fixture_type_frozenset_dirty;
+extern fixture_type_t *fixture_type_set_dirty;
+extern fixture_type_t *fixture_type_frozendict;
+extern fixture_type_t *fixture_type_dict;
+extern fixture_type_t *fixture_type_frozendict_dirty;
+extern fixture_type_t *fixture_type_dict_dirty;
+extern fixture_type_t *fixture_type_function;
+
+typedef struct _fixture_t {
+    fixture_type_t *type;
+} fixture_t;
+
+
+typedef struct _fixture_types_t {
+    yp_ssize_t len;
+    fixture_type_t **types;
+} fixture_types_t;
+
+
+extern fixture_types_t *fixture_types_all;
+
+extern fixture_types_t *fixture_types_mutable;
+extern fixture_types_t *fixture_types_numeric;
+extern fixture_types_t *fixture_types_iterable;
+extern fixture_types_t *fixture_types_collection;
+extern fixture_types_t *fixture_types_sequence;
+extern fixture_types_t *fixture_types_string;
+extern fixture_types_t *fixture_types_setlike;
+extern fixture_types_t *fixture_types_mapping;
+extern fixture_types_t *fixture_types_callable;
+extern fixture_types_t *fixture_types_immutable;
+extern fixture_types_t *fixture_types_not_numeric;
+extern fixture_types_t *fixture_types_not_iterable;
+extern fixture_types_t *fixture_types_not_collection;
+extern fixture_types_t *fixture_types_not_sequence;
+extern fixture_types_t *fixture_types_not_string;
+extern fixture_types_t *fixture_types_not_setlike;
+extern fixture_types_t *fixture_types_not_mapping;
+extern fixture_types_t *fixture_types_not_callable;
+extern fixture_types_t *fixture_types_immutable_not_str;
+extern fixture_types_t *fixture_types_immutable_paired;
+
+
+
+extern char *param_values_types_all[];
+extern char *param_values_types_mutable[];
+extern char *param_values_types_numeric[];
+extern char *param_values_types_iterable[];
+extern char *param_values_types_collection[];
+extern char *param_values_types_sequence[];
+extern char *param_values_types_string[];
+extern char *param_values_types_setlike[];
+extern char *param_values_types_mapping[];
+extern char *param_values_types_callable[];
+extern char *param_values_types_immutable[];
+extern char *param_values_types_not_numeric[];
+extern char *param_values_types_not_iterable[];
+extern char *param_values_types_not_collection[];
+extern char *param_values_types_not_sequence[];
+extern char *param_values_types_not_string[];
+extern char *param_values_types_not_setlike[];
+extern char *param_values_types_not_mapping[];
+extern char *param_values_types_not_callable[];
+extern char *param_values_types_immutable_not_str[];
+extern char *param_values_types_immutable_paired[];
+
+
+
+
+extern int are_friend_types(fixture_type_t *type, fixture_type_t *other);
+
+
+extern int types_are_comparable(fixture_type_t *type, fixture_type_t *other);
+
+
+
+
+extern fixture_type_t *fixture_type_from_object(ypObject *object);
+
+
+
+extern int object_is_hashable(ypObject *object);
+
+
+extern char param_key_type[];
+
+
+
+
+
+
+
+typedef struct _uniqueness_t uniqueness_t;
+
+
+typedef struct _hashability_pair_t {
+    ypObject *hashable;
+    ypObject *unhashable;
+} hashability_pair_t;
+
+
+extern uniqueness_t *uniqueness_new(void);
+
+
+extern void uniqueness_dealloc(uniqueness_t *uq);
+
+
+extern ypObject *rand_obj_any(uniqueness_t *uq);
+
+
+extern ypObject *rand_obj_any_mutable(uniqueness_t *uq);
+
+
+extern ypObject *rand_obj_any_hashable(uniqueness_t *uq);
+
+
+extern ypObject *rand_obj_any_hashable_not_str(uniqueness_t *uq);
+
+
+
+extern hashability_pair_t rand_obj_any_hashability_pair(uniqueness_t *uq);
+
+
+extern ypObject *rand_obj_any_not_iterable(uniqueness_t *uq);
+
+
+extern ypObject *rand_obj_any_not_callable(uniqueness_t *uq);
+
+
+
+extern ypObject *rand_obj(uniqueness_t *uq, fixture_type_t *type);
+
+
+extern ypObject *new_iterN(int n, ...);
+extern ypObject *new_iterNV(int n, va_list args);
+
+
+
+
+extern ypObject *new_itemsK(fixture_type_t *outer, fixture_type_t *inner, int k, ...);
+extern ypObject *new_itemsKV(fixture_type_t *outer, fixture_type_t *inner, int k, va_list args);
+
+
+
+
+extern ypObject *new_faulty_iter(
+        ypObject *supplier, yp_ssize_t n, ypObject *exception, yp_ssize_t length_hint);
+
+
+
+
+
+
+#define obj_array_init(n,expression) {_COMMA_REPEAT ##n((expression))}
+
+
+
+
+
+
+
+#define obj_array_fill(array,uq,filler) (filler)((uq), yp_lengthof_array(array), (array))
+
+
+extern void obj_array_decref2(yp_ssize_t n, ypObject **array);
+
+
+
+#define obj_array_decref(array) obj_array_decref2(yp_lengthof_array(array), (array))
+
+
+
+yp_ssize_t yp_lenC_not_raises(ypObject *container);
+
+
+
+yp_int_t yp_asintC_not_raises(ypObject *number);
+
+
+
+
+
+extern void malloc_tracker_oom_after(int successful);
+
+
+
+extern void malloc_tracker_oom_disable(void);
+
+
+
+
+#define INCREMENTAL_RESIZE_LEN 16
+
+
+extern void *malloc_tracker_malloc(yp_ssize_t *actual, yp_ssize_t size);
+extern void *malloc_tracker_malloc_resize(
+        yp_ssize_t *actual, void *p, yp_ssize_t size, yp_ssize_t extra);
+extern void malloc_tracker_free(void *p);
+
+
+extern fixture_t *fixture_setup(const MunitParameter params[], void *user_data);
+extern void fixture_tear_down(fixture_t *fixture);
+
+
+
+extern void disable_debugger_popups(void);
+
+
+extern void unittest_initialize(void);
+
+#define SUITE_OF_TESTS_DECLS(name) extern MunitTest name ##_tests[]; extern void name ##_initialize(void)
+
+
+
+#define SUITE_OF_SUITES_DECLS(name) extern MunitSuite name ##_suites[]; extern void name ##_initialize(void)
+
+
+
+
+extern MunitSuite munit_test_suites[]; extern void munit_test_initialize(void);
+extern MunitTest test_unittest_tests[]; extern void test_unittest_initialize(void);
+extern MunitTest test_memory_tests[]; extern void test_memory_initialize(void);
+extern MunitTest test_refcnt_tests[]; extern void test_refcnt_initialize(void);
+
+extern MunitSuite test_objects_suites[]; extern void test_objects_initialize(void);
+extern MunitTest test_exception_tests[]; extern void test_exception_initialize(void);
+extern MunitTest test_frozendict_tests[]; extern void test_frozendict_initialize(void);
+extern MunitTest test_frozenset_tests[]; extern void test_frozenset_initialize(void);
+extern MunitTest test_function_tests[]; extern void test_function_initialize(void);
+extern MunitTest test_intdict_tests[]; extern void test_intdict_initialize(void);
+extern MunitTest test_iter_tests[]; extern void test_iter_initialize(void);
+extern MunitTest test_range_tests[]; extern void test_range_initialize(void);
+extern MunitTest test_tuple_tests[]; extern void test_tuple_initialize(void);
+
+extern MunitSuite test_protocols_suites[]; extern void test_protocols_initialize(void);
+extern MunitTest test_all_tests[]; extern void test_all_initialize(void);
+extern MunitTest test_collection_tests[]; extern void test_collection_initialize(void);
+extern MunitTest test_comparable_tests[]; extern void test_comparable_initialize(void);
+extern MunitTest test_iterable_tests[]; extern void test_iterable_initialize(void);
+extern MunitTest test_mapping_tests[]; extern void test_mapping_initialize(void);
+extern MunitTest test_sequence_tests[]; extern void test_sequence_initialize(void);
+extern MunitTest test_setlike_tests[]; extern void test_setlike_initialize(void);
+extern MunitTest test_string_tests[]; extern void test_string_initialize(void);
+# 3 "Lib/munit_test/test_objects/test_range.c" 2
+
+
+
+#define assert_range(obj,...) do { ypObject *_ypmt_RANGE_obj = (obj); ypObject *_ypmt_RANGE_items[] = {__VA_ARGS__}; char *_ypmt_RANGE_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_type_is(_ypmt_RANGE_obj, yp_t_range, "%s", "yp_t_range", #obj); _assert_sequence(_ypmt_RANGE_obj, _ypmt_RANGE_items, "%s", _ypmt_RANGE_item_strs, #obj); } while (0)
+# 16 "Lib/munit_test/test_objects/test_range.c"
+static void _test_rangeC(
+        ypObject *(*any_rangeC)(yp_int_t), ypObject *(*any_rangeC3)(yp_int_t, yp_int_t, yp_int_t))
+{
+    uniqueness_t *uq = uniqueness_new();
+    yp_ssize_t i;
+    yp_int_t itemsC[8];
+    yp_int_t stepC;
+    ypObject *items[(((yp_ssize_t)sizeof(itemsC)) / ((yp_ssize_t)sizeof((itemsC)[0])))];
+    (fixture_type_range->rand_items)((uq), (((yp_ssize_t)sizeof(items)) / ((yp_ssize_t)sizeof((items)[0]))), (items));
+    for (i = 0; i < (((yp_ssize_t)sizeof(itemsC)) / ((yp_ssize_t)sizeof((itemsC)[0]))); i++) itemsC[i] = yp_asintC_not_raises(items[i]);
+    stepC = itemsC[1] - itemsC[0];
+
+
+    do { ypObject *(r) = (any_rangeC(1)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {yp_i_zero}; char *_ypmt_RANGE_item_strs[] = {"yp_i_zero"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 29, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 29, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 29, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 29, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 29, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 29, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 29, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 29, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 29, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 29 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 29 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC(2)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {yp_i_zero, yp_i_one}; char *_ypmt_RANGE_item_strs[] = {"yp_i_zero", "yp_i_one"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 30, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 30, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 30, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 30, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 30, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 30, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 30, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 30, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 30, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 30 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 30 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(0, 1, 1)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {yp_i_zero}; char *_ypmt_RANGE_item_strs[] = {"yp_i_zero"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 31, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 31, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 31, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 31, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 31, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 31, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 31, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 31, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 31, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 31 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 31 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(0, 2, 1)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {yp_i_zero, yp_i_one}; char *_ypmt_RANGE_item_strs[] = {"yp_i_zero", "yp_i_one"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 32, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 32, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 32, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 32, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 32, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 32, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 32, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 32, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 32, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 32 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 32 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(itemsC[0], itemsC[1], stepC)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[0]}; char *_ypmt_RANGE_item_strs[] = {"items[0]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 33, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 33, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 33, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 33, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 33, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 33, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 33, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 33, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 33, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 33 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 33 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(itemsC[0], itemsC[2], stepC)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[0], items[1]}; char *_ypmt_RANGE_item_strs[] = {"items[0]", "items[1]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 34, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 34, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 34, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 34, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 34, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 34, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 34, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 34, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 34, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 34 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 34 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+
+
+    do { ypObject *(r) = (any_rangeC3(1, 0, -1)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {yp_i_one}; char *_ypmt_RANGE_item_strs[] = {"yp_i_one"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 37, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 37, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 37, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 37, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 37, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 37, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 37, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 37, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 37, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 37 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 37 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(1, -1, -1)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {yp_i_one, yp_i_zero}; char *_ypmt_RANGE_item_strs[] = {"yp_i_one", "yp_i_zero"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 38, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 38, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 38, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 38, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 38, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 38, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 38, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 38, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 38, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 38 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 38 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(itemsC[2], itemsC[1], -stepC)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[2]}; char *_ypmt_RANGE_item_strs[] = {"items[2]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 39, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 39, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 39, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 39, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 39, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 39, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 39, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 39, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 39, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 39 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 39 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(itemsC[2], itemsC[0], -stepC)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[2], items[1]}; char *_ypmt_RANGE_item_strs[] = {"items[2]", "items[1]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 40, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 40, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 40, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 40, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 40, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 40, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 40, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 40, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 40, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 40 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 40 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+
+
+    do { ypObject *(r) = (any_rangeC3(itemsC[0], itemsC[7], stepC)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[0], items[1], items[2], items[3], items[4], items[5], items[6]}; char *_ypmt_RANGE_item_strs[] = {"items[0]", "items[1]", "items[2]", "items[3]", "items[4]", "items[5]", "items[6]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 44, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 44, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 44, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 44, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 44, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 44, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 44, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 44, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 44, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 43 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 43 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0)
+                                                                                                  ;
+    do { ypObject *(r) = (any_rangeC3(itemsC[0], itemsC[7], stepC * 2)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[0], items[2], items[4], items[6]}; char *_ypmt_RANGE_item_strs[] = {"items[0]", "items[2]", "items[4]", "items[6]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 46, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 46, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 46, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 46, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 46, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 46, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 46, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 46, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 46, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 45 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 45 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0)
+                                                                    ;
+    do { ypObject *(r) = (any_rangeC3(itemsC[0], itemsC[7], stepC * 3)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[0], items[3], items[6]}; char *_ypmt_RANGE_item_strs[] = {"items[0]", "items[3]", "items[6]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 48, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 48, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 48, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 48, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 48, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 48, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 48, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 48, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 48, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 47 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 47 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0)
+                                                          ;
+    do { ypObject *(r) = (any_rangeC3(itemsC[0], itemsC[7], stepC * 4)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[0], items[4]}; char *_ypmt_RANGE_item_strs[] = {"items[0]", "items[4]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 49, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 49, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 49, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 49, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 49, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 49, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 49, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 49, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 49, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 49 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 49 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(itemsC[0], itemsC[7], stepC * 5)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[0], items[5]}; char *_ypmt_RANGE_item_strs[] = {"items[0]", "items[5]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 50, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 50, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 50, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 50, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 50, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 50, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 50, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 50, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 50, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 50 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 50 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(itemsC[0], itemsC[7], stepC * 6)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[0], items[6]}; char *_ypmt_RANGE_item_strs[] = {"items[0]", "items[6]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 51, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 51, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 51, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 51, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 51, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 51, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 51, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 51, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 51, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 51 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 51 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(itemsC[0], itemsC[7], stepC * 7)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[0]}; char *_ypmt_RANGE_item_strs[] = {"items[0]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 52, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 52, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 52, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 52, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 52, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 52, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 52, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 52, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 52, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 52 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 52 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+
+
+    do { ypObject *(r) = (any_rangeC3(itemsC[7], itemsC[0], stepC * -1)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[7], items[6], items[5], items[4], items[3], items[2], items[1]}; char *_ypmt_RANGE_item_strs[] = {"items[7]", "items[6]", "items[5]", "items[4]", "items[3]", "items[2]", "items[1]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 56, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 56, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 56, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 56, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 56, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 56, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 56, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 56, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 56, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 55 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 55 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0)
+                                                                                                  ;
+    do { ypObject *(r) = (any_rangeC3(itemsC[7], itemsC[0], stepC * -2)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[7], items[5], items[3], items[1]}; char *_ypmt_RANGE_item_strs[] = {"items[7]", "items[5]", "items[3]", "items[1]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 58, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 58, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 58, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 58, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 58, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 58, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 58, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 58, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 58, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 57 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 57 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0)
+                                                                    ;
+    do { ypObject *(r) = (any_rangeC3(itemsC[7], itemsC[0], stepC * -3)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[7], items[4], items[1]}; char *_ypmt_RANGE_item_strs[] = {"items[7]", "items[4]", "items[1]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 60, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 60, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 60, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 60, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 60, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 60, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 60, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 60, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 60, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 59 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 59 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0)
+                                                          ;
+    do { ypObject *(r) = (any_rangeC3(itemsC[7], itemsC[0], stepC * -4)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[7], items[3]}; char *_ypmt_RANGE_item_strs[] = {"items[7]", "items[3]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 61, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 61, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 61, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 61, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 61, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 61, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 61, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 61, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 61, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 61 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 61 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(itemsC[7], itemsC[0], stepC * -5)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[7], items[2]}; char *_ypmt_RANGE_item_strs[] = {"items[7]", "items[2]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 62, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 62, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 62, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 62, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 62, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 62, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 62, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 62, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 62, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 62 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 62 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(itemsC[7], itemsC[0], stepC * -6)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[7], items[1]}; char *_ypmt_RANGE_item_strs[] = {"items[7]", "items[1]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 63, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 63, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 63, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 63, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 63, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 63, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 63, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 63, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 63, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 63 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 63 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (any_rangeC3(itemsC[7], itemsC[0], stepC * -7)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {items[7]}; char *_ypmt_RANGE_item_strs[] = {"items[7]"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 64, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 64, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 64, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 64, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 64, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 64, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 64, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 64, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 64, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 64 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 64 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+
+
+    do { ypObject *_ypmt_TYPE_obj = (yp_range_empty); ypObject *_ypmt_TYPE_expected = (yp_t_range); do { if (yp_isexceptionC(_ypmt_TYPE_obj)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 67, "assertion failed: !yp_isexceptionC(" "%s" ")", "yp_range_empty"); } } while (0); do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_TYPE_obj); do { if (!(_ypmt_TYPE_type_obj == _ypmt_TYPE_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 67, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "%s" " (%" "p" " " "==" " %" "p" ") ", "yp_range_empty", "yp_t_range", _ypmt_TYPE_type_obj, _ypmt_TYPE_expected); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_LEN_obj = (yp_range_empty); yp_ssize_t _ypmt_LEN_expected = (0); do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 68 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 68 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_LEN_obj, &exc); if (exc != 
+# 68 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 68 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 68, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%s" "; !yp_isexceptionC(exc)", "yp_range_empty", "0"); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 68, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%s", "yp_range_empty", "0"); } } while (0); if (_ypmt_LEN_actual != _ypmt_LEN_expected) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 68, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%s" " (%" 
+# 68 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 68 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 68 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 68 "Lib/munit_test/test_objects/test_range.c"
+   ")", "yp_range_empty", "0", _ypmt_LEN_actual, _ypmt_LEN_expected); } } while (0); } while (0);
+    do { ypObject *_ypmt_OBJ_a = (any_rangeC(0)); ypObject *_ypmt_OBJ_b = (yp_range_empty); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 69, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_rangeC(0)", "yp_range_empty"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 69, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_rangeC(0)", "yp_range_empty"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 69, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_rangeC(0)", "yp_range_empty"); } while (0); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_OBJ_a = (any_rangeC(-1)); ypObject *_ypmt_OBJ_b = (yp_range_empty); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 70, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_rangeC(-1)", "yp_range_empty"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 70, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_rangeC(-1)", "yp_range_empty"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 70, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_rangeC(-1)", "yp_range_empty"); } while (0); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_OBJ_a = (any_rangeC3(0, 0, 1)); ypObject *_ypmt_OBJ_b = (yp_range_empty); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 71, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_rangeC3(0, 0, 1)", "yp_range_empty"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 71, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_rangeC3(0, 0, 1)", "yp_range_empty"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 71, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_rangeC3(0, 0, 1)", "yp_range_empty"); } while (0); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_OBJ_a = (any_rangeC3(0, -1, 1)); ypObject *_ypmt_OBJ_b = (yp_range_empty); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 72, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_rangeC3(0, -1, 1)", "yp_range_empty"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 72, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_rangeC3(0, -1, 1)", "yp_range_empty"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 72, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_rangeC3(0, -1, 1)", "yp_range_empty"); } while (0); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_OBJ_a = (any_rangeC3(0, 0, -1)); ypObject *_ypmt_OBJ_b = (yp_range_empty); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 73, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_rangeC3(0, 0, -1)", "yp_range_empty"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 73, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_rangeC3(0, 0, -1)", "yp_range_empty"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 73, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_rangeC3(0, 0, -1)", "yp_range_empty"); } while (0); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_OBJ_a = (any_rangeC3(-1, 0, -1)); ypObject *_ypmt_OBJ_b = (yp_range_empty); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 74, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_rangeC3(-1, 0, -1)", "yp_range_empty"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 74, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_rangeC3(-1, 0, -1)", "yp_range_empty"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 74, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_rangeC3(-1, 0, -1)", "yp_range_empty"); } while (0); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_OBJ_a = (any_rangeC3(itemsC[0], itemsC[0], stepC)); ypObject *_ypmt_OBJ_b = (yp_range_empty); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 75, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_rangeC3(itemsC[0], itemsC[0], stepC)", "yp_range_empty"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 75, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_rangeC3(itemsC[0], itemsC[0], stepC)", "yp_range_empty"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 75, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_rangeC3(itemsC[0], itemsC[0], stepC)", "yp_range_empty"); } while (0); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_OBJ_a = (any_rangeC3(itemsC[1], itemsC[0], stepC)); ypObject *_ypmt_OBJ_b = (yp_range_empty); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 76, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_rangeC3(itemsC[1], itemsC[0], stepC)", "yp_range_empty"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 76, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_rangeC3(itemsC[1], itemsC[0], stepC)", "yp_range_empty"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 76, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_rangeC3(itemsC[1], itemsC[0], stepC)", "yp_range_empty"); } while (0); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_OBJ_a = (any_rangeC3(itemsC[0], itemsC[0], -stepC)); ypObject *_ypmt_OBJ_b = (yp_range_empty); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 77, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_rangeC3(itemsC[0], itemsC[0], -stepC)", "yp_range_empty"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 77, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_rangeC3(itemsC[0], itemsC[0], -stepC)", "yp_range_empty"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 77, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_rangeC3(itemsC[0], itemsC[0], -stepC)", "yp_range_empty"); } while (0); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_OBJ_a = (any_rangeC3(itemsC[0], itemsC[1], -stepC)); ypObject *_ypmt_OBJ_b = (yp_range_empty); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 78, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_rangeC3(itemsC[0], itemsC[1], -stepC)", "yp_range_empty"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 78, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_rangeC3(itemsC[0], itemsC[1], -stepC)", "yp_range_empty"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 78, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_rangeC3(itemsC[0], itemsC[1], -stepC)", "yp_range_empty"); } while (0); } } while (0); } while (0); } while (0);
+
+
+    do { ypObject *_ypmt_RAISES_expected[] = {yp_ValueError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (any_rangeC3(0, 1, 0)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 81, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 81, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "any_rangeC3(0, 1, 0)", "yp_ValueError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 81, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "any_rangeC3(0, 1, 0)", "yp_ValueError"); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_RAISES_expected[] = {yp_SystemLimitationError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (any_rangeC3(0, 1, -0x7fffffffffffffffLL - 1)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 82, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 82, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "any_rangeC3(0, 1, -yp_INT_T_MAX - 1)", "yp_SystemLimitationError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 82, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "any_rangeC3(0, 1, -yp_INT_T_MAX - 1)", "yp_SystemLimitationError"); } } while (0); } while (0); } while (0)
+                                                                           ;
+    do { ypObject *_ypmt_RAISES_expected[] = {yp_SystemLimitationError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (any_rangeC3(
+# 84 "Lib/munit_test/test_objects/test_range.c" 3 4
+   (-0x7fffffffffffffffLL - 1LL)
+# 84 "Lib/munit_test/test_objects/test_range.c"
+   , 0x7fffffffffffffffLL, 1)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 84, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 84, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "any_rangeC3(yp_INT_T_MIN, yp_INT_T_MAX, 1)", "yp_SystemLimitationError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 84, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "any_rangeC3(yp_INT_T_MIN, yp_INT_T_MAX, 1)", "yp_SystemLimitationError"); } } while (0); } while (0); } while (0)
+                                     ;
+
+    obj_array_decref2((((yp_ssize_t)sizeof(items)) / ((yp_ssize_t)sizeof((items)[0]))), (items));
+    uniqueness_dealloc(uq);
+}
+
+static MunitResult test_rangeC(const MunitParameter params[], fixture_t *fixture)
+{
+    _test_rangeC(yp_rangeC, yp_rangeC3);
+    return MUNIT_OK;
+}
+
+static ypObject *rangeC_to_call_args_t_range(yp_int_t stop)
+{
+    ypObject *ist_stop;
+    ypObject *result;
+    do { ypObject *_ypmt_NOT_RAISES_obj = (ist_stop = yp_intstoreC(stop)); do { if (yp_isexceptionC(_ypmt_NOT_RAISES_obj)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 101, "assertion failed: !yp_isexceptionC(" "%s" ")", "ist_stop = yp_intstoreC(stop)"); } } while (0); } while (0);
+    result = yp_callN(yp_t_range, 1, ist_stop);
+    yp_decref(ist_stop);
+    return result;
+}
+
+static ypObject *rangeC3_to_call_args_t_range(yp_int_t start, yp_int_t stop, yp_int_t step)
+{
+    ypObject *ist_start;
+    ypObject *ist_stop;
+    ypObject *ist_step;
+    ypObject *result;
+    do { ypObject *_ypmt_NOT_RAISES_obj = (ist_start = yp_intstoreC(start)); do { if (yp_isexceptionC(_ypmt_NOT_RAISES_obj)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 113, "assertion failed: !yp_isexceptionC(" "%s" ")", "ist_start = yp_intstoreC(start)"); } } while (0); } while (0);
+    do { ypObject *_ypmt_NOT_RAISES_obj = (ist_stop = yp_intstoreC(stop)); do { if (yp_isexceptionC(_ypmt_NOT_RAISES_obj)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 114, "assertion failed: !yp_isexceptionC(" "%s" ")", "ist_stop = yp_intstoreC(stop)"); } } while (0); } while (0);
+    do { ypObject *_ypmt_NOT_RAISES_obj = (ist_step = yp_intstoreC(step)); do { if (yp_isexceptionC(_ypmt_NOT_RAISES_obj)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 115, "assertion failed: !yp_isexceptionC(" "%s" ")", "ist_step = yp_intstoreC(step)"); } } while (0); } while (0);
+    result = yp_callN(yp_t_range, 3, ist_start, ist_stop, ist_step);
+    yp_decrefN((3), ist_step, ist_stop, ist_start);
+    return result;
+}
+
+static MunitResult test_call_type(const MunitParameter params[], fixture_t *fixture)
+{
+    ypObject *ist_0 = yp_intstoreC(0);
+    ypObject *ist_1 = yp_intstoreC(1);
+    ypObject *ist_2 = yp_intstoreC(2);
+    ypObject *f_value = rand_obj(
+# 126 "Lib/munit_test/test_objects/test_range.c" 3 4
+                                ((void *)0)
+# 126 "Lib/munit_test/test_objects/test_range.c"
+                                    , fixture_type_float);
+    ypObject *str_cls = yp_str_frombytesC2(-1, "cls");
+    ypObject *str_x = yp_str_frombytesC2(-1, "x");
+    ypObject *str_step = yp_str_frombytesC2(-1, "step");
+    ypObject *str_rand = rand_obj(
+# 130 "Lib/munit_test/test_objects/test_range.c" 3 4
+                                 ((void *)0)
+# 130 "Lib/munit_test/test_objects/test_range.c"
+                                     , fixture_type_str);
+
+
+    _test_rangeC(rangeC_to_call_args_t_range, rangeC3_to_call_args_t_range);
+
+
+    do { ypObject *(r) = (yp_callN(yp_t_range, (2), ist_0, ist_1)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {yp_i_zero}; char *_ypmt_RANGE_item_strs[] = {"yp_i_zero"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 136, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 136, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 136, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 136, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 136, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 136, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 136, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 136, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 136, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 136 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 136 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *(r) = (yp_callN(yp_t_range, (2), ist_0, ist_2)); do { ypObject *_ypmt_RANGE_obj = (r); ypObject *_ypmt_RANGE_items[] = {yp_i_zero, yp_i_one}; char *_ypmt_RANGE_item_strs[] = {"yp_i_zero", "yp_i_one"}; do { ypObject *_ypmt_TYPE_type_obj = yp_type(_ypmt_RANGE_obj); do { if (!(_ypmt_TYPE_type_obj == yp_t_range)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 137, "assertion failed: " "yp_type(" "%s" ")" " " "==" " " "yp_t_range" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_TYPE_type_obj, yp_t_range); } } while (0); } while (0); do { yp_ssize_t _ypmt_SEQ_n = (((yp_ssize_t)sizeof(_ypmt_RANGE_items)) / ((yp_ssize_t)sizeof((_ypmt_RANGE_items)[0]))); yp_ssize_t _ypmt_SEQ_i; do { yp_ssize_t _ypmt_LEN_actual; do { ypObject *exc = 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   ; _ypmt_LEN_actual = yp_lenC(_ypmt_RANGE_obj, &exc); if (exc != 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   ((void *)0)
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   ) { if (yp_isexceptionC(exc)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 137, "assertion failed: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   "; !yp_isexceptionC(exc)", "r", _ypmt_SEQ_n); } munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 137, "exc set to a non-exception: " "yp_lenC(" "%s" ", &exc) == " "%" 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d"
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   , "r", _ypmt_SEQ_n); } } while (0); if (_ypmt_LEN_actual != _ypmt_SEQ_n) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 137, "assertion failed: yp_lenC(" "%s" ", &exc) == " "%" 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   " (%" 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   " == %" 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   ")", "r", _ypmt_SEQ_n, _ypmt_LEN_actual, _ypmt_SEQ_n); } } while (0); for (_ypmt_SEQ_i = 0; _ypmt_SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_actual = yp_getindexC(_ypmt_RANGE_obj, _ypmt_SEQ_i); do { if (yp_isexceptionC(_ypmt_SEQ_actual)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 137, "assertion failed: !yp_isexceptionC(" "yp_getindexC(" "%s" ", %" 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")", "r", _ypmt_SEQ_i); } } while (0); do { do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_SEQ_actual, _ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 137, "assertion failed: " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" " == " "yp_True", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 137, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 137, "expected a bool or an exception" ": " "yp_" "eq" "(" "yp_getindexC(" "%s" ", %" 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   ")" ", " "%s" ")", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i]); } while (0); } } while (0); } while (0); do { ypObject *_ypmt_TYPE_type_a = yp_type(_ypmt_SEQ_actual); ypObject *_ypmt_TYPE_type_b = yp_type(_ypmt_RANGE_items[_ypmt_SEQ_i]); do { if (!(_ypmt_TYPE_type_a == _ypmt_TYPE_type_b)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 137, "assertion failed: " "yp_type(" "yp_getindexC(" "%s" ", %" 
+# 137 "Lib/munit_test/test_objects/test_range.c" 3 4
+   "l" "d" 
+# 137 "Lib/munit_test/test_objects/test_range.c"
+   ")" ")" " " "==" " " "yp_type(" "%s" ")" " (%" "p" " " "==" " %" "p" ") ", "r", _ypmt_SEQ_i, _ypmt_RANGE_item_strs[_ypmt_SEQ_i], _ypmt_TYPE_type_a, _ypmt_TYPE_type_b); } } while (0); } while (0); } while (0); yp_decref(_ypmt_SEQ_actual); } } while (0); } while (0); yp_decref(r); } while (0);
+    do { ypObject *_ypmt_OBJ_a = (yp_callN(yp_t_range, (2), ist_2, ist_0)); ypObject *_ypmt_OBJ_b = (yp_range_empty); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 138, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "yp_callN(yp_t_range, N(ist_2, ist_0))", "yp_range_empty"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 138, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "yp_callN(yp_t_range, N(ist_2, ist_0))", "yp_range_empty"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 138, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "yp_callN(yp_t_range, N(ist_2, ist_0))", "yp_range_empty"); } while (0); } } while (0); } while (0); } while (0);
+
+
+    do { ypObject *_ypmt_RAISES_expected[] = {yp_TypeError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_callN(yp_t_range, (3), f_value, ist_2, ist_1)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 141, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 141, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_callN(yp_t_range, N(f_value, ist_2, ist_1))", "yp_TypeError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 141, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_callN(yp_t_range, N(f_value, ist_2, ist_1))", "yp_TypeError"); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_RAISES_expected[] = {yp_TypeError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_callN(yp_t_range, (3), ist_0, f_value, ist_1)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 142, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 142, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_callN(yp_t_range, N(ist_0, f_value, ist_1))", "yp_TypeError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 142, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_callN(yp_t_range, N(ist_0, f_value, ist_1))", "yp_TypeError"); } } while (0); } while (0); } while (0);
+    do { ypObject *_ypmt_RAISES_expected[] = {yp_TypeError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_callN(yp_t_range, (3), ist_0, ist_2, f_value)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 143, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 143, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_callN(yp_t_range, N(ist_0, ist_2, f_value))", "yp_TypeError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 143, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_callN(yp_t_range, N(ist_0, ist_2, f_value))", "yp_TypeError"); } } while (0); } while (0); } while (0);
+
+
+    {
+        ypObject *args_two = yp_tupleN((2), ist_0, ist_2);
+        ypObject *args_three = yp_tupleN((3), ist_0, ist_2, ist_1);
+        ypObject *args_four = yp_tupleN((4), ist_0, ist_2, ist_1, ist_1);
+        ypObject *kwargs_cls = yp_frozendictK(((4) / 2), str_cls, yp_t_range, str_x, ist_2);
+        ypObject *kwargs_step = yp_frozendictK(((2) / 2), str_step, ist_1);
+        ypObject *kwargs_rand = yp_frozendictK(((2) / 2), str_rand, ist_0);
+
+        do { ypObject *_ypmt_RAISES_expected[] = {yp_TypeError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_callN(yp_t_range, 0)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 154, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 154, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_callN(yp_t_range, 0)", "yp_TypeError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 154, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_callN(yp_t_range, 0)", "yp_TypeError"); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_RAISES_expected[] = {yp_TypeError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_call_stars(yp_t_range, yp_tuple_empty, yp_frozendict_empty)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 155, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 155, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_call_stars(yp_t_range, yp_tuple_empty, yp_frozendict_empty)", "yp_TypeError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 155, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_call_stars(yp_t_range, yp_tuple_empty, yp_frozendict_empty)", "yp_TypeError"); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_RAISES_expected[] = {yp_TypeError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_callN(yp_t_range, (4), ist_0, ist_2, ist_1, ist_1)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 156, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 156, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_callN(yp_t_range, N(ist_0, ist_2, ist_1, ist_1))", "yp_TypeError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 156, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_callN(yp_t_range, N(ist_0, ist_2, ist_1, ist_1))", "yp_TypeError"); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_RAISES_expected[] = {yp_TypeError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_call_stars(yp_t_range, args_four, yp_frozendict_empty)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 157, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 157, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_call_stars(yp_t_range, args_four, yp_frozendict_empty)", "yp_TypeError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 157, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_call_stars(yp_t_range, args_four, yp_frozendict_empty)", "yp_TypeError"); } } while (0); } while (0); } while (0);
+
+
+        do { ypObject *_ypmt_RAISES_expected[] = {yp_TypeError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_call_stars(yp_t_range, yp_tuple_empty, kwargs_cls)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 160, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 160, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_call_stars(yp_t_range, yp_tuple_empty, kwargs_cls)", "yp_TypeError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 160, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_call_stars(yp_t_range, yp_tuple_empty, kwargs_cls)", "yp_TypeError"); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_RAISES_expected[] = {yp_TypeError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_call_stars(yp_t_range, args_two, kwargs_step)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 161, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 161, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_call_stars(yp_t_range, args_two, kwargs_step)", "yp_TypeError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 161, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_call_stars(yp_t_range, args_two, kwargs_step)", "yp_TypeError"); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_RAISES_expected[] = {yp_TypeError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_call_stars(yp_t_range, args_three, kwargs_rand)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 162, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 162, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_call_stars(yp_t_range, args_three, kwargs_rand)", "yp_TypeError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 162, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_call_stars(yp_t_range, args_three, kwargs_rand)", "yp_TypeError"); } } while (0); } while (0); } while (0);
+
+        yp_decrefN((6), args_two, args_three, args_four, kwargs_cls, kwargs_step, kwargs_rand);
+    }
+
+
+    do { ypObject *_ypmt_ISEXC_obj = (yp_callN(yp_t_range, (1), yp_SyntaxError)); ypObject *_ypmt_ISEXC_expected[] = {yp_SyntaxError}; yp_ssize_t _ypmt_ISEXC_n = (((yp_ssize_t)sizeof(_ypmt_ISEXC_expected)) / ((yp_ssize_t)sizeof((_ypmt_ISEXC_expected)[0]))); do { if (_ypmt_ISEXC_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 168, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_ISEXC_obj)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 168, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_callN(yp_t_range, N(yp_SyntaxError))", "yp_SyntaxError"); } if (!yp_isexception_arrayC(_ypmt_ISEXC_obj, _ypmt_ISEXC_n, _ypmt_ISEXC_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 168, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_callN(yp_t_range, N(yp_SyntaxError))", "yp_SyntaxError"); } } while (0); } while (0);
+    do { ypObject *_ypmt_ISEXC_obj = (yp_callN(yp_t_range, (2), ist_0, yp_SyntaxError)); ypObject *_ypmt_ISEXC_expected[] = {yp_SyntaxError}; yp_ssize_t _ypmt_ISEXC_n = (((yp_ssize_t)sizeof(_ypmt_ISEXC_expected)) / ((yp_ssize_t)sizeof((_ypmt_ISEXC_expected)[0]))); do { if (_ypmt_ISEXC_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 169, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_ISEXC_obj)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 169, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_callN(yp_t_range, N(ist_0, yp_SyntaxError))", "yp_SyntaxError"); } if (!yp_isexception_arrayC(_ypmt_ISEXC_obj, _ypmt_ISEXC_n, _ypmt_ISEXC_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 169, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_callN(yp_t_range, N(ist_0, yp_SyntaxError))", "yp_SyntaxError"); } } while (0); } while (0);
+    do { ypObject *_ypmt_ISEXC_obj = (yp_callN(yp_t_range, (3), ist_0, ist_2, yp_SyntaxError)); ypObject *_ypmt_ISEXC_expected[] = {yp_SyntaxError}; yp_ssize_t _ypmt_ISEXC_n = (((yp_ssize_t)sizeof(_ypmt_ISEXC_expected)) / ((yp_ssize_t)sizeof((_ypmt_ISEXC_expected)[0]))); do { if (_ypmt_ISEXC_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 170, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_ISEXC_obj)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 170, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_callN(yp_t_range, N(ist_0, ist_2, yp_SyntaxError))", "yp_SyntaxError"); } if (!yp_isexception_arrayC(_ypmt_ISEXC_obj, _ypmt_ISEXC_n, _ypmt_ISEXC_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 170, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_callN(yp_t_range, N(ist_0, ist_2, yp_SyntaxError))", "yp_SyntaxError"); } } while (0); } while (0);
+
+    yp_decrefN((8), str_rand, str_step, str_x, str_cls, f_value, ist_2, ist_1, ist_0);
+    return MUNIT_OK;
+}
+
+
+
+
+
+
+static void _test_contains(fixture_type_t *type, ypObject *(*any_contains)(ypObject *, ypObject *))
+{
+
+
+    yp_int_t first = (yp_int_t)((yp_int32_t)munit_rand_uint32());
+    ypObject *int_first = yp_intC(first);
+    ypObject *int_first_p1 = yp_intC(first + 1);
+    ypObject *int_first_m1 = yp_intC(first - 1);
+    yp_int_t multi_step = (yp_int_t)munit_rand_int_range(2, 128);
+    yp_ssize_t multi_step_last_idx = (yp_ssize_t)munit_rand_int_range(2, 128);
+    yp_int_t last = first + (multi_step * multi_step_last_idx);
+    ypObject *int_last = yp_intC(last);
+    ypObject *int_last_p1 = yp_intC(last + 1);
+    ypObject *int_last_m1 = yp_intC(last - 1);
+    yp_ssize_t multi_step_middle_idx =
+            (yp_ssize_t)munit_rand_int_range(1, (int)(multi_step_last_idx - 1));
+    yp_int_t middle = first + (multi_step * multi_step_middle_idx);
+    ypObject *int_middle = yp_intC(middle);
+    ypObject *int_middle_p1 = yp_intC(middle + 1);
+    ypObject *int_middle_m1 = yp_intC(middle - 1);
+
+
+    {
+        ypObject *r = yp_rangeC3(first, first, 1);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 206, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 206, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 206, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_p1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 207, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_p1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 207, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_p1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 207, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_p1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_m1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 208, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_m1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 208, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_m1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 208, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_m1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+
+        yp_decrefN((1), r);
+    }
+
+
+    {
+        ypObject *r = yp_rangeC3(first, first + 1, 1);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 217, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 217, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 217, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_p1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 218, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_p1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 218, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_p1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 218, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_p1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_m1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 219, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_m1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 219, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_m1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 219, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_m1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+
+        yp_decrefN((1), r);
+    }
+
+
+    {
+        ypObject *r = yp_rangeC3(first, last + 1, 1);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 228, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 228, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 228, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_p1)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 229, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_p1)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 229, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_p1)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 229, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_p1)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_m1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 230, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_m1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 230, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_m1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 230, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_m1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 232, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 232, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 232, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last_p1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 233, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last_p1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 233, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last_p1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 233, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last_p1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last_m1)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 234, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last_m1)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 234, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last_m1)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 234, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last_m1)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 236, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 236, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 236, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle_p1)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 237, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle_p1)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 237, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle_p1)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 237, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle_p1)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle_m1)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 238, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle_m1)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 238, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle_m1)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 238, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle_m1)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+
+        yp_decrefN((1), r);
+    }
+
+
+    {
+        ypObject *r = yp_rangeC3(last, first - 1, -1);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 247, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 247, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 247, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_p1)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 248, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_p1)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 248, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_p1)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 248, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_p1)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_m1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 249, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_m1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 249, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_m1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 249, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_m1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 251, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 251, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 251, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last_p1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 252, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last_p1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 252, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last_p1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 252, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last_p1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last_m1)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 253, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last_m1)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 253, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last_m1)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 253, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last_m1)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 255, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 255, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 255, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle_p1)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 256, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle_p1)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 256, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle_p1)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 256, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle_p1)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle_m1)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 257, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle_m1)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 257, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle_m1)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 257, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle_m1)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+
+        yp_decrefN((1), r);
+    }
+
+
+    {
+        ypObject *r = yp_rangeC3(first, last + 1, multi_step);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 266, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 266, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 266, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_p1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 267, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_p1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 267, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_p1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 267, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_p1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_m1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 268, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_m1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 268, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_m1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 268, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_m1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 270, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 270, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 270, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last_p1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 271, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last_p1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 271, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last_p1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 271, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last_p1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last_m1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 272, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last_m1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 272, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last_m1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 272, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last_m1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 274, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 274, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 274, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle_p1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 275, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle_p1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 275, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle_p1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 275, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle_p1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle_m1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 276, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle_m1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 276, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle_m1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 276, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle_m1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+
+        yp_decrefN((1), r);
+    }
+
+
+    {
+        ypObject *r = yp_rangeC3(last, first - 1, -multi_step);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 285, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 285, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 285, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_p1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 286, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_p1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 286, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_p1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 286, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_p1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_first_m1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 287, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_first_m1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 287, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_first_m1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 287, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_first_m1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 289, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 289, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 289, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last_p1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 290, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last_p1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 290, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last_p1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 290, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last_p1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_last_m1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 291, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_last_m1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 291, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_last_m1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 291, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_last_m1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle)); ypObject *_ypmt_OBJ_b = (yp_True); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 293, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle)", "yp_True"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 293, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle)", "yp_True"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 293, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle)", "yp_True"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle_p1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 294, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle_p1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 294, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle_p1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 294, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle_p1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *_ypmt_OBJ_a = (any_contains(r, int_middle_m1)); ypObject *_ypmt_OBJ_b = (yp_False); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 295, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "any_contains(r, int_middle_m1)", "yp_False"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 295, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "any_contains(r, int_middle_m1)", "yp_False"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 295, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "any_contains(r, int_middle_m1)", "yp_False"); } while (0); } } while (0); } while (0); } while (0);
+
+        yp_decrefN((1), r);
+    }
+
+    yp_decrefN((9), int_first, int_first_p1, int_first_m1, int_last, int_last_p1, int_last_m1, int_middle, int_middle_p1, int_middle_m1
+                                                     );
+}
+
+static ypObject *contains_to_in(ypObject *r, ypObject *x) { return yp_in(x, r); }
+
+static ypObject *contains_to_not_in(ypObject *r, ypObject *x) { return yp_not(yp_not_in(x, r)); }
+
+static MunitResult test_contains(const MunitParameter params[], fixture_t *fixture)
+{
+    _test_contains(fixture->type, yp_contains);
+    _test_contains(fixture->type, contains_to_in);
+    _test_contains(fixture->type, contains_to_not_in);
+    return MUNIT_OK;
+}
+
+static ypObject *_contains_to_findC(yp_ssize_t (*any_findC)(ypObject *, ypObject *, ypObject **),
+        int raises, ypObject *r, ypObject *x)
+{
+    ypObject *exc = yp_None;
+    yp_ssize_t result = any_findC(r, x, &exc);
+    if (result < 0) {
+        do { yp_ssize_t munit_tmp_a_ = (result); yp_ssize_t munit_tmp_b_ = (-1); if (!(munit_tmp_a_ == munit_tmp_b_)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 322, "assertion failed: %s %s %s (" "" "%" 
+# 322 "Lib/munit_test/test_objects/test_range.c" 3 4
+       "l" "d" 
+# 322 "Lib/munit_test/test_objects/test_range.c"
+       "" " %s " "" "%" 
+# 322 "Lib/munit_test/test_objects/test_range.c" 3 4
+       "l" "d" 
+# 322 "Lib/munit_test/test_objects/test_range.c"
+       "" ")", "result", "==", "-1", munit_tmp_a_, "==", munit_tmp_b_); } } while (0) ;
+        if (raises) {
+            do { ypObject *_ypmt_ISEXC_obj = (exc); ypObject *_ypmt_ISEXC_expected[] = {yp_ValueError}; yp_ssize_t _ypmt_ISEXC_n = (((yp_ssize_t)sizeof(_ypmt_ISEXC_expected)) / ((yp_ssize_t)sizeof((_ypmt_ISEXC_expected)[0]))); do { if (_ypmt_ISEXC_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 324, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_ISEXC_obj)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 324, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "exc", "yp_ValueError"); } if (!yp_isexception_arrayC(_ypmt_ISEXC_obj, _ypmt_ISEXC_n, _ypmt_ISEXC_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 324, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "exc", "yp_ValueError"); } } while (0); } while (0);
+        } else {
+            do { ypObject *_ypmt_OBJ_a = (exc); ypObject *_ypmt_OBJ_b = (yp_None); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 326, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "exc", "yp_None"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 326, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "exc", "yp_None"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 326, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "exc", "yp_None"); } while (0); } } while (0); } while (0); } while (0);
+        };
+        return yp_False;
+    } else {
+        do { ypObject *_ypmt_OBJ_a = (exc); ypObject *_ypmt_OBJ_b = (yp_None); do { ypObject *_ypmt_OBJ_result = ((_ypmt_OBJ_a) == (_ypmt_OBJ_b) ? yp_True : yp_False); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 330, "assertion failed: " "yp_" "is" "(" "%s" ", " "%s" ")" " == " "yp_True", "exc", "yp_None"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 330, "assertion failed: !yp_isexceptionC(" "yp_" "is" "(" "%s" ", " "%s" ")" ")", "exc", "yp_None"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 330, "expected a bool or an exception" ": " "yp_" "is" "(" "%s" ", " "%s" ")", "exc", "yp_None"); } while (0); } } while (0); } while (0); } while (0);
+        do { ypObject *(item) = (yp_getindexC(r, result)); do { ypObject *_ypmt_OBJ_a = (item); ypObject *_ypmt_OBJ_b = (x); do { ypObject *_ypmt_OBJ_result = yp_eq(_ypmt_OBJ_a, _ypmt_OBJ_b); do { if (_ypmt_OBJ_result == yp_True) { } else if (_ypmt_OBJ_result == yp_False) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 331, "assertion failed: " "yp_" "eq" "(" "%s" ", " "%s" ")" " == " "yp_True", "item", "x"); } else { do { do { if (yp_isexceptionC(_ypmt_OBJ_result)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 331, "assertion failed: !yp_isexceptionC(" "yp_" "eq" "(" "%s" ", " "%s" ")" ")", "item", "x"); } } while (0); munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 331, "expected a bool or an exception" ": " "yp_" "eq" "(" "%s" ", " "%s" ")", "item", "x"); } while (0); } } while (0); } while (0); } while (0); yp_decref(item); } while (0);
+        return yp_True;
+    }
+}
+
+static ypObject *contains_to_findC(ypObject *r, ypObject *x)
+{
+    return _contains_to_findC(yp_findC, (0 == 1), r, x);
+}
+
+static MunitResult test_findC(const MunitParameter params[], fixture_t *fixture)
+{
+    _test_contains(fixture->type, contains_to_findC);
+    return MUNIT_OK;
+}
+
+static ypObject *contains_to_indexC(ypObject *r, ypObject *x)
+{
+    return _contains_to_findC(yp_indexC, (1 == 1), r, x);
+}
+
+static MunitResult test_indexC(const MunitParameter params[], fixture_t *fixture)
+{
+    _test_contains(fixture->type, contains_to_indexC);
+    return MUNIT_OK;
+}
+
+static ypObject *contains_to_rfindC(ypObject *r, ypObject *x)
+{
+    return _contains_to_findC(yp_rfindC, (0 == 1), r, x);
+}
+
+static MunitResult test_rfindC(const MunitParameter params[], fixture_t *fixture)
+{
+    _test_contains(fixture->type, contains_to_rfindC);
+    return MUNIT_OK;
+}
+
+static ypObject *contains_to_rindexC(ypObject *r, ypObject *x)
+{
+    return _contains_to_findC(yp_rindexC, (1 == 1), r, x);
+}
+
+static MunitResult test_rindexC(const MunitParameter params[], fixture_t *fixture)
+{
+    _test_contains(fixture->type, contains_to_rindexC);
+    return MUNIT_OK;
+}
+
+static MunitResult test_oom(const MunitParameter params[], fixture_t *fixture)
+{
+    uniqueness_t *uq = uniqueness_new();
+    ypObject *items[2];
+    (fixture_type_range->rand_items)((uq), (((yp_ssize_t)sizeof(items)) / ((yp_ssize_t)sizeof((items)[0]))), (items));
+
+
+    {
+        ypObject *r = fixture_type_range->newN((2), items[0], items[1]);
+        malloc_tracker_oom_after(0);
+        do { ypObject *_ypmt_RAISES_expected[] = {yp_MemoryError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_getsliceC4(r, 0, 1, 1)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 390, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 390, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_getsliceC4(r, 0, 1, 1)", "yp_MemoryError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 390, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_getsliceC4(r, 0, 1, 1)", "yp_MemoryError"); } } while (0); } while (0); } while (0);
+        malloc_tracker_oom_disable();
+        yp_decrefN((1), r);
+    }
+
+
+    malloc_tracker_oom_after(0);
+    do { ypObject *_ypmt_RAISES_expected[] = {yp_MemoryError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_rangeC(1)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 397, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 397, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_rangeC(1)", "yp_MemoryError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 397, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_rangeC(1)", "yp_MemoryError"); } } while (0); } while (0); } while (0);
+    malloc_tracker_oom_disable();
+
+
+    malloc_tracker_oom_after(0);
+    do { ypObject *_ypmt_RAISES_expected[] = {yp_MemoryError}; yp_ssize_t _ypmt_RAISES_n = (((yp_ssize_t)sizeof(_ypmt_RAISES_expected)) / ((yp_ssize_t)sizeof((_ypmt_RAISES_expected)[0]))); do { ypObject *_ypmt_RAISES_statement = (yp_rangeC3(0, 1, 1)); do { if (_ypmt_RAISES_n < 1) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 402, "%s", "missing expected exception in assertion"); } if (!yp_isexceptionC(_ypmt_RAISES_statement)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 402, "assertion failed: yp_isexceptionC(" "%s" ") (expected " "%s" ")", "yp_rangeC3(0, 1, 1)", "yp_MemoryError"); } if (!yp_isexception_arrayC(_ypmt_RAISES_statement, _ypmt_RAISES_n, _ypmt_RAISES_expected)) { munit_errorf_ex("Lib/munit_test/test_objects/test_range.c", 402, "assertion failed: yp_isexceptionCN(" "%s" ", N(" "%s" "))", "yp_rangeC3(0, 1, 1)", "yp_MemoryError"); } } while (0); } while (0); } while (0);
+    malloc_tracker_oom_disable();
+
+    obj_array_decref2((((yp_ssize_t)sizeof(items)) / ((yp_ssize_t)sizeof((items)[0]))), (items));
+    uniqueness_dealloc(uq);
+    return MUNIT_OK;
+}
+
+
+MunitTest test_range_tests[] = {{ "/" "test_rangeC", (MunitTestFunc)(test_rangeC), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, 
+# 411 "Lib/munit_test/test_objects/test_range.c" 3 4
+                               ((void *)0) 
+# 411 "Lib/munit_test/test_objects/test_range.c"
+                               }, { "/" "test_call_type", (MunitTestFunc)(test_call_type), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, 
+# 411 "Lib/munit_test/test_objects/test_range.c" 3 4
+                                                        ((void *)0) 
+# 411 "Lib/munit_test/test_objects/test_range.c"
+                                                        },
+        { "/" "test_contains", (MunitTestFunc)(test_contains), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, 
+# 412 "Lib/munit_test/test_objects/test_range.c" 3 4
+       ((void *)0) 
+# 412 "Lib/munit_test/test_objects/test_range.c"
+       }, { "/" "test_findC", (MunitTestFunc)(test_findC), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, 
+# 412 "Lib/munit_test/test_objects/test_range.c" 3 4
+                                  ((void *)0) 
+# 412 "Lib/munit_test/test_objects/test_range.c"
+                                  }, { "/" "test_indexC", (MunitTestFunc)(test_indexC), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, 
+# 412 "Lib/munit_test/test_objects/test_range.c" 3 4
+                                                          ((void *)0) 
+# 412 "Lib/munit_test/test_objects/test_range.c"
+                                                          },
+        { "/" "test_rfindC", (MunitTestFunc)(test_rfindC), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, 
+# 413 "Lib/munit_test/test_objects/test_range.c" 3 4
+       ((void *)0) 
+# 413 "Lib/munit_test/test_objects/test_range.c"
+       }, { "/" "test_rindexC", (MunitTestFunc)(test_rindexC), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, 
+# 413 "Lib/munit_test/test_objects/test_range.c" 3 4
+                                ((void *)0) 
+# 413 "Lib/munit_test/test_objects/test_range.c"
+                                }, { "/" "test_oom", (MunitTestFunc)(test_oom), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, 
+# 413 "Lib/munit_test/test_objects/test_range.c" 3 4
+                                                          ((void *)0) 
+# 413 "Lib/munit_test/test_objects/test_range.c"
+                                                          }, {
+# 413 "Lib/munit_test/test_objects/test_range.c" 3 4
+                                                                                 ((void *)0)
+# 413 "Lib/munit_test/test_objects/test_range.c"
+                                                                                     }};
+
+
+extern void test_range_initialize(void) {}
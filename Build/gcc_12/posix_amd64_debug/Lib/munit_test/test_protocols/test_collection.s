@@ -0,0 +1,36827 @@
+	.file	"test_collection.c"
+# GNU C17 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -m64 -mtune=generic -march=x86-64 -g3 -Og -fvisibility=hidden -ftrapv -fstack-clash-protection -fno-omit-frame-pointer -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "Lib/munit_test/test_protocols/test_collection.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"yp_MethodError"
+.LC1:
+	.string	"yp_reserveC(self, 32, &exc)"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC2:
+	.string	"assertion failed: %s; yp_isexceptionC(exc) (expected %s)"
+	.align 8
+.LC3:
+	.string	"Lib/munit_test/test_protocols/test_collection.c"
+	.align 8
+.LC4:
+	.string	"assertion failed: %s; yp_isexceptionCN(exc, N(%s))"
+	.section	.rodata.str1.1
+.LC5:
+	.string	"2"
+.LC6:
+	.string	"self"
+	.section	.rodata.str1.8
+	.align 8
+.LC7:
+	.string	"assertion failed: yp_lenC(%s, &exc) == %s; !yp_isexceptionC(exc)"
+	.align 8
+.LC8:
+	.string	"exc set to a non-exception: yp_lenC(%s, &exc) == %s"
+	.align 8
+.LC9:
+	.string	"assertion failed: yp_lenC(%s, &exc) == %s (%ld == %ld)"
+	.align 8
+.LC10:
+	.string	"assertion failed: %s; !yp_isexceptionC(exc)"
+	.align 8
+.LC11:
+	.string	"exc set to a non-exception: %s"
+	.section	.rodata.str1.1
+.LC12:
+	.string	"yp_True"
+.LC13:
+	.string	"yp_contains(self, items[0])"
+	.section	.rodata.str1.8
+	.align 8
+.LC14:
+	.string	"assertion failed: yp_is(%s, %s) == yp_True"
+	.align 8
+.LC15:
+	.string	"assertion failed: !yp_isexceptionC(yp_is(%s, %s))"
+	.align 8
+.LC16:
+	.string	"expected a bool or an exception: yp_is(%s, %s)"
+	.section	.rodata.str1.1
+.LC17:
+	.string	"yp_contains(self, items[1])"
+	.section	.rodata.str1.8
+	.align 8
+.LC18:
+	.string	"yp_setitem(self, items[i], yp_None, &exc)"
+	.align 8
+.LC19:
+	.string	"yp_push(self, items[i % 2], &exc)"
+	.section	.rodata.str1.1
+.LC20:
+	.string	"yp_push(self, items[i], &exc)"
+	.globl	__addvsi3
+.LC21:
+	.string	"32"
+.LC22:
+	.string	"items[0]"
+.LC23:
+	.string	"items[1]"
+.LC24:
+	.string	"keys"
+	.section	.rodata.str1.8
+	.align 8
+.LC25:
+	.string	"assertion failed: yp_lenC(%s, &exc) == %ld; !yp_isexceptionC(exc)"
+	.align 8
+.LC26:
+	.string	"exc set to a non-exception: yp_lenC(%s, &exc) == %ld"
+	.align 8
+.LC27:
+	.string	"assertion failed: yp_lenC(%s, &exc) == %ld (%ld == %ld)"
+	.align 8
+.LC28:
+	.string	"assertion failed: !yp_isexceptionC(yp_miniiter(%s, &mi_state))"
+	.align 8
+.LC29:
+	.string	"assertion failed: !yp_isexceptionC(yp_miniiter_next(yp_miniiter(%s, &mi_state), &mi_state))"
+	.align 8
+.LC30:
+	.string	"unexpected item yielded from %s"
+	.section	.rodata.str1.1
+.LC31:
+	.string	"%s yielded twice from %s"
+	.section	.rodata.str1.8
+	.align 8
+.LC32:
+	.string	"assertion failed: yp_type(<item in %s>) == yp_type(%s) (%p == %p) "
+	.section	.rodata.str1.1
+.LC33:
+	.string	"%s not yielded from %s"
+	.globl	__addvdi3
+.LC34:
+	.string	"yp_reserveC(self, 1, &exc)"
+.LC35:
+	.string	"yp_reserveC(self, 0, &exc)"
+.LC36:
+	.string	"yp_reserveC(self, -1, &exc)"
+.LC37:
+	.string	"0"
+.LC38:
+	.string	"yp_MemorySizeOverflowError"
+	.section	.rodata.str1.8
+	.align 8
+.LC39:
+	.string	"yp_reserveC(self, yp_SSIZE_T_MAX, &exc)"
+	.section	.rodata.str1.1
+.LC40:
+	.string	"yp_MemoryError"
+.LC41:
+	.string	"yp_reserveC(self, 1000, &exc)"
+	.text
+	.type	test_reserve, @function
+test_reserve:
+.LVL0:
+.LFB26:
+	.file 1 "Lib/munit_test/test_protocols/test_collection.c"
+	.loc 1 208 1 view -0
+	.cfi_startproc
+	.loc 1 208 1 is_stmt 0 view .LVU1
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$344, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 209 5 is_stmt 1 view .LVU2
+# Lib/munit_test/test_protocols/test_collection.c:209:     fixture_type_t *type = fixture->type;
+	.loc 1 209 21 is_stmt 0 view .LVU3
+	movq	(%rsi), %r12	# fixture_150(D)->type, type
+.LVL1:
+	.loc 1 210 5 is_stmt 1 view .LVU4
+# Lib/munit_test/test_protocols/test_collection.c:210:     uniqueness_t   *uq = uniqueness_new();
+	.loc 1 210 24 is_stmt 0 view .LVU5
+	call	uniqueness_new@PLT	#
+.LVL2:
+	.loc 1 210 24 view .LVU6
+	movq	%rax, %rbx	# tmp606, uq
+.LVL3:
+	.loc 1 211 5 is_stmt 1 view .LVU7
+	.loc 1 212 5 view .LVU8
+	.loc 1 213 5 view .LVU9
+# Lib/munit_test/test_protocols/test_collection.c:213:     obj_array_fill(items, uq, type->rand_items);
+	.loc 1 213 10 is_stmt 0 view .LVU10
+	leaq	-304(%rbp), %rdx	#, tmp257
+	movl	$32, %esi	#,
+	movq	%rax, %rdi	# uq,
+	call	*64(%r12)	# type_151->rand_items
+.LVL4:
+	.loc 1 216 5 is_stmt 1 view .LVU11
+# Lib/munit_test/test_protocols/test_collection.c:216:     if (!type->is_mutable) {
+	.loc 1 216 8 is_stmt 0 view .LVU12
+	cmpl	$0, 96(%r12)	#, type_151->is_mutable
+	jne	.L2	#,
+.LBB2:
+	.loc 1 217 9 is_stmt 1 view .LVU13
+# Lib/munit_test/test_protocols/test_collection.c:217:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 217 26 is_stmt 0 view .LVU14
+	movq	-296(%rbp), %rdx	# items[1],
+	movq	-304(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r12)	# type_151->newN
+.LVL5:
+	movq	%rax, %r12	# tmp607, self
+.LVL6:
+	.loc 1 218 9 is_stmt 1 view .LVU15
+.LBB3:
+	.loc 1 218 14 view .LVU16
+# Lib/munit_test/test_protocols/test_collection.c:218:         assert_raises_exc(yp_reserveC(self, 32, &exc), yp_MethodError);
+	.loc 1 218 24 is_stmt 0 view .LVU17
+	movq	yp_MethodError(%rip), %rax	# yp_MethodError, yp_MethodError
+.LVL7:
+	.loc 1 218 24 view .LVU18
+	movq	%rax, -336(%rbp)	# yp_MethodError, MEM[(struct ypObject *[1] *)_444][0]
+	.loc 1 218 68 is_stmt 1 view .LVU19
+.LVL8:
+	.loc 1 218 194 view .LVU20
+.LBB4:
+	.loc 1 218 199 view .LVU21
+# Lib/munit_test/test_protocols/test_collection.c:218:         assert_raises_exc(yp_reserveC(self, 32, &exc), yp_MethodError);
+	.loc 1 218 209 is_stmt 0 view .LVU22
+	movq	yp_None(%rip), %rax	# yp_None, yp_None
+	movq	%rax, -320(%rbp)	# yp_None, MEM[(struct ypObject * *)_445]
+	.loc 1 218 224 is_stmt 1 view .LVU23
+	.loc 1 218 374 view .LVU24
+# Lib/munit_test/test_protocols/test_collection.c:218:         assert_raises_exc(yp_reserveC(self, 32, &exc), yp_MethodError);
+	.loc 1 218 375 is_stmt 0 view .LVU25
+	leaq	-320(%rbp), %rdx	#, tmp263
+	movl	$32, %esi	#,
+	movq	%r12, %rdi	# self,
+	call	yp_reserveC@PLT	#
+.LVL9:
+	.loc 1 218 405 is_stmt 1 view .LVU26
+# Lib/munit_test/test_protocols/test_collection.c:218:         assert_raises_exc(yp_reserveC(self, 32, &exc), yp_MethodError);
+	.loc 1 218 410 is_stmt 0 view .LVU27
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445],
+	call	yp_isexceptionC@PLT	#
+.LVL10:
+# Lib/munit_test/test_protocols/test_collection.c:218:         assert_raises_exc(yp_reserveC(self, 32, &exc), yp_MethodError);
+	.loc 1 218 408 view .LVU28
+	testl	%eax, %eax	# tmp608
+	je	.L117	#,
+	.loc 1 218 630 is_stmt 1 discriminator 4 view .LVU29
+# Lib/munit_test/test_protocols/test_collection.c:218:         assert_raises_exc(yp_reserveC(self, 32, &exc), yp_MethodError);
+	.loc 1 218 635 is_stmt 0 discriminator 4 view .LVU30
+	leaq	-336(%rbp), %rdx	#, tmp268
+	movl	$1, %esi	#,
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445],
+	call	yp_isexception_arrayC@PLT	#
+.LVL11:
+# Lib/munit_test/test_protocols/test_collection.c:218:         assert_raises_exc(yp_reserveC(self, 32, &exc), yp_MethodError);
+	.loc 1 218 633 discriminator 4 view .LVU31
+	testl	%eax, %eax	# tmp609
+	je	.L118	#,
+.LBE4:
+	.loc 1 218 197 is_stmt 1 view .LVU32
+.LBE3:
+	.loc 1 218 12 view .LVU33
+	.loc 1 219 9 view .LVU34
+.LBB6:
+	.loc 1 219 14 view .LVU35
+.LVL12:
+	.loc 1 219 48 view .LVU36
+	.loc 1 219 85 view .LVU37
+.LBB7:
+	.loc 1 219 90 view .LVU38
+	.loc 1 219 119 view .LVU39
+.LBB8:
+	.loc 1 219 124 view .LVU40
+# Lib/munit_test/test_protocols/test_collection.c:219:         assert_len(self, 2);
+	.loc 1 219 134 is_stmt 0 view .LVU41
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 219 10 is_stmt 1 view .LVU42
+# Lib/munit_test/test_protocols/test_collection.c:219:         assert_len(self, 2);
+	.loc 1 219 29 is_stmt 0 view .LVU43
+	leaq	-320(%rbp), %rsi	#, tmp273
+	movq	%r12, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL13:
+	.loc 1 219 59 is_stmt 1 view .LVU44
+# Lib/munit_test/test_protocols/test_collection.c:219:         assert_len(self, 2);
+	.loc 1 219 67 is_stmt 0 view .LVU45
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.4_12
+# Lib/munit_test/test_protocols/test_collection.c:219:         assert_len(self, 2);
+	.loc 1 219 62 view .LVU46
+	testq	%rdi, %rdi	# exc.4_12
+	je	.L5	#,
+	.loc 1 219 12 is_stmt 1 discriminator 1 view .LVU47
+# Lib/munit_test/test_protocols/test_collection.c:219:         assert_len(self, 2);
+	.loc 1 219 16 is_stmt 0 discriminator 1 view .LVU48
+	call	yp_isexceptionC@PLT	#
+.LVL14:
+# Lib/munit_test/test_protocols/test_collection.c:219:         assert_len(self, 2);
+	.loc 1 219 15 discriminator 1 view .LVU49
+	testl	%eax, %eax	# tmp611
+	je	.L6	#,
+	.loc 1 219 40 is_stmt 1 discriminator 3 view .LVU50
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp274
+	leaq	.LC7(%rip), %rdx	#, tmp275
+	movl	$219, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp276
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL15:
+.L117:
+	.loc 1 219 40 is_stmt 0 discriminator 3 view .LVU51
+.LBE8:
+.LBE7:
+.LBE6:
+.LBB12:
+.LBB5:
+	.loc 1 218 434 is_stmt 1 discriminator 3 view .LVU52
+	leaq	.LC0(%rip), %r8	#,
+	leaq	.LC1(%rip), %rcx	#, tmp265
+	leaq	.LC2(%rip), %rdx	#, tmp266
+	movl	$218, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp267
+	call	munit_errorf_ex@PLT	#
+.LVL16:
+.L118:
+	.loc 1 218 704 discriminator 5 view .LVU53
+	leaq	.LC0(%rip), %r8	#,
+	leaq	.LC1(%rip), %rcx	#, tmp270
+	leaq	.LC4(%rip), %rdx	#, tmp271
+	movl	$218, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp272
+	call	munit_errorf_ex@PLT	#
+.LVL17:
+.L6:
+	.loc 1 218 704 is_stmt 0 discriminator 5 view .LVU54
+.LBE5:
+.LBE12:
+.LBB13:
+.LBB10:
+.LBB9:
+	.loc 1 219 211 is_stmt 1 discriminator 4 view .LVU55
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp277
+	leaq	.LC8(%rip), %rdx	#, tmp278
+	movl	$219, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp279
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL18:
+.L5:
+	.loc 1 219 211 is_stmt 0 discriminator 4 view .LVU56
+.LBE9:
+	.loc 1 219 122 is_stmt 1 discriminator 2 view .LVU57
+	.loc 1 219 379 discriminator 2 view .LVU58
+# Lib/munit_test/test_protocols/test_collection.c:219:         assert_len(self, 2);
+	.loc 1 219 382 is_stmt 0 discriminator 2 view .LVU59
+	cmpq	$2, %rax	#, _ypmt_LEN_actual
+	jne	.L119	#,
+.LBE10:
+	.loc 1 219 88 is_stmt 1 discriminator 6 view .LVU60
+.LBE13:
+	.loc 1 219 12 discriminator 6 view .LVU61
+	.loc 1 220 9 discriminator 6 view .LVU62
+	movq	%r12, %rdi	# self,
+	call	yp_decref@PLT	#
+.LVL19:
+	.loc 1 221 9 discriminator 6 view .LVU63
+.L8:
+	.loc 1 221 9 is_stmt 0 discriminator 6 view .LVU64
+.LBE2:
+	.loc 1 310 5 is_stmt 1 view .LVU65
+	leaq	-304(%rbp), %rsi	#, tmp603
+	movl	$32, %edi	#,
+	call	obj_array_decref2@PLT	#
+.LVL20:
+	.loc 1 311 5 view .LVU66
+	movq	%rbx, %rdi	# uq,
+	call	uniqueness_dealloc@PLT	#
+.LVL21:
+	.loc 1 312 5 view .LVU67
+# Lib/munit_test/test_protocols/test_collection.c:313: }
+	.loc 1 313 1 is_stmt 0 view .LVU68
+	movl	$0, %eax	#,
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+.LVL22:
+	.loc 1 313 1 view .LVU69
+	popq	%r12	#
+	popq	%r13	#
+	popq	%r14	#
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL23:
+.L119:
+	.cfi_restore_state
+.LBB15:
+.LBB14:
+.LBB11:
+	.loc 1 219 425 is_stmt 1 discriminator 5 view .LVU70
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	movq	%rax, %r9	# _ypmt_LEN_actual,
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp280
+	leaq	.LC9(%rip), %rdx	#, tmp281
+	movl	$219, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp282
+	movl	$0, %eax	#,
+.LVL24:
+	.loc 1 219 425 is_stmt 0 discriminator 5 view .LVU71
+	call	munit_errorf_ex@PLT	#
+.LVL25:
+.L2:
+	.loc 1 219 425 discriminator 5 view .LVU72
+.LBE11:
+.LBE14:
+.LBE15:
+.LBB16:
+	.loc 1 226 9 is_stmt 1 view .LVU73
+# Lib/munit_test/test_protocols/test_collection.c:226:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 226 26 is_stmt 0 view .LVU74
+	movq	-296(%rbp), %rdx	# items[1],
+	movq	-304(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r12)	# type_151->newN
+.LVL26:
+	movq	%rax, %r14	# tmp612, self
+.LVL27:
+	.loc 1 227 9 is_stmt 1 view .LVU75
+.LBB17:
+	.loc 1 227 14 view .LVU76
+# Lib/munit_test/test_protocols/test_collection.c:227:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 227 24 is_stmt 0 view .LVU77
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 227 10 is_stmt 1 view .LVU78
+# Lib/munit_test/test_protocols/test_collection.c:227:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 227 11 is_stmt 0 view .LVU79
+	leaq	-320(%rbp), %rdx	#, tmp285
+	movl	$32, %esi	#,
+	movq	%rax, %rdi	# self,
+	call	yp_reserveC@PLT	#
+.LVL28:
+	.loc 1 227 41 is_stmt 1 view .LVU80
+# Lib/munit_test/test_protocols/test_collection.c:227:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 227 49 is_stmt 0 view .LVU81
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.6_17
+# Lib/munit_test/test_protocols/test_collection.c:227:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 227 44 view .LVU82
+	testq	%rdi, %rdi	# exc.6_17
+	je	.L9	#,
+	.loc 1 227 12 is_stmt 1 discriminator 1 view .LVU83
+# Lib/munit_test/test_protocols/test_collection.c:227:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 227 16 is_stmt 0 discriminator 1 view .LVU84
+	call	yp_isexceptionC@PLT	#
+.LVL29:
+# Lib/munit_test/test_protocols/test_collection.c:227:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 227 15 discriminator 1 view .LVU85
+	testl	%eax, %eax	# tmp613
+	je	.L10	#,
+	.loc 1 227 40 is_stmt 1 discriminator 2 view .LVU86
+	leaq	.LC1(%rip), %rcx	#, tmp286
+	leaq	.LC10(%rip), %rdx	#, tmp287
+	movl	$227, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp288
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL30:
+.L10:
+	.loc 1 227 199 discriminator 3 view .LVU87
+	leaq	.LC1(%rip), %rcx	#, tmp289
+	leaq	.LC11(%rip), %rdx	#, tmp290
+	movl	$227, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp291
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL31:
+.L9:
+.LBE17:
+	.loc 1 227 12 view .LVU88
+	.loc 1 228 9 view .LVU89
+.LBB18:
+	.loc 1 228 14 view .LVU90
+	.loc 1 228 48 view .LVU91
+	.loc 1 228 85 view .LVU92
+.LBB19:
+	.loc 1 228 90 view .LVU93
+	.loc 1 228 119 view .LVU94
+.LBB20:
+	.loc 1 228 124 view .LVU95
+# Lib/munit_test/test_protocols/test_collection.c:228:         assert_len(self, 2);
+	.loc 1 228 134 is_stmt 0 view .LVU96
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 228 10 is_stmt 1 view .LVU97
+# Lib/munit_test/test_protocols/test_collection.c:228:         assert_len(self, 2);
+	.loc 1 228 29 is_stmt 0 view .LVU98
+	leaq	-320(%rbp), %rsi	#, tmp292
+	movq	%r14, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL32:
+	.loc 1 228 59 is_stmt 1 view .LVU99
+# Lib/munit_test/test_protocols/test_collection.c:228:         assert_len(self, 2);
+	.loc 1 228 67 is_stmt 0 view .LVU100
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.8_19
+# Lib/munit_test/test_protocols/test_collection.c:228:         assert_len(self, 2);
+	.loc 1 228 62 view .LVU101
+	testq	%rdi, %rdi	# exc.8_19
+	je	.L11	#,
+	.loc 1 228 12 is_stmt 1 discriminator 1 view .LVU102
+# Lib/munit_test/test_protocols/test_collection.c:228:         assert_len(self, 2);
+	.loc 1 228 16 is_stmt 0 discriminator 1 view .LVU103
+	call	yp_isexceptionC@PLT	#
+.LVL33:
+# Lib/munit_test/test_protocols/test_collection.c:228:         assert_len(self, 2);
+	.loc 1 228 15 discriminator 1 view .LVU104
+	testl	%eax, %eax	# tmp615
+	je	.L12	#,
+	.loc 1 228 40 is_stmt 1 discriminator 3 view .LVU105
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp293
+	leaq	.LC7(%rip), %rdx	#, tmp294
+	movl	$228, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp295
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL34:
+.L12:
+	.loc 1 228 211 discriminator 4 view .LVU106
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp296
+	leaq	.LC8(%rip), %rdx	#, tmp297
+	movl	$228, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp298
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL35:
+.L11:
+	.loc 1 228 211 is_stmt 0 discriminator 4 view .LVU107
+.LBE20:
+	.loc 1 228 122 is_stmt 1 discriminator 2 view .LVU108
+	.loc 1 228 379 discriminator 2 view .LVU109
+# Lib/munit_test/test_protocols/test_collection.c:228:         assert_len(self, 2);
+	.loc 1 228 382 is_stmt 0 discriminator 2 view .LVU110
+	cmpq	$2, %rax	#, _ypmt_LEN_actual
+	jne	.L120	#,
+.LBE19:
+	.loc 1 228 88 is_stmt 1 discriminator 6 view .LVU111
+.LBE18:
+	.loc 1 228 12 discriminator 6 view .LVU112
+	.loc 1 229 9 discriminator 6 view .LVU113
+.LBB22:
+	.loc 1 229 14 discriminator 6 view .LVU114
+# Lib/munit_test/test_protocols/test_collection.c:229:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 229 39 is_stmt 0 discriminator 6 view .LVU115
+	movq	-304(%rbp), %rsi	# items[0],
+	movq	%r14, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL36:
+	.loc 1 229 69 is_stmt 1 discriminator 6 view .LVU116
+# Lib/munit_test/test_protocols/test_collection.c:229:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 229 79 is_stmt 0 discriminator 6 view .LVU117
+	movq	yp_True(%rip), %r13	# yp_True, _ypmt_OBJ_b
+.LVL37:
+	.loc 1 229 104 is_stmt 1 discriminator 6 view .LVU118
+.LBB23:
+	.loc 1 229 109 discriminator 6 view .LVU119
+# Lib/munit_test/test_protocols/test_collection.c:229:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 229 180 is_stmt 0 discriminator 6 view .LVU120
+	cmpq	%rax, %r13	# tmp616, _ypmt_OBJ_b
+	je	.L108	#,
+# Lib/munit_test/test_protocols/test_collection.c:229:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 229 180 discriminator 2 view .LVU121
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.10_134
+.L14:
+.LVL38:
+	.loc 1 229 193 is_stmt 1 discriminator 4 view .LVU122
+	.loc 1 229 198 discriminator 4 view .LVU123
+# Lib/munit_test/test_protocols/test_collection.c:229:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 229 201 is_stmt 0 discriminator 4 view .LVU124
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.10_134
+	je	.L15	#,
+	.loc 1 229 240 is_stmt 1 discriminator 6 view .LVU125
+# Lib/munit_test/test_protocols/test_collection.c:229:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 229 243 is_stmt 0 discriminator 6 view .LVU126
+	cmpq	%rdi, yp_False(%rip)	# iftmp.10_134, yp_False
+	je	.L121	#,
+	.loc 1 229 473 is_stmt 1 discriminator 8 view .LVU127
+	.loc 1 229 478 discriminator 8 view .LVU128
+	.loc 1 229 483 discriminator 8 view .LVU129
+# Lib/munit_test/test_protocols/test_collection.c:229:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 229 487 is_stmt 0 discriminator 8 view .LVU130
+	call	yp_isexceptionC@PLT	#
+.LVL39:
+# Lib/munit_test/test_protocols/test_collection.c:229:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 229 486 discriminator 8 view .LVU131
+	testl	%eax, %eax	# tmp617
+	je	.L17	#,
+	.loc 1 229 524 is_stmt 1 discriminator 9 view .LVU132
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp306
+	leaq	.LC15(%rip), %rdx	#, tmp307
+	movl	$229, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp308
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL40:
+.L120:
+	.loc 1 229 524 is_stmt 0 discriminator 9 view .LVU133
+.LBE23:
+.LBE22:
+.LBB25:
+.LBB21:
+	.loc 1 228 425 is_stmt 1 discriminator 5 view .LVU134
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	movq	%rax, %r9	# _ypmt_LEN_actual,
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp299
+	leaq	.LC9(%rip), %rdx	#, tmp300
+	movl	$228, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp301
+	movl	$0, %eax	#,
+.LVL41:
+	.loc 1 228 425 is_stmt 0 discriminator 5 view .LVU135
+	call	munit_errorf_ex@PLT	#
+.LVL42:
+.L108:
+	.loc 1 228 425 discriminator 5 view .LVU136
+.LBE21:
+.LBE25:
+.LBB26:
+.LBB24:
+# Lib/munit_test/test_protocols/test_collection.c:229:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 229 180 view .LVU137
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.10_134
+	jmp	.L14	#
+.LVL43:
+.L121:
+	.loc 1 229 276 is_stmt 1 discriminator 7 view .LVU138
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp303
+	leaq	.LC14(%rip), %rdx	#, tmp304
+	movl	$229, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp305
+.LVL44:
+	.loc 1 229 276 is_stmt 0 discriminator 7 view .LVU139
+	movl	$0, %eax	#,
+.LVL45:
+	.loc 1 229 276 discriminator 7 view .LVU140
+	call	munit_errorf_ex@PLT	#
+.LVL46:
+.L17:
+	.loc 1 229 481 is_stmt 1 discriminator 10 view .LVU141
+	.loc 1 229 731 discriminator 10 view .LVU142
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp309
+	leaq	.LC16(%rip), %rdx	#, tmp310
+	movl	$229, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp311
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL47:
+.L15:
+	.loc 1 229 233 view .LVU143
+	.loc 1 229 476 view .LVU144
+	.loc 1 229 196 view .LVU145
+.LBE24:
+	.loc 1 229 107 view .LVU146
+.LBE26:
+	.loc 1 229 12 view .LVU147
+	.loc 1 230 9 view .LVU148
+.LBB27:
+	.loc 1 230 14 view .LVU149
+# Lib/munit_test/test_protocols/test_collection.c:230:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 230 39 is_stmt 0 view .LVU150
+	movq	-296(%rbp), %rsi	# items[1],
+	movq	%r14, %rdi	# self,
+.LVL48:
+	.loc 1 230 39 view .LVU151
+	call	yp_contains@PLT	#
+.LVL49:
+	.loc 1 230 69 is_stmt 1 view .LVU152
+	.loc 1 230 104 view .LVU153
+.LBB28:
+	.loc 1 230 109 view .LVU154
+# Lib/munit_test/test_protocols/test_collection.c:230:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 230 180 is_stmt 0 view .LVU155
+	cmpq	%rax, %r13	# tmp618, _ypmt_OBJ_b
+	je	.L109	#,
+# Lib/munit_test/test_protocols/test_collection.c:230:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 230 180 discriminator 2 view .LVU156
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.13_135
+.L18:
+.LVL50:
+	.loc 1 230 193 is_stmt 1 discriminator 4 view .LVU157
+	.loc 1 230 198 discriminator 4 view .LVU158
+# Lib/munit_test/test_protocols/test_collection.c:230:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 230 201 is_stmt 0 discriminator 4 view .LVU159
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.13_135
+	je	.L19	#,
+	.loc 1 230 240 is_stmt 1 discriminator 6 view .LVU160
+# Lib/munit_test/test_protocols/test_collection.c:230:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 230 243 is_stmt 0 discriminator 6 view .LVU161
+	cmpq	%rdi, yp_False(%rip)	# iftmp.13_135, yp_False
+	je	.L122	#,
+	.loc 1 230 473 is_stmt 1 discriminator 8 view .LVU162
+	.loc 1 230 478 discriminator 8 view .LVU163
+	.loc 1 230 483 discriminator 8 view .LVU164
+# Lib/munit_test/test_protocols/test_collection.c:230:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 230 487 is_stmt 0 discriminator 8 view .LVU165
+	call	yp_isexceptionC@PLT	#
+.LVL51:
+# Lib/munit_test/test_protocols/test_collection.c:230:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 230 486 discriminator 8 view .LVU166
+	testl	%eax, %eax	# tmp619
+	je	.L21	#,
+	.loc 1 230 524 is_stmt 1 discriminator 9 view .LVU167
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp316
+	leaq	.LC15(%rip), %rdx	#, tmp317
+	movl	$230, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp318
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL52:
+.L109:
+# Lib/munit_test/test_protocols/test_collection.c:230:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 230 180 is_stmt 0 view .LVU168
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.13_135
+	jmp	.L18	#
+.LVL53:
+.L122:
+	.loc 1 230 276 is_stmt 1 discriminator 7 view .LVU169
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp313
+	leaq	.LC14(%rip), %rdx	#, tmp314
+	movl	$230, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp315
+.LVL54:
+	.loc 1 230 276 is_stmt 0 discriminator 7 view .LVU170
+	movl	$0, %eax	#,
+.LVL55:
+	.loc 1 230 276 discriminator 7 view .LVU171
+	call	munit_errorf_ex@PLT	#
+.LVL56:
+.L21:
+	.loc 1 230 481 is_stmt 1 discriminator 10 view .LVU172
+	.loc 1 230 731 discriminator 10 view .LVU173
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp319
+	leaq	.LC16(%rip), %rdx	#, tmp320
+	movl	$230, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp321
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL57:
+.L19:
+	.loc 1 230 233 view .LVU174
+	.loc 1 230 476 view .LVU175
+	.loc 1 230 196 view .LVU176
+.LBE28:
+	.loc 1 230 107 view .LVU177
+.LBE27:
+	.loc 1 230 12 view .LVU178
+	.loc 1 232 9 view .LVU179
+	movl	$0, %edi	#,
+.LVL58:
+	.loc 1 232 9 is_stmt 0 view .LVU180
+	call	malloc_tracker_oom_after@PLT	#
+.LVL59:
+	.loc 1 233 9 is_stmt 1 view .LVU181
+# Lib/munit_test/test_protocols/test_collection.c:233:         for (i = 2; i < 32; i++) {
+	.loc 1 233 16 is_stmt 0 view .LVU182
+	movl	$2, %r15d	#, i
+# Lib/munit_test/test_protocols/test_collection.c:233:         for (i = 2; i < 32; i++) {
+	.loc 1 233 9 view .LVU183
+	jmp	.L22	#
+.LVL60:
+.L125:
+	.loc 1 235 17 is_stmt 1 view .LVU184
+.LBB29:
+	.loc 1 235 22 view .LVU185
+# Lib/munit_test/test_protocols/test_collection.c:235:                 assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 235 32 is_stmt 0 view .LVU186
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 235 18 is_stmt 1 view .LVU187
+# Lib/munit_test/test_protocols/test_collection.c:235:                 assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 235 19 is_stmt 0 view .LVU188
+	leaq	-320(%rbp), %rcx	#, tmp322
+	movslq	%r15d, %rax	# i, i
+	movq	-304(%rbp,%rax,8), %rsi	# items[i_132], items[i_132]
+	movq	yp_None(%rip), %rdx	# yp_None,
+	movq	%r14, %rdi	# self,
+	call	yp_setitem@PLT	#
+.LVL61:
+	.loc 1 235 63 is_stmt 1 view .LVU189
+# Lib/munit_test/test_protocols/test_collection.c:235:                 assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 235 71 is_stmt 0 view .LVU190
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.17_30
+# Lib/munit_test/test_protocols/test_collection.c:235:                 assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 235 66 view .LVU191
+	testq	%rdi, %rdi	# exc.17_30
+	je	.L26	#,
+	.loc 1 235 20 is_stmt 1 discriminator 1 view .LVU192
+# Lib/munit_test/test_protocols/test_collection.c:235:                 assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 235 24 is_stmt 0 discriminator 1 view .LVU193
+	call	yp_isexceptionC@PLT	#
+.LVL62:
+# Lib/munit_test/test_protocols/test_collection.c:235:                 assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 235 23 discriminator 1 view .LVU194
+	testl	%eax, %eax	# tmp620
+	je	.L25	#,
+	.loc 1 235 48 is_stmt 1 discriminator 2 view .LVU195
+	leaq	.LC18(%rip), %rcx	#, tmp326
+	leaq	.LC10(%rip), %rdx	#, tmp327
+	movl	$235, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp328
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL63:
+.L25:
+	.loc 1 235 221 discriminator 3 view .LVU196
+	leaq	.LC18(%rip), %rcx	#, tmp329
+	leaq	.LC11(%rip), %rdx	#, tmp330
+	movl	$235, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp331
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL64:
+.L29:
+	.loc 1 235 221 is_stmt 0 discriminator 3 view .LVU197
+.LBE29:
+.LBB30:
+	.loc 1 238 213 is_stmt 1 discriminator 3 view .LVU198
+	leaq	.LC19(%rip), %rcx	#, tmp343
+	leaq	.LC11(%rip), %rdx	#, tmp344
+	movl	$238, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp345
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL65:
+.L27:
+	.loc 1 238 213 is_stmt 0 discriminator 3 view .LVU199
+.LBE30:
+	.loc 1 240 17 is_stmt 1 view .LVU200
+.LBB31:
+	.loc 1 240 22 view .LVU201
+# Lib/munit_test/test_protocols/test_collection.c:240:                 assert_not_raises_exc(yp_push(self, items[i], &exc));
+	.loc 1 240 32 is_stmt 0 view .LVU202
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 240 18 is_stmt 1 view .LVU203
+# Lib/munit_test/test_protocols/test_collection.c:240:                 assert_not_raises_exc(yp_push(self, items[i], &exc));
+	.loc 1 240 19 is_stmt 0 view .LVU204
+	leaq	-320(%rbp), %rdx	#, tmp346
+	movslq	%r15d, %rax	# i, i
+	movq	-304(%rbp,%rax,8), %rsi	# items[i_132], items[i_132]
+	movq	%r14, %rdi	# self,
+	call	yp_push@PLT	#
+.LVL66:
+	.loc 1 240 51 is_stmt 1 view .LVU205
+# Lib/munit_test/test_protocols/test_collection.c:240:                 assert_not_raises_exc(yp_push(self, items[i], &exc));
+	.loc 1 240 59 is_stmt 0 view .LVU206
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.21_38
+# Lib/munit_test/test_protocols/test_collection.c:240:                 assert_not_raises_exc(yp_push(self, items[i], &exc));
+	.loc 1 240 54 view .LVU207
+	testq	%rdi, %rdi	# exc.21_38
+	jne	.L123	#,
+.L26:
+	.loc 1 240 54 view .LVU208
+.LBE31:
+	.loc 1 240 20 is_stmt 1 discriminator 2 view .LVU209
+	.loc 1 233 30 discriminator 2 view .LVU210
+	movl	$1, %esi	#,
+	movl	%r15d, %edi	# i,
+	call	__addvsi3@PLT	#
+.LVL67:
+	movl	%eax, %r15d	# tmp623, i
+.LVL68:
+.L22:
+	.loc 1 233 23 discriminator 1 view .LVU211
+	cmpl	$31, %r15d	#, i
+	jg	.L124	#,
+	.loc 1 234 13 view .LVU212
+# Lib/munit_test/test_protocols/test_collection.c:234:             if (type->is_mapping) {
+	.loc 1 234 16 is_stmt 0 view .LVU213
+	cmpl	$0, 124(%r12)	#, type_151->is_mapping
+	jne	.L125	#,
+	.loc 1 236 20 is_stmt 1 view .LVU214
+# Lib/munit_test/test_protocols/test_collection.c:236:             } else if (type->is_string) {
+	.loc 1 236 23 is_stmt 0 view .LVU215
+	cmpl	$0, 116(%r12)	#, type_151->is_string
+	je	.L27	#,
+	.loc 1 238 17 is_stmt 1 view .LVU216
+.LBB32:
+	.loc 1 238 22 view .LVU217
+# Lib/munit_test/test_protocols/test_collection.c:238:                 assert_not_raises_exc(yp_push(self, items[i % 2], &exc));
+	.loc 1 238 32 is_stmt 0 view .LVU218
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 238 18 is_stmt 1 view .LVU219
+# Lib/munit_test/test_protocols/test_collection.c:238:                 assert_not_raises_exc(yp_push(self, items[i % 2], &exc));
+	.loc 1 238 41 is_stmt 0 view .LVU220
+	movl	%r15d, %edx	# i, tmp333
+	shrl	$31, %edx	#, tmp333
+	leal	(%r15,%rdx), %eax	#, tmp334
+	andl	$1, %eax	#, tmp335
+	subl	%edx, %eax	# tmp333, tmp336
+# Lib/munit_test/test_protocols/test_collection.c:238:                 assert_not_raises_exc(yp_push(self, items[i % 2], &exc));
+	.loc 1 238 19 view .LVU221
+	leaq	-320(%rbp), %rdx	#, tmp337
+	cltq
+	movq	-304(%rbp,%rax,8), %rsi	# items[_33], items[_33]
+	movq	%r14, %rdi	# self,
+	call	yp_push@PLT	#
+.LVL69:
+	.loc 1 238 55 is_stmt 1 view .LVU222
+# Lib/munit_test/test_protocols/test_collection.c:238:                 assert_not_raises_exc(yp_push(self, items[i % 2], &exc));
+	.loc 1 238 63 is_stmt 0 view .LVU223
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.19_35
+# Lib/munit_test/test_protocols/test_collection.c:238:                 assert_not_raises_exc(yp_push(self, items[i % 2], &exc));
+	.loc 1 238 58 view .LVU224
+	testq	%rdi, %rdi	# exc.19_35
+	je	.L26	#,
+	.loc 1 238 20 is_stmt 1 discriminator 1 view .LVU225
+# Lib/munit_test/test_protocols/test_collection.c:238:                 assert_not_raises_exc(yp_push(self, items[i % 2], &exc));
+	.loc 1 238 24 is_stmt 0 discriminator 1 view .LVU226
+	call	yp_isexceptionC@PLT	#
+.LVL70:
+# Lib/munit_test/test_protocols/test_collection.c:238:                 assert_not_raises_exc(yp_push(self, items[i % 2], &exc));
+	.loc 1 238 23 discriminator 1 view .LVU227
+	testl	%eax, %eax	# tmp621
+	je	.L29	#,
+	.loc 1 238 48 is_stmt 1 discriminator 2 view .LVU228
+	leaq	.LC19(%rip), %rcx	#, tmp340
+	leaq	.LC10(%rip), %rdx	#, tmp341
+	movl	$238, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp342
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL71:
+.L123:
+	.loc 1 238 48 is_stmt 0 discriminator 2 view .LVU229
+.LBE32:
+.LBB33:
+	.loc 1 240 20 is_stmt 1 discriminator 1 view .LVU230
+# Lib/munit_test/test_protocols/test_collection.c:240:                 assert_not_raises_exc(yp_push(self, items[i], &exc));
+	.loc 1 240 24 is_stmt 0 discriminator 1 view .LVU231
+	call	yp_isexceptionC@PLT	#
+.LVL72:
+# Lib/munit_test/test_protocols/test_collection.c:240:                 assert_not_raises_exc(yp_push(self, items[i], &exc));
+	.loc 1 240 23 discriminator 1 view .LVU232
+	testl	%eax, %eax	# tmp622
+	je	.L31	#,
+	.loc 1 240 48 is_stmt 1 discriminator 2 view .LVU233
+	leaq	.LC20(%rip), %rcx	#, tmp349
+	leaq	.LC10(%rip), %rdx	#, tmp350
+	movl	$240, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp351
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL73:
+.L31:
+	.loc 1 240 209 discriminator 3 view .LVU234
+	leaq	.LC20(%rip), %rcx	#, tmp352
+	leaq	.LC11(%rip), %rdx	#, tmp353
+	movl	$240, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp354
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL74:
+.L124:
+	.loc 1 240 209 is_stmt 0 discriminator 3 view .LVU235
+.LBE33:
+	.loc 1 243 9 is_stmt 1 view .LVU236
+	call	malloc_tracker_oom_disable@PLT	#
+.LVL75:
+	.loc 1 244 9 view .LVU237
+.LBB34:
+	.loc 1 244 14 view .LVU238
+	.loc 1 244 48 view .LVU239
+	.loc 1 244 86 view .LVU240
+.LBB35:
+	.loc 1 244 91 view .LVU241
+	.loc 1 244 120 view .LVU242
+.LBB36:
+	.loc 1 244 125 view .LVU243
+# Lib/munit_test/test_protocols/test_collection.c:244:         assert_len(self, 32);
+	.loc 1 244 135 is_stmt 0 view .LVU244
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 244 10 is_stmt 1 view .LVU245
+# Lib/munit_test/test_protocols/test_collection.c:244:         assert_len(self, 32);
+	.loc 1 244 29 is_stmt 0 view .LVU246
+	leaq	-320(%rbp), %rsi	#, tmp356
+	movq	%r14, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL76:
+	movq	%rax, %r9	# tmp624, _ypmt_LEN_actual
+.LVL77:
+	.loc 1 244 59 is_stmt 1 view .LVU247
+# Lib/munit_test/test_protocols/test_collection.c:244:         assert_len(self, 32);
+	.loc 1 244 67 is_stmt 0 view .LVU248
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.23_40
+# Lib/munit_test/test_protocols/test_collection.c:244:         assert_len(self, 32);
+	.loc 1 244 62 view .LVU249
+	testq	%rdi, %rdi	# exc.23_40
+	je	.L33	#,
+	.loc 1 244 12 is_stmt 1 discriminator 1 view .LVU250
+# Lib/munit_test/test_protocols/test_collection.c:244:         assert_len(self, 32);
+	.loc 1 244 16 is_stmt 0 discriminator 1 view .LVU251
+	call	yp_isexceptionC@PLT	#
+.LVL78:
+# Lib/munit_test/test_protocols/test_collection.c:244:         assert_len(self, 32);
+	.loc 1 244 15 discriminator 1 view .LVU252
+	testl	%eax, %eax	# tmp625
+	je	.L34	#,
+	.loc 1 244 40 is_stmt 1 discriminator 3 view .LVU253
+	leaq	.LC21(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp357
+	leaq	.LC7(%rip), %rdx	#, tmp358
+	movl	$244, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp359
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL79:
+.L34:
+	.loc 1 244 212 discriminator 4 view .LVU254
+	leaq	.LC21(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp360
+	leaq	.LC8(%rip), %rdx	#, tmp361
+	movl	$244, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp362
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL80:
+.L33:
+	.loc 1 244 212 is_stmt 0 discriminator 4 view .LVU255
+.LBE36:
+	.loc 1 244 123 is_stmt 1 discriminator 2 view .LVU256
+	.loc 1 244 381 discriminator 2 view .LVU257
+# Lib/munit_test/test_protocols/test_collection.c:244:         assert_len(self, 32);
+	.loc 1 244 384 is_stmt 0 discriminator 2 view .LVU258
+	cmpq	$32, %rax	#, _ypmt_LEN_actual
+	jne	.L126	#,
+.LBE35:
+	.loc 1 244 89 is_stmt 1 discriminator 6 view .LVU259
+.LBE34:
+	.loc 1 244 12 discriminator 6 view .LVU260
+	.loc 1 245 9 discriminator 6 view .LVU261
+.LBB38:
+	.loc 1 245 14 discriminator 6 view .LVU262
+# Lib/munit_test/test_protocols/test_collection.c:245:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 245 39 is_stmt 0 discriminator 6 view .LVU263
+	movq	-304(%rbp), %rsi	# items[0],
+	movq	%r14, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL81:
+	.loc 1 245 69 is_stmt 1 discriminator 6 view .LVU264
+	.loc 1 245 104 discriminator 6 view .LVU265
+.LBB39:
+	.loc 1 245 109 discriminator 6 view .LVU266
+# Lib/munit_test/test_protocols/test_collection.c:245:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 245 180 is_stmt 0 discriminator 6 view .LVU267
+	cmpq	%rax, %r13	# tmp626, _ypmt_OBJ_b
+	je	.L110	#,
+# Lib/munit_test/test_protocols/test_collection.c:245:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 245 180 discriminator 2 view .LVU268
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.25_136
+.L36:
+.LVL82:
+	.loc 1 245 193 is_stmt 1 discriminator 4 view .LVU269
+	.loc 1 245 198 discriminator 4 view .LVU270
+# Lib/munit_test/test_protocols/test_collection.c:245:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 245 201 is_stmt 0 discriminator 4 view .LVU271
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.25_136
+	je	.L37	#,
+	.loc 1 245 240 is_stmt 1 discriminator 6 view .LVU272
+# Lib/munit_test/test_protocols/test_collection.c:245:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 245 243 is_stmt 0 discriminator 6 view .LVU273
+	cmpq	%rdi, yp_False(%rip)	# iftmp.25_136, yp_False
+	je	.L127	#,
+	.loc 1 245 473 is_stmt 1 discriminator 8 view .LVU274
+	.loc 1 245 478 discriminator 8 view .LVU275
+	.loc 1 245 483 discriminator 8 view .LVU276
+# Lib/munit_test/test_protocols/test_collection.c:245:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 245 487 is_stmt 0 discriminator 8 view .LVU277
+	call	yp_isexceptionC@PLT	#
+.LVL83:
+# Lib/munit_test/test_protocols/test_collection.c:245:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 245 486 discriminator 8 view .LVU278
+	testl	%eax, %eax	# tmp627
+	je	.L39	#,
+	.loc 1 245 524 is_stmt 1 discriminator 9 view .LVU279
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp370
+	leaq	.LC15(%rip), %rdx	#, tmp371
+	movl	$245, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp372
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL84:
+.L126:
+	.loc 1 245 524 is_stmt 0 discriminator 9 view .LVU280
+.LBE39:
+.LBE38:
+.LBB41:
+.LBB37:
+	.loc 1 244 427 is_stmt 1 discriminator 5 view .LVU281
+	subq	$8, %rsp	#,
+	pushq	$32	#
+	leaq	.LC21(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp363
+	leaq	.LC9(%rip), %rdx	#, tmp364
+	movl	$244, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp365
+	movl	$0, %eax	#,
+.LVL85:
+	.loc 1 244 427 is_stmt 0 discriminator 5 view .LVU282
+	call	munit_errorf_ex@PLT	#
+.LVL86:
+.L110:
+	.loc 1 244 427 discriminator 5 view .LVU283
+.LBE37:
+.LBE41:
+.LBB42:
+.LBB40:
+# Lib/munit_test/test_protocols/test_collection.c:245:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 245 180 view .LVU284
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.25_136
+	jmp	.L36	#
+.LVL87:
+.L127:
+	.loc 1 245 276 is_stmt 1 discriminator 7 view .LVU285
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp367
+	leaq	.LC14(%rip), %rdx	#, tmp368
+	movl	$245, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp369
+.LVL88:
+	.loc 1 245 276 is_stmt 0 discriminator 7 view .LVU286
+	movl	$0, %eax	#,
+.LVL89:
+	.loc 1 245 276 discriminator 7 view .LVU287
+	call	munit_errorf_ex@PLT	#
+.LVL90:
+.L39:
+	.loc 1 245 481 is_stmt 1 discriminator 10 view .LVU288
+	.loc 1 245 731 discriminator 10 view .LVU289
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp373
+	leaq	.LC16(%rip), %rdx	#, tmp374
+	movl	$245, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp375
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL91:
+.L37:
+	.loc 1 245 233 view .LVU290
+	.loc 1 245 476 view .LVU291
+	.loc 1 245 196 view .LVU292
+.LBE40:
+	.loc 1 245 107 view .LVU293
+.LBE42:
+	.loc 1 245 12 view .LVU294
+	.loc 1 246 9 view .LVU295
+.LBB43:
+	.loc 1 246 14 view .LVU296
+# Lib/munit_test/test_protocols/test_collection.c:246:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 246 39 is_stmt 0 view .LVU297
+	movq	-296(%rbp), %rsi	# items[1],
+	movq	%r14, %rdi	# self,
+.LVL92:
+	.loc 1 246 39 view .LVU298
+	call	yp_contains@PLT	#
+.LVL93:
+	.loc 1 246 69 is_stmt 1 view .LVU299
+	.loc 1 246 104 view .LVU300
+.LBB44:
+	.loc 1 246 109 view .LVU301
+# Lib/munit_test/test_protocols/test_collection.c:246:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 246 180 is_stmt 0 view .LVU302
+	cmpq	%rax, %r13	# tmp628, _ypmt_OBJ_b
+	je	.L111	#,
+# Lib/munit_test/test_protocols/test_collection.c:246:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 246 180 discriminator 2 view .LVU303
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.28_137
+.L40:
+.LVL94:
+	.loc 1 246 193 is_stmt 1 discriminator 4 view .LVU304
+	.loc 1 246 198 discriminator 4 view .LVU305
+# Lib/munit_test/test_protocols/test_collection.c:246:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 246 201 is_stmt 0 discriminator 4 view .LVU306
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.28_137
+	je	.L41	#,
+	.loc 1 246 240 is_stmt 1 discriminator 6 view .LVU307
+# Lib/munit_test/test_protocols/test_collection.c:246:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 246 243 is_stmt 0 discriminator 6 view .LVU308
+	cmpq	%rdi, yp_False(%rip)	# iftmp.28_137, yp_False
+	je	.L128	#,
+	.loc 1 246 473 is_stmt 1 discriminator 8 view .LVU309
+	.loc 1 246 478 discriminator 8 view .LVU310
+	.loc 1 246 483 discriminator 8 view .LVU311
+# Lib/munit_test/test_protocols/test_collection.c:246:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 246 487 is_stmt 0 discriminator 8 view .LVU312
+	call	yp_isexceptionC@PLT	#
+.LVL95:
+# Lib/munit_test/test_protocols/test_collection.c:246:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 246 486 discriminator 8 view .LVU313
+	testl	%eax, %eax	# tmp629
+	je	.L43	#,
+	.loc 1 246 524 is_stmt 1 discriminator 9 view .LVU314
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp380
+	leaq	.LC15(%rip), %rdx	#, tmp381
+	movl	$246, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp382
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL96:
+.L111:
+# Lib/munit_test/test_protocols/test_collection.c:246:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 246 180 is_stmt 0 view .LVU315
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.28_137
+	jmp	.L40	#
+.LVL97:
+.L128:
+	.loc 1 246 276 is_stmt 1 discriminator 7 view .LVU316
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp377
+	leaq	.LC14(%rip), %rdx	#, tmp378
+	movl	$246, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp379
+.LVL98:
+	.loc 1 246 276 is_stmt 0 discriminator 7 view .LVU317
+	movl	$0, %eax	#,
+.LVL99:
+	.loc 1 246 276 discriminator 7 view .LVU318
+	call	munit_errorf_ex@PLT	#
+.LVL100:
+.L43:
+	.loc 1 246 481 is_stmt 1 discriminator 10 view .LVU319
+	.loc 1 246 731 discriminator 10 view .LVU320
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp383
+	leaq	.LC16(%rip), %rdx	#, tmp384
+	movl	$246, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp385
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL101:
+.L41:
+	.loc 1 246 233 view .LVU321
+	.loc 1 246 476 view .LVU322
+	.loc 1 246 196 view .LVU323
+.LBE44:
+	.loc 1 246 107 view .LVU324
+.LBE43:
+	.loc 1 246 12 view .LVU325
+	.loc 1 247 9 view .LVU326
+	movq	%r14, %rdi	# self,
+.LVL102:
+	.loc 1 247 9 is_stmt 0 view .LVU327
+	call	yp_decref@PLT	#
+.LVL103:
+	.loc 1 247 9 view .LVU328
+.LBE16:
+	.loc 1 252 5 is_stmt 1 view .LVU329
+# Lib/munit_test/test_protocols/test_collection.c:252:     if (type->is_mapping) {
+	.loc 1 252 8 is_stmt 0 view .LVU330
+	cmpl	$0, 124(%r12)	#, type_151->is_mapping
+	je	.L44	#,
+.LBB45:
+	.loc 1 253 9 is_stmt 1 view .LVU331
+# Lib/munit_test/test_protocols/test_collection.c:253:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 253 26 is_stmt 0 view .LVU332
+	movq	-296(%rbp), %rdx	# items[1],
+	movq	-304(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r12)	# type_151->newN
+.LVL104:
+	movq	%rax, %r14	# tmp630, self
+.LVL105:
+	.loc 1 254 9 is_stmt 1 view .LVU333
+	.loc 1 255 9 view .LVU334
+.LBB46:
+	.loc 1 255 14 view .LVU335
+# Lib/munit_test/test_protocols/test_collection.c:255:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 255 24 is_stmt 0 view .LVU336
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 255 10 is_stmt 1 view .LVU337
+# Lib/munit_test/test_protocols/test_collection.c:255:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 255 11 is_stmt 0 view .LVU338
+	leaq	-320(%rbp), %rdx	#, tmp388
+	movl	$32, %esi	#,
+	movq	%rax, %rdi	# self,
+	call	yp_reserveC@PLT	#
+.LVL106:
+	.loc 1 255 41 is_stmt 1 view .LVU339
+# Lib/munit_test/test_protocols/test_collection.c:255:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 255 49 is_stmt 0 view .LVU340
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.31_52
+# Lib/munit_test/test_protocols/test_collection.c:255:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 255 44 view .LVU341
+	testq	%rdi, %rdi	# exc.31_52
+	je	.L45	#,
+	.loc 1 255 12 is_stmt 1 discriminator 1 view .LVU342
+# Lib/munit_test/test_protocols/test_collection.c:255:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 255 16 is_stmt 0 discriminator 1 view .LVU343
+	call	yp_isexceptionC@PLT	#
+.LVL107:
+# Lib/munit_test/test_protocols/test_collection.c:255:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 255 15 discriminator 1 view .LVU344
+	testl	%eax, %eax	# tmp631
+	je	.L46	#,
+	.loc 1 255 40 is_stmt 1 discriminator 2 view .LVU345
+	leaq	.LC1(%rip), %rcx	#, tmp389
+	leaq	.LC10(%rip), %rdx	#, tmp390
+	movl	$255, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp391
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL108:
+.L46:
+	.loc 1 255 199 discriminator 3 view .LVU346
+	leaq	.LC1(%rip), %rcx	#, tmp392
+	leaq	.LC11(%rip), %rdx	#, tmp393
+	movl	$255, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp394
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL109:
+.L45:
+.LBE46:
+	.loc 1 255 12 view .LVU347
+	.loc 1 256 9 view .LVU348
+# Lib/munit_test/test_protocols/test_collection.c:256:         keys = yp_frozenset(self);
+	.loc 1 256 16 is_stmt 0 view .LVU349
+	movq	%r14, %rdi	# self,
+	call	yp_frozenset@PLT	#
+.LVL110:
+	movq	%rax, -376(%rbp)	# tmp632, %sfp
+.LVL111:
+	.loc 1 257 9 is_stmt 1 view .LVU350
+.LBB47:
+	.loc 1 257 14 view .LVU351
+# Lib/munit_test/test_protocols/test_collection.c:257:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 257 24 is_stmt 0 view .LVU352
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 257 10 is_stmt 1 view .LVU353
+# Lib/munit_test/test_protocols/test_collection.c:257:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 257 11 is_stmt 0 view .LVU354
+	leaq	-320(%rbp), %rdx	#, tmp395
+	movl	$32, %esi	#,
+	movq	%r14, %rdi	# self,
+	call	yp_reserveC@PLT	#
+.LVL112:
+	.loc 1 257 41 is_stmt 1 view .LVU355
+# Lib/munit_test/test_protocols/test_collection.c:257:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 257 49 is_stmt 0 view .LVU356
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.33_54
+# Lib/munit_test/test_protocols/test_collection.c:257:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 257 44 view .LVU357
+	testq	%rdi, %rdi	# exc.33_54
+	je	.L47	#,
+	.loc 1 257 12 is_stmt 1 discriminator 1 view .LVU358
+# Lib/munit_test/test_protocols/test_collection.c:257:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 257 16 is_stmt 0 discriminator 1 view .LVU359
+	call	yp_isexceptionC@PLT	#
+.LVL113:
+# Lib/munit_test/test_protocols/test_collection.c:257:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 257 15 discriminator 1 view .LVU360
+	testl	%eax, %eax	# tmp633
+	je	.L48	#,
+	.loc 1 257 40 is_stmt 1 discriminator 2 view .LVU361
+	leaq	.LC1(%rip), %rcx	#, tmp396
+	leaq	.LC10(%rip), %rdx	#, tmp397
+	movl	$257, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp398
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL114:
+.L48:
+	.loc 1 257 199 discriminator 3 view .LVU362
+	leaq	.LC1(%rip), %rcx	#, tmp399
+	leaq	.LC11(%rip), %rdx	#, tmp400
+	movl	$257, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp401
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL115:
+.L47:
+.LBE47:
+	.loc 1 257 12 view .LVU363
+	.loc 1 259 9 view .LVU364
+	movl	$0, %edi	#,
+	call	malloc_tracker_oom_after@PLT	#
+.LVL116:
+	.loc 1 260 9 view .LVU365
+# Lib/munit_test/test_protocols/test_collection.c:260:         for (i = 2; i < 32; i++) {
+	.loc 1 260 16 is_stmt 0 view .LVU366
+	movl	$2, %r15d	#, i
+.LVL117:
+.L49:
+	.loc 1 260 23 is_stmt 1 discriminator 1 view .LVU367
+	cmpl	$31, %r15d	#, i
+	jg	.L129	#,
+	.loc 1 261 13 view .LVU368
+.LBB48:
+	.loc 1 261 18 view .LVU369
+# Lib/munit_test/test_protocols/test_collection.c:261:             assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 261 28 is_stmt 0 view .LVU370
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 261 14 is_stmt 1 view .LVU371
+# Lib/munit_test/test_protocols/test_collection.c:261:             assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 261 15 is_stmt 0 view .LVU372
+	leaq	-320(%rbp), %rcx	#, tmp402
+	movslq	%r15d, %rax	# i, i
+	movq	-304(%rbp,%rax,8), %rsi	# items[i_133], items[i_133]
+	movq	yp_None(%rip), %rdx	# yp_None,
+	movq	%r14, %rdi	# self,
+	call	yp_setitem@PLT	#
+.LVL118:
+	.loc 1 261 59 is_stmt 1 view .LVU373
+# Lib/munit_test/test_protocols/test_collection.c:261:             assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 261 67 is_stmt 0 view .LVU374
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.36_58
+# Lib/munit_test/test_protocols/test_collection.c:261:             assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 261 62 view .LVU375
+	testq	%rdi, %rdi	# exc.36_58
+	jne	.L130	#,
+.LBE48:
+	.loc 1 261 16 is_stmt 1 discriminator 2 view .LVU376
+	.loc 1 260 30 discriminator 2 view .LVU377
+	movl	$1, %esi	#,
+	movl	%r15d, %edi	# i,
+	call	__addvsi3@PLT	#
+.LVL119:
+	movl	%eax, %r15d	# tmp635, i
+.LVL120:
+	.loc 1 260 30 is_stmt 0 discriminator 2 view .LVU378
+	jmp	.L49	#
+.LVL121:
+.L130:
+.LBB49:
+	.loc 1 261 16 is_stmt 1 discriminator 1 view .LVU379
+# Lib/munit_test/test_protocols/test_collection.c:261:             assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 261 20 is_stmt 0 discriminator 1 view .LVU380
+	call	yp_isexceptionC@PLT	#
+.LVL122:
+# Lib/munit_test/test_protocols/test_collection.c:261:             assert_not_raises_exc(yp_setitem(self, items[i], yp_None, &exc));
+	.loc 1 261 19 discriminator 1 view .LVU381
+	testl	%eax, %eax	# tmp634
+	je	.L51	#,
+	.loc 1 261 44 is_stmt 1 discriminator 2 view .LVU382
+	leaq	.LC18(%rip), %rcx	#, tmp406
+	leaq	.LC10(%rip), %rdx	#, tmp407
+	movl	$261, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp408
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL123:
+.L51:
+	.loc 1 261 217 discriminator 3 view .LVU383
+	leaq	.LC18(%rip), %rcx	#, tmp409
+	leaq	.LC11(%rip), %rdx	#, tmp410
+	movl	$261, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp411
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL124:
+.L129:
+	.loc 1 261 217 is_stmt 0 discriminator 3 view .LVU384
+.LBE49:
+	.loc 1 263 9 is_stmt 1 view .LVU385
+	call	malloc_tracker_oom_disable@PLT	#
+.LVL125:
+	.loc 1 264 9 view .LVU386
+.LBB50:
+	.loc 1 264 14 view .LVU387
+	.loc 1 264 48 view .LVU388
+	.loc 1 264 86 view .LVU389
+.LBB51:
+	.loc 1 264 91 view .LVU390
+	.loc 1 264 120 view .LVU391
+.LBB52:
+	.loc 1 264 125 view .LVU392
+# Lib/munit_test/test_protocols/test_collection.c:264:         assert_len(self, 32);
+	.loc 1 264 135 is_stmt 0 view .LVU393
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 264 10 is_stmt 1 view .LVU394
+# Lib/munit_test/test_protocols/test_collection.c:264:         assert_len(self, 32);
+	.loc 1 264 29 is_stmt 0 view .LVU395
+	leaq	-320(%rbp), %rsi	#, tmp413
+	movq	%r14, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL126:
+	movq	%rax, %r9	# tmp636, _ypmt_LEN_actual
+.LVL127:
+	.loc 1 264 59 is_stmt 1 view .LVU396
+# Lib/munit_test/test_protocols/test_collection.c:264:         assert_len(self, 32);
+	.loc 1 264 67 is_stmt 0 view .LVU397
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.38_60
+# Lib/munit_test/test_protocols/test_collection.c:264:         assert_len(self, 32);
+	.loc 1 264 62 view .LVU398
+	testq	%rdi, %rdi	# exc.38_60
+	je	.L53	#,
+	.loc 1 264 12 is_stmt 1 discriminator 1 view .LVU399
+# Lib/munit_test/test_protocols/test_collection.c:264:         assert_len(self, 32);
+	.loc 1 264 16 is_stmt 0 discriminator 1 view .LVU400
+	call	yp_isexceptionC@PLT	#
+.LVL128:
+# Lib/munit_test/test_protocols/test_collection.c:264:         assert_len(self, 32);
+	.loc 1 264 15 discriminator 1 view .LVU401
+	testl	%eax, %eax	# tmp637
+	je	.L54	#,
+	.loc 1 264 40 is_stmt 1 discriminator 3 view .LVU402
+	leaq	.LC21(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp414
+	leaq	.LC7(%rip), %rdx	#, tmp415
+	movl	$264, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp416
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL129:
+.L54:
+	.loc 1 264 212 discriminator 4 view .LVU403
+	leaq	.LC21(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp417
+	leaq	.LC8(%rip), %rdx	#, tmp418
+	movl	$264, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp419
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL130:
+.L53:
+	.loc 1 264 212 is_stmt 0 discriminator 4 view .LVU404
+.LBE52:
+	.loc 1 264 123 is_stmt 1 discriminator 2 view .LVU405
+	.loc 1 264 381 discriminator 2 view .LVU406
+# Lib/munit_test/test_protocols/test_collection.c:264:         assert_len(self, 32);
+	.loc 1 264 384 is_stmt 0 discriminator 2 view .LVU407
+	cmpq	$32, %rax	#, _ypmt_LEN_actual
+	jne	.L131	#,
+.LBE51:
+	.loc 1 264 89 is_stmt 1 discriminator 6 view .LVU408
+.LBE50:
+	.loc 1 264 12 discriminator 6 view .LVU409
+	.loc 1 265 9 discriminator 6 view .LVU410
+.LBB54:
+	.loc 1 265 14 discriminator 6 view .LVU411
+.LVL131:
+	.loc 1 265 48 discriminator 6 view .LVU412
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 84 is_stmt 0 discriminator 6 view .LVU413
+	movq	-304(%rbp), %rax	# items[0], _62
+.LVL132:
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 58 discriminator 6 view .LVU414
+	movq	%rax, -336(%rbp)	# _62, MEM[(struct ypObject *[2] *)_444][0]
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 94 discriminator 6 view .LVU415
+	movq	-296(%rbp), %rax	# items[1], _63
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 58 discriminator 6 view .LVU416
+	movq	%rax, -328(%rbp)	# _63, MEM[(struct ypObject *[2] *)_444][1]
+	.loc 1 265 100 is_stmt 1 discriminator 6 view .LVU417
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 106 is_stmt 0 discriminator 6 view .LVU418
+	leaq	.LC22(%rip), %rax	#, tmp677
+	movq	%rax, -320(%rbp)	# tmp677, MEM[(char *[2] *)_445][0]
+	leaq	.LC23(%rip), %rax	#, tmp678
+	movq	%rax, -312(%rbp)	# tmp678, MEM[(char *[2] *)_445][1]
+	.loc 1 265 156 is_stmt 1 discriminator 6 view .LVU419
+.LBB55:
+	.loc 1 265 161 discriminator 6 view .LVU420
+.LVL133:
+	.loc 1 265 272 discriminator 6 view .LVU421
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 276 is_stmt 0 discriminator 6 view .LVU422
+	movq	$0, -344(%rbp)	#, _ypmt_SET_found
+	.loc 1 265 385 is_stmt 1 discriminator 6 view .LVU423
+	.loc 1 265 417 discriminator 6 view .LVU424
+	.loc 1 265 441 discriminator 6 view .LVU425
+	.loc 1 265 469 discriminator 6 view .LVU426
+	.loc 1 265 493 discriminator 6 view .LVU427
+.LBB56:
+	.loc 1 265 498 discriminator 6 view .LVU428
+	.loc 1 265 527 discriminator 6 view .LVU429
+.LBB57:
+	.loc 1 265 532 discriminator 6 view .LVU430
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 542 is_stmt 0 discriminator 6 view .LVU431
+	movq	$0, -352(%rbp)	#, MEM[(struct ypObject * *)_446]
+	.loc 1 265 10 is_stmt 1 discriminator 6 view .LVU432
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 29 is_stmt 0 discriminator 6 view .LVU433
+	leaq	-352(%rbp), %rsi	#, tmp425
+	movq	-376(%rbp), %rdi	# %sfp,
+	call	yp_lenC@PLT	#
+.LVL134:
+	.loc 1 265 29 discriminator 6 view .LVU434
+	movq	%rax, %r9	# tmp638, _ypmt_LEN_actual
+.LVL135:
+	.loc 1 265 59 is_stmt 1 discriminator 6 view .LVU435
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 67 is_stmt 0 discriminator 6 view .LVU436
+	movq	-352(%rbp), %rdi	# MEM[(struct ypObject * *)_446], exc.40_64
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 62 discriminator 6 view .LVU437
+	testq	%rdi, %rdi	# exc.40_64
+	je	.L56	#,
+	.loc 1 265 12 is_stmt 1 discriminator 1 view .LVU438
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 16 is_stmt 0 discriminator 1 view .LVU439
+	call	yp_isexceptionC@PLT	#
+.LVL136:
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 15 discriminator 1 view .LVU440
+	testl	%eax, %eax	# tmp639
+	je	.L57	#,
+	.loc 1 265 40 is_stmt 1 discriminator 3 view .LVU441
+	movl	$2, %r8d	#,
+	leaq	.LC24(%rip), %rcx	#, tmp426
+	leaq	.LC25(%rip), %rdx	#, tmp427
+	movl	$265, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp428
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL137:
+.L131:
+	.loc 1 265 40 is_stmt 0 discriminator 3 view .LVU442
+.LBE57:
+.LBE56:
+.LBE55:
+.LBE54:
+.LBB67:
+.LBB53:
+	.loc 1 264 427 is_stmt 1 discriminator 5 view .LVU443
+	subq	$8, %rsp	#,
+	pushq	$32	#
+	leaq	.LC21(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp420
+	leaq	.LC9(%rip), %rdx	#, tmp421
+	movl	$264, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp422
+	movl	$0, %eax	#,
+.LVL138:
+	.loc 1 264 427 is_stmt 0 discriminator 5 view .LVU444
+	call	munit_errorf_ex@PLT	#
+.LVL139:
+.L57:
+	.loc 1 264 427 discriminator 5 view .LVU445
+.LBE53:
+.LBE67:
+.LBB68:
+.LBB65:
+.LBB59:
+.LBB58:
+	.loc 1 265 59 is_stmt 1 discriminator 4 view .LVU446
+	movl	$2, %r8d	#,
+	leaq	.LC24(%rip), %rcx	#, tmp429
+	leaq	.LC26(%rip), %rdx	#, tmp430
+	movl	$265, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp431
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL140:
+.L56:
+	.loc 1 265 59 is_stmt 0 discriminator 4 view .LVU447
+.LBE58:
+	.loc 1 265 530 is_stmt 1 discriminator 2 view .LVU448
+	.loc 1 265 47 discriminator 2 view .LVU449
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 50 is_stmt 0 discriminator 2 view .LVU450
+	cmpq	$2, %rax	#, _ypmt_LEN_actual
+	jne	.L132	#,
+.LBE59:
+	.loc 1 265 496 is_stmt 1 discriminator 6 view .LVU451
+	.loc 1 265 81 discriminator 6 view .LVU452
+.LBB60:
+	.loc 1 265 86 discriminator 6 view .LVU453
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 134 is_stmt 0 discriminator 6 view .LVU454
+	leaq	-368(%rbp), %rsi	#, tmp435
+	movq	-376(%rbp), %rdi	# %sfp,
+	call	yp_miniiter@PLT	#
+.LVL141:
+	.loc 1 265 134 discriminator 6 view .LVU455
+	movq	%rax, %r15	# tmp640, _ypmt_SET_mi
+.LVL142:
+	.loc 1 265 183 is_stmt 1 discriminator 6 view .LVU456
+	.loc 1 265 188 discriminator 6 view .LVU457
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 192 is_stmt 0 discriminator 6 view .LVU458
+	movq	%rax, %rdi	# _ypmt_SET_mi,
+	call	yp_isexceptionC@PLT	#
+.LVL143:
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 191 discriminator 6 view .LVU459
+	testl	%eax, %eax	# tmp641
+	jne	.L133	#,
+.L59:
+	.loc 1 265 191 discriminator 6 view .LVU460
+.LBE60:
+	.loc 1 265 427 is_stmt 1 discriminator 17 view .LVU461
+	leaq	-336(%rbp), %rcx	#, tmp460
+	leaq	-368(%rbp), %rsi	#, tmp461
+	leaq	-352(%rbp), %r9	#,
+	leaq	-360(%rbp), %r8	#,
+	movl	$2, %edx	#,
+	movq	%r15, %rdi	# _ypmt_SET_mi,
+	call	_assert_setlike_helper@PLT	#
+.LVL144:
+	testl	%eax, %eax	# tmp645
+	je	.L134	#,
+	.loc 1 265 552 discriminator 18 view .LVU462
+	.loc 1 265 557 discriminator 18 view .LVU463
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 561 is_stmt 0 discriminator 18 view .LVU464
+	movq	-360(%rbp), %rdi	# _ypmt_SET_actual,
+	call	yp_isexceptionC@PLT	#
+.LVL145:
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 560 discriminator 18 view .LVU465
+	testl	%eax, %eax	# tmp642
+	jne	.L135	#,
+	.loc 1 265 555 is_stmt 1 discriminator 10 view .LVU466
+	.loc 1 265 801 discriminator 10 view .LVU467
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 817 is_stmt 0 discriminator 10 view .LVU468
+	movq	-352(%rbp), %rax	# MEM[(long int *)_446], _ypmt_SET_i.43_69
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 804 discriminator 10 view .LVU469
+	cmpq	$1, %rax	#, _ypmt_SET_i.43_69
+	jg	.L136	#,
+	.loc 1 265 956 is_stmt 1 discriminator 12 view .LVU470
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 959 is_stmt 0 discriminator 12 view .LVU471
+	cmpl	$0, -344(%rbp,%rax,4)	#, _ypmt_SET_found[_ypmt_SET_i.43_69]
+	jne	.L137	#,
+	.loc 1 265 1140 is_stmt 1 discriminator 14 view .LVU472
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 1169 is_stmt 0 discriminator 14 view .LVU473
+	movl	$1, -344(%rbp,%rax,4)	#, _ypmt_SET_found[_ypmt_SET_i.43_69]
+	.loc 1 265 1181 is_stmt 1 discriminator 14 view .LVU474
+.LBB61:
+	.loc 1 265 1186 discriminator 14 view .LVU475
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 1216 is_stmt 0 discriminator 14 view .LVU476
+	movq	-360(%rbp), %rdi	# _ypmt_SET_actual,
+	call	yp_type@PLT	#
+.LVL146:
+	movq	%rax, -384(%rbp)	# tmp643, %sfp
+.LVL147:
+	.loc 1 265 1243 is_stmt 1 discriminator 14 view .LVU477
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 1273 is_stmt 0 discriminator 14 view .LVU478
+	movq	-352(%rbp), %rax	# MEM[(long int *)_446], MEM[(long int *)_446]
+.LVL148:
+	.loc 1 265 1273 discriminator 14 view .LVU479
+	movq	-336(%rbp,%rax,8), %rdi	# MEM[(struct ypObject *[2] *)_444][_ypmt_SET_i.48_73], MEM[(struct ypObject *[2] *)_444][_ypmt_SET_i.48_73]
+	call	yp_type@PLT	#
+.LVL149:
+	.loc 1 265 1312 is_stmt 1 discriminator 14 view .LVU480
+	.loc 1 265 1317 discriminator 14 view .LVU481
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 1320 is_stmt 0 discriminator 14 view .LVU482
+	cmpq	%rax, -384(%rbp)	# _ypmt_TYPE_type_b, %sfp
+	jne	.L138	#,
+	.loc 1 265 1315 is_stmt 1 discriminator 16 view .LVU483
+.LBE61:
+	.loc 1 265 1184 discriminator 16 view .LVU484
+	.loc 1 265 1671 discriminator 16 view .LVU485
+	movq	-360(%rbp), %rdi	# _ypmt_SET_actual,
+	call	yp_decref@PLT	#
+.LVL150:
+	.loc 1 265 1671 is_stmt 0 discriminator 16 view .LVU486
+	jmp	.L59	#
+.LVL151:
+.L132:
+.LBB62:
+	.loc 1 265 86 is_stmt 1 discriminator 5 view .LVU487
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	movl	$2, %r8d	#,
+	leaq	.LC24(%rip), %rcx	#, tmp432
+	leaq	.LC27(%rip), %rdx	#, tmp433
+	movl	$265, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp434
+	movl	$0, %eax	#,
+.LVL152:
+	.loc 1 265 86 is_stmt 0 discriminator 5 view .LVU488
+	call	munit_errorf_ex@PLT	#
+.LVL153:
+.L133:
+	.loc 1 265 86 discriminator 5 view .LVU489
+.LBE62:
+.LBB63:
+	.loc 1 265 233 is_stmt 1 discriminator 7 view .LVU490
+	leaq	.LC24(%rip), %rcx	#, tmp436
+	leaq	.LC28(%rip), %rdx	#, tmp437
+	movl	$265, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp438
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL154:
+.L135:
+	.loc 1 265 233 is_stmt 0 discriminator 7 view .LVU491
+.LBE63:
+	.loc 1 265 598 is_stmt 1 discriminator 9 view .LVU492
+	leaq	.LC24(%rip), %rcx	#, tmp440
+	leaq	.LC29(%rip), %rdx	#, tmp441
+	movl	$265, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp442
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL155:
+.L136:
+	.loc 1 265 835 discriminator 11 view .LVU493
+	leaq	.LC24(%rip), %rcx	#, tmp443
+	leaq	.LC30(%rip), %rdx	#, tmp444
+	movl	$265, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp445
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL156:
+.L137:
+	.loc 1 265 992 discriminator 13 view .LVU494
+	movq	-320(%rbp,%rax,8), %rcx	# MEM[(char *[2] *)_445][_ypmt_SET_i.43_69], MEM[(char *[2] *)_445][_ypmt_SET_i.43_69]
+	leaq	.LC24(%rip), %r8	#,
+	leaq	.LC31(%rip), %rdx	#, tmp447
+	movl	$265, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp448
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL157:
+.L138:
+.LBB64:
+	.loc 1 265 1366 discriminator 15 view .LVU495
+	subq	$8, %rsp	#,
+	pushq	%rax	# _ypmt_TYPE_type_b
+	movq	-384(%rbp), %r9	# %sfp,
+	movq	-352(%rbp), %rax	# MEM[(long int *)_446], MEM[(long int *)_446]
+.LVL158:
+	.loc 1 265 1366 is_stmt 0 discriminator 15 view .LVU496
+	movq	-320(%rbp,%rax,8), %r8	# MEM[(char *[2] *)_445][_ypmt_SET_i.49_75],
+	leaq	.LC24(%rip), %rcx	#, tmp454
+	leaq	.LC32(%rip), %rdx	#, tmp455
+	movl	$265, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp456
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL159:
+.L134:
+	.loc 1 265 1366 discriminator 15 view .LVU497
+.LBE64:
+	.loc 1 265 1702 is_stmt 1 discriminator 19 view .LVU498
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 1719 is_stmt 0 discriminator 19 view .LVU499
+	movq	$0, -352(%rbp)	#, MEM[(long int *)_446]
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 1702 discriminator 19 view .LVU500
+	jmp	.L65	#
+.L67:
+	.loc 1 265 1768 is_stmt 1 discriminator 24 view .LVU501
+# Lib/munit_test/test_protocols/test_collection.c:265:         assert_setlike(keys, items[0], items[1]);
+	.loc 1 265 1771 is_stmt 0 discriminator 24 view .LVU502
+	cmpl	$0, -344(%rbp,%rdi,4)	#, _ypmt_SET_found[_ypmt_SET_i.54_82]
+	je	.L139	#,
+	.loc 1 265 1762 is_stmt 1 discriminator 22 view .LVU503
+	movl	$1, %esi	#,
+	call	__addvdi3@PLT	#
+.LVL160:
+	movq	%rax, -352(%rbp)	# tmp646, MEM[(long int *)_446]
+.L65:
+	.loc 1 265 1736 discriminator 23 view .LVU504
+	movq	-352(%rbp), %rdi	# MEM[(long int *)_446], _ypmt_SET_i.54_82
+	cmpq	$1, %rdi	#, _ypmt_SET_i.54_82
+	jle	.L67	#,
+	.loc 1 265 1953 discriminator 25 view .LVU505
+	movq	%r15, %rdi	# _ypmt_SET_mi,
+	call	yp_decref@PLT	#
+.LVL161:
+.LBE65:
+	.loc 1 265 159 discriminator 25 view .LVU506
+.LBE68:
+	.loc 1 265 12 discriminator 25 view .LVU507
+	.loc 1 266 9 discriminator 25 view .LVU508
+	movq	-376(%rbp), %rdx	# %sfp,
+	movq	%r14, %rsi	# self,
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_decrefN@PLT	#
+.LVL162:
+.L44:
+	.loc 1 266 9 is_stmt 0 discriminator 25 view .LVU509
+.LBE45:
+.LBB70:
+	.loc 1 271 9 is_stmt 1 view .LVU510
+# Lib/munit_test/test_protocols/test_collection.c:271:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 271 26 is_stmt 0 view .LVU511
+	movq	-296(%rbp), %rdx	# items[1],
+	movq	-304(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r12)	# type_151->newN
+.LVL163:
+	movq	%rax, %r14	# tmp647, self
+.LVL164:
+	.loc 1 272 9 is_stmt 1 view .LVU512
+.LBB71:
+	.loc 1 272 14 view .LVU513
+# Lib/munit_test/test_protocols/test_collection.c:272:         assert_not_raises_exc(yp_reserveC(self, 1, &exc));
+	.loc 1 272 24 is_stmt 0 view .LVU514
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 272 10 is_stmt 1 view .LVU515
+# Lib/munit_test/test_protocols/test_collection.c:272:         assert_not_raises_exc(yp_reserveC(self, 1, &exc));
+	.loc 1 272 11 is_stmt 0 view .LVU516
+	leaq	-320(%rbp), %rdx	#, tmp468
+	movl	$1, %esi	#,
+	movq	%rax, %rdi	# self,
+	call	yp_reserveC@PLT	#
+.LVL165:
+	.loc 1 272 40 is_stmt 1 view .LVU517
+# Lib/munit_test/test_protocols/test_collection.c:272:         assert_not_raises_exc(yp_reserveC(self, 1, &exc));
+	.loc 1 272 48 is_stmt 0 view .LVU518
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.55_86
+# Lib/munit_test/test_protocols/test_collection.c:272:         assert_not_raises_exc(yp_reserveC(self, 1, &exc));
+	.loc 1 272 43 view .LVU519
+	testq	%rdi, %rdi	# exc.55_86
+	je	.L68	#,
+	.loc 1 272 12 is_stmt 1 discriminator 1 view .LVU520
+# Lib/munit_test/test_protocols/test_collection.c:272:         assert_not_raises_exc(yp_reserveC(self, 1, &exc));
+	.loc 1 272 16 is_stmt 0 discriminator 1 view .LVU521
+	call	yp_isexceptionC@PLT	#
+.LVL166:
+# Lib/munit_test/test_protocols/test_collection.c:272:         assert_not_raises_exc(yp_reserveC(self, 1, &exc));
+	.loc 1 272 15 discriminator 1 view .LVU522
+	testl	%eax, %eax	# tmp648
+	je	.L69	#,
+	.loc 1 272 40 is_stmt 1 discriminator 2 view .LVU523
+	leaq	.LC34(%rip), %rcx	#, tmp469
+	leaq	.LC10(%rip), %rdx	#, tmp470
+	movl	$272, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp471
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL167:
+.L139:
+	.loc 1 272 40 is_stmt 0 discriminator 2 view .LVU524
+.LBE71:
+.LBE70:
+.LBB86:
+.LBB69:
+.LBB66:
+	.loc 1 265 1805 is_stmt 1 discriminator 21 view .LVU525
+	movq	-320(%rbp,%rdi,8), %rcx	# MEM[(char *[2] *)_445][_ypmt_SET_i.54_82], MEM[(char *[2] *)_445][_ypmt_SET_i.54_82]
+	leaq	.LC24(%rip), %r8	#,
+	leaq	.LC33(%rip), %rdx	#, tmp463
+	movl	$265, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp464
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL168:
+.L69:
+	.loc 1 265 1805 is_stmt 0 discriminator 21 view .LVU526
+.LBE66:
+.LBE69:
+.LBE86:
+.LBB87:
+.LBB72:
+	.loc 1 272 198 is_stmt 1 discriminator 3 view .LVU527
+	leaq	.LC34(%rip), %rcx	#, tmp472
+	leaq	.LC11(%rip), %rdx	#, tmp473
+	movl	$272, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp474
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL169:
+.L68:
+.LBE72:
+	.loc 1 272 12 view .LVU528
+	.loc 1 273 9 view .LVU529
+.LBB73:
+	.loc 1 273 14 view .LVU530
+# Lib/munit_test/test_protocols/test_collection.c:273:         assert_not_raises_exc(yp_reserveC(self, 0, &exc));
+	.loc 1 273 24 is_stmt 0 view .LVU531
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 273 10 is_stmt 1 view .LVU532
+# Lib/munit_test/test_protocols/test_collection.c:273:         assert_not_raises_exc(yp_reserveC(self, 0, &exc));
+	.loc 1 273 11 is_stmt 0 view .LVU533
+	leaq	-320(%rbp), %rdx	#, tmp475
+	movl	$0, %esi	#,
+	movq	%r14, %rdi	# self,
+	call	yp_reserveC@PLT	#
+.LVL170:
+	.loc 1 273 40 is_stmt 1 view .LVU534
+# Lib/munit_test/test_protocols/test_collection.c:273:         assert_not_raises_exc(yp_reserveC(self, 0, &exc));
+	.loc 1 273 48 is_stmt 0 view .LVU535
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.57_88
+# Lib/munit_test/test_protocols/test_collection.c:273:         assert_not_raises_exc(yp_reserveC(self, 0, &exc));
+	.loc 1 273 43 view .LVU536
+	testq	%rdi, %rdi	# exc.57_88
+	je	.L70	#,
+	.loc 1 273 12 is_stmt 1 discriminator 1 view .LVU537
+# Lib/munit_test/test_protocols/test_collection.c:273:         assert_not_raises_exc(yp_reserveC(self, 0, &exc));
+	.loc 1 273 16 is_stmt 0 discriminator 1 view .LVU538
+	call	yp_isexceptionC@PLT	#
+.LVL171:
+# Lib/munit_test/test_protocols/test_collection.c:273:         assert_not_raises_exc(yp_reserveC(self, 0, &exc));
+	.loc 1 273 15 discriminator 1 view .LVU539
+	testl	%eax, %eax	# tmp649
+	je	.L71	#,
+	.loc 1 273 40 is_stmt 1 discriminator 2 view .LVU540
+	leaq	.LC35(%rip), %rcx	#, tmp476
+	leaq	.LC10(%rip), %rdx	#, tmp477
+	movl	$273, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp478
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL172:
+.L71:
+	.loc 1 273 198 discriminator 3 view .LVU541
+	leaq	.LC35(%rip), %rcx	#, tmp479
+	leaq	.LC11(%rip), %rdx	#, tmp480
+	movl	$273, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp481
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL173:
+.L70:
+.LBE73:
+	.loc 1 273 12 view .LVU542
+	.loc 1 274 9 view .LVU543
+.LBB74:
+	.loc 1 274 14 view .LVU544
+# Lib/munit_test/test_protocols/test_collection.c:274:         assert_not_raises_exc(yp_reserveC(self, -1, &exc));
+	.loc 1 274 24 is_stmt 0 view .LVU545
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 274 10 is_stmt 1 view .LVU546
+# Lib/munit_test/test_protocols/test_collection.c:274:         assert_not_raises_exc(yp_reserveC(self, -1, &exc));
+	.loc 1 274 11 is_stmt 0 view .LVU547
+	leaq	-320(%rbp), %rdx	#, tmp482
+	movq	$-1, %rsi	#,
+	movq	%r14, %rdi	# self,
+	call	yp_reserveC@PLT	#
+.LVL174:
+	.loc 1 274 41 is_stmt 1 view .LVU548
+# Lib/munit_test/test_protocols/test_collection.c:274:         assert_not_raises_exc(yp_reserveC(self, -1, &exc));
+	.loc 1 274 49 is_stmt 0 view .LVU549
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.59_90
+# Lib/munit_test/test_protocols/test_collection.c:274:         assert_not_raises_exc(yp_reserveC(self, -1, &exc));
+	.loc 1 274 44 view .LVU550
+	testq	%rdi, %rdi	# exc.59_90
+	je	.L72	#,
+	.loc 1 274 12 is_stmt 1 discriminator 1 view .LVU551
+# Lib/munit_test/test_protocols/test_collection.c:274:         assert_not_raises_exc(yp_reserveC(self, -1, &exc));
+	.loc 1 274 16 is_stmt 0 discriminator 1 view .LVU552
+	call	yp_isexceptionC@PLT	#
+.LVL175:
+# Lib/munit_test/test_protocols/test_collection.c:274:         assert_not_raises_exc(yp_reserveC(self, -1, &exc));
+	.loc 1 274 15 discriminator 1 view .LVU553
+	testl	%eax, %eax	# tmp650
+	je	.L73	#,
+	.loc 1 274 40 is_stmt 1 discriminator 2 view .LVU554
+	leaq	.LC36(%rip), %rcx	#, tmp483
+	leaq	.LC10(%rip), %rdx	#, tmp484
+	movl	$274, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp485
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL176:
+.L73:
+	.loc 1 274 199 discriminator 3 view .LVU555
+	leaq	.LC36(%rip), %rcx	#, tmp486
+	leaq	.LC11(%rip), %rdx	#, tmp487
+	movl	$274, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp488
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL177:
+.L72:
+.LBE74:
+	.loc 1 274 12 view .LVU556
+	.loc 1 275 9 view .LVU557
+.LBB75:
+	.loc 1 275 14 view .LVU558
+	.loc 1 275 48 view .LVU559
+	.loc 1 275 85 view .LVU560
+.LBB76:
+	.loc 1 275 90 view .LVU561
+	.loc 1 275 119 view .LVU562
+.LBB77:
+	.loc 1 275 124 view .LVU563
+# Lib/munit_test/test_protocols/test_collection.c:275:         assert_len(self, 2);
+	.loc 1 275 134 is_stmt 0 view .LVU564
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 275 10 is_stmt 1 view .LVU565
+# Lib/munit_test/test_protocols/test_collection.c:275:         assert_len(self, 2);
+	.loc 1 275 29 is_stmt 0 view .LVU566
+	leaq	-320(%rbp), %rsi	#, tmp489
+	movq	%r14, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL178:
+	movq	%rax, %r9	# tmp651, _ypmt_LEN_actual
+.LVL179:
+	.loc 1 275 59 is_stmt 1 view .LVU567
+# Lib/munit_test/test_protocols/test_collection.c:275:         assert_len(self, 2);
+	.loc 1 275 67 is_stmt 0 view .LVU568
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.61_92
+# Lib/munit_test/test_protocols/test_collection.c:275:         assert_len(self, 2);
+	.loc 1 275 62 view .LVU569
+	testq	%rdi, %rdi	# exc.61_92
+	je	.L74	#,
+	.loc 1 275 12 is_stmt 1 discriminator 1 view .LVU570
+# Lib/munit_test/test_protocols/test_collection.c:275:         assert_len(self, 2);
+	.loc 1 275 16 is_stmt 0 discriminator 1 view .LVU571
+	call	yp_isexceptionC@PLT	#
+.LVL180:
+# Lib/munit_test/test_protocols/test_collection.c:275:         assert_len(self, 2);
+	.loc 1 275 15 discriminator 1 view .LVU572
+	testl	%eax, %eax	# tmp652
+	je	.L75	#,
+	.loc 1 275 40 is_stmt 1 discriminator 3 view .LVU573
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp490
+	leaq	.LC7(%rip), %rdx	#, tmp491
+	movl	$275, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp492
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL181:
+.L75:
+	.loc 1 275 211 discriminator 4 view .LVU574
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp493
+	leaq	.LC8(%rip), %rdx	#, tmp494
+	movl	$275, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp495
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL182:
+.L74:
+	.loc 1 275 211 is_stmt 0 discriminator 4 view .LVU575
+.LBE77:
+	.loc 1 275 122 is_stmt 1 discriminator 2 view .LVU576
+	.loc 1 275 379 discriminator 2 view .LVU577
+# Lib/munit_test/test_protocols/test_collection.c:275:         assert_len(self, 2);
+	.loc 1 275 382 is_stmt 0 discriminator 2 view .LVU578
+	cmpq	$2, %rax	#, _ypmt_LEN_actual
+	jne	.L140	#,
+.LBE76:
+	.loc 1 275 88 is_stmt 1 discriminator 6 view .LVU579
+.LBE75:
+	.loc 1 275 12 discriminator 6 view .LVU580
+	.loc 1 276 9 discriminator 6 view .LVU581
+.LBB79:
+	.loc 1 276 14 discriminator 6 view .LVU582
+# Lib/munit_test/test_protocols/test_collection.c:276:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 276 39 is_stmt 0 discriminator 6 view .LVU583
+	movq	-304(%rbp), %rsi	# items[0],
+	movq	%r14, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL183:
+	.loc 1 276 69 is_stmt 1 discriminator 6 view .LVU584
+	.loc 1 276 104 discriminator 6 view .LVU585
+.LBB80:
+	.loc 1 276 109 discriminator 6 view .LVU586
+# Lib/munit_test/test_protocols/test_collection.c:276:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 276 180 is_stmt 0 discriminator 6 view .LVU587
+	cmpq	%rax, %r13	# tmp653, _ypmt_OBJ_b
+	je	.L112	#,
+# Lib/munit_test/test_protocols/test_collection.c:276:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 276 180 discriminator 2 view .LVU588
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.63_138
+.L77:
+.LVL184:
+	.loc 1 276 193 is_stmt 1 discriminator 4 view .LVU589
+	.loc 1 276 198 discriminator 4 view .LVU590
+# Lib/munit_test/test_protocols/test_collection.c:276:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 276 201 is_stmt 0 discriminator 4 view .LVU591
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.63_138
+	je	.L78	#,
+	.loc 1 276 240 is_stmt 1 discriminator 6 view .LVU592
+# Lib/munit_test/test_protocols/test_collection.c:276:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 276 243 is_stmt 0 discriminator 6 view .LVU593
+	cmpq	%rdi, yp_False(%rip)	# iftmp.63_138, yp_False
+	je	.L141	#,
+	.loc 1 276 473 is_stmt 1 discriminator 8 view .LVU594
+	.loc 1 276 478 discriminator 8 view .LVU595
+	.loc 1 276 483 discriminator 8 view .LVU596
+# Lib/munit_test/test_protocols/test_collection.c:276:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 276 487 is_stmt 0 discriminator 8 view .LVU597
+	call	yp_isexceptionC@PLT	#
+.LVL185:
+# Lib/munit_test/test_protocols/test_collection.c:276:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 276 486 discriminator 8 view .LVU598
+	testl	%eax, %eax	# tmp654
+	je	.L80	#,
+	.loc 1 276 524 is_stmt 1 discriminator 9 view .LVU599
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp503
+	leaq	.LC15(%rip), %rdx	#, tmp504
+	movl	$276, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp505
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL186:
+.L140:
+	.loc 1 276 524 is_stmt 0 discriminator 9 view .LVU600
+.LBE80:
+.LBE79:
+.LBB82:
+.LBB78:
+	.loc 1 275 425 is_stmt 1 discriminator 5 view .LVU601
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp496
+	leaq	.LC9(%rip), %rdx	#, tmp497
+	movl	$275, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp498
+	movl	$0, %eax	#,
+.LVL187:
+	.loc 1 275 425 is_stmt 0 discriminator 5 view .LVU602
+	call	munit_errorf_ex@PLT	#
+.LVL188:
+.L112:
+	.loc 1 275 425 discriminator 5 view .LVU603
+.LBE78:
+.LBE82:
+.LBB83:
+.LBB81:
+# Lib/munit_test/test_protocols/test_collection.c:276:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 276 180 view .LVU604
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.63_138
+	jmp	.L77	#
+.LVL189:
+.L141:
+	.loc 1 276 276 is_stmt 1 discriminator 7 view .LVU605
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp500
+	leaq	.LC14(%rip), %rdx	#, tmp501
+	movl	$276, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp502
+.LVL190:
+	.loc 1 276 276 is_stmt 0 discriminator 7 view .LVU606
+	movl	$0, %eax	#,
+.LVL191:
+	.loc 1 276 276 discriminator 7 view .LVU607
+	call	munit_errorf_ex@PLT	#
+.LVL192:
+.L80:
+	.loc 1 276 481 is_stmt 1 discriminator 10 view .LVU608
+	.loc 1 276 731 discriminator 10 view .LVU609
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp506
+	leaq	.LC16(%rip), %rdx	#, tmp507
+	movl	$276, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp508
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL193:
+.L78:
+	.loc 1 276 233 view .LVU610
+	.loc 1 276 476 view .LVU611
+	.loc 1 276 196 view .LVU612
+.LBE81:
+	.loc 1 276 107 view .LVU613
+.LBE83:
+	.loc 1 276 12 view .LVU614
+	.loc 1 277 9 view .LVU615
+.LBB84:
+	.loc 1 277 14 view .LVU616
+# Lib/munit_test/test_protocols/test_collection.c:277:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 277 39 is_stmt 0 view .LVU617
+	movq	-296(%rbp), %rsi	# items[1],
+	movq	%r14, %rdi	# self,
+.LVL194:
+	.loc 1 277 39 view .LVU618
+	call	yp_contains@PLT	#
+.LVL195:
+	.loc 1 277 69 is_stmt 1 view .LVU619
+	.loc 1 277 104 view .LVU620
+.LBB85:
+	.loc 1 277 109 view .LVU621
+# Lib/munit_test/test_protocols/test_collection.c:277:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 277 180 is_stmt 0 view .LVU622
+	cmpq	%rax, %r13	# tmp655, _ypmt_OBJ_b
+	je	.L113	#,
+# Lib/munit_test/test_protocols/test_collection.c:277:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 277 180 discriminator 2 view .LVU623
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.66_139
+.L81:
+.LVL196:
+	.loc 1 277 193 is_stmt 1 discriminator 4 view .LVU624
+	.loc 1 277 198 discriminator 4 view .LVU625
+# Lib/munit_test/test_protocols/test_collection.c:277:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 277 201 is_stmt 0 discriminator 4 view .LVU626
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.66_139
+	je	.L82	#,
+	.loc 1 277 240 is_stmt 1 discriminator 6 view .LVU627
+# Lib/munit_test/test_protocols/test_collection.c:277:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 277 243 is_stmt 0 discriminator 6 view .LVU628
+	cmpq	%rdi, yp_False(%rip)	# iftmp.66_139, yp_False
+	je	.L142	#,
+	.loc 1 277 473 is_stmt 1 discriminator 8 view .LVU629
+	.loc 1 277 478 discriminator 8 view .LVU630
+	.loc 1 277 483 discriminator 8 view .LVU631
+# Lib/munit_test/test_protocols/test_collection.c:277:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 277 487 is_stmt 0 discriminator 8 view .LVU632
+	call	yp_isexceptionC@PLT	#
+.LVL197:
+# Lib/munit_test/test_protocols/test_collection.c:277:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 277 486 discriminator 8 view .LVU633
+	testl	%eax, %eax	# tmp656
+	je	.L84	#,
+	.loc 1 277 524 is_stmt 1 discriminator 9 view .LVU634
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp513
+	leaq	.LC15(%rip), %rdx	#, tmp514
+	movl	$277, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp515
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL198:
+.L113:
+# Lib/munit_test/test_protocols/test_collection.c:277:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 277 180 is_stmt 0 view .LVU635
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.66_139
+	jmp	.L81	#
+.LVL199:
+.L142:
+	.loc 1 277 276 is_stmt 1 discriminator 7 view .LVU636
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp510
+	leaq	.LC14(%rip), %rdx	#, tmp511
+	movl	$277, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp512
+.LVL200:
+	.loc 1 277 276 is_stmt 0 discriminator 7 view .LVU637
+	movl	$0, %eax	#,
+.LVL201:
+	.loc 1 277 276 discriminator 7 view .LVU638
+	call	munit_errorf_ex@PLT	#
+.LVL202:
+.L84:
+	.loc 1 277 481 is_stmt 1 discriminator 10 view .LVU639
+	.loc 1 277 731 discriminator 10 view .LVU640
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp516
+	leaq	.LC16(%rip), %rdx	#, tmp517
+	movl	$277, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp518
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL203:
+.L82:
+	.loc 1 277 233 view .LVU641
+	.loc 1 277 476 view .LVU642
+	.loc 1 277 196 view .LVU643
+.LBE85:
+	.loc 1 277 107 view .LVU644
+.LBE84:
+	.loc 1 277 12 view .LVU645
+	.loc 1 278 9 view .LVU646
+	movq	%r14, %rdi	# self,
+.LVL204:
+	.loc 1 278 9 is_stmt 0 view .LVU647
+	call	yp_decref@PLT	#
+.LVL205:
+	.loc 1 278 9 view .LVU648
+.LBE87:
+.LBB88:
+	.loc 1 283 9 is_stmt 1 view .LVU649
+# Lib/munit_test/test_protocols/test_collection.c:283:         ypObject *self = type->newN(0);
+	.loc 1 283 26 is_stmt 0 view .LVU650
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r12)	# type_151->newN
+.LVL206:
+	movq	%rax, %r14	# tmp657, self
+.LVL207:
+	.loc 1 284 9 is_stmt 1 view .LVU651
+.LBB89:
+	.loc 1 284 14 view .LVU652
+# Lib/munit_test/test_protocols/test_collection.c:284:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 284 24 is_stmt 0 view .LVU653
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 284 10 is_stmt 1 view .LVU654
+# Lib/munit_test/test_protocols/test_collection.c:284:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 284 11 is_stmt 0 view .LVU655
+	leaq	-320(%rbp), %rdx	#, tmp519
+	movl	$32, %esi	#,
+	movq	%rax, %rdi	# self,
+	call	yp_reserveC@PLT	#
+.LVL208:
+	.loc 1 284 41 is_stmt 1 view .LVU656
+# Lib/munit_test/test_protocols/test_collection.c:284:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 284 49 is_stmt 0 view .LVU657
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.69_101
+# Lib/munit_test/test_protocols/test_collection.c:284:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 284 44 view .LVU658
+	testq	%rdi, %rdi	# exc.69_101
+	je	.L85	#,
+	.loc 1 284 12 is_stmt 1 discriminator 1 view .LVU659
+# Lib/munit_test/test_protocols/test_collection.c:284:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 284 16 is_stmt 0 discriminator 1 view .LVU660
+	call	yp_isexceptionC@PLT	#
+.LVL209:
+# Lib/munit_test/test_protocols/test_collection.c:284:         assert_not_raises_exc(yp_reserveC(self, 32, &exc));
+	.loc 1 284 15 discriminator 1 view .LVU661
+	testl	%eax, %eax	# tmp658
+	je	.L86	#,
+	.loc 1 284 40 is_stmt 1 discriminator 2 view .LVU662
+	leaq	.LC1(%rip), %rcx	#, tmp520
+	leaq	.LC10(%rip), %rdx	#, tmp521
+	movl	$284, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp522
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL210:
+.L86:
+	.loc 1 284 199 discriminator 3 view .LVU663
+	leaq	.LC1(%rip), %rcx	#, tmp523
+	leaq	.LC11(%rip), %rdx	#, tmp524
+	movl	$284, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp525
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL211:
+.L85:
+.LBE89:
+	.loc 1 284 12 view .LVU664
+	.loc 1 285 9 view .LVU665
+.LBB90:
+	.loc 1 285 14 view .LVU666
+	.loc 1 285 48 view .LVU667
+	.loc 1 285 85 view .LVU668
+.LBB91:
+	.loc 1 285 90 view .LVU669
+	.loc 1 285 119 view .LVU670
+.LBB92:
+	.loc 1 285 124 view .LVU671
+# Lib/munit_test/test_protocols/test_collection.c:285:         assert_len(self, 0);
+	.loc 1 285 134 is_stmt 0 view .LVU672
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 285 10 is_stmt 1 view .LVU673
+# Lib/munit_test/test_protocols/test_collection.c:285:         assert_len(self, 0);
+	.loc 1 285 29 is_stmt 0 view .LVU674
+	leaq	-320(%rbp), %rsi	#, tmp526
+	movq	%r14, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL212:
+	movq	%rax, %r9	# tmp659, _ypmt_LEN_actual
+.LVL213:
+	.loc 1 285 59 is_stmt 1 view .LVU675
+# Lib/munit_test/test_protocols/test_collection.c:285:         assert_len(self, 0);
+	.loc 1 285 67 is_stmt 0 view .LVU676
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.71_103
+# Lib/munit_test/test_protocols/test_collection.c:285:         assert_len(self, 0);
+	.loc 1 285 62 view .LVU677
+	testq	%rdi, %rdi	# exc.71_103
+	je	.L87	#,
+	.loc 1 285 12 is_stmt 1 discriminator 1 view .LVU678
+# Lib/munit_test/test_protocols/test_collection.c:285:         assert_len(self, 0);
+	.loc 1 285 16 is_stmt 0 discriminator 1 view .LVU679
+	call	yp_isexceptionC@PLT	#
+.LVL214:
+# Lib/munit_test/test_protocols/test_collection.c:285:         assert_len(self, 0);
+	.loc 1 285 15 discriminator 1 view .LVU680
+	testl	%eax, %eax	# tmp660
+	je	.L88	#,
+	.loc 1 285 40 is_stmt 1 discriminator 3 view .LVU681
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp527
+	leaq	.LC7(%rip), %rdx	#, tmp528
+	movl	$285, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp529
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL215:
+.L88:
+	.loc 1 285 211 discriminator 4 view .LVU682
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp530
+	leaq	.LC8(%rip), %rdx	#, tmp531
+	movl	$285, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp532
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL216:
+.L87:
+	.loc 1 285 211 is_stmt 0 discriminator 4 view .LVU683
+.LBE92:
+	.loc 1 285 122 is_stmt 1 discriminator 2 view .LVU684
+	.loc 1 285 379 discriminator 2 view .LVU685
+# Lib/munit_test/test_protocols/test_collection.c:285:         assert_len(self, 0);
+	.loc 1 285 382 is_stmt 0 discriminator 2 view .LVU686
+	testq	%rax, %rax	# _ypmt_LEN_actual
+	je	.L89	#,
+	.loc 1 285 425 is_stmt 1 discriminator 5 view .LVU687
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp533
+	leaq	.LC9(%rip), %rdx	#, tmp534
+	movl	$285, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp535
+	movl	$0, %eax	#,
+.LVL217:
+	.loc 1 285 425 is_stmt 0 discriminator 5 view .LVU688
+	call	munit_errorf_ex@PLT	#
+.LVL218:
+.L89:
+	.loc 1 285 425 discriminator 5 view .LVU689
+.LBE91:
+	.loc 1 285 88 is_stmt 1 discriminator 6 view .LVU690
+.LBE90:
+	.loc 1 285 12 discriminator 6 view .LVU691
+	.loc 1 286 9 discriminator 6 view .LVU692
+	movq	%r14, %rdi	# self,
+	call	yp_decref@PLT	#
+.LVL219:
+	.loc 1 286 9 is_stmt 0 discriminator 6 view .LVU693
+.LBE88:
+.LBB93:
+	.loc 1 291 9 is_stmt 1 discriminator 6 view .LVU694
+# Lib/munit_test/test_protocols/test_collection.c:291:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 291 26 is_stmt 0 discriminator 6 view .LVU695
+	movq	-296(%rbp), %rdx	# items[1],
+	movq	-304(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r12)	# type_151->newN
+.LVL220:
+	movq	%rax, %r15	# tmp661, self
+.LVL221:
+	.loc 1 292 9 is_stmt 1 discriminator 6 view .LVU696
+.LBB94:
+	.loc 1 292 14 discriminator 6 view .LVU697
+# Lib/munit_test/test_protocols/test_collection.c:292:         assert_raises_exc(yp_reserveC(self, yp_SSIZE_T_MAX, &exc), yp_MemorySizeOverflowError);
+	.loc 1 292 24 is_stmt 0 discriminator 6 view .LVU698
+	movq	yp_MemorySizeOverflowError(%rip), %rax	# yp_MemorySizeOverflowError, yp_MemorySizeOverflowError
+.LVL222:
+	.loc 1 292 24 discriminator 6 view .LVU699
+	movq	%rax, -336(%rbp)	# yp_MemorySizeOverflowError, MEM[(struct ypObject *[1] *)_444][0]
+	.loc 1 292 80 is_stmt 1 discriminator 6 view .LVU700
+.LVL223:
+	.loc 1 292 206 discriminator 6 view .LVU701
+.LBB95:
+	.loc 1 292 211 discriminator 6 view .LVU702
+# Lib/munit_test/test_protocols/test_collection.c:292:         assert_raises_exc(yp_reserveC(self, yp_SSIZE_T_MAX, &exc), yp_MemorySizeOverflowError);
+	.loc 1 292 221 is_stmt 0 discriminator 6 view .LVU703
+	movq	yp_None(%rip), %r14	# yp_None, yp_None.74_109
+.LVL224:
+	.loc 1 292 221 discriminator 6 view .LVU704
+	movq	%r14, -320(%rbp)	# yp_None.74_109, MEM[(struct ypObject * *)_445]
+	.loc 1 292 236 is_stmt 1 discriminator 6 view .LVU705
+	.loc 1 292 386 discriminator 6 view .LVU706
+# Lib/munit_test/test_protocols/test_collection.c:292:         assert_raises_exc(yp_reserveC(self, yp_SSIZE_T_MAX, &exc), yp_MemorySizeOverflowError);
+	.loc 1 292 387 is_stmt 0 discriminator 6 view .LVU707
+	leaq	-320(%rbp), %rdx	#, tmp539
+	movabsq	$9223372036854775807, %rsi	#, tmp540
+	movq	%r15, %rdi	# self,
+	call	yp_reserveC@PLT	#
+.LVL225:
+	.loc 1 292 434 is_stmt 1 discriminator 6 view .LVU708
+# Lib/munit_test/test_protocols/test_collection.c:292:         assert_raises_exc(yp_reserveC(self, yp_SSIZE_T_MAX, &exc), yp_MemorySizeOverflowError);
+	.loc 1 292 439 is_stmt 0 discriminator 6 view .LVU709
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445],
+	call	yp_isexceptionC@PLT	#
+.LVL226:
+# Lib/munit_test/test_protocols/test_collection.c:292:         assert_raises_exc(yp_reserveC(self, yp_SSIZE_T_MAX, &exc), yp_MemorySizeOverflowError);
+	.loc 1 292 437 discriminator 6 view .LVU710
+	testl	%eax, %eax	# tmp662
+	jne	.L90	#,
+	.loc 1 292 463 is_stmt 1 discriminator 3 view .LVU711
+	leaq	.LC38(%rip), %r8	#,
+	leaq	.LC39(%rip), %rcx	#, tmp542
+	leaq	.LC2(%rip), %rdx	#, tmp543
+	movl	$292, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp544
+	call	munit_errorf_ex@PLT	#
+.LVL227:
+.L90:
+	.loc 1 292 683 discriminator 4 view .LVU712
+# Lib/munit_test/test_protocols/test_collection.c:292:         assert_raises_exc(yp_reserveC(self, yp_SSIZE_T_MAX, &exc), yp_MemorySizeOverflowError);
+	.loc 1 292 688 is_stmt 0 discriminator 4 view .LVU713
+	leaq	-336(%rbp), %rdx	#, tmp545
+	movl	$1, %esi	#,
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445],
+	call	yp_isexception_arrayC@PLT	#
+.LVL228:
+# Lib/munit_test/test_protocols/test_collection.c:292:         assert_raises_exc(yp_reserveC(self, yp_SSIZE_T_MAX, &exc), yp_MemorySizeOverflowError);
+	.loc 1 292 686 discriminator 4 view .LVU714
+	testl	%eax, %eax	# tmp663
+	jne	.L91	#,
+	.loc 1 292 757 is_stmt 1 discriminator 5 view .LVU715
+	leaq	.LC38(%rip), %r8	#,
+	leaq	.LC39(%rip), %rcx	#, tmp547
+	leaq	.LC4(%rip), %rdx	#, tmp548
+	movl	$292, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp549
+	call	munit_errorf_ex@PLT	#
+.LVL229:
+.L91:
+.LBE95:
+	.loc 1 292 209 view .LVU716
+.LBE94:
+	.loc 1 292 12 view .LVU717
+	.loc 1 293 9 view .LVU718
+.LBB96:
+	.loc 1 293 14 view .LVU719
+	.loc 1 293 48 view .LVU720
+	.loc 1 293 85 view .LVU721
+.LBB97:
+	.loc 1 293 90 view .LVU722
+	.loc 1 293 119 view .LVU723
+.LBB98:
+	.loc 1 293 124 view .LVU724
+# Lib/munit_test/test_protocols/test_collection.c:293:         assert_len(self, 2);
+	.loc 1 293 134 is_stmt 0 view .LVU725
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 293 10 is_stmt 1 view .LVU726
+# Lib/munit_test/test_protocols/test_collection.c:293:         assert_len(self, 2);
+	.loc 1 293 29 is_stmt 0 view .LVU727
+	leaq	-320(%rbp), %rsi	#, tmp550
+	movq	%r15, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL230:
+	movq	%rax, %r9	# tmp664, _ypmt_LEN_actual
+.LVL231:
+	.loc 1 293 59 is_stmt 1 view .LVU728
+# Lib/munit_test/test_protocols/test_collection.c:293:         assert_len(self, 2);
+	.loc 1 293 67 is_stmt 0 view .LVU729
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.77_114
+# Lib/munit_test/test_protocols/test_collection.c:293:         assert_len(self, 2);
+	.loc 1 293 62 view .LVU730
+	testq	%rdi, %rdi	# exc.77_114
+	je	.L92	#,
+	.loc 1 293 12 is_stmt 1 discriminator 1 view .LVU731
+# Lib/munit_test/test_protocols/test_collection.c:293:         assert_len(self, 2);
+	.loc 1 293 16 is_stmt 0 discriminator 1 view .LVU732
+	call	yp_isexceptionC@PLT	#
+.LVL232:
+# Lib/munit_test/test_protocols/test_collection.c:293:         assert_len(self, 2);
+	.loc 1 293 15 discriminator 1 view .LVU733
+	testl	%eax, %eax	# tmp665
+	je	.L93	#,
+	.loc 1 293 40 is_stmt 1 discriminator 3 view .LVU734
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp551
+	leaq	.LC7(%rip), %rdx	#, tmp552
+	movl	$293, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp553
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL233:
+.L93:
+	.loc 1 293 211 discriminator 4 view .LVU735
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp554
+	leaq	.LC8(%rip), %rdx	#, tmp555
+	movl	$293, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp556
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL234:
+.L92:
+	.loc 1 293 211 is_stmt 0 discriminator 4 view .LVU736
+.LBE98:
+	.loc 1 293 122 is_stmt 1 discriminator 2 view .LVU737
+	.loc 1 293 379 discriminator 2 view .LVU738
+# Lib/munit_test/test_protocols/test_collection.c:293:         assert_len(self, 2);
+	.loc 1 293 382 is_stmt 0 discriminator 2 view .LVU739
+	cmpq	$2, %rax	#, _ypmt_LEN_actual
+	je	.L94	#,
+	.loc 1 293 425 is_stmt 1 discriminator 5 view .LVU740
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp557
+	leaq	.LC9(%rip), %rdx	#, tmp558
+	movl	$293, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp559
+	movl	$0, %eax	#,
+.LVL235:
+	.loc 1 293 425 is_stmt 0 discriminator 5 view .LVU741
+	call	munit_errorf_ex@PLT	#
+.LVL236:
+.L94:
+	.loc 1 293 425 discriminator 5 view .LVU742
+.LBE97:
+	.loc 1 293 88 is_stmt 1 discriminator 6 view .LVU743
+.LBE96:
+	.loc 1 293 12 discriminator 6 view .LVU744
+	.loc 1 294 9 discriminator 6 view .LVU745
+	movq	%r15, %rdi	# self,
+	call	yp_decref@PLT	#
+.LVL237:
+	.loc 1 294 9 is_stmt 0 discriminator 6 view .LVU746
+.LBE93:
+.LBB99:
+	.loc 1 299 9 is_stmt 1 discriminator 6 view .LVU747
+# Lib/munit_test/test_protocols/test_collection.c:299:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 299 26 is_stmt 0 discriminator 6 view .LVU748
+	movq	-296(%rbp), %rdx	# items[1],
+	movq	-304(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r12)	# type_151->newN
+.LVL238:
+	movq	%rax, %r12	# tmp666, self
+.LVL239:
+	.loc 1 300 9 is_stmt 1 discriminator 6 view .LVU749
+	movl	$0, %edi	#,
+	call	malloc_tracker_oom_after@PLT	#
+.LVL240:
+	.loc 1 301 9 discriminator 6 view .LVU750
+.LBB100:
+	.loc 1 301 14 discriminator 6 view .LVU751
+# Lib/munit_test/test_protocols/test_collection.c:301:         assert_raises_exc(yp_reserveC(self, 1000, &exc), yp_MemoryError);
+	.loc 1 301 24 is_stmt 0 discriminator 6 view .LVU752
+	movq	yp_MemoryError(%rip), %rax	# yp_MemoryError, yp_MemoryError
+	movq	%rax, -336(%rbp)	# yp_MemoryError, MEM[(struct ypObject *[1] *)_444][0]
+	.loc 1 301 68 is_stmt 1 discriminator 6 view .LVU753
+.LVL241:
+	.loc 1 301 194 discriminator 6 view .LVU754
+.LBB101:
+	.loc 1 301 199 discriminator 6 view .LVU755
+# Lib/munit_test/test_protocols/test_collection.c:301:         assert_raises_exc(yp_reserveC(self, 1000, &exc), yp_MemoryError);
+	.loc 1 301 209 is_stmt 0 discriminator 6 view .LVU756
+	movq	%r14, -320(%rbp)	# yp_None.74_109, MEM[(struct ypObject * *)_445]
+	.loc 1 301 224 is_stmt 1 discriminator 6 view .LVU757
+	.loc 1 301 374 discriminator 6 view .LVU758
+# Lib/munit_test/test_protocols/test_collection.c:301:         assert_raises_exc(yp_reserveC(self, 1000, &exc), yp_MemoryError);
+	.loc 1 301 375 is_stmt 0 discriminator 6 view .LVU759
+	leaq	-320(%rbp), %rdx	#, tmp563
+	movl	$1000, %esi	#,
+	movq	%r12, %rdi	# self,
+	call	yp_reserveC@PLT	#
+.LVL242:
+	.loc 1 301 407 is_stmt 1 discriminator 6 view .LVU760
+# Lib/munit_test/test_protocols/test_collection.c:301:         assert_raises_exc(yp_reserveC(self, 1000, &exc), yp_MemoryError);
+	.loc 1 301 412 is_stmt 0 discriminator 6 view .LVU761
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445],
+	call	yp_isexceptionC@PLT	#
+.LVL243:
+# Lib/munit_test/test_protocols/test_collection.c:301:         assert_raises_exc(yp_reserveC(self, 1000, &exc), yp_MemoryError);
+	.loc 1 301 410 discriminator 6 view .LVU762
+	testl	%eax, %eax	# tmp667
+	jne	.L95	#,
+	.loc 1 301 436 is_stmt 1 discriminator 3 view .LVU763
+	leaq	.LC40(%rip), %r8	#,
+	leaq	.LC41(%rip), %rcx	#, tmp565
+	leaq	.LC2(%rip), %rdx	#, tmp566
+	movl	$301, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp567
+	call	munit_errorf_ex@PLT	#
+.LVL244:
+.L95:
+	.loc 1 301 634 discriminator 4 view .LVU764
+# Lib/munit_test/test_protocols/test_collection.c:301:         assert_raises_exc(yp_reserveC(self, 1000, &exc), yp_MemoryError);
+	.loc 1 301 639 is_stmt 0 discriminator 4 view .LVU765
+	leaq	-336(%rbp), %rdx	#, tmp568
+	movl	$1, %esi	#,
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445],
+	call	yp_isexception_arrayC@PLT	#
+.LVL245:
+# Lib/munit_test/test_protocols/test_collection.c:301:         assert_raises_exc(yp_reserveC(self, 1000, &exc), yp_MemoryError);
+	.loc 1 301 637 discriminator 4 view .LVU766
+	testl	%eax, %eax	# tmp668
+	jne	.L96	#,
+	.loc 1 301 708 is_stmt 1 discriminator 5 view .LVU767
+	leaq	.LC40(%rip), %r8	#,
+	leaq	.LC41(%rip), %rcx	#, tmp570
+	leaq	.LC4(%rip), %rdx	#, tmp571
+	movl	$301, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp572
+	call	munit_errorf_ex@PLT	#
+.LVL246:
+.L96:
+.LBE101:
+	.loc 1 301 197 view .LVU768
+.LBE100:
+	.loc 1 301 12 view .LVU769
+	.loc 1 302 9 view .LVU770
+	call	malloc_tracker_oom_disable@PLT	#
+.LVL247:
+	.loc 1 303 9 view .LVU771
+.LBB102:
+	.loc 1 303 14 view .LVU772
+	.loc 1 303 48 view .LVU773
+	.loc 1 303 85 view .LVU774
+.LBB103:
+	.loc 1 303 90 view .LVU775
+	.loc 1 303 119 view .LVU776
+.LBB104:
+	.loc 1 303 124 view .LVU777
+# Lib/munit_test/test_protocols/test_collection.c:303:         assert_len(self, 2);
+	.loc 1 303 134 is_stmt 0 view .LVU778
+	movq	$0, -320(%rbp)	#, MEM[(struct ypObject * *)_445]
+	.loc 1 303 10 is_stmt 1 view .LVU779
+# Lib/munit_test/test_protocols/test_collection.c:303:         assert_len(self, 2);
+	.loc 1 303 29 is_stmt 0 view .LVU780
+	leaq	-320(%rbp), %rsi	#, tmp573
+	movq	%r12, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL248:
+	movq	%rax, %r9	# tmp669, _ypmt_LEN_actual
+.LVL249:
+	.loc 1 303 59 is_stmt 1 view .LVU781
+# Lib/munit_test/test_protocols/test_collection.c:303:         assert_len(self, 2);
+	.loc 1 303 67 is_stmt 0 view .LVU782
+	movq	-320(%rbp), %rdi	# MEM[(struct ypObject * *)_445], exc.83_124
+# Lib/munit_test/test_protocols/test_collection.c:303:         assert_len(self, 2);
+	.loc 1 303 62 view .LVU783
+	testq	%rdi, %rdi	# exc.83_124
+	je	.L97	#,
+	.loc 1 303 12 is_stmt 1 discriminator 1 view .LVU784
+# Lib/munit_test/test_protocols/test_collection.c:303:         assert_len(self, 2);
+	.loc 1 303 16 is_stmt 0 discriminator 1 view .LVU785
+	call	yp_isexceptionC@PLT	#
+.LVL250:
+# Lib/munit_test/test_protocols/test_collection.c:303:         assert_len(self, 2);
+	.loc 1 303 15 discriminator 1 view .LVU786
+	testl	%eax, %eax	# tmp670
+	je	.L98	#,
+	.loc 1 303 40 is_stmt 1 discriminator 3 view .LVU787
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp574
+	leaq	.LC7(%rip), %rdx	#, tmp575
+	movl	$303, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp576
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL251:
+.L98:
+	.loc 1 303 211 discriminator 4 view .LVU788
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp577
+	leaq	.LC8(%rip), %rdx	#, tmp578
+	movl	$303, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp579
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL252:
+.L97:
+	.loc 1 303 211 is_stmt 0 discriminator 4 view .LVU789
+.LBE104:
+	.loc 1 303 122 is_stmt 1 discriminator 2 view .LVU790
+	.loc 1 303 379 discriminator 2 view .LVU791
+# Lib/munit_test/test_protocols/test_collection.c:303:         assert_len(self, 2);
+	.loc 1 303 382 is_stmt 0 discriminator 2 view .LVU792
+	cmpq	$2, %rax	#, _ypmt_LEN_actual
+	je	.L99	#,
+	.loc 1 303 425 is_stmt 1 discriminator 5 view .LVU793
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp580
+	leaq	.LC9(%rip), %rdx	#, tmp581
+	movl	$303, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp582
+	movl	$0, %eax	#,
+.LVL253:
+	.loc 1 303 425 is_stmt 0 discriminator 5 view .LVU794
+	call	munit_errorf_ex@PLT	#
+.LVL254:
+.L99:
+	.loc 1 303 425 discriminator 5 view .LVU795
+.LBE103:
+	.loc 1 303 88 is_stmt 1 discriminator 6 view .LVU796
+.LBE102:
+	.loc 1 303 12 discriminator 6 view .LVU797
+	.loc 1 304 9 discriminator 6 view .LVU798
+.LBB105:
+	.loc 1 304 14 discriminator 6 view .LVU799
+# Lib/munit_test/test_protocols/test_collection.c:304:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 304 39 is_stmt 0 discriminator 6 view .LVU800
+	movq	-304(%rbp), %rsi	# items[0],
+	movq	%r12, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL255:
+	.loc 1 304 69 is_stmt 1 discriminator 6 view .LVU801
+	.loc 1 304 104 discriminator 6 view .LVU802
+.LBB106:
+	.loc 1 304 109 discriminator 6 view .LVU803
+# Lib/munit_test/test_protocols/test_collection.c:304:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 304 180 is_stmt 0 discriminator 6 view .LVU804
+	cmpq	%rax, %r13	# tmp671, _ypmt_OBJ_b
+	je	.L114	#,
+# Lib/munit_test/test_protocols/test_collection.c:304:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 304 180 discriminator 2 view .LVU805
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.85_140
+.L100:
+.LVL256:
+	.loc 1 304 193 is_stmt 1 discriminator 4 view .LVU806
+	.loc 1 304 198 discriminator 4 view .LVU807
+# Lib/munit_test/test_protocols/test_collection.c:304:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 304 201 is_stmt 0 discriminator 4 view .LVU808
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.85_140
+	je	.L101	#,
+	.loc 1 304 240 is_stmt 1 discriminator 6 view .LVU809
+# Lib/munit_test/test_protocols/test_collection.c:304:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 304 243 is_stmt 0 discriminator 6 view .LVU810
+	cmpq	%rdi, yp_False(%rip)	# iftmp.85_140, yp_False
+	jne	.L102	#,
+	.loc 1 304 276 is_stmt 1 discriminator 7 view .LVU811
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp584
+	leaq	.LC14(%rip), %rdx	#, tmp585
+	movl	$304, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp586
+.LVL257:
+	.loc 1 304 276 is_stmt 0 discriminator 7 view .LVU812
+	movl	$0, %eax	#,
+.LVL258:
+	.loc 1 304 276 discriminator 7 view .LVU813
+	call	munit_errorf_ex@PLT	#
+.LVL259:
+.L114:
+# Lib/munit_test/test_protocols/test_collection.c:304:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 304 180 view .LVU814
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.85_140
+	jmp	.L100	#
+.LVL260:
+.L102:
+	.loc 1 304 473 is_stmt 1 discriminator 8 view .LVU815
+	.loc 1 304 478 discriminator 8 view .LVU816
+	.loc 1 304 483 discriminator 8 view .LVU817
+# Lib/munit_test/test_protocols/test_collection.c:304:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 304 487 is_stmt 0 discriminator 8 view .LVU818
+	call	yp_isexceptionC@PLT	#
+.LVL261:
+# Lib/munit_test/test_protocols/test_collection.c:304:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 304 486 discriminator 8 view .LVU819
+	testl	%eax, %eax	# tmp672
+	je	.L103	#,
+	.loc 1 304 524 is_stmt 1 discriminator 9 view .LVU820
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp587
+	leaq	.LC15(%rip), %rdx	#, tmp588
+	movl	$304, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp589
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL262:
+.L103:
+	.loc 1 304 481 discriminator 10 view .LVU821
+	.loc 1 304 731 discriminator 10 view .LVU822
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp590
+	leaq	.LC16(%rip), %rdx	#, tmp591
+	movl	$304, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp592
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL263:
+.L101:
+	.loc 1 304 233 view .LVU823
+	.loc 1 304 476 view .LVU824
+	.loc 1 304 196 view .LVU825
+.LBE106:
+	.loc 1 304 107 view .LVU826
+.LBE105:
+	.loc 1 304 12 view .LVU827
+	.loc 1 305 9 view .LVU828
+.LBB107:
+	.loc 1 305 14 view .LVU829
+# Lib/munit_test/test_protocols/test_collection.c:305:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 305 39 is_stmt 0 view .LVU830
+	movq	-296(%rbp), %rsi	# items[1],
+	movq	%r12, %rdi	# self,
+.LVL264:
+	.loc 1 305 39 view .LVU831
+	call	yp_contains@PLT	#
+.LVL265:
+	.loc 1 305 69 is_stmt 1 view .LVU832
+	.loc 1 305 104 view .LVU833
+.LBB108:
+	.loc 1 305 109 view .LVU834
+# Lib/munit_test/test_protocols/test_collection.c:305:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 305 180 is_stmt 0 view .LVU835
+	cmpq	%rax, %r13	# tmp673, _ypmt_OBJ_b
+	je	.L115	#,
+# Lib/munit_test/test_protocols/test_collection.c:305:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 305 180 discriminator 2 view .LVU836
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.88_141
+.L104:
+.LVL266:
+	.loc 1 305 193 is_stmt 1 discriminator 4 view .LVU837
+	.loc 1 305 198 discriminator 4 view .LVU838
+# Lib/munit_test/test_protocols/test_collection.c:305:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 305 201 is_stmt 0 discriminator 4 view .LVU839
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.88_141
+	je	.L105	#,
+	.loc 1 305 240 is_stmt 1 discriminator 6 view .LVU840
+# Lib/munit_test/test_protocols/test_collection.c:305:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 305 243 is_stmt 0 discriminator 6 view .LVU841
+	cmpq	%rdi, yp_False(%rip)	# iftmp.88_141, yp_False
+	jne	.L106	#,
+	.loc 1 305 276 is_stmt 1 discriminator 7 view .LVU842
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp594
+	leaq	.LC14(%rip), %rdx	#, tmp595
+	movl	$305, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp596
+.LVL267:
+	.loc 1 305 276 is_stmt 0 discriminator 7 view .LVU843
+	movl	$0, %eax	#,
+.LVL268:
+	.loc 1 305 276 discriminator 7 view .LVU844
+	call	munit_errorf_ex@PLT	#
+.LVL269:
+.L115:
+# Lib/munit_test/test_protocols/test_collection.c:305:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 305 180 view .LVU845
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.88_141
+	jmp	.L104	#
+.LVL270:
+.L106:
+	.loc 1 305 473 is_stmt 1 discriminator 8 view .LVU846
+	.loc 1 305 478 discriminator 8 view .LVU847
+	.loc 1 305 483 discriminator 8 view .LVU848
+# Lib/munit_test/test_protocols/test_collection.c:305:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 305 487 is_stmt 0 discriminator 8 view .LVU849
+	call	yp_isexceptionC@PLT	#
+.LVL271:
+# Lib/munit_test/test_protocols/test_collection.c:305:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 305 486 discriminator 8 view .LVU850
+	testl	%eax, %eax	# tmp674
+	je	.L107	#,
+	.loc 1 305 524 is_stmt 1 discriminator 9 view .LVU851
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp597
+	leaq	.LC15(%rip), %rdx	#, tmp598
+	movl	$305, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp599
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL272:
+.L107:
+	.loc 1 305 481 discriminator 10 view .LVU852
+	.loc 1 305 731 discriminator 10 view .LVU853
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp600
+	leaq	.LC16(%rip), %rdx	#, tmp601
+	movl	$305, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp602
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL273:
+.L105:
+	.loc 1 305 233 view .LVU854
+	.loc 1 305 476 view .LVU855
+	.loc 1 305 196 view .LVU856
+.LBE108:
+	.loc 1 305 107 view .LVU857
+.LBE107:
+	.loc 1 305 12 view .LVU858
+	.loc 1 306 9 view .LVU859
+	movq	%r12, %rdi	# self,
+.LVL274:
+	.loc 1 306 9 is_stmt 0 view .LVU860
+	call	yp_decref@PLT	#
+.LVL275:
+	.loc 1 306 9 view .LVU861
+	jmp	.L8	#
+.LBE99:
+	.cfi_endproc
+.LFE26:
+	.size	test_reserve, .-test_reserve
+	.section	.rodata.str1.1
+.LC42:
+	.string	"yp_clear(self, &exc)"
+.LC43:
+	.string	"yp_False"
+	.text
+	.type	test_clear, @function
+test_clear:
+.LVL276:
+.LFB25:
+	.loc 1 150 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 150 1 is_stmt 0 view .LVU863
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$280, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 151 5 is_stmt 1 view .LVU864
+# Lib/munit_test/test_protocols/test_collection.c:151:     fixture_type_t *type = fixture->type;
+	.loc 1 151 21 is_stmt 0 view .LVU865
+	movq	(%rsi), %r12	# fixture_92(D)->type, type
+.LVL277:
+	.loc 1 152 5 is_stmt 1 view .LVU866
+# Lib/munit_test/test_protocols/test_collection.c:152:     uniqueness_t   *uq = uniqueness_new();
+	.loc 1 152 24 is_stmt 0 view .LVU867
+	call	uniqueness_new@PLT	#
+.LVL278:
+	.loc 1 152 24 view .LVU868
+	movq	%rax, %rbx	# tmp361, uq
+.LVL279:
+	.loc 1 153 5 is_stmt 1 view .LVU869
+	.loc 1 154 5 view .LVU870
+# Lib/munit_test/test_protocols/test_collection.c:154:     obj_array_fill(items, uq, type->rand_items);
+	.loc 1 154 10 is_stmt 0 view .LVU871
+	leaq	-304(%rbp), %rdx	#, tmp194
+	movl	$32, %esi	#,
+	movq	%rax, %rdi	# uq,
+	call	*64(%r12)	# type_93->rand_items
+.LVL280:
+	.loc 1 157 5 is_stmt 1 view .LVU872
+# Lib/munit_test/test_protocols/test_collection.c:157:     if (!type->is_mutable) {
+	.loc 1 157 8 is_stmt 0 view .LVU873
+	cmpl	$0, 96(%r12)	#, type_93->is_mutable
+	jne	.L144	#,
+.LBB109:
+	.loc 1 158 9 is_stmt 1 view .LVU874
+# Lib/munit_test/test_protocols/test_collection.c:158:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 158 26 is_stmt 0 view .LVU875
+	movq	-296(%rbp), %rdx	# items[1],
+	movq	-304(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r12)	# type_93->newN
+.LVL281:
+	movq	%rax, %r12	# tmp362, self
+.LVL282:
+	.loc 1 159 9 is_stmt 1 view .LVU876
+.LBB110:
+	.loc 1 159 14 view .LVU877
+# Lib/munit_test/test_protocols/test_collection.c:159:         assert_raises_exc(yp_clear(self, &exc), yp_MethodError);
+	.loc 1 159 24 is_stmt 0 view .LVU878
+	movq	yp_MethodError(%rip), %rax	# yp_MethodError, yp_MethodError
+.LVL283:
+	.loc 1 159 24 view .LVU879
+	movq	%rax, -320(%rbp)	# yp_MethodError, _ypmt_RAISES_expected[0]
+	.loc 1 159 68 is_stmt 1 view .LVU880
+.LVL284:
+	.loc 1 159 194 view .LVU881
+.LBB111:
+	.loc 1 159 199 view .LVU882
+# Lib/munit_test/test_protocols/test_collection.c:159:         assert_raises_exc(yp_clear(self, &exc), yp_MethodError);
+	.loc 1 159 209 is_stmt 0 view .LVU883
+	movq	yp_None(%rip), %rax	# yp_None, yp_None
+	movq	%rax, -312(%rbp)	# yp_None, MEM[(struct ypObject * *)_226]
+	.loc 1 159 224 is_stmt 1 view .LVU884
+	.loc 1 159 374 view .LVU885
+# Lib/munit_test/test_protocols/test_collection.c:159:         assert_raises_exc(yp_clear(self, &exc), yp_MethodError);
+	.loc 1 159 375 is_stmt 0 view .LVU886
+	leaq	-312(%rbp), %rsi	#, tmp200
+	movq	%r12, %rdi	# self,
+	call	yp_clear@PLT	#
+.LVL285:
+	.loc 1 159 398 is_stmt 1 view .LVU887
+# Lib/munit_test/test_protocols/test_collection.c:159:         assert_raises_exc(yp_clear(self, &exc), yp_MethodError);
+	.loc 1 159 403 is_stmt 0 view .LVU888
+	movq	-312(%rbp), %rdi	# MEM[(struct ypObject * *)_226],
+	call	yp_isexceptionC@PLT	#
+.LVL286:
+# Lib/munit_test/test_protocols/test_collection.c:159:         assert_raises_exc(yp_clear(self, &exc), yp_MethodError);
+	.loc 1 159 401 view .LVU889
+	testl	%eax, %eax	# tmp363
+	je	.L207	#,
+	.loc 1 159 616 is_stmt 1 discriminator 4 view .LVU890
+# Lib/munit_test/test_protocols/test_collection.c:159:         assert_raises_exc(yp_clear(self, &exc), yp_MethodError);
+	.loc 1 159 621 is_stmt 0 discriminator 4 view .LVU891
+	leaq	-320(%rbp), %rdx	#, tmp205
+	movl	$1, %esi	#,
+	movq	-312(%rbp), %rdi	# MEM[(struct ypObject * *)_226],
+	call	yp_isexception_arrayC@PLT	#
+.LVL287:
+# Lib/munit_test/test_protocols/test_collection.c:159:         assert_raises_exc(yp_clear(self, &exc), yp_MethodError);
+	.loc 1 159 619 discriminator 4 view .LVU892
+	testl	%eax, %eax	# tmp364
+	je	.L208	#,
+.LBE111:
+	.loc 1 159 197 is_stmt 1 view .LVU893
+.LBE110:
+	.loc 1 159 12 view .LVU894
+	.loc 1 160 9 view .LVU895
+.LBB113:
+	.loc 1 160 14 view .LVU896
+.LVL288:
+	.loc 1 160 48 view .LVU897
+	.loc 1 160 85 view .LVU898
+.LBB114:
+	.loc 1 160 90 view .LVU899
+	.loc 1 160 119 view .LVU900
+.LBB115:
+	.loc 1 160 124 view .LVU901
+# Lib/munit_test/test_protocols/test_collection.c:160:         assert_len(self, 2);
+	.loc 1 160 134 is_stmt 0 view .LVU902
+	movq	$0, -312(%rbp)	#, MEM[(struct ypObject * *)_226]
+	.loc 1 160 10 is_stmt 1 view .LVU903
+# Lib/munit_test/test_protocols/test_collection.c:160:         assert_len(self, 2);
+	.loc 1 160 29 is_stmt 0 view .LVU904
+	leaq	-312(%rbp), %rsi	#, tmp210
+	movq	%r12, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL289:
+	.loc 1 160 59 is_stmt 1 view .LVU905
+# Lib/munit_test/test_protocols/test_collection.c:160:         assert_len(self, 2);
+	.loc 1 160 67 is_stmt 0 view .LVU906
+	movq	-312(%rbp), %rdi	# MEM[(struct ypObject * *)_226], exc.95_12
+# Lib/munit_test/test_protocols/test_collection.c:160:         assert_len(self, 2);
+	.loc 1 160 62 view .LVU907
+	testq	%rdi, %rdi	# exc.95_12
+	je	.L147	#,
+	.loc 1 160 12 is_stmt 1 discriminator 1 view .LVU908
+# Lib/munit_test/test_protocols/test_collection.c:160:         assert_len(self, 2);
+	.loc 1 160 16 is_stmt 0 discriminator 1 view .LVU909
+	call	yp_isexceptionC@PLT	#
+.LVL290:
+# Lib/munit_test/test_protocols/test_collection.c:160:         assert_len(self, 2);
+	.loc 1 160 15 discriminator 1 view .LVU910
+	testl	%eax, %eax	# tmp366
+	je	.L148	#,
+	.loc 1 160 40 is_stmt 1 discriminator 3 view .LVU911
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp211
+	leaq	.LC7(%rip), %rdx	#, tmp212
+	movl	$160, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp213
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL291:
+.L207:
+	.loc 1 160 40 is_stmt 0 discriminator 3 view .LVU912
+.LBE115:
+.LBE114:
+.LBE113:
+.LBB119:
+.LBB112:
+	.loc 1 159 427 is_stmt 1 discriminator 3 view .LVU913
+	leaq	.LC0(%rip), %r8	#,
+	leaq	.LC42(%rip), %rcx	#, tmp202
+	leaq	.LC2(%rip), %rdx	#, tmp203
+	movl	$159, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp204
+	call	munit_errorf_ex@PLT	#
+.LVL292:
+.L208:
+	.loc 1 159 690 discriminator 5 view .LVU914
+	leaq	.LC0(%rip), %r8	#,
+	leaq	.LC42(%rip), %rcx	#, tmp207
+	leaq	.LC4(%rip), %rdx	#, tmp208
+	movl	$159, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp209
+	call	munit_errorf_ex@PLT	#
+.LVL293:
+.L148:
+	.loc 1 159 690 is_stmt 0 discriminator 5 view .LVU915
+.LBE112:
+.LBE119:
+.LBB120:
+.LBB117:
+.LBB116:
+	.loc 1 160 211 is_stmt 1 discriminator 4 view .LVU916
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp214
+	leaq	.LC8(%rip), %rdx	#, tmp215
+	movl	$160, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp216
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL294:
+.L147:
+	.loc 1 160 211 is_stmt 0 discriminator 4 view .LVU917
+.LBE116:
+	.loc 1 160 122 is_stmt 1 discriminator 2 view .LVU918
+	.loc 1 160 379 discriminator 2 view .LVU919
+# Lib/munit_test/test_protocols/test_collection.c:160:         assert_len(self, 2);
+	.loc 1 160 382 is_stmt 0 discriminator 2 view .LVU920
+	cmpq	$2, %rax	#, _ypmt_LEN_actual
+	jne	.L209	#,
+.LBE117:
+	.loc 1 160 88 is_stmt 1 discriminator 6 view .LVU921
+.LBE120:
+	.loc 1 160 12 discriminator 6 view .LVU922
+	.loc 1 161 9 discriminator 6 view .LVU923
+.LBB121:
+	.loc 1 161 14 discriminator 6 view .LVU924
+# Lib/munit_test/test_protocols/test_collection.c:161:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 161 39 is_stmt 0 discriminator 6 view .LVU925
+	movq	-304(%rbp), %rsi	# items[0],
+	movq	%r12, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL295:
+	.loc 1 161 69 is_stmt 1 discriminator 6 view .LVU926
+# Lib/munit_test/test_protocols/test_collection.c:161:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 161 79 is_stmt 0 discriminator 6 view .LVU927
+	movq	yp_True(%rip), %r13	# yp_True, _ypmt_OBJ_b
+.LVL296:
+	.loc 1 161 104 is_stmt 1 discriminator 6 view .LVU928
+.LBB122:
+	.loc 1 161 109 discriminator 6 view .LVU929
+# Lib/munit_test/test_protocols/test_collection.c:161:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 161 180 is_stmt 0 discriminator 6 view .LVU930
+	cmpq	%rax, %r13	# tmp367, _ypmt_OBJ_b
+	je	.L198	#,
+# Lib/munit_test/test_protocols/test_collection.c:161:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 161 180 discriminator 2 view .LVU931
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.97_82
+.L150:
+.LVL297:
+	.loc 1 161 193 is_stmt 1 discriminator 4 view .LVU932
+	.loc 1 161 198 discriminator 4 view .LVU933
+# Lib/munit_test/test_protocols/test_collection.c:161:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 161 201 is_stmt 0 discriminator 4 view .LVU934
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.97_82
+	je	.L151	#,
+	.loc 1 161 240 is_stmt 1 discriminator 6 view .LVU935
+# Lib/munit_test/test_protocols/test_collection.c:161:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 161 243 is_stmt 0 discriminator 6 view .LVU936
+	cmpq	%rdi, yp_False(%rip)	# iftmp.97_82, yp_False
+	je	.L210	#,
+	.loc 1 161 473 is_stmt 1 discriminator 8 view .LVU937
+	.loc 1 161 478 discriminator 8 view .LVU938
+	.loc 1 161 483 discriminator 8 view .LVU939
+# Lib/munit_test/test_protocols/test_collection.c:161:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 161 487 is_stmt 0 discriminator 8 view .LVU940
+	call	yp_isexceptionC@PLT	#
+.LVL298:
+# Lib/munit_test/test_protocols/test_collection.c:161:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 161 486 discriminator 8 view .LVU941
+	testl	%eax, %eax	# tmp368
+	je	.L153	#,
+	.loc 1 161 524 is_stmt 1 discriminator 9 view .LVU942
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp224
+	leaq	.LC15(%rip), %rdx	#, tmp225
+	movl	$161, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp226
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL299:
+.L209:
+	.loc 1 161 524 is_stmt 0 discriminator 9 view .LVU943
+.LBE122:
+.LBE121:
+.LBB124:
+.LBB118:
+	.loc 1 160 425 is_stmt 1 discriminator 5 view .LVU944
+	subq	$8, %rsp	#,
+	pushq	$2	#
+	movq	%rax, %r9	# _ypmt_LEN_actual,
+	leaq	.LC5(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp217
+	leaq	.LC9(%rip), %rdx	#, tmp218
+	movl	$160, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp219
+	movl	$0, %eax	#,
+.LVL300:
+	.loc 1 160 425 is_stmt 0 discriminator 5 view .LVU945
+	call	munit_errorf_ex@PLT	#
+.LVL301:
+.L198:
+	.loc 1 160 425 discriminator 5 view .LVU946
+.LBE118:
+.LBE124:
+.LBB125:
+.LBB123:
+# Lib/munit_test/test_protocols/test_collection.c:161:         assert_obj(yp_contains(self, items[0]), is, yp_True);
+	.loc 1 161 180 view .LVU947
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.97_82
+	jmp	.L150	#
+.LVL302:
+.L210:
+	.loc 1 161 276 is_stmt 1 discriminator 7 view .LVU948
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp221
+	leaq	.LC14(%rip), %rdx	#, tmp222
+	movl	$161, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp223
+.LVL303:
+	.loc 1 161 276 is_stmt 0 discriminator 7 view .LVU949
+	movl	$0, %eax	#,
+.LVL304:
+	.loc 1 161 276 discriminator 7 view .LVU950
+	call	munit_errorf_ex@PLT	#
+.LVL305:
+.L153:
+	.loc 1 161 481 is_stmt 1 discriminator 10 view .LVU951
+	.loc 1 161 731 discriminator 10 view .LVU952
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp227
+	leaq	.LC16(%rip), %rdx	#, tmp228
+	movl	$161, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp229
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL306:
+.L151:
+	.loc 1 161 233 view .LVU953
+	.loc 1 161 476 view .LVU954
+	.loc 1 161 196 view .LVU955
+.LBE123:
+	.loc 1 161 107 view .LVU956
+.LBE125:
+	.loc 1 161 12 view .LVU957
+	.loc 1 162 9 view .LVU958
+.LBB126:
+	.loc 1 162 14 view .LVU959
+# Lib/munit_test/test_protocols/test_collection.c:162:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 162 39 is_stmt 0 view .LVU960
+	movq	-296(%rbp), %rsi	# items[1],
+	movq	%r12, %rdi	# self,
+.LVL307:
+	.loc 1 162 39 view .LVU961
+	call	yp_contains@PLT	#
+.LVL308:
+	.loc 1 162 69 is_stmt 1 view .LVU962
+	.loc 1 162 104 view .LVU963
+.LBB127:
+	.loc 1 162 109 view .LVU964
+# Lib/munit_test/test_protocols/test_collection.c:162:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 162 180 is_stmt 0 view .LVU965
+	cmpq	%rax, %r13	# tmp369, _ypmt_OBJ_b
+	je	.L199	#,
+# Lib/munit_test/test_protocols/test_collection.c:162:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 162 180 discriminator 2 view .LVU966
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.100_83
+.L154:
+.LVL309:
+	.loc 1 162 193 is_stmt 1 discriminator 4 view .LVU967
+	.loc 1 162 198 discriminator 4 view .LVU968
+# Lib/munit_test/test_protocols/test_collection.c:162:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 162 201 is_stmt 0 discriminator 4 view .LVU969
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.100_83
+	je	.L155	#,
+	.loc 1 162 240 is_stmt 1 discriminator 6 view .LVU970
+# Lib/munit_test/test_protocols/test_collection.c:162:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 162 243 is_stmt 0 discriminator 6 view .LVU971
+	cmpq	%rdi, yp_False(%rip)	# iftmp.100_83, yp_False
+	je	.L211	#,
+	.loc 1 162 473 is_stmt 1 discriminator 8 view .LVU972
+	.loc 1 162 478 discriminator 8 view .LVU973
+	.loc 1 162 483 discriminator 8 view .LVU974
+# Lib/munit_test/test_protocols/test_collection.c:162:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 162 487 is_stmt 0 discriminator 8 view .LVU975
+	call	yp_isexceptionC@PLT	#
+.LVL310:
+# Lib/munit_test/test_protocols/test_collection.c:162:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 162 486 discriminator 8 view .LVU976
+	testl	%eax, %eax	# tmp370
+	je	.L157	#,
+	.loc 1 162 524 is_stmt 1 discriminator 9 view .LVU977
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp234
+	leaq	.LC15(%rip), %rdx	#, tmp235
+	movl	$162, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp236
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL311:
+.L199:
+# Lib/munit_test/test_protocols/test_collection.c:162:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 162 180 is_stmt 0 view .LVU978
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.100_83
+	jmp	.L154	#
+.LVL312:
+.L211:
+	.loc 1 162 276 is_stmt 1 discriminator 7 view .LVU979
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp231
+	leaq	.LC14(%rip), %rdx	#, tmp232
+	movl	$162, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp233
+.LVL313:
+	.loc 1 162 276 is_stmt 0 discriminator 7 view .LVU980
+	movl	$0, %eax	#,
+.LVL314:
+	.loc 1 162 276 discriminator 7 view .LVU981
+	call	munit_errorf_ex@PLT	#
+.LVL315:
+.L157:
+	.loc 1 162 481 is_stmt 1 discriminator 10 view .LVU982
+	.loc 1 162 731 discriminator 10 view .LVU983
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp237
+	leaq	.LC16(%rip), %rdx	#, tmp238
+	movl	$162, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp239
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL316:
+.L155:
+	.loc 1 162 233 view .LVU984
+	.loc 1 162 476 view .LVU985
+	.loc 1 162 196 view .LVU986
+.LBE127:
+	.loc 1 162 107 view .LVU987
+.LBE126:
+	.loc 1 162 12 view .LVU988
+	.loc 1 163 9 view .LVU989
+	movq	%r12, %rdi	# self,
+.LVL317:
+	.loc 1 163 9 is_stmt 0 view .LVU990
+	call	yp_decref@PLT	#
+.LVL318:
+	.loc 1 164 9 is_stmt 1 view .LVU991
+.L158:
+	.loc 1 164 9 is_stmt 0 view .LVU992
+.LBE109:
+	.loc 1 202 5 is_stmt 1 view .LVU993
+	leaq	-304(%rbp), %rsi	#, tmp358
+	movl	$32, %edi	#,
+	call	obj_array_decref2@PLT	#
+.LVL319:
+	.loc 1 203 5 view .LVU994
+	movq	%rbx, %rdi	# uq,
+	call	uniqueness_dealloc@PLT	#
+.LVL320:
+	.loc 1 204 5 view .LVU995
+# Lib/munit_test/test_protocols/test_collection.c:205: }
+	.loc 1 205 1 is_stmt 0 view .LVU996
+	movl	$0, %eax	#,
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+.LVL321:
+	.loc 1 205 1 view .LVU997
+	popq	%r12	#
+	popq	%r13	#
+	popq	%r14	#
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL322:
+.L144:
+	.cfi_restore_state
+.LBB128:
+	.loc 1 169 9 is_stmt 1 view .LVU998
+# Lib/munit_test/test_protocols/test_collection.c:169:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 169 26 is_stmt 0 view .LVU999
+	movq	-296(%rbp), %rdx	# items[1],
+	movq	-304(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r12)	# type_93->newN
+.LVL323:
+	movq	%rax, %r13	# tmp371, self
+.LVL324:
+	.loc 1 170 9 is_stmt 1 view .LVU1000
+.LBB129:
+	.loc 1 170 14 view .LVU1001
+# Lib/munit_test/test_protocols/test_collection.c:170:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 170 24 is_stmt 0 view .LVU1002
+	movq	$0, -312(%rbp)	#, MEM[(struct ypObject * *)_226]
+	.loc 1 170 10 is_stmt 1 view .LVU1003
+# Lib/munit_test/test_protocols/test_collection.c:170:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 170 11 is_stmt 0 view .LVU1004
+	leaq	-312(%rbp), %rsi	#, tmp242
+	movq	%rax, %rdi	# self,
+	call	yp_clear@PLT	#
+.LVL325:
+	.loc 1 170 34 is_stmt 1 view .LVU1005
+# Lib/munit_test/test_protocols/test_collection.c:170:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 170 42 is_stmt 0 view .LVU1006
+	movq	-312(%rbp), %rdi	# MEM[(struct ypObject * *)_226], exc.103_23
+# Lib/munit_test/test_protocols/test_collection.c:170:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 170 37 view .LVU1007
+	testq	%rdi, %rdi	# exc.103_23
+	je	.L159	#,
+	.loc 1 170 12 is_stmt 1 discriminator 1 view .LVU1008
+# Lib/munit_test/test_protocols/test_collection.c:170:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 170 16 is_stmt 0 discriminator 1 view .LVU1009
+	call	yp_isexceptionC@PLT	#
+.LVL326:
+# Lib/munit_test/test_protocols/test_collection.c:170:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 170 15 discriminator 1 view .LVU1010
+	testl	%eax, %eax	# tmp372
+	je	.L160	#,
+	.loc 1 170 40 is_stmt 1 discriminator 2 view .LVU1011
+	leaq	.LC42(%rip), %rcx	#, tmp243
+	leaq	.LC10(%rip), %rdx	#, tmp244
+	movl	$170, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp245
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL327:
+.L160:
+	.loc 1 170 192 discriminator 3 view .LVU1012
+	leaq	.LC42(%rip), %rcx	#, tmp246
+	leaq	.LC11(%rip), %rdx	#, tmp247
+	movl	$170, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp248
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL328:
+.L159:
+.LBE129:
+	.loc 1 170 12 view .LVU1013
+	.loc 1 171 9 view .LVU1014
+.LBB130:
+	.loc 1 171 14 view .LVU1015
+	.loc 1 171 48 view .LVU1016
+	.loc 1 171 85 view .LVU1017
+.LBB131:
+	.loc 1 171 90 view .LVU1018
+	.loc 1 171 119 view .LVU1019
+.LBB132:
+	.loc 1 171 124 view .LVU1020
+# Lib/munit_test/test_protocols/test_collection.c:171:         assert_len(self, 0);
+	.loc 1 171 134 is_stmt 0 view .LVU1021
+	movq	$0, -312(%rbp)	#, MEM[(struct ypObject * *)_226]
+	.loc 1 171 10 is_stmt 1 view .LVU1022
+# Lib/munit_test/test_protocols/test_collection.c:171:         assert_len(self, 0);
+	.loc 1 171 29 is_stmt 0 view .LVU1023
+	leaq	-312(%rbp), %rsi	#, tmp249
+	movq	%r13, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL329:
+	.loc 1 171 59 is_stmt 1 view .LVU1024
+# Lib/munit_test/test_protocols/test_collection.c:171:         assert_len(self, 0);
+	.loc 1 171 67 is_stmt 0 view .LVU1025
+	movq	-312(%rbp), %rdi	# MEM[(struct ypObject * *)_226], exc.105_25
+# Lib/munit_test/test_protocols/test_collection.c:171:         assert_len(self, 0);
+	.loc 1 171 62 view .LVU1026
+	testq	%rdi, %rdi	# exc.105_25
+	je	.L161	#,
+	.loc 1 171 12 is_stmt 1 discriminator 1 view .LVU1027
+# Lib/munit_test/test_protocols/test_collection.c:171:         assert_len(self, 0);
+	.loc 1 171 16 is_stmt 0 discriminator 1 view .LVU1028
+	call	yp_isexceptionC@PLT	#
+.LVL330:
+# Lib/munit_test/test_protocols/test_collection.c:171:         assert_len(self, 0);
+	.loc 1 171 15 discriminator 1 view .LVU1029
+	testl	%eax, %eax	# tmp374
+	je	.L162	#,
+	.loc 1 171 40 is_stmt 1 discriminator 3 view .LVU1030
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp250
+	leaq	.LC7(%rip), %rdx	#, tmp251
+	movl	$171, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp252
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL331:
+.L162:
+	.loc 1 171 211 discriminator 4 view .LVU1031
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp253
+	leaq	.LC8(%rip), %rdx	#, tmp254
+	movl	$171, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp255
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL332:
+.L161:
+	.loc 1 171 211 is_stmt 0 discriminator 4 view .LVU1032
+.LBE132:
+	.loc 1 171 122 is_stmt 1 discriminator 2 view .LVU1033
+	.loc 1 171 379 discriminator 2 view .LVU1034
+# Lib/munit_test/test_protocols/test_collection.c:171:         assert_len(self, 0);
+	.loc 1 171 382 is_stmt 0 discriminator 2 view .LVU1035
+	testq	%rax, %rax	# _ypmt_LEN_actual
+	jne	.L212	#,
+.LBE131:
+	.loc 1 171 88 is_stmt 1 discriminator 6 view .LVU1036
+.LBE130:
+	.loc 1 171 12 discriminator 6 view .LVU1037
+	.loc 1 172 9 discriminator 6 view .LVU1038
+.LBB134:
+	.loc 1 172 14 discriminator 6 view .LVU1039
+# Lib/munit_test/test_protocols/test_collection.c:172:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 172 39 is_stmt 0 discriminator 6 view .LVU1040
+	movq	-304(%rbp), %rsi	# items[0],
+	movq	%r13, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL333:
+	.loc 1 172 69 is_stmt 1 discriminator 6 view .LVU1041
+# Lib/munit_test/test_protocols/test_collection.c:172:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 172 79 is_stmt 0 discriminator 6 view .LVU1042
+	movq	yp_False(%rip), %r14	# yp_False, _ypmt_OBJ_b
+.LVL334:
+	.loc 1 172 105 is_stmt 1 discriminator 6 view .LVU1043
+.LBB135:
+	.loc 1 172 110 discriminator 6 view .LVU1044
+# Lib/munit_test/test_protocols/test_collection.c:172:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 172 181 is_stmt 0 discriminator 6 view .LVU1045
+	cmpq	%rax, %r14	# tmp375, _ypmt_OBJ_b
+	je	.L213	#,
+# Lib/munit_test/test_protocols/test_collection.c:172:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 172 181 view .LVU1046
+	movq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.107_84
+.L164:
+.LVL335:
+	.loc 1 172 194 is_stmt 1 discriminator 4 view .LVU1047
+	.loc 1 172 199 discriminator 4 view .LVU1048
+# Lib/munit_test/test_protocols/test_collection.c:172:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 172 220 is_stmt 0 discriminator 4 view .LVU1049
+	movq	yp_True(%rip), %r15	# yp_True, yp_True.108_28
+# Lib/munit_test/test_protocols/test_collection.c:172:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 172 202 discriminator 4 view .LVU1050
+	cmpq	%rdi, %r15	# iftmp.107_84, yp_True.108_28
+	je	.L165	#,
+	.loc 1 172 241 is_stmt 1 discriminator 6 view .LVU1051
+# Lib/munit_test/test_protocols/test_collection.c:172:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 172 244 is_stmt 0 discriminator 6 view .LVU1052
+	cmpq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.107_84
+	je	.L214	#,
+	.loc 1 172 475 is_stmt 1 discriminator 8 view .LVU1053
+	.loc 1 172 480 discriminator 8 view .LVU1054
+	.loc 1 172 485 discriminator 8 view .LVU1055
+# Lib/munit_test/test_protocols/test_collection.c:172:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 172 489 is_stmt 0 discriminator 8 view .LVU1056
+	call	yp_isexceptionC@PLT	#
+.LVL336:
+# Lib/munit_test/test_protocols/test_collection.c:172:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 172 488 discriminator 8 view .LVU1057
+	testl	%eax, %eax	# tmp376
+	je	.L167	#,
+	.loc 1 172 526 is_stmt 1 discriminator 9 view .LVU1058
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp263
+	leaq	.LC15(%rip), %rdx	#, tmp264
+	movl	$172, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp265
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL337:
+.L212:
+	.loc 1 172 526 is_stmt 0 discriminator 9 view .LVU1059
+.LBE135:
+.LBE134:
+.LBB137:
+.LBB133:
+	.loc 1 171 425 is_stmt 1 discriminator 5 view .LVU1060
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	movq	%rax, %r9	# _ypmt_LEN_actual,
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp256
+	leaq	.LC9(%rip), %rdx	#, tmp257
+	movl	$171, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp258
+	movl	$0, %eax	#,
+.LVL338:
+	.loc 1 171 425 is_stmt 0 discriminator 5 view .LVU1061
+	call	munit_errorf_ex@PLT	#
+.LVL339:
+.L213:
+	.loc 1 171 425 discriminator 5 view .LVU1062
+.LBE133:
+.LBE137:
+.LBB138:
+.LBB136:
+# Lib/munit_test/test_protocols/test_collection.c:172:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 172 181 discriminator 1 view .LVU1063
+	movq	yp_True(%rip), %rdi	# yp_True, iftmp.107_84
+	jmp	.L164	#
+.LVL340:
+.L214:
+	.loc 1 172 277 is_stmt 1 discriminator 7 view .LVU1064
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp260
+	leaq	.LC14(%rip), %rdx	#, tmp261
+	movl	$172, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp262
+.LVL341:
+	.loc 1 172 277 is_stmt 0 discriminator 7 view .LVU1065
+	movl	$0, %eax	#,
+.LVL342:
+	.loc 1 172 277 discriminator 7 view .LVU1066
+	call	munit_errorf_ex@PLT	#
+.LVL343:
+.L167:
+	.loc 1 172 483 is_stmt 1 discriminator 10 view .LVU1067
+	.loc 1 172 734 discriminator 10 view .LVU1068
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp266
+	leaq	.LC16(%rip), %rdx	#, tmp267
+	movl	$172, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp268
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL344:
+.L165:
+	.loc 1 172 234 view .LVU1069
+	.loc 1 172 478 view .LVU1070
+	.loc 1 172 197 view .LVU1071
+.LBE136:
+	.loc 1 172 108 view .LVU1072
+.LBE138:
+	.loc 1 172 12 view .LVU1073
+	.loc 1 173 9 view .LVU1074
+.LBB139:
+	.loc 1 173 14 view .LVU1075
+# Lib/munit_test/test_protocols/test_collection.c:173:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 173 39 is_stmt 0 view .LVU1076
+	movq	-296(%rbp), %rsi	# items[1],
+	movq	%r13, %rdi	# self,
+.LVL345:
+	.loc 1 173 39 view .LVU1077
+	call	yp_contains@PLT	#
+.LVL346:
+	.loc 1 173 69 is_stmt 1 view .LVU1078
+	.loc 1 173 105 view .LVU1079
+.LBB140:
+	.loc 1 173 110 view .LVU1080
+# Lib/munit_test/test_protocols/test_collection.c:173:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 173 181 is_stmt 0 view .LVU1081
+	cmpq	%rax, %r14	# tmp377, _ypmt_OBJ_b
+	je	.L215	#,
+	movq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.110_85
+.L168:
+.LVL347:
+	.loc 1 173 194 is_stmt 1 discriminator 4 view .LVU1082
+	.loc 1 173 199 discriminator 4 view .LVU1083
+# Lib/munit_test/test_protocols/test_collection.c:173:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 173 202 is_stmt 0 discriminator 4 view .LVU1084
+	cmpq	%rdi, %r15	# iftmp.110_85, yp_True.108_28
+	je	.L169	#,
+	.loc 1 173 241 is_stmt 1 discriminator 6 view .LVU1085
+# Lib/munit_test/test_protocols/test_collection.c:173:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 173 244 is_stmt 0 discriminator 6 view .LVU1086
+	cmpq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.110_85
+	je	.L216	#,
+	.loc 1 173 475 is_stmt 1 discriminator 8 view .LVU1087
+	.loc 1 173 480 discriminator 8 view .LVU1088
+	.loc 1 173 485 discriminator 8 view .LVU1089
+# Lib/munit_test/test_protocols/test_collection.c:173:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 173 489 is_stmt 0 discriminator 8 view .LVU1090
+	call	yp_isexceptionC@PLT	#
+.LVL348:
+# Lib/munit_test/test_protocols/test_collection.c:173:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 173 488 discriminator 8 view .LVU1091
+	testl	%eax, %eax	# tmp378
+	je	.L171	#,
+	.loc 1 173 526 is_stmt 1 discriminator 9 view .LVU1092
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp273
+	leaq	.LC15(%rip), %rdx	#, tmp274
+	movl	$173, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp275
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL349:
+.L215:
+# Lib/munit_test/test_protocols/test_collection.c:173:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 173 181 is_stmt 0 view .LVU1093
+	movq	%r15, %rdi	# yp_True.108_28, iftmp.110_85
+	jmp	.L168	#
+.LVL350:
+.L216:
+	.loc 1 173 277 is_stmt 1 discriminator 7 view .LVU1094
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp270
+	leaq	.LC14(%rip), %rdx	#, tmp271
+	movl	$173, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp272
+.LVL351:
+	.loc 1 173 277 is_stmt 0 discriminator 7 view .LVU1095
+	movl	$0, %eax	#,
+.LVL352:
+	.loc 1 173 277 discriminator 7 view .LVU1096
+	call	munit_errorf_ex@PLT	#
+.LVL353:
+.L171:
+	.loc 1 173 483 is_stmt 1 discriminator 10 view .LVU1097
+	.loc 1 173 734 discriminator 10 view .LVU1098
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp276
+	leaq	.LC16(%rip), %rdx	#, tmp277
+	movl	$173, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp278
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL354:
+.L169:
+	.loc 1 173 234 view .LVU1099
+	.loc 1 173 478 view .LVU1100
+	.loc 1 173 197 view .LVU1101
+.LBE140:
+	.loc 1 173 108 view .LVU1102
+.LBE139:
+	.loc 1 173 12 view .LVU1103
+	.loc 1 174 9 view .LVU1104
+	movq	%r13, %rdi	# self,
+.LVL355:
+	.loc 1 174 9 is_stmt 0 view .LVU1105
+	call	yp_decref@PLT	#
+.LVL356:
+	.loc 1 174 9 view .LVU1106
+.LBE128:
+.LBB141:
+	.loc 1 179 9 is_stmt 1 view .LVU1107
+# Lib/munit_test/test_protocols/test_collection.c:179:         ypObject *self = type->newN(0);
+	.loc 1 179 26 is_stmt 0 view .LVU1108
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r12)	# type_93->newN
+.LVL357:
+	movq	%rax, %r13	# tmp379, self
+.LVL358:
+	.loc 1 180 9 is_stmt 1 view .LVU1109
+.LBB142:
+	.loc 1 180 14 view .LVU1110
+# Lib/munit_test/test_protocols/test_collection.c:180:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 180 24 is_stmt 0 view .LVU1111
+	movq	$0, -312(%rbp)	#, MEM[(struct ypObject * *)_226]
+	.loc 1 180 10 is_stmt 1 view .LVU1112
+# Lib/munit_test/test_protocols/test_collection.c:180:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 180 11 is_stmt 0 view .LVU1113
+	leaq	-312(%rbp), %rsi	#, tmp279
+	movq	%rax, %rdi	# self,
+	call	yp_clear@PLT	#
+.LVL359:
+	.loc 1 180 34 is_stmt 1 view .LVU1114
+# Lib/munit_test/test_protocols/test_collection.c:180:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 180 42 is_stmt 0 view .LVU1115
+	movq	-312(%rbp), %rdi	# MEM[(struct ypObject * *)_226], exc.113_33
+# Lib/munit_test/test_protocols/test_collection.c:180:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 180 37 view .LVU1116
+	testq	%rdi, %rdi	# exc.113_33
+	je	.L172	#,
+	.loc 1 180 12 is_stmt 1 discriminator 1 view .LVU1117
+# Lib/munit_test/test_protocols/test_collection.c:180:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 180 16 is_stmt 0 discriminator 1 view .LVU1118
+	call	yp_isexceptionC@PLT	#
+.LVL360:
+# Lib/munit_test/test_protocols/test_collection.c:180:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 180 15 discriminator 1 view .LVU1119
+	testl	%eax, %eax	# tmp380
+	je	.L173	#,
+	.loc 1 180 40 is_stmt 1 discriminator 2 view .LVU1120
+	leaq	.LC42(%rip), %rcx	#, tmp280
+	leaq	.LC10(%rip), %rdx	#, tmp281
+	movl	$180, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp282
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL361:
+.L173:
+	.loc 1 180 192 discriminator 3 view .LVU1121
+	leaq	.LC42(%rip), %rcx	#, tmp283
+	leaq	.LC11(%rip), %rdx	#, tmp284
+	movl	$180, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp285
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL362:
+.L172:
+.LBE142:
+	.loc 1 180 12 view .LVU1122
+	.loc 1 181 9 view .LVU1123
+.LBB143:
+	.loc 1 181 14 view .LVU1124
+	.loc 1 181 48 view .LVU1125
+	.loc 1 181 85 view .LVU1126
+.LBB144:
+	.loc 1 181 90 view .LVU1127
+	.loc 1 181 119 view .LVU1128
+.LBB145:
+	.loc 1 181 124 view .LVU1129
+# Lib/munit_test/test_protocols/test_collection.c:181:         assert_len(self, 0);
+	.loc 1 181 134 is_stmt 0 view .LVU1130
+	movq	$0, -312(%rbp)	#, MEM[(struct ypObject * *)_226]
+	.loc 1 181 10 is_stmt 1 view .LVU1131
+# Lib/munit_test/test_protocols/test_collection.c:181:         assert_len(self, 0);
+	.loc 1 181 29 is_stmt 0 view .LVU1132
+	leaq	-312(%rbp), %rsi	#, tmp286
+	movq	%r13, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL363:
+	movq	%rax, %r9	# tmp381, _ypmt_LEN_actual
+.LVL364:
+	.loc 1 181 59 is_stmt 1 view .LVU1133
+# Lib/munit_test/test_protocols/test_collection.c:181:         assert_len(self, 0);
+	.loc 1 181 67 is_stmt 0 view .LVU1134
+	movq	-312(%rbp), %rdi	# MEM[(struct ypObject * *)_226], exc.115_35
+# Lib/munit_test/test_protocols/test_collection.c:181:         assert_len(self, 0);
+	.loc 1 181 62 view .LVU1135
+	testq	%rdi, %rdi	# exc.115_35
+	je	.L174	#,
+	.loc 1 181 12 is_stmt 1 discriminator 1 view .LVU1136
+# Lib/munit_test/test_protocols/test_collection.c:181:         assert_len(self, 0);
+	.loc 1 181 16 is_stmt 0 discriminator 1 view .LVU1137
+	call	yp_isexceptionC@PLT	#
+.LVL365:
+# Lib/munit_test/test_protocols/test_collection.c:181:         assert_len(self, 0);
+	.loc 1 181 15 discriminator 1 view .LVU1138
+	testl	%eax, %eax	# tmp382
+	je	.L175	#,
+	.loc 1 181 40 is_stmt 1 discriminator 3 view .LVU1139
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp287
+	leaq	.LC7(%rip), %rdx	#, tmp288
+	movl	$181, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp289
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL366:
+.L175:
+	.loc 1 181 211 discriminator 4 view .LVU1140
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp290
+	leaq	.LC8(%rip), %rdx	#, tmp291
+	movl	$181, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp292
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL367:
+.L174:
+	.loc 1 181 211 is_stmt 0 discriminator 4 view .LVU1141
+.LBE145:
+	.loc 1 181 122 is_stmt 1 discriminator 2 view .LVU1142
+	.loc 1 181 379 discriminator 2 view .LVU1143
+# Lib/munit_test/test_protocols/test_collection.c:181:         assert_len(self, 0);
+	.loc 1 181 382 is_stmt 0 discriminator 2 view .LVU1144
+	testq	%rax, %rax	# _ypmt_LEN_actual
+	jne	.L217	#,
+.LBE144:
+	.loc 1 181 88 is_stmt 1 discriminator 6 view .LVU1145
+.LBE143:
+	.loc 1 181 12 discriminator 6 view .LVU1146
+	.loc 1 182 9 discriminator 6 view .LVU1147
+.LBB147:
+	.loc 1 182 14 discriminator 6 view .LVU1148
+# Lib/munit_test/test_protocols/test_collection.c:182:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 182 39 is_stmt 0 discriminator 6 view .LVU1149
+	movq	-304(%rbp), %rsi	# items[0],
+	movq	%r13, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL368:
+	.loc 1 182 69 is_stmt 1 discriminator 6 view .LVU1150
+	.loc 1 182 105 discriminator 6 view .LVU1151
+.LBB148:
+	.loc 1 182 110 discriminator 6 view .LVU1152
+# Lib/munit_test/test_protocols/test_collection.c:182:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 182 181 is_stmt 0 discriminator 6 view .LVU1153
+	cmpq	%rax, %r14	# tmp383, _ypmt_OBJ_b
+	je	.L218	#,
+# Lib/munit_test/test_protocols/test_collection.c:182:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 182 181 view .LVU1154
+	movq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.117_86
+.L177:
+.LVL369:
+	.loc 1 182 194 is_stmt 1 discriminator 4 view .LVU1155
+	.loc 1 182 199 discriminator 4 view .LVU1156
+# Lib/munit_test/test_protocols/test_collection.c:182:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 182 202 is_stmt 0 discriminator 4 view .LVU1157
+	cmpq	%rdi, %r15	# iftmp.117_86, yp_True.108_28
+	je	.L178	#,
+	.loc 1 182 241 is_stmt 1 discriminator 6 view .LVU1158
+# Lib/munit_test/test_protocols/test_collection.c:182:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 182 244 is_stmt 0 discriminator 6 view .LVU1159
+	cmpq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.117_86
+	je	.L219	#,
+	.loc 1 182 475 is_stmt 1 discriminator 8 view .LVU1160
+	.loc 1 182 480 discriminator 8 view .LVU1161
+	.loc 1 182 485 discriminator 8 view .LVU1162
+# Lib/munit_test/test_protocols/test_collection.c:182:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 182 489 is_stmt 0 discriminator 8 view .LVU1163
+	call	yp_isexceptionC@PLT	#
+.LVL370:
+# Lib/munit_test/test_protocols/test_collection.c:182:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 182 488 discriminator 8 view .LVU1164
+	testl	%eax, %eax	# tmp384
+	je	.L180	#,
+	.loc 1 182 526 is_stmt 1 discriminator 9 view .LVU1165
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp300
+	leaq	.LC15(%rip), %rdx	#, tmp301
+	movl	$182, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp302
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL371:
+.L217:
+	.loc 1 182 526 is_stmt 0 discriminator 9 view .LVU1166
+.LBE148:
+.LBE147:
+.LBB150:
+.LBB146:
+	.loc 1 181 425 is_stmt 1 discriminator 5 view .LVU1167
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp293
+	leaq	.LC9(%rip), %rdx	#, tmp294
+	movl	$181, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp295
+	movl	$0, %eax	#,
+.LVL372:
+	.loc 1 181 425 is_stmt 0 discriminator 5 view .LVU1168
+	call	munit_errorf_ex@PLT	#
+.LVL373:
+.L218:
+	.loc 1 181 425 discriminator 5 view .LVU1169
+.LBE146:
+.LBE150:
+.LBB151:
+.LBB149:
+# Lib/munit_test/test_protocols/test_collection.c:182:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 182 181 view .LVU1170
+	movq	%r15, %rdi	# yp_True.108_28, iftmp.117_86
+	jmp	.L177	#
+.LVL374:
+.L219:
+	.loc 1 182 277 is_stmt 1 discriminator 7 view .LVU1171
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp297
+	leaq	.LC14(%rip), %rdx	#, tmp298
+	movl	$182, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp299
+.LVL375:
+	.loc 1 182 277 is_stmt 0 discriminator 7 view .LVU1172
+	movl	$0, %eax	#,
+.LVL376:
+	.loc 1 182 277 discriminator 7 view .LVU1173
+	call	munit_errorf_ex@PLT	#
+.LVL377:
+.L180:
+	.loc 1 182 483 is_stmt 1 discriminator 10 view .LVU1174
+	.loc 1 182 734 discriminator 10 view .LVU1175
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp303
+	leaq	.LC16(%rip), %rdx	#, tmp304
+	movl	$182, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp305
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL378:
+.L178:
+	.loc 1 182 234 view .LVU1176
+	.loc 1 182 478 view .LVU1177
+	.loc 1 182 197 view .LVU1178
+.LBE149:
+	.loc 1 182 108 view .LVU1179
+.LBE151:
+	.loc 1 182 12 view .LVU1180
+	.loc 1 183 9 view .LVU1181
+.LBB152:
+	.loc 1 183 14 view .LVU1182
+# Lib/munit_test/test_protocols/test_collection.c:183:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 183 39 is_stmt 0 view .LVU1183
+	movq	-296(%rbp), %rsi	# items[1],
+	movq	%r13, %rdi	# self,
+.LVL379:
+	.loc 1 183 39 view .LVU1184
+	call	yp_contains@PLT	#
+.LVL380:
+	.loc 1 183 69 is_stmt 1 view .LVU1185
+	.loc 1 183 105 view .LVU1186
+.LBB153:
+	.loc 1 183 110 view .LVU1187
+# Lib/munit_test/test_protocols/test_collection.c:183:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 183 181 is_stmt 0 view .LVU1188
+	cmpq	%rax, %r14	# tmp385, _ypmt_OBJ_b
+	je	.L220	#,
+	movq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.120_87
+.L181:
+.LVL381:
+	.loc 1 183 194 is_stmt 1 discriminator 4 view .LVU1189
+	.loc 1 183 199 discriminator 4 view .LVU1190
+# Lib/munit_test/test_protocols/test_collection.c:183:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 183 202 is_stmt 0 discriminator 4 view .LVU1191
+	cmpq	%rdi, %r15	# iftmp.120_87, yp_True.108_28
+	je	.L182	#,
+	.loc 1 183 241 is_stmt 1 discriminator 6 view .LVU1192
+# Lib/munit_test/test_protocols/test_collection.c:183:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 183 244 is_stmt 0 discriminator 6 view .LVU1193
+	cmpq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.120_87
+	je	.L221	#,
+	.loc 1 183 475 is_stmt 1 discriminator 8 view .LVU1194
+	.loc 1 183 480 discriminator 8 view .LVU1195
+	.loc 1 183 485 discriminator 8 view .LVU1196
+# Lib/munit_test/test_protocols/test_collection.c:183:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 183 489 is_stmt 0 discriminator 8 view .LVU1197
+	call	yp_isexceptionC@PLT	#
+.LVL382:
+# Lib/munit_test/test_protocols/test_collection.c:183:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 183 488 discriminator 8 view .LVU1198
+	testl	%eax, %eax	# tmp386
+	je	.L184	#,
+	.loc 1 183 526 is_stmt 1 discriminator 9 view .LVU1199
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp310
+	leaq	.LC15(%rip), %rdx	#, tmp311
+	movl	$183, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp312
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL383:
+.L220:
+# Lib/munit_test/test_protocols/test_collection.c:183:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 183 181 is_stmt 0 view .LVU1200
+	movq	%r15, %rdi	# yp_True.108_28, iftmp.120_87
+	jmp	.L181	#
+.LVL384:
+.L221:
+	.loc 1 183 277 is_stmt 1 discriminator 7 view .LVU1201
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp307
+	leaq	.LC14(%rip), %rdx	#, tmp308
+	movl	$183, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp309
+.LVL385:
+	.loc 1 183 277 is_stmt 0 discriminator 7 view .LVU1202
+	movl	$0, %eax	#,
+.LVL386:
+	.loc 1 183 277 discriminator 7 view .LVU1203
+	call	munit_errorf_ex@PLT	#
+.LVL387:
+.L184:
+	.loc 1 183 483 is_stmt 1 discriminator 10 view .LVU1204
+	.loc 1 183 734 discriminator 10 view .LVU1205
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp313
+	leaq	.LC16(%rip), %rdx	#, tmp314
+	movl	$183, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp315
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL388:
+.L182:
+	.loc 1 183 234 view .LVU1206
+	.loc 1 183 478 view .LVU1207
+	.loc 1 183 197 view .LVU1208
+.LBE153:
+	.loc 1 183 108 view .LVU1209
+.LBE152:
+	.loc 1 183 12 view .LVU1210
+	.loc 1 184 9 view .LVU1211
+	movq	%r13, %rdi	# self,
+.LVL389:
+	.loc 1 184 9 is_stmt 0 view .LVU1212
+	call	yp_decref@PLT	#
+.LVL390:
+	.loc 1 184 9 view .LVU1213
+.LBE141:
+.LBB154:
+	.loc 1 189 9 is_stmt 1 view .LVU1214
+# Lib/munit_test/test_protocols/test_collection.c:189:         ypObject *self = type->newN(N(items[0], items[1], items[2], items[3], items[4], items[5],
+	.loc 1 189 30 is_stmt 0 view .LVU1215
+	movq	56(%r12), %r10	# type_93->newN, _41
+# Lib/munit_test/test_protocols/test_collection.c:189:         ypObject *self = type->newN(N(items[0], items[1], items[2], items[3], items[4], items[5],
+	.loc 1 189 26 view .LVU1216
+	subq	$8, %rsp	#,
+	pushq	-56(%rbp)	# items[31]
+	pushq	-64(%rbp)	# items[30]
+	pushq	-72(%rbp)	# items[29]
+	pushq	-80(%rbp)	# items[28]
+	pushq	-88(%rbp)	# items[27]
+	pushq	-96(%rbp)	# items[26]
+	pushq	-104(%rbp)	# items[25]
+	pushq	-112(%rbp)	# items[24]
+	pushq	-120(%rbp)	# items[23]
+	pushq	-128(%rbp)	# items[22]
+	pushq	-136(%rbp)	# items[21]
+	pushq	-144(%rbp)	# items[20]
+	pushq	-152(%rbp)	# items[19]
+	pushq	-160(%rbp)	# items[18]
+	pushq	-168(%rbp)	# items[17]
+	pushq	-176(%rbp)	# items[16]
+	pushq	-184(%rbp)	# items[15]
+	pushq	-192(%rbp)	# items[14]
+	pushq	-200(%rbp)	# items[13]
+	pushq	-208(%rbp)	# items[12]
+	pushq	-216(%rbp)	# items[11]
+	pushq	-224(%rbp)	# items[10]
+	pushq	-232(%rbp)	# items[9]
+	pushq	-240(%rbp)	# items[8]
+	pushq	-248(%rbp)	# items[7]
+	pushq	-256(%rbp)	# items[6]
+	pushq	-264(%rbp)	# items[5]
+	movq	-272(%rbp), %r9	# items[4],
+	movq	-280(%rbp), %r8	# items[3],
+	movq	-288(%rbp), %rcx	# items[2],
+	movq	-296(%rbp), %rdx	# items[1],
+	movq	-304(%rbp), %rsi	# items[0],
+	movl	$32, %edi	#,
+	movl	$0, %eax	#,
+	call	*%r10	# _41
+.LVL391:
+	movq	%rax, %r12	# tmp387, self
+.LVL392:
+	.loc 1 194 9 is_stmt 1 view .LVU1217
+.LBB155:
+	.loc 1 194 14 view .LVU1218
+# Lib/munit_test/test_protocols/test_collection.c:194:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 194 24 is_stmt 0 view .LVU1219
+	movq	$0, -312(%rbp)	#, MEM[(struct ypObject * *)_226]
+	.loc 1 194 10 is_stmt 1 view .LVU1220
+# Lib/munit_test/test_protocols/test_collection.c:194:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 194 11 is_stmt 0 view .LVU1221
+	addq	$224, %rsp	#,
+	leaq	-312(%rbp), %rsi	#, tmp321
+	movq	%rax, %rdi	# self,
+	call	yp_clear@PLT	#
+.LVL393:
+	.loc 1 194 34 is_stmt 1 view .LVU1222
+# Lib/munit_test/test_protocols/test_collection.c:194:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 194 42 is_stmt 0 view .LVU1223
+	movq	-312(%rbp), %rdi	# MEM[(struct ypObject * *)_226], exc.123_74
+# Lib/munit_test/test_protocols/test_collection.c:194:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 194 37 view .LVU1224
+	testq	%rdi, %rdi	# exc.123_74
+	je	.L185	#,
+	.loc 1 194 12 is_stmt 1 discriminator 1 view .LVU1225
+# Lib/munit_test/test_protocols/test_collection.c:194:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 194 16 is_stmt 0 discriminator 1 view .LVU1226
+	call	yp_isexceptionC@PLT	#
+.LVL394:
+# Lib/munit_test/test_protocols/test_collection.c:194:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 194 15 discriminator 1 view .LVU1227
+	testl	%eax, %eax	# tmp388
+	je	.L186	#,
+	.loc 1 194 40 is_stmt 1 discriminator 2 view .LVU1228
+	leaq	.LC42(%rip), %rcx	#, tmp322
+	leaq	.LC10(%rip), %rdx	#, tmp323
+	movl	$194, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp324
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL395:
+.L186:
+	.loc 1 194 192 discriminator 3 view .LVU1229
+	leaq	.LC42(%rip), %rcx	#, tmp325
+	leaq	.LC11(%rip), %rdx	#, tmp326
+	movl	$194, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp327
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL396:
+.L185:
+.LBE155:
+	.loc 1 194 12 view .LVU1230
+	.loc 1 195 9 view .LVU1231
+.LBB156:
+	.loc 1 195 14 view .LVU1232
+	.loc 1 195 48 view .LVU1233
+	.loc 1 195 85 view .LVU1234
+.LBB157:
+	.loc 1 195 90 view .LVU1235
+	.loc 1 195 119 view .LVU1236
+.LBB158:
+	.loc 1 195 124 view .LVU1237
+# Lib/munit_test/test_protocols/test_collection.c:195:         assert_len(self, 0);
+	.loc 1 195 134 is_stmt 0 view .LVU1238
+	movq	$0, -312(%rbp)	#, MEM[(struct ypObject * *)_226]
+	.loc 1 195 10 is_stmt 1 view .LVU1239
+# Lib/munit_test/test_protocols/test_collection.c:195:         assert_len(self, 0);
+	.loc 1 195 29 is_stmt 0 view .LVU1240
+	leaq	-312(%rbp), %rsi	#, tmp328
+	movq	%r12, %rdi	# self,
+	call	yp_lenC@PLT	#
+.LVL397:
+	movq	%rax, %r9	# tmp389, _ypmt_LEN_actual
+.LVL398:
+	.loc 1 195 59 is_stmt 1 view .LVU1241
+# Lib/munit_test/test_protocols/test_collection.c:195:         assert_len(self, 0);
+	.loc 1 195 67 is_stmt 0 view .LVU1242
+	movq	-312(%rbp), %rdi	# MEM[(struct ypObject * *)_226], exc.125_76
+# Lib/munit_test/test_protocols/test_collection.c:195:         assert_len(self, 0);
+	.loc 1 195 62 view .LVU1243
+	testq	%rdi, %rdi	# exc.125_76
+	je	.L187	#,
+	.loc 1 195 12 is_stmt 1 discriminator 1 view .LVU1244
+# Lib/munit_test/test_protocols/test_collection.c:195:         assert_len(self, 0);
+	.loc 1 195 16 is_stmt 0 discriminator 1 view .LVU1245
+	call	yp_isexceptionC@PLT	#
+.LVL399:
+# Lib/munit_test/test_protocols/test_collection.c:195:         assert_len(self, 0);
+	.loc 1 195 15 discriminator 1 view .LVU1246
+	testl	%eax, %eax	# tmp390
+	je	.L188	#,
+	.loc 1 195 40 is_stmt 1 discriminator 3 view .LVU1247
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp329
+	leaq	.LC7(%rip), %rdx	#, tmp330
+	movl	$195, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp331
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL400:
+.L188:
+	.loc 1 195 211 discriminator 4 view .LVU1248
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp332
+	leaq	.LC8(%rip), %rdx	#, tmp333
+	movl	$195, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp334
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL401:
+.L187:
+	.loc 1 195 211 is_stmt 0 discriminator 4 view .LVU1249
+.LBE158:
+	.loc 1 195 122 is_stmt 1 discriminator 2 view .LVU1250
+	.loc 1 195 379 discriminator 2 view .LVU1251
+# Lib/munit_test/test_protocols/test_collection.c:195:         assert_len(self, 0);
+	.loc 1 195 382 is_stmt 0 discriminator 2 view .LVU1252
+	testq	%rax, %rax	# _ypmt_LEN_actual
+	jne	.L222	#,
+.LBE157:
+	.loc 1 195 88 is_stmt 1 discriminator 6 view .LVU1253
+.LBE156:
+	.loc 1 195 12 discriminator 6 view .LVU1254
+	.loc 1 196 9 discriminator 6 view .LVU1255
+.LBB160:
+	.loc 1 196 14 discriminator 6 view .LVU1256
+# Lib/munit_test/test_protocols/test_collection.c:196:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 196 39 is_stmt 0 discriminator 6 view .LVU1257
+	movq	-304(%rbp), %rsi	# items[0],
+	movq	%r12, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL402:
+	.loc 1 196 69 is_stmt 1 discriminator 6 view .LVU1258
+	.loc 1 196 105 discriminator 6 view .LVU1259
+.LBB161:
+	.loc 1 196 110 discriminator 6 view .LVU1260
+# Lib/munit_test/test_protocols/test_collection.c:196:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 196 181 is_stmt 0 discriminator 6 view .LVU1261
+	cmpq	%rax, %r14	# tmp391, _ypmt_OBJ_b
+	je	.L223	#,
+# Lib/munit_test/test_protocols/test_collection.c:196:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 196 181 view .LVU1262
+	movq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.127_88
+.L190:
+.LVL403:
+	.loc 1 196 194 is_stmt 1 discriminator 4 view .LVU1263
+	.loc 1 196 199 discriminator 4 view .LVU1264
+# Lib/munit_test/test_protocols/test_collection.c:196:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 196 202 is_stmt 0 discriminator 4 view .LVU1265
+	cmpq	%rdi, %r15	# iftmp.127_88, yp_True.108_28
+	je	.L191	#,
+	.loc 1 196 241 is_stmt 1 discriminator 6 view .LVU1266
+# Lib/munit_test/test_protocols/test_collection.c:196:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 196 244 is_stmt 0 discriminator 6 view .LVU1267
+	cmpq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.127_88
+	je	.L224	#,
+	.loc 1 196 475 is_stmt 1 discriminator 8 view .LVU1268
+	.loc 1 196 480 discriminator 8 view .LVU1269
+	.loc 1 196 485 discriminator 8 view .LVU1270
+# Lib/munit_test/test_protocols/test_collection.c:196:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 196 489 is_stmt 0 discriminator 8 view .LVU1271
+	call	yp_isexceptionC@PLT	#
+.LVL404:
+# Lib/munit_test/test_protocols/test_collection.c:196:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 196 488 discriminator 8 view .LVU1272
+	testl	%eax, %eax	# tmp392
+	je	.L193	#,
+	.loc 1 196 526 is_stmt 1 discriminator 9 view .LVU1273
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp342
+	leaq	.LC15(%rip), %rdx	#, tmp343
+	movl	$196, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp344
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL405:
+.L222:
+	.loc 1 196 526 is_stmt 0 discriminator 9 view .LVU1274
+.LBE161:
+.LBE160:
+.LBB163:
+.LBB159:
+	.loc 1 195 425 is_stmt 1 discriminator 5 view .LVU1275
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC37(%rip), %r8	#,
+	leaq	.LC6(%rip), %rcx	#, tmp335
+	leaq	.LC9(%rip), %rdx	#, tmp336
+	movl	$195, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp337
+	movl	$0, %eax	#,
+.LVL406:
+	.loc 1 195 425 is_stmt 0 discriminator 5 view .LVU1276
+	call	munit_errorf_ex@PLT	#
+.LVL407:
+.L223:
+	.loc 1 195 425 discriminator 5 view .LVU1277
+.LBE159:
+.LBE163:
+.LBB164:
+.LBB162:
+# Lib/munit_test/test_protocols/test_collection.c:196:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 196 181 view .LVU1278
+	movq	%r15, %rdi	# yp_True.108_28, iftmp.127_88
+	jmp	.L190	#
+.LVL408:
+.L224:
+	.loc 1 196 277 is_stmt 1 discriminator 7 view .LVU1279
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp339
+	leaq	.LC14(%rip), %rdx	#, tmp340
+	movl	$196, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp341
+.LVL409:
+	.loc 1 196 277 is_stmt 0 discriminator 7 view .LVU1280
+	movl	$0, %eax	#,
+.LVL410:
+	.loc 1 196 277 discriminator 7 view .LVU1281
+	call	munit_errorf_ex@PLT	#
+.LVL411:
+.L193:
+	.loc 1 196 483 is_stmt 1 discriminator 10 view .LVU1282
+	.loc 1 196 734 discriminator 10 view .LVU1283
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp345
+	leaq	.LC16(%rip), %rdx	#, tmp346
+	movl	$196, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp347
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL412:
+.L191:
+	.loc 1 196 234 view .LVU1284
+	.loc 1 196 478 view .LVU1285
+	.loc 1 196 197 view .LVU1286
+.LBE162:
+	.loc 1 196 108 view .LVU1287
+.LBE164:
+	.loc 1 196 12 view .LVU1288
+	.loc 1 197 9 view .LVU1289
+.LBB165:
+	.loc 1 197 14 view .LVU1290
+# Lib/munit_test/test_protocols/test_collection.c:197:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 197 39 is_stmt 0 view .LVU1291
+	movq	-296(%rbp), %rsi	# items[1],
+	movq	%r12, %rdi	# self,
+.LVL413:
+	.loc 1 197 39 view .LVU1292
+	call	yp_contains@PLT	#
+.LVL414:
+	.loc 1 197 69 is_stmt 1 view .LVU1293
+	.loc 1 197 105 view .LVU1294
+.LBB166:
+	.loc 1 197 110 view .LVU1295
+# Lib/munit_test/test_protocols/test_collection.c:197:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 197 181 is_stmt 0 view .LVU1296
+	cmpq	%rax, %r14	# tmp393, _ypmt_OBJ_b
+	je	.L225	#,
+	movq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.130_89
+.L194:
+.LVL415:
+	.loc 1 197 194 is_stmt 1 discriminator 4 view .LVU1297
+	.loc 1 197 199 discriminator 4 view .LVU1298
+# Lib/munit_test/test_protocols/test_collection.c:197:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 197 202 is_stmt 0 discriminator 4 view .LVU1299
+	cmpq	%rdi, %r15	# iftmp.130_89, yp_True.108_28
+	je	.L195	#,
+	.loc 1 197 241 is_stmt 1 discriminator 6 view .LVU1300
+# Lib/munit_test/test_protocols/test_collection.c:197:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 197 244 is_stmt 0 discriminator 6 view .LVU1301
+	cmpq	%r14, %rdi	# _ypmt_OBJ_b, iftmp.130_89
+	je	.L226	#,
+	.loc 1 197 475 is_stmt 1 discriminator 8 view .LVU1302
+	.loc 1 197 480 discriminator 8 view .LVU1303
+	.loc 1 197 485 discriminator 8 view .LVU1304
+# Lib/munit_test/test_protocols/test_collection.c:197:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 197 489 is_stmt 0 discriminator 8 view .LVU1305
+	call	yp_isexceptionC@PLT	#
+.LVL416:
+# Lib/munit_test/test_protocols/test_collection.c:197:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 197 488 discriminator 8 view .LVU1306
+	testl	%eax, %eax	# tmp394
+	je	.L197	#,
+	.loc 1 197 526 is_stmt 1 discriminator 9 view .LVU1307
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp352
+	leaq	.LC15(%rip), %rdx	#, tmp353
+	movl	$197, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp354
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL417:
+.L225:
+# Lib/munit_test/test_protocols/test_collection.c:197:         assert_obj(yp_contains(self, items[1]), is, yp_False);
+	.loc 1 197 181 is_stmt 0 view .LVU1308
+	movq	%r15, %rdi	# yp_True.108_28, iftmp.130_89
+	jmp	.L194	#
+.LVL418:
+.L226:
+	.loc 1 197 277 is_stmt 1 discriminator 7 view .LVU1309
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp349
+	leaq	.LC14(%rip), %rdx	#, tmp350
+	movl	$197, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp351
+.LVL419:
+	.loc 1 197 277 is_stmt 0 discriminator 7 view .LVU1310
+	movl	$0, %eax	#,
+.LVL420:
+	.loc 1 197 277 discriminator 7 view .LVU1311
+	call	munit_errorf_ex@PLT	#
+.LVL421:
+.L197:
+	.loc 1 197 483 is_stmt 1 discriminator 10 view .LVU1312
+	.loc 1 197 734 discriminator 10 view .LVU1313
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp355
+	leaq	.LC16(%rip), %rdx	#, tmp356
+	movl	$197, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp357
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL422:
+.L195:
+	.loc 1 197 234 view .LVU1314
+	.loc 1 197 478 view .LVU1315
+	.loc 1 197 197 view .LVU1316
+.LBE166:
+	.loc 1 197 108 view .LVU1317
+.LBE165:
+	.loc 1 197 12 view .LVU1318
+	.loc 1 198 9 view .LVU1319
+	movq	%r12, %rdi	# self,
+.LVL423:
+	.loc 1 198 9 is_stmt 0 view .LVU1320
+	call	yp_decref@PLT	#
+.LVL424:
+	.loc 1 198 9 view .LVU1321
+	jmp	.L158	#
+.LBE154:
+	.cfi_endproc
+.LFE25:
+	.size	test_clear, .-test_clear
+	.section	.rodata.str1.1
+.LC44:
+	.string	"yp_SyntaxError"
+.LC45:
+	.string	"out[i]"
+	.section	.rodata.str1.8
+	.align 8
+.LC46:
+	.string	"assertion failed: yp_isexceptionC(%s) (expected %s)"
+	.align 8
+.LC47:
+	.string	"assertion failed: yp_isexceptionCN(%s, N(%s))"
+	.section	.rodata.str1.1
+.LC48:
+	.string	"yp_contains(self, keys[i])"
+	.section	.rodata.str1.8
+	.align 8
+.LC49:
+	.string	"i % 4 == 2 ? yp_False : yp_True"
+	.section	.rodata.str1.1
+.LC50:
+	.string	"((void *)0)"
+.LC51:
+	.string	"=="
+.LC52:
+	.string	"out[0]"
+	.section	.rodata.str1.8
+	.align 8
+.LC53:
+	.string	"assertion failed: %s %s %s (%p %s %p)"
+	.text
+	.type	test_contains_manyC, @function
+test_contains_manyC:
+.LVL425:
+.LFB24:
+	.loc 1 93 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 93 1 is_stmt 0 view .LVU1323
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$712, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 94 5 is_stmt 1 view .LVU1324
+# Lib/munit_test/test_protocols/test_collection.c:94:     fixture_type_t *type = fixture->type;
+	.loc 1 94 21 is_stmt 0 view .LVU1325
+	movq	(%rsi), %rbx	# fixture_42(D)->type, type
+.LVL426:
+	.loc 1 95 5 is_stmt 1 view .LVU1326
+# Lib/munit_test/test_protocols/test_collection.c:95:     uniqueness_t   *uq = uniqueness_new();
+	.loc 1 95 24 is_stmt 0 view .LVU1327
+	call	uniqueness_new@PLT	#
+.LVL427:
+	.loc 1 95 24 view .LVU1328
+	movq	%rax, %r14	# tmp221, uq
+.LVL428:
+	.loc 1 96 5 is_stmt 1 view .LVU1329
+	.loc 1 97 5 view .LVU1330
+	.loc 1 98 5 view .LVU1331
+	.loc 1 99 5 view .LVU1332
+	.loc 1 100 5 view .LVU1333
+	.loc 1 101 5 view .LVU1334
+	.loc 1 102 5 view .LVU1335
+# Lib/munit_test/test_protocols/test_collection.c:102:     obj_array_fill(items, uq, type->rand_items);
+	.loc 1 102 10 is_stmt 0 view .LVU1336
+	leaq	-80(%rbp), %rdx	#, tmp132
+	movl	$3, %esi	#,
+	movq	%rax, %rdi	# uq,
+	call	*64(%rbx)	# type_43->rand_items
+.LVL429:
+	.loc 1 103 5 is_stmt 1 view .LVU1337
+# Lib/munit_test/test_protocols/test_collection.c:103:     self = type->newN(N(items[0], items[1]));
+	.loc 1 103 12 is_stmt 0 view .LVU1338
+	movq	-72(%rbp), %rdx	# items[1],
+	movq	-80(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%rbx)	# type_43->newN
+.LVL430:
+	movq	%rax, %r13	# tmp222, self
+.LVL431:
+	.loc 1 104 5 is_stmt 1 view .LVU1339
+# Lib/munit_test/test_protocols/test_collection.c:104:     empty = type->newN(0);
+	.loc 1 104 13 is_stmt 0 view .LVU1340
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+.LVL432:
+	.loc 1 104 13 view .LVU1341
+	call	*56(%rbx)	# type_43->newN
+.LVL433:
+	movq	%rax, -744(%rbp)	# tmp223, %sfp
+.LVL434:
+	.loc 1 107 5 is_stmt 1 view .LVU1342
+# Lib/munit_test/test_protocols/test_collection.c:107:     for (i = 0; i < yp_lengthof_array(keys); i++) {
+	.loc 1 107 12 is_stmt 0 view .LVU1343
+	movl	$0, %edi	#, i
+# Lib/munit_test/test_protocols/test_collection.c:107:     for (i = 0; i < yp_lengthof_array(keys); i++) {
+	.loc 1 107 5 view .LVU1344
+	jmp	.L228	#
+.LVL435:
+.L229:
+# Lib/munit_test/test_protocols/test_collection.c:108:         keys[i] = i % 4 == 3 ? yp_SyntaxError : items[i % 4];
+	.loc 1 108 47 discriminator 2 view .LVU1345
+	movq	yp_SyntaxError(%rip), %rax	# yp_SyntaxError, iftmp.133_30
+.L230:
+# Lib/munit_test/test_protocols/test_collection.c:108:         keys[i] = i % 4 == 3 ? yp_SyntaxError : items[i % 4];
+	.loc 1 108 17 discriminator 4 view .LVU1346
+	movq	%rax, -400(%rbp,%rdi,8)	# iftmp.133_30, keys[i_26]
+	.loc 1 107 86 is_stmt 1 discriminator 4 view .LVU1347
+	movl	$1, %esi	#,
+	call	__addvdi3@PLT	#
+.LVL436:
+	.loc 1 107 86 is_stmt 0 discriminator 4 view .LVU1348
+	movq	%rax, %rdi	# tmp224, i
+.LVL437:
+.L228:
+	.loc 1 107 19 is_stmt 1 discriminator 2 view .LVU1349
+	cmpq	$39, %rdi	#, i
+	jg	.L265	#,
+	.loc 1 108 9 view .LVU1350
+# Lib/munit_test/test_protocols/test_collection.c:108:         keys[i] = i % 4 == 3 ? yp_SyntaxError : items[i % 4];
+	.loc 1 108 21 is_stmt 0 view .LVU1351
+	movq	%rdi, %rdx	# i, tmp136
+	sarq	$63, %rdx	#, tmp136
+	shrq	$62, %rdx	#, tmp137
+	leaq	(%rdi,%rdx), %rax	#, tmp138
+	andl	$3, %eax	#, tmp139
+	subq	%rdx, %rax	# tmp137, tmp140
+# Lib/munit_test/test_protocols/test_collection.c:108:         keys[i] = i % 4 == 3 ? yp_SyntaxError : items[i % 4];
+	.loc 1 108 47 view .LVU1352
+	cmpq	$3, %rax	#, tmp140
+	je	.L229	#,
+# Lib/munit_test/test_protocols/test_collection.c:108:         keys[i] = i % 4 == 3 ? yp_SyntaxError : items[i % 4];
+	.loc 1 108 47 discriminator 1 view .LVU1353
+	movq	-80(%rbp,%rax,8), %rax	# items[_6], iftmp.133_30
+	jmp	.L230	#
+.L265:
+	.loc 1 112 5 is_stmt 1 view .LVU1354
+	leaq	-720(%rbp), %rcx	#, tmp142
+	leaq	-400(%rbp), %rdx	#, tmp143
+	movl	$40, %esi	#,
+	movq	%r13, %rdi	# self,
+.LVL438:
+	.loc 1 112 5 is_stmt 0 view .LVU1355
+	call	yp_contains_manyC@PLT	#
+.LVL439:
+	.loc 1 113 5 is_stmt 1 view .LVU1356
+# Lib/munit_test/test_protocols/test_collection.c:113:     for (i = 0; i < yp_lengthof_array(keys); i++) {
+	.loc 1 113 12 is_stmt 0 view .LVU1357
+	movl	$0, %ebx	#, i
+.LVL440:
+# Lib/munit_test/test_protocols/test_collection.c:113:     for (i = 0; i < yp_lengthof_array(keys); i++) {
+	.loc 1 113 5 view .LVU1358
+	jmp	.L232	#
+.LVL441:
+.L270:
+	.loc 1 115 13 is_stmt 1 view .LVU1359
+.LBB167:
+	.loc 1 115 18 view .LVU1360
+# Lib/munit_test/test_protocols/test_collection.c:115:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 115 28 is_stmt 0 view .LVU1361
+	movq	-720(%rbp,%rbx,8), %r12	# out[i_27], _ypmt_ISEXC_obj
+.LVL442:
+	.loc 1 115 56 is_stmt 1 view .LVU1362
+# Lib/munit_test/test_protocols/test_collection.c:115:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 115 66 is_stmt 0 view .LVU1363
+	movq	yp_SyntaxError(%rip), %rax	# yp_SyntaxError, yp_SyntaxError
+	movq	%rax, -728(%rbp)	# yp_SyntaxError, MEM[(struct ypObject *[1] *)_117][0]
+	.loc 1 115 109 is_stmt 1 view .LVU1364
+.LVL443:
+	.loc 1 115 232 view .LVU1365
+	.loc 1 115 237 view .LVU1366
+	.loc 1 115 386 view .LVU1367
+# Lib/munit_test/test_protocols/test_collection.c:115:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 115 391 is_stmt 0 view .LVU1368
+	movq	%r12, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexceptionC@PLT	#
+.LVL444:
+# Lib/munit_test/test_protocols/test_collection.c:115:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 115 389 view .LVU1369
+	testl	%eax, %eax	# tmp225
+	je	.L266	#,
+	.loc 1 115 597 is_stmt 1 discriminator 4 view .LVU1370
+# Lib/munit_test/test_protocols/test_collection.c:115:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 115 602 is_stmt 0 discriminator 4 view .LVU1371
+	leaq	-728(%rbp), %rdx	#, tmp153
+	movl	$1, %esi	#,
+	movq	%r12, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexception_arrayC@PLT	#
+.LVL445:
+# Lib/munit_test/test_protocols/test_collection.c:115:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 115 600 discriminator 4 view .LVU1372
+	testl	%eax, %eax	# tmp226
+	jne	.L236	#,
+	.loc 1 115 681 is_stmt 1 discriminator 5 view .LVU1373
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp154
+	leaq	.LC47(%rip), %rdx	#, tmp155
+	movl	$115, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp156
+	call	munit_errorf_ex@PLT	#
+.LVL446:
+.L266:
+	.loc 1 115 427 discriminator 3 view .LVU1374
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp150
+	leaq	.LC46(%rip), %rdx	#, tmp151
+	movl	$115, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp152
+	call	munit_errorf_ex@PLT	#
+.LVL447:
+.L271:
+	.loc 1 115 427 is_stmt 0 discriminator 3 view .LVU1375
+.LBE167:
+.LBB168:
+.LBB169:
+# Lib/munit_test/test_protocols/test_collection.c:117:             assert_obj(out[i], is, yp_contains(self, keys[i]));
+	.loc 1 117 182 discriminator 1 view .LVU1376
+	movq	yp_True(%rip), %rdi	# yp_True, iftmp.135_31
+	jmp	.L238	#
+.LVL448:
+.L272:
+	.loc 1 117 242 is_stmt 1 discriminator 6 view .LVU1377
+# Lib/munit_test/test_protocols/test_collection.c:117:             assert_obj(out[i], is, yp_contains(self, keys[i]));
+	.loc 1 117 245 is_stmt 0 discriminator 6 view .LVU1378
+	cmpq	%rdi, yp_False(%rip)	# iftmp.135_31, yp_False
+	je	.L267	#,
+	.loc 1 117 473 is_stmt 1 discriminator 8 view .LVU1379
+	.loc 1 117 478 discriminator 8 view .LVU1380
+	.loc 1 117 483 discriminator 8 view .LVU1381
+# Lib/munit_test/test_protocols/test_collection.c:117:             assert_obj(out[i], is, yp_contains(self, keys[i]));
+	.loc 1 117 487 is_stmt 0 discriminator 8 view .LVU1382
+	call	yp_isexceptionC@PLT	#
+.LVL449:
+# Lib/munit_test/test_protocols/test_collection.c:117:             assert_obj(out[i], is, yp_contains(self, keys[i]));
+	.loc 1 117 486 discriminator 8 view .LVU1383
+	testl	%eax, %eax	# tmp228
+	je	.L241	#,
+	.loc 1 117 524 is_stmt 1 discriminator 9 view .LVU1384
+	leaq	.LC48(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp161
+	leaq	.LC15(%rip), %rdx	#, tmp162
+	movl	$117, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp163
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL450:
+.L267:
+	.loc 1 117 278 discriminator 7 view .LVU1385
+	leaq	.LC48(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp158
+	leaq	.LC14(%rip), %rdx	#, tmp159
+	movl	$117, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp160
+.LVL451:
+	.loc 1 117 278 is_stmt 0 discriminator 7 view .LVU1386
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL452:
+.L241:
+	.loc 1 117 481 is_stmt 1 discriminator 10 view .LVU1387
+	.loc 1 117 729 discriminator 10 view .LVU1388
+	leaq	.LC48(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp164
+	leaq	.LC16(%rip), %rdx	#, tmp165
+	movl	$117, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp166
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL453:
+.L273:
+	.loc 1 117 729 is_stmt 0 discriminator 10 view .LVU1389
+.LBE169:
+.LBE168:
+.LBB171:
+# Lib/munit_test/test_protocols/test_collection.c:118:             assert_obj(out[i], is, i % 4 == 2 ? yp_False : yp_True);
+	.loc 1 118 99 discriminator 1 view .LVU1390
+	movq	yp_False(%rip), %rcx	# yp_False, iftmp.138_32
+.L242:
+.LVL454:
+	.loc 1 118 111 is_stmt 1 discriminator 4 view .LVU1391
+.LBB172:
+	.loc 1 118 116 discriminator 4 view .LVU1392
+# Lib/munit_test/test_protocols/test_collection.c:118:             assert_obj(out[i], is, i % 4 == 2 ? yp_False : yp_True);
+	.loc 1 118 187 is_stmt 0 discriminator 4 view .LVU1393
+	cmpq	%rdx, %rcx	# _ypmt_OBJ_a, iftmp.138_32
+	je	.L262	#,
+# Lib/munit_test/test_protocols/test_collection.c:118:             assert_obj(out[i], is, i % 4 == 2 ? yp_False : yp_True);
+	.loc 1 118 187 discriminator 6 view .LVU1394
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.139_33
+.LVL455:
+.L243:
+	.loc 1 118 200 is_stmt 1 discriminator 8 view .LVU1395
+	.loc 1 118 205 discriminator 8 view .LVU1396
+# Lib/munit_test/test_protocols/test_collection.c:118:             assert_obj(out[i], is, i % 4 == 2 ? yp_False : yp_True);
+	.loc 1 118 208 is_stmt 0 discriminator 8 view .LVU1397
+	cmpq	%rdi, %rax	# iftmp.139_33, yp_True.136_12
+	jne	.L268	#,
+.LVL456:
+.L236:
+	.loc 1 118 486 is_stmt 1 discriminator 2 view .LVU1398
+	.loc 1 118 203 discriminator 2 view .LVU1399
+.LBE172:
+	.loc 1 118 114 discriminator 2 view .LVU1400
+.LBE171:
+	.loc 1 118 16 discriminator 2 view .LVU1401
+	.loc 1 113 86 discriminator 2 view .LVU1402
+	movl	$1, %esi	#,
+	movq	%rbx, %rdi	# i,
+	call	__addvdi3@PLT	#
+.LVL457:
+	movq	%rax, %rbx	# tmp230, i
+.LVL458:
+.L232:
+	.loc 1 113 19 discriminator 1 view .LVU1403
+	cmpq	$39, %rbx	#, i
+	jg	.L269	#,
+	.loc 1 114 9 view .LVU1404
+# Lib/munit_test/test_protocols/test_collection.c:114:         if (i % 4 == 3) {
+	.loc 1 114 15 is_stmt 0 view .LVU1405
+	movq	%rbx, %rax	# i, tmp144
+	sarq	$63, %rax	#, tmp144
+	shrq	$62, %rax	#, tmp145
+	leaq	(%rbx,%rax), %r12	#, tmp146
+	andl	$3, %r12d	#, tmp147
+	subq	%rax, %r12	# tmp145, tmp148
+# Lib/munit_test/test_protocols/test_collection.c:114:         if (i % 4 == 3) {
+	.loc 1 114 12 view .LVU1406
+	cmpq	$3, %r12	#, tmp148
+	je	.L270	#,
+	.loc 1 117 13 is_stmt 1 view .LVU1407
+.LBB174:
+	.loc 1 117 18 view .LVU1408
+# Lib/munit_test/test_protocols/test_collection.c:117:             assert_obj(out[i], is, yp_contains(self, keys[i]));
+	.loc 1 117 28 is_stmt 0 view .LVU1409
+	movq	-720(%rbp,%rbx,8), %r15	# out[i_27], _ypmt_OBJ_a
+.LVL459:
+	.loc 1 117 52 is_stmt 1 view .LVU1410
+# Lib/munit_test/test_protocols/test_collection.c:117:             assert_obj(out[i], is, yp_contains(self, keys[i]));
+	.loc 1 117 77 is_stmt 0 view .LVU1411
+	movq	-400(%rbp,%rbx,8), %rsi	# keys[i_27], keys[i_27]
+	movq	%r13, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL460:
+	.loc 1 117 106 is_stmt 1 view .LVU1412
+.LBB170:
+	.loc 1 117 111 view .LVU1413
+# Lib/munit_test/test_protocols/test_collection.c:117:             assert_obj(out[i], is, yp_contains(self, keys[i]));
+	.loc 1 117 182 is_stmt 0 view .LVU1414
+	cmpq	%rax, %r15	# tmp227, _ypmt_OBJ_a
+	je	.L271	#,
+# Lib/munit_test/test_protocols/test_collection.c:117:             assert_obj(out[i], is, yp_contains(self, keys[i]));
+	.loc 1 117 182 discriminator 2 view .LVU1415
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.135_31
+.L238:
+.LVL461:
+	.loc 1 117 195 is_stmt 1 discriminator 4 view .LVU1416
+	.loc 1 117 200 discriminator 4 view .LVU1417
+# Lib/munit_test/test_protocols/test_collection.c:117:             assert_obj(out[i], is, yp_contains(self, keys[i]));
+	.loc 1 117 221 is_stmt 0 discriminator 4 view .LVU1418
+	movq	yp_True(%rip), %rax	# yp_True, yp_True.136_12
+.LVL462:
+# Lib/munit_test/test_protocols/test_collection.c:117:             assert_obj(out[i], is, yp_contains(self, keys[i]));
+	.loc 1 117 203 discriminator 4 view .LVU1419
+	cmpq	%rdi, %rax	# iftmp.135_31, yp_True.136_12
+	jne	.L272	#,
+	.loc 1 117 235 is_stmt 1 view .LVU1420
+	.loc 1 117 476 view .LVU1421
+	.loc 1 117 198 view .LVU1422
+.LBE170:
+	.loc 1 117 109 view .LVU1423
+.LBE174:
+	.loc 1 117 16 view .LVU1424
+	.loc 1 118 13 view .LVU1425
+.LBB175:
+	.loc 1 118 18 view .LVU1426
+# Lib/munit_test/test_protocols/test_collection.c:118:             assert_obj(out[i], is, i % 4 == 2 ? yp_False : yp_True);
+	.loc 1 118 28 is_stmt 0 view .LVU1427
+	movq	-720(%rbp,%rbx,8), %rdx	# out[i_27], _ypmt_OBJ_a
+.LVL463:
+	.loc 1 118 52 is_stmt 1 view .LVU1428
+# Lib/munit_test/test_protocols/test_collection.c:118:             assert_obj(out[i], is, i % 4 == 2 ? yp_False : yp_True);
+	.loc 1 118 99 is_stmt 0 view .LVU1429
+	cmpq	$2, %r12	#, tmp148
+	je	.L273	#,
+	movq	%rax, %rcx	# yp_True.136_12, iftmp.138_32
+	jmp	.L242	#
+.LVL464:
+.L262:
+.LBB173:
+# Lib/munit_test/test_protocols/test_collection.c:118:             assert_obj(out[i], is, i % 4 == 2 ? yp_False : yp_True);
+	.loc 1 118 187 view .LVU1430
+	movq	%rax, %rdi	# yp_True.136_12, iftmp.139_33
+.LVL465:
+	.loc 1 118 187 view .LVU1431
+	jmp	.L243	#
+.LVL466:
+.L268:
+	.loc 1 118 247 is_stmt 1 discriminator 10 view .LVU1432
+# Lib/munit_test/test_protocols/test_collection.c:118:             assert_obj(out[i], is, i % 4 == 2 ? yp_False : yp_True);
+	.loc 1 118 250 is_stmt 0 discriminator 10 view .LVU1433
+	cmpq	%rdi, yp_False(%rip)	# iftmp.139_33, yp_False
+	je	.L274	#,
+	.loc 1 118 483 is_stmt 1 discriminator 12 view .LVU1434
+	.loc 1 118 488 discriminator 12 view .LVU1435
+	.loc 1 118 493 discriminator 12 view .LVU1436
+# Lib/munit_test/test_protocols/test_collection.c:118:             assert_obj(out[i], is, i % 4 == 2 ? yp_False : yp_True);
+	.loc 1 118 497 is_stmt 0 discriminator 12 view .LVU1437
+	call	yp_isexceptionC@PLT	#
+.LVL467:
+# Lib/munit_test/test_protocols/test_collection.c:118:             assert_obj(out[i], is, i % 4 == 2 ? yp_False : yp_True);
+	.loc 1 118 496 discriminator 12 view .LVU1438
+	testl	%eax, %eax	# tmp229
+	je	.L245	#,
+	.loc 1 118 534 is_stmt 1 discriminator 13 view .LVU1439
+	leaq	.LC49(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp170
+	leaq	.LC15(%rip), %rdx	#, tmp171
+	movl	$118, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp172
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL468:
+.L274:
+	.loc 1 118 283 discriminator 11 view .LVU1440
+	leaq	.LC49(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp167
+.LVL469:
+	.loc 1 118 283 is_stmt 0 discriminator 11 view .LVU1441
+	leaq	.LC14(%rip), %rdx	#, tmp168
+.LVL470:
+	.loc 1 118 283 discriminator 11 view .LVU1442
+	movl	$118, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp169
+.LVL471:
+	.loc 1 118 283 discriminator 11 view .LVU1443
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL472:
+.L245:
+	.loc 1 118 491 is_stmt 1 discriminator 14 view .LVU1444
+	.loc 1 118 744 discriminator 14 view .LVU1445
+	leaq	.LC49(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp173
+	leaq	.LC16(%rip), %rdx	#, tmp174
+	movl	$118, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp175
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL473:
+.L269:
+	.loc 1 118 744 is_stmt 0 discriminator 14 view .LVU1446
+.LBE173:
+.LBE175:
+	.loc 1 123 5 is_stmt 1 view .LVU1447
+	leaq	-720(%rbp), %rcx	#, tmp177
+	leaq	-400(%rbp), %rdx	#, tmp178
+	movl	$40, %esi	#,
+	movq	-744(%rbp), %rdi	# %sfp,
+	call	yp_contains_manyC@PLT	#
+.LVL474:
+	.loc 1 124 5 view .LVU1448
+# Lib/munit_test/test_protocols/test_collection.c:124:     for (i = 0; i < yp_lengthof_array(keys); i++) {
+	.loc 1 124 12 is_stmt 0 view .LVU1449
+	movl	$0, %ebx	#, i
+# Lib/munit_test/test_protocols/test_collection.c:124:     for (i = 0; i < yp_lengthof_array(keys); i++) {
+	.loc 1 124 5 view .LVU1450
+	jmp	.L247	#
+.LVL475:
+.L278:
+	.loc 1 126 13 is_stmt 1 view .LVU1451
+.LBB176:
+	.loc 1 126 18 view .LVU1452
+# Lib/munit_test/test_protocols/test_collection.c:126:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 126 28 is_stmt 0 view .LVU1453
+	movq	-720(%rbp,%rbx,8), %r12	# out[i_28], _ypmt_ISEXC_obj
+.LVL476:
+	.loc 1 126 56 is_stmt 1 view .LVU1454
+# Lib/munit_test/test_protocols/test_collection.c:126:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 126 66 is_stmt 0 view .LVU1455
+	movq	yp_SyntaxError(%rip), %rax	# yp_SyntaxError, yp_SyntaxError
+	movq	%rax, -728(%rbp)	# yp_SyntaxError, MEM[(struct ypObject *[1] *)_117][0]
+	.loc 1 126 109 is_stmt 1 view .LVU1456
+.LVL477:
+	.loc 1 126 232 view .LVU1457
+	.loc 1 126 237 view .LVU1458
+	.loc 1 126 386 view .LVU1459
+# Lib/munit_test/test_protocols/test_collection.c:126:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 126 391 is_stmt 0 view .LVU1460
+	movq	%r12, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexceptionC@PLT	#
+.LVL478:
+# Lib/munit_test/test_protocols/test_collection.c:126:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 126 389 view .LVU1461
+	testl	%eax, %eax	# tmp231
+	je	.L275	#,
+	.loc 1 126 597 is_stmt 1 discriminator 4 view .LVU1462
+# Lib/munit_test/test_protocols/test_collection.c:126:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 126 602 is_stmt 0 discriminator 4 view .LVU1463
+	leaq	-728(%rbp), %rdx	#, tmp188
+	movl	$1, %esi	#,
+	movq	%r12, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexception_arrayC@PLT	#
+.LVL479:
+# Lib/munit_test/test_protocols/test_collection.c:126:             assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 126 600 discriminator 4 view .LVU1464
+	testl	%eax, %eax	# tmp232
+	jne	.L251	#,
+	.loc 1 126 681 is_stmt 1 discriminator 5 view .LVU1465
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp189
+	leaq	.LC47(%rip), %rdx	#, tmp190
+	movl	$126, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp191
+	call	munit_errorf_ex@PLT	#
+.LVL480:
+.L275:
+	.loc 1 126 427 discriminator 3 view .LVU1466
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp185
+	leaq	.LC46(%rip), %rdx	#, tmp186
+	movl	$126, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp187
+	call	munit_errorf_ex@PLT	#
+.LVL481:
+.L279:
+	.loc 1 126 427 is_stmt 0 discriminator 3 view .LVU1467
+.LBE176:
+.LBB177:
+.LBB178:
+# Lib/munit_test/test_protocols/test_collection.c:128:             assert_obj(out[i], is, yp_False);
+	.loc 1 128 164 discriminator 1 view .LVU1468
+	movq	yp_True(%rip), %rdi	# yp_True, iftmp.143_34
+.L252:
+.LVL482:
+	.loc 1 128 177 is_stmt 1 discriminator 4 view .LVU1469
+	.loc 1 128 182 discriminator 4 view .LVU1470
+# Lib/munit_test/test_protocols/test_collection.c:128:             assert_obj(out[i], is, yp_False);
+	.loc 1 128 185 is_stmt 0 discriminator 4 view .LVU1471
+	cmpq	%rdi, yp_True(%rip)	# iftmp.143_34, yp_True
+	jne	.L276	#,
+.LVL483:
+.L251:
+	.loc 1 128 440 is_stmt 1 discriminator 2 view .LVU1472
+	.loc 1 128 180 discriminator 2 view .LVU1473
+.LBE178:
+	.loc 1 128 91 discriminator 2 view .LVU1474
+.LBE177:
+	.loc 1 128 16 discriminator 2 view .LVU1475
+	.loc 1 124 86 discriminator 2 view .LVU1476
+	movl	$1, %esi	#,
+	movq	%rbx, %rdi	# i,
+	call	__addvdi3@PLT	#
+.LVL484:
+	movq	%rax, %rbx	# tmp234, i
+.LVL485:
+.L247:
+	.loc 1 124 19 discriminator 1 view .LVU1477
+	cmpq	$39, %rbx	#, i
+	jg	.L277	#,
+	.loc 1 125 9 view .LVU1478
+# Lib/munit_test/test_protocols/test_collection.c:125:         if (i % 4 == 3) {
+	.loc 1 125 15 is_stmt 0 view .LVU1479
+	movq	%rbx, %rdx	# i, tmp179
+	sarq	$63, %rdx	#, tmp179
+	shrq	$62, %rdx	#, tmp180
+	leaq	(%rbx,%rdx), %rax	#, tmp181
+	andl	$3, %eax	#, tmp182
+	subq	%rdx, %rax	# tmp180, tmp183
+# Lib/munit_test/test_protocols/test_collection.c:125:         if (i % 4 == 3) {
+	.loc 1 125 12 view .LVU1480
+	cmpq	$3, %rax	#, tmp183
+	je	.L278	#,
+	.loc 1 128 13 is_stmt 1 view .LVU1481
+.LBB180:
+	.loc 1 128 18 view .LVU1482
+.LVL486:
+	.loc 1 128 52 view .LVU1483
+# Lib/munit_test/test_protocols/test_collection.c:128:             assert_obj(out[i], is, yp_False);
+	.loc 1 128 62 is_stmt 0 view .LVU1484
+	movq	yp_False(%rip), %rax	# yp_False, _ypmt_OBJ_b
+.LVL487:
+	.loc 1 128 88 is_stmt 1 view .LVU1485
+.LBB179:
+	.loc 1 128 93 view .LVU1486
+# Lib/munit_test/test_protocols/test_collection.c:128:             assert_obj(out[i], is, yp_False);
+	.loc 1 128 164 is_stmt 0 view .LVU1487
+	cmpq	%rax, -720(%rbp,%rbx,8)	# _ypmt_OBJ_b, out[i_28]
+	je	.L279	#,
+	movq	%rax, %rdi	# _ypmt_OBJ_b, iftmp.143_34
+	jmp	.L252	#
+.LVL488:
+.L276:
+	.loc 1 128 224 is_stmt 1 discriminator 6 view .LVU1488
+# Lib/munit_test/test_protocols/test_collection.c:128:             assert_obj(out[i], is, yp_False);
+	.loc 1 128 227 is_stmt 0 discriminator 6 view .LVU1489
+	cmpq	%rax, %rdi	# _ypmt_OBJ_b, iftmp.143_34
+	je	.L280	#,
+	.loc 1 128 437 is_stmt 1 discriminator 8 view .LVU1490
+	.loc 1 128 442 discriminator 8 view .LVU1491
+	.loc 1 128 447 discriminator 8 view .LVU1492
+# Lib/munit_test/test_protocols/test_collection.c:128:             assert_obj(out[i], is, yp_False);
+	.loc 1 128 451 is_stmt 0 discriminator 8 view .LVU1493
+	call	yp_isexceptionC@PLT	#
+.LVL489:
+# Lib/munit_test/test_protocols/test_collection.c:128:             assert_obj(out[i], is, yp_False);
+	.loc 1 128 450 discriminator 8 view .LVU1494
+	testl	%eax, %eax	# tmp233
+	je	.L254	#,
+	.loc 1 128 488 is_stmt 1 discriminator 9 view .LVU1495
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp195
+	leaq	.LC15(%rip), %rdx	#, tmp196
+	movl	$128, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp197
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL490:
+.L280:
+	.loc 1 128 260 discriminator 7 view .LVU1496
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp192
+	leaq	.LC14(%rip), %rdx	#, tmp193
+	movl	$128, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp194
+.LVL491:
+	.loc 1 128 260 is_stmt 0 discriminator 7 view .LVU1497
+	movl	$0, %eax	#,
+.LVL492:
+	.loc 1 128 260 discriminator 7 view .LVU1498
+	call	munit_errorf_ex@PLT	#
+.LVL493:
+.L254:
+	.loc 1 128 445 is_stmt 1 discriminator 10 view .LVU1499
+	.loc 1 128 675 discriminator 10 view .LVU1500
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp198
+	leaq	.LC16(%rip), %rdx	#, tmp199
+	movl	$128, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp200
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL494:
+.L277:
+	.loc 1 128 675 is_stmt 0 discriminator 10 view .LVU1501
+.LBE179:
+.LBE180:
+	.loc 1 133 5 is_stmt 1 view .LVU1502
+# Lib/munit_test/test_protocols/test_collection.c:133:     out[0] = NULL;
+	.loc 1 133 12 is_stmt 0 view .LVU1503
+	movq	$0, -720(%rbp)	#, out[0]
+	.loc 1 134 5 is_stmt 1 view .LVU1504
+	leaq	-720(%rbp), %rcx	#, tmp202
+	leaq	-400(%rbp), %rdx	#, tmp203
+	movl	$0, %esi	#,
+	movq	%r13, %rdi	# self,
+	call	yp_contains_manyC@PLT	#
+.LVL495:
+	.loc 1 135 5 view .LVU1505
+.LBB181:
+	.loc 1 135 10 view .LVU1506
+# Lib/munit_test/test_protocols/test_collection.c:135:     assert_ptr(out[0], ==, NULL);
+	.loc 1 135 22 is_stmt 0 view .LVU1507
+	movq	-720(%rbp), %rax	# out[0], munit_tmp_a_
+.LVL496:
+	.loc 1 135 47 is_stmt 1 view .LVU1508
+	.loc 1 135 7 view .LVU1509
+# Lib/munit_test/test_protocols/test_collection.c:135:     assert_ptr(out[0], ==, NULL);
+	.loc 1 135 10 is_stmt 0 view .LVU1510
+	testq	%rax, %rax	# munit_tmp_a_
+	jne	.L281	#,
+.LBE181:
+	.loc 1 135 8 is_stmt 1 discriminator 2 view .LVU1511
+	.loc 1 138 5 discriminator 2 view .LVU1512
+	movq	yp_SyntaxError(%rip), %r15	# yp_SyntaxError, yp_SyntaxError.146_23
+	leaq	-720(%rbp), %rcx	#, tmp208
+	leaq	-400(%rbp), %rdx	#, tmp209
+	movl	$40, %esi	#,
+	movq	%r15, %rdi	# yp_SyntaxError.146_23,
+	call	yp_contains_manyC@PLT	#
+.LVL497:
+	.loc 1 139 5 discriminator 2 view .LVU1513
+# Lib/munit_test/test_protocols/test_collection.c:139:     for (i = 0; i < yp_lengthof_array(keys); i++) {
+	.loc 1 139 12 is_stmt 0 discriminator 2 view .LVU1514
+	movl	$0, %ebx	#, i
+# Lib/munit_test/test_protocols/test_collection.c:139:     for (i = 0; i < yp_lengthof_array(keys); i++) {
+	.loc 1 139 5 discriminator 2 view .LVU1515
+	jmp	.L257	#
+.LVL498:
+.L281:
+.LBB182:
+	.loc 1 135 46 is_stmt 1 discriminator 1 view .LVU1516
+	subq	$8, %rsp	#,
+	pushq	$0	#
+	leaq	.LC51(%rip), %r8	#, tmp204
+	pushq	%r8	# tmp204
+	pushq	%rax	# munit_tmp_a_
+	leaq	.LC50(%rip), %r9	#,
+	leaq	.LC52(%rip), %rcx	#, tmp205
+	leaq	.LC53(%rip), %rdx	#, tmp206
+	movl	$135, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp207
+	movl	$0, %eax	#,
+.LVL499:
+	.loc 1 135 46 is_stmt 0 discriminator 1 view .LVU1517
+	call	munit_errorf_ex@PLT	#
+.LVL500:
+.L283:
+	.loc 1 135 46 discriminator 1 view .LVU1518
+.LBE182:
+.LBB183:
+	.loc 1 140 423 is_stmt 1 discriminator 3 view .LVU1519
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp210
+	leaq	.LC46(%rip), %rdx	#, tmp211
+	movl	$140, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp212
+	call	munit_errorf_ex@PLT	#
+.LVL501:
+.L259:
+	.loc 1 140 231 discriminator 6 view .LVU1520
+.LBE183:
+	.loc 1 140 12 discriminator 6 view .LVU1521
+	.loc 1 139 86 discriminator 6 view .LVU1522
+	movl	$1, %esi	#,
+	movq	%rbx, %rdi	# i,
+	call	__addvdi3@PLT	#
+.LVL502:
+	movq	%rax, %rbx	# tmp237, i
+.LVL503:
+.L257:
+	.loc 1 139 19 discriminator 2 view .LVU1523
+	cmpq	$39, %rbx	#, i
+	jg	.L282	#,
+	.loc 1 140 9 view .LVU1524
+.LBB184:
+	.loc 1 140 14 view .LVU1525
+# Lib/munit_test/test_protocols/test_collection.c:140:         assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 140 24 is_stmt 0 view .LVU1526
+	movq	-720(%rbp,%rbx,8), %r12	# out[i_29], _ypmt_ISEXC_obj
+.LVL504:
+	.loc 1 140 52 is_stmt 1 view .LVU1527
+# Lib/munit_test/test_protocols/test_collection.c:140:         assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 140 62 is_stmt 0 view .LVU1528
+	movq	%r15, -728(%rbp)	# yp_SyntaxError.146_23, MEM[(struct ypObject *[1] *)_117][0]
+	.loc 1 140 105 is_stmt 1 view .LVU1529
+.LVL505:
+	.loc 1 140 228 view .LVU1530
+	.loc 1 140 233 view .LVU1531
+	.loc 1 140 382 view .LVU1532
+# Lib/munit_test/test_protocols/test_collection.c:140:         assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 140 387 is_stmt 0 view .LVU1533
+	movq	%r12, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexceptionC@PLT	#
+.LVL506:
+# Lib/munit_test/test_protocols/test_collection.c:140:         assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 140 385 view .LVU1534
+	testl	%eax, %eax	# tmp235
+	je	.L283	#,
+	.loc 1 140 593 is_stmt 1 discriminator 4 view .LVU1535
+# Lib/munit_test/test_protocols/test_collection.c:140:         assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 140 598 is_stmt 0 discriminator 4 view .LVU1536
+	leaq	-728(%rbp), %rdx	#, tmp213
+	movl	$1, %esi	#,
+	movq	%r12, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexception_arrayC@PLT	#
+.LVL507:
+# Lib/munit_test/test_protocols/test_collection.c:140:         assert_isexception(out[i], yp_SyntaxError);
+	.loc 1 140 596 discriminator 4 view .LVU1537
+	testl	%eax, %eax	# tmp236
+	jne	.L259	#,
+	.loc 1 140 677 is_stmt 1 discriminator 5 view .LVU1538
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC45(%rip), %rcx	#, tmp214
+	leaq	.LC47(%rip), %rdx	#, tmp215
+	movl	$140, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp216
+	call	munit_errorf_ex@PLT	#
+.LVL508:
+.L282:
+	.loc 1 140 677 is_stmt 0 discriminator 5 view .LVU1539
+.LBE184:
+	.loc 1 143 5 is_stmt 1 view .LVU1540
+	leaq	-80(%rbp), %rsi	#, tmp218
+	movl	$3, %edi	#,
+	call	obj_array_decref2@PLT	#
+.LVL509:
+	.loc 1 144 5 view .LVU1541
+	movq	%r14, %rdi	# uq,
+	call	uniqueness_dealloc@PLT	#
+.LVL510:
+	.loc 1 145 5 view .LVU1542
+	movq	-744(%rbp), %rdx	# %sfp,
+	movq	%r13, %rsi	# self,
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_decrefN@PLT	#
+.LVL511:
+	.loc 1 146 5 view .LVU1543
+# Lib/munit_test/test_protocols/test_collection.c:147: }
+	.loc 1 147 1 is_stmt 0 view .LVU1544
+	movl	$0, %eax	#,
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+.LVL512:
+	.loc 1 147 1 view .LVU1545
+	popq	%r12	#
+	popq	%r13	#
+.LVL513:
+	.loc 1 147 1 view .LVU1546
+	popq	%r14	#
+.LVL514:
+	.loc 1 147 1 view .LVU1547
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+.LVL515:
+	.loc 1 147 1 view .LVU1548
+	ret	
+	.cfi_endproc
+.LFE24:
+	.size	test_contains_manyC, .-test_contains_manyC
+	.section	.rodata.str1.1
+.LC54:
+	.string	"yp_in(items[1], self)"
+.LC55:
+	.string	"yp_not_in(items[1], self)"
+.LC56:
+	.string	"yp_contains(self, items[2])"
+.LC57:
+	.string	"yp_in(items[2], self)"
+.LC58:
+	.string	"yp_not_in(items[2], self)"
+.LC59:
+	.string	"yp_in(items[0], self)"
+.LC60:
+	.string	"yp_not_in(items[0], self)"
+	.section	.rodata.str1.8
+	.align 8
+.LC61:
+	.string	"type->is_string ? yp_True : yp_False"
+	.section	.rodata.str1.1
+.LC62:
+	.string	"yp_contains(self, self)"
+.LC63:
+	.string	"yp_in(self, self)"
+	.section	.rodata.str1.8
+	.align 8
+.LC64:
+	.string	"type->is_string ? yp_False : yp_True"
+	.section	.rodata.str1.1
+.LC65:
+	.string	"yp_not_in(self, self)"
+	.section	.rodata.str1.8
+	.align 8
+.LC66:
+	.string	"yp_contains(self, yp_SyntaxError)"
+	.section	.rodata.str1.1
+.LC67:
+	.string	"yp_in(yp_SyntaxError, self)"
+	.section	.rodata.str1.8
+	.align 8
+.LC68:
+	.string	"yp_not_in(yp_SyntaxError, self)"
+	.align 8
+.LC69:
+	.string	"yp_contains(empty, yp_SyntaxError)"
+	.section	.rodata.str1.1
+.LC70:
+	.string	"yp_in(yp_SyntaxError, empty)"
+	.section	.rodata.str1.8
+	.align 8
+.LC71:
+	.string	"yp_not_in(yp_SyntaxError, empty)"
+	.text
+	.type	test_contains, @function
+test_contains:
+.LVL516:
+.LFB23:
+	.loc 1 22 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 22 1 is_stmt 0 view .LVU1550
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$56, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 23 5 is_stmt 1 view .LVU1551
+# Lib/munit_test/test_protocols/test_collection.c:23:     fixture_type_t *type = fixture->type;
+	.loc 1 23 21 is_stmt 0 view .LVU1552
+	movq	(%rsi), %r14	# fixture_86(D)->type, type
+.LVL517:
+	.loc 1 24 5 is_stmt 1 view .LVU1553
+# Lib/munit_test/test_protocols/test_collection.c:24:     uniqueness_t   *uq = uniqueness_new();
+	.loc 1 24 24 is_stmt 0 view .LVU1554
+	call	uniqueness_new@PLT	#
+.LVL518:
+	.loc 1 24 24 view .LVU1555
+	movq	%rax, %r12	# tmp410, uq
+.LVL519:
+	.loc 1 25 5 is_stmt 1 view .LVU1556
+	.loc 1 26 5 view .LVU1557
+# Lib/munit_test/test_protocols/test_collection.c:26:     obj_array_fill(items, uq, type->rand_items);
+	.loc 1 26 10 is_stmt 0 view .LVU1558
+	leaq	-80(%rbp), %rdx	#, tmp200
+	movl	$4, %esi	#,
+	movq	%rax, %rdi	# uq,
+	call	*64(%r14)	# type_87->rand_items
+.LVL520:
+.LBB185:
+	.loc 1 30 9 is_stmt 1 view .LVU1559
+# Lib/munit_test/test_protocols/test_collection.c:30:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 30 26 is_stmt 0 view .LVU1560
+	movq	-72(%rbp), %rdx	# items[1],
+	movq	-80(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r14)	# type_87->newN
+.LVL521:
+	movq	%rax, %rbx	# tmp411, self
+.LVL522:
+	.loc 1 31 9 is_stmt 1 view .LVU1561
+.LBB186:
+	.loc 1 31 14 view .LVU1562
+# Lib/munit_test/test_protocols/test_collection.c:31:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 31 39 is_stmt 0 view .LVU1563
+	movq	-72(%rbp), %rsi	# items[1],
+	movq	%rax, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL523:
+	.loc 1 31 69 is_stmt 1 view .LVU1564
+# Lib/munit_test/test_protocols/test_collection.c:31:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 31 79 is_stmt 0 view .LVU1565
+	movq	yp_True(%rip), %r13	# yp_True, _ypmt_OBJ_b
+.LVL524:
+	.loc 1 31 104 is_stmt 1 view .LVU1566
+.LBB187:
+	.loc 1 31 109 view .LVU1567
+# Lib/munit_test/test_protocols/test_collection.c:31:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 31 180 is_stmt 0 view .LVU1568
+	cmpq	%rax, %r13	# tmp412, _ypmt_OBJ_b
+	je	.L363	#,
+# Lib/munit_test/test_protocols/test_collection.c:31:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 31 180 discriminator 2 view .LVU1569
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.148_66
+.L285:
+.LVL525:
+	.loc 1 31 193 is_stmt 1 discriminator 4 view .LVU1570
+	.loc 1 31 198 discriminator 4 view .LVU1571
+# Lib/munit_test/test_protocols/test_collection.c:31:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 31 201 is_stmt 0 discriminator 4 view .LVU1572
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.148_66
+	je	.L286	#,
+	.loc 1 31 240 is_stmt 1 discriminator 6 view .LVU1573
+# Lib/munit_test/test_protocols/test_collection.c:31:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 31 243 is_stmt 0 discriminator 6 view .LVU1574
+	cmpq	%rdi, yp_False(%rip)	# iftmp.148_66, yp_False
+	je	.L382	#,
+	.loc 1 31 472 is_stmt 1 discriminator 8 view .LVU1575
+	.loc 1 31 477 discriminator 8 view .LVU1576
+	.loc 1 31 482 discriminator 8 view .LVU1577
+# Lib/munit_test/test_protocols/test_collection.c:31:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 31 486 is_stmt 0 discriminator 8 view .LVU1578
+	call	yp_isexceptionC@PLT	#
+.LVL526:
+# Lib/munit_test/test_protocols/test_collection.c:31:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 31 485 discriminator 8 view .LVU1579
+	testl	%eax, %eax	# tmp413
+	je	.L288	#,
+	.loc 1 31 523 is_stmt 1 discriminator 9 view .LVU1580
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp208
+	leaq	.LC15(%rip), %rdx	#, tmp209
+	movl	$31, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp210
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL527:
+.L363:
+# Lib/munit_test/test_protocols/test_collection.c:31:         assert_obj(yp_contains(self, items[1]), is, yp_True);
+	.loc 1 31 180 is_stmt 0 view .LVU1581
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.148_66
+	jmp	.L285	#
+.LVL528:
+.L382:
+	.loc 1 31 276 is_stmt 1 discriminator 7 view .LVU1582
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp205
+	leaq	.LC14(%rip), %rdx	#, tmp206
+	movl	$31, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp207
+.LVL529:
+	.loc 1 31 276 is_stmt 0 discriminator 7 view .LVU1583
+	movl	$0, %eax	#,
+.LVL530:
+	.loc 1 31 276 discriminator 7 view .LVU1584
+	call	munit_errorf_ex@PLT	#
+.LVL531:
+.L288:
+	.loc 1 31 480 is_stmt 1 discriminator 10 view .LVU1585
+	.loc 1 31 729 discriminator 10 view .LVU1586
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC17(%rip), %rcx	#, tmp211
+	leaq	.LC16(%rip), %rdx	#, tmp212
+	movl	$31, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp213
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL532:
+.L286:
+	.loc 1 31 233 view .LVU1587
+	.loc 1 31 475 view .LVU1588
+	.loc 1 31 196 view .LVU1589
+.LBE187:
+	.loc 1 31 107 view .LVU1590
+.LBE186:
+	.loc 1 31 12 view .LVU1591
+	.loc 1 32 9 view .LVU1592
+.LBB188:
+	.loc 1 32 14 view .LVU1593
+# Lib/munit_test/test_protocols/test_collection.c:32:         assert_obj(yp_in(items[1], self), is, yp_True);
+	.loc 1 32 39 is_stmt 0 view .LVU1594
+	movq	%rbx, %rsi	# self,
+	movq	-72(%rbp), %rdi	# items[1],
+.LVL533:
+	.loc 1 32 39 view .LVU1595
+	call	yp_in@PLT	#
+.LVL534:
+	.loc 1 32 63 is_stmt 1 view .LVU1596
+	.loc 1 32 98 view .LVU1597
+.LBB189:
+	.loc 1 32 103 view .LVU1598
+# Lib/munit_test/test_protocols/test_collection.c:32:         assert_obj(yp_in(items[1], self), is, yp_True);
+	.loc 1 32 174 is_stmt 0 view .LVU1599
+	cmpq	%rax, %r13	# tmp414, _ypmt_OBJ_b
+	je	.L364	#,
+# Lib/munit_test/test_protocols/test_collection.c:32:         assert_obj(yp_in(items[1], self), is, yp_True);
+	.loc 1 32 174 discriminator 2 view .LVU1600
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.151_67
+.L289:
+.LVL535:
+	.loc 1 32 187 is_stmt 1 discriminator 4 view .LVU1601
+	.loc 1 32 192 discriminator 4 view .LVU1602
+# Lib/munit_test/test_protocols/test_collection.c:32:         assert_obj(yp_in(items[1], self), is, yp_True);
+	.loc 1 32 195 is_stmt 0 discriminator 4 view .LVU1603
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.151_67
+	je	.L290	#,
+	.loc 1 32 234 is_stmt 1 discriminator 6 view .LVU1604
+# Lib/munit_test/test_protocols/test_collection.c:32:         assert_obj(yp_in(items[1], self), is, yp_True);
+	.loc 1 32 237 is_stmt 0 discriminator 6 view .LVU1605
+	cmpq	%rdi, yp_False(%rip)	# iftmp.151_67, yp_False
+	je	.L383	#,
+	.loc 1 32 460 is_stmt 1 discriminator 8 view .LVU1606
+	.loc 1 32 465 discriminator 8 view .LVU1607
+	.loc 1 32 470 discriminator 8 view .LVU1608
+# Lib/munit_test/test_protocols/test_collection.c:32:         assert_obj(yp_in(items[1], self), is, yp_True);
+	.loc 1 32 474 is_stmt 0 discriminator 8 view .LVU1609
+	call	yp_isexceptionC@PLT	#
+.LVL536:
+# Lib/munit_test/test_protocols/test_collection.c:32:         assert_obj(yp_in(items[1], self), is, yp_True);
+	.loc 1 32 473 discriminator 8 view .LVU1610
+	testl	%eax, %eax	# tmp415
+	je	.L292	#,
+	.loc 1 32 511 is_stmt 1 discriminator 9 view .LVU1611
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC54(%rip), %rcx	#, tmp218
+	leaq	.LC15(%rip), %rdx	#, tmp219
+	movl	$32, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp220
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL537:
+.L364:
+# Lib/munit_test/test_protocols/test_collection.c:32:         assert_obj(yp_in(items[1], self), is, yp_True);
+	.loc 1 32 174 is_stmt 0 view .LVU1612
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.151_67
+	jmp	.L289	#
+.LVL538:
+.L383:
+	.loc 1 32 270 is_stmt 1 discriminator 7 view .LVU1613
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC54(%rip), %rcx	#, tmp215
+	leaq	.LC14(%rip), %rdx	#, tmp216
+	movl	$32, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp217
+.LVL539:
+	.loc 1 32 270 is_stmt 0 discriminator 7 view .LVU1614
+	movl	$0, %eax	#,
+.LVL540:
+	.loc 1 32 270 discriminator 7 view .LVU1615
+	call	munit_errorf_ex@PLT	#
+.LVL541:
+.L292:
+	.loc 1 32 468 is_stmt 1 discriminator 10 view .LVU1616
+	.loc 1 32 711 discriminator 10 view .LVU1617
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC54(%rip), %rcx	#, tmp221
+	leaq	.LC16(%rip), %rdx	#, tmp222
+	movl	$32, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp223
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL542:
+.L290:
+	.loc 1 32 227 view .LVU1618
+	.loc 1 32 463 view .LVU1619
+	.loc 1 32 190 view .LVU1620
+.LBE189:
+	.loc 1 32 101 view .LVU1621
+.LBE188:
+	.loc 1 32 12 view .LVU1622
+	.loc 1 33 9 view .LVU1623
+.LBB190:
+	.loc 1 33 14 view .LVU1624
+# Lib/munit_test/test_protocols/test_collection.c:33:         assert_obj(yp_not_in(items[1], self), is, yp_False);
+	.loc 1 33 39 is_stmt 0 view .LVU1625
+	movq	%rbx, %rsi	# self,
+	movq	-72(%rbp), %rdi	# items[1],
+.LVL543:
+	.loc 1 33 39 view .LVU1626
+	call	yp_not_in@PLT	#
+.LVL544:
+	.loc 1 33 67 is_stmt 1 view .LVU1627
+# Lib/munit_test/test_protocols/test_collection.c:33:         assert_obj(yp_not_in(items[1], self), is, yp_False);
+	.loc 1 33 77 is_stmt 0 view .LVU1628
+	movq	yp_False(%rip), %r15	# yp_False, _ypmt_OBJ_b
+.LVL545:
+	.loc 1 33 103 is_stmt 1 view .LVU1629
+.LBB191:
+	.loc 1 33 108 view .LVU1630
+# Lib/munit_test/test_protocols/test_collection.c:33:         assert_obj(yp_not_in(items[1], self), is, yp_False);
+	.loc 1 33 179 is_stmt 0 view .LVU1631
+	cmpq	%rax, %r15	# tmp416, _ypmt_OBJ_b
+	je	.L384	#,
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.154_68
+.L293:
+.LVL546:
+	.loc 1 33 192 is_stmt 1 discriminator 4 view .LVU1632
+	.loc 1 33 197 discriminator 4 view .LVU1633
+# Lib/munit_test/test_protocols/test_collection.c:33:         assert_obj(yp_not_in(items[1], self), is, yp_False);
+	.loc 1 33 200 is_stmt 0 discriminator 4 view .LVU1634
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.154_68
+	je	.L294	#,
+	.loc 1 33 239 is_stmt 1 discriminator 6 view .LVU1635
+# Lib/munit_test/test_protocols/test_collection.c:33:         assert_obj(yp_not_in(items[1], self), is, yp_False);
+	.loc 1 33 242 is_stmt 0 discriminator 6 view .LVU1636
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.154_68
+	je	.L385	#,
+	.loc 1 33 470 is_stmt 1 discriminator 8 view .LVU1637
+	.loc 1 33 475 discriminator 8 view .LVU1638
+	.loc 1 33 480 discriminator 8 view .LVU1639
+# Lib/munit_test/test_protocols/test_collection.c:33:         assert_obj(yp_not_in(items[1], self), is, yp_False);
+	.loc 1 33 484 is_stmt 0 discriminator 8 view .LVU1640
+	call	yp_isexceptionC@PLT	#
+.LVL547:
+# Lib/munit_test/test_protocols/test_collection.c:33:         assert_obj(yp_not_in(items[1], self), is, yp_False);
+	.loc 1 33 483 discriminator 8 view .LVU1641
+	testl	%eax, %eax	# tmp417
+	je	.L296	#,
+	.loc 1 33 521 is_stmt 1 discriminator 9 view .LVU1642
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC55(%rip), %rcx	#, tmp228
+	leaq	.LC15(%rip), %rdx	#, tmp229
+	movl	$33, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp230
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL548:
+.L384:
+# Lib/munit_test/test_protocols/test_collection.c:33:         assert_obj(yp_not_in(items[1], self), is, yp_False);
+	.loc 1 33 179 is_stmt 0 view .LVU1643
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.154_68
+	jmp	.L293	#
+.LVL549:
+.L385:
+	.loc 1 33 275 is_stmt 1 discriminator 7 view .LVU1644
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC55(%rip), %rcx	#, tmp225
+	leaq	.LC14(%rip), %rdx	#, tmp226
+	movl	$33, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp227
+.LVL550:
+	.loc 1 33 275 is_stmt 0 discriminator 7 view .LVU1645
+	movl	$0, %eax	#,
+.LVL551:
+	.loc 1 33 275 discriminator 7 view .LVU1646
+	call	munit_errorf_ex@PLT	#
+.LVL552:
+.L296:
+	.loc 1 33 478 is_stmt 1 discriminator 10 view .LVU1647
+	.loc 1 33 726 discriminator 10 view .LVU1648
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC55(%rip), %rcx	#, tmp231
+	leaq	.LC16(%rip), %rdx	#, tmp232
+	movl	$33, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp233
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL553:
+.L294:
+	.loc 1 33 232 view .LVU1649
+	.loc 1 33 473 view .LVU1650
+	.loc 1 33 195 view .LVU1651
+.LBE191:
+	.loc 1 33 106 view .LVU1652
+.LBE190:
+	.loc 1 33 12 view .LVU1653
+	.loc 1 34 9 view .LVU1654
+	movq	%rbx, %rsi	# self,
+	movl	$1, %edi	#,
+.LVL554:
+	.loc 1 34 9 is_stmt 0 view .LVU1655
+	movl	$0, %eax	#,
+.LVL555:
+	.loc 1 34 9 view .LVU1656
+	call	yp_decrefN@PLT	#
+.LVL556:
+.LBE185:
+.LBB192:
+	.loc 1 39 9 is_stmt 1 view .LVU1657
+# Lib/munit_test/test_protocols/test_collection.c:39:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 39 26 is_stmt 0 view .LVU1658
+	movq	-72(%rbp), %rdx	# items[1],
+	movq	-80(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r14)	# type_87->newN
+.LVL557:
+	movq	%rax, %rbx	# tmp418, self
+.LVL558:
+	.loc 1 40 9 is_stmt 1 view .LVU1659
+.LBB193:
+	.loc 1 40 14 view .LVU1660
+# Lib/munit_test/test_protocols/test_collection.c:40:         assert_obj(yp_contains(self, items[2]), is, yp_False);
+	.loc 1 40 39 is_stmt 0 view .LVU1661
+	movq	-64(%rbp), %rsi	# items[2],
+	movq	%rax, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL559:
+	.loc 1 40 69 is_stmt 1 view .LVU1662
+	.loc 1 40 105 view .LVU1663
+.LBB194:
+	.loc 1 40 110 view .LVU1664
+# Lib/munit_test/test_protocols/test_collection.c:40:         assert_obj(yp_contains(self, items[2]), is, yp_False);
+	.loc 1 40 181 is_stmt 0 view .LVU1665
+	cmpq	%rax, %r15	# tmp419, _ypmt_OBJ_b
+	je	.L386	#,
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.157_69
+.L297:
+.LVL560:
+	.loc 1 40 194 is_stmt 1 discriminator 4 view .LVU1666
+	.loc 1 40 199 discriminator 4 view .LVU1667
+# Lib/munit_test/test_protocols/test_collection.c:40:         assert_obj(yp_contains(self, items[2]), is, yp_False);
+	.loc 1 40 202 is_stmt 0 discriminator 4 view .LVU1668
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.157_69
+	je	.L298	#,
+	.loc 1 40 241 is_stmt 1 discriminator 6 view .LVU1669
+# Lib/munit_test/test_protocols/test_collection.c:40:         assert_obj(yp_contains(self, items[2]), is, yp_False);
+	.loc 1 40 244 is_stmt 0 discriminator 6 view .LVU1670
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.157_69
+	je	.L387	#,
+	.loc 1 40 474 is_stmt 1 discriminator 8 view .LVU1671
+	.loc 1 40 479 discriminator 8 view .LVU1672
+	.loc 1 40 484 discriminator 8 view .LVU1673
+# Lib/munit_test/test_protocols/test_collection.c:40:         assert_obj(yp_contains(self, items[2]), is, yp_False);
+	.loc 1 40 488 is_stmt 0 discriminator 8 view .LVU1674
+	call	yp_isexceptionC@PLT	#
+.LVL561:
+# Lib/munit_test/test_protocols/test_collection.c:40:         assert_obj(yp_contains(self, items[2]), is, yp_False);
+	.loc 1 40 487 discriminator 8 view .LVU1675
+	testl	%eax, %eax	# tmp420
+	je	.L300	#,
+	.loc 1 40 525 is_stmt 1 discriminator 9 view .LVU1676
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC56(%rip), %rcx	#, tmp240
+	leaq	.LC15(%rip), %rdx	#, tmp241
+	movl	$40, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp242
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL562:
+.L386:
+# Lib/munit_test/test_protocols/test_collection.c:40:         assert_obj(yp_contains(self, items[2]), is, yp_False);
+	.loc 1 40 181 is_stmt 0 view .LVU1677
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.157_69
+	jmp	.L297	#
+.LVL563:
+.L387:
+	.loc 1 40 277 is_stmt 1 discriminator 7 view .LVU1678
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC56(%rip), %rcx	#, tmp237
+	leaq	.LC14(%rip), %rdx	#, tmp238
+	movl	$40, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp239
+.LVL564:
+	.loc 1 40 277 is_stmt 0 discriminator 7 view .LVU1679
+	movl	$0, %eax	#,
+.LVL565:
+	.loc 1 40 277 discriminator 7 view .LVU1680
+	call	munit_errorf_ex@PLT	#
+.LVL566:
+.L300:
+	.loc 1 40 482 is_stmt 1 discriminator 10 view .LVU1681
+	.loc 1 40 732 discriminator 10 view .LVU1682
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC56(%rip), %rcx	#, tmp243
+	leaq	.LC16(%rip), %rdx	#, tmp244
+	movl	$40, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp245
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL567:
+.L298:
+	.loc 1 40 234 view .LVU1683
+	.loc 1 40 477 view .LVU1684
+	.loc 1 40 197 view .LVU1685
+.LBE194:
+	.loc 1 40 108 view .LVU1686
+.LBE193:
+	.loc 1 40 12 view .LVU1687
+	.loc 1 41 9 view .LVU1688
+.LBB195:
+	.loc 1 41 14 view .LVU1689
+# Lib/munit_test/test_protocols/test_collection.c:41:         assert_obj(yp_in(items[2], self), is, yp_False);
+	.loc 1 41 39 is_stmt 0 view .LVU1690
+	movq	%rbx, %rsi	# self,
+	movq	-64(%rbp), %rdi	# items[2],
+.LVL568:
+	.loc 1 41 39 view .LVU1691
+	call	yp_in@PLT	#
+.LVL569:
+	.loc 1 41 63 is_stmt 1 view .LVU1692
+	.loc 1 41 99 view .LVU1693
+.LBB196:
+	.loc 1 41 104 view .LVU1694
+# Lib/munit_test/test_protocols/test_collection.c:41:         assert_obj(yp_in(items[2], self), is, yp_False);
+	.loc 1 41 175 is_stmt 0 view .LVU1695
+	cmpq	%rax, %r15	# tmp421, _ypmt_OBJ_b
+	je	.L388	#,
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.160_70
+.L301:
+.LVL570:
+	.loc 1 41 188 is_stmt 1 discriminator 4 view .LVU1696
+	.loc 1 41 193 discriminator 4 view .LVU1697
+# Lib/munit_test/test_protocols/test_collection.c:41:         assert_obj(yp_in(items[2], self), is, yp_False);
+	.loc 1 41 196 is_stmt 0 discriminator 4 view .LVU1698
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.160_70
+	je	.L302	#,
+	.loc 1 41 235 is_stmt 1 discriminator 6 view .LVU1699
+# Lib/munit_test/test_protocols/test_collection.c:41:         assert_obj(yp_in(items[2], self), is, yp_False);
+	.loc 1 41 238 is_stmt 0 discriminator 6 view .LVU1700
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.160_70
+	je	.L389	#,
+	.loc 1 41 462 is_stmt 1 discriminator 8 view .LVU1701
+	.loc 1 41 467 discriminator 8 view .LVU1702
+	.loc 1 41 472 discriminator 8 view .LVU1703
+# Lib/munit_test/test_protocols/test_collection.c:41:         assert_obj(yp_in(items[2], self), is, yp_False);
+	.loc 1 41 476 is_stmt 0 discriminator 8 view .LVU1704
+	call	yp_isexceptionC@PLT	#
+.LVL571:
+# Lib/munit_test/test_protocols/test_collection.c:41:         assert_obj(yp_in(items[2], self), is, yp_False);
+	.loc 1 41 475 discriminator 8 view .LVU1705
+	testl	%eax, %eax	# tmp422
+	je	.L304	#,
+	.loc 1 41 513 is_stmt 1 discriminator 9 view .LVU1706
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC57(%rip), %rcx	#, tmp250
+	leaq	.LC15(%rip), %rdx	#, tmp251
+	movl	$41, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp252
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL572:
+.L388:
+# Lib/munit_test/test_protocols/test_collection.c:41:         assert_obj(yp_in(items[2], self), is, yp_False);
+	.loc 1 41 175 is_stmt 0 view .LVU1707
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.160_70
+	jmp	.L301	#
+.LVL573:
+.L389:
+	.loc 1 41 271 is_stmt 1 discriminator 7 view .LVU1708
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC57(%rip), %rcx	#, tmp247
+	leaq	.LC14(%rip), %rdx	#, tmp248
+	movl	$41, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp249
+.LVL574:
+	.loc 1 41 271 is_stmt 0 discriminator 7 view .LVU1709
+	movl	$0, %eax	#,
+.LVL575:
+	.loc 1 41 271 discriminator 7 view .LVU1710
+	call	munit_errorf_ex@PLT	#
+.LVL576:
+.L304:
+	.loc 1 41 470 is_stmt 1 discriminator 10 view .LVU1711
+	.loc 1 41 714 discriminator 10 view .LVU1712
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC57(%rip), %rcx	#, tmp253
+	leaq	.LC16(%rip), %rdx	#, tmp254
+	movl	$41, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp255
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL577:
+.L302:
+	.loc 1 41 228 view .LVU1713
+	.loc 1 41 465 view .LVU1714
+	.loc 1 41 191 view .LVU1715
+.LBE196:
+	.loc 1 41 102 view .LVU1716
+.LBE195:
+	.loc 1 41 12 view .LVU1717
+	.loc 1 42 9 view .LVU1718
+.LBB197:
+	.loc 1 42 14 view .LVU1719
+# Lib/munit_test/test_protocols/test_collection.c:42:         assert_obj(yp_not_in(items[2], self), is, yp_True);
+	.loc 1 42 39 is_stmt 0 view .LVU1720
+	movq	%rbx, %rsi	# self,
+	movq	-64(%rbp), %rdi	# items[2],
+.LVL578:
+	.loc 1 42 39 view .LVU1721
+	call	yp_not_in@PLT	#
+.LVL579:
+	.loc 1 42 67 is_stmt 1 view .LVU1722
+	.loc 1 42 102 view .LVU1723
+.LBB198:
+	.loc 1 42 107 view .LVU1724
+# Lib/munit_test/test_protocols/test_collection.c:42:         assert_obj(yp_not_in(items[2], self), is, yp_True);
+	.loc 1 42 178 is_stmt 0 view .LVU1725
+	cmpq	%rax, %r13	# tmp423, _ypmt_OBJ_b
+	je	.L390	#,
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.163_71
+.L305:
+.LVL580:
+	.loc 1 42 191 is_stmt 1 discriminator 4 view .LVU1726
+	.loc 1 42 196 discriminator 4 view .LVU1727
+# Lib/munit_test/test_protocols/test_collection.c:42:         assert_obj(yp_not_in(items[2], self), is, yp_True);
+	.loc 1 42 199 is_stmt 0 discriminator 4 view .LVU1728
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.163_71
+	je	.L306	#,
+	.loc 1 42 238 is_stmt 1 discriminator 6 view .LVU1729
+# Lib/munit_test/test_protocols/test_collection.c:42:         assert_obj(yp_not_in(items[2], self), is, yp_True);
+	.loc 1 42 241 is_stmt 0 discriminator 6 view .LVU1730
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.163_71
+	je	.L391	#,
+	.loc 1 42 468 is_stmt 1 discriminator 8 view .LVU1731
+	.loc 1 42 473 discriminator 8 view .LVU1732
+	.loc 1 42 478 discriminator 8 view .LVU1733
+# Lib/munit_test/test_protocols/test_collection.c:42:         assert_obj(yp_not_in(items[2], self), is, yp_True);
+	.loc 1 42 482 is_stmt 0 discriminator 8 view .LVU1734
+	call	yp_isexceptionC@PLT	#
+.LVL581:
+# Lib/munit_test/test_protocols/test_collection.c:42:         assert_obj(yp_not_in(items[2], self), is, yp_True);
+	.loc 1 42 481 discriminator 8 view .LVU1735
+	testl	%eax, %eax	# tmp424
+	je	.L308	#,
+	.loc 1 42 519 is_stmt 1 discriminator 9 view .LVU1736
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC58(%rip), %rcx	#, tmp260
+	leaq	.LC15(%rip), %rdx	#, tmp261
+	movl	$42, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp262
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL582:
+.L390:
+# Lib/munit_test/test_protocols/test_collection.c:42:         assert_obj(yp_not_in(items[2], self), is, yp_True);
+	.loc 1 42 178 is_stmt 0 view .LVU1737
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.163_71
+	jmp	.L305	#
+.LVL583:
+.L391:
+	.loc 1 42 274 is_stmt 1 discriminator 7 view .LVU1738
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC58(%rip), %rcx	#, tmp257
+	leaq	.LC14(%rip), %rdx	#, tmp258
+	movl	$42, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp259
+.LVL584:
+	.loc 1 42 274 is_stmt 0 discriminator 7 view .LVU1739
+	movl	$0, %eax	#,
+.LVL585:
+	.loc 1 42 274 discriminator 7 view .LVU1740
+	call	munit_errorf_ex@PLT	#
+.LVL586:
+.L308:
+	.loc 1 42 476 is_stmt 1 discriminator 10 view .LVU1741
+	.loc 1 42 723 discriminator 10 view .LVU1742
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC58(%rip), %rcx	#, tmp263
+	leaq	.LC16(%rip), %rdx	#, tmp264
+	movl	$42, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp265
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL587:
+.L306:
+	.loc 1 42 231 view .LVU1743
+	.loc 1 42 471 view .LVU1744
+	.loc 1 42 194 view .LVU1745
+.LBE198:
+	.loc 1 42 105 view .LVU1746
+.LBE197:
+	.loc 1 42 12 view .LVU1747
+	.loc 1 43 9 view .LVU1748
+	movq	%rbx, %rsi	# self,
+	movl	$1, %edi	#,
+.LVL588:
+	.loc 1 43 9 is_stmt 0 view .LVU1749
+	movl	$0, %eax	#,
+.LVL589:
+	.loc 1 43 9 view .LVU1750
+	call	yp_decrefN@PLT	#
+.LVL590:
+.LBE192:
+	.loc 1 47 5 is_stmt 1 view .LVU1751
+# Lib/munit_test/test_protocols/test_collection.c:47:     if (type->is_mutable) {
+	.loc 1 47 8 is_stmt 0 view .LVU1752
+	cmpl	$0, 96(%r14)	#, type_87->is_mutable
+	je	.L309	#,
+.LBB199:
+	.loc 1 48 9 is_stmt 1 view .LVU1753
+# Lib/munit_test/test_protocols/test_collection.c:48:         ypObject *self = type->newN(N(items[0]));
+	.loc 1 48 26 is_stmt 0 view .LVU1754
+	movq	-80(%rbp), %rsi	# items[0],
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r14)	# type_87->newN
+.LVL591:
+	movq	%rax, %rbx	# tmp425, self
+.LVL592:
+	.loc 1 49 9 is_stmt 1 view .LVU1755
+.LBB200:
+	.loc 1 49 14 view .LVU1756
+# Lib/munit_test/test_protocols/test_collection.c:49:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 49 24 is_stmt 0 view .LVU1757
+	movq	$0, -88(%rbp)	#, MEM[(struct ypObject * *)_264]
+	.loc 1 49 10 is_stmt 1 view .LVU1758
+# Lib/munit_test/test_protocols/test_collection.c:49:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 49 11 is_stmt 0 view .LVU1759
+	leaq	-88(%rbp), %rsi	#, tmp267
+	movq	%rax, %rdi	# self,
+	call	yp_clear@PLT	#
+.LVL593:
+	.loc 1 49 34 is_stmt 1 view .LVU1760
+# Lib/munit_test/test_protocols/test_collection.c:49:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 49 42 is_stmt 0 view .LVU1761
+	movq	-88(%rbp), %rdi	# MEM[(struct ypObject * *)_264], exc.166_25
+# Lib/munit_test/test_protocols/test_collection.c:49:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 49 37 view .LVU1762
+	testq	%rdi, %rdi	# exc.166_25
+	je	.L310	#,
+	.loc 1 49 12 is_stmt 1 discriminator 1 view .LVU1763
+# Lib/munit_test/test_protocols/test_collection.c:49:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 49 16 is_stmt 0 discriminator 1 view .LVU1764
+	call	yp_isexceptionC@PLT	#
+.LVL594:
+# Lib/munit_test/test_protocols/test_collection.c:49:         assert_not_raises_exc(yp_clear(self, &exc));
+	.loc 1 49 15 discriminator 1 view .LVU1765
+	testl	%eax, %eax	# tmp426
+	je	.L311	#,
+	.loc 1 49 40 is_stmt 1 discriminator 2 view .LVU1766
+	leaq	.LC42(%rip), %rcx	#, tmp268
+	leaq	.LC10(%rip), %rdx	#, tmp269
+	movl	$49, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp270
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL595:
+.L311:
+	.loc 1 49 191 discriminator 3 view .LVU1767
+	leaq	.LC42(%rip), %rcx	#, tmp271
+	leaq	.LC11(%rip), %rdx	#, tmp272
+	movl	$49, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp273
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL596:
+.L310:
+.LBE200:
+	.loc 1 49 12 view .LVU1768
+	.loc 1 50 9 view .LVU1769
+.LBB201:
+	.loc 1 50 14 view .LVU1770
+# Lib/munit_test/test_protocols/test_collection.c:50:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 50 39 is_stmt 0 view .LVU1771
+	movq	-80(%rbp), %rsi	# items[0],
+	movq	%rbx, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL597:
+	.loc 1 50 69 is_stmt 1 view .LVU1772
+	.loc 1 50 105 view .LVU1773
+.LBB202:
+	.loc 1 50 110 view .LVU1774
+# Lib/munit_test/test_protocols/test_collection.c:50:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 50 181 is_stmt 0 view .LVU1775
+	cmpq	%rax, %r15	# tmp427, _ypmt_OBJ_b
+	je	.L392	#,
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.168_72
+.L312:
+.LVL598:
+	.loc 1 50 194 is_stmt 1 discriminator 4 view .LVU1776
+	.loc 1 50 199 discriminator 4 view .LVU1777
+# Lib/munit_test/test_protocols/test_collection.c:50:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 50 202 is_stmt 0 discriminator 4 view .LVU1778
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.168_72
+	je	.L313	#,
+	.loc 1 50 241 is_stmt 1 discriminator 6 view .LVU1779
+# Lib/munit_test/test_protocols/test_collection.c:50:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 50 244 is_stmt 0 discriminator 6 view .LVU1780
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.168_72
+	je	.L393	#,
+	.loc 1 50 474 is_stmt 1 discriminator 8 view .LVU1781
+	.loc 1 50 479 discriminator 8 view .LVU1782
+	.loc 1 50 484 discriminator 8 view .LVU1783
+# Lib/munit_test/test_protocols/test_collection.c:50:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 50 488 is_stmt 0 discriminator 8 view .LVU1784
+	call	yp_isexceptionC@PLT	#
+.LVL599:
+# Lib/munit_test/test_protocols/test_collection.c:50:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 50 487 discriminator 8 view .LVU1785
+	testl	%eax, %eax	# tmp428
+	je	.L315	#,
+	.loc 1 50 525 is_stmt 1 discriminator 9 view .LVU1786
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp278
+	leaq	.LC15(%rip), %rdx	#, tmp279
+	movl	$50, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp280
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL600:
+.L392:
+# Lib/munit_test/test_protocols/test_collection.c:50:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 50 181 is_stmt 0 view .LVU1787
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.168_72
+	jmp	.L312	#
+.LVL601:
+.L393:
+	.loc 1 50 277 is_stmt 1 discriminator 7 view .LVU1788
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp275
+	leaq	.LC14(%rip), %rdx	#, tmp276
+	movl	$50, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp277
+.LVL602:
+	.loc 1 50 277 is_stmt 0 discriminator 7 view .LVU1789
+	movl	$0, %eax	#,
+.LVL603:
+	.loc 1 50 277 discriminator 7 view .LVU1790
+	call	munit_errorf_ex@PLT	#
+.LVL604:
+.L315:
+	.loc 1 50 482 is_stmt 1 discriminator 10 view .LVU1791
+	.loc 1 50 732 discriminator 10 view .LVU1792
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp281
+	leaq	.LC16(%rip), %rdx	#, tmp282
+	movl	$50, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp283
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL605:
+.L313:
+	.loc 1 50 234 view .LVU1793
+	.loc 1 50 477 view .LVU1794
+	.loc 1 50 197 view .LVU1795
+.LBE202:
+	.loc 1 50 108 view .LVU1796
+.LBE201:
+	.loc 1 50 12 view .LVU1797
+	.loc 1 51 9 view .LVU1798
+.LBB203:
+	.loc 1 51 14 view .LVU1799
+# Lib/munit_test/test_protocols/test_collection.c:51:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 51 39 is_stmt 0 view .LVU1800
+	movq	%rbx, %rsi	# self,
+	movq	-80(%rbp), %rdi	# items[0],
+.LVL606:
+	.loc 1 51 39 view .LVU1801
+	call	yp_in@PLT	#
+.LVL607:
+	.loc 1 51 63 is_stmt 1 view .LVU1802
+	.loc 1 51 99 view .LVU1803
+.LBB204:
+	.loc 1 51 104 view .LVU1804
+# Lib/munit_test/test_protocols/test_collection.c:51:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 51 175 is_stmt 0 view .LVU1805
+	cmpq	%rax, %r15	# tmp429, _ypmt_OBJ_b
+	je	.L394	#,
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.171_73
+.L316:
+.LVL608:
+	.loc 1 51 188 is_stmt 1 discriminator 4 view .LVU1806
+	.loc 1 51 193 discriminator 4 view .LVU1807
+# Lib/munit_test/test_protocols/test_collection.c:51:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 51 196 is_stmt 0 discriminator 4 view .LVU1808
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.171_73
+	je	.L317	#,
+	.loc 1 51 235 is_stmt 1 discriminator 6 view .LVU1809
+# Lib/munit_test/test_protocols/test_collection.c:51:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 51 238 is_stmt 0 discriminator 6 view .LVU1810
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.171_73
+	je	.L395	#,
+	.loc 1 51 462 is_stmt 1 discriminator 8 view .LVU1811
+	.loc 1 51 467 discriminator 8 view .LVU1812
+	.loc 1 51 472 discriminator 8 view .LVU1813
+# Lib/munit_test/test_protocols/test_collection.c:51:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 51 476 is_stmt 0 discriminator 8 view .LVU1814
+	call	yp_isexceptionC@PLT	#
+.LVL609:
+# Lib/munit_test/test_protocols/test_collection.c:51:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 51 475 discriminator 8 view .LVU1815
+	testl	%eax, %eax	# tmp430
+	je	.L319	#,
+	.loc 1 51 513 is_stmt 1 discriminator 9 view .LVU1816
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC59(%rip), %rcx	#, tmp288
+	leaq	.LC15(%rip), %rdx	#, tmp289
+	movl	$51, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp290
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL610:
+.L394:
+# Lib/munit_test/test_protocols/test_collection.c:51:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 51 175 is_stmt 0 view .LVU1817
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.171_73
+	jmp	.L316	#
+.LVL611:
+.L395:
+	.loc 1 51 271 is_stmt 1 discriminator 7 view .LVU1818
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC59(%rip), %rcx	#, tmp285
+	leaq	.LC14(%rip), %rdx	#, tmp286
+	movl	$51, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp287
+.LVL612:
+	.loc 1 51 271 is_stmt 0 discriminator 7 view .LVU1819
+	movl	$0, %eax	#,
+.LVL613:
+	.loc 1 51 271 discriminator 7 view .LVU1820
+	call	munit_errorf_ex@PLT	#
+.LVL614:
+.L319:
+	.loc 1 51 470 is_stmt 1 discriminator 10 view .LVU1821
+	.loc 1 51 714 discriminator 10 view .LVU1822
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC59(%rip), %rcx	#, tmp291
+	leaq	.LC16(%rip), %rdx	#, tmp292
+	movl	$51, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp293
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL615:
+.L317:
+	.loc 1 51 228 view .LVU1823
+	.loc 1 51 465 view .LVU1824
+	.loc 1 51 191 view .LVU1825
+.LBE204:
+	.loc 1 51 102 view .LVU1826
+.LBE203:
+	.loc 1 51 12 view .LVU1827
+	.loc 1 52 9 view .LVU1828
+.LBB205:
+	.loc 1 52 14 view .LVU1829
+# Lib/munit_test/test_protocols/test_collection.c:52:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 52 39 is_stmt 0 view .LVU1830
+	movq	%rbx, %rsi	# self,
+	movq	-80(%rbp), %rdi	# items[0],
+.LVL616:
+	.loc 1 52 39 view .LVU1831
+	call	yp_not_in@PLT	#
+.LVL617:
+	.loc 1 52 67 is_stmt 1 view .LVU1832
+	.loc 1 52 102 view .LVU1833
+.LBB206:
+	.loc 1 52 107 view .LVU1834
+# Lib/munit_test/test_protocols/test_collection.c:52:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 52 178 is_stmt 0 view .LVU1835
+	cmpq	%rax, %r13	# tmp431, _ypmt_OBJ_b
+	je	.L396	#,
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.174_74
+.L320:
+.LVL618:
+	.loc 1 52 191 is_stmt 1 discriminator 4 view .LVU1836
+	.loc 1 52 196 discriminator 4 view .LVU1837
+# Lib/munit_test/test_protocols/test_collection.c:52:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 52 199 is_stmt 0 discriminator 4 view .LVU1838
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.174_74
+	je	.L321	#,
+	.loc 1 52 238 is_stmt 1 discriminator 6 view .LVU1839
+# Lib/munit_test/test_protocols/test_collection.c:52:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 52 241 is_stmt 0 discriminator 6 view .LVU1840
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.174_74
+	je	.L397	#,
+	.loc 1 52 468 is_stmt 1 discriminator 8 view .LVU1841
+	.loc 1 52 473 discriminator 8 view .LVU1842
+	.loc 1 52 478 discriminator 8 view .LVU1843
+# Lib/munit_test/test_protocols/test_collection.c:52:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 52 482 is_stmt 0 discriminator 8 view .LVU1844
+	call	yp_isexceptionC@PLT	#
+.LVL619:
+# Lib/munit_test/test_protocols/test_collection.c:52:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 52 481 discriminator 8 view .LVU1845
+	testl	%eax, %eax	# tmp432
+	je	.L323	#,
+	.loc 1 52 519 is_stmt 1 discriminator 9 view .LVU1846
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC60(%rip), %rcx	#, tmp298
+	leaq	.LC15(%rip), %rdx	#, tmp299
+	movl	$52, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp300
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL620:
+.L396:
+# Lib/munit_test/test_protocols/test_collection.c:52:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 52 178 is_stmt 0 view .LVU1847
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.174_74
+	jmp	.L320	#
+.LVL621:
+.L397:
+	.loc 1 52 274 is_stmt 1 discriminator 7 view .LVU1848
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC60(%rip), %rcx	#, tmp295
+	leaq	.LC14(%rip), %rdx	#, tmp296
+	movl	$52, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp297
+.LVL622:
+	.loc 1 52 274 is_stmt 0 discriminator 7 view .LVU1849
+	movl	$0, %eax	#,
+.LVL623:
+	.loc 1 52 274 discriminator 7 view .LVU1850
+	call	munit_errorf_ex@PLT	#
+.LVL624:
+.L323:
+	.loc 1 52 476 is_stmt 1 discriminator 10 view .LVU1851
+	.loc 1 52 723 discriminator 10 view .LVU1852
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC60(%rip), %rcx	#, tmp301
+	leaq	.LC16(%rip), %rdx	#, tmp302
+	movl	$52, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp303
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL625:
+.L321:
+	.loc 1 52 231 view .LVU1853
+	.loc 1 52 471 view .LVU1854
+	.loc 1 52 194 view .LVU1855
+.LBE206:
+	.loc 1 52 105 view .LVU1856
+.LBE205:
+	.loc 1 52 12 view .LVU1857
+	.loc 1 53 9 view .LVU1858
+	movq	%rbx, %rsi	# self,
+	movl	$1, %edi	#,
+.LVL626:
+	.loc 1 53 9 is_stmt 0 view .LVU1859
+	movl	$0, %eax	#,
+.LVL627:
+	.loc 1 53 9 view .LVU1860
+	call	yp_decrefN@PLT	#
+.LVL628:
+.L309:
+	.loc 1 53 9 view .LVU1861
+.LBE199:
+.LBB207:
+	.loc 1 58 9 is_stmt 1 view .LVU1862
+# Lib/munit_test/test_protocols/test_collection.c:58:         ypObject *self = type->newN(0);
+	.loc 1 58 26 is_stmt 0 view .LVU1863
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r14)	# type_87->newN
+.LVL629:
+	movq	%rax, %rbx	# tmp433, self
+.LVL630:
+	.loc 1 59 9 is_stmt 1 view .LVU1864
+.LBB208:
+	.loc 1 59 14 view .LVU1865
+# Lib/munit_test/test_protocols/test_collection.c:59:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 59 39 is_stmt 0 view .LVU1866
+	movq	-80(%rbp), %rsi	# items[0],
+	movq	%rax, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL631:
+	.loc 1 59 69 is_stmt 1 view .LVU1867
+	.loc 1 59 105 view .LVU1868
+.LBB209:
+	.loc 1 59 110 view .LVU1869
+# Lib/munit_test/test_protocols/test_collection.c:59:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 59 181 is_stmt 0 view .LVU1870
+	cmpq	%rax, %r15	# tmp434, _ypmt_OBJ_b
+	je	.L398	#,
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.177_75
+.L324:
+.LVL632:
+	.loc 1 59 194 is_stmt 1 discriminator 4 view .LVU1871
+	.loc 1 59 199 discriminator 4 view .LVU1872
+# Lib/munit_test/test_protocols/test_collection.c:59:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 59 202 is_stmt 0 discriminator 4 view .LVU1873
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.177_75
+	je	.L325	#,
+	.loc 1 59 241 is_stmt 1 discriminator 6 view .LVU1874
+# Lib/munit_test/test_protocols/test_collection.c:59:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 59 244 is_stmt 0 discriminator 6 view .LVU1875
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.177_75
+	je	.L399	#,
+	.loc 1 59 474 is_stmt 1 discriminator 8 view .LVU1876
+	.loc 1 59 479 discriminator 8 view .LVU1877
+	.loc 1 59 484 discriminator 8 view .LVU1878
+# Lib/munit_test/test_protocols/test_collection.c:59:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 59 488 is_stmt 0 discriminator 8 view .LVU1879
+	call	yp_isexceptionC@PLT	#
+.LVL633:
+# Lib/munit_test/test_protocols/test_collection.c:59:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 59 487 discriminator 8 view .LVU1880
+	testl	%eax, %eax	# tmp435
+	je	.L327	#,
+	.loc 1 59 525 is_stmt 1 discriminator 9 view .LVU1881
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp308
+	leaq	.LC15(%rip), %rdx	#, tmp309
+	movl	$59, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp310
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL634:
+.L398:
+# Lib/munit_test/test_protocols/test_collection.c:59:         assert_obj(yp_contains(self, items[0]), is, yp_False);
+	.loc 1 59 181 is_stmt 0 view .LVU1882
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.177_75
+	jmp	.L324	#
+.LVL635:
+.L399:
+	.loc 1 59 277 is_stmt 1 discriminator 7 view .LVU1883
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp305
+	leaq	.LC14(%rip), %rdx	#, tmp306
+	movl	$59, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp307
+.LVL636:
+	.loc 1 59 277 is_stmt 0 discriminator 7 view .LVU1884
+	movl	$0, %eax	#,
+.LVL637:
+	.loc 1 59 277 discriminator 7 view .LVU1885
+	call	munit_errorf_ex@PLT	#
+.LVL638:
+.L327:
+	.loc 1 59 482 is_stmt 1 discriminator 10 view .LVU1886
+	.loc 1 59 732 discriminator 10 view .LVU1887
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC13(%rip), %rcx	#, tmp311
+	leaq	.LC16(%rip), %rdx	#, tmp312
+	movl	$59, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp313
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL639:
+.L325:
+	.loc 1 59 234 view .LVU1888
+	.loc 1 59 477 view .LVU1889
+	.loc 1 59 197 view .LVU1890
+.LBE209:
+	.loc 1 59 108 view .LVU1891
+.LBE208:
+	.loc 1 59 12 view .LVU1892
+	.loc 1 60 9 view .LVU1893
+.LBB210:
+	.loc 1 60 14 view .LVU1894
+# Lib/munit_test/test_protocols/test_collection.c:60:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 60 39 is_stmt 0 view .LVU1895
+	movq	%rbx, %rsi	# self,
+	movq	-80(%rbp), %rdi	# items[0],
+.LVL640:
+	.loc 1 60 39 view .LVU1896
+	call	yp_in@PLT	#
+.LVL641:
+	.loc 1 60 63 is_stmt 1 view .LVU1897
+	.loc 1 60 99 view .LVU1898
+.LBB211:
+	.loc 1 60 104 view .LVU1899
+# Lib/munit_test/test_protocols/test_collection.c:60:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 60 175 is_stmt 0 view .LVU1900
+	cmpq	%rax, %r15	# tmp436, _ypmt_OBJ_b
+	je	.L400	#,
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.180_76
+.L328:
+.LVL642:
+	.loc 1 60 188 is_stmt 1 discriminator 4 view .LVU1901
+	.loc 1 60 193 discriminator 4 view .LVU1902
+# Lib/munit_test/test_protocols/test_collection.c:60:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 60 196 is_stmt 0 discriminator 4 view .LVU1903
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.180_76
+	je	.L329	#,
+	.loc 1 60 235 is_stmt 1 discriminator 6 view .LVU1904
+# Lib/munit_test/test_protocols/test_collection.c:60:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 60 238 is_stmt 0 discriminator 6 view .LVU1905
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.180_76
+	je	.L401	#,
+	.loc 1 60 462 is_stmt 1 discriminator 8 view .LVU1906
+	.loc 1 60 467 discriminator 8 view .LVU1907
+	.loc 1 60 472 discriminator 8 view .LVU1908
+# Lib/munit_test/test_protocols/test_collection.c:60:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 60 476 is_stmt 0 discriminator 8 view .LVU1909
+	call	yp_isexceptionC@PLT	#
+.LVL643:
+# Lib/munit_test/test_protocols/test_collection.c:60:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 60 475 discriminator 8 view .LVU1910
+	testl	%eax, %eax	# tmp437
+	je	.L331	#,
+	.loc 1 60 513 is_stmt 1 discriminator 9 view .LVU1911
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC59(%rip), %rcx	#, tmp318
+	leaq	.LC15(%rip), %rdx	#, tmp319
+	movl	$60, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp320
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL644:
+.L400:
+# Lib/munit_test/test_protocols/test_collection.c:60:         assert_obj(yp_in(items[0], self), is, yp_False);
+	.loc 1 60 175 is_stmt 0 view .LVU1912
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.180_76
+	jmp	.L328	#
+.LVL645:
+.L401:
+	.loc 1 60 271 is_stmt 1 discriminator 7 view .LVU1913
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC59(%rip), %rcx	#, tmp315
+	leaq	.LC14(%rip), %rdx	#, tmp316
+	movl	$60, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp317
+.LVL646:
+	.loc 1 60 271 is_stmt 0 discriminator 7 view .LVU1914
+	movl	$0, %eax	#,
+.LVL647:
+	.loc 1 60 271 discriminator 7 view .LVU1915
+	call	munit_errorf_ex@PLT	#
+.LVL648:
+.L331:
+	.loc 1 60 470 is_stmt 1 discriminator 10 view .LVU1916
+	.loc 1 60 714 discriminator 10 view .LVU1917
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC59(%rip), %rcx	#, tmp321
+	leaq	.LC16(%rip), %rdx	#, tmp322
+	movl	$60, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp323
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL649:
+.L329:
+	.loc 1 60 228 view .LVU1918
+	.loc 1 60 465 view .LVU1919
+	.loc 1 60 191 view .LVU1920
+.LBE211:
+	.loc 1 60 102 view .LVU1921
+.LBE210:
+	.loc 1 60 12 view .LVU1922
+	.loc 1 61 9 view .LVU1923
+.LBB212:
+	.loc 1 61 14 view .LVU1924
+# Lib/munit_test/test_protocols/test_collection.c:61:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 61 39 is_stmt 0 view .LVU1925
+	movq	%rbx, %rsi	# self,
+	movq	-80(%rbp), %rdi	# items[0],
+.LVL650:
+	.loc 1 61 39 view .LVU1926
+	call	yp_not_in@PLT	#
+.LVL651:
+	.loc 1 61 67 is_stmt 1 view .LVU1927
+	.loc 1 61 102 view .LVU1928
+.LBB213:
+	.loc 1 61 107 view .LVU1929
+# Lib/munit_test/test_protocols/test_collection.c:61:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 61 178 is_stmt 0 view .LVU1930
+	cmpq	%rax, %r13	# tmp438, _ypmt_OBJ_b
+	je	.L402	#,
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.183_77
+.L332:
+.LVL652:
+	.loc 1 61 191 is_stmt 1 discriminator 4 view .LVU1931
+	.loc 1 61 196 discriminator 4 view .LVU1932
+# Lib/munit_test/test_protocols/test_collection.c:61:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 61 199 is_stmt 0 discriminator 4 view .LVU1933
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.183_77
+	je	.L333	#,
+	.loc 1 61 238 is_stmt 1 discriminator 6 view .LVU1934
+# Lib/munit_test/test_protocols/test_collection.c:61:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 61 241 is_stmt 0 discriminator 6 view .LVU1935
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.183_77
+	je	.L403	#,
+	.loc 1 61 468 is_stmt 1 discriminator 8 view .LVU1936
+	.loc 1 61 473 discriminator 8 view .LVU1937
+	.loc 1 61 478 discriminator 8 view .LVU1938
+# Lib/munit_test/test_protocols/test_collection.c:61:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 61 482 is_stmt 0 discriminator 8 view .LVU1939
+	call	yp_isexceptionC@PLT	#
+.LVL653:
+# Lib/munit_test/test_protocols/test_collection.c:61:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 61 481 discriminator 8 view .LVU1940
+	testl	%eax, %eax	# tmp439
+	je	.L335	#,
+	.loc 1 61 519 is_stmt 1 discriminator 9 view .LVU1941
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC60(%rip), %rcx	#, tmp328
+	leaq	.LC15(%rip), %rdx	#, tmp329
+	movl	$61, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp330
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL654:
+.L402:
+# Lib/munit_test/test_protocols/test_collection.c:61:         assert_obj(yp_not_in(items[0], self), is, yp_True);
+	.loc 1 61 178 is_stmt 0 view .LVU1942
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.183_77
+	jmp	.L332	#
+.LVL655:
+.L403:
+	.loc 1 61 274 is_stmt 1 discriminator 7 view .LVU1943
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC60(%rip), %rcx	#, tmp325
+	leaq	.LC14(%rip), %rdx	#, tmp326
+	movl	$61, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp327
+.LVL656:
+	.loc 1 61 274 is_stmt 0 discriminator 7 view .LVU1944
+	movl	$0, %eax	#,
+.LVL657:
+	.loc 1 61 274 discriminator 7 view .LVU1945
+	call	munit_errorf_ex@PLT	#
+.LVL658:
+.L335:
+	.loc 1 61 476 is_stmt 1 discriminator 10 view .LVU1946
+	.loc 1 61 723 discriminator 10 view .LVU1947
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC60(%rip), %rcx	#, tmp331
+	leaq	.LC16(%rip), %rdx	#, tmp332
+	movl	$61, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp333
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL659:
+.L333:
+	.loc 1 61 231 view .LVU1948
+	.loc 1 61 471 view .LVU1949
+	.loc 1 61 194 view .LVU1950
+.LBE213:
+	.loc 1 61 105 view .LVU1951
+.LBE212:
+	.loc 1 61 12 view .LVU1952
+	.loc 1 62 9 view .LVU1953
+	movq	%rbx, %rsi	# self,
+	movl	$1, %edi	#,
+.LVL660:
+	.loc 1 62 9 is_stmt 0 view .LVU1954
+	movl	$0, %eax	#,
+.LVL661:
+	.loc 1 62 9 view .LVU1955
+	call	yp_decrefN@PLT	#
+.LVL662:
+.LBE207:
+.LBB214:
+	.loc 1 67 9 is_stmt 1 view .LVU1956
+# Lib/munit_test/test_protocols/test_collection.c:67:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 67 26 is_stmt 0 view .LVU1957
+	movq	-72(%rbp), %rdx	# items[1],
+	movq	-80(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r14)	# type_87->newN
+.LVL663:
+	movq	%rax, %rbx	# tmp440, self
+.LVL664:
+	.loc 1 68 9 is_stmt 1 view .LVU1958
+.LBB215:
+	.loc 1 68 14 view .LVU1959
+# Lib/munit_test/test_protocols/test_collection.c:68:         assert_obj(yp_contains(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 68 39 is_stmt 0 view .LVU1960
+	movq	%rax, %rsi	# self,
+	movq	%rax, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL665:
+	.loc 1 68 65 is_stmt 1 view .LVU1961
+# Lib/munit_test/test_protocols/test_collection.c:68:         assert_obj(yp_contains(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 68 116 is_stmt 0 view .LVU1962
+	cmpl	$0, 116(%r14)	#, type_87->is_string
+	je	.L375	#,
+	movq	%r13, %rdx	# _ypmt_OBJ_b, iftmp.186_78
+.L336:
+.LVL666:
+	.loc 1 68 129 is_stmt 1 discriminator 4 view .LVU1963
+.LBB216:
+	.loc 1 68 134 discriminator 4 view .LVU1964
+# Lib/munit_test/test_protocols/test_collection.c:68:         assert_obj(yp_contains(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 68 205 is_stmt 0 discriminator 4 view .LVU1965
+	cmpq	%rax, %rdx	# _ypmt_OBJ_a, iftmp.186_78
+	je	.L404	#,
+# Lib/munit_test/test_protocols/test_collection.c:68:         assert_obj(yp_contains(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 68 205 view .LVU1966
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.187_79
+.L337:
+.LVL667:
+	.loc 1 68 218 is_stmt 1 discriminator 8 view .LVU1967
+	.loc 1 68 223 discriminator 8 view .LVU1968
+# Lib/munit_test/test_protocols/test_collection.c:68:         assert_obj(yp_contains(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 68 226 is_stmt 0 discriminator 8 view .LVU1969
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.187_79
+	je	.L338	#,
+	.loc 1 68 265 is_stmt 1 discriminator 10 view .LVU1970
+# Lib/munit_test/test_protocols/test_collection.c:68:         assert_obj(yp_contains(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 68 268 is_stmt 0 discriminator 10 view .LVU1971
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.187_79
+	je	.L405	#,
+	.loc 1 68 522 is_stmt 1 discriminator 12 view .LVU1972
+	.loc 1 68 527 discriminator 12 view .LVU1973
+	.loc 1 68 532 discriminator 12 view .LVU1974
+# Lib/munit_test/test_protocols/test_collection.c:68:         assert_obj(yp_contains(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 68 536 is_stmt 0 discriminator 12 view .LVU1975
+	call	yp_isexceptionC@PLT	#
+.LVL668:
+# Lib/munit_test/test_protocols/test_collection.c:68:         assert_obj(yp_contains(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 68 535 discriminator 12 view .LVU1976
+	testl	%eax, %eax	# tmp442
+	je	.L340	#,
+	.loc 1 68 573 is_stmt 1 discriminator 13 view .LVU1977
+	leaq	.LC61(%rip), %r8	#,
+	leaq	.LC62(%rip), %rcx	#, tmp339
+	leaq	.LC15(%rip), %rdx	#, tmp340
+	movl	$68, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp341
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL669:
+.L375:
+	.loc 1 68 573 is_stmt 0 discriminator 13 view .LVU1978
+.LBE216:
+# Lib/munit_test/test_protocols/test_collection.c:68:         assert_obj(yp_contains(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 68 116 view .LVU1979
+	movq	%r15, %rdx	# _ypmt_OBJ_b, iftmp.186_78
+	jmp	.L336	#
+.LVL670:
+.L404:
+.LBB217:
+# Lib/munit_test/test_protocols/test_collection.c:68:         assert_obj(yp_contains(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 68 205 view .LVU1980
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.187_79
+	jmp	.L337	#
+.LVL671:
+.L405:
+	.loc 1 68 301 is_stmt 1 discriminator 11 view .LVU1981
+	leaq	.LC61(%rip), %r8	#,
+	leaq	.LC62(%rip), %rcx	#, tmp336
+	leaq	.LC14(%rip), %rdx	#, tmp337
+.LVL672:
+	.loc 1 68 301 is_stmt 0 discriminator 11 view .LVU1982
+	movl	$68, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp338
+.LVL673:
+	.loc 1 68 301 discriminator 11 view .LVU1983
+	movl	$0, %eax	#,
+.LVL674:
+	.loc 1 68 301 discriminator 11 view .LVU1984
+	call	munit_errorf_ex@PLT	#
+.LVL675:
+.L340:
+	.loc 1 68 530 is_stmt 1 discriminator 14 view .LVU1985
+	.loc 1 68 804 discriminator 14 view .LVU1986
+	leaq	.LC61(%rip), %r8	#,
+	leaq	.LC62(%rip), %rcx	#, tmp342
+	leaq	.LC16(%rip), %rdx	#, tmp343
+	movl	$68, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp344
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL676:
+.L338:
+	.loc 1 68 258 view .LVU1987
+	.loc 1 68 525 view .LVU1988
+	.loc 1 68 221 view .LVU1989
+.LBE217:
+	.loc 1 68 132 view .LVU1990
+.LBE215:
+	.loc 1 68 12 view .LVU1991
+	.loc 1 69 9 view .LVU1992
+.LBB218:
+	.loc 1 69 14 view .LVU1993
+# Lib/munit_test/test_protocols/test_collection.c:69:         assert_obj(yp_in(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 69 39 is_stmt 0 view .LVU1994
+	movq	%rbx, %rsi	# self,
+	movq	%rbx, %rdi	# self,
+.LVL677:
+	.loc 1 69 39 view .LVU1995
+	call	yp_in@PLT	#
+.LVL678:
+	.loc 1 69 59 is_stmt 1 view .LVU1996
+# Lib/munit_test/test_protocols/test_collection.c:69:         assert_obj(yp_in(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 69 110 is_stmt 0 view .LVU1997
+	cmpl	$0, 116(%r14)	#, type_87->is_string
+	je	.L377	#,
+	movq	%r13, %rdx	# _ypmt_OBJ_b, iftmp.190_80
+.L341:
+.LVL679:
+	.loc 1 69 123 is_stmt 1 discriminator 4 view .LVU1998
+.LBB219:
+	.loc 1 69 128 discriminator 4 view .LVU1999
+# Lib/munit_test/test_protocols/test_collection.c:69:         assert_obj(yp_in(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 69 199 is_stmt 0 discriminator 4 view .LVU2000
+	cmpq	%rax, %rdx	# _ypmt_OBJ_a, iftmp.190_80
+	je	.L406	#,
+# Lib/munit_test/test_protocols/test_collection.c:69:         assert_obj(yp_in(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 69 199 view .LVU2001
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.191_81
+.L342:
+.LVL680:
+	.loc 1 69 212 is_stmt 1 discriminator 8 view .LVU2002
+	.loc 1 69 217 discriminator 8 view .LVU2003
+# Lib/munit_test/test_protocols/test_collection.c:69:         assert_obj(yp_in(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 69 220 is_stmt 0 discriminator 8 view .LVU2004
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.191_81
+	je	.L343	#,
+	.loc 1 69 259 is_stmt 1 discriminator 10 view .LVU2005
+# Lib/munit_test/test_protocols/test_collection.c:69:         assert_obj(yp_in(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 69 262 is_stmt 0 discriminator 10 view .LVU2006
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.191_81
+	je	.L407	#,
+	.loc 1 69 510 is_stmt 1 discriminator 12 view .LVU2007
+	.loc 1 69 515 discriminator 12 view .LVU2008
+	.loc 1 69 520 discriminator 12 view .LVU2009
+# Lib/munit_test/test_protocols/test_collection.c:69:         assert_obj(yp_in(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 69 524 is_stmt 0 discriminator 12 view .LVU2010
+	call	yp_isexceptionC@PLT	#
+.LVL681:
+# Lib/munit_test/test_protocols/test_collection.c:69:         assert_obj(yp_in(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 69 523 discriminator 12 view .LVU2011
+	testl	%eax, %eax	# tmp444
+	je	.L345	#,
+	.loc 1 69 561 is_stmt 1 discriminator 13 view .LVU2012
+	leaq	.LC61(%rip), %r8	#,
+	leaq	.LC63(%rip), %rcx	#, tmp348
+	leaq	.LC15(%rip), %rdx	#, tmp349
+	movl	$69, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp350
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL682:
+.L377:
+	.loc 1 69 561 is_stmt 0 discriminator 13 view .LVU2013
+.LBE219:
+# Lib/munit_test/test_protocols/test_collection.c:69:         assert_obj(yp_in(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 69 110 view .LVU2014
+	movq	%r15, %rdx	# _ypmt_OBJ_b, iftmp.190_80
+	jmp	.L341	#
+.LVL683:
+.L406:
+.LBB220:
+# Lib/munit_test/test_protocols/test_collection.c:69:         assert_obj(yp_in(self, self), is, type->is_string ? yp_True : yp_False);
+	.loc 1 69 199 view .LVU2015
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.191_81
+	jmp	.L342	#
+.LVL684:
+.L407:
+	.loc 1 69 295 is_stmt 1 discriminator 11 view .LVU2016
+	leaq	.LC61(%rip), %r8	#,
+	leaq	.LC63(%rip), %rcx	#, tmp345
+	leaq	.LC14(%rip), %rdx	#, tmp346
+.LVL685:
+	.loc 1 69 295 is_stmt 0 discriminator 11 view .LVU2017
+	movl	$69, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp347
+.LVL686:
+	.loc 1 69 295 discriminator 11 view .LVU2018
+	movl	$0, %eax	#,
+.LVL687:
+	.loc 1 69 295 discriminator 11 view .LVU2019
+	call	munit_errorf_ex@PLT	#
+.LVL688:
+.L345:
+	.loc 1 69 518 is_stmt 1 discriminator 14 view .LVU2020
+	.loc 1 69 786 discriminator 14 view .LVU2021
+	leaq	.LC61(%rip), %r8	#,
+	leaq	.LC63(%rip), %rcx	#, tmp351
+	leaq	.LC16(%rip), %rdx	#, tmp352
+	movl	$69, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp353
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL689:
+.L343:
+	.loc 1 69 252 view .LVU2022
+	.loc 1 69 513 view .LVU2023
+	.loc 1 69 215 view .LVU2024
+.LBE220:
+	.loc 1 69 126 view .LVU2025
+.LBE218:
+	.loc 1 69 12 view .LVU2026
+	.loc 1 70 9 view .LVU2027
+.LBB221:
+	.loc 1 70 14 view .LVU2028
+# Lib/munit_test/test_protocols/test_collection.c:70:         assert_obj(yp_not_in(self, self), is, type->is_string ? yp_False : yp_True);
+	.loc 1 70 39 is_stmt 0 view .LVU2029
+	movq	%rbx, %rsi	# self,
+	movq	%rbx, %rdi	# self,
+.LVL690:
+	.loc 1 70 39 view .LVU2030
+	call	yp_not_in@PLT	#
+.LVL691:
+	.loc 1 70 63 is_stmt 1 view .LVU2031
+# Lib/munit_test/test_protocols/test_collection.c:70:         assert_obj(yp_not_in(self, self), is, type->is_string ? yp_False : yp_True);
+	.loc 1 70 115 is_stmt 0 view .LVU2032
+	cmpl	$0, 116(%r14)	#, type_87->is_string
+	je	.L379	#,
+	movq	%r15, %rdx	# _ypmt_OBJ_b, iftmp.194_82
+.L346:
+.LVL692:
+	.loc 1 70 127 is_stmt 1 discriminator 4 view .LVU2033
+.LBB222:
+	.loc 1 70 132 discriminator 4 view .LVU2034
+# Lib/munit_test/test_protocols/test_collection.c:70:         assert_obj(yp_not_in(self, self), is, type->is_string ? yp_False : yp_True);
+	.loc 1 70 203 is_stmt 0 discriminator 4 view .LVU2035
+	cmpq	%rax, %rdx	# _ypmt_OBJ_a, iftmp.194_82
+	jne	.L380	#,
+# Lib/munit_test/test_protocols/test_collection.c:70:         assert_obj(yp_not_in(self, self), is, type->is_string ? yp_False : yp_True);
+	.loc 1 70 203 view .LVU2036
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.195_83
+.L347:
+.LVL693:
+	.loc 1 70 216 is_stmt 1 discriminator 8 view .LVU2037
+	.loc 1 70 221 discriminator 8 view .LVU2038
+# Lib/munit_test/test_protocols/test_collection.c:70:         assert_obj(yp_not_in(self, self), is, type->is_string ? yp_False : yp_True);
+	.loc 1 70 224 is_stmt 0 discriminator 8 view .LVU2039
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.195_83
+	je	.L348	#,
+	.loc 1 70 263 is_stmt 1 discriminator 10 view .LVU2040
+# Lib/munit_test/test_protocols/test_collection.c:70:         assert_obj(yp_not_in(self, self), is, type->is_string ? yp_False : yp_True);
+	.loc 1 70 266 is_stmt 0 discriminator 10 view .LVU2041
+	cmpq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.195_83
+	je	.L408	#,
+	.loc 1 70 518 is_stmt 1 discriminator 12 view .LVU2042
+	.loc 1 70 523 discriminator 12 view .LVU2043
+	.loc 1 70 528 discriminator 12 view .LVU2044
+# Lib/munit_test/test_protocols/test_collection.c:70:         assert_obj(yp_not_in(self, self), is, type->is_string ? yp_False : yp_True);
+	.loc 1 70 532 is_stmt 0 discriminator 12 view .LVU2045
+	call	yp_isexceptionC@PLT	#
+.LVL694:
+# Lib/munit_test/test_protocols/test_collection.c:70:         assert_obj(yp_not_in(self, self), is, type->is_string ? yp_False : yp_True);
+	.loc 1 70 531 discriminator 12 view .LVU2046
+	testl	%eax, %eax	# tmp446
+	je	.L350	#,
+	.loc 1 70 569 is_stmt 1 discriminator 13 view .LVU2047
+	leaq	.LC64(%rip), %r8	#,
+	leaq	.LC65(%rip), %rcx	#, tmp357
+	leaq	.LC15(%rip), %rdx	#, tmp358
+	movl	$70, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp359
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL695:
+.L379:
+	.loc 1 70 569 is_stmt 0 discriminator 13 view .LVU2048
+.LBE222:
+# Lib/munit_test/test_protocols/test_collection.c:70:         assert_obj(yp_not_in(self, self), is, type->is_string ? yp_False : yp_True);
+	.loc 1 70 115 view .LVU2049
+	movq	%r13, %rdx	# _ypmt_OBJ_b, iftmp.194_82
+	jmp	.L346	#
+.LVL696:
+.L380:
+.LBB223:
+# Lib/munit_test/test_protocols/test_collection.c:70:         assert_obj(yp_not_in(self, self), is, type->is_string ? yp_False : yp_True);
+	.loc 1 70 203 view .LVU2050
+	movq	%r15, %rdi	# _ypmt_OBJ_b, iftmp.195_83
+	jmp	.L347	#
+.LVL697:
+.L408:
+	.loc 1 70 299 is_stmt 1 discriminator 11 view .LVU2051
+	leaq	.LC64(%rip), %r8	#,
+	leaq	.LC65(%rip), %rcx	#, tmp354
+	leaq	.LC14(%rip), %rdx	#, tmp355
+.LVL698:
+	.loc 1 70 299 is_stmt 0 discriminator 11 view .LVU2052
+	movl	$70, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp356
+.LVL699:
+	.loc 1 70 299 discriminator 11 view .LVU2053
+	movl	$0, %eax	#,
+.LVL700:
+	.loc 1 70 299 discriminator 11 view .LVU2054
+	call	munit_errorf_ex@PLT	#
+.LVL701:
+.L350:
+	.loc 1 70 526 is_stmt 1 discriminator 14 view .LVU2055
+	.loc 1 70 798 discriminator 14 view .LVU2056
+	leaq	.LC64(%rip), %r8	#,
+	leaq	.LC65(%rip), %rcx	#, tmp360
+	leaq	.LC16(%rip), %rdx	#, tmp361
+	movl	$70, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp362
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL702:
+.L348:
+	.loc 1 70 256 view .LVU2057
+	.loc 1 70 521 view .LVU2058
+	.loc 1 70 219 view .LVU2059
+.LBE223:
+	.loc 1 70 130 view .LVU2060
+.LBE221:
+	.loc 1 70 12 view .LVU2061
+	.loc 1 71 9 view .LVU2062
+	movq	%rbx, %rsi	# self,
+	movl	$1, %edi	#,
+.LVL703:
+	.loc 1 71 9 is_stmt 0 view .LVU2063
+	movl	$0, %eax	#,
+.LVL704:
+	.loc 1 71 9 view .LVU2064
+	call	yp_decrefN@PLT	#
+.LVL705:
+	.loc 1 71 9 view .LVU2065
+.LBE214:
+.LBB224:
+	.loc 1 76 9 is_stmt 1 view .LVU2066
+# Lib/munit_test/test_protocols/test_collection.c:76:         ypObject *self = type->newN(N(items[0], items[1]));
+	.loc 1 76 26 is_stmt 0 view .LVU2067
+	movq	-72(%rbp), %rdx	# items[1],
+	movq	-80(%rbp), %rsi	# items[0],
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r14)	# type_87->newN
+.LVL706:
+	movq	%rax, %r13	# tmp447, self
+.LVL707:
+	.loc 1 77 9 is_stmt 1 view .LVU2068
+# Lib/munit_test/test_protocols/test_collection.c:77:         ypObject *empty = type->newN(0);
+	.loc 1 77 27 is_stmt 0 view .LVU2069
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+.LVL708:
+	.loc 1 77 27 view .LVU2070
+	call	*56(%r14)	# type_87->newN
+.LVL709:
+	movq	%rax, %r14	# tmp448, empty
+.LVL710:
+	.loc 1 78 9 is_stmt 1 view .LVU2071
+.LBB225:
+	.loc 1 78 14 view .LVU2072
+# Lib/munit_test/test_protocols/test_collection.c:78:         assert_isexception(yp_contains(self, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 78 43 is_stmt 0 view .LVU2073
+	movq	yp_SyntaxError(%rip), %rbx	# yp_SyntaxError, yp_SyntaxError.198_53
+.LVL711:
+	.loc 1 78 43 view .LVU2074
+	movq	%rbx, %rsi	# yp_SyntaxError.198_53,
+	movq	%r13, %rdi	# self,
+	call	yp_contains@PLT	#
+.LVL712:
+	.loc 1 78 43 view .LVU2075
+	movq	%rax, %r15	# tmp449, _ypmt_ISEXC_obj
+.LVL713:
+	.loc 1 78 79 is_stmt 1 view .LVU2076
+# Lib/munit_test/test_protocols/test_collection.c:78:         assert_isexception(yp_contains(self, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 78 89 is_stmt 0 view .LVU2077
+	movq	%rbx, -88(%rbp)	# yp_SyntaxError.198_53, MEM[(struct ypObject *[1] *)_264][0]
+	.loc 1 78 132 is_stmt 1 view .LVU2078
+.LVL714:
+	.loc 1 78 255 view .LVU2079
+	.loc 1 78 260 view .LVU2080
+	.loc 1 78 408 view .LVU2081
+# Lib/munit_test/test_protocols/test_collection.c:78:         assert_isexception(yp_contains(self, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 78 413 is_stmt 0 view .LVU2082
+	movq	%rax, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexceptionC@PLT	#
+.LVL715:
+# Lib/munit_test/test_protocols/test_collection.c:78:         assert_isexception(yp_contains(self, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 78 411 view .LVU2083
+	testl	%eax, %eax	# tmp450
+	jne	.L351	#,
+	.loc 1 78 449 is_stmt 1 discriminator 3 view .LVU2084
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC66(%rip), %rcx	#, tmp365
+	leaq	.LC46(%rip), %rdx	#, tmp366
+	movl	$78, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp367
+	call	munit_errorf_ex@PLT	#
+.LVL716:
+.L351:
+	.loc 1 78 645 discriminator 4 view .LVU2085
+# Lib/munit_test/test_protocols/test_collection.c:78:         assert_isexception(yp_contains(self, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 78 650 is_stmt 0 discriminator 4 view .LVU2086
+	leaq	-88(%rbp), %rdx	#, tmp368
+	movl	$1, %esi	#,
+	movq	%r15, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexception_arrayC@PLT	#
+.LVL717:
+# Lib/munit_test/test_protocols/test_collection.c:78:         assert_isexception(yp_contains(self, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 78 648 discriminator 4 view .LVU2087
+	testl	%eax, %eax	# tmp451
+	jne	.L352	#,
+	.loc 1 78 729 is_stmt 1 discriminator 5 view .LVU2088
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC66(%rip), %rcx	#, tmp369
+	leaq	.LC47(%rip), %rdx	#, tmp370
+	movl	$78, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp371
+	call	munit_errorf_ex@PLT	#
+.LVL718:
+.L352:
+	.loc 1 78 258 discriminator 6 view .LVU2089
+.LBE225:
+	.loc 1 78 12 discriminator 6 view .LVU2090
+	.loc 1 79 9 discriminator 6 view .LVU2091
+.LBB226:
+	.loc 1 79 14 discriminator 6 view .LVU2092
+# Lib/munit_test/test_protocols/test_collection.c:79:         assert_isexception(yp_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 79 43 is_stmt 0 discriminator 6 view .LVU2093
+	movq	%r13, %rsi	# self,
+	movq	%rbx, %rdi	# yp_SyntaxError.198_53,
+	call	yp_in@PLT	#
+.LVL719:
+	movq	%rax, %r15	# tmp452, _ypmt_ISEXC_obj
+.LVL720:
+	.loc 1 79 73 is_stmt 1 discriminator 6 view .LVU2094
+# Lib/munit_test/test_protocols/test_collection.c:79:         assert_isexception(yp_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 79 83 is_stmt 0 discriminator 6 view .LVU2095
+	movq	%rbx, -88(%rbp)	# yp_SyntaxError.198_53, MEM[(struct ypObject *[1] *)_264][0]
+	.loc 1 79 126 is_stmt 1 discriminator 6 view .LVU2096
+.LVL721:
+	.loc 1 79 249 discriminator 6 view .LVU2097
+	.loc 1 79 254 discriminator 6 view .LVU2098
+	.loc 1 79 402 discriminator 6 view .LVU2099
+# Lib/munit_test/test_protocols/test_collection.c:79:         assert_isexception(yp_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 79 407 is_stmt 0 discriminator 6 view .LVU2100
+	movq	%rax, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexceptionC@PLT	#
+.LVL722:
+# Lib/munit_test/test_protocols/test_collection.c:79:         assert_isexception(yp_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 79 405 discriminator 6 view .LVU2101
+	testl	%eax, %eax	# tmp453
+	jne	.L353	#,
+	.loc 1 79 443 is_stmt 1 discriminator 3 view .LVU2102
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC67(%rip), %rcx	#, tmp372
+	leaq	.LC46(%rip), %rdx	#, tmp373
+	movl	$79, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp374
+	call	munit_errorf_ex@PLT	#
+.LVL723:
+.L353:
+	.loc 1 79 633 discriminator 4 view .LVU2103
+# Lib/munit_test/test_protocols/test_collection.c:79:         assert_isexception(yp_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 79 638 is_stmt 0 discriminator 4 view .LVU2104
+	leaq	-88(%rbp), %rdx	#, tmp375
+	movl	$1, %esi	#,
+	movq	%r15, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexception_arrayC@PLT	#
+.LVL724:
+# Lib/munit_test/test_protocols/test_collection.c:79:         assert_isexception(yp_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 79 636 discriminator 4 view .LVU2105
+	testl	%eax, %eax	# tmp454
+	jne	.L354	#,
+	.loc 1 79 717 is_stmt 1 discriminator 5 view .LVU2106
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC67(%rip), %rcx	#, tmp376
+	leaq	.LC47(%rip), %rdx	#, tmp377
+	movl	$79, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp378
+	call	munit_errorf_ex@PLT	#
+.LVL725:
+.L354:
+	.loc 1 79 252 discriminator 6 view .LVU2107
+.LBE226:
+	.loc 1 79 12 discriminator 6 view .LVU2108
+	.loc 1 80 9 discriminator 6 view .LVU2109
+.LBB227:
+	.loc 1 80 14 discriminator 6 view .LVU2110
+# Lib/munit_test/test_protocols/test_collection.c:80:         assert_isexception(yp_not_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 80 43 is_stmt 0 discriminator 6 view .LVU2111
+	movq	%r13, %rsi	# self,
+	movq	%rbx, %rdi	# yp_SyntaxError.198_53,
+	call	yp_not_in@PLT	#
+.LVL726:
+	movq	%rax, %r15	# tmp455, _ypmt_ISEXC_obj
+.LVL727:
+	.loc 1 80 77 is_stmt 1 discriminator 6 view .LVU2112
+# Lib/munit_test/test_protocols/test_collection.c:80:         assert_isexception(yp_not_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 80 87 is_stmt 0 discriminator 6 view .LVU2113
+	movq	%rbx, -88(%rbp)	# yp_SyntaxError.198_53, MEM[(struct ypObject *[1] *)_264][0]
+	.loc 1 80 130 is_stmt 1 discriminator 6 view .LVU2114
+.LVL728:
+	.loc 1 80 253 discriminator 6 view .LVU2115
+	.loc 1 80 258 discriminator 6 view .LVU2116
+	.loc 1 80 406 discriminator 6 view .LVU2117
+# Lib/munit_test/test_protocols/test_collection.c:80:         assert_isexception(yp_not_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 80 411 is_stmt 0 discriminator 6 view .LVU2118
+	movq	%rax, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexceptionC@PLT	#
+.LVL729:
+# Lib/munit_test/test_protocols/test_collection.c:80:         assert_isexception(yp_not_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 80 409 discriminator 6 view .LVU2119
+	testl	%eax, %eax	# tmp456
+	jne	.L355	#,
+	.loc 1 80 447 is_stmt 1 discriminator 3 view .LVU2120
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC68(%rip), %rcx	#, tmp379
+	leaq	.LC46(%rip), %rdx	#, tmp380
+	movl	$80, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp381
+	call	munit_errorf_ex@PLT	#
+.LVL730:
+.L355:
+	.loc 1 80 641 discriminator 4 view .LVU2121
+# Lib/munit_test/test_protocols/test_collection.c:80:         assert_isexception(yp_not_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 80 646 is_stmt 0 discriminator 4 view .LVU2122
+	leaq	-88(%rbp), %rdx	#, tmp382
+	movl	$1, %esi	#,
+	movq	%r15, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexception_arrayC@PLT	#
+.LVL731:
+# Lib/munit_test/test_protocols/test_collection.c:80:         assert_isexception(yp_not_in(yp_SyntaxError, self), yp_SyntaxError);
+	.loc 1 80 644 discriminator 4 view .LVU2123
+	testl	%eax, %eax	# tmp457
+	jne	.L356	#,
+	.loc 1 80 725 is_stmt 1 discriminator 5 view .LVU2124
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC68(%rip), %rcx	#, tmp383
+	leaq	.LC47(%rip), %rdx	#, tmp384
+	movl	$80, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp385
+	call	munit_errorf_ex@PLT	#
+.LVL732:
+.L356:
+	.loc 1 80 256 discriminator 6 view .LVU2125
+.LBE227:
+	.loc 1 80 12 discriminator 6 view .LVU2126
+	.loc 1 81 9 discriminator 6 view .LVU2127
+.LBB228:
+	.loc 1 81 14 discriminator 6 view .LVU2128
+# Lib/munit_test/test_protocols/test_collection.c:81:         assert_isexception(yp_contains(empty, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 81 43 is_stmt 0 discriminator 6 view .LVU2129
+	movq	%rbx, %rsi	# yp_SyntaxError.198_53,
+	movq	%r14, %rdi	# empty,
+	call	yp_contains@PLT	#
+.LVL733:
+	movq	%rax, %r15	# tmp458, _ypmt_ISEXC_obj
+.LVL734:
+	.loc 1 81 80 is_stmt 1 discriminator 6 view .LVU2130
+# Lib/munit_test/test_protocols/test_collection.c:81:         assert_isexception(yp_contains(empty, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 81 90 is_stmt 0 discriminator 6 view .LVU2131
+	movq	%rbx, -88(%rbp)	# yp_SyntaxError.198_53, MEM[(struct ypObject *[1] *)_264][0]
+	.loc 1 81 133 is_stmt 1 discriminator 6 view .LVU2132
+.LVL735:
+	.loc 1 81 256 discriminator 6 view .LVU2133
+	.loc 1 81 261 discriminator 6 view .LVU2134
+	.loc 1 81 409 discriminator 6 view .LVU2135
+# Lib/munit_test/test_protocols/test_collection.c:81:         assert_isexception(yp_contains(empty, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 81 414 is_stmt 0 discriminator 6 view .LVU2136
+	movq	%rax, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexceptionC@PLT	#
+.LVL736:
+# Lib/munit_test/test_protocols/test_collection.c:81:         assert_isexception(yp_contains(empty, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 81 412 discriminator 6 view .LVU2137
+	testl	%eax, %eax	# tmp459
+	jne	.L357	#,
+	.loc 1 81 450 is_stmt 1 discriminator 3 view .LVU2138
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC69(%rip), %rcx	#, tmp386
+	leaq	.LC46(%rip), %rdx	#, tmp387
+	movl	$81, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp388
+	call	munit_errorf_ex@PLT	#
+.LVL737:
+.L357:
+	.loc 1 81 647 discriminator 4 view .LVU2139
+# Lib/munit_test/test_protocols/test_collection.c:81:         assert_isexception(yp_contains(empty, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 81 652 is_stmt 0 discriminator 4 view .LVU2140
+	leaq	-88(%rbp), %rdx	#, tmp389
+	movl	$1, %esi	#,
+	movq	%r15, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexception_arrayC@PLT	#
+.LVL738:
+# Lib/munit_test/test_protocols/test_collection.c:81:         assert_isexception(yp_contains(empty, yp_SyntaxError), yp_SyntaxError);
+	.loc 1 81 650 discriminator 4 view .LVU2141
+	testl	%eax, %eax	# tmp460
+	jne	.L358	#,
+	.loc 1 81 731 is_stmt 1 discriminator 5 view .LVU2142
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC69(%rip), %rcx	#, tmp390
+	leaq	.LC47(%rip), %rdx	#, tmp391
+	movl	$81, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp392
+	call	munit_errorf_ex@PLT	#
+.LVL739:
+.L358:
+	.loc 1 81 259 discriminator 6 view .LVU2143
+.LBE228:
+	.loc 1 81 12 discriminator 6 view .LVU2144
+	.loc 1 82 9 discriminator 6 view .LVU2145
+.LBB229:
+	.loc 1 82 14 discriminator 6 view .LVU2146
+# Lib/munit_test/test_protocols/test_collection.c:82:         assert_isexception(yp_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 82 43 is_stmt 0 discriminator 6 view .LVU2147
+	movq	%r14, %rsi	# empty,
+	movq	%rbx, %rdi	# yp_SyntaxError.198_53,
+	call	yp_in@PLT	#
+.LVL740:
+	movq	%rax, %r15	# tmp461, _ypmt_ISEXC_obj
+.LVL741:
+	.loc 1 82 74 is_stmt 1 discriminator 6 view .LVU2148
+# Lib/munit_test/test_protocols/test_collection.c:82:         assert_isexception(yp_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 82 84 is_stmt 0 discriminator 6 view .LVU2149
+	movq	%rbx, -88(%rbp)	# yp_SyntaxError.198_53, MEM[(struct ypObject *[1] *)_264][0]
+	.loc 1 82 127 is_stmt 1 discriminator 6 view .LVU2150
+.LVL742:
+	.loc 1 82 250 discriminator 6 view .LVU2151
+	.loc 1 82 255 discriminator 6 view .LVU2152
+	.loc 1 82 403 discriminator 6 view .LVU2153
+# Lib/munit_test/test_protocols/test_collection.c:82:         assert_isexception(yp_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 82 408 is_stmt 0 discriminator 6 view .LVU2154
+	movq	%rax, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexceptionC@PLT	#
+.LVL743:
+# Lib/munit_test/test_protocols/test_collection.c:82:         assert_isexception(yp_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 82 406 discriminator 6 view .LVU2155
+	testl	%eax, %eax	# tmp462
+	jne	.L359	#,
+	.loc 1 82 444 is_stmt 1 discriminator 3 view .LVU2156
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC70(%rip), %rcx	#, tmp393
+	leaq	.LC46(%rip), %rdx	#, tmp394
+	movl	$82, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp395
+	call	munit_errorf_ex@PLT	#
+.LVL744:
+.L359:
+	.loc 1 82 635 discriminator 4 view .LVU2157
+# Lib/munit_test/test_protocols/test_collection.c:82:         assert_isexception(yp_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 82 640 is_stmt 0 discriminator 4 view .LVU2158
+	leaq	-88(%rbp), %rdx	#, tmp396
+	movl	$1, %esi	#,
+	movq	%r15, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexception_arrayC@PLT	#
+.LVL745:
+# Lib/munit_test/test_protocols/test_collection.c:82:         assert_isexception(yp_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 82 638 discriminator 4 view .LVU2159
+	testl	%eax, %eax	# tmp463
+	jne	.L360	#,
+	.loc 1 82 719 is_stmt 1 discriminator 5 view .LVU2160
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC70(%rip), %rcx	#, tmp397
+	leaq	.LC47(%rip), %rdx	#, tmp398
+	movl	$82, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp399
+	call	munit_errorf_ex@PLT	#
+.LVL746:
+.L360:
+	.loc 1 82 253 discriminator 6 view .LVU2161
+.LBE229:
+	.loc 1 82 12 discriminator 6 view .LVU2162
+	.loc 1 83 9 discriminator 6 view .LVU2163
+.LBB230:
+	.loc 1 83 14 discriminator 6 view .LVU2164
+# Lib/munit_test/test_protocols/test_collection.c:83:         assert_isexception(yp_not_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 83 43 is_stmt 0 discriminator 6 view .LVU2165
+	movq	%r14, %rsi	# empty,
+	movq	%rbx, %rdi	# yp_SyntaxError.198_53,
+	call	yp_not_in@PLT	#
+.LVL747:
+	movq	%rax, %r15	# tmp464, _ypmt_ISEXC_obj
+.LVL748:
+	.loc 1 83 78 is_stmt 1 discriminator 6 view .LVU2166
+# Lib/munit_test/test_protocols/test_collection.c:83:         assert_isexception(yp_not_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 83 88 is_stmt 0 discriminator 6 view .LVU2167
+	movq	%rbx, -88(%rbp)	# yp_SyntaxError.198_53, MEM[(struct ypObject *[1] *)_264][0]
+	.loc 1 83 131 is_stmt 1 discriminator 6 view .LVU2168
+.LVL749:
+	.loc 1 83 254 discriminator 6 view .LVU2169
+	.loc 1 83 259 discriminator 6 view .LVU2170
+	.loc 1 83 407 discriminator 6 view .LVU2171
+# Lib/munit_test/test_protocols/test_collection.c:83:         assert_isexception(yp_not_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 83 412 is_stmt 0 discriminator 6 view .LVU2172
+	movq	%rax, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexceptionC@PLT	#
+.LVL750:
+# Lib/munit_test/test_protocols/test_collection.c:83:         assert_isexception(yp_not_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 83 410 discriminator 6 view .LVU2173
+	testl	%eax, %eax	# tmp465
+	jne	.L361	#,
+	.loc 1 83 448 is_stmt 1 discriminator 3 view .LVU2174
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC71(%rip), %rcx	#, tmp400
+	leaq	.LC46(%rip), %rdx	#, tmp401
+	movl	$83, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp402
+	call	munit_errorf_ex@PLT	#
+.LVL751:
+.L361:
+	.loc 1 83 643 discriminator 4 view .LVU2175
+# Lib/munit_test/test_protocols/test_collection.c:83:         assert_isexception(yp_not_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 83 648 is_stmt 0 discriminator 4 view .LVU2176
+	leaq	-88(%rbp), %rdx	#, tmp403
+	movl	$1, %esi	#,
+	movq	%r15, %rdi	# _ypmt_ISEXC_obj,
+	call	yp_isexception_arrayC@PLT	#
+.LVL752:
+# Lib/munit_test/test_protocols/test_collection.c:83:         assert_isexception(yp_not_in(yp_SyntaxError, empty), yp_SyntaxError);
+	.loc 1 83 646 discriminator 4 view .LVU2177
+	testl	%eax, %eax	# tmp466
+	jne	.L362	#,
+	.loc 1 83 727 is_stmt 1 discriminator 5 view .LVU2178
+	leaq	.LC44(%rip), %r8	#,
+	leaq	.LC71(%rip), %rcx	#, tmp404
+	leaq	.LC47(%rip), %rdx	#, tmp405
+	movl	$83, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp406
+	call	munit_errorf_ex@PLT	#
+.LVL753:
+.L362:
+	.loc 1 83 257 discriminator 6 view .LVU2179
+.LBE230:
+	.loc 1 83 12 discriminator 6 view .LVU2180
+	.loc 1 84 9 discriminator 6 view .LVU2181
+	movq	%r14, %rdx	# empty,
+	movq	%r13, %rsi	# self,
+	movl	$2, %edi	#,
+	movl	$0, %eax	#,
+	call	yp_decrefN@PLT	#
+.LVL754:
+.LBE224:
+	.loc 1 87 5 discriminator 6 view .LVU2182
+	leaq	-80(%rbp), %rsi	#, tmp407
+	movl	$4, %edi	#,
+	call	obj_array_decref2@PLT	#
+.LVL755:
+	.loc 1 88 5 discriminator 6 view .LVU2183
+	movq	%r12, %rdi	# uq,
+	call	uniqueness_dealloc@PLT	#
+.LVL756:
+	.loc 1 89 5 discriminator 6 view .LVU2184
+# Lib/munit_test/test_protocols/test_collection.c:90: }
+	.loc 1 90 1 is_stmt 0 discriminator 6 view .LVU2185
+	movl	$0, %eax	#,
+	addq	$56, %rsp	#,
+	popq	%rbx	#
+	popq	%r12	#
+.LVL757:
+	.loc 1 90 1 discriminator 6 view .LVU2186
+	popq	%r13	#
+.LVL758:
+	.loc 1 90 1 discriminator 6 view .LVU2187
+	popq	%r14	#
+.LVL759:
+	.loc 1 90 1 discriminator 6 view .LVU2188
+	popq	%r15	#
+.LVL760:
+	.loc 1 90 1 discriminator 6 view .LVU2189
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE23:
+	.size	test_contains, .-test_contains
+	.section	.rodata.str1.1
+.LC72:
+	.string	"yp_bool(x)"
+	.text
+	.type	test_bool, @function
+test_bool:
+.LVL761:
+.LFB22:
+	.loc 1 6 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 6 1 is_stmt 0 view .LVU2191
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	subq	$16, %rsp	#,
+	.cfi_offset 14, -24
+	.cfi_offset 13, -32
+	.cfi_offset 12, -40
+	.cfi_offset 3, -48
+	.loc 1 7 5 is_stmt 1 view .LVU2192
+# Lib/munit_test/test_protocols/test_collection.c:7:     fixture_type_t *type = fixture->type;
+	.loc 1 7 21 is_stmt 0 view .LVU2193
+	movq	(%rsi), %r14	# fixture_11(D)->type, type
+.LVL762:
+	.loc 1 8 5 is_stmt 1 view .LVU2194
+# Lib/munit_test/test_protocols/test_collection.c:8:     uniqueness_t   *uq = uniqueness_new();
+	.loc 1 8 24 is_stmt 0 view .LVU2195
+	call	uniqueness_new@PLT	#
+.LVL763:
+	.loc 1 8 24 view .LVU2196
+	movq	%rax, %r12	# tmp126, uq
+.LVL764:
+	.loc 1 9 5 is_stmt 1 view .LVU2197
+	.loc 1 10 5 view .LVU2198
+# Lib/munit_test/test_protocols/test_collection.c:10:     obj_array_fill(items, uq, type->rand_items);
+	.loc 1 10 10 is_stmt 0 view .LVU2199
+	leaq	-40(%rbp), %rdx	#, tmp102
+	movl	$1, %esi	#,
+	movq	%rax, %rdi	# uq,
+	call	*64(%r14)	# type_12->rand_items
+.LVL765:
+	.loc 1 13 5 is_stmt 1 view .LVU2200
+.LBB231:
+	.loc 1 13 10 view .LVU2201
+# Lib/munit_test/test_protocols/test_collection.c:13:     ead(x, type->newN(1, items[0]), assert_obj(yp_bool(x), is, yp_True));
+	.loc 1 13 27 is_stmt 0 view .LVU2202
+	movq	-40(%rbp), %rsi	# items[0],
+	movl	$1, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r14)	# type_12->newN
+.LVL766:
+	movq	%rax, %rbx	# tmp127, x
+.LVL767:
+	.loc 1 13 53 is_stmt 1 view .LVU2203
+.LBB232:
+	.loc 1 13 58 view .LVU2204
+# Lib/munit_test/test_protocols/test_collection.c:13:     ead(x, type->newN(1, items[0]), assert_obj(yp_bool(x), is, yp_True));
+	.loc 1 13 83 is_stmt 0 view .LVU2205
+	movq	%rax, %rdi	# x,
+	call	yp_bool@PLT	#
+.LVL768:
+	.loc 1 13 96 is_stmt 1 view .LVU2206
+# Lib/munit_test/test_protocols/test_collection.c:13:     ead(x, type->newN(1, items[0]), assert_obj(yp_bool(x), is, yp_True));
+	.loc 1 13 106 is_stmt 0 view .LVU2207
+	movq	yp_True(%rip), %r13	# yp_True, _ypmt_OBJ_b
+.LVL769:
+	.loc 1 13 131 is_stmt 1 view .LVU2208
+.LBB233:
+	.loc 1 13 136 view .LVU2209
+# Lib/munit_test/test_protocols/test_collection.c:13:     ead(x, type->newN(1, items[0]), assert_obj(yp_bool(x), is, yp_True));
+	.loc 1 13 207 is_stmt 0 view .LVU2210
+	cmpq	%rax, %r13	# tmp128, _ypmt_OBJ_b
+	je	.L418	#,
+# Lib/munit_test/test_protocols/test_collection.c:13:     ead(x, type->newN(1, items[0]), assert_obj(yp_bool(x), is, yp_True));
+	.loc 1 13 207 discriminator 2 view .LVU2211
+	movq	yp_False(%rip), %rdi	# yp_False, iftmp.210_8
+.L410:
+.LVL770:
+	.loc 1 13 220 is_stmt 1 discriminator 4 view .LVU2212
+	.loc 1 13 225 discriminator 4 view .LVU2213
+# Lib/munit_test/test_protocols/test_collection.c:13:     ead(x, type->newN(1, items[0]), assert_obj(yp_bool(x), is, yp_True));
+	.loc 1 13 228 is_stmt 0 discriminator 4 view .LVU2214
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.210_8
+	je	.L411	#,
+	.loc 1 13 267 is_stmt 1 discriminator 6 view .LVU2215
+# Lib/munit_test/test_protocols/test_collection.c:13:     ead(x, type->newN(1, items[0]), assert_obj(yp_bool(x), is, yp_True));
+	.loc 1 13 270 is_stmt 0 discriminator 6 view .LVU2216
+	cmpq	%rdi, yp_False(%rip)	# iftmp.210_8, yp_False
+	je	.L421	#,
+	.loc 1 13 482 is_stmt 1 discriminator 8 view .LVU2217
+	.loc 1 13 487 discriminator 8 view .LVU2218
+	.loc 1 13 492 discriminator 8 view .LVU2219
+# Lib/munit_test/test_protocols/test_collection.c:13:     ead(x, type->newN(1, items[0]), assert_obj(yp_bool(x), is, yp_True));
+	.loc 1 13 496 is_stmt 0 discriminator 8 view .LVU2220
+	call	yp_isexceptionC@PLT	#
+.LVL771:
+# Lib/munit_test/test_protocols/test_collection.c:13:     ead(x, type->newN(1, items[0]), assert_obj(yp_bool(x), is, yp_True));
+	.loc 1 13 495 discriminator 8 view .LVU2221
+	testl	%eax, %eax	# tmp129
+	je	.L413	#,
+	.loc 1 13 533 is_stmt 1 discriminator 9 view .LVU2222
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC72(%rip), %rcx	#, tmp108
+	leaq	.LC15(%rip), %rdx	#, tmp109
+	movl	$13, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp110
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL772:
+.L418:
+# Lib/munit_test/test_protocols/test_collection.c:13:     ead(x, type->newN(1, items[0]), assert_obj(yp_bool(x), is, yp_True));
+	.loc 1 13 207 is_stmt 0 view .LVU2223
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.210_8
+	jmp	.L410	#
+.LVL773:
+.L421:
+	.loc 1 13 303 is_stmt 1 discriminator 7 view .LVU2224
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC72(%rip), %rcx	#, tmp105
+	leaq	.LC14(%rip), %rdx	#, tmp106
+	movl	$13, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp107
+.LVL774:
+	.loc 1 13 303 is_stmt 0 discriminator 7 view .LVU2225
+	movl	$0, %eax	#,
+.LVL775:
+	.loc 1 13 303 discriminator 7 view .LVU2226
+	call	munit_errorf_ex@PLT	#
+.LVL776:
+.L413:
+	.loc 1 13 490 is_stmt 1 discriminator 10 view .LVU2227
+	.loc 1 13 722 discriminator 10 view .LVU2228
+	leaq	.LC12(%rip), %r8	#,
+	leaq	.LC72(%rip), %rcx	#, tmp111
+	leaq	.LC16(%rip), %rdx	#, tmp112
+	movl	$13, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp113
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL777:
+.L411:
+	.loc 1 13 260 view .LVU2229
+	.loc 1 13 485 view .LVU2230
+	.loc 1 13 223 view .LVU2231
+.LBE233:
+	.loc 1 13 134 view .LVU2232
+.LBE232:
+	.loc 1 13 56 view .LVU2233
+	.loc 1 13 947 view .LVU2234
+	movq	%rbx, %rdi	# x,
+.LVL778:
+	.loc 1 13 947 is_stmt 0 view .LVU2235
+	call	yp_decref@PLT	#
+.LVL779:
+	.loc 1 13 947 view .LVU2236
+.LBE231:
+	.loc 1 13 8 is_stmt 1 view .LVU2237
+	.loc 1 14 5 view .LVU2238
+.LBB234:
+	.loc 1 14 10 view .LVU2239
+# Lib/munit_test/test_protocols/test_collection.c:14:     ead(x, type->newN(0), assert_obj(yp_bool(x), is, yp_False));
+	.loc 1 14 27 is_stmt 0 view .LVU2240
+	movl	$0, %edi	#,
+	movl	$0, %eax	#,
+	call	*56(%r14)	# type_12->newN
+.LVL780:
+	movq	%rax, %rbx	# tmp130, x
+.LVL781:
+	.loc 1 14 43 is_stmt 1 view .LVU2241
+.LBB235:
+	.loc 1 14 48 view .LVU2242
+# Lib/munit_test/test_protocols/test_collection.c:14:     ead(x, type->newN(0), assert_obj(yp_bool(x), is, yp_False));
+	.loc 1 14 73 is_stmt 0 view .LVU2243
+	movq	%rax, %rdi	# x,
+	call	yp_bool@PLT	#
+.LVL782:
+	.loc 1 14 73 view .LVU2244
+	movq	%rax, %rdx	#, tmp131
+.LVL783:
+	.loc 1 14 86 is_stmt 1 view .LVU2245
+# Lib/munit_test/test_protocols/test_collection.c:14:     ead(x, type->newN(0), assert_obj(yp_bool(x), is, yp_False));
+	.loc 1 14 96 is_stmt 0 view .LVU2246
+	movq	yp_False(%rip), %rax	# yp_False, _ypmt_OBJ_b
+.LVL784:
+	.loc 1 14 122 is_stmt 1 view .LVU2247
+.LBB236:
+	.loc 1 14 127 view .LVU2248
+# Lib/munit_test/test_protocols/test_collection.c:14:     ead(x, type->newN(0), assert_obj(yp_bool(x), is, yp_False));
+	.loc 1 14 198 is_stmt 0 view .LVU2249
+	cmpq	%rdx, %rax	# tmp131, _ypmt_OBJ_b
+	je	.L422	#,
+	movq	%rax, %rdi	# _ypmt_OBJ_b, iftmp.213_9
+.L414:
+.LVL785:
+	.loc 1 14 211 is_stmt 1 discriminator 4 view .LVU2250
+	.loc 1 14 216 discriminator 4 view .LVU2251
+# Lib/munit_test/test_protocols/test_collection.c:14:     ead(x, type->newN(0), assert_obj(yp_bool(x), is, yp_False));
+	.loc 1 14 219 is_stmt 0 discriminator 4 view .LVU2252
+	cmpq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.213_9
+	je	.L415	#,
+	.loc 1 14 258 is_stmt 1 discriminator 6 view .LVU2253
+# Lib/munit_test/test_protocols/test_collection.c:14:     ead(x, type->newN(0), assert_obj(yp_bool(x), is, yp_False));
+	.loc 1 14 261 is_stmt 0 discriminator 6 view .LVU2254
+	cmpq	%rax, %rdi	# _ypmt_OBJ_b, iftmp.213_9
+	je	.L423	#,
+	.loc 1 14 474 is_stmt 1 discriminator 8 view .LVU2255
+	.loc 1 14 479 discriminator 8 view .LVU2256
+	.loc 1 14 484 discriminator 8 view .LVU2257
+# Lib/munit_test/test_protocols/test_collection.c:14:     ead(x, type->newN(0), assert_obj(yp_bool(x), is, yp_False));
+	.loc 1 14 488 is_stmt 0 discriminator 8 view .LVU2258
+	call	yp_isexceptionC@PLT	#
+.LVL786:
+# Lib/munit_test/test_protocols/test_collection.c:14:     ead(x, type->newN(0), assert_obj(yp_bool(x), is, yp_False));
+	.loc 1 14 487 discriminator 8 view .LVU2259
+	testl	%eax, %eax	# tmp132
+	je	.L417	#,
+	.loc 1 14 525 is_stmt 1 discriminator 9 view .LVU2260
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC72(%rip), %rcx	#, tmp117
+	leaq	.LC15(%rip), %rdx	#, tmp118
+	movl	$14, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp119
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL787:
+.L422:
+# Lib/munit_test/test_protocols/test_collection.c:14:     ead(x, type->newN(0), assert_obj(yp_bool(x), is, yp_False));
+	.loc 1 14 198 is_stmt 0 view .LVU2261
+	movq	%r13, %rdi	# _ypmt_OBJ_b, iftmp.213_9
+	jmp	.L414	#
+.LVL788:
+.L423:
+	.loc 1 14 294 is_stmt 1 discriminator 7 view .LVU2262
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC72(%rip), %rcx	#, tmp114
+	leaq	.LC14(%rip), %rdx	#, tmp115
+.LVL789:
+	.loc 1 14 294 is_stmt 0 discriminator 7 view .LVU2263
+	movl	$14, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp116
+.LVL790:
+	.loc 1 14 294 discriminator 7 view .LVU2264
+	movl	$0, %eax	#,
+.LVL791:
+	.loc 1 14 294 discriminator 7 view .LVU2265
+	call	munit_errorf_ex@PLT	#
+.LVL792:
+.L417:
+	.loc 1 14 482 is_stmt 1 discriminator 10 view .LVU2266
+	.loc 1 14 715 discriminator 10 view .LVU2267
+	leaq	.LC43(%rip), %r8	#,
+	leaq	.LC72(%rip), %rcx	#, tmp120
+	leaq	.LC16(%rip), %rdx	#, tmp121
+	movl	$14, %esi	#,
+	leaq	.LC3(%rip), %rdi	#, tmp122
+	movl	$0, %eax	#,
+	call	munit_errorf_ex@PLT	#
+.LVL793:
+.L415:
+	.loc 1 14 251 view .LVU2268
+	.loc 1 14 477 view .LVU2269
+	.loc 1 14 214 view .LVU2270
+.LBE236:
+	.loc 1 14 125 view .LVU2271
+.LBE235:
+	.loc 1 14 46 view .LVU2272
+	.loc 1 14 941 view .LVU2273
+	movq	%rbx, %rdi	# x,
+.LVL794:
+	.loc 1 14 941 is_stmt 0 view .LVU2274
+	call	yp_decref@PLT	#
+.LVL795:
+	.loc 1 14 941 view .LVU2275
+.LBE234:
+	.loc 1 14 8 is_stmt 1 view .LVU2276
+	.loc 1 16 5 view .LVU2277
+	leaq	-40(%rbp), %rsi	#, tmp123
+	movl	$1, %edi	#,
+	call	obj_array_decref2@PLT	#
+.LVL796:
+	.loc 1 17 5 view .LVU2278
+	movq	%r12, %rdi	# uq,
+	call	uniqueness_dealloc@PLT	#
+.LVL797:
+	.loc 1 18 5 view .LVU2279
+# Lib/munit_test/test_protocols/test_collection.c:19: }
+	.loc 1 19 1 is_stmt 0 view .LVU2280
+	movl	$0, %eax	#,
+	addq	$16, %rsp	#,
+	popq	%rbx	#
+.LVL798:
+	.loc 1 19 1 view .LVU2281
+	popq	%r12	#
+.LVL799:
+	.loc 1 19 1 view .LVU2282
+	popq	%r13	#
+.LVL800:
+	.loc 1 19 1 view .LVU2283
+	popq	%r14	#
+.LVL801:
+	.loc 1 19 1 view .LVU2284
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE22:
+	.size	test_bool, .-test_bool
+	.globl	test_collection_initialize
+	.hidden	test_collection_initialize
+	.type	test_collection_initialize, @function
+test_collection_initialize:
+.LFB27:
+	.loc 1 358 46 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 358 47 view .LVU2286
+	ret	
+	.cfi_endproc
+.LFE27:
+	.size	test_collection_initialize, .-test_collection_initialize
+	.hidden	test_collection_tests
+	.globl	test_collection_tests
+	.section	.rodata.str1.1
+.LC73:
+	.string	"/test_bool"
+.LC74:
+	.string	"/test_contains"
+.LC75:
+	.string	"/test_contains_manyC"
+.LC76:
+	.string	"/test_clear"
+.LC77:
+	.string	"/test_reserve"
+	.section	.data.rel,"aw"
+	.align 32
+	.type	test_collection_tests, @object
+	.size	test_collection_tests, 288
+test_collection_tests:
+# name:
+	.quad	.LC73
+# test:
+	.quad	test_bool
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	test_collection_params
+# name:
+	.quad	.LC74
+# test:
+	.quad	test_contains
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	test_collection_params
+# name:
+	.quad	.LC75
+# test:
+	.quad	test_contains_manyC
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	test_collection_params
+# name:
+	.quad	.LC76
+# test:
+	.quad	test_clear
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	test_collection_params
+# name:
+	.quad	.LC77
+# test:
+	.quad	test_reserve
+# setup:
+	.quad	fixture_setup
+# tear_down:
+	.quad	fixture_tear_down
+# options:
+	.long	0
+# parameters:
+	.zero	4
+	.quad	test_collection_params
+# name:
+	.quad	0
+	.zero	40
+	.align 32
+	.type	test_collection_params, @object
+	.size	test_collection_params, 32
+test_collection_params:
+# name:
+	.quad	param_key_type
+# values:
+	.quad	param_values_types_collection
+# name:
+	.quad	0
+	.zero	8
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 4 "./nohtyP.h"
+	.file 5 "Tools/munit/munit.h"
+	.file 6 "Lib/munit_test/unittest.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x7a04
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2e
+	.long	.LASF1746
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1578
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1579
+	.uleb128 0x2f
+	.byte	0x8
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1580
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1581
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1582
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1583
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1584
+	.uleb128 0x12
+	.long	0x5e
+	.long	0x7c
+	.uleb128 0x16
+	.long	0x32
+	.byte	0x1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1586
+	.byte	0x2
+	.byte	0xc2
+	.byte	0x12
+	.long	0x65
+	.uleb128 0xc
+	.long	0x8d
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1585
+	.uleb128 0x22
+	.long	0x8d
+	.uleb128 0x17
+	.long	.LASF1587
+	.byte	0x3
+	.byte	0x6c
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1588
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1589
+	.uleb128 0x17
+	.long	.LASF1590
+	.byte	0x4
+	.byte	0x8b
+	.byte	0x1a
+	.long	0xbf
+	.uleb128 0x23
+	.long	.LASF1643
+	.byte	0x20
+	.byte	0x4
+	.value	0x944
+	.byte	0x8
+	.long	0x13e
+	.uleb128 0x9
+	.long	.LASF1591
+	.byte	0x4
+	.value	0x945
+	.byte	0x13
+	.long	0x21e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1592
+	.byte	0x4
+	.value	0x946
+	.byte	0x10
+	.long	0x154
+	.byte	0x2
+	.uleb128 0x9
+	.long	.LASF1593
+	.byte	0x4
+	.value	0x947
+	.byte	0x10
+	.long	0x154
+	.byte	0x3
+	.uleb128 0x9
+	.long	.LASF1594
+	.byte	0x4
+	.value	0x948
+	.byte	0x11
+	.long	0x178
+	.byte	0x4
+	.uleb128 0x9
+	.long	.LASF1595
+	.byte	0x4
+	.value	0x949
+	.byte	0x12
+	.long	0x22b
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF1596
+	.byte	0x4
+	.value	0x94a
+	.byte	0x12
+	.long	0x22b
+	.byte	0xc
+	.uleb128 0x9
+	.long	.LASF1597
+	.byte	0x4
+	.value	0x94b
+	.byte	0xf
+	.long	0x1aa
+	.byte	0x10
+	.uleb128 0x9
+	.long	.LASF1598
+	.byte	0x4
+	.value	0x94c
+	.byte	0xb
+	.long	0x40
+	.byte	0x18
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1608
+	.byte	0x4
+	.byte	0x8e
+	.byte	0x3f
+	.long	0x14f
+	.uleb128 0xc
+	.long	0xb3
+	.uleb128 0x22
+	.long	0x14a
+	.uleb128 0x17
+	.long	.LASF1599
+	.byte	0x4
+	.byte	0xb0
+	.byte	0x17
+	.long	0x42
+	.uleb128 0x17
+	.long	.LASF1600
+	.byte	0x4
+	.byte	0xb2
+	.byte	0x18
+	.long	0x49
+	.uleb128 0x17
+	.long	.LASF1601
+	.byte	0x4
+	.byte	0xb4
+	.byte	0xd
+	.long	0x5e
+	.uleb128 0x17
+	.long	.LASF1602
+	.byte	0x4
+	.byte	0xb5
+	.byte	0x16
+	.long	0x39
+	.uleb128 0x17
+	.long	.LASF1603
+	.byte	0x4
+	.byte	0xbb
+	.byte	0x1c
+	.long	0xa5
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1604
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1605
+	.uleb128 0x17
+	.long	.LASF1606
+	.byte	0x4
+	.byte	0xc1
+	.byte	0x11
+	.long	0x99
+	.uleb128 0x17
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0xcb
+	.byte	0x14
+	.long	0x19e
+	.uleb128 0x19
+	.long	.LASF1609
+	.byte	0x4
+	.value	0x1bf
+	.byte	0x3f
+	.long	0x14f
+	.uleb128 0x19
+	.long	.LASF1610
+	.byte	0x4
+	.value	0x1c0
+	.byte	0x3f
+	.long	0x14f
+	.uleb128 0xc
+	.long	0x14f
+	.uleb128 0x19
+	.long	.LASF1611
+	.byte	0x4
+	.value	0x776
+	.byte	0x3f
+	.long	0x14f
+	.uleb128 0x19
+	.long	.LASF1612
+	.byte	0x4
+	.value	0x77d
+	.byte	0x3f
+	.long	0x14f
+	.uleb128 0x19
+	.long	.LASF1613
+	.byte	0x4
+	.value	0x787
+	.byte	0x3f
+	.long	0x14f
+	.uleb128 0x19
+	.long	.LASF1614
+	.byte	0x4
+	.value	0x789
+	.byte	0x3f
+	.long	0x14f
+	.uleb128 0xc
+	.long	0x19e
+	.uleb128 0x29
+	.long	0x219
+	.uleb128 0x7
+	.long	0x40
+	.byte	0
+	.uleb128 0xc
+	.long	0x20e
+	.uleb128 0xd
+	.long	.LASF1615
+	.byte	0x4
+	.value	0x942
+	.byte	0x15
+	.long	0x160
+	.uleb128 0xd
+	.long	.LASF1616
+	.byte	0x4
+	.value	0x943
+	.byte	0x14
+	.long	0x16c
+	.uleb128 0xc
+	.long	0x23d
+	.uleb128 0x32
+	.uleb128 0xc
+	.long	0x94
+	.uleb128 0x2a
+	.long	0x39
+	.value	0x195
+	.long	0x267
+	.uleb128 0x1c
+	.long	.LASF1617
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1618
+	.byte	0x1
+	.uleb128 0x1c
+	.long	.LASF1619
+	.byte	0x2
+	.uleb128 0x1c
+	.long	.LASF1620
+	.byte	0x3
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1621
+	.byte	0x5
+	.value	0x1a0
+	.byte	0x3
+	.long	0x243
+	.uleb128 0x26
+	.byte	0x10
+	.value	0x1a2
+	.long	0x299
+	.uleb128 0x9
+	.long	.LASF1622
+	.byte	0x5
+	.value	0x1a3
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1623
+	.byte	0x5
+	.value	0x1a4
+	.byte	0xa
+	.long	0x299
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.long	0x88
+	.uleb128 0xd
+	.long	.LASF1624
+	.byte	0x5
+	.value	0x1a5
+	.byte	0x3
+	.long	0x274
+	.uleb128 0x26
+	.byte	0x10
+	.value	0x1a7
+	.long	0x2d0
+	.uleb128 0x9
+	.long	.LASF1622
+	.byte	0x5
+	.value	0x1a8
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1625
+	.byte	0x5
+	.value	0x1a9
+	.byte	0x9
+	.long	0x88
+	.byte	0x8
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1626
+	.byte	0x5
+	.value	0x1aa
+	.byte	0x3
+	.long	0x2ab
+	.uleb128 0x22
+	.long	0x2d0
+	.uleb128 0x2a
+	.long	0x39
+	.value	0x1ae
+	.long	0x300
+	.uleb128 0x1c
+	.long	.LASF1627
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1628
+	.byte	0x1
+	.uleb128 0x1c
+	.long	.LASF1629
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1630
+	.byte	0x5
+	.value	0x1b2
+	.byte	0x3
+	.long	0x2e2
+	.uleb128 0xd
+	.long	.LASF1631
+	.byte	0x5
+	.value	0x1b4
+	.byte	0x18
+	.long	0x31a
+	.uleb128 0xc
+	.long	0x31f
+	.uleb128 0x1e
+	.long	0x267
+	.long	0x333
+	.uleb128 0x7
+	.long	0x333
+	.uleb128 0x7
+	.long	0x40
+	.byte	0
+	.uleb128 0xc
+	.long	0x2dd
+	.uleb128 0xd
+	.long	.LASF1632
+	.byte	0x5
+	.value	0x1b5
+	.byte	0x12
+	.long	0x345
+	.uleb128 0xc
+	.long	0x34a
+	.uleb128 0x1e
+	.long	0x40
+	.long	0x35e
+	.uleb128 0x7
+	.long	0x333
+	.uleb128 0x7
+	.long	0x40
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1633
+	.byte	0x5
+	.value	0x1b6
+	.byte	0x11
+	.long	0x219
+	.uleb128 0x26
+	.byte	0x30
+	.value	0x1b8
+	.long	0x3c8
+	.uleb128 0x9
+	.long	.LASF1622
+	.byte	0x5
+	.value	0x1b9
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1634
+	.byte	0x5
+	.value	0x1ba
+	.byte	0x11
+	.long	0x30d
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF1635
+	.byte	0x5
+	.value	0x1bb
+	.byte	0x12
+	.long	0x338
+	.byte	0x10
+	.uleb128 0x9
+	.long	.LASF1636
+	.byte	0x5
+	.value	0x1bc
+	.byte	0x15
+	.long	0x35e
+	.byte	0x18
+	.uleb128 0x9
+	.long	.LASF1637
+	.byte	0x5
+	.value	0x1bd
+	.byte	0x14
+	.long	0x300
+	.byte	0x20
+	.uleb128 0x9
+	.long	.LASF1638
+	.byte	0x5
+	.value	0x1be
+	.byte	0x17
+	.long	0x3c8
+	.byte	0x28
+	.byte	0
+	.uleb128 0xc
+	.long	0x29e
+	.uleb128 0xd
+	.long	.LASF1639
+	.byte	0x5
+	.value	0x1bf
+	.byte	0x3
+	.long	0x36b
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1640
+	.uleb128 0x10
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1641
+	.uleb128 0xd
+	.long	.LASF1642
+	.byte	0x6
+	.value	0x371
+	.byte	0x20
+	.long	0x3f5
+	.uleb128 0x23
+	.long	.LASF1644
+	.byte	0x90
+	.byte	0x6
+	.value	0x37f
+	.byte	0x10
+	.long	0x554
+	.uleb128 0x9
+	.long	.LASF1622
+	.byte	0x6
+	.value	0x380
+	.byte	0xb
+	.long	0x88
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1645
+	.byte	0x6
+	.value	0x381
+	.byte	0xf
+	.long	0x14a
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF1646
+	.byte	0x6
+	.value	0x382
+	.byte	0xf
+	.long	0x14a
+	.byte	0x10
+	.uleb128 0x9
+	.long	.LASF1647
+	.byte	0x6
+	.value	0x383
+	.byte	0x15
+	.long	0x65d
+	.byte	0x18
+	.uleb128 0x9
+	.long	.LASF1648
+	.byte	0x6
+	.value	0x385
+	.byte	0x1c
+	.long	0x5f4
+	.byte	0x20
+	.uleb128 0x9
+	.long	.LASF1649
+	.byte	0x6
+	.value	0x387
+	.byte	0x10
+	.long	0x59a
+	.byte	0x28
+	.uleb128 0x9
+	.long	.LASF1650
+	.byte	0x6
+	.value	0x388
+	.byte	0x12
+	.long	0x662
+	.byte	0x30
+	.uleb128 0x9
+	.long	.LASF1651
+	.byte	0x6
+	.value	0x38d
+	.byte	0x13
+	.long	0x5bb
+	.byte	0x38
+	.uleb128 0x9
+	.long	.LASF1652
+	.byte	0x6
+	.value	0x38e
+	.byte	0x14
+	.long	0x62c
+	.byte	0x40
+	.uleb128 0x9
+	.long	.LASF1653
+	.byte	0x6
+	.value	0x393
+	.byte	0x13
+	.long	0x5bb
+	.byte	0x48
+	.uleb128 0x9
+	.long	.LASF1654
+	.byte	0x6
+	.value	0x394
+	.byte	0x14
+	.long	0x62c
+	.byte	0x50
+	.uleb128 0x9
+	.long	.LASF1655
+	.byte	0x6
+	.value	0x398
+	.byte	0x14
+	.long	0x62c
+	.byte	0x58
+	.uleb128 0x9
+	.long	.LASF1656
+	.byte	0x6
+	.value	0x39b
+	.byte	0x9
+	.long	0x5e
+	.byte	0x60
+	.uleb128 0x9
+	.long	.LASF1657
+	.byte	0x6
+	.value	0x39c
+	.byte	0x9
+	.long	0x5e
+	.byte	0x64
+	.uleb128 0x9
+	.long	.LASF1658
+	.byte	0x6
+	.value	0x39d
+	.byte	0x9
+	.long	0x5e
+	.byte	0x68
+	.uleb128 0x9
+	.long	.LASF1659
+	.byte	0x6
+	.value	0x39e
+	.byte	0x9
+	.long	0x5e
+	.byte	0x6c
+	.uleb128 0x9
+	.long	.LASF1660
+	.byte	0x6
+	.value	0x39f
+	.byte	0x9
+	.long	0x5e
+	.byte	0x70
+	.uleb128 0x9
+	.long	.LASF1661
+	.byte	0x6
+	.value	0x3a0
+	.byte	0x9
+	.long	0x5e
+	.byte	0x74
+	.uleb128 0x9
+	.long	.LASF1662
+	.byte	0x6
+	.value	0x3a1
+	.byte	0x9
+	.long	0x5e
+	.byte	0x78
+	.uleb128 0x9
+	.long	.LASF1663
+	.byte	0x6
+	.value	0x3a2
+	.byte	0x9
+	.long	0x5e
+	.byte	0x7c
+	.uleb128 0x9
+	.long	.LASF1664
+	.byte	0x6
+	.value	0x3a3
+	.byte	0x9
+	.long	0x5e
+	.byte	0x80
+	.uleb128 0x9
+	.long	.LASF1665
+	.byte	0x6
+	.value	0x3a4
+	.byte	0x9
+	.long	0x5e
+	.byte	0x84
+	.uleb128 0x9
+	.long	.LASF1666
+	.byte	0x6
+	.value	0x3a5
+	.byte	0x9
+	.long	0x5e
+	.byte	0x88
+	.uleb128 0x9
+	.long	.LASF1667
+	.byte	0x6
+	.value	0x3a6
+	.byte	0x9
+	.long	0x5e
+	.byte	0x8c
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1668
+	.byte	0x6
+	.value	0x372
+	.byte	0x1d
+	.long	0x561
+	.uleb128 0x23
+	.long	.LASF1669
+	.byte	0x18
+	.byte	0x6
+	.value	0x3b6
+	.byte	0x10
+	.long	0x59a
+	.uleb128 0x9
+	.long	.LASF1670
+	.byte	0x6
+	.value	0x3b7
+	.byte	0x15
+	.long	0x65d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1652
+	.byte	0x6
+	.value	0x3b8
+	.byte	0x14
+	.long	0x62c
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF1654
+	.byte	0x6
+	.value	0x3b9
+	.byte	0x14
+	.long	0x62c
+	.byte	0x10
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1671
+	.byte	0x6
+	.value	0x373
+	.byte	0x15
+	.long	0x5a7
+	.uleb128 0xc
+	.long	0x5ac
+	.uleb128 0x1e
+	.long	0x14a
+	.long	0x5bb
+	.uleb128 0x7
+	.long	0x14a
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1672
+	.byte	0x6
+	.value	0x374
+	.byte	0x15
+	.long	0x5c8
+	.uleb128 0xc
+	.long	0x5cd
+	.uleb128 0x1e
+	.long	0x14a
+	.long	0x5dd
+	.uleb128 0x7
+	.long	0x5e
+	.uleb128 0x27
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1673
+	.byte	0x6
+	.value	0x375
+	.byte	0x2a
+	.long	0x5ef
+	.uleb128 0x22
+	.long	0x5dd
+	.uleb128 0x2b
+	.long	.LASF1676
+	.uleb128 0xd
+	.long	.LASF1674
+	.byte	0x6
+	.value	0x376
+	.byte	0x15
+	.long	0x601
+	.uleb128 0xc
+	.long	0x606
+	.uleb128 0x1e
+	.long	0x14a
+	.long	0x615
+	.uleb128 0x7
+	.long	0x615
+	.byte	0
+	.uleb128 0xc
+	.long	0x5ea
+	.uleb128 0xd
+	.long	.LASF1675
+	.byte	0x6
+	.value	0x377
+	.byte	0x1e
+	.long	0x627
+	.uleb128 0x2b
+	.long	.LASF1677
+	.uleb128 0xd
+	.long	.LASF1678
+	.byte	0x6
+	.value	0x378
+	.byte	0x10
+	.long	0x639
+	.uleb128 0xc
+	.long	0x63e
+	.uleb128 0x29
+	.long	0x653
+	.uleb128 0x7
+	.long	0x653
+	.uleb128 0x7
+	.long	0x19e
+	.uleb128 0x7
+	.long	0x658
+	.byte	0
+	.uleb128 0xc
+	.long	0x61a
+	.uleb128 0xc
+	.long	0x14a
+	.uleb128 0xc
+	.long	0x3e8
+	.uleb128 0xc
+	.long	0x554
+	.uleb128 0x23
+	.long	.LASF1679
+	.byte	0x8
+	.byte	0x6
+	.value	0x3d7
+	.byte	0x10
+	.long	0x684
+	.uleb128 0x9
+	.long	.LASF1670
+	.byte	0x6
+	.value	0x3d8
+	.byte	0x15
+	.long	0x65d
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1680
+	.byte	0x6
+	.value	0x3d9
+	.byte	0x3
+	.long	0x667
+	.uleb128 0x12
+	.long	0x88
+	.long	0x69c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1681
+	.byte	0x6
+	.value	0x3ff
+	.byte	0xe
+	.long	0x691
+	.uleb128 0x12
+	.long	0x8d
+	.long	0x6b4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1682
+	.byte	0x6
+	.value	0x423
+	.byte	0xd
+	.long	0x6a9
+	.uleb128 0x12
+	.long	0x3cd
+	.long	0x6cc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1683
+	.byte	0x6
+	.value	0x4bb
+	.byte	0x12
+	.long	0x6c1
+	.uleb128 0x12
+	.long	0x29e
+	.long	0x6e9
+	.uleb128 0x16
+	.long	0x32
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1709
+	.value	0x15e
+	.byte	0x1b
+	.long	0x6d9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	test_collection_params
+	.uleb128 0x12
+	.long	0x3cd
+	.long	0x70f
+	.uleb128 0x16
+	.long	0x32
+	.byte	0x5
+	.byte	0
+	.uleb128 0x33
+	.long	0x6cc
+	.byte	0x1
+	.value	0x161
+	.byte	0xb
+	.long	0x6ff
+	.uleb128 0x9
+	.byte	0x3
+	.quad	test_collection_tests
+	.uleb128 0x15
+	.long	.LASF1684
+	.byte	0x4
+	.value	0x1c4
+	.byte	0x39
+	.long	0x14a
+	.long	0x73d
+	.uleb128 0x7
+	.long	0x14a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1685
+	.byte	0x4
+	.value	0x2a4
+	.byte	0x39
+	.long	0x14a
+	.long	0x759
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x14a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1686
+	.byte	0x4
+	.value	0x29a
+	.byte	0x39
+	.long	0x14a
+	.long	0x775
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x14a
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1687
+	.byte	0x4
+	.value	0x2a0
+	.byte	0x34
+	.long	0x797
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x19e
+	.uleb128 0x7
+	.long	0x1d0
+	.uleb128 0x7
+	.long	0x658
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1688
+	.byte	0x4
+	.value	0x2aa
+	.byte	0x34
+	.long	0x7af
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x658
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1689
+	.byte	0x6
+	.value	0x437
+	.byte	0xd
+	.long	0x7c2
+	.uleb128 0x7
+	.long	0x653
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1690
+	.byte	0x6
+	.value	0x473
+	.byte	0xd
+	.long	0x7da
+	.uleb128 0x7
+	.long	0x19e
+	.uleb128 0x7
+	.long	0x658
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1691
+	.byte	0x9d
+	.long	0x7eb
+	.uleb128 0x7
+	.long	0x5e
+	.uleb128 0x27
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1692
+	.byte	0x6
+	.value	0x242
+	.byte	0xc
+	.long	0x5e
+	.long	0x81b
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x81b
+	.uleb128 0x7
+	.long	0x19e
+	.uleb128 0x7
+	.long	0x658
+	.uleb128 0x7
+	.long	0x658
+	.uleb128 0x7
+	.long	0x209
+	.byte	0
+	.uleb128 0xc
+	.long	0x184
+	.uleb128 0x15
+	.long	.LASF1645
+	.byte	0x4
+	.value	0x65a
+	.byte	0x39
+	.long	0x14a
+	.long	0x837
+	.uleb128 0x7
+	.long	0x14a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1693
+	.byte	0x4
+	.value	0x6e1
+	.byte	0x39
+	.long	0x14a
+	.long	0x853
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x81b
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1694
+	.byte	0x4
+	.value	0x176
+	.byte	0x39
+	.long	0x14a
+	.long	0x86a
+	.uleb128 0x7
+	.long	0x14a
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF1747
+	.byte	0x6
+	.value	0x489
+	.byte	0xd
+	.uleb128 0x1a
+	.long	.LASF1695
+	.byte	0x4
+	.value	0x3a1
+	.byte	0x34
+	.long	0x890
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x658
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1696
+	.byte	0x4
+	.value	0x3d6
+	.byte	0x34
+	.long	0x8b2
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x658
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1697
+	.byte	0x6
+	.value	0x485
+	.byte	0xd
+	.long	0x8c5
+	.uleb128 0x7
+	.long	0x5e
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1698
+	.byte	0x4
+	.value	0x299
+	.byte	0x39
+	.long	0x14a
+	.long	0x8e1
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x14a
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1699
+	.byte	0x9a
+	.long	0x8f1
+	.uleb128 0x7
+	.long	0x14a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1700
+	.byte	0x4
+	.value	0x2a7
+	.byte	0x3a
+	.long	0x19e
+	.long	0x90d
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x658
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1701
+	.byte	0x6
+	.value	0x34f
+	.byte	0xc
+	.long	0x5e
+	.long	0x92e
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x19e
+	.uleb128 0x7
+	.long	0x658
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF1702
+	.byte	0x4
+	.byte	0xa1
+	.byte	0x33
+	.long	0x5e
+	.long	0x944
+	.uleb128 0x7
+	.long	0x14a
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1703
+	.byte	0x4
+	.value	0x2b0
+	.byte	0x34
+	.long	0x961
+	.uleb128 0x7
+	.long	0x14a
+	.uleb128 0x7
+	.long	0x19e
+	.uleb128 0x7
+	.long	0x658
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF1704
+	.byte	0x5
+	.byte	0xc4
+	.byte	0x6
+	.long	0x97e
+	.uleb128 0x7
+	.long	0x23e
+	.uleb128 0x7
+	.long	0x5e
+	.uleb128 0x7
+	.long	0x23e
+	.uleb128 0x27
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF1748
+	.byte	0x6
+	.value	0x434
+	.byte	0x16
+	.long	0x653
+	.uleb128 0x1a
+	.long	.LASF1705
+	.byte	0x6
+	.value	0x498
+	.byte	0xd
+	.long	0x99e
+	.uleb128 0x7
+	.long	0x99e
+	.byte	0
+	.uleb128 0xc
+	.long	0x684
+	.uleb128 0x15
+	.long	.LASF1706
+	.byte	0x6
+	.value	0x497
+	.byte	0x13
+	.long	0x99e
+	.long	0x9bf
+	.uleb128 0x7
+	.long	0x333
+	.uleb128 0x7
+	.long	0x40
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF1749
+	.byte	0x1
+	.value	0x166
+	.byte	0xd
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x20
+	.long	.LASF1733
+	.byte	0xcf
+	.long	0x267
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x355c
+	.uleb128 0x18
+	.long	.LASF1707
+	.byte	0xcf
+	.byte	0x36
+	.long	0x333
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x18
+	.long	.LASF1708
+	.byte	0xcf
+	.byte	0x4b
+	.long	0x99e
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x4
+	.long	.LASF1670
+	.byte	0xd1
+	.byte	0x15
+	.long	0x65d
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1b
+	.string	"uq"
+	.byte	0xd2
+	.byte	0x13
+	.long	0x653
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xf
+	.long	.LASF1710
+	.byte	0xd3
+	.byte	0xf
+	.long	0x355c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0xd4
+	.byte	0x9
+	.long	0x5e
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x39
+	.long	.LASF1636
+	.byte	0x1
+	.value	0x135
+	.byte	0x1
+	.quad	.L8
+	.uleb128 0x8
+	.long	.LLRL5
+	.long	0xd49
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0xd9
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x8
+	.long	.LLRL7
+	.long	0xbb7
+	.uleb128 0xf
+	.long	.LASF1712
+	.byte	0xda
+	.byte	0x18
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.uleb128 0x4
+	.long	.LASF1713
+	.byte	0xda
+	.byte	0x4f
+	.long	0x19e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x11
+	.long	.LLRL9
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xda
+	.byte	0xd1
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL9
+	.long	0x944
+	.long	0xaf6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL10
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL11
+	.long	0x90d
+	.long	0xb21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL16
+	.long	0x961
+	.long	0xb6d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xda
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL17
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xda
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL10
+	.long	0xd21
+	.uleb128 0x4
+	.long	.LASF1714
+	.byte	0xdb
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x4
+	.long	.LASF1715
+	.byte	0xdb
+	.byte	0x3b
+	.long	0x19e
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x11
+	.long	.LLRL10
+	.uleb128 0x4
+	.long	.LASF1716
+	.byte	0xdb
+	.byte	0x65
+	.long	0x19e
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x8
+	.long	.LLRL14
+	.long	0xcd7
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xdb
+	.byte	0x86
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL13
+	.long	0x8f1
+	.long	0xc35
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL14
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL15
+	.long	0x961
+	.long	0xc8e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xdb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL18
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xdb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL25
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xdb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL5
+	.long	0xd34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL19
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.long	0x192a
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0xe2
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x5
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.long	0xe42
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xe3
+	.byte	0x18
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL28
+	.long	0x944
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL29
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL30
+	.long	0x961
+	.long	0xe06
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL31
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL16
+	.long	0xfb1
+	.uleb128 0x4
+	.long	.LASF1714
+	.byte	0xe4
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x14
+	.long	.LASF1715
+	.byte	0xe4
+	.byte	0x3b
+	.long	0x19e
+	.byte	0x2
+	.uleb128 0x11
+	.long	.LLRL16
+	.uleb128 0x4
+	.long	.LASF1716
+	.byte	0xe4
+	.byte	0x65
+	.long	0x19e
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x5
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.long	0xf67
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xe4
+	.byte	0x86
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL32
+	.long	0x8f1
+	.long	0xec5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL33
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL34
+	.long	0x961
+	.long	0xf1e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL35
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL42
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL19
+	.long	0x10ff
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xe5
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xe5
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x8
+	.long	.LLRL22
+	.long	0x10ea
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xe5
+	.byte	0x77
+	.long	0x14a
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x6
+	.quad	.LVL39
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL40
+	.long	0x961
+	.long	0x1055
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL46
+	.long	0x961
+	.long	0x10a1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL47
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL36
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB27
+	.quad	.LBE27-.LBB27
+	.long	0x1265
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xe6
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xe6
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x5
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.long	0x1250
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xe6
+	.byte	0x77
+	.long	0x14a
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x6
+	.quad	.LVL51
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL52
+	.long	0x961
+	.long	0x11bb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL56
+	.long	0x961
+	.long	0x1207
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL57
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL49
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB29
+	.quad	.LBE29-.LBB29
+	.long	0x1330
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xeb
+	.byte	0x20
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL61
+	.long	0x890
+	.long	0x12a8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL62
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL63
+	.long	0x961
+	.long	0x12f4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xeb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL64
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xeb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL27
+	.long	0x13ef
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xee
+	.byte	0x20
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL65
+	.long	0x961
+	.long	0x1387
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xee
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL69
+	.long	0x873
+	.long	0x13a6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL70
+	.long	0x92e
+	.uleb128 0x3
+	.quad	.LVL71
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xee
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL28
+	.long	0x14ae
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xf0
+	.byte	0x20
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL66
+	.long	0x873
+	.long	0x1426
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL72
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL73
+	.long	0x961
+	.long	0x1472
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xf0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL74
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xf0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL29
+	.long	0x161d
+	.uleb128 0x4
+	.long	.LASF1714
+	.byte	0xf4
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x14
+	.long	.LASF1715
+	.byte	0xf4
+	.byte	0x3b
+	.long	0x19e
+	.byte	0x20
+	.uleb128 0x11
+	.long	.LLRL29
+	.uleb128 0x4
+	.long	.LASF1716
+	.byte	0xf4
+	.byte	0x66
+	.long	0x19e
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x5
+	.quad	.LBB36
+	.quad	.LBE36-.LBB36
+	.long	0x15d3
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xf4
+	.byte	0x87
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL76
+	.long	0x8f1
+	.long	0x1531
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL78
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL79
+	.long	0x961
+	.long	0x158a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xf4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL80
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xf4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL86
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xf4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL32
+	.long	0x176b
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xf5
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xf5
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x8
+	.long	.LLRL35
+	.long	0x1756
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xf5
+	.byte	0x77
+	.long	0x14a
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x6
+	.quad	.LVL83
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL84
+	.long	0x961
+	.long	0x16c1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xf5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL90
+	.long	0x961
+	.long	0x170d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xf5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL91
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xf5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL81
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.long	0x18d1
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xf6
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xf6
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x5
+	.quad	.LBB44
+	.quad	.LBE44-.LBB44
+	.long	0x18bc
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xf6
+	.byte	0x77
+	.long	0x14a
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x6
+	.quad	.LVL95
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL96
+	.long	0x961
+	.long	0x1827
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xf6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL100
+	.long	0x961
+	.long	0x1873
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xf6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL101
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xf6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL93
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL26
+	.long	0x18e4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL59
+	.long	0x8b2
+	.long	0x18fb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL67
+	.long	0x79f5
+	.uleb128 0x6
+	.quad	.LVL75
+	.long	0x86a
+	.uleb128 0x3
+	.quad	.LVL103
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL40
+	.long	0x2225
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0xfd
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x4
+	.long	.LASF1720
+	.byte	0xfe
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x5
+	.quad	.LBB46
+	.quad	.LBE46-.LBB46
+	.long	0x1a2a
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xff
+	.byte	0x18
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL106
+	.long	0x944
+	.long	0x19a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL107
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL108
+	.long	0x961
+	.long	0x19ee
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL109
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB47
+	.quad	.LBE47-.LBB47
+	.long	0x1afe
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x101
+	.byte	0x18
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL112
+	.long	0x944
+	.long	0x1a74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL113
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL114
+	.long	0x961
+	.long	0x1ac1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x101
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL115
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x101
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL43
+	.long	0x1bc0
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x105
+	.byte	0x1c
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL118
+	.long	0x890
+	.long	0x1b36
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL122
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL123
+	.long	0x961
+	.long	0x1b83
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x105
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL124
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x105
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL44
+	.long	0x1d3d
+	.uleb128 0xa
+	.long	.LASF1714
+	.value	0x108
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0xa
+	.long	.LASF1715
+	.value	0x108
+	.byte	0x3b
+	.long	0x19e
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x11
+	.long	.LLRL44
+	.uleb128 0xa
+	.long	.LASF1716
+	.value	0x108
+	.byte	0x66
+	.long	0x19e
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x5
+	.quad	.LBB52
+	.quad	.LBE52-.LBB52
+	.long	0x1cf2
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x108
+	.byte	0x87
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL126
+	.long	0x8f1
+	.long	0x1c4e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL128
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL129
+	.long	0x961
+	.long	0x1ca8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x108
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL130
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x108
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL139
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x108
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL48
+	.long	0x21a7
+	.uleb128 0xa
+	.long	.LASF1721
+	.value	0x109
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x1f
+	.long	.LASF1722
+	.value	0x109
+	.byte	0x3a
+	.long	0x357c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.uleb128 0x1f
+	.long	.LASF1723
+	.value	0x109
+	.byte	0x6a
+	.long	0x358c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x11
+	.long	.LLRL50
+	.uleb128 0xa
+	.long	.LASF1724
+	.value	0x109
+	.byte	0xac
+	.long	0x19e
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x24
+	.long	.LASF1725
+	.value	0x114
+	.long	0x6c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -360
+	.uleb128 0x24
+	.long	.LASF1726
+	.value	0x18d
+	.long	0x184
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0x25
+	.long	.LASF1727
+	.value	0x1ab
+	.long	0x14a
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x24
+	.long	.LASF1728
+	.value	0x1c3
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0x24
+	.long	.LASF1729
+	.value	0x1e0
+	.long	0x19e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x8
+	.long	.LLRL53
+	.long	0x1f10
+	.uleb128 0x25
+	.long	.LASF1716
+	.value	0x1fd
+	.long	0x19e
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x8
+	.long	.LLRL55
+	.long	0x1ece
+	.uleb128 0x3a
+	.string	"exc"
+	.byte	0x1
+	.value	0x109
+	.value	0x21e
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x2
+	.quad	.LVL134
+	.long	0x8f1
+	.long	0x1e3a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL136
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL137
+	.long	0x961
+	.long	0x1e8c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x109
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL140
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x109
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL153
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x109
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL56
+	.long	0x1fa3
+	.uleb128 0xa
+	.long	.LASF1730
+	.value	0x109
+	.byte	0x60
+	.long	0x14a
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x2
+	.quad	.LVL141
+	.long	0x837
+	.long	0x1f4e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL143
+	.long	0x92e
+	.long	0x1f66
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL154
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x109
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL58
+	.long	0x2031
+	.uleb128 0x25
+	.long	.LASF1731
+	.value	0x4ac
+	.long	0x14a
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x25
+	.long	.LASF1732
+	.value	0x4e5
+	.long	0x14a
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x6
+	.quad	.LVL146
+	.long	0x820
+	.uleb128 0x6
+	.quad	.LVL149
+	.long	0x820
+	.uleb128 0x3
+	.quad	.LVL159
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x109
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -400
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL144
+	.long	0x7eb
+	.long	0x206a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL145
+	.long	0x92e
+	.uleb128 0x6
+	.quad	.LVL150
+	.long	0x8e1
+	.uleb128 0x2
+	.quad	.LVL155
+	.long	0x961
+	.long	0x20c4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x109
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL156
+	.long	0x961
+	.long	0x2104
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x109
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL157
+	.long	0x961
+	.long	0x2144
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x109
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL160
+	.long	0x79fe
+	.uleb128 0x2
+	.quad	.LVL161
+	.long	0x8e1
+	.long	0x2169
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL168
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x109
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL104
+	.long	0x21ba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL110
+	.long	0x853
+	.long	0x21d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL116
+	.long	0x8b2
+	.long	0x21e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL119
+	.long	0x79f5
+	.uleb128 0x6
+	.quad	.LVL125
+	.long	0x86a
+	.uleb128 0x3
+	.quad	.LVL162
+	.long	0x7da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL61
+	.long	0x290e
+	.uleb128 0xa
+	.long	.LASF1711
+	.value	0x10f
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x8
+	.long	.LLRL63
+	.long	0x2309
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x110
+	.byte	0x18
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL165
+	.long	0x944
+	.long	0x227f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL166
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL167
+	.long	0x961
+	.long	0x22cc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x110
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC34
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL169
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x110
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC34
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB73
+	.quad	.LBE73-.LBB73
+	.long	0x23dc
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x111
+	.byte	0x18
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL170
+	.long	0x944
+	.long	0x2352
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL171
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL172
+	.long	0x961
+	.long	0x239f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x111
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL173
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x111
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB74
+	.quad	.LBE74-.LBB74
+	.long	0x24b0
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x112
+	.byte	0x18
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL174
+	.long	0x944
+	.long	0x2426
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL175
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL176
+	.long	0x961
+	.long	0x2473
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x112
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC36
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL177
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x112
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC36
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL64
+	.long	0x2626
+	.uleb128 0xa
+	.long	.LASF1714
+	.value	0x113
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x1d
+	.long	.LASF1715
+	.value	0x113
+	.byte	0x3b
+	.long	0x19e
+	.byte	0x2
+	.uleb128 0x11
+	.long	.LLRL64
+	.uleb128 0xa
+	.long	.LASF1716
+	.value	0x113
+	.byte	0x65
+	.long	0x19e
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x5
+	.quad	.LBB77
+	.quad	.LBE77-.LBB77
+	.long	0x25db
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x113
+	.byte	0x86
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL178
+	.long	0x8f1
+	.long	0x2537
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL180
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL181
+	.long	0x961
+	.long	0x2591
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x113
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL182
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x113
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL188
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x113
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL67
+	.long	0x277a
+	.uleb128 0xa
+	.long	.LASF1717
+	.value	0x114
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0xa
+	.long	.LASF1718
+	.value	0x114
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x8
+	.long	.LLRL70
+	.long	0x2765
+	.uleb128 0xa
+	.long	.LASF1719
+	.value	0x114
+	.byte	0x77
+	.long	0x14a
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x6
+	.quad	.LVL185
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL186
+	.long	0x961
+	.long	0x26ce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x114
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL192
+	.long	0x961
+	.long	0x271b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x114
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL193
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x114
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL183
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB84
+	.quad	.LBE84-.LBB84
+	.long	0x28e6
+	.uleb128 0xa
+	.long	.LASF1717
+	.value	0x115
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0xa
+	.long	.LASF1718
+	.value	0x115
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x5
+	.quad	.LBB85
+	.quad	.LBE85-.LBB85
+	.long	0x28d1
+	.uleb128 0xa
+	.long	.LASF1719
+	.value	0x115
+	.byte	0x77
+	.long	0x14a
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x6
+	.quad	.LVL197
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL198
+	.long	0x961
+	.long	0x283a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x115
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL202
+	.long	0x961
+	.long	0x2887
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x115
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL203
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x115
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL195
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL163
+	.long	0x28f9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL205
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB88
+	.quad	.LBE88-.LBB88
+	.long	0x2bc1
+	.uleb128 0xa
+	.long	.LASF1711
+	.value	0x11b
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x5
+	.quad	.LBB89
+	.quad	.LBE89-.LBB89
+	.long	0x2a0b
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x11c
+	.byte	0x18
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL208
+	.long	0x944
+	.long	0x2981
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL209
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL210
+	.long	0x961
+	.long	0x29ce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x11c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL211
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x11c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB90
+	.quad	.LBE90-.LBB90
+	.long	0x2b99
+	.uleb128 0xa
+	.long	.LASF1714
+	.value	0x11d
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x1d
+	.long	.LASF1715
+	.value	0x11d
+	.byte	0x3b
+	.long	0x19e
+	.byte	0
+	.uleb128 0x21
+	.quad	.LBB91
+	.quad	.LBE91-.LBB91
+	.uleb128 0xa
+	.long	.LASF1716
+	.value	0x11d
+	.byte	0x65
+	.long	0x19e
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x5
+	.quad	.LBB92
+	.quad	.LBE92-.LBB92
+	.long	0x2b4e
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x11d
+	.byte	0x86
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL212
+	.long	0x8f1
+	.long	0x2aaa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL214
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL215
+	.long	0x961
+	.long	0x2b04
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x11d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL216
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x11d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL218
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x11d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL206
+	.long	0x2bac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL219
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB93
+	.quad	.LBE93-.LBB93
+	.long	0x2ee3
+	.uleb128 0xa
+	.long	.LASF1711
+	.value	0x123
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x5
+	.quad	.LBB94
+	.quad	.LBE94-.LBB94
+	.long	0x2d2d
+	.uleb128 0x1f
+	.long	.LASF1712
+	.value	0x124
+	.byte	0x18
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.uleb128 0x1d
+	.long	.LASF1713
+	.value	0x124
+	.byte	0x5b
+	.long	0x19e
+	.byte	0x1
+	.uleb128 0x21
+	.quad	.LBB95
+	.quad	.LBE95-.LBB95
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x124
+	.byte	0xdd
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL225
+	.long	0x944
+	.long	0x2c6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xa
+	.byte	0x10
+	.uleb128 0x7fffffffffffffff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL226
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL227
+	.long	0x961
+	.long	0x2cc4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x124
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC38
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL228
+	.long	0x90d
+	.long	0x2ce2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL229
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x124
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC38
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB96
+	.quad	.LBE96-.LBB96
+	.long	0x2ebb
+	.uleb128 0xa
+	.long	.LASF1714
+	.value	0x125
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x1d
+	.long	.LASF1715
+	.value	0x125
+	.byte	0x3b
+	.long	0x19e
+	.byte	0x2
+	.uleb128 0x21
+	.quad	.LBB97
+	.quad	.LBE97-.LBB97
+	.uleb128 0xa
+	.long	.LASF1716
+	.value	0x125
+	.byte	0x65
+	.long	0x19e
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x5
+	.quad	.LBB98
+	.quad	.LBE98-.LBB98
+	.long	0x2e70
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x125
+	.byte	0x86
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL230
+	.long	0x8f1
+	.long	0x2dcc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL232
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL233
+	.long	0x961
+	.long	0x2e26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x125
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL234
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x125
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL236
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x125
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL220
+	.long	0x2ece
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL237
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB99
+	.quad	.LBE99-.LBB99
+	.long	0x34fa
+	.uleb128 0xa
+	.long	.LASF1711
+	.value	0x12b
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x5
+	.quad	.LBB100
+	.quad	.LBE100-.LBB100
+	.long	0x3048
+	.uleb128 0x1f
+	.long	.LASF1712
+	.value	0x12d
+	.byte	0x18
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.uleb128 0x1d
+	.long	.LASF1713
+	.value	0x12d
+	.byte	0x4f
+	.long	0x19e
+	.byte	0x1
+	.uleb128 0x21
+	.quad	.LBB101
+	.quad	.LBE101-.LBB101
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x12d
+	.byte	0xd1
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL242
+	.long	0x944
+	.long	0x2f85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL243
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL244
+	.long	0x961
+	.long	0x2fdf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC40
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL245
+	.long	0x90d
+	.long	0x2ffd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL246
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC40
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB102
+	.quad	.LBE102-.LBB102
+	.long	0x31d6
+	.uleb128 0xa
+	.long	.LASF1714
+	.value	0x12f
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x1d
+	.long	.LASF1715
+	.value	0x12f
+	.byte	0x3b
+	.long	0x19e
+	.byte	0x2
+	.uleb128 0x21
+	.quad	.LBB103
+	.quad	.LBE103-.LBB103
+	.uleb128 0xa
+	.long	.LASF1716
+	.value	0x12f
+	.byte	0x65
+	.long	0x19e
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x5
+	.quad	.LBB104
+	.quad	.LBE104-.LBB104
+	.long	0x318b
+	.uleb128 0x13
+	.string	"exc"
+	.value	0x12f
+	.byte	0x86
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x2
+	.quad	.LVL248
+	.long	0x8f1
+	.long	0x30e7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL250
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL251
+	.long	0x961
+	.long	0x3141
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL252
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL254
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB105
+	.quad	.LBE105-.LBB105
+	.long	0x3342
+	.uleb128 0xa
+	.long	.LASF1717
+	.value	0x130
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0xa
+	.long	.LASF1718
+	.value	0x130
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x5
+	.quad	.LBB106
+	.quad	.LBE106-.LBB106
+	.long	0x332d
+	.uleb128 0xa
+	.long	.LASF1719
+	.value	0x130
+	.byte	0x77
+	.long	0x14a
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x2
+	.quad	.LVL259
+	.long	0x961
+	.long	0x3289
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x130
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL261
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL262
+	.long	0x961
+	.long	0x32e3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x130
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL263
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x130
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL255
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB107
+	.quad	.LBE107-.LBB107
+	.long	0x34ae
+	.uleb128 0xa
+	.long	.LASF1717
+	.value	0x131
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0xa
+	.long	.LASF1718
+	.value	0x131
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x5
+	.quad	.LBB108
+	.quad	.LBE108-.LBB108
+	.long	0x3499
+	.uleb128 0xa
+	.long	.LASF1719
+	.value	0x131
+	.byte	0x77
+	.long	0x14a
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x2
+	.quad	.LVL269
+	.long	0x961
+	.long	0x33f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x131
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL271
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL272
+	.long	0x961
+	.long	0x344f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x131
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL273
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x131
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL265
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL238
+	.long	0x34c1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL240
+	.long	0x8b2
+	.long	0x34d8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL247
+	.long	0x86a
+	.uleb128 0x3
+	.quad	.LVL275
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL2
+	.long	0x97e
+	.uleb128 0xb
+	.quad	.LVL4
+	.long	0x3528
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL20
+	.long	0x7c2
+	.long	0x3547
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL21
+	.long	0x7af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x14a
+	.long	0x356c
+	.uleb128 0x16
+	.long	0x32
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x12
+	.long	0x14a
+	.long	0x357c
+	.uleb128 0x16
+	.long	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x14a
+	.long	0x358c
+	.uleb128 0x16
+	.long	0x32
+	.byte	0x1
+	.byte	0
+	.uleb128 0x12
+	.long	0x88
+	.long	0x359c
+	.uleb128 0x16
+	.long	0x32
+	.byte	0x1
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1734
+	.byte	0x95
+	.long	0x267
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4bd0
+	.uleb128 0x18
+	.long	.LASF1707
+	.byte	0x95
+	.byte	0x34
+	.long	0x333
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x18
+	.long	.LASF1708
+	.byte	0x95
+	.byte	0x49
+	.long	0x99e
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x4
+	.long	.LASF1670
+	.byte	0x97
+	.byte	0x15
+	.long	0x65d
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x1b
+	.string	"uq"
+	.byte	0x98
+	.byte	0x13
+	.long	0x653
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0xf
+	.long	.LASF1710
+	.byte	0x99
+	.byte	0xf
+	.long	0x355c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x3b
+	.long	.LASF1636
+	.byte	0x1
+	.byte	0xc9
+	.byte	0x1
+	.quad	.L158
+	.uleb128 0x5
+	.quad	.LBB109
+	.quad	.LBE109-.LBB109
+	.long	0x3bb3
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0x9e
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x8
+	.long	.LLRL95
+	.long	0x376d
+	.uleb128 0xf
+	.long	.LASF1712
+	.byte	0x9f
+	.byte	0x18
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x4
+	.long	.LASF1713
+	.byte	0x9f
+	.byte	0x4f
+	.long	0x19e
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x11
+	.long	.LLRL97
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0x9f
+	.byte	0xd1
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x2
+	.quad	.LVL285
+	.long	0x797
+	.long	0x36ac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL286
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL287
+	.long	0x90d
+	.long	0x36d7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL292
+	.long	0x961
+	.long	0x3723
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x9f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL293
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x9f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL98
+	.long	0x38d7
+	.uleb128 0x4
+	.long	.LASF1714
+	.byte	0xa0
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x4
+	.long	.LASF1715
+	.byte	0xa0
+	.byte	0x3b
+	.long	0x19e
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x11
+	.long	.LLRL98
+	.uleb128 0x4
+	.long	.LASF1716
+	.byte	0xa0
+	.byte	0x65
+	.long	0x19e
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x8
+	.long	.LLRL102
+	.long	0x388d
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xa0
+	.byte	0x86
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x2
+	.quad	.LVL289
+	.long	0x8f1
+	.long	0x37eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL290
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL291
+	.long	0x961
+	.long	0x3844
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL294
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL301
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL103
+	.long	0x3a25
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xa1
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xa1
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x8
+	.long	.LLRL106
+	.long	0x3a10
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xa1
+	.byte	0x77
+	.long	0x14a
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x6
+	.quad	.LVL298
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL299
+	.long	0x961
+	.long	0x397b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL305
+	.long	0x961
+	.long	0x39c7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL306
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL295
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB126
+	.quad	.LBE126-.LBB126
+	.long	0x3b8b
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xa2
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xa2
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x5
+	.quad	.LBB127
+	.quad	.LBE127-.LBB127
+	.long	0x3b76
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xa2
+	.byte	0x77
+	.long	0x14a
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x6
+	.quad	.LVL310
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL311
+	.long	0x961
+	.long	0x3ae1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL315
+	.long	0x961
+	.long	0x3b2d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL316
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL308
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL281
+	.long	0x3b9e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL318
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB128
+	.quad	.LBE128-.LBB128
+	.long	0x40f1
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0xa9
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x5
+	.quad	.LBB129
+	.quad	.LBE129-.LBB129
+	.long	0x3ca6
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xaa
+	.byte	0x18
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x2
+	.quad	.LVL325
+	.long	0x797
+	.long	0x3c1e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL326
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL327
+	.long	0x961
+	.long	0x3c6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xaa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL328
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xaa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL112
+	.long	0x3e15
+	.uleb128 0x4
+	.long	.LASF1714
+	.byte	0xab
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x14
+	.long	.LASF1715
+	.byte	0xab
+	.byte	0x3b
+	.long	0x19e
+	.byte	0
+	.uleb128 0x11
+	.long	.LLRL112
+	.uleb128 0x4
+	.long	.LASF1716
+	.byte	0xab
+	.byte	0x65
+	.long	0x19e
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x5
+	.quad	.LBB132
+	.quad	.LBE132-.LBB132
+	.long	0x3dcb
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xab
+	.byte	0x86
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x2
+	.quad	.LVL329
+	.long	0x8f1
+	.long	0x3d29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL330
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL331
+	.long	0x961
+	.long	0x3d82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL332
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL339
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL115
+	.long	0x3f63
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xac
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xac
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x8
+	.long	.LLRL118
+	.long	0x3f4e
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xac
+	.byte	0x78
+	.long	0x14a
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x6
+	.quad	.LVL336
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL337
+	.long	0x961
+	.long	0x3eb9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL343
+	.long	0x961
+	.long	0x3f05
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL344
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL333
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB139
+	.quad	.LBE139-.LBB139
+	.long	0x40c9
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xad
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xad
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x5
+	.quad	.LBB140
+	.quad	.LBE140-.LBB140
+	.long	0x40b4
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xad
+	.byte	0x78
+	.long	0x14a
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x6
+	.quad	.LVL348
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL349
+	.long	0x961
+	.long	0x401f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL353
+	.long	0x961
+	.long	0x406b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL354
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL346
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL323
+	.long	0x40dc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL356
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB141
+	.quad	.LBE141-.LBB141
+	.long	0x462f
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0xb3
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x5
+	.quad	.LBB142
+	.quad	.LBE142-.LBB142
+	.long	0x41e4
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xb4
+	.byte	0x18
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x2
+	.quad	.LVL359
+	.long	0x797
+	.long	0x415c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL360
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL361
+	.long	0x961
+	.long	0x41a8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL362
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL124
+	.long	0x4353
+	.uleb128 0x4
+	.long	.LASF1714
+	.byte	0xb5
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x14
+	.long	.LASF1715
+	.byte	0xb5
+	.byte	0x3b
+	.long	0x19e
+	.byte	0
+	.uleb128 0x11
+	.long	.LLRL124
+	.uleb128 0x4
+	.long	.LASF1716
+	.byte	0xb5
+	.byte	0x65
+	.long	0x19e
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x5
+	.quad	.LBB145
+	.quad	.LBE145-.LBB145
+	.long	0x4309
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xb5
+	.byte	0x86
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x2
+	.quad	.LVL363
+	.long	0x8f1
+	.long	0x4267
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL365
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL366
+	.long	0x961
+	.long	0x42c0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL367
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL373
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL127
+	.long	0x44a1
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xb6
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xb6
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x8
+	.long	.LLRL130
+	.long	0x448c
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xb6
+	.byte	0x78
+	.long	0x14a
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x6
+	.quad	.LVL370
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL371
+	.long	0x961
+	.long	0x43f7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL377
+	.long	0x961
+	.long	0x4443
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL378
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL368
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB152
+	.quad	.LBE152-.LBB152
+	.long	0x4607
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xb7
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xb7
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x5
+	.quad	.LBB153
+	.quad	.LBE153-.LBB153
+	.long	0x45f2
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xb7
+	.byte	0x78
+	.long	0x14a
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x6
+	.quad	.LVL382
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL383
+	.long	0x961
+	.long	0x455d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL387
+	.long	0x961
+	.long	0x45a9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL388
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xb7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL380
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL357
+	.long	0x461a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL390
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB154
+	.quad	.LBE154-.LBB154
+	.long	0x4b6e
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0xbd
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x5
+	.quad	.LBB155
+	.quad	.LBE155-.LBB155
+	.long	0x4722
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xc2
+	.byte	0x18
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x2
+	.quad	.LVL393
+	.long	0x797
+	.long	0x469a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL394
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL395
+	.long	0x961
+	.long	0x46e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL396
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL136
+	.long	0x4891
+	.uleb128 0x4
+	.long	.LASF1714
+	.byte	0xc3
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x14
+	.long	.LASF1715
+	.byte	0xc3
+	.byte	0x3b
+	.long	0x19e
+	.byte	0
+	.uleb128 0x11
+	.long	.LLRL136
+	.uleb128 0x4
+	.long	.LASF1716
+	.byte	0xc3
+	.byte	0x65
+	.long	0x19e
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x5
+	.quad	.LBB158
+	.quad	.LBE158-.LBB158
+	.long	0x4847
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0xc3
+	.byte	0x86
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x2
+	.quad	.LVL397
+	.long	0x8f1
+	.long	0x47a5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL399
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL400
+	.long	0x961
+	.long	0x47fe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL401
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL407
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL139
+	.long	0x49df
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xc4
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xc4
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x8
+	.long	.LLRL142
+	.long	0x49ca
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xc4
+	.byte	0x78
+	.long	0x14a
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x6
+	.quad	.LVL404
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL405
+	.long	0x961
+	.long	0x4935
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL411
+	.long	0x961
+	.long	0x4981
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL412
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL402
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB165
+	.quad	.LBE165-.LBB165
+	.long	0x4b45
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xc5
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xc5
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x5
+	.quad	.LBB166
+	.quad	.LBE166-.LBB166
+	.long	0x4b30
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xc5
+	.byte	0x78
+	.long	0x14a
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x6
+	.quad	.LVL416
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL417
+	.long	0x961
+	.long	0x4a9b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL421
+	.long	0x961
+	.long	0x4ae7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL422
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL414
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL391
+	.long	0x4b59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL424
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL278
+	.long	0x97e
+	.uleb128 0xb
+	.quad	.LVL280
+	.long	0x4b9c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL319
+	.long	0x7c2
+	.long	0x4bbb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL320
+	.long	0x7af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1735
+	.byte	0x5c
+	.long	0x267
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x55ac
+	.uleb128 0x18
+	.long	.LASF1707
+	.byte	0x5c
+	.byte	0x3d
+	.long	0x333
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x18
+	.long	.LASF1708
+	.byte	0x5c
+	.byte	0x52
+	.long	0x99e
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x4
+	.long	.LASF1670
+	.byte	0x5e
+	.byte	0x15
+	.long	0x65d
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x1b
+	.string	"uq"
+	.byte	0x5f
+	.byte	0x13
+	.long	0x653
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0xf
+	.long	.LASF1710
+	.byte	0x60
+	.byte	0xf
+	.long	0x55ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0x61
+	.byte	0xf
+	.long	0x14a
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0x4
+	.long	.LASF1736
+	.byte	0x62
+	.byte	0xf
+	.long	0x14a
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0xf
+	.long	.LASF1720
+	.byte	0x63
+	.byte	0xf
+	.long	0x55bc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.uleb128 0xe
+	.string	"out"
+	.byte	0x64
+	.byte	0xf
+	.long	0x55bc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -736
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0x65
+	.byte	0x10
+	.long	0x19e
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x5
+	.quad	.LBB167
+	.quad	.LBE167-.LBB167
+	.long	0x4dba
+	.uleb128 0x4
+	.long	.LASF1737
+	.byte	0x73
+	.byte	0x1c
+	.long	0x14a
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0xf
+	.long	.LASF1738
+	.byte	0x73
+	.byte	0x42
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -744
+	.uleb128 0x4
+	.long	.LASF1739
+	.byte	0x73
+	.byte	0x78
+	.long	0x19e
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x2
+	.quad	.LVL444
+	.long	0x92e
+	.long	0x4d01
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL445
+	.long	0x90d
+	.long	0x4d25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -744
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL446
+	.long	0x961
+	.long	0x4d71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x73
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL447
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x73
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL156
+	.long	0x4f08
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x75
+	.byte	0x1c
+	.long	0x14a
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x75
+	.byte	0x3e
+	.long	0x14a
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x8
+	.long	.LLRL159
+	.long	0x4ef3
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x75
+	.byte	0x79
+	.long	0x14a
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x6
+	.quad	.LVL449
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL450
+	.long	0x961
+	.long	0x4e5e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC48
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL452
+	.long	0x961
+	.long	0x4eaa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC48
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL453
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC48
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL460
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL161
+	.long	0x503e
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x76
+	.byte	0x1c
+	.long	0x14a
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x76
+	.byte	0x3e
+	.long	0x14a
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x11
+	.long	.LLRL164
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x76
+	.byte	0x7e
+	.long	0x14a
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x6
+	.quad	.LVL467
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL468
+	.long	0x961
+	.long	0x4fa8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC49
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL472
+	.long	0x961
+	.long	0x4ff4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC49
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL473
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC49
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB176
+	.quad	.LBE176-.LBB176
+	.long	0x5159
+	.uleb128 0x4
+	.long	.LASF1737
+	.byte	0x7e
+	.byte	0x1c
+	.long	0x14a
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0xf
+	.long	.LASF1738
+	.byte	0x7e
+	.byte	0x42
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -744
+	.uleb128 0x4
+	.long	.LASF1739
+	.byte	0x7e
+	.byte	0x78
+	.long	0x19e
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0x2
+	.quad	.LVL478
+	.long	0x92e
+	.long	0x50a0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL479
+	.long	0x90d
+	.long	0x50c4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -744
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL480
+	.long	0x961
+	.long	0x5110
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL481
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL168
+	.long	0x528f
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x80
+	.byte	0x1c
+	.long	0x14a
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x80
+	.byte	0x3e
+	.long	0x14a
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x11
+	.long	.LLRL171
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x80
+	.byte	0x67
+	.long	0x14a
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0x6
+	.quad	.LVL489
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL490
+	.long	0x961
+	.long	0x51f9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL493
+	.long	0x961
+	.long	0x5245
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL494
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL173
+	.long	0x530d
+	.uleb128 0x4
+	.long	.LASF1740
+	.byte	0x87
+	.byte	0x16
+	.long	0x238
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x14
+	.long	.LASF1741
+	.byte	0x87
+	.byte	0x3b
+	.long	0x238
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL500
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x87
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL175
+	.long	0x541c
+	.uleb128 0x4
+	.long	.LASF1737
+	.byte	0x8c
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0xf
+	.long	.LASF1738
+	.byte	0x8c
+	.byte	0x3e
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -744
+	.uleb128 0x4
+	.long	.LASF1739
+	.byte	0x8c
+	.byte	0x74
+	.long	0x19e
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x2
+	.quad	.LVL501
+	.long	0x961
+	.long	0x5397
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x8c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL506
+	.long	0x92e
+	.long	0x53af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL507
+	.long	0x90d
+	.long	0x53d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -744
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL508
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x8c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL427
+	.long	0x97e
+	.uleb128 0xb
+	.quad	.LVL429
+	.long	0x5449
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL430
+	.long	0x545c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL433
+	.long	0x546f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL436
+	.long	0x79fe
+	.uleb128 0x2
+	.quad	.LVL439
+	.long	0x775
+	.long	0x54a8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -736
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL457
+	.long	0x79fe
+	.uleb128 0x2
+	.quad	.LVL474
+	.long	0x775
+	.long	0x54e3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -760
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -736
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL484
+	.long	0x79fe
+	.uleb128 0x2
+	.quad	.LVL495
+	.long	0x775
+	.long	0x551b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -736
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL497
+	.long	0x775
+	.long	0x5547
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -736
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL502
+	.long	0x79fe
+	.uleb128 0x2
+	.quad	.LVL509
+	.long	0x7c2
+	.long	0x5572
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL510
+	.long	0x7af
+	.long	0x558a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL511
+	.long	0x7da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -760
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x14a
+	.long	0x55bc
+	.uleb128 0x16
+	.long	0x32
+	.byte	0x2
+	.byte	0
+	.uleb128 0x12
+	.long	0x14a
+	.long	0x55cc
+	.uleb128 0x16
+	.long	0x32
+	.byte	0x27
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1742
+	.byte	0x15
+	.long	0x267
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x75ac
+	.uleb128 0x18
+	.long	.LASF1707
+	.byte	0x15
+	.byte	0x37
+	.long	0x333
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x18
+	.long	.LASF1708
+	.byte	0x15
+	.byte	0x4c
+	.long	0x99e
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x4
+	.long	.LASF1670
+	.byte	0x17
+	.byte	0x15
+	.long	0x65d
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0x1b
+	.string	"uq"
+	.byte	0x18
+	.byte	0x13
+	.long	0x653
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0xf
+	.long	.LASF1710
+	.byte	0x19
+	.byte	0xf
+	.long	0x75ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x5
+	.quad	.LBB185
+	.quad	.LBE185-.LBB185
+	.long	0x5aca
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0x1e
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x5
+	.quad	.LBB186
+	.quad	.LBE186-.LBB186
+	.long	0x57d1
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x1f
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x1f
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x5
+	.quad	.LBB187
+	.quad	.LBE187-.LBB187
+	.long	0x57bc
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x1f
+	.byte	0x77
+	.long	0x14a
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0x6
+	.quad	.LVL526
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL527
+	.long	0x961
+	.long	0x5729
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x4f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL531
+	.long	0x961
+	.long	0x5774
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x4f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL532
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x4f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL523
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB188
+	.quad	.LBE188-.LBB188
+	.long	0x5937
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x20
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST186
+	.long	.LVUS186
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x20
+	.byte	0x49
+	.long	0x14a
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0x5
+	.quad	.LBB189
+	.quad	.LBE189-.LBB189
+	.long	0x5922
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x20
+	.byte	0x71
+	.long	0x14a
+	.long	.LLST188
+	.long	.LVUS188
+	.uleb128 0x6
+	.quad	.LVL536
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL537
+	.long	0x961
+	.long	0x588d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL541
+	.long	0x961
+	.long	0x58d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL542
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL534
+	.long	0x759
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB190
+	.quad	.LBE190-.LBB190
+	.long	0x5a9d
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x21
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x21
+	.byte	0x4d
+	.long	0x14a
+	.long	.LLST190
+	.long	.LVUS190
+	.uleb128 0x5
+	.quad	.LBB191
+	.quad	.LBE191-.LBB191
+	.long	0x5a88
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x21
+	.byte	0x76
+	.long	0x14a
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x6
+	.quad	.LVL547
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL548
+	.long	0x961
+	.long	0x59f3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL552
+	.long	0x961
+	.long	0x5a3f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL553
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL544
+	.long	0x73d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL521
+	.long	0x5ab0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL556
+	.long	0x7da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB192
+	.quad	.LBE192-.LBB192
+	.long	0x5f51
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0x27
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST192
+	.long	.LVUS192
+	.uleb128 0x5
+	.quad	.LBB193
+	.quad	.LBE193-.LBB193
+	.long	0x5c58
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x28
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST193
+	.long	.LVUS193
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x28
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x5
+	.quad	.LBB194
+	.quad	.LBE194-.LBB194
+	.long	0x5c43
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x28
+	.byte	0x78
+	.long	0x14a
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0x6
+	.quad	.LVL561
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL562
+	.long	0x961
+	.long	0x5bae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL566
+	.long	0x961
+	.long	0x5bfa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL567
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL559
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB195
+	.quad	.LBE195-.LBB195
+	.long	0x5dbe
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x29
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x29
+	.byte	0x49
+	.long	0x14a
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0x5
+	.quad	.LBB196
+	.quad	.LBE196-.LBB196
+	.long	0x5da9
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x29
+	.byte	0x72
+	.long	0x14a
+	.long	.LLST198
+	.long	.LVUS198
+	.uleb128 0x6
+	.quad	.LVL571
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL572
+	.long	0x961
+	.long	0x5d14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC57
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL576
+	.long	0x961
+	.long	0x5d60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC57
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL577
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC57
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL569
+	.long	0x759
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB197
+	.quad	.LBE197-.LBB197
+	.long	0x5f24
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x2a
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x2a
+	.byte	0x4d
+	.long	0x14a
+	.long	.LLST200
+	.long	.LVUS200
+	.uleb128 0x5
+	.quad	.LBB198
+	.quad	.LBE198-.LBB198
+	.long	0x5f0f
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x2a
+	.byte	0x75
+	.long	0x14a
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x6
+	.quad	.LVL581
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL582
+	.long	0x961
+	.long	0x5e7a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC58
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL586
+	.long	0x961
+	.long	0x5ec6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC58
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL587
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC58
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL579
+	.long	0x73d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL557
+	.long	0x5f37
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL590
+	.long	0x7da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB199
+	.quad	.LBE199-.LBB199
+	.long	0x64a3
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0x30
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST202
+	.long	.LVUS202
+	.uleb128 0x5
+	.quad	.LBB200
+	.quad	.LBE200-.LBB200
+	.long	0x6044
+	.uleb128 0xe
+	.string	"exc"
+	.byte	0x31
+	.byte	0x18
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x2
+	.quad	.LVL593
+	.long	0x797
+	.long	0x5fbc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL594
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL595
+	.long	0x961
+	.long	0x6008
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL596
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB201
+	.quad	.LBE201-.LBB201
+	.long	0x61aa
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x32
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST203
+	.long	.LVUS203
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x32
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST204
+	.long	.LVUS204
+	.uleb128 0x5
+	.quad	.LBB202
+	.quad	.LBE202-.LBB202
+	.long	0x6195
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x32
+	.byte	0x78
+	.long	0x14a
+	.long	.LLST205
+	.long	.LVUS205
+	.uleb128 0x6
+	.quad	.LVL599
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL600
+	.long	0x961
+	.long	0x6100
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL604
+	.long	0x961
+	.long	0x614c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL605
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL597
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB203
+	.quad	.LBE203-.LBB203
+	.long	0x6310
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x33
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST206
+	.long	.LVUS206
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x33
+	.byte	0x49
+	.long	0x14a
+	.long	.LLST207
+	.long	.LVUS207
+	.uleb128 0x5
+	.quad	.LBB204
+	.quad	.LBE204-.LBB204
+	.long	0x62fb
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x33
+	.byte	0x72
+	.long	0x14a
+	.long	.LLST208
+	.long	.LVUS208
+	.uleb128 0x6
+	.quad	.LVL609
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL610
+	.long	0x961
+	.long	0x6266
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL614
+	.long	0x961
+	.long	0x62b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL615
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL607
+	.long	0x759
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB205
+	.quad	.LBE205-.LBB205
+	.long	0x6476
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x34
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST209
+	.long	.LVUS209
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x34
+	.byte	0x4d
+	.long	0x14a
+	.long	.LLST210
+	.long	.LVUS210
+	.uleb128 0x5
+	.quad	.LBB206
+	.quad	.LBE206-.LBB206
+	.long	0x6461
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x34
+	.byte	0x75
+	.long	0x14a
+	.long	.LLST211
+	.long	.LVUS211
+	.uleb128 0x6
+	.quad	.LVL619
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL620
+	.long	0x961
+	.long	0x63cc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL624
+	.long	0x961
+	.long	0x6418
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL625
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL617
+	.long	0x73d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL591
+	.long	0x6489
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL628
+	.long	0x7da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB207
+	.quad	.LBE207-.LBB207
+	.long	0x692a
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0x3a
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST212
+	.long	.LVUS212
+	.uleb128 0x5
+	.quad	.LBB208
+	.quad	.LBE208-.LBB208
+	.long	0x6631
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x3b
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST213
+	.long	.LVUS213
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x3b
+	.byte	0x4f
+	.long	0x14a
+	.long	.LLST214
+	.long	.LVUS214
+	.uleb128 0x5
+	.quad	.LBB209
+	.quad	.LBE209-.LBB209
+	.long	0x661c
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x3b
+	.byte	0x78
+	.long	0x14a
+	.long	.LLST215
+	.long	.LVUS215
+	.uleb128 0x6
+	.quad	.LVL633
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL634
+	.long	0x961
+	.long	0x6587
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL638
+	.long	0x961
+	.long	0x65d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL639
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL631
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB210
+	.quad	.LBE210-.LBB210
+	.long	0x6797
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x3c
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST216
+	.long	.LVUS216
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x3c
+	.byte	0x49
+	.long	0x14a
+	.long	.LLST217
+	.long	.LVUS217
+	.uleb128 0x5
+	.quad	.LBB211
+	.quad	.LBE211-.LBB211
+	.long	0x6782
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x3c
+	.byte	0x72
+	.long	0x14a
+	.long	.LLST218
+	.long	.LVUS218
+	.uleb128 0x6
+	.quad	.LVL643
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL644
+	.long	0x961
+	.long	0x66ed
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL648
+	.long	0x961
+	.long	0x6739
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL649
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL641
+	.long	0x759
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB212
+	.quad	.LBE212-.LBB212
+	.long	0x68fd
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x3d
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST219
+	.long	.LVUS219
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x3d
+	.byte	0x4d
+	.long	0x14a
+	.long	.LLST220
+	.long	.LVUS220
+	.uleb128 0x5
+	.quad	.LBB213
+	.quad	.LBE213-.LBB213
+	.long	0x68e8
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x3d
+	.byte	0x75
+	.long	0x14a
+	.long	.LLST221
+	.long	.LVUS221
+	.uleb128 0x6
+	.quad	.LVL653
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL654
+	.long	0x961
+	.long	0x6853
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL658
+	.long	0x961
+	.long	0x689f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL659
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL651
+	.long	0x73d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL629
+	.long	0x6910
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL662
+	.long	0x7da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB214
+	.quad	.LBE214-.LBB214
+	.long	0x6d9f
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0x43
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST222
+	.long	.LVUS222
+	.uleb128 0x5
+	.quad	.LBB215
+	.quad	.LBE215-.LBB215
+	.long	0x6ab2
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x44
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST223
+	.long	.LVUS223
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x44
+	.byte	0x4b
+	.long	0x14a
+	.long	.LLST224
+	.long	.LVUS224
+	.uleb128 0x8
+	.long	.LLRL225
+	.long	0x6a97
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x44
+	.byte	0x90
+	.long	0x14a
+	.long	.LLST226
+	.long	.LVUS226
+	.uleb128 0x6
+	.quad	.LVL668
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL669
+	.long	0x961
+	.long	0x6a02
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC61
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL675
+	.long	0x961
+	.long	0x6a4e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC61
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL676
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC61
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL665
+	.long	0x8c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB218
+	.quad	.LBE218-.LBB218
+	.long	0x6c12
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x45
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST227
+	.long	.LVUS227
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x45
+	.byte	0x45
+	.long	0x14a
+	.long	.LLST228
+	.long	.LVUS228
+	.uleb128 0x8
+	.long	.LLRL229
+	.long	0x6bf7
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x45
+	.byte	0x8a
+	.long	0x14a
+	.long	.LLST230
+	.long	.LVUS230
+	.uleb128 0x6
+	.quad	.LVL681
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL682
+	.long	0x961
+	.long	0x6b62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC63
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC61
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL688
+	.long	0x961
+	.long	0x6bae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC63
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC61
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL689
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC63
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC61
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL678
+	.long	0x759
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB221
+	.quad	.LBE221-.LBB221
+	.long	0x6d72
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0x46
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST231
+	.long	.LVUS231
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0x46
+	.byte	0x49
+	.long	0x14a
+	.long	.LLST232
+	.long	.LVUS232
+	.uleb128 0x8
+	.long	.LLRL233
+	.long	0x6d57
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0x46
+	.byte	0x8e
+	.long	0x14a
+	.long	.LLST234
+	.long	.LVUS234
+	.uleb128 0x6
+	.quad	.LVL694
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL695
+	.long	0x961
+	.long	0x6cc2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC64
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL701
+	.long	0x961
+	.long	0x6d0e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC64
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL702
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC64
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL691
+	.long	0x73d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL663
+	.long	0x6d85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL705
+	.long	0x7da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB224
+	.quad	.LBE224-.LBB224
+	.long	0x754c
+	.uleb128 0x4
+	.long	.LASF1711
+	.byte	0x4c
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST235
+	.long	.LVUS235
+	.uleb128 0x4
+	.long	.LASF1736
+	.byte	0x4d
+	.byte	0x13
+	.long	0x14a
+	.long	.LLST236
+	.long	.LVUS236
+	.uleb128 0x5
+	.quad	.LBB225
+	.quad	.LBE225-.LBB225
+	.long	0x6f0c
+	.uleb128 0x4
+	.long	.LASF1737
+	.byte	0x4e
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST237
+	.long	.LVUS237
+	.uleb128 0xf
+	.long	.LASF1738
+	.byte	0x4e
+	.byte	0x59
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x14
+	.long	.LASF1739
+	.byte	0x4e
+	.byte	0x8f
+	.long	0x19e
+	.byte	0x1
+	.uleb128 0x2
+	.quad	.LVL712
+	.long	0x8c5
+	.long	0x6e3b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL715
+	.long	0x92e
+	.long	0x6e53
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL716
+	.long	0x961
+	.long	0x6e9f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC66
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL717
+	.long	0x90d
+	.long	0x6ec3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL718
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC66
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB226
+	.quad	.LBE226-.LBB226
+	.long	0x703e
+	.uleb128 0x4
+	.long	.LASF1737
+	.byte	0x4f
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST238
+	.long	.LVUS238
+	.uleb128 0xf
+	.long	.LASF1738
+	.byte	0x4f
+	.byte	0x53
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x14
+	.long	.LASF1739
+	.byte	0x4f
+	.byte	0x89
+	.long	0x19e
+	.byte	0x1
+	.uleb128 0x2
+	.quad	.LVL719
+	.long	0x759
+	.long	0x6f6d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL722
+	.long	0x92e
+	.long	0x6f85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL723
+	.long	0x961
+	.long	0x6fd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC67
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL724
+	.long	0x90d
+	.long	0x6ff5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL725
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC67
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB227
+	.quad	.LBE227-.LBB227
+	.long	0x7170
+	.uleb128 0x4
+	.long	.LASF1737
+	.byte	0x50
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST239
+	.long	.LVUS239
+	.uleb128 0xf
+	.long	.LASF1738
+	.byte	0x50
+	.byte	0x57
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x14
+	.long	.LASF1739
+	.byte	0x50
+	.byte	0x8d
+	.long	0x19e
+	.byte	0x1
+	.uleb128 0x2
+	.quad	.LVL726
+	.long	0x73d
+	.long	0x709f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL729
+	.long	0x92e
+	.long	0x70b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL730
+	.long	0x961
+	.long	0x7103
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL731
+	.long	0x90d
+	.long	0x7127
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL732
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB228
+	.quad	.LBE228-.LBB228
+	.long	0x72a2
+	.uleb128 0x4
+	.long	.LASF1737
+	.byte	0x51
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST240
+	.long	.LVUS240
+	.uleb128 0xf
+	.long	.LASF1738
+	.byte	0x51
+	.byte	0x5a
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x14
+	.long	.LASF1739
+	.byte	0x51
+	.byte	0x90
+	.long	0x19e
+	.byte	0x1
+	.uleb128 0x2
+	.quad	.LVL733
+	.long	0x8c5
+	.long	0x71d1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL736
+	.long	0x92e
+	.long	0x71e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL737
+	.long	0x961
+	.long	0x7235
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL738
+	.long	0x90d
+	.long	0x7259
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL739
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB229
+	.quad	.LBE229-.LBB229
+	.long	0x73d4
+	.uleb128 0x4
+	.long	.LASF1737
+	.byte	0x52
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST241
+	.long	.LVUS241
+	.uleb128 0xf
+	.long	.LASF1738
+	.byte	0x52
+	.byte	0x54
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x14
+	.long	.LASF1739
+	.byte	0x52
+	.byte	0x8a
+	.long	0x19e
+	.byte	0x1
+	.uleb128 0x2
+	.quad	.LVL740
+	.long	0x759
+	.long	0x7303
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL743
+	.long	0x92e
+	.long	0x731b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL744
+	.long	0x961
+	.long	0x7367
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC70
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL745
+	.long	0x90d
+	.long	0x738b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL746
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC70
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB230
+	.quad	.LBE230-.LBB230
+	.long	0x7506
+	.uleb128 0x4
+	.long	.LASF1737
+	.byte	0x53
+	.byte	0x18
+	.long	0x14a
+	.long	.LLST242
+	.long	.LVUS242
+	.uleb128 0xf
+	.long	.LASF1738
+	.byte	0x53
+	.byte	0x58
+	.long	0x356c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x14
+	.long	.LASF1739
+	.byte	0x53
+	.byte	0x8e
+	.long	0x19e
+	.byte	0x1
+	.uleb128 0x2
+	.quad	.LVL747
+	.long	0x73d
+	.long	0x7435
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL750
+	.long	0x92e
+	.long	0x744d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL751
+	.long	0x961
+	.long	0x7499
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x53
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL752
+	.long	0x90d
+	.long	0x74bd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL753
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x53
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL706
+	.long	0x7519
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL709
+	.long	0x752c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL754
+	.long	0x7da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL518
+	.long	0x97e
+	.uleb128 0xb
+	.quad	.LVL520
+	.long	0x7579
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL755
+	.long	0x7c2
+	.long	0x7597
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL756
+	.long	0x7af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x14a
+	.long	0x75bc
+	.uleb128 0x16
+	.long	0x32
+	.byte	0x3
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1743
+	.byte	0x5
+	.long	0x267
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x79f5
+	.uleb128 0x18
+	.long	.LASF1707
+	.byte	0x5
+	.byte	0x33
+	.long	0x333
+	.long	.LLST243
+	.long	.LVUS243
+	.uleb128 0x18
+	.long	.LASF1708
+	.byte	0x5
+	.byte	0x48
+	.long	0x99e
+	.long	.LLST244
+	.long	.LVUS244
+	.uleb128 0x4
+	.long	.LASF1670
+	.byte	0x7
+	.byte	0x15
+	.long	0x65d
+	.long	.LLST245
+	.long	.LVUS245
+	.uleb128 0x1b
+	.string	"uq"
+	.byte	0x8
+	.byte	0x13
+	.long	0x653
+	.long	.LLST246
+	.long	.LVUS246
+	.uleb128 0xf
+	.long	.LASF1710
+	.byte	0x9
+	.byte	0xf
+	.long	0x356c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.quad	.LBB231
+	.quad	.LBE231-.LBB231
+	.long	0x77e6
+	.uleb128 0x1b
+	.string	"x"
+	.byte	0xd
+	.byte	0x15
+	.long	0x14a
+	.long	.LLST247
+	.long	.LVUS247
+	.uleb128 0x5
+	.quad	.LBB232
+	.quad	.LBE232-.LBB232
+	.long	0x77be
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xd
+	.byte	0x44
+	.long	0x14a
+	.long	.LLST248
+	.long	.LVUS248
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xd
+	.byte	0x6a
+	.long	0x14a
+	.long	.LLST249
+	.long	.LVUS249
+	.uleb128 0x5
+	.quad	.LBB233
+	.quad	.LBE233-.LBB233
+	.long	0x77a9
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xd
+	.byte	0x92
+	.long	0x14a
+	.long	.LLST250
+	.long	.LVUS250
+	.uleb128 0x6
+	.quad	.LVL771
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL772
+	.long	0x961
+	.long	0x7716
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL776
+	.long	0x961
+	.long	0x7761
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL777
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL768
+	.long	0x726
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL766
+	.long	0x77d1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL779
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB234
+	.quad	.LBE234-.LBB234
+	.long	0x7997
+	.uleb128 0x1b
+	.string	"x"
+	.byte	0xe
+	.byte	0x15
+	.long	0x14a
+	.long	.LLST251
+	.long	.LVUS251
+	.uleb128 0x5
+	.quad	.LBB235
+	.quad	.LBE235-.LBB235
+	.long	0x796f
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xe
+	.byte	0x3a
+	.long	0x14a
+	.long	.LLST252
+	.long	.LVUS252
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xe
+	.byte	0x60
+	.long	0x14a
+	.long	.LLST253
+	.long	.LVUS253
+	.uleb128 0x5
+	.quad	.LBB236
+	.quad	.LBE236-.LBB236
+	.long	0x795a
+	.uleb128 0x4
+	.long	.LASF1719
+	.byte	0xe
+	.byte	0x89
+	.long	0x14a
+	.long	.LLST254
+	.long	.LVUS254
+	.uleb128 0x6
+	.quad	.LVL786
+	.long	0x92e
+	.uleb128 0x2
+	.quad	.LVL787
+	.long	0x961
+	.long	0x78c7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL792
+	.long	0x961
+	.long	0x7912
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL793
+	.long	0x961
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL782
+	.long	0x726
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL780
+	.long	0x7982
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL795
+	.long	0x8e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL763
+	.long	0x97e
+	.uleb128 0xb
+	.quad	.LVL765
+	.long	0x79c3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL796
+	.long	0x7c2
+	.long	0x79e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL797
+	.long	0x7af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1744
+	.long	.LASF1744
+	.uleb128 0x2d
+	.long	.LASF1745
+	.long	.LASF1745
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 265
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 265
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 52
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU4
+	.uleb128 .LVU15
+	.uleb128 .LVU72
+	.uleb128 .LVU749
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU7
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU69
+	.uleb128 .LVU70
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU182
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU367
+	.uleb128 .LVU367
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU456
+	.uleb128 .LVU487
+	.uleb128 .LVU489
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU15
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU64
+	.uleb128 .LVU70
+	.uleb128 .LVU72
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU20
+	.uleb128 .LVU64
+	.uleb128 .LVU70
+	.uleb128 .LVU72
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU36
+	.uleb128 .LVU51
+	.uleb128 .LVU54
+	.uleb128 .LVU64
+	.uleb128 .LVU70
+	.uleb128 .LVU72
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU37
+	.uleb128 .LVU51
+	.uleb128 .LVU54
+	.uleb128 .LVU64
+	.uleb128 .LVU70
+	.uleb128 .LVU72
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU44
+	.uleb128 .LVU49
+	.uleb128 .LVU56
+	.uleb128 .LVU63
+	.uleb128 .LVU70
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU72
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU75
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 .LVU333
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL28-1-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU91
+	.uleb128 .LVU333
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU99
+	.uleb128 .LVU104
+	.uleb128 .LVU107
+	.uleb128 .LVU116
+	.uleb128 .LVU133
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU136
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU116
+	.uleb128 .LVU131
+	.uleb128 .LVU136
+	.uleb128 .LVU140
+	.uleb128 .LVU143
+	.uleb128 .LVU152
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL39-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU118
+	.uleb128 .LVU133
+	.uleb128 .LVU136
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU122
+	.uleb128 .LVU131
+	.uleb128 .LVU138
+	.uleb128 .LVU139
+	.uleb128 .LVU143
+	.uleb128 .LVU151
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU152
+	.uleb128 .LVU166
+	.uleb128 .LVU168
+	.uleb128 .LVU171
+	.uleb128 .LVU174
+	.uleb128 .LVU181
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU153
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU157
+	.uleb128 .LVU166
+	.uleb128 .LVU169
+	.uleb128 .LVU170
+	.uleb128 .LVU174
+	.uleb128 .LVU180
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU239
+	.uleb128 .LVU333
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU247
+	.uleb128 .LVU252
+	.uleb128 .LVU255
+	.uleb128 .LVU264
+	.uleb128 .LVU280
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU283
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU264
+	.uleb128 .LVU278
+	.uleb128 .LVU283
+	.uleb128 .LVU287
+	.uleb128 .LVU290
+	.uleb128 .LVU299
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL93-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU265
+	.uleb128 .LVU280
+	.uleb128 .LVU283
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU269
+	.uleb128 .LVU278
+	.uleb128 .LVU285
+	.uleb128 .LVU286
+	.uleb128 .LVU290
+	.uleb128 .LVU298
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU299
+	.uleb128 .LVU313
+	.uleb128 .LVU315
+	.uleb128 .LVU318
+	.uleb128 .LVU321
+	.uleb128 .LVU328
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU300
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU304
+	.uleb128 .LVU313
+	.uleb128 .LVU316
+	.uleb128 .LVU317
+	.uleb128 .LVU321
+	.uleb128 .LVU327
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU333
+	.uleb128 .LVU339
+	.uleb128 .LVU339
+	.uleb128 .LVU509
+	.uleb128 .LVU524
+	.uleb128 .LVU526
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL106-1-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU350
+	.uleb128 .LVU355
+	.uleb128 .LVU355
+	.uleb128 .LVU509
+	.uleb128 .LVU524
+	.uleb128 .LVU526
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU388
+	.uleb128 .LVU509
+	.uleb128 .LVU524
+	.uleb128 .LVU526
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU389
+	.uleb128 .LVU509
+	.uleb128 .LVU524
+	.uleb128 .LVU526
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU396
+	.uleb128 .LVU401
+	.uleb128 .LVU404
+	.uleb128 .LVU414
+	.uleb128 .LVU414
+	.uleb128 .LVU434
+	.uleb128 .LVU442
+	.uleb128 .LVU444
+	.uleb128 .LVU444
+	.uleb128 .LVU445
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU412
+	.uleb128 .LVU442
+	.uleb128 .LVU445
+	.uleb128 .LVU509
+	.uleb128 .LVU524
+	.uleb128 .LVU526
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU421
+	.uleb128 .LVU442
+	.uleb128 .LVU445
+	.uleb128 .LVU509
+	.uleb128 .LVU524
+	.uleb128 .LVU526
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU456
+	.uleb128 .LVU459
+	.uleb128 .LVU459
+	.uleb128 .LVU487
+	.uleb128 .LVU489
+	.uleb128 .LVU509
+	.uleb128 .LVU524
+	.uleb128 .LVU526
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL143-1-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU435
+	.uleb128 .LVU440
+	.uleb128 .LVU447
+	.uleb128 .LVU455
+	.uleb128 .LVU487
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU489
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU477
+	.uleb128 .LVU479
+	.uleb128 .LVU479
+	.uleb128 .LVU487
+	.uleb128 .LVU495
+	.uleb128 .LVU497
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU480
+	.uleb128 .LVU486
+	.uleb128 .LVU495
+	.uleb128 .LVU496
+	.uleb128 .LVU496
+	.uleb128 .LVU497
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU512
+	.uleb128 .LVU517
+	.uleb128 .LVU517
+	.uleb128 .LVU524
+	.uleb128 .LVU526
+	.uleb128 .LVU651
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU559
+	.uleb128 .LVU651
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU567
+	.uleb128 .LVU572
+	.uleb128 .LVU575
+	.uleb128 .LVU584
+	.uleb128 .LVU600
+	.uleb128 .LVU602
+	.uleb128 .LVU602
+	.uleb128 .LVU603
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU584
+	.uleb128 .LVU598
+	.uleb128 .LVU603
+	.uleb128 .LVU607
+	.uleb128 .LVU610
+	.uleb128 .LVU619
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL185-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL195-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU585
+	.uleb128 .LVU600
+	.uleb128 .LVU603
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU589
+	.uleb128 .LVU598
+	.uleb128 .LVU605
+	.uleb128 .LVU606
+	.uleb128 .LVU610
+	.uleb128 .LVU618
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU619
+	.uleb128 .LVU633
+	.uleb128 .LVU635
+	.uleb128 .LVU638
+	.uleb128 .LVU641
+	.uleb128 .LVU648
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL197-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU620
+	.uleb128 0
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU624
+	.uleb128 .LVU633
+	.uleb128 .LVU636
+	.uleb128 .LVU637
+	.uleb128 .LVU641
+	.uleb128 .LVU647
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU651
+	.uleb128 .LVU656
+	.uleb128 .LVU656
+	.uleb128 .LVU704
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL208-1-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU667
+	.uleb128 .LVU704
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU675
+	.uleb128 .LVU680
+	.uleb128 .LVU683
+	.uleb128 .LVU688
+	.uleb128 .LVU688
+	.uleb128 .LVU689
+	.uleb128 .LVU689
+	.uleb128 .LVU693
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU696
+	.uleb128 .LVU699
+	.uleb128 .LVU699
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU720
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU728
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU742
+	.uleb128 .LVU742
+	.uleb128 .LVU746
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU749
+	.uleb128 .LVU750
+	.uleb128 .LVU750
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL240-1-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU773
+	.uleb128 0
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU781
+	.uleb128 .LVU786
+	.uleb128 .LVU789
+	.uleb128 .LVU794
+	.uleb128 .LVU794
+	.uleb128 .LVU795
+	.uleb128 .LVU795
+	.uleb128 .LVU801
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL250-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL254-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL255-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU801
+	.uleb128 .LVU813
+	.uleb128 .LVU814
+	.uleb128 .LVU819
+	.uleb128 .LVU823
+	.uleb128 .LVU832
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL261-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL265-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU802
+	.uleb128 0
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU806
+	.uleb128 .LVU812
+	.uleb128 .LVU815
+	.uleb128 .LVU819
+	.uleb128 .LVU823
+	.uleb128 .LVU831
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL261-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU832
+	.uleb128 .LVU844
+	.uleb128 .LVU845
+	.uleb128 .LVU850
+	.uleb128 .LVU854
+	.uleb128 .LVU861
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU833
+	.uleb128 0
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU837
+	.uleb128 .LVU843
+	.uleb128 .LVU846
+	.uleb128 .LVU850
+	.uleb128 .LVU854
+	.uleb128 .LVU860
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS90:
+	.uleb128 0
+	.uleb128 .LVU868
+	.uleb128 .LVU868
+	.uleb128 0
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 0
+	.uleb128 .LVU868
+	.uleb128 .LVU868
+	.uleb128 0
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU866
+	.uleb128 .LVU876
+	.uleb128 .LVU998
+	.uleb128 .LVU1217
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU869
+	.uleb128 .LVU872
+	.uleb128 .LVU872
+	.uleb128 .LVU997
+	.uleb128 .LVU998
+	.uleb128 0
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL280-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL280-1-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU876
+	.uleb128 .LVU879
+	.uleb128 .LVU879
+	.uleb128 .LVU992
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU881
+	.uleb128 .LVU992
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU897
+	.uleb128 .LVU912
+	.uleb128 .LVU915
+	.uleb128 .LVU992
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU898
+	.uleb128 .LVU912
+	.uleb128 .LVU915
+	.uleb128 .LVU992
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU905
+	.uleb128 .LVU910
+	.uleb128 .LVU917
+	.uleb128 .LVU926
+	.uleb128 .LVU943
+	.uleb128 .LVU945
+	.uleb128 .LVU945
+	.uleb128 .LVU946
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL290-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL295-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL301-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU926
+	.uleb128 .LVU941
+	.uleb128 .LVU946
+	.uleb128 .LVU950
+	.uleb128 .LVU953
+	.uleb128 .LVU962
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL298-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL308-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU928
+	.uleb128 .LVU943
+	.uleb128 .LVU946
+	.uleb128 .LVU992
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU932
+	.uleb128 .LVU941
+	.uleb128 .LVU948
+	.uleb128 .LVU949
+	.uleb128 .LVU953
+	.uleb128 .LVU961
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL298-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU962
+	.uleb128 .LVU976
+	.uleb128 .LVU978
+	.uleb128 .LVU981
+	.uleb128 .LVU984
+	.uleb128 .LVU991
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL310-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL318-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU963
+	.uleb128 .LVU992
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU967
+	.uleb128 .LVU976
+	.uleb128 .LVU979
+	.uleb128 .LVU980
+	.uleb128 .LVU984
+	.uleb128 .LVU990
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL310-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU1000
+	.uleb128 .LVU1005
+	.uleb128 .LVU1005
+	.uleb128 .LVU1109
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL325-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL325-1-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU1016
+	.uleb128 .LVU1109
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU1024
+	.uleb128 .LVU1029
+	.uleb128 .LVU1032
+	.uleb128 .LVU1041
+	.uleb128 .LVU1059
+	.uleb128 .LVU1061
+	.uleb128 .LVU1061
+	.uleb128 .LVU1062
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL330-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL333-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL339-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU1041
+	.uleb128 .LVU1057
+	.uleb128 .LVU1062
+	.uleb128 .LVU1066
+	.uleb128 .LVU1069
+	.uleb128 .LVU1078
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL336-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL346-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU1043
+	.uleb128 .LVU1059
+	.uleb128 .LVU1062
+	.uleb128 0
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU1047
+	.uleb128 .LVU1057
+	.uleb128 .LVU1064
+	.uleb128 .LVU1065
+	.uleb128 .LVU1069
+	.uleb128 .LVU1077
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL336-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU1078
+	.uleb128 .LVU1091
+	.uleb128 .LVU1093
+	.uleb128 .LVU1096
+	.uleb128 .LVU1099
+	.uleb128 .LVU1106
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL348-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL356-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU1079
+	.uleb128 0
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU1082
+	.uleb128 .LVU1091
+	.uleb128 .LVU1094
+	.uleb128 .LVU1095
+	.uleb128 .LVU1099
+	.uleb128 .LVU1105
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 .LVL348-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU1109
+	.uleb128 .LVU1114
+	.uleb128 .LVU1114
+	.uleb128 0
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LVL359-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL359-1-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU1125
+	.uleb128 0
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU1133
+	.uleb128 .LVU1138
+	.uleb128 .LVU1141
+	.uleb128 .LVU1150
+	.uleb128 .LVU1166
+	.uleb128 .LVU1168
+	.uleb128 .LVU1168
+	.uleb128 .LVU1169
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 .LVL365-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 .LVL368-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 .LVL373-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU1150
+	.uleb128 .LVU1164
+	.uleb128 .LVU1169
+	.uleb128 .LVU1173
+	.uleb128 .LVU1176
+	.uleb128 .LVU1185
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL370-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL380-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU1151
+	.uleb128 .LVU1166
+	.uleb128 .LVU1169
+	.uleb128 0
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU1155
+	.uleb128 .LVU1164
+	.uleb128 .LVU1171
+	.uleb128 .LVU1172
+	.uleb128 .LVU1176
+	.uleb128 .LVU1184
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 .LVL370-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU1185
+	.uleb128 .LVU1198
+	.uleb128 .LVU1200
+	.uleb128 .LVU1203
+	.uleb128 .LVU1206
+	.uleb128 .LVU1213
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 .LVL382-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 .LVL390-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU1186
+	.uleb128 0
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU1189
+	.uleb128 .LVU1198
+	.uleb128 .LVU1201
+	.uleb128 .LVU1202
+	.uleb128 .LVU1206
+	.uleb128 .LVU1212
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 .LVL382-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU1217
+	.uleb128 .LVU1222
+	.uleb128 .LVU1222
+	.uleb128 0
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL393-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL393-1-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU1233
+	.uleb128 0
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU1241
+	.uleb128 .LVU1246
+	.uleb128 .LVU1249
+	.uleb128 .LVU1258
+	.uleb128 .LVU1274
+	.uleb128 .LVU1276
+	.uleb128 .LVU1276
+	.uleb128 .LVU1277
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 .LVL399-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LVL402-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 .LVL407-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU1258
+	.uleb128 .LVU1272
+	.uleb128 .LVU1277
+	.uleb128 .LVU1281
+	.uleb128 .LVU1284
+	.uleb128 .LVU1293
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL404-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL407-.Ltext0
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 .LVL414-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU1259
+	.uleb128 .LVU1274
+	.uleb128 .LVU1277
+	.uleb128 0
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL407-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU1263
+	.uleb128 .LVU1272
+	.uleb128 .LVU1279
+	.uleb128 .LVU1280
+	.uleb128 .LVU1284
+	.uleb128 .LVU1292
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 .LVL404-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU1293
+	.uleb128 .LVU1306
+	.uleb128 .LVU1308
+	.uleb128 .LVU1311
+	.uleb128 .LVU1314
+	.uleb128 .LVU1321
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 .LVL416-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LVL424-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU1294
+	.uleb128 0
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU1297
+	.uleb128 .LVU1306
+	.uleb128 .LVU1309
+	.uleb128 .LVU1310
+	.uleb128 .LVU1314
+	.uleb128 .LVU1320
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 .LVL416-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 .LVL419-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS147:
+	.uleb128 0
+	.uleb128 .LVU1328
+	.uleb128 .LVU1328
+	.uleb128 0
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL427-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL427-1-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS148:
+	.uleb128 0
+	.uleb128 .LVU1328
+	.uleb128 .LVU1328
+	.uleb128 0
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL427-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL427-1-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU1326
+	.uleb128 .LVU1358
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU1329
+	.uleb128 .LVU1337
+	.uleb128 .LVU1337
+	.uleb128 .LVU1547
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 .LVL429-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL429-1-.Ltext0
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU1339
+	.uleb128 .LVU1341
+	.uleb128 .LVU1341
+	.uleb128 .LVU1546
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL431-.Ltext0
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU1342
+	.uleb128 .LVU1345
+	.uleb128 .LVU1345
+	.uleb128 .LVU1548
+	.uleb128 .LVU1548
+	.uleb128 0
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -760
+	.byte	0x4
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -752
+	.byte	0
+.LVUS153:
+	.uleb128 .LVU1343
+	.uleb128 .LVU1345
+	.uleb128 .LVU1345
+	.uleb128 .LVU1348
+	.uleb128 .LVU1349
+	.uleb128 .LVU1355
+	.uleb128 .LVU1357
+	.uleb128 .LVU1359
+	.uleb128 .LVU1359
+	.uleb128 .LVU1449
+	.uleb128 .LVU1449
+	.uleb128 .LVU1451
+	.uleb128 .LVU1451
+	.uleb128 .LVU1514
+	.uleb128 .LVU1514
+	.uleb128 .LVU1516
+	.uleb128 .LVU1516
+	.uleb128 .LVU1545
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 .LVL436-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL437-.Ltext0
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 .LVL498-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL498-.Ltext0
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU1362
+	.uleb128 .LVU1375
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU1365
+	.uleb128 .LVU1375
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU1375
+	.uleb128 .LVU1398
+	.uleb128 .LVU1410
+	.uleb128 .LVU1446
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL459-.Ltext0
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU1375
+	.uleb128 .LVU1377
+	.uleb128 .LVU1412
+	.uleb128 .LVU1419
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL460-.Ltext0
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU1377
+	.uleb128 .LVU1383
+	.uleb128 .LVU1385
+	.uleb128 .LVU1386
+	.uleb128 .LVU1389
+	.uleb128 .LVU1395
+	.uleb128 .LVU1416
+	.uleb128 .LVU1431
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL449-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 .LVL451-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL461-.Ltext0
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU1389
+	.uleb128 .LVU1398
+	.uleb128 .LVU1428
+	.uleb128 .LVU1438
+	.uleb128 .LVU1440
+	.uleb128 .LVU1442
+	.uleb128 .LVU1442
+	.uleb128 .LVU1444
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 .LVL467-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 .LVL472-1-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x2e0
+	.byte	0x1c
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU1391
+	.uleb128 .LVU1398
+	.uleb128 .LVU1430
+	.uleb128 .LVU1438
+	.uleb128 .LVU1440
+	.uleb128 .LVU1441
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 .LVL467-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU1395
+	.uleb128 .LVU1398
+	.uleb128 .LVU1432
+	.uleb128 .LVU1438
+	.uleb128 .LVU1440
+	.uleb128 .LVU1443
+.LLST165:
+	.byte	0x4
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL466-.Ltext0
+	.uleb128 .LVL467-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU1454
+	.uleb128 .LVU1467
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU1457
+	.uleb128 .LVU1467
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU1467
+	.uleb128 .LVU1472
+	.uleb128 .LVU1483
+	.uleb128 .LVU1494
+	.uleb128 .LVU1496
+	.uleb128 .LVU1499
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x2e0
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LVL489-1-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x2e0
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 .LVL493-1-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x2e0
+	.byte	0x1c
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU1467
+	.uleb128 .LVU1472
+	.uleb128 .LVU1485
+	.uleb128 .LVU1494
+	.uleb128 .LVU1496
+	.uleb128 .LVU1498
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 .LVL489-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS172:
+	.uleb128 .LVU1469
+	.uleb128 .LVU1472
+	.uleb128 .LVU1488
+	.uleb128 .LVU1494
+	.uleb128 .LVU1496
+	.uleb128 .LVU1497
+.LLST172:
+	.byte	0x4
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 .LVL489-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU1508
+	.uleb128 .LVU1513
+	.uleb128 .LVU1516
+	.uleb128 .LVU1517
+	.uleb128 .LVU1517
+	.uleb128 .LVU1518
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 .LVL497-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL498-.Ltext0
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 .LVL500-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -736
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU1518
+	.uleb128 .LVU1523
+	.uleb128 .LVU1527
+	.uleb128 .LVU1539
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS177:
+	.uleb128 .LVU1518
+	.uleb128 .LVU1523
+	.uleb128 .LVU1530
+	.uleb128 .LVU1539
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS178:
+	.uleb128 0
+	.uleb128 .LVU1555
+	.uleb128 .LVU1555
+	.uleb128 0
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 .LVL518-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL518-1-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS179:
+	.uleb128 0
+	.uleb128 .LVU1555
+	.uleb128 .LVU1555
+	.uleb128 0
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 .LVL518-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL518-1-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU1553
+	.uleb128 .LVU2071
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL517-.Ltext0
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU1556
+	.uleb128 .LVU1559
+	.uleb128 .LVU1559
+	.uleb128 .LVU2186
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 .LVL520-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL520-1-.Ltext0
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU1561
+	.uleb128 .LVU1564
+	.uleb128 .LVU1564
+	.uleb128 .LVU1659
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL523-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL523-1-.Ltext0
+	.uleb128 .LVL558-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU1564
+	.uleb128 .LVU1579
+	.uleb128 .LVU1581
+	.uleb128 .LVU1584
+	.uleb128 .LVU1587
+	.uleb128 .LVU1596
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 .LVL526-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL527-.Ltext0
+	.uleb128 .LVL530-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL532-.Ltext0
+	.uleb128 .LVL534-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU1566
+	.uleb128 .LVU2068
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL524-.Ltext0
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU1570
+	.uleb128 .LVU1579
+	.uleb128 .LVU1582
+	.uleb128 .LVU1583
+	.uleb128 .LVU1587
+	.uleb128 .LVU1595
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL525-.Ltext0
+	.uleb128 .LVL526-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 .LVL529-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL532-.Ltext0
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS186:
+	.uleb128 .LVU1596
+	.uleb128 .LVU1610
+	.uleb128 .LVU1612
+	.uleb128 .LVU1615
+	.uleb128 .LVU1618
+	.uleb128 .LVU1627
+.LLST186:
+	.byte	0x4
+	.uleb128 .LVL534-.Ltext0
+	.uleb128 .LVL536-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL537-.Ltext0
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 .LVL544-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU1597
+	.uleb128 .LVU2068
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL534-.Ltext0
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU1601
+	.uleb128 .LVU1610
+	.uleb128 .LVU1613
+	.uleb128 .LVU1614
+	.uleb128 .LVU1618
+	.uleb128 .LVU1626
+.LLST188:
+	.byte	0x4
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 .LVL536-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL538-.Ltext0
+	.uleb128 .LVL539-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 .LVL543-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU1627
+	.uleb128 .LVU1641
+	.uleb128 .LVU1643
+	.uleb128 .LVU1646
+	.uleb128 .LVU1649
+	.uleb128 .LVU1656
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL544-.Ltext0
+	.uleb128 .LVL547-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL553-.Ltext0
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS190:
+	.uleb128 .LVU1629
+	.uleb128 .LVU2076
+.LLST190:
+	.byte	0x4
+	.uleb128 .LVL545-.Ltext0
+	.uleb128 .LVL713-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU1632
+	.uleb128 .LVU1641
+	.uleb128 .LVU1644
+	.uleb128 .LVU1645
+	.uleb128 .LVU1649
+	.uleb128 .LVU1655
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL546-.Ltext0
+	.uleb128 .LVL547-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL549-.Ltext0
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL553-.Ltext0
+	.uleb128 .LVL554-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU1659
+	.uleb128 .LVU1662
+	.uleb128 .LVU1662
+	.uleb128 .LVU1755
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL558-.Ltext0
+	.uleb128 .LVL559-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL559-1-.Ltext0
+	.uleb128 .LVL592-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS193:
+	.uleb128 .LVU1662
+	.uleb128 .LVU1675
+	.uleb128 .LVU1677
+	.uleb128 .LVU1680
+	.uleb128 .LVU1683
+	.uleb128 .LVU1692
+.LLST193:
+	.byte	0x4
+	.uleb128 .LVL559-.Ltext0
+	.uleb128 .LVL561-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL562-.Ltext0
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL567-.Ltext0
+	.uleb128 .LVL569-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS194:
+	.uleb128 .LVU1663
+	.uleb128 .LVU2076
+.LLST194:
+	.byte	0x4
+	.uleb128 .LVL559-.Ltext0
+	.uleb128 .LVL713-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU1666
+	.uleb128 .LVU1675
+	.uleb128 .LVU1678
+	.uleb128 .LVU1679
+	.uleb128 .LVU1683
+	.uleb128 .LVU1691
+.LLST195:
+	.byte	0x4
+	.uleb128 .LVL560-.Ltext0
+	.uleb128 .LVL561-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL563-.Ltext0
+	.uleb128 .LVL564-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL567-.Ltext0
+	.uleb128 .LVL568-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU1692
+	.uleb128 .LVU1705
+	.uleb128 .LVU1707
+	.uleb128 .LVU1710
+	.uleb128 .LVU1713
+	.uleb128 .LVU1722
+.LLST196:
+	.byte	0x4
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 .LVL571-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL572-.Ltext0
+	.uleb128 .LVL575-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL577-.Ltext0
+	.uleb128 .LVL579-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU1693
+	.uleb128 .LVU2076
+.LLST197:
+	.byte	0x4
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 .LVL713-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU1696
+	.uleb128 .LVU1705
+	.uleb128 .LVU1708
+	.uleb128 .LVU1709
+	.uleb128 .LVU1713
+	.uleb128 .LVU1721
+.LLST198:
+	.byte	0x4
+	.uleb128 .LVL570-.Ltext0
+	.uleb128 .LVL571-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL573-.Ltext0
+	.uleb128 .LVL574-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL577-.Ltext0
+	.uleb128 .LVL578-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU1722
+	.uleb128 .LVU1735
+	.uleb128 .LVU1737
+	.uleb128 .LVU1740
+	.uleb128 .LVU1743
+	.uleb128 .LVU1750
+.LLST199:
+	.byte	0x4
+	.uleb128 .LVL579-.Ltext0
+	.uleb128 .LVL581-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 .LVL585-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL587-.Ltext0
+	.uleb128 .LVL589-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS200:
+	.uleb128 .LVU1723
+	.uleb128 .LVU2068
+.LLST200:
+	.byte	0x4
+	.uleb128 .LVL579-.Ltext0
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU1726
+	.uleb128 .LVU1735
+	.uleb128 .LVU1738
+	.uleb128 .LVU1739
+	.uleb128 .LVU1743
+	.uleb128 .LVU1749
+.LLST201:
+	.byte	0x4
+	.uleb128 .LVL580-.Ltext0
+	.uleb128 .LVL581-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL583-.Ltext0
+	.uleb128 .LVL584-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL587-.Ltext0
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU1755
+	.uleb128 .LVU1760
+	.uleb128 .LVU1760
+	.uleb128 .LVU1861
+.LLST202:
+	.byte	0x4
+	.uleb128 .LVL592-.Ltext0
+	.uleb128 .LVL593-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL593-1-.Ltext0
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS203:
+	.uleb128 .LVU1772
+	.uleb128 .LVU1785
+	.uleb128 .LVU1787
+	.uleb128 .LVU1790
+	.uleb128 .LVU1793
+	.uleb128 .LVU1802
+.LLST203:
+	.byte	0x4
+	.uleb128 .LVL597-.Ltext0
+	.uleb128 .LVL599-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL600-.Ltext0
+	.uleb128 .LVL603-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL605-.Ltext0
+	.uleb128 .LVL607-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS204:
+	.uleb128 .LVU1773
+	.uleb128 .LVU1861
+.LLST204:
+	.byte	0x4
+	.uleb128 .LVL597-.Ltext0
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS205:
+	.uleb128 .LVU1776
+	.uleb128 .LVU1785
+	.uleb128 .LVU1788
+	.uleb128 .LVU1789
+	.uleb128 .LVU1793
+	.uleb128 .LVU1801
+.LLST205:
+	.byte	0x4
+	.uleb128 .LVL598-.Ltext0
+	.uleb128 .LVL599-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL601-.Ltext0
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL605-.Ltext0
+	.uleb128 .LVL606-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS206:
+	.uleb128 .LVU1802
+	.uleb128 .LVU1815
+	.uleb128 .LVU1817
+	.uleb128 .LVU1820
+	.uleb128 .LVU1823
+	.uleb128 .LVU1832
+.LLST206:
+	.byte	0x4
+	.uleb128 .LVL607-.Ltext0
+	.uleb128 .LVL609-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL613-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL615-.Ltext0
+	.uleb128 .LVL617-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU1803
+	.uleb128 .LVU1861
+.LLST207:
+	.byte	0x4
+	.uleb128 .LVL607-.Ltext0
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS208:
+	.uleb128 .LVU1806
+	.uleb128 .LVU1815
+	.uleb128 .LVU1818
+	.uleb128 .LVU1819
+	.uleb128 .LVU1823
+	.uleb128 .LVU1831
+.LLST208:
+	.byte	0x4
+	.uleb128 .LVL608-.Ltext0
+	.uleb128 .LVL609-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL615-.Ltext0
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS209:
+	.uleb128 .LVU1832
+	.uleb128 .LVU1845
+	.uleb128 .LVU1847
+	.uleb128 .LVU1850
+	.uleb128 .LVU1853
+	.uleb128 .LVU1860
+.LLST209:
+	.byte	0x4
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 .LVL619-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL620-.Ltext0
+	.uleb128 .LVL623-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL627-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU1833
+	.uleb128 .LVU1861
+.LLST210:
+	.byte	0x4
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS211:
+	.uleb128 .LVU1836
+	.uleb128 .LVU1845
+	.uleb128 .LVU1848
+	.uleb128 .LVU1849
+	.uleb128 .LVU1853
+	.uleb128 .LVU1859
+.LLST211:
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL619-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS212:
+	.uleb128 .LVU1864
+	.uleb128 .LVU1867
+	.uleb128 .LVU1867
+	.uleb128 .LVU1958
+.LLST212:
+	.byte	0x4
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 .LVL631-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL631-1-.Ltext0
+	.uleb128 .LVL664-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS213:
+	.uleb128 .LVU1867
+	.uleb128 .LVU1880
+	.uleb128 .LVU1882
+	.uleb128 .LVU1885
+	.uleb128 .LVU1888
+	.uleb128 .LVU1897
+.LLST213:
+	.byte	0x4
+	.uleb128 .LVL631-.Ltext0
+	.uleb128 .LVL633-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL634-.Ltext0
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL639-.Ltext0
+	.uleb128 .LVL641-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS214:
+	.uleb128 .LVU1868
+	.uleb128 .LVU2076
+.LLST214:
+	.byte	0x4
+	.uleb128 .LVL631-.Ltext0
+	.uleb128 .LVL713-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS215:
+	.uleb128 .LVU1871
+	.uleb128 .LVU1880
+	.uleb128 .LVU1883
+	.uleb128 .LVU1884
+	.uleb128 .LVU1888
+	.uleb128 .LVU1896
+.LLST215:
+	.byte	0x4
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 .LVL633-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL639-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU1897
+	.uleb128 .LVU1910
+	.uleb128 .LVU1912
+	.uleb128 .LVU1915
+	.uleb128 .LVU1918
+	.uleb128 .LVU1927
+.LLST216:
+	.byte	0x4
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 .LVL643-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL649-.Ltext0
+	.uleb128 .LVL651-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS217:
+	.uleb128 .LVU1898
+	.uleb128 .LVU2076
+.LLST217:
+	.byte	0x4
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 .LVL713-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU1901
+	.uleb128 .LVU1910
+	.uleb128 .LVU1913
+	.uleb128 .LVU1914
+	.uleb128 .LVU1918
+	.uleb128 .LVU1926
+.LLST218:
+	.byte	0x4
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 .LVL643-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL649-.Ltext0
+	.uleb128 .LVL650-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS219:
+	.uleb128 .LVU1927
+	.uleb128 .LVU1940
+	.uleb128 .LVU1942
+	.uleb128 .LVU1945
+	.uleb128 .LVU1948
+	.uleb128 .LVU1955
+.LLST219:
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL653-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL654-.Ltext0
+	.uleb128 .LVL657-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL659-.Ltext0
+	.uleb128 .LVL661-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS220:
+	.uleb128 .LVU1928
+	.uleb128 .LVU2068
+.LLST220:
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS221:
+	.uleb128 .LVU1931
+	.uleb128 .LVU1940
+	.uleb128 .LVU1943
+	.uleb128 .LVU1944
+	.uleb128 .LVU1948
+	.uleb128 .LVU1954
+.LLST221:
+	.byte	0x4
+	.uleb128 .LVL652-.Ltext0
+	.uleb128 .LVL653-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL655-.Ltext0
+	.uleb128 .LVL656-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL659-.Ltext0
+	.uleb128 .LVL660-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS222:
+	.uleb128 .LVU1958
+	.uleb128 .LVU1961
+	.uleb128 .LVU1961
+	.uleb128 .LVU2074
+.LLST222:
+	.byte	0x4
+	.uleb128 .LVL664-.Ltext0
+	.uleb128 .LVL665-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL665-1-.Ltext0
+	.uleb128 .LVL711-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS223:
+	.uleb128 .LVU1961
+	.uleb128 .LVU1976
+	.uleb128 .LVU1978
+	.uleb128 .LVU1984
+	.uleb128 .LVU1987
+	.uleb128 .LVU1996
+.LLST223:
+	.byte	0x4
+	.uleb128 .LVL665-.Ltext0
+	.uleb128 .LVL668-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL669-.Ltext0
+	.uleb128 .LVL674-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL676-.Ltext0
+	.uleb128 .LVL678-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU1963
+	.uleb128 .LVU1976
+	.uleb128 .LVU1980
+	.uleb128 .LVU1982
+	.uleb128 .LVU1987
+	.uleb128 .LVU1996
+.LLST224:
+	.byte	0x4
+	.uleb128 .LVL666-.Ltext0
+	.uleb128 .LVL668-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL670-.Ltext0
+	.uleb128 .LVL672-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL676-.Ltext0
+	.uleb128 .LVL678-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS226:
+	.uleb128 .LVU1967
+	.uleb128 .LVU1976
+	.uleb128 .LVU1981
+	.uleb128 .LVU1983
+	.uleb128 .LVU1987
+	.uleb128 .LVU1995
+.LLST226:
+	.byte	0x4
+	.uleb128 .LVL667-.Ltext0
+	.uleb128 .LVL668-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL671-.Ltext0
+	.uleb128 .LVL673-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL676-.Ltext0
+	.uleb128 .LVL677-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS227:
+	.uleb128 .LVU1996
+	.uleb128 .LVU2011
+	.uleb128 .LVU2013
+	.uleb128 .LVU2019
+	.uleb128 .LVU2022
+	.uleb128 .LVU2031
+.LLST227:
+	.byte	0x4
+	.uleb128 .LVL678-.Ltext0
+	.uleb128 .LVL681-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL682-.Ltext0
+	.uleb128 .LVL687-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 .LVL691-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS228:
+	.uleb128 .LVU1998
+	.uleb128 .LVU2011
+	.uleb128 .LVU2015
+	.uleb128 .LVU2017
+	.uleb128 .LVU2022
+	.uleb128 .LVU2031
+.LLST228:
+	.byte	0x4
+	.uleb128 .LVL679-.Ltext0
+	.uleb128 .LVL681-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL683-.Ltext0
+	.uleb128 .LVL685-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 .LVL691-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS230:
+	.uleb128 .LVU2002
+	.uleb128 .LVU2011
+	.uleb128 .LVU2016
+	.uleb128 .LVU2018
+	.uleb128 .LVU2022
+	.uleb128 .LVU2030
+.LLST230:
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LVL681-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL684-.Ltext0
+	.uleb128 .LVL686-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 .LVL690-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS231:
+	.uleb128 .LVU2031
+	.uleb128 .LVU2046
+	.uleb128 .LVU2048
+	.uleb128 .LVU2054
+	.uleb128 .LVU2057
+	.uleb128 .LVU2064
+.LLST231:
+	.byte	0x4
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 .LVL694-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL695-.Ltext0
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL702-.Ltext0
+	.uleb128 .LVL704-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS232:
+	.uleb128 .LVU2033
+	.uleb128 .LVU2046
+	.uleb128 .LVU2050
+	.uleb128 .LVU2052
+	.uleb128 .LVU2057
+	.uleb128 .LVU2065
+.LLST232:
+	.byte	0x4
+	.uleb128 .LVL692-.Ltext0
+	.uleb128 .LVL694-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL696-.Ltext0
+	.uleb128 .LVL698-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL702-.Ltext0
+	.uleb128 .LVL705-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS234:
+	.uleb128 .LVU2037
+	.uleb128 .LVU2046
+	.uleb128 .LVU2051
+	.uleb128 .LVU2053
+	.uleb128 .LVU2057
+	.uleb128 .LVU2063
+.LLST234:
+	.byte	0x4
+	.uleb128 .LVL693-.Ltext0
+	.uleb128 .LVL694-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL697-.Ltext0
+	.uleb128 .LVL699-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL702-.Ltext0
+	.uleb128 .LVL703-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS235:
+	.uleb128 .LVU2068
+	.uleb128 .LVU2070
+	.uleb128 .LVU2070
+	.uleb128 .LVU2187
+.LLST235:
+	.byte	0x4
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 .LVL708-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL708-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS236:
+	.uleb128 .LVU2071
+	.uleb128 .LVU2075
+	.uleb128 .LVU2075
+	.uleb128 .LVU2188
+.LLST236:
+	.byte	0x4
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 .LVL712-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL712-1-.Ltext0
+	.uleb128 .LVL759-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS237:
+	.uleb128 .LVU2076
+	.uleb128 .LVU2083
+	.uleb128 .LVU2083
+	.uleb128 .LVU2094
+.LLST237:
+	.byte	0x4
+	.uleb128 .LVL713-.Ltext0
+	.uleb128 .LVL715-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL715-1-.Ltext0
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS238:
+	.uleb128 .LVU2094
+	.uleb128 .LVU2101
+	.uleb128 .LVU2101
+	.uleb128 .LVU2112
+.LLST238:
+	.byte	0x4
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 .LVL722-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL722-1-.Ltext0
+	.uleb128 .LVL727-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS239:
+	.uleb128 .LVU2112
+	.uleb128 .LVU2119
+	.uleb128 .LVU2119
+	.uleb128 .LVU2130
+.LLST239:
+	.byte	0x4
+	.uleb128 .LVL727-.Ltext0
+	.uleb128 .LVL729-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL729-1-.Ltext0
+	.uleb128 .LVL734-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS240:
+	.uleb128 .LVU2130
+	.uleb128 .LVU2137
+	.uleb128 .LVU2137
+	.uleb128 .LVU2148
+.LLST240:
+	.byte	0x4
+	.uleb128 .LVL734-.Ltext0
+	.uleb128 .LVL736-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL736-1-.Ltext0
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS241:
+	.uleb128 .LVU2148
+	.uleb128 .LVU2155
+	.uleb128 .LVU2155
+	.uleb128 .LVU2166
+.LLST241:
+	.byte	0x4
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 .LVL743-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL743-1-.Ltext0
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS242:
+	.uleb128 .LVU2166
+	.uleb128 .LVU2173
+	.uleb128 .LVU2173
+	.uleb128 .LVU2189
+.LLST242:
+	.byte	0x4
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 .LVL750-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL750-1-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS243:
+	.uleb128 0
+	.uleb128 .LVU2196
+	.uleb128 .LVU2196
+	.uleb128 0
+.LLST243:
+	.byte	0x4
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 .LVL763-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL763-1-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS244:
+	.uleb128 0
+	.uleb128 .LVU2196
+	.uleb128 .LVU2196
+	.uleb128 0
+.LLST244:
+	.byte	0x4
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 .LVL763-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL763-1-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS245:
+	.uleb128 .LVU2194
+	.uleb128 .LVU2284
+.LLST245:
+	.byte	0x4
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 .LVL801-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS246:
+	.uleb128 .LVU2197
+	.uleb128 .LVU2200
+	.uleb128 .LVU2200
+	.uleb128 .LVU2282
+.LLST246:
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LVL765-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL765-1-.Ltext0
+	.uleb128 .LVL799-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS247:
+	.uleb128 .LVU2203
+	.uleb128 .LVU2206
+	.uleb128 .LVU2206
+	.uleb128 .LVU2241
+.LLST247:
+	.byte	0x4
+	.uleb128 .LVL767-.Ltext0
+	.uleb128 .LVL768-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL768-1-.Ltext0
+	.uleb128 .LVL781-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS248:
+	.uleb128 .LVU2206
+	.uleb128 .LVU2221
+	.uleb128 .LVU2223
+	.uleb128 .LVU2226
+	.uleb128 .LVU2229
+	.uleb128 .LVU2236
+.LLST248:
+	.byte	0x4
+	.uleb128 .LVL768-.Ltext0
+	.uleb128 .LVL771-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL772-.Ltext0
+	.uleb128 .LVL775-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL777-.Ltext0
+	.uleb128 .LVL779-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS249:
+	.uleb128 .LVU2208
+	.uleb128 .LVU2283
+.LLST249:
+	.byte	0x4
+	.uleb128 .LVL769-.Ltext0
+	.uleb128 .LVL800-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS250:
+	.uleb128 .LVU2212
+	.uleb128 .LVU2221
+	.uleb128 .LVU2224
+	.uleb128 .LVU2225
+	.uleb128 .LVU2229
+	.uleb128 .LVU2235
+.LLST250:
+	.byte	0x4
+	.uleb128 .LVL770-.Ltext0
+	.uleb128 .LVL771-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL773-.Ltext0
+	.uleb128 .LVL774-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL777-.Ltext0
+	.uleb128 .LVL778-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS251:
+	.uleb128 .LVU2241
+	.uleb128 .LVU2244
+	.uleb128 .LVU2244
+	.uleb128 .LVU2281
+.LLST251:
+	.byte	0x4
+	.uleb128 .LVL781-.Ltext0
+	.uleb128 .LVL782-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL782-1-.Ltext0
+	.uleb128 .LVL798-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS252:
+	.uleb128 .LVU2245
+	.uleb128 .LVU2247
+	.uleb128 .LVU2247
+	.uleb128 .LVU2259
+	.uleb128 .LVU2261
+	.uleb128 .LVU2263
+	.uleb128 .LVU2268
+	.uleb128 .LVU2275
+.LLST252:
+	.byte	0x4
+	.uleb128 .LVL783-.Ltext0
+	.uleb128 .LVL784-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL784-.Ltext0
+	.uleb128 .LVL786-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL787-.Ltext0
+	.uleb128 .LVL789-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL793-.Ltext0
+	.uleb128 .LVL795-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS253:
+	.uleb128 .LVU2247
+	.uleb128 .LVU2259
+	.uleb128 .LVU2261
+	.uleb128 .LVU2265
+	.uleb128 .LVU2268
+	.uleb128 .LVU2275
+.LLST253:
+	.byte	0x4
+	.uleb128 .LVL784-.Ltext0
+	.uleb128 .LVL786-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL787-.Ltext0
+	.uleb128 .LVL791-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL793-.Ltext0
+	.uleb128 .LVL795-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS254:
+	.uleb128 .LVU2250
+	.uleb128 .LVU2259
+	.uleb128 .LVU2262
+	.uleb128 .LVU2264
+	.uleb128 .LVU2268
+	.uleb128 .LVU2274
+.LLST254:
+	.byte	0x4
+	.uleb128 .LVL785-.Ltext0
+	.uleb128 .LVL786-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL788-.Ltext0
+	.uleb128 .LVL790-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL793-.Ltext0
+	.uleb128 .LVL794-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0
+.LLRL29:
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0
+.LLRL32:
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0
+.LLRL48:
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0
+.LLRL50:
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0
+.LLRL53:
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0
+.LLRL55:
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0
+.LLRL56:
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0
+.LLRL58:
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0
+.LLRL61:
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0
+.LLRL63:
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0
+.LLRL64:
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0
+.LLRL67:
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0
+.LLRL95:
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB119-.Ltext0
+	.uleb128 .LBE119-.Ltext0
+	.byte	0
+.LLRL97:
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0
+.LLRL98:
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0
+.LLRL102:
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB116-.Ltext0
+	.uleb128 .LBE116-.Ltext0
+	.byte	0
+.LLRL103:
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0
+.LLRL106:
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0
+.LLRL112:
+	.byte	0x4
+	.uleb128 .LBB130-.Ltext0
+	.uleb128 .LBE130-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0
+.LLRL115:
+	.byte	0x4
+	.uleb128 .LBB134-.Ltext0
+	.uleb128 .LBE134-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0
+.LLRL118:
+	.byte	0x4
+	.uleb128 .LBB135-.Ltext0
+	.uleb128 .LBE135-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0
+.LLRL124:
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0
+.LLRL127:
+	.byte	0x4
+	.uleb128 .LBB147-.Ltext0
+	.uleb128 .LBE147-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0
+.LLRL130:
+	.byte	0x4
+	.uleb128 .LBB148-.Ltext0
+	.uleb128 .LBE148-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB149-.Ltext0
+	.uleb128 .LBE149-.Ltext0
+	.byte	0
+.LLRL136:
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB163-.Ltext0
+	.uleb128 .LBE163-.Ltext0
+	.byte	0
+.LLRL139:
+	.byte	0x4
+	.uleb128 .LBB160-.Ltext0
+	.uleb128 .LBE160-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB164-.Ltext0
+	.uleb128 .LBE164-.Ltext0
+	.byte	0
+.LLRL142:
+	.byte	0x4
+	.uleb128 .LBB161-.Ltext0
+	.uleb128 .LBE161-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB162-.Ltext0
+	.uleb128 .LBE162-.Ltext0
+	.byte	0
+.LLRL156:
+	.byte	0x4
+	.uleb128 .LBB168-.Ltext0
+	.uleb128 .LBE168-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB174-.Ltext0
+	.uleb128 .LBE174-.Ltext0
+	.byte	0
+.LLRL159:
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0
+.LLRL161:
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB175-.Ltext0
+	.uleb128 .LBE175-.Ltext0
+	.byte	0
+.LLRL164:
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB173-.Ltext0
+	.uleb128 .LBE173-.Ltext0
+	.byte	0
+.LLRL168:
+	.byte	0x4
+	.uleb128 .LBB177-.Ltext0
+	.uleb128 .LBE177-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0
+.LLRL171:
+	.byte	0x4
+	.uleb128 .LBB178-.Ltext0
+	.uleb128 .LBE178-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB179-.Ltext0
+	.uleb128 .LBE179-.Ltext0
+	.byte	0
+.LLRL173:
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0
+.LLRL175:
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB184-.Ltext0
+	.uleb128 .LBE184-.Ltext0
+	.byte	0
+.LLRL225:
+	.byte	0x4
+	.uleb128 .LBB216-.Ltext0
+	.uleb128 .LBE216-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB217-.Ltext0
+	.uleb128 .LBE217-.Ltext0
+	.byte	0
+.LLRL229:
+	.byte	0x4
+	.uleb128 .LBB219-.Ltext0
+	.uleb128 .LBE219-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB220-.Ltext0
+	.uleb128 .LBE220-.Ltext0
+	.byte	0
+.LLRL233:
+	.byte	0x4
+	.uleb128 .LBB222-.Ltext0
+	.uleb128 .LBE222-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB223-.Ltext0
+	.uleb128 .LBE223-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF394
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h"
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF395
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF396
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x8
+	.file 10 "/usr/include/limits.h"
+	.byte	0x3
+	.uleb128 0xcb
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h"
+	.byte	0x3
+	.uleb128 0xc3
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF572
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/local_lim.h"
+	.byte	0x3
+	.uleb128 0xa1
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 22 "/usr/include/linux/limits.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF636
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF643
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h"
+	.byte	0x3
+	.uleb128 0xc7
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0x8
+	.long	.LASF663
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF714
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF715
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF775
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF789
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF790
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF791
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF792
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF814
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.file 35 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF816
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF833
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF846
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF851
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF855
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF872
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF873
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF874
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF886
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF893
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF894
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF972
+	.file 52 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF995
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1031
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 57 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1062
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x3a
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 60 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3c
+	.file 61 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1069
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1132
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.file 64 "/usr/include/inttypes.h"
+	.byte	0x3
+	.uleb128 0x6b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 65 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x135
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1344
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1345
+	.byte	0x4
+	.byte	0x4
+	.file 68 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 69 "/usr/include/stdio.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1378
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1379
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1380
+	.byte	0x4
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1381
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1382
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1383
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF390
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unittest.h.2.f0a7d71e5425ff1436838cf2eea9b2ab,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.23.3c23ae3e8f372a0298be6ce978307bc7,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.32.6a1c51cbc8834927c9b529a347d7b23f,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF571
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix1_lim.h.32.a7cb894e219b90f9f73cd9217f417c40,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF602
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.25.97ee4129efb08ad296101237bcd3401b,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF606
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.3.0a3ae0fffe30e22dfdd77ac2c1b1fbdd,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF620
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.42.a403368f4a1bbbff510e22bd9037c5aa,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2a
+	.long	.LASF621
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF622
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF623
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF624
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF625
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF626
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF627
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF633
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF635
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.84.535be492ad9773d11e46b49da2c4d18d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF642
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix2_lim.h.23.56b9c4f885cbac0b652f53ee56b244b1,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF662
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.60.7bfe30ae3ff4e90f07238e284348f8e7,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF664
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF666
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF668
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF670
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF672
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF674
+	.byte	0x6
+	.uleb128 0x62
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF676
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF678
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF680
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF682
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF684
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF686
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF688
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF690
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF692
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF694
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF696
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF570
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF699
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF713
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF730
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF772
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF774
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF788
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.f6fdfdd3074dba759703a90896f28cf6,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF820
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF822
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF824
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF828
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF832
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF845
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF850
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF867
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF871
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF885
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF889
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.nohtyP.h.97.2e0fa8bba9384abbe6f78eb6f8754f10,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x342
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x34b
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x808
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x809
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x80a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x933
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x93d
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x95b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x95d
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x95f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x975
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x979
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x97b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x97d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x97e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x97f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x980
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x983
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x984
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x985
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x986
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x987
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x9b5
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x9b7
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x9bb
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x9be
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x9c0
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x9c4
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9c9
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9d2
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9d3
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x9d4
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x9d6
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x9d7
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x9d8
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x9de
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9e3
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e8
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9e9
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x9eb
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x9ec
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x9f2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x9fa
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x9fb
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x9fc
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xa02
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xa03
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xa04
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xa06
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xa08
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xa0b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xa14
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xa1b
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xa1c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xa1d
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xa1f
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xa21
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xa24
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xa2d
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xa3c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xa3d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xa3e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xa40
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xa42
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xa44
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xa47
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xa50
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xa51
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xa55
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xa57
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xa58
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xa59
+	.long	.LASF971
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.2a7f4947d4b7296e7e393bf9a618c3c1,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF990
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF991
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF992
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1004
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1016
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1023
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1030
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1052
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1058
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1061
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.31.44de592716652d75a04e2faa46853d09,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1064
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1068
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1131
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.47.1ef7fb496f1b65128a348b451b57d412,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1140
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.inttypes.h.23.2397f598c39b8a2316c758c5353fd94b,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1298
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.114.92fe5c078131265938a549edd1319448,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1342
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.munit.h.310.45d0a216137ebcf1d6d874c8ac8a068a,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1360
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.f07083f9b666a9e5c52a336c758fdd72,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1373
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1374
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF992
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1376
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1374
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF992
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1375
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1391
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.93.8171f82adf48af92ec67424d5f5b709c,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1400
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1407
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1412
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1416
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF1417
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unittest.h.26.cfd313572d0c5f6e4458388009f5c7dd,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x354
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x468
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x470
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x477
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1577
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1636:
+	.string	"tear_down"
+.LASF914:
+	.string	"_ypStringLib_ENC_CODE_LATIN_1 (1u)"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1616:
+	.string	"_yp_ob_len_t"
+.LASF679:
+	.string	"SHRT_MAX"
+.LASF1735:
+	.string	"test_contains_manyC"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1453:
+	.string	"_STRINGIFY27(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A"
+.LASF1553:
+	.string	"assert_eq_same_type(a,b) do { ypObject *_ypmt_EQ_TYPE_a = (a); ypObject *_ypmt_EQ_TYPE_b = (b); _assert_eq_same_type(_ypmt_EQ_TYPE_a, _ypmt_EQ_TYPE_b, \"%s\", \"%s\", #a, #b); } while (0)"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF984:
+	.string	"_WCHAR_T_DEFINED "
+.LASF674:
+	.string	"CHAR_MIN SCHAR_MIN"
+.LASF935:
+	.ascii	"_yp_IMMORTAL_F"
+	.string	"UNCTION5(qual,name,code,parameters_len,parameters) static struct _ypFunctionObject _ ##name ##_struct = { _yp_IMMORTAL_HEAD_INIT(_ypFunction_CODE, 0, (parameters_len), (parameters)), (code), NULL}; qual ypObject *const _yp_UNUSED name = _yp_CONST_REF(name)"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF680:
+	.string	"SHRT_MAX __SHRT_MAX__"
+.LASF1674:
+	.string	"rand_obj_supplier_func"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1209:
+	.string	"PRIXLEAST8 \"X\""
+.LASF1473:
+	.string	"_COMMA_REPEAT13(x) x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1189:
+	.string	"PRIuFAST8 \"u\""
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF398:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1695:
+	.string	"yp_push"
+.LASF1237:
+	.string	"SCNdFAST8 \"hhd\""
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF722:
+	.string	"__SQUAD_TYPE long int"
+.LASF1073:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF818:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1354:
+	.string	"munit_assert_not_null(ptr) munit_assert_ptr(ptr, !=, NULL)"
+.LASF1424:
+	.string	"_PP_NARG(prefix,...) _ESC(_PP_ARG_N(prefix, __VA_ARGS__))"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1222:
+	.string	"PRIXMAX __PRI64_PREFIX \"X\""
+.LASF784:
+	.string	"__pid_t_defined "
+.LASF817:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1156:
+	.string	"PRIdFAST64 __PRI64_PREFIX \"d\""
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF629:
+	.string	"_POSIX_THREAD_KEYS_MAX 128"
+.LASF1001:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF631:
+	.string	"_POSIX_THREAD_DESTRUCTOR_ITERATIONS 4"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1066:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1171:
+	.string	"PRIo32 \"o\""
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1063:
+	.string	"MUNIT_VERSION(major,minor,revision) (((major) << 16) | ((minor) << 8) | (revision))"
+.LASF572:
+	.string	"_BITS_POSIX1_LIM_H 1"
+.LASF1683:
+	.string	"test_collection_tests"
+.LASF1640:
+	.string	"_Bool"
+.LASF1594:
+	.string	"ob_refcnt"
+.LASF1536:
+	.ascii	"_assert_typeC_raises_exc(T,a_statement,op,b_statement,excs,v"
+	.ascii	"al_pri,a_fmt,b_fmt,excs_fmt,a_str,b_str,excs_str) do { ypObj"
+	.ascii	"ect *_ypmt_TYPEC_excs[] = {UNPACK excs}; yp_ssize_t _ypmt_TY"
+	.ascii	"PEC_n = yp_lengthof_array(_ypmt_TYPEC_excs); T _ypmt_TYPEC_a"
+	.ascii	"; T _ypmt_TYPEC_b; _assert_raises_exc(_ypmt_TYP"
+	.string	"EC_a = (a_statement), _ypmt_TYPEC_n, _ypmt_TYPEC_excs, a_fmt, excs_fmt, a_str, excs_str); _assert_not_raises_exc(_ypmt_TYPEC_b = (b_statement), b_fmt, b_str); _assert_typeC(_ypmt_TYPEC_a, op, _ypmt_TYPEC_b, val_pri, a_fmt, b_fmt, a_str, b_str); } while (0)"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1258:
+	.string	"SCNuLEAST16 \"hu\""
+.LASF644:
+	.string	"_BITS_POSIX2_LIM_H 1"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF607:
+	.string	"_LINUX_LIMITS_H "
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1300:
+	.string	"MUNIT_LIKELY(expr) (__builtin_expect ((expr), 1))"
+.LASF1626:
+	.string	"MunitParameter"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1559:
+	.string	"assert_setlike(obj,...) do { ypObject *_ypmt_SET_obj = (obj); ypObject *_ypmt_SET_items[] = {__VA_ARGS__}; char *_ypmt_SET_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_setlike(_ypmt_SET_obj, _ypmt_SET_items, \"%s\", _ypmt_SET_item_strs, #obj); } while (0)"
+.LASF1316:
+	.string	"munit_assert_true(expr) do { if (!MUNIT_LIKELY(expr)) { munit_error(\"assertion failed: \" #expr \" is not true\"); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF589:
+	.string	"_POSIX_PIPE_BUF 512"
+.LASF1617:
+	.string	"MUNIT_OK"
+.LASF1385:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1692:
+	.string	"_assert_setlike_helper"
+.LASF1447:
+	.string	"_STRINGIFY21(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1468:
+	.string	"_COMMA_REPEAT8(x) x, x, x, x, x, x, x, x"
+.LASF1737:
+	.string	"_ypmt_ISEXC_obj"
+.LASF1653:
+	.string	"newK"
+.LASF394:
+	.string	"yp_NOHTYP_H "
+.LASF1265:
+	.string	"SCNo8 \"hho\""
+.LASF1197:
+	.string	"PRIxLEAST8 \"x\""
+.LASF421:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF651:
+	.string	"_POSIX2_LINE_MAX 2048"
+.LASF1331:
+	.string	"munit_assert_float(a,op,b) munit_assert_type(float, \"f\", a, op, b)"
+.LASF396:
+	.string	"_GCC_NEXT_LIMITS_H "
+.LASF1719:
+	.string	"_ypmt_OBJ_result"
+.LASF1649:
+	.string	"new_"
+.LASF976:
+	.string	"__WCHAR_T__ "
+.LASF995:
+	.string	"_STDLIB_H 1"
+.LASF1009:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF947:
+	.string	"yp_ELSE } } if(_yp_IF_cond == yp_False) { {"
+.LASF702:
+	.string	"__need___va_list"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF616:
+	.string	"PIPE_BUF 4096"
+.LASF928:
+	.ascii	"_yp_IMMORTAL_STR_LATIN_1(qual,name,value) static const char "
+	.ascii	"_ ##name ##_dat"
+	.string	"a[] = (value); static struct _ypStringLibObject _ ##name ##_struct = { _yp_IMMORTAL_HEAD_INIT(_ypStr_CODE, _ypStringLib_ENC_CODE_LATIN_1, sizeof(_ ##name ##_data) - 1, (void *)_ ##name ##_data), }; qual ypObject *const _yp_UNUSED name = _yp_CONST_REF(name)"
+.LASF670:
+	.string	"SCHAR_MAX __SCHAR_MAX__"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF688:
+	.string	"UINT_MAX (INT_MAX * 2U + 1U)"
+.LASF1386:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1248:
+	.string	"SCNiLEAST64 __PRI64_PREFIX \"i\""
+.LASF1323:
+	.string	"munit_assert_ushort(a,op,b) munit_assert_type(unsigned short, MUNIT_SHORT_MODIFIER \"u\", a, op, b)"
+.LASF1693:
+	.string	"yp_miniiter"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF907:
+	.string	"_ypObject_HEAD ypObject ob_base"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1591:
+	.string	"ob_type"
+.LASF1708:
+	.string	"fixture"
+.LASF829:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF772:
+	.string	"__FD_SETSIZE 1024"
+.LASF730:
+	.string	"__STD_TYPE typedef"
+.LASF599:
+	.string	"_POSIX_TIMER_MAX 32"
+.LASF612:
+	.string	"MAX_CANON 255"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1544:
+	.string	"yp_is(a,b) ((a) == (b) ? yp_True : yp_False)"
+.LASF950:
+	.string	"yp_ENDIF } } }"
+.LASF1319:
+	.string	"munit_assert_type(T,fmt,a,op,b) munit_assert_type_full(\"\", \"\", T, fmt, a, op, b)"
+.LASF630:
+	.string	"PTHREAD_KEYS_MAX 1024"
+.LASF1208:
+	.string	"PRIX64 __PRI64_PREFIX \"X\""
+.LASF1306:
+	.string	"MUNIT_SHORT_MODIFIER \"h\""
+.LASF782:
+	.string	"__uid_t_defined "
+.LASF1492:
+	.string	"_COMMA_REPEAT32(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1099:
+	.string	"INT_FAST8_MAX (127)"
+.LASF910:
+	.string	"_ypObject_REFCNT_IMMORTAL (0x7FFFFFFFu)"
+.LASF1599:
+	.string	"yp_uint8_t"
+.LASF1384:
+	.string	"__struct_FILE_defined 1"
+.LASF1391:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF1668:
+	.string	"peer_type_t"
+.LASF1556:
+	.ascii	"_assert_sequence(obj,items,obj_fmt,item_strs,...) do { yp_ss"
+	.ascii	"ize_t _ypmt_SEQ_n = yp_lengthof_array(items); yp_ssize_t _yp"
+	.ascii	"mt_SEQ_i; _assert_len(obj, _ypmt_SEQ_n, obj_fmt, \"%\" PRIss"
+	.ascii	"ize, __VA_ARGS__, _ypmt_SEQ_n); for (_ypmt_SEQ_i = 0; _ypmt_"
+	.ascii	"SEQ_i < _ypmt_SEQ_n; _ypmt_SEQ_i++) { ypObject *_ypmt_SEQ_ac"
+	.ascii	"tual = yp_getindexC(obj, _ypmt_SEQ_i); _assert_not_exception"
+	.ascii	"(_ypmt_SEQ_actual, \"yp_getindexC(\" o"
+	.string	"bj_fmt \", %\" PRIssize \")\", __VA_ARGS__, _ypmt_SEQ_i); _assert_eq_same_type(_ypmt_SEQ_actual, items[_ypmt_SEQ_i], \"yp_getindexC(\" obj_fmt \", %\" PRIssize \")\", \"%s\", __VA_ARGS__, _ypmt_SEQ_i, item_strs[_ypmt_SEQ_i]); yp_decref(_ypmt_SEQ_actual); } } while (0)"
+.LASF1235:
+	.string	"SCNdLEAST32 \"d\""
+.LASF908:
+	.string	"_ypSmallObject_HEAD struct _ypSmallObject ob_base"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1397:
+	.string	"SEEK_SET 0"
+.LASF1491:
+	.string	"_COMMA_REPEAT31(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1490:
+	.string	"_COMMA_REPEAT30(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF952:
+	.string	"yp_WHILE(expression) _yp_WHILE(expression, ((void)0))"
+.LASF419:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF638:
+	.string	"TTY_NAME_MAX 32"
+.LASF1231:
+	.string	"SCNd32 \"d\""
+.LASF1512:
+	.string	"assert_ptr(a,op,b) munit_assert_ptr(a, op, b)"
+.LASF711:
+	.string	"_VA_LIST_DEFINED "
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF781:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1566:
+	.ascii	"_faulty_iter_tests(setup,iter_name,iter_supplier,statement,a"
+	.ascii	"ssertion,tear_down,exc_suffix,statement_str) do { yp_ssize_t"
+	.ascii	" _ypmt_FLT_ITR_len = yp_lenC_not_raises(iter_supplier); if ("
+	.ascii	"_ypmt_FLT_ITR_len < 2) { munit_error(\"iter_supplier must co"
+	.ascii	"ntain at least two entries\"); } _faulty_iter_test_raises(se"
+	.ascii	"tup, iter_name, yp_StopIteration, statement, tear_down, \"ex"
+	.ascii	"c_passthrough\", exc_suffix, yp_StopIteration, statement_str"
+	.ascii	"); _faulty_iter_test_raises(setup, iter_name, new_faulty_ite"
+	.ascii	"r(iter_supplier, 0, yp_SyntaxError, _ypmt_FLT_ITR_len), stat"
+	.ascii	"ement, tear_down, \"fail_start\", exc_suffix, yp_SyntaxError"
+	.ascii	", statement_str); _faulty_iter_test_raises(setup, iter_name,"
+	.ascii	" new_faulty_iter(iter_supplier, 1, yp_SyntaxError, _ypmt_FLT"
+	.ascii	"_ITR_len), statement, tear_down, \"fail_mid\", exc_suffix, y"
+	.ascii	"p_SyntaxError, statement_str); _faulty_iter_test_raises(setu"
+	.ascii	"p, iter_name, new_faulty_iter(iter_supplier, 0, yp_Generator"
+	.ascii	"Exit, _ypmt_FLT_ITR_len), statement, tear_down, \"fail_start"
+	.ascii	"\", exc_suffix, yp_GeneratorExit, statement_str); _faulty_it"
+	.ascii	"er_test_raises(setup, iter_name, new_faulty_iter( iter_suppl"
+	.ascii	"ier, _ypmt_FLT_ITR_len, yp_GeneratorExit, _ypmt_FLT_ITR_len)"
+	.ascii	", statement, tear_down, \"fail_end\", exc_suffix, yp_Generat"
+	.ascii	"orExit, statement_str); _faulty_iter_test_succeeds(setup, it"
+	.ascii	"er_name, new_faulty_iter(iter_supplier, _ypmt_FLT_ITR_len + "
+	.ascii	"1, yp_SyntaxError, 1), statement, assertion, tear_down, \"hi"
+	.ascii	"nt_small\","
+	.string	" exc_suffix, statement_str); _faulty_iter_test_succeeds(setup, iter_name, new_faulty_iter(iter_supplier, _ypmt_FLT_ITR_len + 1, yp_SyntaxError, _ypmt_FLT_ITR_len + 100), statement, assertion, tear_down, \"hint_large\", exc_suffix, statement_str); } while (0)"
+.LASF1722:
+	.string	"_ypmt_SET_items"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF975:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1628:
+	.string	"MUNIT_TEST_OPTION_SINGLE_ITERATION"
+.LASF1285:
+	.string	"SCNxFAST8 \"hhx\""
+.LASF410:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1537:
+	.string	"assert_intC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_int_t, a, op, b, (__VA_ARGS__), PRIint, \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF1445:
+	.string	"_STRINGIFY19(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s"
+.LASF1164:
+	.string	"PRIiLEAST64 __PRI64_PREFIX \"i\""
+.LASF1126:
+	.string	"UINT8_C(c) c"
+.LASF569:
+	.string	"LLONG_MIN (-LLONG_MAX-1)"
+.LASF596:
+	.string	"_POSIX_STREAM_MAX 8"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1612:
+	.string	"yp_SyntaxError"
+.LASF1076:
+	.string	"INT16_MAX (32767)"
+.LASF575:
+	.string	"_POSIX_ARG_MAX 4096"
+.LASF1402:
+	.string	"L_tmpnam 20"
+.LASF1147:
+	.string	"PRId32 \"d\""
+.LASF650:
+	.string	"_POSIX2_EXPR_NEST_MAX 32"
+.LASF1048:
+	.string	"__f64x(x) x ##f64x"
+.LASF1150:
+	.string	"PRIdLEAST16 \"d\""
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1289:
+	.string	"SCNdMAX __PRI64_PREFIX \"d\""
+.LASF1624:
+	.string	"MunitParameterEnum"
+.LASF1522:
+	.string	"assert_not_raises(statement) _assert_not_raises((statement), \"%s\", #statement)"
+.LASF1176:
+	.string	"PRIoLEAST64 __PRI64_PREFIX \"o\""
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF617:
+	.string	"XATTR_NAME_MAX 255"
+.LASF938:
+	.string	"yp_IMMORTAL_FUNCTION_static(name,code,parameters) _yp_IMMORTAL_FUNCTION(static, name, code, parameters)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1136:
+	.string	"munit_uint16_t uint16_t"
+.LASF768:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1365:
+	.string	"_T_PTRDIFF_ "
+.LASF1188:
+	.string	"PRIuLEAST64 __PRI64_PREFIX \"u\""
+.LASF1240:
+	.string	"SCNdFAST64 __PRI64_PREFIX \"d\""
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1557:
+	.ascii	"as"
+	.string	"sert_sequence(obj,...) do { ypObject *_ypmt_SEQ_obj = (obj); ypObject *_ypmt_SEQ_items[] = {__VA_ARGS__}; char *_ypmt_SEQ_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_sequence(_ypmt_SEQ_obj, _ypmt_SEQ_items, \"%s\", _ypmt_SEQ_item_strs, #obj); } while (0)"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF805:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1597:
+	.string	"ob_hash"
+.LASF1518:
+	.string	"_assert_not_exception(obj,obj_fmt,...) do { if (yp_isexceptionC(obj)) { munit_errorf(\"assertion failed: !yp_isexceptionC(\" obj_fmt \")\", __VA_ARGS__); } } while (0)"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF966:
+	.string	"yp1(self,method) yp_ ##method(self)"
+.LASF1103:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1712:
+	.string	"_ypmt_RAISES_expected"
+.LASF1284:
+	.string	"SCNxLEAST64 __PRI64_PREFIX \"x\""
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1483:
+	.string	"_COMMA_REPEAT23(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF846:
+	.string	"_SYS_SELECT_H 1"
+.LASF1026:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF917:
+	.string	"_ypBaseException_CODE (2u)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF642:
+	.string	"SEM_VALUE_MAX (2147483647)"
+.LASF858:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1699:
+	.string	"yp_decref"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1345:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF986:
+	.string	"___int_wchar_t_h "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF401:
+	.string	"__USE_ISOC11"
+.LASF1673:
+	.string	"rand_obj_supplier_memo_t"
+.LASF1654:
+	.string	"rand_values"
+.LASF1503:
+	.string	"yp_lengthof_array(x) (yp_sizeof(x) / yp_sizeof((x)[0]))"
+.LASF579:
+	.string	"_POSIX_LINK_MAX 8"
+.LASF1614:
+	.string	"yp_MemorySizeOverflowError"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1416:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF831:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1721:
+	.string	"_ypmt_SET_obj"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF713:
+	.string	"__va_list__ "
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1254:
+	.string	"SCNu16 \"hu\""
+.LASF513:
+	.string	"__always_inline"
+.LASF970:
+	.string	"yp4(self,method,a1,a2,a3) yp_ ##method(self, a1, a2, a3)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1032:
+	.string	"__HAVE_FLOAT16 0"
+.LASF611:
+	.string	"LINK_MAX 127"
+.LASF1340:
+	.string	"munit_assert_int64(a,op,b) munit_assert_type(munit_int64_t, PRIi64, a, op, b)"
+.LASF1555:
+	.string	"assert_len(obj,expected) do { ypObject *_ypmt_LEN_obj = (obj); yp_ssize_t _ypmt_LEN_expected = (expected); _assert_len(_ypmt_LEN_obj, _ypmt_LEN_expected, \"%s\", \"%s\", #obj, #expected); } while (0)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF632:
+	.string	"PTHREAD_DESTRUCTOR_ITERATIONS _POSIX_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF1623:
+	.string	"values"
+.LASF677:
+	.string	"SHRT_MIN"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1531:
+	.ascii	"assert_raises_exc(statem"
+	.string	"ent,...) do { ypObject *_ypmt_RAISES_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_RAISES_n = yp_lengthof_array(_ypmt_RAISES_expected); _assert_raises_exc((statement), _ypmt_RAISES_n, _ypmt_RAISES_expected, \"%s\", \"%s\", #statement, #__VA_ARGS__); } while (0)"
+.LASF1655:
+	.string	"rand_ordered_items"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF940:
+	.string	"yp_IMMORTAL_FUNCTION2_static(name,code) _yp_IMMORTAL_FUNCTION5(static, name, code, 0, NULL)"
+.LASF1067:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1218:
+	.string	"PRIiMAX __PRI64_PREFIX \"i\""
+.LASF1422:
+	.string	"PRIssize PRId64"
+.LASF1153:
+	.string	"PRIdFAST8 \"d\""
+.LASF1667:
+	.string	"hashable_items_only"
+.LASF1305:
+	.string	"MUNIT_CHAR_MODIFIER \"hh\""
+.LASF663:
+	.string	"_GCC_NEXT_LIMITS_H"
+.LASF915:
+	.string	"_ypStringLib_ENC_CODE_UCS_2 (2u)"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1472:
+	.string	"_COMMA_REPEAT12(x) x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1095:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1335:
+	.string	"munit_assert_uint8(a,op,b) munit_assert_type(munit_uint8_t, PRIu8, a, op, b)"
+.LASF1456:
+	.string	"_STRINGIFY30(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D"
+.LASF1514:
+	.string	"assert_not_null(ptr) munit_assert_not_null(ptr)"
+.LASF749:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF696:
+	.string	"LLONG_MIN (-LLONG_MAX - 1LL)"
+.LASF1627:
+	.string	"MUNIT_TEST_OPTION_NONE"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF798:
+	.string	"_T_SIZE_ "
+.LASF1549:
+	.ascii	"a"
+	.string	"ssert_type_is(obj,expected) do { ypObject *_ypmt_TYPE_obj = (obj); ypObject *_ypmt_TYPE_expected = (expected); _assert_not_exception(_ypmt_TYPE_obj, \"%s\", #obj); _assert_type_is(_ypmt_TYPE_obj, _ypmt_TYPE_expected, \"%s\", \"%s\", #obj, #expected); } while (0)"
+.LASF842:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1577:
+	.string	"SUITE_OF_SUITES_DECLS(name) extern MunitSuite name ##_suites[]; extern void name ##_initialize(void)"
+.LASF850:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1584:
+	.string	"long int"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1539:
+	.string	"assert_ssizeC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_ssize_t, a, op, b, (__VA_ARGS__), PRIssize, \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF602:
+	.string	"_POSIX_CLOCKRES_MIN 20000000"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF585:
+	.string	"_POSIX_NAME_MAX 14"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF672:
+	.string	"UCHAR_MAX (SCHAR_MAX * 2 + 1)"
+.LASF1012:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1122:
+	.string	"INT8_C(c) c"
+.LASF1415:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF809:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF900:
+	.string	"yp_SLICE_DEFAULT yp_SSIZE_T_MIN"
+.LASF1036:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1417:
+	.string	"__STDIO_INLINE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF658:
+	.string	"COLL_WEIGHTS_MAX 255"
+.LASF626:
+	.string	"__undef_OPEN_MAX"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1144:
+	.string	"__PRIPTR_PREFIX \"l\""
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1124:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1527:
+	.string	"assert_isexception_exc assert_raises_exc"
+.LASF1621:
+	.string	"MunitResult"
+.LASF1226:
+	.string	"PRIuPTR __PRIPTR_PREFIX \"u\""
+.LASF1443:
+	.string	"_STRINGIFY17(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q"
+.LASF648:
+	.string	"_POSIX2_BC_STRING_MAX 1000"
+.LASF1713:
+	.string	"_ypmt_RAISES_n"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1236:
+	.string	"SCNdLEAST64 __PRI64_PREFIX \"d\""
+.LASF1656:
+	.string	"is_mutable"
+.LASF1725:
+	.string	"_ypmt_SET_found"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF944:
+	.string	"_yp_ELIF(expression,decref_expression) } } if(_yp_IF_cond == yp_False) { _yp_IF_expr = (expression); _yp_IF_cond = yp_bool(_yp_IF_expr); decref_expression; if(_yp_IF_cond == yp_True) {"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1028:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF698:
+	.string	"ULLONG_MAX"
+.LASF806:
+	.string	"_SIZE_T_DECLARED "
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1618:
+	.string	"MUNIT_FAIL"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1072:
+	.string	"INT16_MIN (-32767-1)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1400:
+	.string	"P_tmpdir \"/tmp\""
+.LASF1318:
+	.ascii	"munit_assert_type_full(prefix,suffix,T,fmt,a,op,b) do { T mu"
+	.ascii	"nit_tmp_a_ = (a); T munit_tmp_b_ = (b); if ("
+	.string	"!(munit_tmp_a_ op munit_tmp_b_)) { munit_errorf(\"assertion failed: %s %s %s (\" prefix \"%\" fmt suffix \" %s \" prefix \"%\" fmt suffix \")\", #a, #op, #b, munit_tmp_a_, #op, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF1738:
+	.string	"_ypmt_ISEXC_expected"
+.LASF1321:
+	.string	"munit_assert_uchar(a,op,b) munit_assert_type_full(\"'\\\\x\", \"'\", unsigned char, \"02\" MUNIT_CHAR_MODIFIER \"x\", a, op, b)"
+.LASF406:
+	.string	"__USE_POSIX2"
+.LASF1598:
+	.string	"ob_data"
+.LASF1635:
+	.string	"setup"
+.LASF828:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1201:
+	.string	"PRIxFAST8 \"x\""
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1232:
+	.string	"SCNd64 __PRI64_PREFIX \"d\""
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF603:
+	.string	"__undef_NR_OPEN "
+.LASF1451:
+	.string	"_STRINGIFY25(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1670:
+	.string	"type"
+.LASF821:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1442:
+	.string	"_STRINGIFY16(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p"
+.LASF1060:
+	.string	"alloca"
+.LASF1058:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF854:
+	.string	"__timeval_defined 1"
+.LASF1371:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1596:
+	.string	"ob_alloclen"
+.LASF586:
+	.string	"_POSIX_NGROUPS_MAX 8"
+.LASF1104:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF619:
+	.string	"XATTR_LIST_MAX 65536"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1121:
+	.string	"WINT_MAX (4294967295u)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1051:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF662:
+	.string	"RE_DUP_MAX (0x7fff)"
+.LASF666:
+	.string	"CHAR_BIT __CHAR_BIT__"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1568:
+	.ascii	"faulty_iter_tests_exc(setup,iter_name,iter_supplier,statemen"
+	.ascii	"t,assertion,tear_down) do { ypObject *_ypmt_FLT_ITR_supplie"
+	.string	"r = (iter_supplier); char _ypmt_FLT_ITR_statement_str[] = #statement; _faulty_iter_tests((setup), (iter_name), _ypmt_FLT_ITR_supplier, (statement), (assertion), (tear_down), _exc, _ypmt_FLT_ITR_statement_str); yp_decref(_ypmt_FLT_ITR_supplier); } while (0)"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1250:
+	.string	"SCNiFAST16 __PRIPTR_PREFIX \"i\""
+.LASF1652:
+	.string	"rand_items"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF405:
+	.string	"__USE_POSIX"
+.LASF1744:
+	.string	"__addvsi3"
+.LASF987:
+	.string	"__INT_WCHAR_T_H "
+.LASF779:
+	.string	"__gid_t_defined "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1162:
+	.string	"PRIiLEAST16 \"i\""
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1308:
+	.string	"MUNIT_PUSH_DISABLE_MSVC_C4127_ "
+.LASF1538:
+	.string	"assert_floatC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_float_t, a, op, b, (__VA_ARGS__), \"lf\", \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1213:
+	.string	"PRIXFAST8 \"X\""
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF847:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1160:
+	.string	"PRIi64 __PRI64_PREFIX \"i\""
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1102:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF864:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1717:
+	.string	"_ypmt_OBJ_a"
+.LASF1718:
+	.string	"_ypmt_OBJ_b"
+.LASF841:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1476:
+	.string	"_COMMA_REPEAT16(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF645:
+	.string	"_POSIX2_BC_BASE_MAX 99"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1262:
+	.string	"SCNuFAST16 __PRIPTR_PREFIX \"u\""
+.LASF1022:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF780:
+	.string	"__mode_t_defined "
+.LASF1666:
+	.string	"original_object_return"
+.LASF1312:
+	.string	"munit_log(level,msg) munit_logf(level, \"%s\", msg)"
+.LASF1185:
+	.string	"PRIuLEAST8 \"u\""
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1494:
+	.string	"_COMMA_REPEAT34(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1047:
+	.string	"__f32x(x) x ##f32x"
+.LASF1211:
+	.string	"PRIXLEAST32 \"X\""
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF933:
+	.string	"yp_IMMORTAL_BYTES_static(name,value) _yp_IMMORTAL_BYTES(static, name, value)"
+.LASF1488:
+	.string	"_COMMA_REPEAT28(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1086:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1502:
+	.string	"yp_sizeof_member(structType,member) yp_sizeof(((structType *)0)->member)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1580:
+	.string	"unsigned char"
+.LASF1069:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1600:
+	.string	"yp_uint16_t"
+.LASF1096:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF610:
+	.string	"ARG_MAX 131072"
+.LASF1475:
+	.string	"_COMMA_REPEAT15(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1309:
+	.string	"MUNIT_POP_DISABLE_MSVC_C4127_ "
+.LASF584:
+	.string	"_POSIX_MQ_PRIO_MAX 32"
+.LASF1521:
+	.string	"_assert_not_raises(statement,statement_fmt,...) do { ypObject *_ypmt_NOT_RAISES_obj = statement; _assert_not_exception(_ypmt_NOT_RAISES_obj, statement_fmt, __VA_ARGS__); } while (0)"
+.LASF1100:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1496:
+	.string	"N(...) VA_ARGC(__VA_ARGS__), __VA_ARGS__"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1372:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1541:
+	.ascii	"_assert_bool(obj,value,n"
+	.string	"ot_value,obj_fmt,...) do { if (obj == value) { } else if (obj == not_value) { munit_errorf(\"assertion failed: \" obj_fmt \" == \" #value, __VA_ARGS__); } else { _ypmt_error_exception(obj, \"expected a bool or an exception\", obj_fmt, __VA_ARGS__); } } while (0)"
+.LASF1542:
+	.string	"assert_falsy(obj) do { ypObject *_ypmt_FALSY_result = yp_bool(obj); _assert_bool(_ypmt_FALSY_result, yp_False, yp_True, \"yp_bool(%s)\", #obj); } while (0)"
+.LASF1329:
+	.string	"munit_assert_ullong(a,op,b) munit_assert_type(unsigned long long int, \"llu\", a, op, b)"
+.LASF1664:
+	.string	"is_callable"
+.LASF358:
+	.string	"__k8 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF590:
+	.string	"_POSIX_RE_DUP_MAX 255"
+.LASF1730:
+	.string	"_ypmt_NOT_RAISES_obj"
+.LASF1604:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF403:
+	.string	"__USE_ISOC95"
+.LASF1609:
+	.string	"yp_True"
+.LASF402:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1123:
+	.string	"INT16_C(c) c"
+.LASF1334:
+	.string	"munit_assert_int8(a,op,b) munit_assert_type(munit_int8_t, PRIi8, a, op, b)"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1278:
+	.string	"SCNx16 \"hx\""
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1149:
+	.string	"PRIdLEAST8 \"d\""
+.LASF1418:
+	.string	"TRUE (1 == 1)"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF814:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1364:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF826:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF412:
+	.string	"__USE_XOPEN2K"
+.LASF678:
+	.string	"SHRT_MIN (-SHRT_MAX - 1)"
+.LASF408:
+	.string	"__USE_POSIX199506"
+.LASF1601:
+	.string	"yp_int32_t"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF941:
+	.string	"_yp_IF(expression,decref_expression) { ypObject *_yp_IF_expr; ypObject *_yp_IF_cond; { _yp_IF_expr = (expression); _yp_IF_cond = yp_bool(_yp_IF_expr); decref_expression; if(_yp_IF_cond == yp_True) {"
+.LASF654:
+	.string	"BC_BASE_MAX _POSIX2_BC_BASE_MAX"
+.LASF1293:
+	.string	"SCNxMAX __PRI64_PREFIX \"x\""
+.LASF1739:
+	.string	"_ypmt_ISEXC_n"
+.LASF844:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF640:
+	.string	"HOST_NAME_MAX 64"
+.LASF1517:
+	.string	"assert_hashC(a,op,b) munit_assert_type(yp_hash_t, PRIssize, a, op, b)"
+.LASF1529:
+	.ascii	"assert_raises(st"
+	.string	"atement,...) do { ypObject *_ypmt_RAISES_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_RAISES_n = yp_lengthof_array(_ypmt_RAISES_expected); _assert_raises((statement), _ypmt_RAISES_n, _ypmt_RAISES_expected, \"%s\", \"%s\", #statement, #__VA_ARGS__); } while (0)"
+.LASF1091:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1221:
+	.string	"PRIxMAX __PRI64_PREFIX \"x\""
+.LASF512:
+	.string	"__wur "
+.LASF894:
+	.string	"__have_pthread_attr_t 1"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1344:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1253:
+	.string	"SCNu8 \"hhu\""
+.LASF1145:
+	.string	"PRId8 \"d\""
+.LASF1170:
+	.string	"PRIo16 \"o\""
+.LASF1011:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1563:
+	.string	"ead(name,expression,assertion) do { ypObject *(name) = (expression); assertion; yp_decref(name); } while (0)"
+.LASF1217:
+	.string	"PRIdMAX __PRI64_PREFIX \"d\""
+.LASF1645:
+	.string	"yp_type"
+.LASF1207:
+	.string	"PRIX32 \"X\""
+.LASF1223:
+	.string	"PRIdPTR __PRIPTR_PREFIX \"d\""
+.LASF1271:
+	.string	"SCNoLEAST32 \"o\""
+.LASF789:
+	.string	"__clock_t_defined 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF433:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF983:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF741:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1530:
+	.ascii	"_assert_raises_exc(statement,n,expected,statement_fmt,expect"
+	.ascii	"ed_fmt,...) do { ypObject *exc = yp_None; if (n < 1) { munit"
+	.ascii	"_error(\"missing expected exception in assertion\"); } state"
+	.ascii	"ment; if (!yp_isexceptionC(exc)) { munit_errorf(\"assertion "
+	.ascii	"failed: \""
+	.string	" statement_fmt \"; yp_isexceptionC(exc) (expected \" expected_fmt \")\", __VA_ARGS__); } if (!yp_isexception_arrayC(exc, n, expected)) { munit_errorf(\"assertion failed: \" statement_fmt \"; yp_isexceptionCN(exc, N(\" expected_fmt \"))\", __VA_ARGS__); } } while (0)"
+.LASF1448:
+	.string	"_STRINGIFY22(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v"
+.LASF1466:
+	.string	"_COMMA_REPEAT6(x) x, x, x, x, x, x"
+.LASF857:
+	.string	"__NFDBITS"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1070:
+	.string	"__intptr_t_defined "
+.LASF635:
+	.string	"AIO_PRIO_DELTA_MAX 20"
+.LASF1078:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1089:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1286:
+	.string	"SCNxFAST16 __PRIPTR_PREFIX \"x\""
+.LASF1014:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1350:
+	.ascii	"munit_assert_memory_not_equal(size,a,b) do { const unsigned "
+	.ascii	"char* munit_tmp_a_ = (const unsigned char*) (a); const unsig"
+	.ascii	"ned char* munit_tmp_b_ = (const unsigned char*) (b); const s"
+	.ascii	"ize_t munit_tmp_si"
+	.string	"ze_ = (size); if (MUNIT_UNLIKELY(memcmp(munit_tmp_a_, munit_tmp_b_, munit_tmp_size_)) == 0) { munit_errorf(\"assertion failed: memory %s != %s (%zu bytes)\", #a, #b, munit_tmp_size_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF708:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1509:
+	.string	"_assert_ptr(a,op,b,a_fmt,b_fmt,...) _assert_typeC(a, op, b, \"p\", a_fmt, b_fmt, __VA_ARGS__)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1225:
+	.string	"PRIoPTR __PRIPTR_PREFIX \"o\""
+.LASF723:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF415:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1342:
+	.ascii	"munit_assert_double_equal(a,b,precision) do { const double m"
+	.ascii	"unit_tmp_a_ = (a); const double munit_tmp_b_ = (b); const do"
+	.ascii	"uble munit_tmp_diff_ = ((munit_tmp_a_ - munit_tmp_b_) < 0) ?"
+	.ascii	" -(munit_tmp_a_ - munit_tmp_b_) : (munit_tmp_a_ - munit_tmp_"
+	.ascii	"b_)"
+	.string	"; if (MUNIT_UNLIKELY(munit_tmp_diff_ > 1e- ##precision)) { munit_errorf(\"assertion failed: %s == %s (%0.\" #precision \"g == %0.\" #precision \"g)\", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF792:
+	.string	"__timer_t_defined 1"
+.LASF1106:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1233:
+	.string	"SCNdLEAST8 \"hhd\""
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1378:
+	.string	"__need___va_list "
+.LASF1215:
+	.string	"PRIXFAST32 __PRIPTR_PREFIX \"X\""
+.LASF1037:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1575:
+	.string	"INCREMENTAL_RESIZE_LEN 16"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1459:
+	.string	"_STRINGIFY33(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F,G) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F, #G"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1399:
+	.string	"SEEK_END 2"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF852:
+	.string	"____sigset_t_defined "
+.LASF816:
+	.string	"_ENDIAN_H 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF701:
+	.string	"_ANSI_STDARG_H_ "
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1128:
+	.string	"UINT32_C(c) c ## U"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1515:
+	.string	"assert_intC(a,op,b) munit_assert_type(yp_int_t, PRIint, a, op, b)"
+.LASF1082:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1714:
+	.string	"_ypmt_LEN_obj"
+.LASF1650:
+	.string	"peers"
+.LASF1742:
+	.string	"test_contains"
+.LASF1661:
+	.string	"is_string"
+.LASF1634:
+	.string	"test"
+.LASF1155:
+	.string	"PRIdFAST32 __PRIPTR_PREFIX \"d\""
+.LASF1441:
+	.string	"_STRINGIFY15(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o"
+.LASF709:
+	.string	"_VA_LIST_ "
+.LASF819:
+	.string	"__BIG_ENDIAN 4321"
+.LASF661:
+	.string	"CHARCLASS_NAME_MAX 2048"
+.LASF895:
+	.string	"ypAPI extern __attribute__((visibility(\"default\")))"
+.LASF1450:
+	.string	"_STRINGIFY24(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x"
+.LASF1039:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1125:
+	.string	"INT64_C(c) c ## L"
+.LASF659:
+	.string	"EXPR_NEST_MAX _POSIX2_EXPR_NEST_MAX"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1062:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1470:
+	.string	"_COMMA_REPEAT10(x) x, x, x, x, x, x, x, x, x, x"
+.LASF729:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF773:
+	.string	"_BITS_TIME64_H 1"
+.LASF885:
+	.string	"__ONCE_ALIGNMENT "
+.LASF932:
+	.string	"yp_IMMORTAL_INT_static(name,value) _yp_IMMORTAL_INT(static, name, value)"
+.LASF1101:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1270:
+	.string	"SCNoLEAST16 \"ho\""
+.LASF753:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1449:
+	.string	"_STRINGIFY23(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w"
+.LASF694:
+	.string	"ULONG_MAX (LONG_MAX * 2UL + 1UL)"
+.LASF1611:
+	.string	"yp_MemoryError"
+.LASF1005:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1477:
+	.string	"_COMMA_REPEAT17(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1659:
+	.string	"is_collection"
+.LASF568:
+	.string	"MB_LEN_MAX 16"
+.LASF1411:
+	.string	"__attr_dealloc_fclose"
+.LASF417:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF815:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1320:
+	.string	"munit_assert_char(a,op,b) munit_assert_type_full(\"'\\\\x\", \"'\", char, \"02\" MUNIT_CHAR_MODIFIER \"x\", a, op, b)"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1157:
+	.string	"PRIi8 \"i\""
+.LASF717:
+	.string	"__U16_TYPE unsigned short int"
+.LASF655:
+	.string	"BC_DIM_MAX _POSIX2_BC_DIM_MAX"
+.LASF838:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1558:
+	.ascii	"_assert_setlike(obj,items,obj_fmt,item_strs,...) do { yp_ssi"
+	.ascii	"ze_t _ypmt_SET_n = yp_lengthof_array(items); int _ypmt_SET_f"
+	.ascii	"ound[yp_lengthof_array(items)] = {0}; yp_uint64_t _ypmt_SET_"
+	.ascii	"mi_state; ypObject *_ypmt_SET_mi; ypObject *_ypmt_SET_actual"
+	.ascii	"; yp_ssize_t _ypmt_SET_i; _assert_len(obj, _ypmt_SET_n, obj_"
+	.ascii	"fmt, \"%\" PRIssize, __VA_ARGS__, _ypmt_SET_n); _assert_not_"
+	.ascii	"raises(_ypmt_SET_mi = yp_miniiter(obj, &_ypmt_SET_mi_state),"
+	.ascii	" \"yp_miniiter(\" obj_fmt \", &mi_state)\", __VA_ARGS__); wh"
+	.ascii	"ile (_assert_setlike_helper(_ypmt_SET_mi, &_ypmt_SET_mi_stat"
+	.ascii	"e, _ypmt_SET_n, items, &_ypmt_SET_actual , &_ypmt_SET_i)) { "
+	.ascii	"_assert_not_exception(_ypmt_SET_actual, \"yp_miniiter_next(y"
+	.ascii	"p_miniiter(\" obj_fmt \", &mi_state), &mi_state)\", __VA_ARG"
+	.ascii	"S__); if (_ypmt_SET_i >= _ypmt_SET_n) { munit_errorf(\"unexp"
+	.ascii	"ected item yielded from \" obj_fmt, __VA_ARGS__); } if (_ypm"
+	.ascii	"t_SET_found[_ypmt_SET_i]) { munit_errorf( \"%s yielded twice"
+	.ascii	" from \" obj_fmt, item_strs[_ypmt_SET_i], __VA_ARGS__); } _y"
+	.ascii	"pmt_SET_found[_ypmt_SET_i] = TRUE; _assert_same_type(_ypmt_S"
+	.ascii	"ET_actual, items[_ypmt_SET_i], \"<item in \" obj_fmt \">\", "
+	.ascii	"\"%s\", __VA_ARGS__, item_strs[_ypmt_SET_i]); y"
+	.string	"p_decref(_ypmt_SET_actual); } for (_ypmt_SET_i = 0; _ypmt_SET_i < _ypmt_SET_n; _ypmt_SET_i++) { if (!_ypmt_SET_found[_ypmt_SET_i]) { munit_errorf(\"%s not yielded from \" obj_fmt, item_strs[_ypmt_SET_i], __VA_ARGS__); } } yp_decref(_ypmt_SET_mi); } while (0)"
+.LASF1178:
+	.string	"PRIoFAST16 __PRIPTR_PREFIX \"o\""
+.LASF1511:
+	.string	"assert_false(expr) munit_assert_false(expr)"
+.LASF1431:
+	.string	"_STRINGIFY5(a,b,c,d,e) #a, #b, #c, #d, #e"
+.LASF1419:
+	.string	"FALSE (0 == 1)"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1552:
+	.string	"_assert_eq_same_type(a,b,a_fmt,b_fmt,...) do { _assert_obj(a, eq, b, a_fmt, b_fmt, __VA_ARGS__); _assert_same_type(a, b, a_fmt, b_fmt, __VA_ARGS__); } while (0)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1383:
+	.string	"__FILE_defined 1"
+.LASF1034:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1727:
+	.string	"_ypmt_SET_mi"
+.LASF808:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF592:
+	.string	"_POSIX_SEM_NSEMS_MAX 256"
+.LASF897:
+	.string	"yp_SSIZE_T_MIN (-yp_SSIZE_T_MAX - 1)"
+.LASF803:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF697:
+	.string	"LLONG_MAX"
+.LASF1471:
+	.string	"_COMMA_REPEAT11(x) x, x, x, x, x, x, x, x, x, x, x"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1452:
+	.string	"_STRINGIFY26(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z"
+.LASF827:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1287:
+	.string	"SCNxFAST32 __PRIPTR_PREFIX \"x\""
+.LASF1139:
+	.string	"munit_int64_t int64_t"
+.LASF755:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1501:
+	.string	"yp_offsetof(structType,member) ((yp_ssize_t)offsetof(structType, member))"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1405:
+	.string	"L_ctermid 9"
+.LASF721:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF993:
+	.string	"NULL"
+.LASF1528:
+	.string	"_assert_raises(statement,n,expected,statement_fmt,expected_fmt,...) do { ypObject *_ypmt_RAISES_statement = statement; _assert_isexception( _ypmt_RAISES_statement, n, expected, statement_fmt, expected_fmt, __VA_ARGS__); } while (0)"
+.LASF656:
+	.string	"BC_SCALE_MAX _POSIX2_BC_SCALE_MAX"
+.LASF886:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF397:
+	.string	"_LIBC_LIMITS_H_ 1"
+.LASF901:
+	.string	"yp_SLICE_LAST yp_SSIZE_T_MAX"
+.LASF1457:
+	.string	"_STRINGIFY31(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E"
+.LASF409:
+	.string	"__USE_XOPEN"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF432:
+	.string	"_DEFAULT_SOURCE"
+.LASF381:
+	.string	"MUNIT_NO_BUFFER 1"
+.LASF431:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1440:
+	.string	"_STRINGIFY14(a,b,c,d,e,f,g,h,i,j,k,l,m,n) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n"
+.LASF778:
+	.string	"__dev_t_defined "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1425:
+	.ascii	"_PP_ARG_N(prefix,_1,_2,_3,_4,_5,_"
+	.string	"6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,_65,_66,n,...) prefix ##n"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF988:
+	.string	"_GCC_WCHAR_T "
+.LASF608:
+	.string	"NR_OPEN 1024"
+.LASF1731:
+	.string	"_ypmt_TYPE_type_a"
+.LASF1732:
+	.string	"_ypmt_TYPE_type_b"
+.LASF734:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1163:
+	.string	"PRIiLEAST32 \"i\""
+.LASF1016:
+	.string	"__WCOREFLAG 0x80"
+.LASF1118:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF898:
+	.string	"yp_INT_T_MAX LLONG_MAX"
+.LASF1564:
+	.ascii	"_faulty_iter_test_raises(setup,iter_name,iter_expression,sta"
+	.ascii	"tement,tear_down,test_name,exc_suffix,expected,statement_str"
+	.ascii	") do { ypObject *_ypmt_FLT_ITR_expecte"
+	.string	"d[] = {expected}; ypObject *iter_name; UNPACK setup; iter_name = iter_expression; _assert_raises ##exc_suffix(statement, 1, _ypmt_FLT_ITR_expected, \"%s /*\" test_name \"*/\", \"%s\", statement_str, #expected); yp_decref(iter_name); UNPACK tear_down; } while (0)"
+.LASF1241:
+	.string	"SCNi8 \"hhi\""
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF965:
+	.string	"yp_ENDFOR } } yp_decref(_yp_FOR_iter); }"
+.LASF693:
+	.string	"ULONG_MAX"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF957:
+	.string	"yp_ENDWHILE } }"
+.LASF793:
+	.string	"__need_size_t "
+.LASF704:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1464:
+	.string	"_COMMA_REPEAT4(x) x, x, x, x"
+.LASF960:
+	.string	"yp_FORd(target,expression) _yp_FOR(target, expression, yp_decref(_yp_FOR_expr))"
+.LASF887:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF924:
+	.string	"_yp_IMMORTAL_HEAD_INIT(type,type_flags,len,data) {(type), 0, (type_flags), _ypObject_REFCNT_IMMORTAL, (len), _ypObject_LEN_INVALID, _ypObject_HASH_INVALID, (data)}"
+.LASF994:
+	.string	"NULL ((void *)0)"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF790:
+	.string	"__clockid_t_defined 1"
+.LASF991:
+	.string	"_BSD_WCHAR_T_"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1030:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF801:
+	.string	"_SIZE_T_ "
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF955:
+	.string	"yp_WHILE_EXCEPT } if(yp_isexceptionC(_yp_WHILE_cond)) {"
+.LASF812:
+	.string	"__need_size_t"
+.LASF1352:
+	.string	"munit_assert_ptr_not_equal(a,b) munit_assert_ptr(a, !=, b)"
+.LASF1374:
+	.string	"__need_ptrdiff_t"
+.LASF830:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1216:
+	.string	"PRIXFAST64 __PRI64_PREFIX \"X\""
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1592:
+	.string	"ob_flags"
+.LASF686:
+	.string	"INT_MAX __INT_MAX__"
+.LASF1315:
+	.string	"munit_assert(expr) do { if (!MUNIT_LIKELY(expr)) { munit_error(\"assertion failed: \" #expr); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF393:
+	.string	"yp_FUTURE "
+.LASF1361:
+	.string	"_STDDEF_H "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1116:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1196:
+	.string	"PRIx64 __PRI64_PREFIX \"x\""
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1702:
+	.string	"yp_isexceptionC"
+.LASF1132:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1272:
+	.string	"SCNoLEAST64 __PRI64_PREFIX \"o\""
+.LASF1131:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF411:
+	.string	"__USE_UNIX98"
+.LASF1203:
+	.string	"PRIxFAST32 __PRIPTR_PREFIX \"x\""
+.LASF1647:
+	.string	"pair"
+.LASF913:
+	.string	"_ypStringLib_ENC_CODE_BYTES (0u)"
+.LASF1454:
+	.string	"_STRINGIFY28(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1710:
+	.string	"items"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF614:
+	.string	"NAME_MAX 255"
+.LASF739:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1551:
+	.ascii	"ass"
+	.string	"ert_same_type(a,b) do { ypObject *_ypmt_TYPE_a = (a); ypObject *_ypmt_TYPE_b = (b); _assert_not_exception(_ypmt_TYPE_a, \"%s\", #a); _assert_not_exception(_ypmt_TYPE_b, \"%s\", #b); _assert_same_type(_ypmt_TYPE_a, _ypmt_TYPE_b, \"%s\", \"%s\", #a, #b); } while (0)"
+.LASF1019:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1260:
+	.string	"SCNuLEAST64 __PRI64_PREFIX \"u\""
+.LASF1273:
+	.string	"SCNoFAST8 \"hho\""
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF604:
+	.string	"__undef_LINK_MAX "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF767:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF961:
+	.string	"yp_FOR_return(expression) return yp_decref(_yp_FOR_iter), (expression)"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1355:
+	.string	"munit_assert_ptr_null(ptr) munit_assert_ptr(ptr, ==, NULL)"
+.LASF624:
+	.string	"__undef_LINK_MAX"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1259:
+	.string	"SCNuLEAST32 \"u\""
+.LASF1682:
+	.string	"param_key_type"
+.LASF1479:
+	.string	"_COMMA_REPEAT19(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1083:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1426:
+	.string	"_PP_RSEQ_N() 66,65,64,63,62,61,60, 59,58,57,56,55,54,53,52,51,50, 49,48,47,46,45,44,43,42,41,40, 39,38,37,36,35,34,33,32,31,30, 29,28,27,26,25,24,23,22,21,20, 19,18,17,16,15,14,13,12,11,10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0"
+.LASF769:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1129:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1029:
+	.string	"__f128(x) x ##f128"
+.LASF870:
+	.string	"__fsblkcnt_t_defined "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1255:
+	.string	"SCNu32 \"u\""
+.LASF951:
+	.string	"_yp_WHILE(expression,decref_expression) { ypObject *_yp_WHILE_expr; ypObject *_yp_WHILE_cond; while(_yp_WHILE_expr = (expression), _yp_WHILE_cond = yp_bool(_yp_WHILE_expr), decref_expression, _yp_WHILE_cond == yp_True) {"
+.LASF692:
+	.string	"LONG_MAX __LONG_MAX__"
+.LASF1619:
+	.string	"MUNIT_SKIP"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF825:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF703:
+	.string	"__GNUC_VA_LIST "
+.LASF1643:
+	.string	"_ypObject"
+.LASF1740:
+	.string	"munit_tmp_a_"
+.LASF627:
+	.string	"ARG_MAX"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1625:
+	.string	"value"
+.LASF871:
+	.string	"__fsfilcnt_t_defined "
+.LASF1610:
+	.string	"yp_False"
+.LASF996:
+	.string	"WNOHANG 1"
+.LASF1357:
+	.string	"munit_malloc(size) munit_malloc_ex(__FILE__, __LINE__, (size))"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1548:
+	.string	"_assert_type_is(obj,expected,obj_fmt,expected_fmt,...) do { ypObject *_ypmt_TYPE_type_obj = yp_type(obj); _assert_ptr(_ypmt_TYPE_type_obj, ==, expected, \"yp_type(\" obj_fmt \")\", expected_fmt, __VA_ARGS__); } while (0)"
+.LASF1297:
+	.string	"SCNuPTR __PRIPTR_PREFIX \"u\""
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1244:
+	.string	"SCNi64 __PRI64_PREFIX \"i\""
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1053:
+	.string	"__ldiv_t_defined 1"
+.LASF389:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF571:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1)"
+.LASF1707:
+	.string	"params"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF967:
+	.string	"yp2(self,method,a1) yp_ ##method(self, a1)"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1394:
+	.string	"_IONBF 2"
+.LASF649:
+	.string	"_POSIX2_COLL_WEIGHTS_MAX 2"
+.LASF1570:
+	.ascii	"define_function(name,code,parameters) yp_pa"
+	.string	"rameter_decl_t _ ##name ##_parameters[] = {UNPACK parameters}; yp_function_decl_t _ ##name ##_declaration = { (code), 0, yp_lengthof_array(_ ##name ##_parameters), _ ##name ##_parameters, NULL, NULL}; ypObject *name = yp_functionC(&_ ##name ##_declaration)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1463:
+	.string	"_COMMA_REPEAT3(x) x, x, x"
+.LASF1474:
+	.string	"_COMMA_REPEAT14(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1687:
+	.string	"yp_contains_manyC"
+.LASF1565:
+	.ascii	"_faulty_iter_test_succeeds(setup,iter_name,iter_expression,s"
+	.ascii	"tatement,assertion,tear_down,t"
+	.string	"est_name,exc_suffix,statement_str) do { ypObject *iter_name; UNPACK setup; iter_name = iter_expression; _assert_not_raises ##exc_suffix(statement, \"%s /*\" test_name \"*/\", statement_str); UNPACK assertion; yp_decref(iter_name); UNPACK tear_down; } while (0)"
+.LASF1741:
+	.string	"munit_tmp_b_"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1093:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1403:
+	.string	"TMP_MAX 238328"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1671:
+	.string	"objobjfunc"
+.LASF998:
+	.string	"WSTOPPED 2"
+.LASF1700:
+	.string	"yp_lenC"
+.LASF868:
+	.string	"__blksize_t_defined "
+.LASF1586:
+	.string	"__ssize_t"
+.LASF929:
+	.string	"yp_IMMORTAL_INT(name,value) _yp_IMMORTAL_INT(, name, value)"
+.LASF691:
+	.string	"LONG_MAX"
+.LASF999:
+	.string	"WEXITED 4"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF690:
+	.string	"LONG_MIN (-LONG_MAX - 1L)"
+.LASF1281:
+	.string	"SCNxLEAST8 \"hhx\""
+.LASF989:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1605:
+	.string	"double"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1146:
+	.string	"PRId16 \"d\""
+.LASF1433:
+	.string	"_STRINGIFY7(a,b,c,d,e,f,g) #a, #b, #c, #d, #e, #f, #g"
+.LASF884:
+	.string	"__LOCK_ALIGNMENT "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1603:
+	.string	"yp_uint64_t"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1660:
+	.string	"is_sequence"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1008:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF385:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1299:
+	.string	"munit_bool _Bool"
+.LASF861:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF613:
+	.string	"MAX_INPUT 255"
+.LASF1519:
+	.string	"assert_not_exception(obj) do { ypObject *_ypmt_NOT_EXC_obj = (obj); _assert_not_exception(_ypmt_NOT_EXC_obj, \"%s\", #obj); } while (0)"
+.LASF1130:
+	.string	"INTMAX_C(c) c ## L"
+.LASF628:
+	.string	"__undef_ARG_MAX"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1347:
+	.ascii	"munit_assert_string_equal(a,b) do { const char* munit_tmp_a_"
+	.ascii	" = a; const char* munit"
+	.string	"_tmp_b_ = b; if (MUNIT_UNLIKELY(strcmp(munit_tmp_a_, munit_tmp_b_) != 0)) { munit_errorf(\"assertion failed: string %s == %s (\\\"%s\\\" == \\\"%s\\\")\", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF641:
+	.string	"MQ_PRIO_MAX 32768"
+.LASF1620:
+	.string	"MUNIT_ERROR"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1027:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1644:
+	.string	"_fixture_type_t"
+.LASF1266:
+	.string	"SCNo16 \"ho\""
+.LASF1267:
+	.string	"SCNo32 \"o\""
+.LASF783:
+	.string	"__off_t_defined "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1532:
+	.ascii	"_assert_typeC_exc(T,a_statement,op,b_statement,val_pri,a_fmt"
+	.ascii	",b_fmt,...) do "
+	.string	"{ T _ypmt_TYPEC_a; T _ypmt_TYPEC_b; _assert_not_raises_exc(_ypmt_TYPEC_a = (a_statement); _ypmt_TYPEC_b = (b_statement), a_fmt \" \" #op \" \" b_fmt, __VA_ARGS__); _assert_typeC(_ypmt_TYPEC_a, op, _ypmt_TYPEC_b, val_pri, a_fmt, b_fmt, __VA_ARGS__); } while (0)"
+.LASF837:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1000:
+	.string	"WCONTINUED 8"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF977:
+	.string	"_WCHAR_T "
+.LASF720:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF695:
+	.string	"LLONG_MIN"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF652:
+	.string	"_POSIX2_RE_DUP_MAX 255"
+.LASF1269:
+	.string	"SCNoLEAST8 \"hho\""
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1110:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1524:
+	.string	"assert_not_raises_exc(statement) _assert_not_raises_exc((statement), \"%s\", #statement)"
+.LASF1097:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF647:
+	.string	"_POSIX2_BC_SCALE_MAX 99"
+.LASF1077:
+	.string	"INT32_MAX (2147483647)"
+.LASF1487:
+	.string	"_COMMA_REPEAT27(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF981:
+	.string	"_WCHAR_T_ "
+.LASF1648:
+	.string	"_new_rand"
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF605:
+	.string	"__undef_OPEN_MAX "
+.LASF953:
+	.string	"yp_WHILEd(expression) _yp_WHILE(expression, yp_decref(_yp_WHILE_expr))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1288:
+	.string	"SCNxFAST64 __PRI64_PREFIX \"x\""
+.LASF1043:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF574:
+	.string	"_POSIX_AIO_MAX 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1109:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1087:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF797:
+	.string	"_SYS_SIZE_T_H "
+.LASF745:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1497:
+	.string	"K(...) (VA_ARGC(__VA_ARGS__) / 2), __VA_ARGS__"
+.LASF609:
+	.string	"NGROUPS_MAX 65536"
+.LASF1701:
+	.string	"yp_isexception_arrayC"
+.LASF1339:
+	.string	"munit_assert_uint32(a,op,b) munit_assert_type(munit_uint32_t, PRIu32, a, op, b)"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1387:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF1181:
+	.string	"PRIu8 \"u\""
+.LASF587:
+	.string	"_POSIX_OPEN_MAX 20"
+.LASF707:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1204:
+	.string	"PRIxFAST64 __PRI64_PREFIX \"x\""
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF943:
+	.string	"yp_IFd(expression) _yp_IF(expression, yp_decref(_yp_IF_expr))"
+.LASF1606:
+	.string	"yp_ssize_t"
+.LASF1622:
+	.string	"name"
+.LASF906:
+	.string	"_yp_UNPACK(...) __VA_ARGS__"
+.LASF423:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF573:
+	.string	"_POSIX_AIO_LISTIO_MAX 2"
+.LASF1550:
+	.string	"_assert_same_type(a,b,a_fmt,b_fmt,...) do { ypObject *_ypmt_TYPE_type_a = yp_type(a); ypObject *_ypmt_TYPE_type_b = yp_type(b); _assert_ptr(_ypmt_TYPE_type_a, ==, _ypmt_TYPE_type_b, \"yp_type(\" a_fmt \")\", \"yp_type(\" b_fmt \")\", __VA_ARGS__); } while (0)"
+.LASF588:
+	.string	"_POSIX_PATH_MAX 256"
+.LASF856:
+	.string	"__suseconds_t_defined "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF756:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1137:
+	.string	"munit_int32_t int32_t"
+.LASF873:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1205:
+	.string	"PRIX8 \"X\""
+.LASF1465:
+	.string	"_COMMA_REPEAT5(x) x, x, x, x, x"
+.LASF865:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF414:
+	.string	"__USE_XOPEN2K8"
+.LASF1117:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1686:
+	.string	"yp_in"
+.LASF848:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF757:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF813:
+	.string	"__need_NULL"
+.LASF1375:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF920:
+	.string	"_ypStr_CODE (18u)"
+.LASF1276:
+	.string	"SCNoFAST64 __PRI64_PREFIX \"o\""
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1247:
+	.string	"SCNiLEAST32 \"i\""
+.LASF416:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1210:
+	.string	"PRIXLEAST16 \"X\""
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1680:
+	.string	"fixture_t"
+.LASF911:
+	.string	"_ypObject_HASH_INVALID ((yp_hash_t) - 1)"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1520:
+	.string	"_ypmt_error_exception(exc,non_exc_fmt,obj_fmt,...) do { _assert_not_exception(exc, obj_fmt, __VA_ARGS__); munit_errorf(non_exc_fmt \": \" obj_fmt, __VA_ARGS__); } while (0)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1180:
+	.string	"PRIoFAST64 __PRI64_PREFIX \"o\""
+.LASF581:
+	.string	"_POSIX_MAX_CANON 255"
+.LASF1381:
+	.string	"_____fpos64_t_defined 1"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1716:
+	.string	"_ypmt_LEN_actual"
+.LASF391:
+	.string	"yp_MUNIT_TEST_UNITTEST_H "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1404:
+	.string	"FILENAME_MAX 4096"
+.LASF1283:
+	.string	"SCNxLEAST32 \"x\""
+.LASF904:
+	.string	"yp_HASH_ALGORITHM_WYHASH (2)"
+.LASF1595:
+	.string	"ob_len"
+.LASF1174:
+	.string	"PRIoLEAST16 \"o\""
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF742:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1167:
+	.string	"PRIiFAST32 __PRIPTR_PREFIX \"i\""
+.LASF899:
+	.string	"yp_INT_T_MIN LLONG_MIN"
+.LASF1249:
+	.string	"SCNiFAST8 \"hhi\""
+.LASF1343:
+	.string	"_STRING_H 1"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1581:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF923:
+	.string	"yp_CONST_REF _yp_CONST_REF"
+.LASF1582:
+	.string	"signed char"
+.LASF1044:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1294:
+	.string	"SCNdPTR __PRIPTR_PREFIX \"d\""
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF949:
+	.string	"yp_ELSE_EXCEPT_AS(target) yp_ELSE_EXCEPT ypObject *target = _yp_IF_cond;"
+.LASF601:
+	.string	"_POSIX_TZNAME_MAX 6"
+.LASF1179:
+	.string	"PRIoFAST32 __PRIPTR_PREFIX \"o\""
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF794:
+	.string	"__size_t__ "
+.LASF1482:
+	.string	"_COMMA_REPEAT22(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1561:
+	.string	"assert_mapping(obj,...) do { ypObject *_ypmt_MAP_obj = (obj); ypObject *_ypmt_MAP_items[] = {__VA_ARGS__}; char *_ypmt_MAP_item_strs[] = {STRINGIFY(__VA_ARGS__)}; _assert_mapping(_ypmt_MAP_obj, _ypmt_MAP_items, \"%s\", _ypmt_MAP_item_strs, #obj); } while (0)"
+.LASF985:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1726:
+	.string	"_ypmt_SET_mi_state"
+.LASF1279:
+	.string	"SCNx32 \"x\""
+.LASF1191:
+	.string	"PRIuFAST32 __PRIPTR_PREFIX \"u\""
+.LASF791:
+	.string	"__time_t_defined 1"
+.LASF840:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF832:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1396:
+	.string	"EOF (-1)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF777:
+	.string	"__ino_t_defined "
+.LASF1111:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF902:
+	.string	"yp_HASH_ALGORITHM_DEFAULT (0)"
+.LASF1177:
+	.string	"PRIoFAST8 \"o\""
+.LASF1296:
+	.string	"SCNoPTR __PRIPTR_PREFIX \"o\""
+.LASF893:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1187:
+	.string	"PRIuLEAST32 \"u\""
+.LASF400:
+	.string	"_FEATURES_H 1"
+.LASF1046:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1333:
+	.string	"munit_assert_ptr(a,op,b) munit_assert_type(const void*, \"p\", a, op, b)"
+.LASF802:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1746:
+	.string	"GNU C17 12.2.0 -m64 -mtune=generic -march=x86-64 -g3 -Og -fvisibility=hidden -ftrapv -fstack-clash-protection -fno-omit-frame-pointer -fasynchronous-unwind-tables"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF872:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF738:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1004:
+	.string	"__WCLONE 0x80000000"
+.LASF964:
+	.string	"yp_FOR_EXCEPT_AS(target) yp_FOR_EXCEPT ypObject *target = _yp_FOR_item;"
+.LASF1642:
+	.string	"fixture_type_t"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF867:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF425:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1206:
+	.string	"PRIX16 \"X\""
+.LASF1020:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1569:
+	.ascii	"sprintf_array(array,fmt,..."
+	.string	") do { yp_ssize_t _ypmt_SPRINTF_len = yp_lengthof_array(array); yp_ssize_t result = (yp_ssize_t)unittest_snprintf( (array), (size_t)_ypmt_SPRINTF_len, fmt, __VA_ARGS__); assert_ssizeC(result, >=, 0); assert_ssizeC(result, <, _ypmt_SPRINTF_len); } while (0)"
+.LASF743:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1035:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF877:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1142:
+	.string	"____gwchar_t_defined 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1420:
+	.string	"yp_ARCH_64_BIT 1"
+.LASF971:
+	.string	"yp5(self,method,a1,a2,a3,a4) yp_ ##method(self, a1, a2, a3, a4)"
+.LASF1513:
+	.string	"assert_null(ptr) munit_assert_null(ptr)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1545:
+	.string	"yp_is_not(a,b) ((a) != (b) ? yp_True : yp_False)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF735:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1363:
+	.string	"_ANSI_STDDEF_H "
+.LASF620:
+	.string	"RTSIG_MAX 32"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF969:
+	.string	"yp3(self,method,a1,a2) yp_ ##method(self, a1, a2)"
+.LASF1280:
+	.string	"SCNx64 __PRI64_PREFIX \"x\""
+.LASF689:
+	.string	"LONG_MIN"
+.LASF1733:
+	.string	"test_reserve"
+.LASF918:
+	.string	"_ypInt_CODE (10u)"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1135:
+	.string	"munit_int16_t int16_t"
+.LASF583:
+	.string	"_POSIX_MQ_OPEN_MAX 8"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1499:
+	.string	"UNPACK(...) __VA_ARGS__"
+.LASF1743:
+	.string	"test_bool"
+.LASF1140:
+	.string	"munit_uint64_t uint64_t"
+.LASF1224:
+	.string	"PRIiPTR __PRIPTR_PREFIX \"i\""
+.LASF1508:
+	.string	"_assert_typeC(a,op,b,val_pri,a_fmt,b_fmt,...) do { if (!(a op b)) { munit_errorf(\"assertion failed: \" a_fmt \" \" #op \" \" b_fmt \" (%\" val_pri \" \" #op \" %\" val_pri \") \", __VA_ARGS__, a, b); } } while (0)"
+.LASF1455:
+	.string	"_STRINGIFY29(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1098:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1023:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF788:
+	.string	"__key_t_defined "
+.LASF1045:
+	.string	"__f32(x) x ##f32"
+.LASF1353:
+	.string	"munit_assert_null(ptr) munit_assert_ptr(ptr, ==, NULL)"
+.LASF737:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1398:
+	.string	"SEEK_CUR 1"
+.LASF1133:
+	.string	"munit_int8_t int8_t"
+.LASF835:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF736:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1462:
+	.string	"_COMMA_REPEAT2(x) x, x"
+.LASF824:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF934:
+	.string	"yp_IMMORTAL_STR_LATIN_1_static(name,value) _yp_IMMORTAL_STR_LATIN_1(static, name, value)"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF595:
+	.string	"_POSIX_SSIZE_MAX 32767"
+.LASF1481:
+	.string	"_COMMA_REPEAT21(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1407:
+	.string	"FOPEN_MAX 16"
+.LASF726:
+	.string	"__SLONG32_TYPE int"
+.LASF1257:
+	.string	"SCNuLEAST8 \"hhu\""
+.LASF937:
+	.string	"yp_IMMORTAL_FUNCTION(name,code,parameters) _yp_IMMORTAL_FUNCTION(, name, code, parameters)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1075:
+	.string	"INT8_MAX (127)"
+.LASF653:
+	.string	"_POSIX2_CHARCLASS_NAME_MAX 14"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1081:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1460:
+	.string	"_STRINGIFY34(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F,G,H) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F, #G, #H"
+.LASF1230:
+	.string	"SCNd16 \"hd\""
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1573:
+	.string	"obj_array_fill(array,uq,filler) (filler)((uq), yp_lengthof_array(array), (array))"
+.LASF1200:
+	.string	"PRIxLEAST64 __PRI64_PREFIX \"x\""
+.LASF939:
+	.string	"yp_IMMORTAL_FUNCTION2(name,code) _yp_IMMORTAL_FUNCTION5(, name, code, 0, NULL)"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF404:
+	.string	"__USE_ISOCXX11"
+.LASF1173:
+	.string	"PRIoLEAST8 \"o\""
+.LASF1169:
+	.string	"PRIo8 \"o\""
+.LASF1389:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF430:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1703:
+	.string	"yp_reserveC"
+.LASF1071:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1079:
+	.string	"UINT8_MAX (255)"
+.LASF968:
+	.string	"yp(self,method,...) yp_ ##method(self, __VA_ARGS__)"
+.LASF1694:
+	.string	"yp_frozenset"
+.LASF1684:
+	.string	"yp_bool"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1408:
+	.string	"stdin stdin"
+.LASF1159:
+	.string	"PRIi32 \"i\""
+.LASF1239:
+	.string	"SCNdFAST32 __PRIPTR_PREFIX \"d\""
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF903:
+	.string	"yp_HASH_ALGORITHM_SIPHASH13 (1)"
+.LASF1590:
+	.string	"ypObject"
+.LASF1421:
+	.string	"PRIint \"lld\""
+.LASF1698:
+	.string	"yp_contains"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1351:
+	.string	"munit_assert_ptr_equal(a,b) munit_assert_ptr(a, ==, b)"
+.LASF1368:
+	.string	"_PTRDIFF_T_ "
+.LASF1332:
+	.string	"munit_assert_double(a,op,b) munit_assert_type(double, \"g\", a, op, b)"
+.LASF1088:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1672:
+	.string	"objvarargfunc"
+.LASF1533:
+	.string	"assert_intC_exc(a,op,b) _assert_typeC_exc(yp_int_t, a, op, b, PRIint, \"%s\", \"%s\", #a, #b)"
+.LASF909:
+	.string	"_yp_INLINE_DATA(elemType) elemType ob_inline_data[]"
+.LASF1246:
+	.string	"SCNiLEAST16 \"hi\""
+.LASF1367:
+	.string	"__PTRDIFF_T "
+.LASF849:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF855:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF387:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1057:
+	.string	"EXIT_SUCCESS 0"
+.LASF1184:
+	.string	"PRIu64 __PRI64_PREFIX \"u\""
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF958:
+	.ascii	"_yp_FOR(target,expression,decref_expression) { yp_uint64_t _"
+	.ascii	"yp_FOR_state; ypObject *_yp_FOR_item; int _yp_FOR_iter_exhau"
+	.ascii	"sted = 0; ypObject *_yp_FOR_expr = (expression); ypObject *_"
+	.ascii	"yp_FOR_iter = yp_miniiter(_yp_FOR_expr, &_yp_FOR_state); dec"
+	.ascii	"ref_expression; while(1) { _yp_FOR_item = yp_"
+	.string	"miniiter_next(&_yp_FOR_iter, &_yp_FOR_state); if(yp_isexceptionC(_yp_FOR_item)) { if(yp_isexceptionC(_yp_FOR_iter)) break; if(yp_isexceptionC2(_yp_FOR_item, yp_StopIteration)) _yp_FOR_iter_exhausted = 1; break; } yp_decref(target); target = _yp_FOR_item; {"
+.LASF759:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF719:
+	.string	"__U32_TYPE unsigned int"
+.LASF636:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF1535:
+	.string	"assert_hashC_exc(a,op,b) _assert_typeC_exc(yp_hash_t, a, op, b, PRIssize, \"%s\", \"%s\", #a, #b)"
+.LASF1429:
+	.string	"_STRINGIFY3(a,b,c) #a, #b, #c"
+.LASF1252:
+	.string	"SCNiFAST64 __PRI64_PREFIX \"i\""
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF591:
+	.string	"_POSIX_RTSIG_MAX 8"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1706:
+	.string	"fixture_setup"
+.LASF1554:
+	.ascii	"_assert_len(obj,expected,obj_fmt,expected_fmt,...) do { yp_s"
+	.ascii	"size_t _ypmt_LEN_actual; _assert_not_raises_exc(_ypmt_LEN_ac"
+	.ascii	"tual = yp_lenC(obj, &exc), \"yp_lenC(\""
+	.string	" obj_fmt \", &exc) == \" expected_fmt, __VA_ARGS__); if (_ypmt_LEN_actual != expected) { munit_errorf(\"assertion failed: yp_lenC(\" obj_fmt \", &exc) == \" expected_fmt \" (%\" PRIssize \" == %\" PRIssize \")\", __VA_ARGS__, _ypmt_LEN_actual, expected); } } while (0)"
+.LASF1409:
+	.string	"stdout stdout"
+.LASF1484:
+	.string	"_COMMA_REPEAT24(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1697:
+	.string	"malloc_tracker_oom_after"
+.LASF954:
+	.string	"yp_WHILE_ELSE } if(_yp_WHILE_cond == yp_False) {"
+.LASF948:
+	.string	"yp_ELSE_EXCEPT } } if(yp_isexceptionC(_yp_IF_cond)) { {"
+.LASF1720:
+	.string	"keys"
+.LASF800:
+	.string	"__SIZE_T "
+.LASF1327:
+	.string	"munit_assert_ulong(a,op,b) munit_assert_type(unsigned long int, \"lu\", a, op, b)"
+.LASF633:
+	.string	"_POSIX_THREAD_THREADS_MAX 64"
+.LASF714:
+	.string	"_SYS_TYPES_H 1"
+.LASF1168:
+	.string	"PRIiFAST64 __PRI64_PREFIX \"i\""
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1049:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF395:
+	.string	"_GCC_LIMITS_H_ "
+.LASF922:
+	.string	"_yp_CONST_REF(name) ((ypObject *)&_ ##name ##_struct)"
+.LASF916:
+	.string	"_ypStringLib_ENC_CODE_UCS_4 (3u)"
+.LASF747:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF763:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1406:
+	.string	"FOPEN_MAX"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1641:
+	.string	"long double"
+.LASF1298:
+	.string	"SCNxPTR __PRIPTR_PREFIX \"x\""
+.LASF1510:
+	.string	"assert_true(expr) munit_assert_true(expr)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1050:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF859:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1182:
+	.string	"PRIu16 \"u\""
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF990:
+	.string	"__DEFINED_wchar_t "
+.LASF1326:
+	.string	"munit_assert_long(a,op,b) munit_assert_type(long int, \"ld\", a, op, b)"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1052:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF429:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF715:
+	.string	"_BITS_TYPES_H 1"
+.LASF606:
+	.string	"__undef_ARG_MAX "
+.LASF1172:
+	.string	"PRIo64 __PRI64_PREFIX \"o\""
+.LASF1578:
+	.string	"long unsigned int"
+.LASF618:
+	.string	"XATTR_SIZE_MAX 65536"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1092:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF853:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1747:
+	.string	"malloc_tracker_oom_disable"
+.LASF978:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1500:
+	.string	"yp_sizeof(x) ((yp_ssize_t)sizeof(x))"
+.LASF1480:
+	.string	"_COMMA_REPEAT20(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF687:
+	.string	"UINT_MAX"
+.LASF1085:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF380:
+	.string	"MUNIT_TEST_NAME_LEN 58"
+.LASF1055:
+	.string	"RAND_MAX 2147483647"
+.LASF1485:
+	.string	"_COMMA_REPEAT25(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1243:
+	.string	"SCNi32 \"i\""
+.LASF718:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1360:
+	.string	"munit_newa(type,nmemb) ((type*) munit_calloc((nmemb), sizeof(type)))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1748:
+	.string	"uniqueness_new"
+.LASF639:
+	.string	"LOGIN_NAME_MAX 256"
+.LASF379:
+	.string	"MUNIT_DISABLE_TIMING 1"
+.LASF1436:
+	.string	"_STRINGIFY10(a,b,c,d,e,f,g,h,i,j) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1358:
+	.string	"munit_new(type) ((type*) munit_malloc(sizeof(type)))"
+.LASF1704:
+	.string	"munit_errorf_ex"
+.LASF1295:
+	.string	"SCNiPTR __PRIPTR_PREFIX \"i\""
+.LASF1413:
+	.string	"_BITS_STDIO_H 1"
+.LASF1585:
+	.string	"char"
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF962:
+	.string	"yp_FOR_ELSE } } if(_yp_FOR_iter_exhausted) { {"
+.LASF1638:
+	.string	"parameters"
+.LASF1437:
+	.string	"_STRINGIFY11(a,b,c,d,e,f,g,h,i,j,k) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1175:
+	.string	"PRIoLEAST32 \"o\""
+.LASF1038:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1356:
+	.string	"munit_assert_ptr_not_null(ptr) munit_assert_ptr(ptr, !=, NULL)"
+.LASF1214:
+	.string	"PRIXFAST16 __PRIPTR_PREFIX \"X\""
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1165:
+	.string	"PRIiFAST8 \"i\""
+.LASF669:
+	.string	"SCHAR_MAX"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1691:
+	.string	"yp_decrefN"
+.LASF716:
+	.string	"__S16_TYPE short int"
+.LASF1311:
+	.string	"munit_logf(level,format,...) munit_logf_ex(level, __FILE__, __LINE__, format, __VA_ARGS__)"
+.LASF646:
+	.string	"_POSIX2_BC_DIM_MAX 2048"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF760:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF997:
+	.string	"WUNTRACED 2"
+.LASF705:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF1317:
+	.string	"munit_assert_false(expr) do { if (!MUNIT_LIKELY(!(expr))) { munit_error(\"assertion failed: \" #expr \" is not false\"); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF843:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF671:
+	.string	"UCHAR_MAX"
+.LASF1562:
+	.ascii	"assert_ptr_array(array,...) do { void **_ypmt_PTR_ARR_array "
+	.ascii	"= (void **)(array); void *_ypmt_PTR_ARR_items[] = {__VA_ARGS"
+	.ascii	"__}; char *_ypmt_PTR_ARR_item_strs[] = {STRINGIFY(__VA_ARGS_"
+	.ascii	"_)}; yp_ssize_t _ypmt_PTR_ARR_n = yp_lengthof_array(_ypmt_PT"
+	.ascii	"R_ARR_items); yp_ssize_t _ypmt_PTR_ARR_i; if (_ypmt_PTR_ARR_"
+	.ascii	"n < 1) { munit_error(\"missing expected items in assertion\""
+	.ascii	"); } for (_ypmt_PTR_ARR_i = 0; "
+	.string	"_ypmt_PTR_ARR_i < _ypmt_PTR_ARR_n; _ypmt_PTR_ARR_i++) { _assert_ptr(_ypmt_PTR_ARR_array[_ypmt_PTR_ARR_i], ==, _ypmt_PTR_ARR_items[_ypmt_PTR_ARR_i], \"%s[%\" PRIssize \"]\", \"%s\", #array, _ypmt_PTR_ARR_i, _ypmt_PTR_ARR_item_strs[_ypmt_PTR_ARR_i]); } } while (0)"
+.LASF1068:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1567:
+	.ascii	"faulty_iter_tests(setup,iter_name,iter_supplier,statement,as"
+	.ascii	"sertion,tear_down) do { ypObject *_ypmt_FLT_ITR_sup"
+	.string	"plier = (iter_supplier); char _ypmt_FLT_ITR_statement_str[] = #statement; _faulty_iter_tests((setup), (iter_name), _ypmt_FLT_ITR_supplier, (statement), (assertion), (tear_down), , _ypmt_FLT_ITR_statement_str); yp_decref(_ypmt_FLT_ITR_supplier); } while (0)"
+.LASF1290:
+	.string	"SCNiMAX __PRI64_PREFIX \"i\""
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1154:
+	.string	"PRIdFAST16 __PRIPTR_PREFIX \"d\""
+.LASF1690:
+	.string	"obj_array_decref2"
+.LASF750:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF804:
+	.string	"_SIZE_T_DEFINED "
+.LASF1705:
+	.string	"fixture_tear_down"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1439:
+	.string	"_STRINGIFY13(a,b,c,d,e,f,g,h,i,j,k,l,m) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m"
+.LASF921:
+	.string	"_ypFunction_CODE (28u)"
+.LASF382:
+	.string	"MUNIT_OUTPUT_FILE stderr"
+.LASF1675:
+	.string	"uniqueness_t"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF775:
+	.string	"__STD_TYPE"
+.LASF761:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1094:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF733:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1033:
+	.string	"__HAVE_FLOAT32 1"
+.LASF384:
+	.string	"_DEBUG 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF811:
+	.string	"__size_t "
+.LASF974:
+	.string	"__need_NULL "
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1401:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1434:
+	.string	"_STRINGIFY8(a,b,c,d,e,f,g,h) #a, #b, #c, #d, #e, #f, #g, #h"
+.LASF1679:
+	.string	"_fixture_t"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1261:
+	.string	"SCNuFAST8 \"hhu\""
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1593:
+	.string	"ob_type_flags"
+.LASF892:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1711:
+	.string	"self"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1489:
+	.string	"_COMMA_REPEAT29(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1543:
+	.string	"assert_truthy(obj) do { ypObject *_ypmt_TRUTHY_result = yp_bool(obj); _assert_bool(_ypmt_TRUTHY_result, yp_True, yp_False, \"yp_bool(%s)\", #obj); } while (0)"
+.LASF1074:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF388:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1119:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF851:
+	.string	"__sigset_t_defined 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF992:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF1108:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1366:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1330:
+	.string	"munit_assert_size(a,op,b) munit_assert_type(size_t, MUNIT_SIZE_MODIFIER \"u\", a, op, b)"
+.LASF1234:
+	.string	"SCNdLEAST16 \"hd\""
+.LASF706:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF963:
+	.string	"yp_FOR_EXCEPT } } if(!_yp_FOR_iter_exhausted && yp_isexceptionC(_yp_FOR_item)) { {"
+.LASF1486:
+	.string	"_COMMA_REPEAT26(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1728:
+	.string	"_ypmt_SET_actual"
+.LASF1504:
+	.string	"yp_lengthof_array_member(structType,member) yp_lengthof_array(((structType *)0)->member)"
+.LASF371:
+	.string	"__linux 1"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1041:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF785:
+	.string	"__id_t_defined "
+.LASF625:
+	.string	"OPEN_MAX"
+.LASF1229:
+	.string	"SCNd8 \"hhd\""
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF890:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1013:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1696:
+	.string	"yp_setitem"
+.LASF1084:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF889:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF435:
+	.string	"__USE_ISOC11 1"
+.LASF787:
+	.string	"__daddr_t_defined "
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1198:
+	.string	"PRIxLEAST16 \"x\""
+.LASF1003:
+	.string	"__WALL 0x40000000"
+.LASF1134:
+	.string	"munit_uint8_t uint8_t"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1302:
+	.string	"MUNIT_UNUSED __attribute__((__unused__))"
+.LASF822:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF836:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF376:
+	.string	"unix 1"
+.LASF426:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1615:
+	.string	"_yp_ob_type_t"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF725:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF959:
+	.string	"yp_FOR(target,expression) _yp_FOR(target, expression, ((void)0))"
+.LASF875:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF418:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1015:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1245:
+	.string	"SCNiLEAST8 \"hhi\""
+.LASF1264:
+	.string	"SCNuFAST64 __PRI64_PREFIX \"u\""
+.LASF1745:
+	.string	"__addvdi3"
+.LASF643:
+	.string	"SSIZE_MAX LONG_MAX"
+.LASF1322:
+	.string	"munit_assert_short(a,op,b) munit_assert_type(short, MUNIT_SHORT_MODIFIER \"d\", a, op, b)"
+.LASF1410:
+	.string	"stderr stderr"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF675:
+	.string	"CHAR_MAX"
+.LASF1219:
+	.string	"PRIoMAX __PRI64_PREFIX \"o\""
+.LASF956:
+	.string	"yp_WHILE_EXCEPT_AS(target) yp_WHILE_EXCEPT ypObject *target = _yp_WHILE_cond;"
+.LASF1576:
+	.string	"SUITE_OF_TESTS_DECLS(name) extern MunitTest name ##_tests[]; extern void name ##_initialize(void)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF839:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1148:
+	.string	"PRId64 __PRI64_PREFIX \"d\""
+.LASF748:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1414:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF820:
+	.string	"__PDP_ENDIAN 3412"
+.LASF594:
+	.string	"_POSIX_SIGQUEUE_MAX 32"
+.LASF684:
+	.string	"INT_MIN (-INT_MAX - 1)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF905:
+	.string	"_yp_UNUSED __attribute__((unused))"
+.LASF1349:
+	.ascii	"munit_assert_memory_equal(size,a,b) do { const unsigned char"
+	.ascii	"* munit_tmp_a_ = (const unsigned char*) (a); const unsigned "
+	.ascii	"char* munit_tmp_b_ = (const unsigned char*) (b); const size_"
+	.ascii	"t munit_tmp_size_ = (size); if (MUNIT_UNLIKELY(memcmp(munit_"
+	.ascii	"tmp_a_, munit_tmp_b_, munit_tmp_size_)) != 0) { size_t munit"
+	.ascii	"_tmp_pos_; for (munit_tmp_pos_ = 0 ; munit_tmp_pos_ < munit_"
+	.ascii	"tmp_size_ ; munit_tmp_pos_++) { if (munit"
+	.string	"_tmp_a_[munit_tmp_pos_] != munit_tmp_b_[munit_tmp_pos_]) { munit_errorf(\"assertion failed: memory %s == %s, at offset %\" MUNIT_SIZE_MODIFIER \"u\", #a, #b, munit_tmp_pos_); break; } } } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF1689:
+	.string	"uniqueness_dealloc"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1587:
+	.string	"ssize_t"
+.LASF758:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1348:
+	.ascii	"munit_assert_string_not_equal(a,b) do { const char* munit_tm"
+	.ascii	"p_a_ = a; const char* munit"
+	.string	"_tmp_b_ = b; if (MUNIT_UNLIKELY(strcmp(munit_tmp_a_, munit_tmp_b_) == 0)) { munit_errorf(\"assertion failed: string %s != %s (\\\"%s\\\" == \\\"%s\\\")\", #a, #b, munit_tmp_a_, munit_tmp_b_); } MUNIT_PUSH_DISABLE_MSVC_C4127_ } while (0) MUNIT_POP_DISABLE_MSVC_C4127_"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1194:
+	.string	"PRIx16 \"x\""
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF982:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1493:
+	.string	"_COMMA_REPEAT33(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1412:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF1054:
+	.string	"__lldiv_t_defined 1"
+.LASF1090:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF578:
+	.string	"_POSIX_HOST_NAME_MAX 255"
+.LASF664:
+	.string	"_LIMITS_H___ "
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1478:
+	.string	"_COMMA_REPEAT18(x) x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x"
+.LASF1665:
+	.string	"is_patterned"
+.LASF1390:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF668:
+	.string	"SCHAR_MIN (-SCHAR_MAX - 1)"
+.LASF621:
+	.string	"NR_OPEN"
+.LASF762:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1540:
+	.string	"assert_hashC_raises_exc(a,op,b,...) _assert_typeC_raises_exc( yp_hash_t, a, op, b, (__VA_ARGS__), PRIssize, \"%s\", \"%s\", \"%s\", #a, #b, #__VA_ARGS__)"
+.LASF422:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1010:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1662:
+	.string	"is_setlike"
+.LASF1115:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1338:
+	.string	"munit_assert_int32(a,op,b) munit_assert_type(munit_int32_t, PRIi32, a, op, b)"
+.LASF1143:
+	.string	"__PRI64_PREFIX \"l\""
+.LASF351:
+	.string	"__x86_64 1"
+.LASF942:
+	.string	"yp_IF(expression) _yp_IF(expression, ((void)0))"
+.LASF1507:
+	.string	"SUITE_OF_SUITES(name) { \"/\" #name, NULL, (name ##_suites), 1, MUNIT_SUITE_OPTION_NONE }"
+.LASF1341:
+	.string	"munit_assert_uint64(a,op,b) munit_assert_type(munit_uint64_t, PRIu64, a, op, b)"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1613:
+	.string	"yp_MethodError"
+.LASF582:
+	.string	"_POSIX_MAX_INPUT 255"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF724:
+	.string	"__SWORD_TYPE long int"
+.LASF973:
+	.string	"__need_wchar_t "
+.LASF413:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1031:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1242:
+	.string	"SCNi16 \"hi\""
+.LASF1105:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF869:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1002:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF979:
+	.string	"_T_WCHAR "
+.LASF1256:
+	.string	"SCNu64 __PRI64_PREFIX \"u\""
+.LASF810:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1080:
+	.string	"UINT16_MAX (65535)"
+.LASF1227:
+	.string	"PRIxPTR __PRIPTR_PREFIX \"x\""
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF766:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1362:
+	.string	"_STDDEF_H_ "
+.LASF774:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1291:
+	.string	"SCNoMAX __PRI64_PREFIX \"o\""
+.LASF1377:
+	.string	"_STDIO_H 1"
+.LASF731:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF927:
+	.ascii	"_yp_IMMORTAL_BYTES(qual,name,value) static const char _"
+	.string	" ##name ##_data[] = (value); static struct _ypStringLibObject _ ##name ##_struct = {_yp_IMMORTAL_HEAD_INIT(_ypBytes_CODE, _ypStringLib_ENC_CODE_BYTES, sizeof(_ ##name ##_data) - 1, (void *)_ ##name ##_data)}; qual ypObject *const name = _yp_CONST_REF(name)"
+.LASF667:
+	.string	"SCHAR_MIN"
+.LASF770:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1127:
+	.string	"UINT16_C(c) c"
+.LASF876:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1059:
+	.string	"_ALLOCA_H 1"
+.LASF1113:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1379:
+	.string	"_____fpos_t_defined 1"
+.LASF1602:
+	.string	"yp_uint32_t"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1688:
+	.string	"yp_clear"
+.LASF1461:
+	.string	"_COMMA_REPEAT1(x) x"
+.LASF407:
+	.string	"__USE_POSIX199309"
+.LASF615:
+	.string	"PATH_MAX 4096"
+.LASF1547:
+	.string	"assert_obj(a,op,b) do { ypObject *_ypmt_OBJ_a = (a); ypObject *_ypmt_OBJ_b = (b); _assert_obj(_ypmt_OBJ_a, op, _ypmt_OBJ_b, \"%s\", \"%s\", #a, #b); } while (0)"
+.LASF685:
+	.string	"INT_MAX"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF622:
+	.string	"__undef_NR_OPEN"
+.LASF1369:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF980:
+	.string	"__WCHAR_T "
+.LASF1274:
+	.string	"SCNoFAST16 __PRIPTR_PREFIX \"o\""
+.LASF1336:
+	.string	"munit_assert_int16(a,op,b) munit_assert_type(munit_int16_t, PRIi16, a, op, b)"
+.LASF1736:
+	.string	"empty"
+.LASF776:
+	.string	"__u_char_defined "
+.LASF386:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1277:
+	.string	"SCNx8 \"hhx\""
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF665:
+	.string	"CHAR_BIT"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF860:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1251:
+	.string	"SCNiFAST32 __PRIPTR_PREFIX \"i\""
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1040:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1186:
+	.string	"PRIuLEAST16 \"u\""
+.LASF434:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF676:
+	.string	"CHAR_MAX SCHAR_MAX"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1588:
+	.string	"long long unsigned int"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF771:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1192:
+	.string	"PRIuFAST64 __PRI64_PREFIX \"u\""
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1268:
+	.string	"SCNo64 __PRI64_PREFIX \"o\""
+.LASF1749:
+	.string	"test_collection_initialize"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1275:
+	.string	"SCNoFAST32 __PRIPTR_PREFIX \"o\""
+.LASF1685:
+	.string	"yp_not_in"
+.LASF1025:
+	.string	"__HAVE_FLOAT128 1"
+.LASF833:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1734:
+	.string	"test_clear"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1263:
+	.string	"SCNuFAST32 __PRIPTR_PREFIX \"u\""
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF383:
+	.string	"yp_ENABLE_SHARED 1"
+.LASF1065:
+	.string	"_STDINT_H 1"
+.LASF1428:
+	.string	"_STRINGIFY2(a,b) #a, #b"
+.LASF699:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1ULL)"
+.LASF1430:
+	.string	"_STRINGIFY4(a,b,c,d) #a, #b, #c, #d"
+.LASF1024:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF764:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1151:
+	.string	"PRIdLEAST32 \"d\""
+.LASF710:
+	.string	"_VA_LIST "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF799:
+	.string	"_T_SIZE "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1663:
+	.string	"is_mapping"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF634:
+	.string	"PTHREAD_THREADS_MAX"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF1314:
+	.string	"munit_error(msg) munit_errorf(\"%s\", msg)"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1006:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1212:
+	.string	"PRIXLEAST64 __PRI64_PREFIX \"X\""
+.LASF1709:
+	.string	"test_collection_params"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF746:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1630:
+	.string	"MunitTestOptions"
+.LASF1303:
+	.string	"MUNIT_ARRAY_PARAM(name) name"
+.LASF1395:
+	.string	"BUFSIZ 8192"
+.LASF1301:
+	.string	"MUNIT_UNLIKELY(expr) (__builtin_expect ((expr), 0))"
+.LASF930:
+	.string	"yp_IMMORTAL_BYTES(name,value) _yp_IMMORTAL_BYTES(, name, value)"
+.LASF925:
+	.string	"_yp_IMMORTAL_SMALL_HEAD_INIT(type,type_flags) {(type), 0, (type_flags), _ypObject_REFCNT_IMMORTAL}"
+.LASF862:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1526:
+	.ascii	"assert_isexception(obj,...) do { ypObject *_ypmt"
+	.string	"_ISEXC_obj = (obj); ypObject *_ypmt_ISEXC_expected[] = {__VA_ARGS__}; yp_ssize_t _ypmt_ISEXC_n = yp_lengthof_array(_ypmt_ISEXC_expected); _assert_isexception(_ypmt_ISEXC_obj, _ypmt_ISEXC_n, _ypmt_ISEXC_expected, \"%s\", \"%s\", #obj, #__VA_ARGS__); } while (0)"
+.LASF945:
+	.string	"yp_ELIF(expression) _yp_ELIF(expression, ((void)0))"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF765:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1346:
+	.string	"_STRINGS_H 1"
+.LASF1359:
+	.string	"munit_calloc(nmemb,size) munit_malloc((nmemb) * (size))"
+.LASF577:
+	.string	"_POSIX_DELAYTIMER_MAX 32"
+.LASF712:
+	.string	"_VA_LIST_T_H "
+.LASF786:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1382:
+	.string	"____FILE_defined 1"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1152:
+	.string	"PRIdLEAST64 __PRI64_PREFIX \"d\""
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1516:
+	.string	"assert_ssizeC(a,op,b) munit_assert_type(yp_ssize_t, PRIssize, a, op, b)"
+.LASF866:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1676:
+	.string	"_rand_obj_supplier_memo_t"
+.LASF1629:
+	.string	"MUNIT_TEST_OPTION_TODO"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1042:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1669:
+	.string	"_peer_type_t"
+.LASF1282:
+	.string	"SCNxLEAST16 \"hx\""
+.LASF1715:
+	.string	"_ypmt_LEN_expected"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1427:
+	.string	"_STRINGIFY1(a) #a"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF874:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF926:
+	.string	"_yp_IMMORTAL_INT(qual,name,value) static struct _ypIntObject _ ##name ##_struct = { _yp_IMMORTAL_SMALL_HEAD_INIT(_ypInt_CODE, 0), (value)}; qual ypObject *const name = _yp_CONST_REF(name)"
+.LASF1061:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1112:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1370:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1723:
+	.string	"_ypmt_SET_item_strs"
+.LASF896:
+	.string	"yp_SSIZE_T_MAX SSIZE_MAX"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1729:
+	.string	"_ypmt_SET_i"
+.LASF1677:
+	.string	"_uniqueness_t"
+.LASF1574:
+	.string	"obj_array_decref(array) obj_array_decref2(yp_lengthof_array(array), (array))"
+.LASF1724:
+	.string	"_ypmt_SET_n"
+.LASF673:
+	.string	"CHAR_MIN"
+.LASF1607:
+	.string	"yp_hash_t"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1523:
+	.ascii	"_assert_not_raises_exc(statement,statement_fmt,...) do { y"
+	.string	"pObject *exc = NULL; statement; if (exc != NULL) { if (yp_isexceptionC(exc)) { munit_errorf(\"assertion failed: \" statement_fmt \"; !yp_isexceptionC(exc)\", __VA_ARGS__); } munit_errorf(\"exc set to a non-exception: \" statement_fmt, __VA_ARGS__); } } while (0)"
+.LASF834:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1158:
+	.string	"PRIi16 \"i\""
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF863:
+	.string	"NFDBITS __NFDBITS"
+.LASF1589:
+	.string	"long long int"
+.LASF936:
+	.string	"_yp_IMMORTAL_FUNCTION(qual,name,code,parameters) static yp_parameter_decl_t _ ##name ##_parameters[] = {_yp_UNPACK parameters}; _yp_IMMORTAL_FUNCTION5( qual, name, code, yp_lengthof_array(_ ##name ##_parameters), _ ##name ##_parameters)"
+.LASF752:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1120:
+	.string	"WINT_MIN (0u)"
+.LASF1631:
+	.string	"MunitTestFunc"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1307:
+	.string	"MUNIT_NO_RETURN _Noreturn"
+.LASF1056:
+	.string	"EXIT_FAILURE 1"
+.LASF1678:
+	.string	"rand_objs_func"
+.LASF1506:
+	.string	"SUITE_OF_TESTS(name) { \"/\" #name, (name ##_tests), NULL, 1, MUNIT_SUITE_OPTION_NONE }"
+.LASF1534:
+	.string	"assert_ssizeC_exc(a,op,b) _assert_typeC_exc(yp_ssize_t, a, op, b, PRIssize, \"%s\", \"%s\", #a, #b)"
+.LASF1017:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF919:
+	.string	"_ypBytes_CODE (16u)"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF931:
+	.string	"yp_IMMORTAL_STR_LATIN_1(name,value) _yp_IMMORTAL_STR_LATIN_1(, name, value)"
+.LASF1633:
+	.string	"MunitTestTearDown"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1388:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF1166:
+	.string	"PRIiFAST16 __PRIPTR_PREFIX \"i\""
+.LASF1444:
+	.string	"_STRINGIFY18(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r"
+.LASF807:
+	.string	"__DEFINED_size_t "
+.LASF972:
+	.string	"MUNIT_H "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF912:
+	.string	"_ypObject_LEN_INVALID ((yp_ssize_t) - 1)"
+.LASF888:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1325:
+	.string	"munit_assert_uint(a,op,b) munit_assert_type(unsigned int, \"u\", a, op, b)"
+.LASF1007:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF598:
+	.string	"_POSIX_SYMLOOP_MAX 8"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF570:
+	.string	"LLONG_MAX __LONG_LONG_MAX__"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF727:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1423:
+	.string	"_ESC(...) __VA_ARGS__"
+.LASF466:
+	.string	"__PMT"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF580:
+	.string	"_POSIX_LOGIN_NAME_MAX 9"
+.LASF1313:
+	.string	"munit_errorf(format,...) munit_errorf_ex(__FILE__, __LINE__, format, __VA_ARGS__)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF420:
+	.string	"__USE_ATFILE"
+.LASF1393:
+	.string	"_IOLBF 1"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1546:
+	.string	"_assert_obj(a,op,b,a_fmt,b_fmt,...) do { ypObject *_ypmt_OBJ_result = yp_ ##op(a, b); _assert_bool(_ypmt_OBJ_result, yp_True, yp_False, \"yp_\" #op \"(\" a_fmt \", \" b_fmt \")\", __VA_ARGS__); } while (0)"
+.LASF1190:
+	.string	"PRIuFAST16 __PRIPTR_PREFIX \"u\""
+.LASF1199:
+	.string	"PRIxLEAST32 \"x\""
+.LASF1560:
+	.ascii	"_assert_mapping(obj,items,obj_fmt,item_strs,...) do { yp_ssi"
+	.ascii	"ze_t _ypmt_MAP_k = yp_lengthof_array(items) / 2; int _ypmt_M"
+	.ascii	"AP_found[yp_lengthof_array(items) / 2] = {0}; yp_uint64_t _y"
+	.ascii	"pmt_MAP_mi_state; ypObject *_ypmt_MAP_mi; ypObject *_ypmt_MA"
+	.ascii	"P_actual_key; ypObject *_ypmt_MAP_actual_value; yp_ssize_t _"
+	.ascii	"ypmt_MAP_ki; if (yp_lengthof_array(items) % 2 != 0) { munit_"
+	.ascii	"error(\"expected an even number of objects for the (key, val"
+	.ascii	"ue) pairs\"); } _assert_len(obj, _ypmt_MAP_k, obj_fmt, \"%\""
+	.ascii	" PRIssize, __VA_ARGS__, _ypmt_MAP_k); _assert_not_raises(_yp"
+	.ascii	"mt_MAP_mi = yp_miniiter_items(obj, &_ypmt_MAP_mi_state), \"y"
+	.ascii	"p_miniiter_items(\" obj_fmt \", &mi_state)\", __VA_ARGS__); "
+	.ascii	"while (_assert_mapping_helper(_ypmt_MAP_mi, &_ypmt_MAP_mi_st"
+	.ascii	"ate, _ypmt_MAP_k, items, &_ypmt_MAP_actual_key , &_ypmt_MAP_"
+	.ascii	"actual_value , &_ypmt_MAP_ki)) { _assert_not_exception(_ypmt"
+	.ascii	"_MAP_actual_key, \"yp_miniiter_items_next(yp_miniiter_items("
+	.ascii	"\" obj_fmt \", &mi_state), &mi_state)\", __VA_ARGS__); if (_"
+	.ascii	"ypmt_MAP_ki >= _ypmt_MAP_k) { munit_errorf(\"unexpected item"
+	.ascii	" yielded from \" obj_fmt, __VA_ARGS__); } if (_ypmt_MAP_foun"
+	.ascii	"d[_ypmt_MAP_ki]) { munit_errorf(\"%s yielded twice from \" o"
+	.ascii	"bj_fmt, item_strs[_ypmt_MAP_ki * 2], __VA_ARGS__); } _ypmt_M"
+	.ascii	"AP_found[_ypmt_MAP_ki] = TRUE; _assert_same_type(_ypmt_MAP_a"
+	.ascii	"ctual_key, items[_ypmt_MAP_ki * 2], \"<key in \" obj_fmt \">"
+	.ascii	"\", \"%s\", __VA_ARGS__, item_strs[_ypmt_MAP_ki * 2]); _asse"
+	.ascii	"rt_eq_same_type(_ypmt_MAP_actual_value, items[_ypmt_MAP_ki *"
+	.ascii	" 2 + 1], \"<value \" obj_fmt \"[%s]>\", \"%s\", __VA_ARGS__,"
+	.ascii	" item_strs[_ypmt_MAP_ki * 2], item_strs[_ypmt_MAP_ki * 2 + 1"
+	.ascii	"]); yp_decref(_ypmt_MAP_actual_key); yp_decref(_ypmt_M"
+	.string	"AP_actual_value); } for (_ypmt_MAP_ki = 0; _ypmt_MAP_ki < _ypmt_MAP_k; _ypmt_MAP_ki++) { if (!_ypmt_MAP_found[_ypmt_MAP_ki]) { munit_errorf( \"%s not yielded from \" obj_fmt, item_strs[_ypmt_MAP_ki * 2], __VA_ARGS__); } } yp_decref(_ypmt_MAP_mi); } while (0)"
+.LASF891:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1018:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1392:
+	.string	"_IOFBF 0"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1107:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF660:
+	.string	"LINE_MAX _POSIX2_LINE_MAX"
+.LASF1572:
+	.string	"obj_array_init(n,expression) {_COMMA_REPEAT ##n((expression))}"
+.LASF946:
+	.string	"yp_ELIFd(expression) _yp_ELIF(expression, yp_decref(_yp_IF_expr))"
+.LASF1114:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1681:
+	.string	"param_values_types_collection"
+.LASF754:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1446:
+	.string	"_STRINGIFY20(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1328:
+	.string	"munit_assert_llong(a,op,b) munit_assert_type(long long int, \"lld\", a, op, b)"
+.LASF1571:
+	.string	"define_function2(name,code) yp_function_decl_t _ ##name ##_declaration = {(code), 0, 0, NULL, NULL, NULL}; ypObject *name = yp_functionC(&_ ##name ##_declaration)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1193:
+	.string	"PRIx8 \"x\""
+.LASF1495:
+	.string	"VA_ARGC(...) (_PP_NARG(, __VA_ARGS__, _PP_RSEQ_N()))"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF751:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1632:
+	.string	"MunitTestSetup"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF744:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1657:
+	.string	"is_numeric"
+.LASF1376:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF1525:
+	.ascii	"_assert_isexception(obj,n,expected,obj_fmt,expected_fmt,...)"
+	.ascii	" do { if (n < 1) { munit_error(\"missing expected exception "
+	.ascii	"in assertion\"); } if (!yp_isexceptionC(obj)) { munit_error"
+	.string	"f(\"assertion failed: yp_isexceptionC(\" obj_fmt \") (expected \" expected_fmt \")\", __VA_ARGS__); } if (!yp_isexception_arrayC(obj, n, expected)) { munit_errorf(\"assertion failed: yp_isexceptionCN(\" obj_fmt \", N(\" expected_fmt \"))\", __VA_ARGS__); } } while (0)"
+.LASF392:
+	.string	"unittest_snprintf snprintf"
+.LASF1646:
+	.string	"falsy"
+.LASF1438:
+	.string	"_STRINGIFY12(a,b,c,d,e,f,g,h,i,j,k,l) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l"
+.LASF683:
+	.string	"INT_MIN"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF795:
+	.string	"__SIZE_T__ "
+.LASF1292:
+	.string	"SCNuMAX __PRI64_PREFIX \"u\""
+.LASF1608:
+	.string	"yp_None"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF740:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF390:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF597:
+	.string	"_POSIX_SYMLINK_MAX 255"
+.LASF1304:
+	.string	"MUNIT_SIZE_MODIFIER \"z\""
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1220:
+	.string	"PRIuMAX __PRI64_PREFIX \"u\""
+.LASF600:
+	.string	"_POSIX_TTY_NAME_MAX 9"
+.LASF1432:
+	.string	"_STRINGIFY6(a,b,c,d,e,f) #a, #b, #c, #d, #e, #f"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1467:
+	.string	"_COMMA_REPEAT7(x) x, x, x, x, x, x, x"
+.LASF1310:
+	.string	"MUNIT_PRINTF(string_index,first_to_check) __attribute__((format (printf, string_index, first_to_check)))"
+.LASF576:
+	.string	"_POSIX_CHILD_MAX 25"
+.LASF1195:
+	.string	"PRIx32 \"x\""
+.LASF1183:
+	.string	"PRIu32 \"u\""
+.LASF1435:
+	.string	"_STRINGIFY9(a,b,c,d,e,f,g,h,i) #a, #b, #c, #d, #e, #f, #g, #h, #i"
+.LASF1579:
+	.string	"unsigned int"
+.LASF1228:
+	.string	"PRIXPTR __PRIPTR_PREFIX \"X\""
+.LASF845:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1505:
+	.string	"TEST(name,parameters) { \"/\" #name, (MunitTestFunc)(name), (MunitTestSetup)fixture_setup, (MunitTestTearDown)fixture_tear_down, MUNIT_TEST_OPTION_NONE, parameters }"
+.LASF682:
+	.string	"USHRT_MAX (SHRT_MAX * 2 + 1)"
+.LASF1064:
+	.string	"MUNIT_CURRENT_VERSION MUNIT_VERSION(0, 4, 1)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1498:
+	.string	"STRINGIFY(...) _ESC(_PP_NARG(_STRINGIFY, __VA_ARGS__, _PP_RSEQ_N())(__VA_ARGS__))"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF823:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1658:
+	.string	"is_iterable"
+.LASF732:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF593:
+	.string	"_POSIX_SEM_VALUE_MAX 32767"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1651:
+	.string	"newN"
+.LASF1583:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1141:
+	.string	"_INTTYPES_H 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1324:
+	.string	"munit_assert_int(a,op,b) munit_assert_type(int, \"d\", a, op, b)"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1380:
+	.string	"____mbstate_t_defined 1"
+.LASF681:
+	.string	"USHRT_MAX"
+.LASF1639:
+	.string	"MunitTest"
+.LASF728:
+	.string	"__S64_TYPE long int"
+.LASF796:
+	.string	"_SIZE_T "
+.LASF637:
+	.string	"DELAYTIMER_MAX 2147483647"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1138:
+	.string	"munit_uint32_t uint32_t"
+.LASF1161:
+	.string	"PRIiLEAST8 \"i\""
+.LASF623:
+	.string	"LINK_MAX"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1637:
+	.string	"options"
+.LASF1337:
+	.string	"munit_assert_uint16(a,op,b) munit_assert_type(munit_uint16_t, PRIu16, a, op, b)"
+.LASF700:
+	.string	"_STDARG_H "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1373:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1202:
+	.string	"PRIxFAST16 __PRIPTR_PREFIX \"x\""
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1021:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF657:
+	.string	"BC_STRING_MAX _POSIX2_BC_STRING_MAX"
+.LASF1469:
+	.string	"_COMMA_REPEAT9(x) x, x, x, x, x, x, x, x, x"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1458:
+	.string	"_STRINGIFY32(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,A,B,C,D,E,F) #a, #b, #c, #d, #e, #f, #g, #h, #i, #j, #k, #l, #m, #n, #o, #p, #q, #r, #s, #t, #u, #v, #w, #x, #y, #z, #A, #B, #C, #D, #E, #F"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1238:
+	.string	"SCNdFAST16 __PRIPTR_PREFIX \"d\""
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"Lib/munit_test/test_protocols/test_collection.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits